@@ -25,6 +25,50 @@
 
 #include "vtkDataArray.h"
 #include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+
+#include <map>
+#include <mutex>
+
+namespace tovtkm
+{
+
+namespace
+{
+
+// Registry of VTK arrays whose buffers have been adopted by VTK-m array
+// handles. The buffer pointer is the key because the deleter VTK-m calls
+// is a plain function that only receives that pointer; a multimap is used
+// since several handles may adopt buffers of the same array (one per SOA
+// component) and the same pointer may be registered more than once.
+std::mutex ArrayLifetimeMutex;
+
+std::multimap<void*, vtkSmartPointer<vtkDataArray>>& ArrayLifetimeRegistry()
+{
+  static std::multimap<void*, vtkSmartPointer<vtkDataArray>> registry;
+  return registry;
+}
+
+} // anonymous namespace
+
+void RegisterArrayLifetime(void* memory, vtkDataArray* owner)
+{
+  std::lock_guard<std::mutex> guard(ArrayLifetimeMutex);
+  ArrayLifetimeRegistry().emplace(memory, owner);
+}
+
+void ReleaseArrayLifetime(void* memory)
+{
+  std::lock_guard<std::mutex> guard(ArrayLifetimeMutex);
+  auto& registry = ArrayLifetimeRegistry();
+  auto it = registry.find(memory);
+  if (it != registry.end())
+  {
+    registry.erase(it);
+  }
+}
+
+} // tovtkm
 
 namespace fromvtkm
 {
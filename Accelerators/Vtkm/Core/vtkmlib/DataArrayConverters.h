@@ -23,6 +23,7 @@
 #include "vtkAOSDataArrayTemplate.h"
 #include "vtkSOADataArrayTemplate.h"
 
+#include <vtkm/cont/ArrayHandleBasic.h>
 #include <vtkm/cont/ArrayHandleSOA.h>
 #include <vtkm/cont/Field.h>
 #include <vtkm/cont/UnknownArrayHandle.h>
@@ -52,6 +53,15 @@ inline static const char* NoNameVTKFieldName()
   return name;
 }
 
+/// Keep a VTK data array alive for as long as a VTK-m ArrayHandle references
+/// its memory. The deleter handed to VTK-m is a plain function that only
+/// receives the memory pointer, so the pointer doubles as the registry key;
+/// ReleaseArrayLifetime is that deleter and drops one reference for the
+/// given pointer.
+///
+VTKACCELERATORSVTKMCORE_EXPORT void RegisterArrayLifetime(void* memory, vtkDataArray* owner);
+VTKACCELERATORSVTKMCORE_EXPORT void ReleaseArrayLifetime(void* memory);
+
 template <typename DataArrayType, vtkm::IdComponent NumComponents>
 struct DataArrayToArrayHandle;
 
@@ -65,8 +75,12 @@ struct DataArrayToArrayHandle<vtkAOSDataArrayTemplate<T>, NumComponents>
 
   static ArrayHandleType Wrap(vtkAOSDataArrayTemplate<T>* input)
   {
-    return vtkm::cont::make_ArrayHandle(reinterpret_cast<ValueType*>(input->GetPointer(0)),
-      input->GetNumberOfTuples(), vtkm::CopyFlag::Off);
+    // adopt the buffer without copying; the registered lifetime keeps the
+    // VTK array alive until the last ArrayHandle referencing it goes away
+    ValueType* memory = reinterpret_cast<ValueType*>(input->GetPointer(0));
+    RegisterArrayLifetime(memory, input);
+    return vtkm::cont::ArrayHandleBasic<ValueType>(
+      memory, input->GetNumberOfTuples(), ReleaseArrayLifetime);
   }
 };
 
@@ -83,9 +97,12 @@ struct DataArrayToArrayHandle<vtkSOADataArrayTemplate<T>, NumComponents>
     vtkm::cont::ArrayHandleSOA<ValueType> handle;
     for (vtkm::IdComponent i = 0; i < NumComponents; ++i)
     {
-      handle.SetArray(i,
-        vtkm::cont::make_ArrayHandle<T>(reinterpret_cast<T*>(input->GetComponentArrayPointer(i)),
-          numValues, vtkm::CopyFlag::Off));
+      // adopt each component buffer without copying; the registered
+      // lifetimes keep the VTK array alive until every component handle
+      // referencing it goes away
+      T* memory = reinterpret_cast<T*>(input->GetComponentArrayPointer(i));
+      RegisterArrayLifetime(memory, input);
+      handle.SetArray(i, vtkm::cont::ArrayHandleBasic<T>(memory, numValues, ReleaseArrayLifetime));
     }
 
     return std::move(handle);
@@ -100,8 +117,9 @@ struct DataArrayToArrayHandle<vtkSOADataArrayTemplate<T>, 1>
 
   static ArrayHandleType Wrap(vtkSOADataArrayTemplate<T>* input)
   {
-    return vtkm::cont::make_ArrayHandle(
-      input->GetComponentArrayPointer(0), input->GetNumberOfTuples(), vtkm::CopyFlag::Off);
+    T* memory = input->GetComponentArrayPointer(0);
+    RegisterArrayLifetime(memory, input);
+    return vtkm::cont::ArrayHandleBasic<T>(memory, input->GetNumberOfTuples(), ReleaseArrayLifetime);
   }
 };
 
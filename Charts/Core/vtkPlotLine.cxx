@@ -92,10 +92,13 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
   }
   else
   {
-    // draw lines between all points
+    // draw lines between all points; very large series may be drawn from
+    // the M4 aggregate instead. Line pairs must keep their pairing and are
+    // always drawn in full.
     if (this->PolyLine)
     {
-      painter->DrawPoly(this->Points);
+      vtkPoints2D* downsampled = this->GetDownsampledPoints();
+      painter->DrawPoly(downsampled ? downsampled : this->Points);
     }
     else
     {
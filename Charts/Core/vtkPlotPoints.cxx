@@ -29,10 +29,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkPen.h"
 #include "vtkPoints2D.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTable.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <set>
 #include <vector>
@@ -81,6 +84,11 @@ vtkPlotPoints::vtkPlotPoints()
 
   this->UnscaledInputBounds[0] = this->UnscaledInputBounds[2] = vtkMath::Inf();
   this->UnscaledInputBounds[1] = this->UnscaledInputBounds[3] = -vtkMath::Inf();
+
+  this->DownsamplingEnabled = true;
+  this->DownsampledRange[0] = this->DownsampledRange[1] = 0.0;
+  this->DownsampledColumns = 0;
+  this->MonotonicX = false;
 }
 
 //------------------------------------------------------------------------------
@@ -169,9 +177,18 @@ bool vtkPlotPoints::Paint(vtkContext2D* painter)
     }
     else
     {
-      // draw all of the points
-      painter->DrawMarkers(this->MarkerStyle, false, points, this->Points->GetNumberOfPoints(),
-        colors, nColorComponents);
+      // draw all of the points, or the M4 aggregate for very large series.
+      // Per-point colors index the full series, so they disable aggregation.
+      vtkIdType numPoints = this->Points->GetNumberOfPoints();
+      if (!colors)
+      {
+        if (vtkPoints2D* downsampled = this->GetDownsampledPoints())
+        {
+          points = static_cast<float*>(downsampled->GetVoidPointer(0));
+          numPoints = downsampled->GetNumberOfPoints();
+        }
+      }
+      painter->DrawMarkers(this->MarkerStyle, false, points, numPoints, colors, nColorComponents);
     }
   }
 
@@ -273,6 +290,116 @@ bool inRange(const vtkVector2f& point, const vtkVector2f& tol, const vtkVector2f
     current.GetY() > point.GetY() - tol.GetY() && current.GetY() < point.GetY() + tol.GetY();
 }
 
+// Per-pixel-column accumulator for M4 downsampling: the indices of the
+// first, last, lowest, and highest samples that land in the column.
+struct M4Bucket
+{
+  vtkIdType First = -1;
+  vtkIdType Last = -1;
+  vtkIdType Min = -1;
+  vtkIdType Max = -1;
+  float MinY = 0.f;
+  float MaxY = 0.f;
+
+  void Add(vtkIdType index, float y)
+  {
+    if (this->First < 0)
+    {
+      this->First = this->Last = this->Min = this->Max = index;
+      this->MinY = this->MaxY = y;
+      return;
+    }
+    this->First = std::min(this->First, index);
+    this->Last = std::max(this->Last, index);
+    if (y < this->MinY)
+    {
+      this->MinY = y;
+      this->Min = index;
+    }
+    if (y > this->MaxY)
+    {
+      this->MaxY = y;
+      this->Max = index;
+    }
+  }
+
+  void Merge(const M4Bucket& other)
+  {
+    if (other.First < 0)
+    {
+      return;
+    }
+    if (this->First < 0)
+    {
+      *this = other;
+      return;
+    }
+    this->First = std::min(this->First, other.First);
+    this->Last = std::max(this->Last, other.Last);
+    if (other.MinY < this->MinY)
+    {
+      this->MinY = other.MinY;
+      this->Min = other.Min;
+    }
+    if (other.MaxY > this->MaxY)
+    {
+      this->MaxY = other.MaxY;
+      this->Max = other.Max;
+    }
+  }
+};
+
+// Bin every sample of the series into pixel columns in parallel. Samples
+// outside the visible range land in the edge columns, which keeps the line
+// continuous while panning.
+class M4SampleFunctor
+{
+public:
+  M4SampleFunctor(const vtkVector2f* points, double rangeMin, double invColumnWidth, int columns)
+    : Points(points)
+    , RangeMin(rangeMin)
+    , InvColumnWidth(invColumnWidth)
+    , Columns(columns)
+  {
+  }
+
+  void Initialize() { this->Local.Local().resize(this->Columns); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<M4Bucket>& buckets = this->Local.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      int column =
+        static_cast<int>((this->Points[i].GetX() - this->RangeMin) * this->InvColumnWidth);
+      column = std::max(0, std::min(this->Columns - 1, column));
+      buckets[column].Add(i, this->Points[i].GetY());
+    }
+  }
+
+  void Reduce()
+  {
+    this->Buckets.clear();
+    this->Buckets.resize(this->Columns);
+    for (const std::vector<M4Bucket>& local : this->Local)
+    {
+      for (int column = 0; column < this->Columns; ++column)
+      {
+        this->Buckets[column].Merge(local[column]);
+      }
+    }
+  }
+
+  std::vector<M4Bucket> Buckets;
+
+private:
+  const vtkVector2f* Points;
+  double RangeMin;
+  double InvColumnWidth;
+  int Columns;
+  vtkSMPThreadLocal<std::vector<M4Bucket>> Local;
+};
+
 }
 
 //------------------------------------------------------------------------------
@@ -288,6 +415,106 @@ void vtkPlotPoints::CreateSortedPoints()
   }
 }
 
+//------------------------------------------------------------------------------
+vtkPoints2D* vtkPlotPoints::GetDownsampledPoints()
+{
+  if (!this->DownsamplingEnabled || !this->Points || !this->XAxis ||
+    (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0))
+  {
+    return nullptr;
+  }
+
+  // One column per pixel along the x axis, capped to keep the aggregate
+  // small when the axis reports an unreasonable extent.
+  float* p1 = this->XAxis->GetPoint1();
+  float* p2 = this->XAxis->GetPoint2();
+  int columns = static_cast<int>(std::max(std::fabs(p2[0] - p1[0]), std::fabs(p2[1] - p1[1])));
+  columns = std::min(columns, 65536);
+  if (columns < 1)
+  {
+    return nullptr;
+  }
+
+  // Only engage when the aggregate is an unambiguous win: at least 16
+  // samples per pixel column.
+  const vtkIdType numPoints = this->Points->GetNumberOfPoints();
+  if (numPoints < 16 * static_cast<vtkIdType>(columns))
+  {
+    return nullptr;
+  }
+
+  // The visible range, transformed into the shifted/scaled space of Points.
+  vtkRectd ss = this->GetShiftScale();
+  double rangeMin = (this->XAxis->GetMinimum() + ss.GetX()) * ss.GetWidth();
+  double rangeMax = (this->XAxis->GetMaximum() + ss.GetX()) * ss.GetWidth();
+  if (rangeMax < rangeMin)
+  {
+    std::swap(rangeMin, rangeMax);
+  }
+  if (!(rangeMax > rangeMin))
+  {
+    return nullptr;
+  }
+
+  const vtkVector2f* data = static_cast<vtkVector2f*>(this->Points->GetVoidPointer(0));
+
+  // M4 assumes an x-monotone series (e.g. a time series); check once per
+  // data change and bypass downsampling for scatter-like data.
+  if (this->Points->GetMTime() > this->MonotonicCheckTime)
+  {
+    this->MonotonicX = true;
+    for (vtkIdType i = 1; i < numPoints && this->MonotonicX; ++i)
+    {
+      this->MonotonicX = data[i].GetX() >= data[i - 1].GetX();
+    }
+    this->MonotonicCheckTime.Modified();
+  }
+  if (!this->MonotonicX)
+  {
+    return nullptr;
+  }
+
+  // Reuse the cache while the data, zoom level, and viewport width match.
+  if (this->DownsampledBuildTime > this->Points->GetMTime() &&
+    this->DownsampledColumns == columns && this->DownsampledRange[0] == rangeMin &&
+    this->DownsampledRange[1] == rangeMax)
+  {
+    return this->DownsampledPoints;
+  }
+
+  M4SampleFunctor functor(data, rangeMin, columns / (rangeMax - rangeMin), columns);
+  vtkSMPTools::For(0, numPoints, functor);
+
+  // Emit up to four samples per column, ordered by index so the polyline
+  // keeps the acquisition order of the series.
+  this->DownsampledPoints->SetNumberOfPoints(0);
+  this->DownsampledPoints->GetData()->Allocate(2 * 4 * static_cast<vtkIdType>(columns));
+  for (const M4Bucket& bucket : functor.Buckets)
+  {
+    if (bucket.First < 0)
+    {
+      continue;
+    }
+    vtkIdType ids[4] = { bucket.First, bucket.Min, bucket.Max, bucket.Last };
+    std::sort(ids, ids + 4);
+    vtkIdType previous = -1;
+    for (vtkIdType id : ids)
+    {
+      if (id != previous)
+      {
+        this->DownsampledPoints->InsertNextPoint(data[id].GetX(), data[id].GetY());
+        previous = id;
+      }
+    }
+  }
+
+  this->DownsampledRange[0] = rangeMin;
+  this->DownsampledRange[1] = rangeMax;
+  this->DownsampledColumns = columns;
+  this->DownsampledBuildTime.Modified();
+  return this->DownsampledPoints;
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkPlotPoints::GetNearestPoint(const vtkVector2f& point, const vtkVector2f& tol,
   vtkVector2f* location, vtkIdType* vtkNotUsed(segmentId))
@@ -964,4 +1191,5 @@ vtkStdString vtkPlotPoints::GetColorArrayName()
 void vtkPlotPoints::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "DownsamplingEnabled: " << this->DownsamplingEnabled << endl;
 }
@@ -177,6 +177,23 @@ public:
   vtkSetMacro(ValidPointMaskName, vtkStdString);
   ///@}
 
+  ///@{
+  /**
+   * When enabled (the default), very large series are drawn from a cached
+   * min/max-per-pixel-column (M4) aggregate of the points instead of from
+   * every sample. The aggregate keeps the first, last, lowest, and highest
+   * sample in each pixel column, so visual extremes are preserved while at
+   * most a few thousand vertices reach the painter. The aggregate is
+   * recomputed when the data, the zoom level, or the viewport width
+   * changes. Only x-monotone series with no bad points are downsampled;
+   * scatter-like data is always drawn in full, as are per-point colors and
+   * selections.
+   */
+  vtkSetMacro(DownsamplingEnabled, vtkTypeBool);
+  vtkGetMacro(DownsamplingEnabled, vtkTypeBool);
+  vtkBooleanMacro(DownsamplingEnabled, vtkTypeBool);
+  ///@}
+
   /**
    * Update the internal cache. Returns true if cache was successfully updated. Default does
    * nothing.
@@ -227,6 +244,15 @@ protected:
    */
   void CreateSortedPoints();
 
+  /**
+   * Return the M4 aggregate of Points for the current x-axis zoom and
+   * viewport width, rebuilding the cache when it is out of date. Returns
+   * nullptr when downsampling does not apply (disabled, too few points,
+   * bad points present, or a non x-monotone series), in which case the
+   * caller should draw the full point set.
+   */
+  vtkPoints2D* GetDownsampledPoints();
+
   ///@{
   /**
    * Store a well packed set of XY coordinates for this data series.
@@ -243,6 +269,26 @@ protected:
   VectorPIMPL* Sorted;
   ///@}
 
+  ///@{
+  /**
+   * M4 aggregate of Points and the cache key (data time, visible x range
+   * in the space of Points, pixel column count) it was built for.
+   */
+  vtkNew<vtkPoints2D> DownsampledPoints;
+  vtkTimeStamp DownsampledBuildTime;
+  double DownsampledRange[2];
+  int DownsampledColumns;
+  vtkTypeBool DownsamplingEnabled;
+  ///@}
+
+  ///@{
+  /**
+   * Whether the series is monotone in x, checked once per data change.
+   */
+  bool MonotonicX;
+  vtkTimeStamp MonotonicCheckTime;
+  ///@}
+
   /**
    * An array containing the indices of all the "bad points", meaning any x, y
    * pair that has an infinity, -infinity or not a number value.
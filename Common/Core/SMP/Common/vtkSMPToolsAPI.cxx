@@ -57,6 +57,13 @@ vtkSMPToolsAPI::vtkSMPToolsAPI()
     this->SetBackend(vtkSMPBackendInUse);
   }
 
+  // Enable worker thread pinning from env if set
+  const char* vtkSMPThreadAffinity = std::getenv("VTK_SMP_THREAD_AFFINITY");
+  if (vtkSMPThreadAffinity)
+  {
+    this->ThreadAffinity = (std::string(vtkSMPThreadAffinity) != "0");
+  }
+
   // Set max thread number from env
   this->RefreshNumberOfThread();
 }
@@ -217,6 +224,18 @@ bool vtkSMPToolsAPI::IsParallelScope()
   return false;
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetThreadAffinity(bool enable)
+{
+  this->ThreadAffinity = enable;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsAPI::GetThreadAffinity()
+{
+  return this->ThreadAffinity;
+}
+
 } // namespace smp
 } // namespace detail
 } // namespace vtk
@@ -76,6 +76,12 @@ public:
   //--------------------------------------------------------------------------------
   bool IsParallelScope();
 
+  //--------------------------------------------------------------------------------
+  void SetThreadAffinity(bool enable);
+
+  //--------------------------------------------------------------------------------
+  bool GetThreadAffinity();
+
   //--------------------------------------------------------------------------------
   int GetInternalDesiredNumberOfThread() { return this->DesiredNumberOfThread; }
 
@@ -257,6 +263,11 @@ private:
    */
   int DesiredNumberOfThread = 0;
 
+  /**
+   * Whether backends that own their worker threads should pin them to CPUs.
+   */
+  bool ThreadAffinity = false;
+
   /**
    * Sequential backend
    */
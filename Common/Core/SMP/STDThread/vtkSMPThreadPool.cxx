@@ -15,15 +15,55 @@
 
 #include "SMP/STDThread/vtkSMPThreadPool.h"
 
-#include <iostream>
+#include "SMP/Common/vtkSMPToolsAPI.h"
+
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 vtk::detail::smp::vtkSMPThreadPool::vtkSMPThreadPool(int threadNumber)
 {
+  this->Queues.reserve(threadNumber);
+  for (int i = 0; i < threadNumber; ++i)
+  {
+    this->Queues.emplace_back(new ThreadQueue);
+  }
+
   this->Threads.reserve(threadNumber);
   for (int i = 0; i < threadNumber; ++i)
   {
-    this->Threads.emplace_back(std::bind(&vtkSMPThreadPool::ThreadJob, this));
+    this->Threads.emplace_back(std::bind(&vtkSMPThreadPool::ThreadJob, this, i));
+  }
+
+  if (vtkSMPToolsAPI::GetInstance().GetThreadAffinity())
+  {
+    this->PinThreads();
+  }
+}
+
+void vtk::detail::smp::vtkSMPThreadPool::PinThreads()
+{
+  // Pin the workers round-robin across the available CPUs, so that each
+  // worker keeps its caches and, on NUMA machines, the memory pages it
+  // first-touched. Only supported on Linux; elsewhere the affinity flag is
+  // a no-op and the OS scheduler places the threads.
+#if defined(__linux__)
+  const unsigned int numCpus = std::thread::hardware_concurrency();
+  if (numCpus == 0)
+  {
+    return;
+  }
+  for (std::size_t i = 0; i < this->Threads.size(); ++i)
+  {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(static_cast<int>(i % numCpus), &cpuSet);
+    pthread_setaffinity_np(this->Threads[i].native_handle(), sizeof(cpu_set_t), &cpuSet);
   }
+#endif
 }
 
 void vtk::detail::smp::vtkSMPThreadPool::Join()
@@ -43,32 +83,79 @@ void vtk::detail::smp::vtkSMPThreadPool::Join()
 
 void vtk::detail::smp::vtkSMPThreadPool::DoJob(std::function<void(void)> job)
 {
-  std::unique_lock<std::mutex> lock(this->Mutex);
+  // Distribute jobs round-robin over the per-thread queues. Workers that
+  // drain their own queue early will steal the remainder, so the initial
+  // placement only matters for locality, not for balance.
+  const unsigned int queueId = this->NextQueue++ % static_cast<unsigned int>(this->Queues.size());
+  ThreadQueue& queue = *this->Queues[queueId];
+
+  {
+    std::unique_lock<std::mutex> queueLock(queue.Mutex);
+    queue.Jobs.emplace_back(std::move(job));
+  }
+  ++this->JobCount;
 
-  this->JobQueue.emplace(std::move(job));
+  std::unique_lock<std::mutex> lock(this->Mutex);
   this->ConditionVariable.notify_one();
 }
 
-void vtk::detail::smp::vtkSMPThreadPool::ThreadJob()
+bool vtk::detail::smp::vtkSMPThreadPool::TryPopOwn(int threadId, std::function<void(void)>& job)
+{
+  ThreadQueue& queue = *this->Queues[threadId];
+  std::unique_lock<std::mutex> lock(queue.Mutex);
+
+  if (queue.Jobs.empty())
+  {
+    return false;
+  }
+
+  job = std::move(queue.Jobs.back());
+  queue.Jobs.pop_back();
+  return true;
+}
+
+bool vtk::detail::smp::vtkSMPThreadPool::TrySteal(int threadId, std::function<void(void)>& job)
+{
+  const int queueNumber = static_cast<int>(this->Queues.size());
+  for (int offset = 1; offset < queueNumber; ++offset)
+  {
+    ThreadQueue& victim = *this->Queues[(threadId + offset) % queueNumber];
+    std::unique_lock<std::mutex> lock(victim.Mutex);
+
+    if (!victim.Jobs.empty())
+    {
+      // Steal from the opposite end that the owner uses, so the thief and
+      // the owner contend as little as possible and stolen jobs are the
+      // oldest (largest remaining) ones.
+      job = std::move(victim.Jobs.front());
+      victim.Jobs.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void vtk::detail::smp::vtkSMPThreadPool::ThreadJob(int threadId)
 {
   std::function<void(void)> job;
 
   while (true)
   {
+    if (this->TryPopOwn(threadId, job) || this->TrySteal(threadId, job))
     {
-      std::unique_lock<std::mutex> lock(this->Mutex);
+      --this->JobCount;
+      job();
+      job = nullptr;
+      continue;
+    }
 
-      this->ConditionVariable.wait(
-        lock, [this] { return (!this->JobQueue.empty() || this->Joining); });
+    std::unique_lock<std::mutex> lock(this->Mutex);
 
-      if (this->JobQueue.empty())
-      {
-        return;
-      }
+    this->ConditionVariable.wait(lock, [this] { return (this->JobCount > 0 || this->Joining); });
 
-      job = std::move(this->JobQueue.front());
-      this->JobQueue.pop();
+    if (this->JobCount <= 0 && this->Joining)
+    {
+      return;
     }
-    job();
   }
 }
@@ -12,14 +12,18 @@
     PURPOSE.  See the above copyright notice for more information.
 
 =========================================================================*/
-// .NAME vtkSMPThreadPool - A thread pool implementation using std::thread
+// .NAME vtkSMPThreadPool - A work-stealing thread pool implementation using std::thread
 //
 // .SECTION Description
 // vtkSMPThreadPool class creates a thread pool of std::thread, the number
 // of thread must be specified at the initialization of the class.
-// The DoJob() method is used attributes the job to a free thread, if all
-// threads are working, the job is kept in a queue. Note that vtkSMPThreadPool
-// destructor joins threads and finish the jobs in the queue.
+// Each worker thread owns a double-ended job queue: DoJob() distributes
+// jobs over the per-thread queues round-robin, workers pop jobs from the
+// back of their own queue and, when it runs empty, steal jobs from the
+// front of another worker's queue. This keeps all threads busy on
+// irregular workloads where per-job cost varies widely, without requiring
+// TBB. Note that vtkSMPThreadPool destructor joins threads and finishes
+// the jobs left in the queues.
 
 #ifndef vtkSMPThreadPool_h
 #define vtkSMPThreadPool_h
@@ -27,11 +31,14 @@
 #include "vtkCommonCoreModule.h" // For export macro
 #include "vtkSystemIncludes.h"
 
+#include <atomic>             // For std::atomic
 #include <condition_variable> // For std::condition_variable
+#include <deque>              // For std::deque
 #include <functional>         // For std::function
+#include <memory>             // For std::unique_ptr
 #include <mutex>              // For std::mutex
-#include <queue>              // For std::queue
 #include <thread>             // For std::thread
+#include <vector>             // For std::vector
 
 namespace vtk
 {
@@ -49,13 +56,26 @@ public:
   void DoJob(std::function<void(void)> job);
 
 private:
-  void ThreadJob();
+  // Per-worker deque: the owner pops from the back, thieves steal from
+  // the front. The mutex only guards the deque itself, jobs run unlocked.
+  struct ThreadQueue
+  {
+    std::mutex Mutex;
+    std::deque<std::function<void(void)>> Jobs;
+  };
+
+  void ThreadJob(int threadId);
+  bool TryPopOwn(int threadId, std::function<void(void)>& job);
+  bool TrySteal(int threadId, std::function<void(void)>& job);
+  void PinThreads();
 
 private:
   std::mutex Mutex;
   bool Joining = false;
   std::condition_variable ConditionVariable;
-  std::queue<std::function<void(void)>> JobQueue;
+  std::atomic<vtkTypeInt64> JobCount{ 0 };
+  std::atomic<unsigned int> NextQueue{ 0 };
+  std::vector<std::unique_ptr<ThreadQueue>> Queues;
   std::vector<std::thread> Threads;
 };
 
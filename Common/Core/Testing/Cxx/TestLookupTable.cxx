@@ -20,6 +20,9 @@
 #include "vtkMathUtilities.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
+#include <vector>
+
 // simple macro for performing tests
 #define TestAssert(t)                                                                              \
   do                                                                                               \
@@ -239,5 +242,40 @@ int TestLookupTable(int, char*[])
 
   table->RemoveObserver(observerId);
 
+  // == check the threaded batch mapping against the serial path ==
+
+  table->SetScaleToLinear();
+  table->SetTableRange(lo, hi);
+  table->Build();
+
+  // large enough for MapScalarsThroughTable2 to map spans in parallel
+  const vtkIdType numValues = 300000;
+  std::vector<double> values(numValues);
+  for (vtkIdType i = 0; i < numValues; i++)
+  {
+    // include below-range, above-range and NaN values
+    values[i] = lo - step + (hi - lo + 2 * step) * i / (numValues - 1);
+    if (i % 1000 == 0)
+    {
+      values[i] = vtkMath::Nan();
+    }
+  }
+
+  std::vector<unsigned char> batchColors(4 * numValues);
+  table->MapScalarsThroughTable2(values.data(), batchColors.data(), VTK_DOUBLE,
+    static_cast<int>(numValues), 1, VTK_RGBA);
+
+  // small slices take the serial path
+  const vtkIdType sliceSize = 1000;
+  std::vector<unsigned char> sliceColors(4 * sliceSize);
+  for (vtkIdType start = 0; start < numValues; start += sliceSize)
+  {
+    const vtkIdType n = std::min(sliceSize, numValues - start);
+    table->MapScalarsThroughTable2(
+      values.data() + start, sliceColors.data(), VTK_DOUBLE, static_cast<int>(n), 1, VTK_RGBA);
+    TestAssert(
+      std::equal(sliceColors.begin(), sliceColors.begin() + 4 * n, batchColors.begin() + 4 * start));
+  }
+
   return rval;
 }
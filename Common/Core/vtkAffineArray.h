@@ -0,0 +1,165 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAffineArray.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkAffineArray
+ * @brief   implicit vtkGenericDataArray computing an affine function of
+ * the value index
+ *
+ *
+ * vtkAffineArray is a read-only vtkGenericDataArray implementation that
+ * evaluates Slope * valueIdx + Intercept on the fly instead of storing the
+ * values. The value index assumes AOS ordering, i.e.
+ * valueIdx = tupleIdx * NumberOfComponents + comp. Typical uses are
+ * regularly spaced coordinates of structured data and sequential ids,
+ * where materializing the array would waste memory proportional to the
+ * number of tuples.
+ *
+ * The array participates in vtkArrayDispatch when
+ * VTK_DISPATCH_IMPLICIT_ARRAYS is enabled, so dispatched filter kernels
+ * consume it at full speed through GetValue()/GetTypedComponent(). The
+ * write API required by vtkGenericDataArray (SetValue() and friends) is
+ * implemented as a no-op: allocation always succeeds and stores nothing.
+ *
+ * @sa
+ * vtkGenericDataArray vtkConstantArray vtkArrayDispatch
+ */
+
+#ifndef vtkAffineArray_h
+#define vtkAffineArray_h
+
+#include "vtkGenericDataArray.h"
+#include "vtkObjectFactory.h" // for VTK_STANDARD_NEW_BODY
+
+template <typename ValueTypeT>
+class vtkAffineArray : public vtkGenericDataArray<vtkAffineArray<ValueTypeT>, ValueTypeT>
+{
+  typedef vtkGenericDataArray<vtkAffineArray<ValueTypeT>, ValueTypeT> GenericDataArrayType;
+
+public:
+  typedef vtkAffineArray<ValueTypeT> SelfType;
+  vtkTemplateTypeMacro(SelfType, GenericDataArrayType);
+  typedef typename Superclass::ValueType ValueType;
+
+  static vtkAffineArray* New() { VTK_STANDARD_NEW_BODY(vtkAffineArray<ValueTypeT>); }
+
+  ///@{
+  /**
+   * Set/Get the slope of the affine function. The default is 1.
+   */
+  void SetSlope(ValueType slope)
+  {
+    if (slope != this->Slope)
+    {
+      this->Slope = slope;
+      this->Modified();
+    }
+  }
+  ValueType GetSlope() const { return this->Slope; }
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the intercept of the affine function. The default is 0.
+   */
+  void SetIntercept(ValueType intercept)
+  {
+    if (intercept != this->Intercept)
+    {
+      this->Intercept = intercept;
+      this->Modified();
+    }
+  }
+  ValueType GetIntercept() const { return this->Intercept; }
+  ///@}
+
+  /**
+   * Get the value at @a valueIdx, i.e. Slope * valueIdx + Intercept.
+   * @a valueIdx assumes AOS ordering.
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    return static_cast<ValueType>(this->Slope * valueIdx + this->Intercept);
+  }
+
+  /**
+   * Copy the tuple at @a tupleIdx into @a tuple.
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const vtkIdType valueIdx = tupleIdx * this->NumberOfComponents;
+    for (int comp = 0; comp < this->NumberOfComponents; ++comp)
+    {
+      tuple[comp] = this->GetValue(valueIdx + comp);
+    }
+  }
+
+  /**
+   * Get component @a comp of the tuple at @a tupleIdx.
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int comp) const
+  {
+    return this->GetValue(tupleIdx * this->NumberOfComponents + comp);
+  }
+
+  ///@{
+  /**
+   * This array is read-only: the write API required by vtkGenericDataArray
+   * does nothing. Use SetSlope()/SetIntercept() to change the function the
+   * array evaluates.
+   */
+  inline void SetValue(vtkIdType vtkNotUsed(valueIdx), ValueType vtkNotUsed(value)) {}
+  inline void SetTypedTuple(vtkIdType vtkNotUsed(tupleIdx), const ValueType* vtkNotUsed(tuple)) {}
+  inline void SetTypedComponent(
+    vtkIdType vtkNotUsed(tupleIdx), int vtkNotUsed(comp), ValueType vtkNotUsed(value))
+  {
+  }
+  ///@}
+
+  void PrintSelf(ostream& os, vtkIndent indent) override
+  {
+    this->Superclass::PrintSelf(os, indent);
+    os << indent << "Slope: " << this->Slope << "\n";
+    os << indent << "Intercept: " << this->Intercept << "\n";
+  }
+
+protected:
+  vtkAffineArray()
+    : Slope(1)
+    , Intercept(0)
+  {
+  }
+  ~vtkAffineArray() override = default;
+
+  ///@{
+  /**
+   * No storage is backing this array: allocation only has to succeed.
+   */
+  bool AllocateTuples(vtkIdType vtkNotUsed(numTuples)) { return true; }
+  bool ReallocateTuples(vtkIdType vtkNotUsed(numTuples)) { return true; }
+  ///@}
+
+  ValueType Slope;
+  ValueType Intercept;
+
+private:
+  vtkAffineArray(const vtkAffineArray&) = delete;
+  void operator=(const vtkAffineArray&) = delete;
+
+  friend class vtkGenericDataArray<vtkAffineArray<ValueTypeT>, ValueTypeT>;
+};
+
+#endif // vtkAffineArray_h
+
+// VTK-HeaderTest-Exclude: vtkAffineArray.h
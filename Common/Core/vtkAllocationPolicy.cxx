@@ -0,0 +1,147 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAllocationPolicy.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAllocationPolicy.h"
+
+#include "vtkObject.h" // For vtkGenericWarningMacro
+
+#include <atomic>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+// The installed policy. These are only written once, at startup, before any
+// arrays exist (see the class documentation); afterwards they are read from
+// many threads, hence the relaxed atomics.
+std::atomic<vtkMallocingFunction> PolicyMalloc{ static_cast<vtkMallocingFunction>(malloc) };
+std::atomic<vtkReallocingFunction> PolicyRealloc{ static_cast<vtkReallocingFunction>(realloc) };
+std::atomic<vtkFreeingFunction> PolicyFree{ static_cast<vtkFreeingFunction>(free) };
+
+std::atomic<vtkTypeUInt64> AllocationCount{ 0 };
+std::atomic<vtkTypeUInt64> ReallocationCount{ 0 };
+std::atomic<vtkTypeUInt64> FreeCount{ 0 };
+std::atomic<vtkTypeUInt64> BytesRequested{ 0 };
+
+void ResetStatistics()
+{
+  AllocationCount.store(0, std::memory_order_relaxed);
+  ReallocationCount.store(0, std::memory_order_relaxed);
+  FreeCount.store(0, std::memory_order_relaxed);
+  BytesRequested.store(0, std::memory_order_relaxed);
+}
+
+#if defined(__linux__)
+// Blocks at least this large are aligned to the x86-64/aarch64 huge page
+// size and advised for transparent huge page backing.
+constexpr size_t VTK_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+void* vtkHugePageMalloc(size_t size)
+{
+  if (size < VTK_HUGE_PAGE_SIZE)
+  {
+    return malloc(size);
+  }
+  void* pointer = nullptr;
+  if (posix_memalign(&pointer, VTK_HUGE_PAGE_SIZE, size) != 0)
+  {
+    return nullptr;
+  }
+  madvise(pointer, size, MADV_HUGEPAGE);
+  return pointer;
+}
+
+void* vtkHugePageRealloc(void* pointer, size_t size)
+{
+  // posix_memalign memory belongs to the malloc family, so plain realloc is
+  // valid; the grown block loses its alignment guarantee and stays on base
+  // pages. Growth-by-realloc is rare for large arrays -- they are sized up
+  // front -- so fresh allocations carry the benefit.
+  return realloc(pointer, size);
+}
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkAllocationPolicy::SetPolicy(vtkMallocingFunction mallocFunction,
+  vtkReallocingFunction reallocFunction, vtkFreeingFunction freeFunction)
+{
+  if (!mallocFunction || !reallocFunction || !freeFunction)
+  {
+    vtkGenericWarningMacro(<< "An allocation policy requires all three functions");
+    return;
+  }
+  if (AllocationCount.load(std::memory_order_relaxed) > 0)
+  {
+    vtkGenericWarningMacro(
+      << "The allocation policy should be installed before any arrays are allocated");
+  }
+  PolicyMalloc.store(mallocFunction, std::memory_order_relaxed);
+  PolicyRealloc.store(reallocFunction, std::memory_order_relaxed);
+  PolicyFree.store(freeFunction, std::memory_order_relaxed);
+  ResetStatistics();
+}
+
+//------------------------------------------------------------------------------
+void vtkAllocationPolicy::SetPolicyToDefault()
+{
+  vtkAllocationPolicy::SetPolicy(malloc, realloc, free);
+}
+
+//------------------------------------------------------------------------------
+void vtkAllocationPolicy::SetPolicyToHugePages()
+{
+#if defined(__linux__)
+  vtkAllocationPolicy::SetPolicy(vtkHugePageMalloc, vtkHugePageRealloc, free);
+#else
+  vtkAllocationPolicy::SetPolicyToDefault();
+#endif
+}
+
+//------------------------------------------------------------------------------
+void* vtkAllocationPolicy::Malloc(size_t size)
+{
+  AllocationCount.fetch_add(1, std::memory_order_relaxed);
+  BytesRequested.fetch_add(size, std::memory_order_relaxed);
+  return PolicyMalloc.load(std::memory_order_relaxed)(size);
+}
+
+//------------------------------------------------------------------------------
+void* vtkAllocationPolicy::Realloc(void* pointer, size_t size)
+{
+  ReallocationCount.fetch_add(1, std::memory_order_relaxed);
+  BytesRequested.fetch_add(size, std::memory_order_relaxed);
+  return PolicyRealloc.load(std::memory_order_relaxed)(pointer, size);
+}
+
+//------------------------------------------------------------------------------
+void vtkAllocationPolicy::Free(void* pointer)
+{
+  FreeCount.fetch_add(1, std::memory_order_relaxed);
+  PolicyFree.load(std::memory_order_relaxed)(pointer);
+}
+
+//------------------------------------------------------------------------------
+vtkAllocationPolicy::Statistics vtkAllocationPolicy::GetStatistics()
+{
+  Statistics statistics;
+  statistics.AllocationCount = AllocationCount.load(std::memory_order_relaxed);
+  statistics.ReallocationCount = ReallocationCount.load(std::memory_order_relaxed);
+  statistics.FreeCount = FreeCount.load(std::memory_order_relaxed);
+  statistics.BytesRequested = BytesRequested.load(std::memory_order_relaxed);
+  return statistics;
+}
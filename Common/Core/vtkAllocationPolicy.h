@@ -0,0 +1,96 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAllocationPolicy.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkAllocationPolicy
+ * @brief   process-wide allocation policy for bulk array memory
+ *
+ * vtkAllocationPolicy routes the allocations made by vtkBuffer -- and
+ * therefore the bulk memory behind every vtkDataArray -- through an
+ * application-installable malloc/realloc/free triple. The default policy is
+ * the plain C allocator. SetPolicyToHugePages() installs a built-in policy
+ * that aligns large blocks for transparent huge pages, which reduces TLB
+ * pressure on very large arrays. Applications with their own requirements
+ * (NUMA placement, pooled allocators for filter temporaries) install their
+ * allocator with SetPolicy().
+ *
+ * A policy must be installed once at startup, before any arrays are
+ * allocated: buffers freed after a policy change would otherwise be released
+ * through the wrong allocator. This mirrors the restriction on
+ * vtkObjectBase::SetMemkindDirectory(); when the memkind extended-memory
+ * allocator is active it takes precedence over the policy installed here.
+ *
+ * Simple counters are kept for the installed policy and can be read at any
+ * time with GetStatistics().
+ */
+
+#ifndef vtkAllocationPolicy_h
+#define vtkAllocationPolicy_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObjectBase.h"       // For the allocation function typedefs
+#include "vtkType.h"             // For vtkTypeUInt64
+
+class VTKCOMMONCORE_EXPORT vtkAllocationPolicy
+{
+public:
+  /**
+   * Counters gathered for the currently installed policy. Byte counts
+   * reflect the sizes requested from the policy, not what the underlying
+   * allocator reserves.
+   */
+  struct Statistics
+  {
+    vtkTypeUInt64 AllocationCount = 0;
+    vtkTypeUInt64 ReallocationCount = 0;
+    vtkTypeUInt64 FreeCount = 0;
+    vtkTypeUInt64 BytesRequested = 0;
+  };
+
+  ///@{
+  /**
+   * Install a process-wide allocation policy. All three functions must
+   * belong to the same allocator family. Installing a policy resets the
+   * statistics. SetPolicyToHugePages() installs a built-in policy that
+   * 2 MiB-aligns blocks of at least that size and advises the kernel to
+   * back them with transparent huge pages; on platforms without that
+   * support it is equivalent to the default policy.
+   */
+  static void SetPolicy(vtkMallocingFunction mallocFunction,
+    vtkReallocingFunction reallocFunction, vtkFreeingFunction freeFunction);
+  static void SetPolicyToDefault();
+  static void SetPolicyToHugePages();
+  ///@}
+
+  ///@{
+  /**
+   * Allocation entry points used by vtkBuffer. These dispatch to the
+   * installed policy and update the statistics.
+   */
+  static void* Malloc(size_t size);
+  static void* Realloc(void* pointer, size_t size);
+  static void Free(void* pointer);
+  ///@}
+
+  /**
+   * Return a snapshot of the counters for the installed policy.
+   */
+  static Statistics GetStatistics();
+
+private:
+  vtkAllocationPolicy() = delete;
+};
+
+#endif
+// VTK-HeaderTest-Exclude: vtkAllocationPolicy.h
@@ -17,11 +17,37 @@
 #include "vtkBitArrayIterator.h"
 #include "vtkIdList.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+
+#include <cstring>
 
 namespace
 {
 constexpr unsigned char InitializationMaskForUnusedBitsOfLastByte[8] = { 0x80, 0xc0, 0xe0, 0xf0,
   0xf8, 0xfc, 0xfe, 0xff };
+
+// Portable population count of a 64 bit word.
+inline int PopCount(vtkTypeUInt64 word)
+{
+  word = word - ((word >> 1) & 0x5555555555555555ull);
+  word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+  word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+  return static_cast<int>((word * 0x0101010101010101ull) >> 56);
+}
+
+// In-place byte-granular combination of two bit arrays, parallel over large
+// arrays; the inner loop vectorizes into full-width word operations.
+template <class Op>
+void CombineBytes(unsigned char* dest, const unsigned char* src, vtkIdType numBytes, Op op)
+{
+  vtkSMPTools::For(0, numBytes, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      dest[i] = op(dest[i], src[i]);
+    }
+  });
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -736,6 +762,170 @@ void vtkBitArray::RemoveLastTuple()
   this->DataChanged();
 }
 
+//------------------------------------------------------------------------------
+void vtkBitArray::BitwiseAnd(vtkBitArray* other)
+{
+  if (other == nullptr || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro(<< "Both arrays must have the same number of values.");
+    return;
+  }
+  CombineBytes(this->Array, other->Array, (this->MaxId + 8) / 8,
+    [](unsigned char a, unsigned char b) { return static_cast<unsigned char>(a & b); });
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+void vtkBitArray::BitwiseOr(vtkBitArray* other)
+{
+  if (other == nullptr || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro(<< "Both arrays must have the same number of values.");
+    return;
+  }
+  CombineBytes(this->Array, other->Array, (this->MaxId + 8) / 8,
+    [](unsigned char a, unsigned char b) { return static_cast<unsigned char>(a | b); });
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+void vtkBitArray::BitwiseXor(vtkBitArray* other)
+{
+  if (other == nullptr || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro(<< "Both arrays must have the same number of values.");
+    return;
+  }
+  CombineBytes(this->Array, other->Array, (this->MaxId + 8) / 8,
+    [](unsigned char a, unsigned char b) { return static_cast<unsigned char>(a ^ b); });
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+void vtkBitArray::BitwiseNot()
+{
+  unsigned char* data = this->Array;
+  vtkSMPTools::For(0, (this->MaxId + 8) / 8, [data](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      data[i] = static_cast<unsigned char>(~data[i]);
+    }
+  });
+  // keep the invariant that the unused bits of the last byte are cleared
+  this->InitializeUnusedBitsInLastByte();
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBitArray::CountSetBits()
+{
+  vtkIdType numBits = this->MaxId + 1;
+  if (numBits <= 0 || !this->Array)
+  {
+    return 0;
+  }
+
+  const unsigned char* data = this->Array;
+  vtkIdType fullBytes = numBits / 8;
+  vtkIdType numWords = fullBytes / 8;
+
+  vtkSMPThreadLocal<vtkIdType> localCount(0);
+  vtkSMPTools::For(0, numWords, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdType& count = localCount.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      vtkTypeUInt64 word;
+      memcpy(&word, data + 8 * i, sizeof(word));
+      count += PopCount(word);
+    }
+  });
+
+  vtkIdType total = 0;
+  for (vtkSMPThreadLocal<vtkIdType>::iterator it = localCount.begin(); it != localCount.end(); ++it)
+  {
+    total += *it;
+  }
+
+  // whole bytes after the last full word
+  for (vtkIdType i = 8 * numWords; i < fullBytes; ++i)
+  {
+    total += PopCount(data[i]);
+  }
+
+  // bits of the trailing partial byte; mask out the unused bits in case the
+  // array wraps user memory where they are not guaranteed to be cleared
+  if (numBits % 8)
+  {
+    total += PopCount(static_cast<vtkTypeUInt64>(
+      data[fullBytes] & InitializationMaskForUnusedBitsOfLastByte[this->MaxId % 8]));
+  }
+
+  return total;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBitArray::FindNextSetBit(vtkIdType startId)
+{
+  if (startId < 0)
+  {
+    startId = 0;
+  }
+  if (!this->Array || startId > this->MaxId)
+  {
+    return -1;
+  }
+
+  const unsigned char* data = this->Array;
+  vtkIdType numBytes = (this->MaxId + 8) / 8;
+  vtkIdType byteId = startId / 8;
+
+  // finish the byte the start index falls in bit by bit
+  if (startId % 8)
+  {
+    for (vtkIdType id = startId; id < 8 * (byteId + 1) && id <= this->MaxId; ++id)
+    {
+      if (data[byteId] & (0x80 >> (id % 8)))
+      {
+        return id;
+      }
+    }
+    ++byteId;
+  }
+
+  // skip runs of zero bits a word at a time
+  while (byteId + 8 <= numBytes)
+  {
+    vtkTypeUInt64 word;
+    memcpy(&word, data + byteId, sizeof(word));
+    if (word != 0)
+    {
+      break;
+    }
+    byteId += 8;
+  }
+
+  for (; byteId < numBytes; ++byteId)
+  {
+    if (data[byteId] == 0)
+    {
+      continue;
+    }
+    for (int bit = 0; bit < 8; ++bit)
+    {
+      vtkIdType id = 8 * byteId + bit;
+      if (id > this->MaxId)
+      {
+        return -1;
+      }
+      if (data[byteId] & (0x80 >> bit))
+      {
+        return id;
+      }
+    }
+  }
+  return -1;
+}
+
 //------------------------------------------------------------------------------
 vtkArrayIterator* vtkBitArray::NewIterator()
 {
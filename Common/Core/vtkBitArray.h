@@ -214,6 +214,39 @@ public:
    */
   void InsertComponent(vtkIdType i, int j, double c) override;
 
+  ///@{
+  /**
+   * Update this array in place with the result of a bitwise operation with
+   * the corresponding bits of another array: a &= b, a |= b and a ^= b
+   * respectively. Both arrays must have the same number of values. The
+   * operation proceeds a word at a time instead of bit by bit and runs in
+   * parallel over large arrays.
+   */
+  void BitwiseAnd(vtkBitArray* other);
+  void BitwiseOr(vtkBitArray* other);
+  void BitwiseXor(vtkBitArray* other);
+  ///@}
+
+  /**
+   * Flip every bit of this array in place (bitwise complement), a word at a
+   * time and in parallel over large arrays.
+   */
+  void BitwiseNot();
+
+  /**
+   * Return the number of bits that are set, using a word-granular population
+   * count rather than testing each bit individually.
+   */
+  vtkIdType CountSetBits();
+
+  /**
+   * Return the index of the first set bit at or after startId, or -1 if no
+   * later bit is set. Runs of zero bits are skipped a word at a time, so
+   * repeatedly calling this to visit the set bits of a sparse mask costs
+   * time proportional to the number of words, not the number of bits.
+   */
+  vtkIdType FindNextSetBit(vtkIdType startId);
+
   /**
    * Direct manipulation of the underlying data.
    */
@@ -25,6 +25,7 @@
 #ifndef vtkBuffer_h
 #define vtkBuffer_h
 
+#include "vtkAllocationPolicy.h" // Process-wide allocation policy
 #include "vtkObject.h"
 #include "vtkObjectFactory.h" // New() implementation
 
@@ -92,9 +93,21 @@ protected:
     : Pointer(nullptr)
     , Size(0)
   {
-    this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
-    this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
-    this->SetFreeFunction(false, vtkObjectBase::GetCurrentFreeFunction());
+    if (vtkObjectBase::GetUsingMemkind())
+    {
+      this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
+      this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
+      this->SetFreeFunction(false, vtkObjectBase::GetCurrentFreeFunction());
+    }
+    else
+    {
+      // Route the default allocator through the process-wide policy so that
+      // bulk array memory can be placed on huge pages or handled by an
+      // application allocator (see vtkAllocationPolicy).
+      this->SetMallocFunction(vtkAllocationPolicy::Malloc);
+      this->SetReallocFunction(vtkAllocationPolicy::Realloc);
+      this->SetFreeFunction(false, vtkAllocationPolicy::Free);
+    }
   }
 
   ~vtkBuffer() override { this->SetBuffer(nullptr, 0); }
@@ -204,10 +217,12 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     return this->Allocate(0);
   }
 
-  if (this->Pointer && this->DeleteFunction != free)
+  if (this->Pointer && this->DeleteFunction != free &&
+    this->DeleteFunction != vtkAllocationPolicy::Free)
   {
     ScalarType* newArray;
     bool forceFreeFunction = false;
+    bool forcePolicyFreeFunction = false;
     if (this->MallocFunction)
     {
       newArray = static_cast<ScalarType*>(this->MallocFunction(newsize * sizeof(ScalarType)));
@@ -221,6 +236,12 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
         // which matches.
         forceFreeFunction = true;
       }
+      else if (this->MallocFunction == vtkAllocationPolicy::Malloc)
+      {
+        // Likewise when allocating through the process-wide policy: the new
+        // buffer must be paired with the policy's free.
+        forcePolicyFreeFunction = true;
+      }
     }
     else
     {
@@ -237,6 +258,10 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     {
       this->DeleteFunction = free;
     }
+    else if (forcePolicyFreeFunction)
+    {
+      this->DeleteFunction = vtkAllocationPolicy::Free;
+    }
   }
   else
   {
@@ -0,0 +1,140 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkConstantArray.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkConstantArray
+ * @brief   implicit vtkGenericDataArray holding a single constant value
+ *
+ *
+ * vtkConstantArray is a read-only vtkGenericDataArray implementation that
+ * returns the same value for every component of every tuple without backing
+ * storage. It is useful for attributes that are uniform over a data set --
+ * a material id per block, for example -- where materializing the array
+ * would waste memory proportional to the number of tuples.
+ *
+ * The array participates in vtkArrayDispatch when
+ * VTK_DISPATCH_IMPLICIT_ARRAYS is enabled, so dispatched filter kernels
+ * consume it at full speed through GetValue()/GetTypedComponent(). The
+ * write API required by vtkGenericDataArray (SetValue() and friends) is
+ * implemented as a no-op: allocation always succeeds and stores nothing.
+ *
+ * @sa
+ * vtkGenericDataArray vtkAffineArray vtkArrayDispatch
+ */
+
+#ifndef vtkConstantArray_h
+#define vtkConstantArray_h
+
+#include "vtkGenericDataArray.h"
+#include "vtkObjectFactory.h" // for VTK_STANDARD_NEW_BODY
+
+template <typename ValueTypeT>
+class vtkConstantArray : public vtkGenericDataArray<vtkConstantArray<ValueTypeT>, ValueTypeT>
+{
+  typedef vtkGenericDataArray<vtkConstantArray<ValueTypeT>, ValueTypeT> GenericDataArrayType;
+
+public:
+  typedef vtkConstantArray<ValueTypeT> SelfType;
+  vtkTemplateTypeMacro(SelfType, GenericDataArrayType);
+  typedef typename Superclass::ValueType ValueType;
+
+  static vtkConstantArray* New() { VTK_STANDARD_NEW_BODY(vtkConstantArray<ValueTypeT>); }
+
+  ///@{
+  /**
+   * Set/Get the value returned for every entry of the array. The default
+   * is 0.
+   */
+  void SetConstantValue(ValueType value)
+  {
+    if (value != this->ConstantValue)
+    {
+      this->ConstantValue = value;
+      this->Modified();
+    }
+  }
+  ValueType GetConstantValue() const { return this->ConstantValue; }
+  ///@}
+
+  /**
+   * Get the value at @a valueIdx. Always returns the constant value.
+   */
+  inline ValueType GetValue(vtkIdType vtkNotUsed(valueIdx)) const { return this->ConstantValue; }
+
+  /**
+   * Copy the tuple at @a tupleIdx into @a tuple.
+   */
+  inline void GetTypedTuple(vtkIdType vtkNotUsed(tupleIdx), ValueType* tuple) const
+  {
+    for (int comp = 0; comp < this->NumberOfComponents; ++comp)
+    {
+      tuple[comp] = this->ConstantValue;
+    }
+  }
+
+  /**
+   * Get component @a comp of the tuple at @a tupleIdx.
+   */
+  inline ValueType GetTypedComponent(vtkIdType vtkNotUsed(tupleIdx), int vtkNotUsed(comp)) const
+  {
+    return this->ConstantValue;
+  }
+
+  ///@{
+  /**
+   * This array is read-only: the write API required by vtkGenericDataArray
+   * does nothing. Use SetConstantValue() to change the value the array
+   * presents.
+   */
+  inline void SetValue(vtkIdType vtkNotUsed(valueIdx), ValueType vtkNotUsed(value)) {}
+  inline void SetTypedTuple(vtkIdType vtkNotUsed(tupleIdx), const ValueType* vtkNotUsed(tuple)) {}
+  inline void SetTypedComponent(
+    vtkIdType vtkNotUsed(tupleIdx), int vtkNotUsed(comp), ValueType vtkNotUsed(value))
+  {
+  }
+  ///@}
+
+  void PrintSelf(ostream& os, vtkIndent indent) override
+  {
+    this->Superclass::PrintSelf(os, indent);
+    os << indent << "ConstantValue: " << this->ConstantValue << "\n";
+  }
+
+protected:
+  vtkConstantArray()
+    : ConstantValue(0)
+  {
+  }
+  ~vtkConstantArray() override = default;
+
+  ///@{
+  /**
+   * No storage is backing this array: allocation only has to succeed.
+   */
+  bool AllocateTuples(vtkIdType vtkNotUsed(numTuples)) { return true; }
+  bool ReallocateTuples(vtkIdType vtkNotUsed(numTuples)) { return true; }
+  ///@}
+
+  ValueType ConstantValue;
+
+private:
+  vtkConstantArray(const vtkConstantArray&) = delete;
+  void operator=(const vtkConstantArray&) = delete;
+
+  friend class vtkGenericDataArray<vtkConstantArray<ValueTypeT>, ValueTypeT>;
+};
+
+#endif // vtkConstantArray_h
+
+// VTK-HeaderTest-Exclude: vtkConstantArray.h
@@ -15,6 +15,9 @@
 #   Include vtkTypedDataArray<ValueType> for the basic types supported
 #   by VTK. This enables the old-style in-situ vtkMappedDataArray subclasses
 #   to be used.
+# - VTK_DISPATCH_IMPLICIT_ARRAYS (default: OFF)
+#   Include the read-only implicit arrays vtkConstantArray<ValueType> and
+#   vtkAffineArray<ValueType> for the basic types supported by VTK.
 #
 # At a lower level, specific arrays can be added to the list individually in
 # two ways:
@@ -146,6 +149,19 @@ if (VTK_DISPATCH_TYPED_ARRAYS)
   )
 endif()
 
+if (VTK_DISPATCH_IMPLICIT_ARRAYS)
+  list(APPEND vtkArrayDispatch_containers vtkConstantArray)
+  set(vtkArrayDispatch_vtkConstantArray_header vtkConstantArray.h)
+  set(vtkArrayDispatch_vtkConstantArray_types
+    ${vtkArrayDispatch_all_types}
+  )
+  list(APPEND vtkArrayDispatch_containers vtkAffineArray)
+  set(vtkArrayDispatch_vtkAffineArray_header vtkAffineArray.h)
+  set(vtkArrayDispatch_vtkAffineArray_types
+    ${vtkArrayDispatch_all_types}
+  )
+endif()
+
 endmacro()
 
 # Concatenates a list of strings into a single string, since string(CONCAT ...)
@@ -108,6 +108,7 @@ public:
   {
     this->ValueMap.clear();
     this->NanIndices.clear();
+    this->IndexedCount = 0;
   }
   ///@}
 
@@ -117,15 +118,30 @@ private:
 
   void UpdateLookup()
   {
-    if (!this->AssociatedArray || (this->AssociatedArray->GetNumberOfTuples() < 1) ||
-      (!this->ValueMap.empty() || !this->NanIndices.empty()))
+    if (!this->AssociatedArray)
     {
       return;
     }
 
     vtkIdType num = this->AssociatedArray->GetNumberOfValues();
+    if (num < this->IndexedCount)
+    {
+      // The array shrank since the index was built; start over.
+      this->ValueMap.clear();
+      this->NanIndices.clear();
+      this->IndexedCount = 0;
+    }
+    if (num == this->IndexedCount)
+    {
+      return;
+    }
+
+    // Only the values appended since the last update need to be indexed; the
+    // index is persistent across append-only growth of the array. In-place
+    // modifications still require DataChanged()/ClearLookup(), which resets
+    // the index completely.
     this->ValueMap.reserve(num);
-    for (vtkIdType i = 0; i < num; ++i)
+    for (vtkIdType i = this->IndexedCount; i < num; ++i)
     {
       auto value = this->AssociatedArray->GetValue(i);
       if (::detail::isnan(value))
@@ -134,6 +150,7 @@ private:
       }
       this->ValueMap[value].push_back(i);
     }
+    this->IndexedCount = num;
   }
 
   // Return a pointer to the relevant vector of indices if specified value was
@@ -156,6 +173,7 @@ private:
   ArrayTypeT* AssociatedArray{ nullptr };
   std::unordered_map<ValueType, std::vector<vtkIdType>> ValueMap;
   std::vector<vtkIdType> NanIndices;
+  vtkIdType IndexedCount{ 0 };
 };
 
 #endif
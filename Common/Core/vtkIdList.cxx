@@ -22,15 +22,15 @@ vtkStandardNewMacro(vtkIdList);
 vtkIdList::vtkIdList()
 {
   this->NumberOfIds = 0;
-  this->Size = 0;
-  this->Ids = nullptr;
+  this->Size = InlineCapacity;
+  this->Ids = this->InlineIds;
   this->ManageMemory = true;
 }
 
 //------------------------------------------------------------------------------
 vtkIdList::~vtkIdList()
 {
-  if (this->ManageMemory)
+  if (this->ManageMemory && this->Ids != this->InlineIds)
   {
     delete[] this->Ids;
   }
@@ -39,8 +39,19 @@ vtkIdList::~vtkIdList()
 //------------------------------------------------------------------------------
 vtkIdType* vtkIdList::Release()
 {
-  auto retval = this->Ids;
-  this->Ids = nullptr;
+  vtkIdType* retval;
+  if (this->Ids == this->InlineIds)
+  {
+    // the inline buffer cannot leave this object; hand out a heap copy,
+    // which the caller deletes as usual
+    retval = new vtkIdType[this->NumberOfIds > 0 ? this->NumberOfIds : 1];
+    std::copy(this->Ids, this->Ids + this->NumberOfIds, retval);
+  }
+  else
+  {
+    retval = this->Ids;
+    this->Ids = nullptr;
+  }
   this->Initialize();
   return retval;
 }
@@ -48,14 +59,14 @@ vtkIdType* vtkIdList::Release()
 //------------------------------------------------------------------------------
 void vtkIdList::Initialize()
 {
-  if (this->ManageMemory)
+  if (this->ManageMemory && this->Ids != this->InlineIds)
   {
     delete[] this->Ids;
   }
   this->ManageMemory = true;
-  this->Ids = nullptr;
+  this->Ids = this->InlineIds;
   this->NumberOfIds = 0;
-  this->Size = 0;
+  this->Size = InlineCapacity;
 }
 
 //------------------------------------------------------------------------------
@@ -64,10 +75,13 @@ int vtkIdList::Allocate(const vtkIdType sz, const int vtkNotUsed(strategy))
   if (sz > this->Size)
   {
     this->Initialize();
-    this->Size = (sz > 0 ? sz : 1);
-    if ((this->Ids = new vtkIdType[this->Size]) == nullptr)
+    if (sz > InlineCapacity)
     {
-      return 0;
+      this->Size = sz;
+      if ((this->Ids = new vtkIdType[this->Size]) == nullptr)
+      {
+        return 0;
+      }
     }
   }
   this->NumberOfIds = 0;
@@ -113,7 +127,7 @@ vtkIdType* vtkIdList::WritePointer(const vtkIdType i, const vtkIdType number)
 //------------------------------------------------------------------------------
 void vtkIdList::SetArray(vtkIdType* array, vtkIdType size, bool save)
 {
-  if (this->ManageMemory)
+  if (this->ManageMemory && this->Ids != this->InlineIds)
   {
     delete[] this->Ids;
   }
@@ -197,7 +211,26 @@ vtkIdType* vtkIdList::Resize(const vtkIdType sz)
     return nullptr;
   }
 
-  if ((newIds = new vtkIdType[newSize]) == nullptr)
+  if (newSize <= InlineCapacity)
+  {
+    // small sizes live in the inline buffer; nothing to move if the ids
+    // are already there
+    if (this->Ids == this->InlineIds)
+    {
+      if (this->NumberOfIds > newSize)
+      {
+        this->NumberOfIds = newSize;
+      }
+      return this->Ids;
+    }
+    if (this->NumberOfIds > newSize)
+    {
+      this->NumberOfIds = newSize;
+    }
+    newIds = this->InlineIds;
+    newSize = InlineCapacity;
+  }
+  else if ((newIds = new vtkIdType[newSize]) == nullptr)
   {
     vtkErrorMacro(<< "Cannot allocate memory\n");
     return nullptr;
@@ -212,7 +245,7 @@ vtkIdType* vtkIdList::Resize(const vtkIdType sz)
   {
     memcpy(newIds, this->Ids,
       static_cast<size_t>(sz < this->Size ? sz : this->Size) * sizeof(vtkIdType));
-    if (this->ManageMemory)
+    if (this->ManageMemory && this->Ids != this->InlineIds)
     {
       delete[] this->Ids;
     }
@@ -205,6 +205,11 @@ protected:
   vtkIdType* Ids;
   bool ManageMemory;
 
+  // Lists up to this long are stored in the object itself, so the short
+  // lists produced by GetCellPoints-style calls never touch the heap.
+  static constexpr vtkIdType InlineCapacity = 8;
+  vtkIdType InlineIds[InlineCapacity];
+
 private:
   vtkIdList(const vtkIdList&) = delete;
   void operator=(const vtkIdList&) = delete;
@@ -80,17 +80,14 @@ void vtkInformation::PrintSelf(ostream& os, vtkIndent indent)
 //------------------------------------------------------------------------------
 void vtkInformation::PrintKeys(ostream& os, vtkIndent indent)
 {
-  typedef vtkInformationInternals::MapType MapType;
-  for (MapType::const_iterator i = this->Internal->Map.begin(); i != this->Internal->Map.end(); ++i)
-  {
+  this->Internal->ForEachKey([&os, &indent, this](vtkInformationKey* key) {
     // Print the key name first.
-    vtkInformationKey* key = i->first;
     os << indent << key->GetName() << ": ";
 
     // Ask the key to print its value.
     key->Print(os, this);
     os << "\n";
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -133,26 +130,23 @@ void vtkInformation::SetAsObjectBase(vtkInformationKey* key, vtkObjectBase* newv
   {
     return;
   }
-  typedef vtkInformationInternals::MapType MapType;
-  MapType::iterator i = this->Internal->Map.find(key);
-  if (i != this->Internal->Map.end())
+  if (vtkObjectBase** value = this->Internal->Find(key))
   {
-    vtkObjectBase* oldvalue = i->second;
+    vtkObjectBase* oldvalue = *value;
     if (newvalue)
     {
-      i->second = newvalue;
+      *value = newvalue;
       newvalue->Register(nullptr);
     }
     else
     {
-      this->Internal->Map.erase(i);
+      this->Internal->Erase(key);
     }
     oldvalue->UnRegister(nullptr);
   }
   else if (newvalue)
   {
-    MapType::value_type entry(key, newvalue);
-    this->Internal->Map.insert(entry);
+    this->Internal->Insert(key, newvalue);
     newvalue->Register(nullptr);
   }
   this->Modified(key);
@@ -163,11 +157,9 @@ const vtkObjectBase* vtkInformation::GetAsObjectBase(const vtkInformationKey* ke
 {
   if (key)
   {
-    typedef vtkInformationInternals::MapType MapType;
-    MapType::const_iterator i = this->Internal->Map.find(const_cast<vtkInformationKey*>(key));
-    if (i != this->Internal->Map.end())
+    if (vtkObjectBase** value = this->Internal->Find(const_cast<vtkInformationKey*>(key)))
     {
-      return i->second;
+      return *value;
     }
   }
   return nullptr;
@@ -178,11 +170,9 @@ vtkObjectBase* vtkInformation::GetAsObjectBase(vtkInformationKey* key)
 {
   if (key)
   {
-    typedef vtkInformationInternals::MapType MapType;
-    MapType::const_iterator i = this->Internal->Map.find(key);
-    if (i != this->Internal->Map.end())
+    if (vtkObjectBase** value = this->Internal->Find(key))
     {
-      return i->second;
+      return *value;
     }
   }
   return nullptr;
@@ -201,12 +191,8 @@ void vtkInformation::Copy(vtkInformation* from, int deep)
   this->Internal = new vtkInformationInternals;
   if (from)
   {
-    typedef vtkInformationInternals::MapType MapType;
-    for (MapType::const_iterator i = from->Internal->Map.begin(); i != from->Internal->Map.end();
-         ++i)
-    {
-      this->CopyEntry(from, i->first, deep);
-    }
+    from->Internal->ForEachKey(
+      [this, from, deep](vtkInformationKey* key) { this->CopyEntry(from, key, deep); });
   }
   delete oldInternal;
 }
@@ -216,12 +202,8 @@ void vtkInformation::Append(vtkInformation* from, int deep)
 {
   if (from)
   {
-    typedef vtkInformationInternals::MapType MapType;
-    for (MapType::const_iterator i = from->Internal->Map.begin(); i != from->Internal->Map.end();
-         ++i)
-    {
-      this->CopyEntry(from, i->first, deep);
-    }
+    from->Internal->ForEachKey(
+      [this, from, deep](vtkInformationKey* key) { this->CopyEntry(from, key, deep); });
   }
 }
 
@@ -923,11 +905,8 @@ void vtkInformation::ReportReferences(vtkGarbageCollector* collector)
 {
   this->Superclass::ReportReferences(collector);
   // Ask each key/value pair to report any references it holds.
-  typedef vtkInformationInternals::MapType MapType;
-  for (MapType::const_iterator i = this->Internal->Map.begin(); i != this->Internal->Map.end(); ++i)
-  {
-    i->first->Report(this, collector);
-  }
+  this->Internal->ForEachKey(
+    [this, collector](vtkInformationKey* key) { key->Report(this, collector); });
 }
 
 //------------------------------------------------------------------------------
@@ -935,11 +914,9 @@ void vtkInformation::ReportAsObjectBase(vtkInformationKey* key, vtkGarbageCollec
 {
   if (key)
   {
-    typedef vtkInformationInternals::MapType MapType;
-    MapType::iterator i = this->Internal->Map.find(key);
-    if (i != this->Internal->Map.end())
+    if (vtkObjectBase** value = this->Internal->Find(key))
     {
-      vtkGarbageCollectorReport(collector, i->second, key->GetName());
+      vtkGarbageCollectorReport(collector, *value, key->GetName());
     }
   }
 }
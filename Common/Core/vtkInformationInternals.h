@@ -53,6 +53,15 @@ public:
 #else
   typedef std::map<KeyType, DataType> MapType;
 #endif
+
+  // Most information objects hold only a handful of entries, dominated by
+  // the hot pipeline keys consulted on every Update. A fixed set of inline
+  // slots is filled before the heap map, so those lookups reduce to a short
+  // pointer scan with no hashing or heap traffic; only overflow entries go
+  // to the map.
+  static constexpr int NumberOfInlineSlots = 12;
+  KeyType InlineKeys[NumberOfInlineSlots] = {};
+  DataType InlineValues[NumberOfInlineSlots] = {};
   MapType Map;
 
 #ifdef VTK_INFORMATION_USE_HASH_MAP
@@ -62,8 +71,76 @@ public:
   }
 #endif
 
+  // Return the address of the value stored for the key, or nullptr if the
+  // key is absent.
+  DataType* Find(KeyType key)
+  {
+    for (int slot = 0; slot < NumberOfInlineSlots; ++slot)
+    {
+      if (this->InlineKeys[slot] == key)
+      {
+        return &this->InlineValues[slot];
+      }
+    }
+    MapType::iterator i = this->Map.find(key);
+    return i != this->Map.end() ? &i->second : nullptr;
+  }
+
+  // Insert an entry. The key must not already be present.
+  void Insert(KeyType key, DataType value)
+  {
+    for (int slot = 0; slot < NumberOfInlineSlots; ++slot)
+    {
+      if (this->InlineKeys[slot] == nullptr)
+      {
+        this->InlineKeys[slot] = key;
+        this->InlineValues[slot] = value;
+        return;
+      }
+    }
+    this->Map[key] = value;
+  }
+
+  // Remove an entry if present. Does not adjust the value's reference count.
+  void Erase(KeyType key)
+  {
+    for (int slot = 0; slot < NumberOfInlineSlots; ++slot)
+    {
+      if (this->InlineKeys[slot] == key)
+      {
+        this->InlineKeys[slot] = nullptr;
+        return;
+      }
+    }
+    this->Map.erase(key);
+  }
+
+  // Visit every stored key, inline slots first, then map overflow.
+  template <typename Visitor>
+  void ForEachKey(Visitor&& visit) const
+  {
+    for (int slot = 0; slot < NumberOfInlineSlots; ++slot)
+    {
+      if (this->InlineKeys[slot] != nullptr)
+      {
+        visit(this->InlineKeys[slot]);
+      }
+    }
+    for (MapType::const_iterator i = this->Map.begin(); i != this->Map.end(); ++i)
+    {
+      visit(i->first);
+    }
+  }
+
   ~vtkInformationInternals()
   {
+    for (int slot = 0; slot < NumberOfInlineSlots; ++slot)
+    {
+      if (this->InlineKeys[slot] != nullptr)
+      {
+        this->InlineValues[slot]->UnRegister(nullptr);
+      }
+    }
     for (MapType::iterator i = this->Map.begin(); i != this->Map.end(); ++i)
     {
       if (vtkObjectBase* value = i->second)
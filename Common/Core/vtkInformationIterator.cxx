@@ -24,7 +24,24 @@ vtkStandardNewMacro(vtkInformationIterator);
 class vtkInformationIteratorInternals
 {
 public:
+  // Index into the inline slots; NumberOfInlineSlots once traversal has
+  // moved on to the overflow map.
+  int Slot;
   vtkInformationInternals::MapType::iterator Iterator;
+
+  // Skip empty inline slots; enter the map when the slots are exhausted.
+  void AdvanceToOccupied(vtkInformationInternals* internal)
+  {
+    while (this->Slot < vtkInformationInternals::NumberOfInlineSlots &&
+      internal->InlineKeys[this->Slot] == nullptr)
+    {
+      ++this->Slot;
+    }
+    if (this->Slot == vtkInformationInternals::NumberOfInlineSlots)
+    {
+      this->Iterator = internal->Map.begin();
+    }
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -85,7 +102,8 @@ void vtkInformationIterator::GoToFirstItem()
     vtkErrorMacro("No information has been set.");
     return;
   }
-  this->Internal->Iterator = this->Information->Internal->Map.begin();
+  this->Internal->Slot = 0;
+  this->Internal->AdvanceToOccupied(this->Information->Internal);
 }
 
 //------------------------------------------------------------------------------
@@ -97,7 +115,15 @@ void vtkInformationIterator::GoToNextItem()
     return;
   }
 
-  ++this->Internal->Iterator;
+  if (this->Internal->Slot < vtkInformationInternals::NumberOfInlineSlots)
+  {
+    ++this->Internal->Slot;
+    this->Internal->AdvanceToOccupied(this->Information->Internal);
+  }
+  else
+  {
+    ++this->Internal->Iterator;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -109,6 +135,10 @@ int vtkInformationIterator::IsDoneWithTraversal()
     return 1;
   }
 
+  if (this->Internal->Slot < vtkInformationInternals::NumberOfInlineSlots)
+  {
+    return 0;
+  }
   if (this->Internal->Iterator == this->Information->Internal->Map.end())
   {
     return 1;
@@ -124,6 +154,10 @@ vtkInformationKey* vtkInformationIterator::GetCurrentKey()
     return nullptr;
   }
 
+  if (this->Internal->Slot < vtkInformationInternals::NumberOfInlineSlots)
+  {
+    return this->Information->Internal->InlineKeys[this->Internal->Slot];
+  }
   return this->Internal->Iterator->first;
 }
 
@@ -19,6 +19,7 @@
 #include "vtkMath.h"
 #include "vtkMathConfigure.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkVariantArray.h"
 
@@ -1063,6 +1064,46 @@ void vtkLookupTableMapData(vtkLookupTable* self, T* input, unsigned char* output
   }   // alpha blending
 }
 
+//------------------------------------------------------------------------------
+// Number of output bytes written per mapped value.
+inline int vtkLookupTableOutputFormatSize(int outFormat)
+{
+  switch (outFormat)
+  {
+    case VTK_RGBA:
+      return 4;
+    case VTK_RGB:
+      return 3;
+    case VTK_LUMINANCE_ALPHA:
+      return 2;
+    default: // VTK_LUMINANCE
+      return 1;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Map large batches in parallel. The lookup table and its parameters are
+// read-only during mapping, so independent spans can run the serial fast
+// path concurrently; each span writes to a disjoint part of the output.
+template <class T>
+void vtkLookupTableMapDataThreaded(vtkLookupTable* self, T* input, unsigned char* output,
+  int length, int inIncr, int outFormat, TableParameters& p)
+{
+  constexpr int VTK_SMP_THRESHOLD = 200000;
+  if (length < VTK_SMP_THRESHOLD)
+  {
+    vtkLookupTableMapData(self, input, output, length, inIncr, outFormat, p);
+    return;
+  }
+
+  const int outIncr = vtkLookupTableOutputFormatSize(outFormat);
+  vtkSMPTools::For(0, length, [&](vtkIdType begin, vtkIdType end) {
+    TableParameters params = p;
+    vtkLookupTableMapData(self, input + begin * inIncr, output + begin * outIncr,
+      static_cast<int>(end - begin), inIncr, outFormat, params);
+  });
+}
+
 //------------------------------------------------------------------------------
 template <class T>
 void vtkLookupTableIndexedMapData(vtkLookupTable* self, const T* input, unsigned char* output,
@@ -1254,7 +1295,7 @@ void vtkLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output,
       }
       break;
 
-        vtkTemplateMacro(vtkLookupTableMapData(this, static_cast<VTK_TT*>(input), output,
+        vtkTemplateMacro(vtkLookupTableMapDataThreaded(this, static_cast<VTK_TT*>(input), output,
           numberOfValues, inputIncrement, outputFormat, p));
       default:
         vtkErrorMacro(<< "MapScalarsThroughTable2: Unknown input ScalarType");
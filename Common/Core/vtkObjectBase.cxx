@@ -305,7 +305,9 @@ void vtkObjectBase::RegisterInternal(vtkObjectBase*, vtkTypeBool check)
   // count.
   if (!(check && vtkObjectBaseToGarbageCollectorFriendship::TakeReference(this)))
   {
-    this->ReferenceCount++;
+    // Taking a new reference only requires atomicity, not ordering: the
+    // caller already holds a valid reference to this object.
+    this->ReferenceCount.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -321,7 +323,10 @@ void vtkObjectBase::UnRegisterInternal(vtkObjectBase*, vtkTypeBool check)
   }
 
   // Decrement the reference count, delete object if count goes to zero.
-  if (--this->ReferenceCount <= 0)
+  // The release ordering publishes all writes made through this reference,
+  // and the acquire side makes them visible to the thread that runs the
+  // destructor.
+  if (this->ReferenceCount.fetch_sub(1, std::memory_order_acq_rel) <= 1)
   {
     // Let subclasses know the object is on its way out.
     this->ObjectFinalize();
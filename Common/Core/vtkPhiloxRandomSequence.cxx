@@ -0,0 +1,120 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPhiloxRandomSequence.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+=========================================================================*/
+#include "vtkPhiloxRandomSequence.h"
+
+#include "vtkObjectFactory.h"
+
+vtkStandardNewMacro(vtkPhiloxRandomSequence);
+
+// Multipliers and Weyl constants of the Philox-4x32 round function, from
+// Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11.
+const vtkTypeUInt32 VTK_PHILOX_M0 = 0xD2511F53u;
+const vtkTypeUInt32 VTK_PHILOX_M1 = 0xCD9E8D57u;
+const vtkTypeUInt32 VTK_PHILOX_W0 = 0x9E3779B9u;
+const vtkTypeUInt32 VTK_PHILOX_W1 = 0xBB67AE85u;
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+inline void PhiloxRound(vtkTypeUInt32 counter[4], const vtkTypeUInt32 key[2])
+{
+  vtkTypeUInt64 product0 = static_cast<vtkTypeUInt64>(VTK_PHILOX_M0) * counter[0];
+  vtkTypeUInt64 product1 = static_cast<vtkTypeUInt64>(VTK_PHILOX_M1) * counter[2];
+  vtkTypeUInt32 hi0 = static_cast<vtkTypeUInt32>(product0 >> 32);
+  vtkTypeUInt32 lo0 = static_cast<vtkTypeUInt32>(product0);
+  vtkTypeUInt32 hi1 = static_cast<vtkTypeUInt32>(product1 >> 32);
+  vtkTypeUInt32 lo1 = static_cast<vtkTypeUInt32>(product1);
+
+  counter[0] = hi1 ^ counter[1] ^ key[0];
+  counter[1] = lo1;
+  counter[2] = hi0 ^ counter[3] ^ key[1];
+  counter[3] = lo0;
+}
+
+}
+
+//------------------------------------------------------------------------------
+vtkPhiloxRandomSequence::vtkPhiloxRandomSequence()
+{
+  this->Key[0] = 0;
+  this->Key[1] = 0;
+  this->Index = 0;
+  this->GenerateBlock();
+}
+
+//------------------------------------------------------------------------------
+vtkPhiloxRandomSequence::~vtkPhiloxRandomSequence() = default;
+
+//------------------------------------------------------------------------------
+void vtkPhiloxRandomSequence::Initialize(vtkTypeUInt32 seed)
+{
+  // the two key words only need to differ per seed; mixing the seed with a
+  // Weyl constant keeps nearby seeds from producing correlated streams.
+  this->Key[0] = seed;
+  this->Key[1] = seed ^ VTK_PHILOX_W0;
+  this->Index = 0;
+  this->GenerateBlock();
+}
+
+//------------------------------------------------------------------------------
+void vtkPhiloxRandomSequence::SetIndex(vtkTypeUInt64 index)
+{
+  vtkTypeUInt64 block = this->Index >> 2;
+  this->Index = index;
+  if ((index >> 2) != block)
+  {
+    this->GenerateBlock();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPhiloxRandomSequence::GenerateBlock()
+{
+  // each 128-bit counter value yields a block of four 32-bit outputs; the
+  // counter is simply the block number, encrypted by ten Philox rounds.
+  vtkTypeUInt64 block = this->Index >> 2;
+  this->Block[0] = static_cast<vtkTypeUInt32>(block);
+  this->Block[1] = static_cast<vtkTypeUInt32>(block >> 32);
+  this->Block[2] = 0;
+  this->Block[3] = 0;
+
+  vtkTypeUInt32 key[2] = { this->Key[0], this->Key[1] };
+  for (int round = 0; round < 10; round++)
+  {
+    PhiloxRound(this->Block, key);
+    key[0] += VTK_PHILOX_W0;
+    key[1] += VTK_PHILOX_W1;
+  }
+}
+
+//------------------------------------------------------------------------------
+double vtkPhiloxRandomSequence::GetValue()
+{
+  // scale the 32-bit word to [0,1)
+  return this->Block[this->Index & 3] * (1.0 / 4294967296.0);
+}
+
+//------------------------------------------------------------------------------
+void vtkPhiloxRandomSequence::Next()
+{
+  this->SetIndex(this->Index + 1);
+}
+
+//------------------------------------------------------------------------------
+void vtkPhiloxRandomSequence::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Index: " << this->Index << endl;
+}
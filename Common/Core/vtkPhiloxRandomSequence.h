@@ -0,0 +1,100 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPhiloxRandomSequence.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+=========================================================================*/
+/**
+ * @class   vtkPhiloxRandomSequence
+ * @brief   Philox counter-based sequence of pseudo random numbers
+ *
+ * vtkPhiloxRandomSequence is a sequence of statistically independent pseudo
+ * random numbers uniformly distributed between 0.0 and 1.0.
+ *
+ * Unlike the recurrence-based generators (see
+ * vtkMinimalStandardRandomSequence and vtkMersenneTwister), the value at any
+ * position of the sequence is a pure function of the seed and the position:
+ * the generator encrypts a 128-bit counter with the Philox-4x32-10 bijection
+ * keyed by the seed. This gives the sequence O(1) skip-ahead via SetIndex(),
+ * which makes it suitable for parallel algorithms where each thread jumps
+ * directly to its portion of a single logical stream, producing results that
+ * are independent of the number of threads.
+ *
+ * ref: Salmon, Moraes, Dror, Shaw, "Parallel Random Numbers: As Easy as
+ * 1, 2, 3", Proceedings of SC'11.
+ *
+ * @sa
+ * vtkRandomSequence vtkMinimalStandardRandomSequence vtkMersenneTwister
+ */
+
+#ifndef vtkPhiloxRandomSequence_h
+#define vtkPhiloxRandomSequence_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkRandomSequence.h"
+
+class VTKCOMMONCORE_EXPORT vtkPhiloxRandomSequence : public vtkRandomSequence
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkPhiloxRandomSequence* New();
+  vtkTypeMacro(vtkPhiloxRandomSequence, vtkRandomSequence);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Initialize the sequence with a seed. The seed selects the Philox key;
+   * the sequence position is reset to index 0. Two sequences initialized
+   * with the same seed produce identical values at identical indices.
+   */
+  void Initialize(vtkTypeUInt32 seed) override;
+
+  ///@{
+  /**
+   * Set/get the current position in the sequence. Setting the index is an
+   * O(1) operation for any index value (skip-ahead), so concurrent
+   * consumers can partition one logical sequence by jumping each to the
+   * start of its own range.
+   */
+  void SetIndex(vtkTypeUInt64 index);
+  vtkTypeUInt64 GetIndex() { return this->Index; }
+  ///@}
+
+  /**
+   * Current value
+   * \post unit_range: result>=0.0 && result<1.0
+   */
+  double GetValue() override;
+
+  /**
+   * Move to the next number in the random sequence.
+   */
+  void Next() override;
+
+protected:
+  vtkPhiloxRandomSequence();
+  ~vtkPhiloxRandomSequence() override;
+
+  // Recompute the four output words for the block containing Index.
+  void GenerateBlock();
+
+  vtkTypeUInt32 Key[2];
+  vtkTypeUInt64 Index;
+  vtkTypeUInt32 Block[4];
+
+private:
+  vtkPhiloxRandomSequence(const vtkPhiloxRandomSequence&) = delete;
+  void operator=(const vtkPhiloxRandomSequence&) = delete;
+};
+
+#endif // #ifndef vtkPhiloxRandomSequence_h
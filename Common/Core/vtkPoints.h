@@ -90,6 +90,22 @@ public:
    */
   void* GetVoidPointer(const int id) { return this->Data->GetVoidPointer(id); }
 
+  /**
+   * Make room for at least (id + number) points and return a raw pointer to
+   * the coordinates of point id. This supports a bulk-output idiom that
+   * avoids the per-call bookkeeping of InsertPoint()/InsertNextPoint():
+   * reserve the full (or estimated) output size once, write coordinates
+   * directly through the returned pointer (possibly from multiple threads,
+   * each owning a disjoint range of ids), then finalize by trimming to the
+   * number of points actually written with SetNumberOfPoints() or Resize()
+   * and calling Modified(). The pointer is only valid until the next method
+   * that may resize the underlying array.
+   */
+  void* WriteVoidPointer(const vtkIdType id, const vtkIdType number)
+  {
+    return this->Data->WriteVoidPointer(3 * id, 3 * number);
+  }
+
   /**
    * Reclaim any extra memory.
    */
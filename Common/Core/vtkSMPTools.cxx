@@ -65,3 +65,17 @@ bool vtkSMPTools::IsParallelScope()
   auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
   return SMPToolsAPI.IsParallelScope();
 }
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetThreadAffinity(bool enable)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetThreadAffinity(enable);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetThreadAffinity()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetThreadAffinity();
+}
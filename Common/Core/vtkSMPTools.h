@@ -443,6 +443,22 @@ public:
    */
   static bool IsParallelScope();
 
+  ///@{
+  /**
+   * If true, backends that own their worker threads pin them round-robin
+   * across the available CPUs, so each worker keeps touching the same
+   * memory and caches between parallel regions. On NUMA machines, pair
+   * this with a parallel first touch (e.g. vtkSMPTools::Fill right after
+   * allocating a large array) so pages end up on the socket of the worker
+   * that will process them. Currently honored by the STDThread backend on
+   * Linux; TBB and OpenMP own their threads, use their native controls
+   * (e.g. OMP_PROC_BIND) there. Can also be enabled with the
+   * VTK_SMP_THREAD_AFFINITY env variable. Default to false.
+   */
+  static void SetThreadAffinity(bool enable);
+  static bool GetThreadAffinity();
+  ///@}
+
   /**
    * Structure used to specify configuration for LocalScope() method.
    * Several parameters can be configured:
@@ -375,16 +375,25 @@ vtkStdString* vtkStringArray::ResizeAndExtend(vtkIdType sz)
 
   if (this->Array)
   {
-    // can't use memcpy here
+    // can't use memcpy here; move when the old storage is about to be
+    // released so no string buffer is reallocated, copy otherwise since
+    // the caller keeps ownership of the old array
     vtkIdType numCopy = (newSize < this->Size ? newSize : this->Size);
-    for (vtkIdType i = 0; i < numCopy; ++i)
-    {
-      newArray[i] = this->Array[i];
-    }
     if (this->DeleteFunction)
     {
+      for (vtkIdType i = 0; i < numCopy; ++i)
+      {
+        newArray[i] = std::move(this->Array[i]);
+      }
       this->DeleteFunction(this->Array);
     }
+    else
+    {
+      for (vtkIdType i = 0; i < numCopy; ++i)
+      {
+        newArray[i] = this->Array[i];
+      }
+    }
   }
 
   if (newSize < this->Size)
@@ -427,16 +436,22 @@ vtkTypeBool vtkStringArray::Resize(vtkIdType sz)
   {
     vtkIdType numCopy = (newSize < this->Size ? newSize : this->Size);
 
-    for (vtkIdType i = 0; i < numCopy; ++i)
-    {
-      newArray[i] = this->Array[i];
-    }
-
     if (this->DeleteFunction)
     {
+      for (vtkIdType i = 0; i < numCopy; ++i)
+      {
+        newArray[i] = std::move(this->Array[i]);
+      }
       this->DeleteFunction = DefaultDeleteFunction;
       this->DeleteFunction(this->Array);
     }
+    else
+    {
+      for (vtkIdType i = 0; i < numCopy; ++i)
+      {
+        newArray[i] = this->Array[i];
+      }
+    }
   }
 
   if (newSize < this->Size)
@@ -476,7 +491,7 @@ void vtkStringArray::InsertValue(vtkIdType id, vtkStdString f)
       return;
     }
   }
-  this->Array[id] = f;
+  this->Array[id] = std::move(f);
   if (id > this->MaxId)
   {
     this->MaxId = id;
@@ -487,7 +502,7 @@ void vtkStringArray::InsertValue(vtkIdType id, vtkStdString f)
 //------------------------------------------------------------------------------
 vtkIdType vtkStringArray::InsertNextValue(vtkStdString f)
 {
-  this->InsertValue(++this->MaxId, f);
+  this->InsertValue(++this->MaxId, std::move(f));
   this->DataElementChanged(this->MaxId);
   return this->MaxId;
 }
@@ -31,6 +31,8 @@
 #include "vtkCommonCoreModule.h" // For export macro
 #include "vtkStdString.h"        // needed for vtkStdString definition
 
+#include <utility> // for std::move
+
 class vtkStringArrayLookup;
 
 class VTKCOMMONCORE_EXPORT vtkStringArray : public vtkAbstractArray
@@ -187,7 +189,7 @@ public:
   void SetValue(vtkIdType id, vtkStdString value)
     VTK_EXPECTS(0 <= id && id < this->GetNumberOfValues())
   {
-    this->Array[id] = value;
+    this->Array[id] = std::move(value);
     this->DataChanged();
   }
 
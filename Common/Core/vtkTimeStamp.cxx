@@ -53,5 +53,10 @@ void vtkTimeStamp::Modified()
 #else
   static std::atomic<uint32_t> GlobalTimeStamp(0U);
 #endif
-  this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+  // A relaxed fetch_add is sufficient here: the returned value is still
+  // unique and monotonic, which is all that MTime comparisons require, and
+  // it avoids paying for two full memory barriers per Modified() on weakly
+  // ordered architectures.
+  this->ModifiedTime =
+    (vtkMTimeType)(GlobalTimeStamp.fetch_add(1, std::memory_order_relaxed) + 1);
 }
@@ -37,6 +37,8 @@
 #define VTK_EXPECTS(x) [[vtk::expects(x)]]
 // Set size hint for parameter or return value
 #define VTK_SIZEHINT(...) [[vtk::sizehint(__VA_ARGS__)]]
+// The Python wrappers may release the GIL while this method executes
+#define VTK_UNBLOCKTHREADS [[vtk::unblockthreads]]
 #endif
 
 #ifndef VTK_WRAP_HINTS_DEFINED
@@ -46,6 +48,7 @@
 #define VTK_FILEPATH
 #define VTK_EXPECTS(x)
 #define VTK_SIZEHINT(...)
+#define VTK_UNBLOCKTHREADS
 #endif
 
 #endif
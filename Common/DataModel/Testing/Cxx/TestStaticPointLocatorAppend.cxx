@@ -0,0 +1,143 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStaticPointLocatorAppend.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Exercise incremental updates of vtkStaticPointLocator via AppendPoints().
+
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkMathUtilities.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Compare the locator against a second locator that was fully rebuilt on the
+// same points.
+bool CompareQueries(
+  vtkStaticPointLocator* locator, vtkStaticPointLocator* expected, vtkPolyData* pd)
+{
+  vtkNew<vtkIdList> result;
+  vtkNew<vtkIdList> expectedResult;
+  for (int i = 0; i < 100; ++i)
+  {
+    double x[3] = { vtkMath::Random(-1.2, 1.2), vtkMath::Random(-1.2, 1.2),
+      vtkMath::Random(-1.2, 1.2) };
+
+    vtkIdType closest = locator->FindClosestPoint(x);
+    vtkIdType expectedClosest = expected->FindClosestPoint(x);
+    if (closest != expectedClosest)
+    {
+      double d2 = vtkMath::Distance2BetweenPoints(x, pd->GetPoint(closest));
+      double ed2 = vtkMath::Distance2BetweenPoints(x, pd->GetPoint(expectedClosest));
+      if (!vtkMathUtilities::FuzzyCompare(d2, ed2, 1.0e-12))
+      {
+        cerr << "FindClosestPoint mismatch: " << closest << " (d2=" << d2 << ") vs "
+             << expectedClosest << " (d2=" << ed2 << ")\n";
+        return false;
+      }
+    }
+
+    locator->FindPointsWithinRadius(0.25, x, result);
+    expected->FindPointsWithinRadius(0.25, x, expectedResult);
+    if (result->GetNumberOfIds() != expectedResult->GetNumberOfIds())
+    {
+      cerr << "FindPointsWithinRadius count mismatch: " << result->GetNumberOfIds() << " vs "
+           << expectedResult->GetNumberOfIds() << "\n";
+      return false;
+    }
+    for (vtkIdType j = 0; j < expectedResult->GetNumberOfIds(); ++j)
+    {
+      if (result->IsId(expectedResult->GetId(j)) < 0)
+      {
+        cerr << "FindPointsWithinRadius missing id " << expectedResult->GetId(j) << "\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestStaticPointLocatorAppend(int, char*[])
+{
+  vtkMath::RandomSeed(314159);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (int i = 0; i < 10000; ++i)
+  {
+    points->InsertNextPoint(
+      vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0));
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(polyData);
+  locator->BuildLocator();
+
+  // Append a small fraction of new points inside the current bounds, as a
+  // streaming acquisition would, and update incrementally.
+  for (int i = 0; i < 100; ++i)
+  {
+    points->InsertNextPoint(
+      vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0));
+  }
+  points->Modified();
+  locator->AppendPoints();
+
+  vtkNew<vtkStaticPointLocator> rebuilt;
+  rebuilt->SetDataSet(polyData);
+  rebuilt->ForceBuildLocator();
+
+  if (!CompareQueries(locator, rebuilt, polyData))
+  {
+    cerr << "Incremental append disagrees with a full rebuild\n";
+    return EXIT_FAILURE;
+  }
+
+  // A second round of appends must also work.
+  for (int i = 0; i < 500; ++i)
+  {
+    points->InsertNextPoint(
+      vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0), vtkMath::Random(-1.0, 1.0));
+  }
+  points->Modified();
+  locator->AppendPoints();
+  rebuilt->ForceBuildLocator();
+  if (!CompareQueries(locator, rebuilt, polyData))
+  {
+    cerr << "Second incremental append disagrees with a full rebuild\n";
+    return EXIT_FAILURE;
+  }
+
+  // Points outside the original bounds must trigger a safe full rebuild.
+  points->InsertNextPoint(5.0, 5.0, 5.0);
+  points->Modified();
+  locator->AppendPoints();
+  double x[3] = { 4.9, 5.1, 5.0 };
+  if (locator->FindClosestPoint(x) != points->GetNumberOfPoints() - 1)
+  {
+    cerr << "Out-of-bounds append did not rebuild correctly\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -168,6 +168,53 @@ bool TestGhostAwareRange()
 
   return retVal;
 }
+
+//------------------------------------------------------------------------------
+bool TestComputeRanges()
+{
+  bool retVal = true;
+
+  vtkNew<vtkFieldData> fd;
+
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfValues(NUMBER_OF_VALS);
+
+  vtkNew<vtkDoubleArray> negated;
+  negated->SetName("Negated");
+  negated->SetNumberOfValues(NUMBER_OF_VALS);
+
+  for (vtkIdType id = 0; id < NUMBER_OF_VALS; ++id)
+  {
+    values->SetValue(id, VALS[id]);
+    negated->SetValue(id, -VALS[id]);
+  }
+
+  fd->AddArray(values);
+  fd->AddArray(negated);
+
+  // The batched sweep must fill the same caches as per-array queries.
+  fd->ComputeRanges();
+
+  double range[2];
+
+  fd->GetRange(0, range);
+  if (range[0] != -10 || range[1] != 999)
+  {
+    vtkLog(ERROR, "Wrong range after ComputeRanges [" << range[0] << ", " << range[1] << "]");
+    retVal = false;
+  }
+
+  fd->GetRange(1, range);
+  if (range[0] != -999 || range[1] != 10)
+  {
+    vtkLog(ERROR,
+      "Wrong range for second array after ComputeRanges [" << range[0] << ", " << range[1] << "]");
+    retVal = false;
+  }
+
+  return retVal;
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -229,6 +276,12 @@ int otherFieldData(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  vtkLog(INFO, "Testing Batched Range Computation...");
+  if (!TestComputeRanges())
+  {
+    retVal = EXIT_FAILURE;
+  }
+
   /* Obsolete API.
   double tuple[10];
   // initialize tuple before using it to set something
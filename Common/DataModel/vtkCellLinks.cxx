@@ -28,7 +28,6 @@ vtkStandardNewMacro(vtkCellLinks);
 //------------------------------------------------------------------------------
 vtkCellLinks::~vtkCellLinks()
 {
-  this->Type = vtkAbstractCellLinks::CELL_LINKS;
   this->Initialize();
 }
 
@@ -177,6 +177,7 @@ protected:
     , NumberOfPoints(0)
     , NumberOfCells(0)
   {
+    this->Type = vtkAbstractCellLinks::CELL_LINKS;
   }
   ~vtkCellLinks() override;
 
@@ -13,8 +13,13 @@
 
 =========================================================================*/
 #include "vtkCylinder.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
 
 vtkStandardNewMacro(vtkCylinder);
 
@@ -48,6 +53,82 @@ double vtkCylinder::EvaluateFunction(double x[3])
   return ((vtkMath::Dot(x2C, x2C) - proj * proj) - this->Radius * this->Radius);
 }
 
+// Accelerate cylinder evaluation over contiguous arrays of points
+namespace
+{
+template <typename InputArrayType, typename OutputArrayType>
+struct CylinderWorker
+{
+  using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+
+  InputArrayType* Input;
+  OutputArrayType* Output;
+  OutputValueType Center[3];
+  OutputValueType Axis[3];
+  OutputValueType Radius2;
+
+  CylinderWorker(InputArrayType* in, OutputArrayType* out)
+    : Input(in)
+    , Output(out)
+  {
+  }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(this->Input, begin, end);
+    auto dstValues = vtk::DataArrayValueRange<1>(this->Output, begin, end);
+
+    using DstTupleCRefType = typename decltype(srcTuples)::ConstTupleReferenceType;
+
+    std::transform(srcTuples.cbegin(), srcTuples.cend(), dstValues.begin(),
+      [&](DstTupleCRefType tuple) -> OutputValueType {
+        const OutputValueType dx = static_cast<OutputValueType>(tuple[0]) - this->Center[0];
+        const OutputValueType dy = static_cast<OutputValueType>(tuple[1]) - this->Center[1];
+        const OutputValueType dz = static_cast<OutputValueType>(tuple[2]) - this->Center[2];
+        const OutputValueType proj = this->Axis[0] * dx + this->Axis[1] * dy + this->Axis[2] * dz;
+        return dx * dx + dy * dy + dz * dz - proj * proj - this->Radius2;
+      });
+  }
+};
+
+struct CylinderFunctionWorker
+{
+  double Center[3];
+  double Axis[3];
+  double Radius;
+  CylinderFunctionWorker(double c[3], double a[3], double r)
+    : Radius(r)
+  {
+    std::copy_n(c, 3, this->Center);
+    std::copy_n(a, 3, this->Axis);
+  }
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    VTK_ASSUME(input->GetNumberOfComponents() == 3);
+    VTK_ASSUME(output->GetNumberOfComponents() == 1);
+    vtkIdType numTuples = input->GetNumberOfTuples();
+    CylinderWorker<InputArrayType, OutputArrayType> cylinder(input, output);
+    std::copy_n(Center, 3, cylinder.Center);
+    std::copy_n(Axis, 3, cylinder.Axis);
+    cylinder.Radius2 = Radius * Radius;
+    vtkSMPTools::For(0, numTuples, cylinder);
+  }
+};
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+void vtkCylinder::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  CylinderFunctionWorker worker(this->Center, this->Axis, this->Radius);
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueType<InputTypes, OutputTypes> MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate cylinder function gradient (along potentially oriented axis). The
 // gradient is always in the radial direction, and thus must be projected
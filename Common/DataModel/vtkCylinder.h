@@ -58,6 +58,7 @@ public:
    * Evaluate cylinder equation F(r) = r^2 - Radius^2.
    */
   using vtkImplicitFunction::EvaluateFunction;
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
   ///@}
 
@@ -28,6 +28,7 @@
 vtkDataObjectTree::vtkDataObjectTree()
 {
   this->Internals = new vtkDataObjectTreeInternals;
+  this->LeafDataObjectsTime = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -624,6 +625,62 @@ vtkIdType vtkDataObjectTree::GetNumberOfCells()
   return numCells;
 }
 
+//------------------------------------------------------------------------------
+// The maximum MTime over this tree and all of its nested trees. Structural
+// changes (SetChild, RemoveChild, ...) always modify the node they apply to,
+// so this stamp changes whenever the leaf list could have changed. It only
+// visits internal nodes, which is far cheaper than a full leaf traversal.
+vtkMTimeType vtkDataObjectTree::GetTreeMTime(vtkDataObjectTree* tree)
+{
+  vtkMTimeType mtime = tree->GetMTime();
+  unsigned int numChildren = tree->GetNumberOfChildren();
+  for (unsigned int cc = 0; cc < numChildren; cc++)
+  {
+    if (vtkDataObjectTree* childTree = vtkDataObjectTree::SafeDownCast(tree->GetChild(cc)))
+    {
+      vtkMTimeType childTime = this->GetTreeMTime(childTree);
+      mtime = (childTime > mtime ? childTime : mtime);
+    }
+  }
+  return mtime;
+}
+
+//------------------------------------------------------------------------------
+void vtkDataObjectTree::BuildLeafDataObjects(vtkDataObjectTree* tree)
+{
+  unsigned int numChildren = tree->GetNumberOfChildren();
+  for (unsigned int cc = 0; cc < numChildren; cc++)
+  {
+    vtkDataObject* child = tree->GetChild(cc);
+    if (vtkDataObjectTree* childTree = vtkDataObjectTree::SafeDownCast(child))
+    {
+      this->BuildLeafDataObjects(childTree);
+    }
+    else
+    {
+      this->LeafDataObjects[0].push_back(child);
+      if (child)
+      {
+        this->LeafDataObjects[1].push_back(child);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+const std::vector<vtkDataObject*>& vtkDataObjectTree::GetLeafDataObjects(bool skipEmptyNodes)
+{
+  vtkMTimeType treeTime = this->GetTreeMTime(this);
+  if (this->LeafDataObjectsTime < treeTime)
+  {
+    this->LeafDataObjects[0].clear();
+    this->LeafDataObjects[1].clear();
+    this->BuildLeafDataObjects(this);
+    this->LeafDataObjectsTime = treeTime;
+  }
+  return this->LeafDataObjects[skipEmptyNodes ? 1 : 0];
+}
+
 //------------------------------------------------------------------------------
 unsigned long vtkDataObjectTree::GetActualMemorySize()
 {
@@ -36,6 +36,8 @@
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkCompositeDataSet.h"
 
+#include <vector> // For GetLeafDataObjects
+
 class vtkCompositeDataIterator;
 class vtkDataObjectTreeIterator;
 class vtkDataObjectTreeInternals;
@@ -145,6 +147,19 @@ public:
    */
   vtkIdType GetNumberOfCells() override;
 
+  /**
+   * Returns the non-composite leaf data objects of the tree in flat-index
+   * order, suitable for range-for traversal without any iterator
+   * allocation. The list is cached on the tree and rebuilt only when the
+   * structure changes (tracked through the MTime of the tree and of its
+   * nested trees), so repeated traversals -- for instance one per render
+   * pass over a large partitioned collection -- cost a single sweep over
+   * the internal nodes. When skipEmptyNodes is true (the default), null
+   * leaves are omitted. The returned reference is owned by the tree and is
+   * valid only until the tree is modified.
+   */
+  const std::vector<vtkDataObject*>& GetLeafDataObjects(bool skipEmptyNodes = true);
+
   ///@{
   /**
    * Retrieve an instance of this class from an information object.
@@ -214,6 +229,18 @@ protected:
    */
   virtual vtkDataObjectTree* CreateForCopyStructure(vtkDataObjectTree* other);
 
+  ///@{
+  /**
+   * Support for GetLeafDataObjects(): the maximum MTime over the tree and
+   * all of its nested trees, the recursive cache fill, and the cached leaf
+   * lists (with and without null leaves) with their validity stamp.
+   */
+  vtkMTimeType GetTreeMTime(vtkDataObjectTree* tree);
+  void BuildLeafDataObjects(vtkDataObjectTree* tree);
+  std::vector<vtkDataObject*> LeafDataObjects[2];
+  vtkMTimeType LeafDataObjectsTime;
+  ///@}
+
   // The internal datastructure. Subclasses need not access this directly.
   vtkDataObjectTreeInternals* Internals;
 
@@ -16,7 +16,10 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkArrayIteratorIncludes.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkDataArrayRange.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
@@ -1099,6 +1102,168 @@ void vtkDataSetAttributes::InterpolatePoint(
   } // for all arrays to interpolate
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+//==============================================================================
+// This worker interpolates a batch of destination tuples from explicitly
+// indexed source tuples and weights, processing the whole batch in a single
+// parallel pass over the array pair. The array pair is dispatched once for
+// the batch, instead of once per output tuple as InterpolateTuple does.
+struct InterpolatePointsWorker
+{
+  vtkIdType NumToIds;
+  const vtkIdType* ToIds;
+  const vtkIdType* Offsets;
+  const vtkIdType* Ids;
+  const double* Weights;
+  bool NearestNeighbor;
+
+  InterpolatePointsWorker(vtkIdType numToIds, const vtkIdType* toIds, const vtkIdType* offsets,
+    const vtkIdType* ids, const double* weights, bool nearestNeighbor)
+    : NumToIds(numToIds)
+    , ToIds(toIds)
+    , Offsets(offsets)
+    , Ids(ids)
+    , Weights(weights)
+    , NearestNeighbor(nearestNeighbor)
+  {
+  }
+
+  template <typename Array1T, typename Array2T>
+  void operator()(Array1T* dst, Array2T* src) const
+  {
+    // Give the compiler a hand -- allow optimizations that require both arrays
+    // to have the same stride.
+    VTK_ASSUME(src->GetNumberOfComponents() == dst->GetNumberOfComponents());
+
+    vtkDataArrayAccessor<Array2T> s(src);
+    vtkDataArrayAccessor<Array1T> d(dst);
+
+    typedef typename vtkDataArrayAccessor<Array1T>::APIType DestType;
+
+    const int numComps = dst->GetNumberOfComponents();
+
+    vtkSMPTools::For(0, this->NumToIds, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType tupleId = begin; tupleId < end; ++tupleId)
+      {
+        const vtkIdType first = this->Offsets[tupleId];
+        const vtkIdType last = this->Offsets[tupleId + 1];
+        const vtkIdType toId = this->ToIds[tupleId];
+
+        if (this->NearestNeighbor)
+        {
+          vtkIdType maxId = this->Ids[first];
+          double maxWeight = 0.;
+          for (vtkIdType j = first; j < last; ++j)
+          {
+            if (this->Weights[j] > maxWeight)
+            {
+              maxWeight = this->Weights[j];
+              maxId = this->Ids[j];
+            }
+          }
+          for (int c = 0; c < numComps; ++c)
+          {
+            d.Set(toId, c, static_cast<DestType>(s.Get(maxId, c)));
+          }
+        }
+        else
+        {
+          for (int c = 0; c < numComps; ++c)
+          {
+            double val = 0.;
+            for (vtkIdType j = first; j < last; ++j)
+            {
+              val += this->Weights[j] * static_cast<double>(s.Get(this->Ids[j], c));
+            }
+            DestType valT;
+            vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+            d.Set(toId, c, valT);
+          }
+        }
+      }
+    });
+
+    dst->DataChanged();
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Batched form of InterpolatePoint. Make sure that the method
+// InterpolateAllocate() has been invoked before using this method.
+void vtkDataSetAttributes::InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType numToIds,
+  const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* ids, const double* weights)
+{
+  if (numToIds == 0)
+  {
+    return;
+  }
+
+  const vtkIdType numberOfTuples = 1 + *std::max_element(toIds, toIds + numToIds);
+
+  for (const auto& i : this->RequiredArrays)
+  {
+    vtkAbstractArray* fromArray = fromPd->Data[i];
+    vtkAbstractArray* toArray = this->Data[this->TargetIndices[i]];
+
+    // check if the destination array needs nearest neighbor interpolation
+    int attributeIndex = this->IsArrayAnAttribute(this->TargetIndices[i]);
+    bool nearestNeighbor =
+      (attributeIndex != -1 && this->CopyAttributeFlags[INTERPOLATE][attributeIndex] == 2);
+
+    vtkDataArray* fromDA = vtkArrayDownCast<vtkDataArray>(fromArray);
+    vtkDataArray* toDA = vtkArrayDownCast<vtkDataArray>(toArray);
+    if (!fromDA || !toDA) // String array, etc
+    {
+      vtkNew<vtkIdList> ptIds;
+      for (vtkIdType t = 0; t < numToIds; ++t)
+      {
+        const vtkIdType first = offsets[t];
+        const vtkIdType numIds = offsets[t + 1] - first;
+        if (nearestNeighbor)
+        {
+          vtkIdType maxId = ids[first];
+          double maxWeight = 0.;
+          for (vtkIdType j = 0; j < numIds; ++j)
+          {
+            if (weights[first + j] > maxWeight)
+            {
+              maxWeight = weights[first + j];
+              maxId = ids[first + j];
+            }
+          }
+          toArray->InsertTuple(toIds[t], maxId, fromArray);
+        }
+        else
+        {
+          ptIds->SetArray(const_cast<vtkIdType*>(ids) + first, numIds, false /* save */);
+          toArray->InterpolateTuple(toIds[t], ptIds, fromArray, const_cast<double*>(weights) + first);
+        }
+      }
+      continue;
+    }
+
+    // Pre-size the destination so the parallel writes below never resize.
+    if (numberOfTuples > toDA->GetSize() / toDA->GetNumberOfComponents())
+    {
+      toDA->Resize(numberOfTuples); // this preserves already existing data
+    }
+    if (numberOfTuples > toDA->GetNumberOfTuples())
+    {
+      toDA->SetNumberOfTuples(numberOfTuples); // this sets MaxId
+    }
+
+    InterpolatePointsWorker worker(numToIds, toIds, offsets, ids, weights, nearestNeighbor);
+    if (!vtkArrayDispatch::Dispatch2SameValueType::Execute(toDA, fromDA, worker))
+    {
+      // Fallback to vtkDataArray API (e.g. vtkBitArray):
+      worker(toDA, fromDA);
+    }
+  } // for all arrays to interpolate
+}
+
 //------------------------------------------------------------------------------
 // Interpolate data from the two points p1,p2 (forming an edge) and an
 // interpolation factor, t, along the edge. The weight ranges from (0,1),
@@ -572,6 +572,19 @@ public:
   void InterpolatePoint(
     vtkDataSetAttributes* fromPd, vtkIdType toId, vtkIdList* ids, double* weights);
 
+  /**
+   * Batched form of InterpolatePoint(). Output tuple toIds[i]
+   * (0 <= i < numToIds) is interpolated from the input tuples
+   * ids[offsets[i]] up to ids[offsets[i+1]-1] with the matching entries of
+   * weights, so offsets must hold numToIds+1 values. Each attribute array
+   * is processed in a single dispatched pass that is parallelized with
+   * vtkSMPTools, which amortizes the per-tuple dispatch of
+   * InterpolatePoint() to once per array. The INTERPOLATION copy flags
+   * are honored the same way as in InterpolatePoint().
+   */
+  void InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType numToIds, const vtkIdType* toIds,
+    const vtkIdType* offsets, const vtkIdType* ids, const double* weights);
+
   /**
    * Interpolate data from the two points p1,p2 (forming an edge) and an
    * interpolation factor, t, along the edge. The weight ranges from (0,1),
@@ -20,6 +20,7 @@
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <array>
@@ -717,6 +718,24 @@ bool vtkFieldData::GetFiniteRange(int index, double range[2], int comp)
     &vtkDataArray::ComputeFiniteVectorRange, &vtkDataArray::ComputeFiniteScalarRange);
 }
 
+//------------------------------------------------------------------------------
+void vtkFieldData::ComputeRanges()
+{
+  // The cache entries in Ranges and FiniteRanges are pre-sized and disjoint
+  // per array index, so filling them for distinct arrays in parallel is safe.
+  vtkSMPTools::For(0, this->GetNumberOfArrays(), [this](vtkIdType begin, vtkIdType end) {
+    double range[2];
+    for (vtkIdType index = begin; index < end; ++index)
+    {
+      if (vtkArrayDownCast<vtkDataArray>(this->GetAbstractArray(static_cast<int>(index))))
+      {
+        this->GetRange(static_cast<int>(index), range, 0);
+        this->GetFiniteRange(static_cast<int>(index), range, 0);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 void vtkFieldData::RemoveArray(const char* name)
 {
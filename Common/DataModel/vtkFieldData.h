@@ -389,6 +389,17 @@ public:
   bool GetFiniteRange(int index, double range[2], int comp = 0);
   ///@}
 
+  /**
+   * Compute and cache the ranges of every `vtkDataArray` held by this field
+   * data in one sweep. The component ranges and finite component ranges are
+   * cached exactly as if `GetRange` / `GetFiniteRange` had been called for
+   * each array, so subsequent per-array queries are served from the cache.
+   * The arrays are processed in parallel with vtkSMPTools (in addition to
+   * the parallel reduction used within each array), which makes this the
+   * preferred entry point when the ranges of many arrays are needed at once.
+   */
+  void ComputeRanges();
+
   ///@{
   /**
    * Set / Get the binary mask filtering out certain types of ghosts when calling `GetRange`.
@@ -23,6 +23,14 @@
  * The SetCellType() methods use \#define constants; these are defined in
  * the file vtkCellType.h.
  *
+ * vtkGenericCell also acts as a per-instance pool for its cell working set:
+ * each concrete cell type instantiated through SetCellType() is retained for
+ * the lifetime of the vtkGenericCell, and the associated vtkPoints and
+ * vtkIdList storage only reallocates when a larger cell is encountered. To
+ * avoid heap traffic in cell-traversal loops, create one vtkGenericCell per
+ * thread (e.g., via vtkSMPThreadLocalObject) and reuse it across the whole
+ * traversal rather than creating one per cell or per query.
+ *
  * @sa
  * vtkCell vtkDataSet
  */
@@ -14,8 +14,11 @@
 =========================================================================*/
 #include "vtkImplicitBoolean.h"
 
+#include "vtkDoubleArray.h"
 #include "vtkImplicitFunctionCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <cmath>
 
@@ -146,6 +149,83 @@ double vtkImplicitBoolean::EvaluateFunction(double x[3])
   return value;
 }
 
+// Evaluate boolean combinations of implicit functions over an array of
+// points. Each function in the list is evaluated through its own array fast
+// path (e.g. vtkPlane, vtkSphere) and the per-point results are then combined
+// according to the current operator.
+void vtkImplicitBoolean::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  const vtkIdType numPts = input->GetNumberOfTuples();
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(numPts);
+
+  if (this->FunctionList->GetNumberOfItems() == 0)
+  {
+    output->Fill(0.0);
+    return;
+  }
+
+  vtkNew<vtkDoubleArray> accum;
+  accum->SetNumberOfTuples(numPts);
+  vtkNew<vtkDoubleArray> scratch;
+  scratch->SetNumberOfTuples(numPts);
+  double* acc = accum->GetPointer(0);
+  double* val = scratch->GetPointer(0);
+
+  vtkImplicitFunction* f;
+  vtkCollectionSimpleIterator sit;
+  this->FunctionList->InitTraversal(sit);
+  f = this->FunctionList->GetNextImplicitFunction(sit);
+  f->FunctionValue(input, accum);
+  if (this->OperationType == VTK_UNION_OF_MAGNITUDES)
+  {
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        acc[cc] = fabs(acc[cc]);
+      }
+    });
+  }
+
+  while ((f = this->FunctionList->GetNextImplicitFunction(sit)) != nullptr)
+  {
+    f->FunctionValue(input, scratch);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      switch (this->OperationType)
+      {
+        case VTK_UNION:
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            acc[cc] = (val[cc] < acc[cc] ? val[cc] : acc[cc]);
+          }
+          break;
+        case VTK_INTERSECTION:
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            acc[cc] = (val[cc] > acc[cc] ? val[cc] : acc[cc]);
+          }
+          break;
+        case VTK_UNION_OF_MAGNITUDES:
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            const double v = fabs(val[cc]);
+            acc[cc] = (v < acc[cc] ? v : acc[cc]);
+          }
+          break;
+        default: // difference
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            const double v = -val[cc];
+            acc[cc] = (v > acc[cc] ? v : acc[cc]);
+          }
+          break;
+      }
+    });
+  }
+
+  output->CopyComponent(0, accum, 0);
+}
+
 // Evaluate gradient of boolean combination.
 void vtkImplicitBoolean::EvaluateGradient(double x[3], double g[3])
 {
@@ -40,6 +40,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -1338,9 +1339,31 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
   int* leftIds = ids;
   int* rightIds = ids ? ids + nleft : nullptr;
 
-  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
+  // The two subtrees rearrange disjoint ranges of the points and ids arrays,
+  // so they can be built as independent tasks.  Only spawn tasks while the
+  // ranges are large enough to amortize the scheduling overhead; below the
+  // threshold plain recursion is used.
+  constexpr int VTK_KDTREE_MIN_POINTS_PER_TASK = 10000;
 
-  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
+  if (kd->GetNumberOfPoints() >= VTK_KDTREE_MIN_POINTS_PER_TASK)
+  {
+    vtkKdNode* children[2] = { kd->GetLeft(), kd->GetRight() };
+    float* childPoints[2] = { c1, c1 + nleft * 3 };
+    int* childIds[2] = { leftIds, rightIds };
+
+    vtkSMPTools::For(0, 2, 1, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType child = begin; child < end; ++child)
+      {
+        this->DivideRegion(children[child], childPoints[child], childIds[child], level + 1);
+      }
+    });
+  }
+  else
+  {
+    this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
+
+    this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
+  }
 
   return 0;
 }
@@ -1865,27 +1888,36 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
     }
     else
     {
-      // Hopefully point arrays are usually floats.  This conversion will
-      // really slow things down.
-
-      for (vtkIdType ii = 0; ii < npoints; ii++)
-      {
-        double* pt = ptArrays[i]->GetPoint(ii);
+      // Convert in parallel straight from the underlying data array.
+      // GetTuple writes into a caller-provided buffer, unlike GetPoint
+      // which returns a pointer to internal storage and so cannot be
+      // called concurrently.
+      vtkDataArray* da = ptArrays[i]->GetData();
+      float* dest = points + ptId;
+      vtkSMPTools::For(0, npoints, [da, dest](vtkIdType begin, vtkIdType end) {
+        double pt[3];
+        for (vtkIdType ii = begin; ii < end; ii++)
+        {
+          da->GetTuple(ii, pt);
 
-        points[ptId++] = static_cast<float>(pt[0]);
-        points[ptId++] = static_cast<float>(pt[1]);
-        points[ptId++] = static_cast<float>(pt[2]);
-      }
+          dest[3 * ii] = static_cast<float>(pt[0]);
+          dest[3 * ii + 1] = static_cast<float>(pt[1]);
+          dest[3 * ii + 2] = static_cast<float>(pt[2]);
+        }
+      });
+      ptId += nvals;
     }
   }
 
-  for (ptId = 0; ptId < totalNumPoints; ptId++)
-  {
-    // Select_ dominates DivideRegion algorithm, operating on
-    // ints is much fast than operating on long longs
+  // Select_ dominates DivideRegion algorithm, operating on
+  // ints is much fast than operating on long longs
 
-    ptIds[ptId] = ptId;
-  }
+  vtkSMPTools::For(0, totalNumPoints, [ptIds](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ii = begin; ii < end; ii++)
+    {
+      ptIds[ii] = static_cast<int>(ii);
+    }
+  });
 
   TIMERDONE("Set up to build k-d tree");
 
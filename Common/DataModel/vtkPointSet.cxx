@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkPointSet.h"
 
+#include "vtkBoundingBox.h"
 #include "vtkCell.h"
 #include "vtkCellLocator.h"
 #include "vtkClosestPointStrategy.h"
@@ -122,10 +123,20 @@ void vtkPointSet::ComputeBounds()
     // which has no impact on the bounds
     if (this->Points->GetMTime() >= this->ComputeTime)
     {
-      const double* bounds = this->Points->GetBounds();
-      for (int i = 0; i < 6; i++)
+      if (this->Points->GetNumberOfPoints() > 0)
       {
-        this->Bounds[i] = bounds[i];
+        // Compute directly from the points array: the dispatched
+        // vtkBoundingBox path threads over the tuple range instead of
+        // walking components serially through the generic array API.
+        vtkBoundingBox::ComputeBounds(this->Points, this->Bounds);
+      }
+      else
+      {
+        const double* bounds = this->Points->GetBounds();
+        for (int i = 0; i < 6; i++)
+        {
+          this->Bounds[i] = bounds[i];
+        }
       }
       this->ComputeTime.Modified();
     }
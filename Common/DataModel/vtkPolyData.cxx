@@ -33,6 +33,7 @@
 #include "vtkQuad.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCellLinks.h"
 #include "vtkTriangle.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
@@ -954,14 +955,25 @@ void vtkPolyData::BuildLinks(int initialSize)
     this->BuildCells();
   }
 
-  this->Links = vtkSmartPointer<vtkCellLinks>::New();
-  if (initialSize > 0)
+  // Create appropriate links. Currently, it's either a vtkCellLinks (when
+  // the dataset is editable) or vtkStaticCellLinks (when the dataset is
+  // not editable).
+  if (!this->Editable)
   {
-    this->Links->Allocate(initialSize);
+    this->Links = vtkSmartPointer<vtkStaticCellLinks>::New();
   }
   else
   {
-    this->Links->Allocate(this->GetNumberOfPoints());
+    vtkNew<vtkCellLinks> links;
+    if (initialSize > 0)
+    {
+      links->Allocate(initialSize);
+    }
+    else
+    {
+      links->Allocate(this->GetNumberOfPoints());
+    }
+    this->Links = links;
   }
 
   this->Links->BuildLinks(this);
@@ -972,15 +984,8 @@ void vtkPolyData::SetLinks(vtkAbstractCellLinks* links)
 {
   if (this->Links != links)
   {
-    if (auto cellLinks = vtkCellLinks::SafeDownCast(links))
-    {
-      this->Links = cellLinks;
-      this->Modified();
-    }
-    else
-    {
-      vtkErrorMacro("Only vtkCellLinks are currently supported.");
-    }
+    this->Links = links;
+    this->Modified();
   }
 }
 
@@ -1005,6 +1010,25 @@ void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
+{
+  if (!this->Editable)
+  {
+    vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
+
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+  else
+  {
+    vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
+
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
@@ -1018,8 +1042,7 @@ void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
   }
   cellIds->Reset();
 
-  numCells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
+  this->GetPointCells(ptId, numCells, cells);
 
   for (i = 0; i < numCells; i++)
   {
@@ -1180,7 +1203,12 @@ void vtkPolyData::ReverseCell(vtkIdType cellId)
 // use this method, make sure points are available and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 {
-  return this->Links->InsertNextPoint(numLinks);
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return -1;
+  }
+  return links->InsertNextPoint(numLinks);
 }
 
 //------------------------------------------------------------------------------
@@ -1190,7 +1218,12 @@ vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 // and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(double x[3], int numLinks)
 {
-  this->Links->InsertNextPoint(numLinks);
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return -1;
+  }
+  links->InsertNextPoint(numLinks);
   return this->Points->InsertNextPoint(x);
 }
 
@@ -1202,12 +1235,18 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 {
   vtkIdType i, id;
 
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return -1;
+  }
+
   id = this->InsertNextCell(type, npts, pts);
 
   for (i = 0; i < npts; i++)
   {
-    this->Links->ResizeCellList(pts[i], 1);
-    this->Links->AddCellReference(id, pts[i]);
+    links->ResizeCellList(pts[i], 1);
+    links->AddCellReference(id, pts[i]);
   }
 
   return id;
@@ -1220,7 +1259,10 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->RemoveCellReference(cellId, ptId);
+  if (vtkCellLinks* links = this->GetEditableLinks())
+  {
+    links->RemoveCellReference(cellId, ptId);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1230,7 +1272,10 @@ void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->AddCellReference(cellId, ptId);
+  if (vtkCellLinks* links = this->GetEditableLinks())
+  {
+    links->AddCellReference(cellId, ptId);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1265,10 +1310,15 @@ void vtkPolyData::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 // link list is changing size.
 void vtkPolyData::ReplaceLinkedCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 {
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return;
+  }
   this->ReplaceCell(cellId, npts, pts);
   for (int i = 0; i < npts; i++)
   {
-    this->Links->InsertNextCellReference(pts[i], cellId);
+    links->InsertNextCellReference(pts[i], cellId);
   }
 }
 
@@ -1281,14 +1331,13 @@ void vtkPolyData::GetCellEdgeNeighbors(
 {
   cellIds->Reset();
 
-  const vtkCellLinks::Link& link1(this->Links->GetLink(p1));
-  const vtkCellLinks::Link& link2(this->Links->GetLink(p2));
-
-  const vtkIdType* cells1 = link1.cells;
-  const vtkIdType* cells1End = cells1 + link1.ncells;
+  vtkIdType ncells1, ncells2;
+  vtkIdType *cells1, *cells2;
+  this->GetPointCells(p1, ncells1, cells1);
+  this->GetPointCells(p2, ncells2, cells2);
 
-  const vtkIdType* cells2 = link2.cells;
-  const vtkIdType* cells2End = cells2 + link2.ncells;
+  const vtkIdType* cells1End = cells1 + ncells1;
+  const vtkIdType* cells2End = cells2 + ncells2;
 
   while (cells1 != cells1End)
   {
@@ -1324,8 +1373,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
 
   // load list with candidate cells, remove current cell
   vtkIdType ptId = ptIds->GetId(0);
-  int numPrime = this->Links->GetNcells(ptId);
-  vtkIdType* primeCells = this->Links->GetCells(ptId);
+  vtkIdType numPrime;
+  vtkIdType* primeCells;
+  this->GetPointCells(ptId, numPrime, primeCells);
   numPts = ptIds->GetNumberOfIds();
 
   // for each potential cell
@@ -1338,8 +1388,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
       for (allFound = 1, i = 1; i < numPts && allFound; i++)
       {
         ptId = ptIds->GetId(i);
-        int numCurrent = this->Links->GetNcells(ptId);
-        vtkIdType* currentCells = this->Links->GetCells(ptId);
+        vtkIdType numCurrent;
+        vtkIdType* currentCells;
+        this->GetPointCells(ptId, numCurrent, currentCells);
         oneFound = 0;
         for (j = 0; j < numCurrent; j++)
         {
@@ -373,17 +373,18 @@ public:
 
   /**
    * Create upward links from points to cells that use each point. Enables
-   * topologically complex queries. Normally the links array is allocated
-   * based on the number of points in the vtkPolyData. The optional
-   * initialSize parameter can be used to allocate a larger size initially.
+   * topologically complex queries. The created links are either a
+   * vtkCellLinks (when the dataset is editable) or the compact, CSR-storage
+   * vtkStaticCellLinks built in parallel (when the dataset is not
+   * editable). The optional initialSize parameter only applies to the
+   * editable vtkCellLinks and can be used to allocate a larger size
+   * initially.
    */
   void BuildLinks(int initialSize = 0);
 
   ///@{
   /**
    * Set/Get the links that you created possibly without using BuildLinks.
-   *
-   * Note: Only vtkCellLinks are currently supported.
    */
   virtual void SetLinks(vtkAbstractCellLinks* links);
   vtkGetSmartPointerMacro(Links, vtkAbstractCellLinks);
@@ -706,6 +707,14 @@ protected:
 
   vtkCellArray* GetCellArrayInternal(TaggedCellId tag);
 
+  /**
+   * Return the links as the editable vtkCellLinks built when the dataset is
+   * set as Editable. Returns nullptr (after emitting an error) when the
+   * links are the read-only vtkStaticCellLinks, i.e., when a link-editing
+   * operator is invoked without calling EditableOn() before BuildLinks().
+   */
+  vtkCellLinks* GetEditableLinks();
+
   // constant cell objects returned by GetCell called.
   vtkSmartPointer<vtkVertex> Vertex;
   vtkSmartPointer<vtkPolyVertex> PolyVertex;
@@ -727,7 +736,7 @@ protected:
   // supporting structures for more complex topological operations
   // built only when necessary
   vtkSmartPointer<CellMap> Cells;
-  vtkSmartPointer<vtkCellLinks> Links;
+  vtkSmartPointer<vtkAbstractCellLinks> Links;
 
   vtkNew<vtkIdList> LegacyBuffer;
 
@@ -747,13 +756,6 @@ private:
   void operator=(const vtkPolyData&) = delete;
 };
 
-//------------------------------------------------------------------------------
-inline void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
-{
-  ncells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
-}
-
 //------------------------------------------------------------------------------
 inline vtkIdType vtkPolyData::GetNumberOfCells()
 {
@@ -852,10 +854,25 @@ inline int vtkPolyData::IsPointUsedByCell(vtkIdType ptId, vtkIdType cellId)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+inline vtkCellLinks* vtkPolyData::GetEditableLinks()
+{
+  if (this->Links == nullptr || this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
+  {
+    vtkErrorMacro("Link editing requires editable cell links: "
+                  "call EditableOn() before BuildLinks()");
+    return nullptr;
+  }
+  return static_cast<vtkCellLinks*>(this->Links.Get());
+}
+
 //------------------------------------------------------------------------------
 inline void vtkPolyData::DeletePoint(vtkIdType ptId)
 {
-  this->Links->DeletePoint(ptId);
+  if (vtkCellLinks* links = this->GetEditableLinks())
+  {
+    links->DeletePoint(ptId);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -870,10 +887,15 @@ inline void vtkPolyData::RemoveCellReference(vtkIdType cellId)
   const vtkIdType* pts;
   vtkIdType npts;
 
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return;
+  }
   this->GetCellPoints(cellId, npts, pts);
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->RemoveCellReference(cellId, pts[i]);
+    links->RemoveCellReference(cellId, pts[i]);
   }
 }
 
@@ -883,17 +905,25 @@ inline void vtkPolyData::AddCellReference(vtkIdType cellId)
   const vtkIdType* pts;
   vtkIdType npts;
 
+  vtkCellLinks* links = this->GetEditableLinks();
+  if (links == nullptr)
+  {
+    return;
+  }
   this->GetCellPoints(cellId, npts, pts);
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->AddCellReference(cellId, pts[i]);
+    links->AddCellReference(cellId, pts[i]);
   }
 }
 
 //------------------------------------------------------------------------------
 inline void vtkPolyData::ResizeCellList(vtkIdType ptId, int size)
 {
-  this->Links->ResizeCellList(ptId, size);
+  if (vtkCellLinks* links = this->GetEditableLinks())
+  {
+    links->ResizeCellList(ptId, size);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -217,18 +217,44 @@ static const double VTK_HEX_CONVERGED = 1.e-04;
 int vtkQuadraticHexahedron::EvaluatePosition(const double x[3], double closestPoint[3], int& subId,
   double pcoords[3], double& dist2, double weights[])
 {
-  double params[3] = { 0.5, 0.5, 0.5 };
+  static const double center[3] = { 0.5, 0.5, 0.5 };
+  return this->EvaluatePositionNewton(x, closestPoint, subId, pcoords, dist2, weights, center);
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadraticHexahedron::EvaluatePositionWithGuess(const double x[3], double closestPoint[3],
+  int& subId, double pcoords[3], double& dist2, double weights[])
+{
+  double guess[3] = { pcoords[0], pcoords[1], pcoords[2] };
+  if (!(guess[0] >= 0.0 && guess[0] <= 1.0 && guess[1] >= 0.0 && guess[1] <= 1.0 &&
+        guess[2] >= 0.0 && guess[2] <= 1.0))
+  {
+    guess[0] = guess[1] = guess[2] = 0.5;
+  }
+  return this->EvaluatePositionNewton(x, closestPoint, subId, pcoords, dist2, weights, guess);
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadraticHexahedron::EvaluatePositionNewton(const double x[3], double closestPoint[3],
+  int& subId, double pcoords[3], double& dist2, double weights[], const double initialPCoords[3])
+{
+  double params[3] = { initialPCoords[0], initialPCoords[1], initialPCoords[2] };
   double derivs[60];
 
+  // fetch the cell points once; Newton's iterations revisit all of them on
+  // every pass
+  double pts[20][3];
+  for (int i = 0; i < 20; i++)
+  {
+    this->Points->GetPoint(i, pts[i]);
+  }
+
   // compute a bound on the volume to get a scale for an acceptable determinant
   vtkIdType diagonals[4][2] = { { 0, 6 }, { 1, 7 }, { 2, 4 }, { 3, 5 } };
   double longestDiagonal = 0;
   for (int i = 0; i < 4; i++)
   {
-    double pt0[3], pt1[3];
-    this->Points->GetPoint(diagonals[i][0], pt0);
-    this->Points->GetPoint(diagonals[i][1], pt1);
-    double d2 = vtkMath::Distance2BetweenPoints(pt0, pt1);
+    double d2 = vtkMath::Distance2BetweenPoints(pts[diagonals[i][0]], pts[diagonals[i][1]]);
     if (longestDiagonal < d2)
     {
       longestDiagonal = d2;
@@ -240,7 +266,9 @@ int vtkQuadraticHexahedron::EvaluatePosition(const double x[3], double closestPo
 
   //  set initial position for Newton's method
   subId = 0;
-  pcoords[0] = pcoords[1] = pcoords[2] = 0.5;
+  pcoords[0] = params[0];
+  pcoords[1] = params[1];
+  pcoords[2] = params[2];
 
   //  enter iteration loop
   int converged = 0;
@@ -255,8 +283,7 @@ int vtkQuadraticHexahedron::EvaluatePosition(const double x[3], double closestPo
            tcol[3] = { 0, 0, 0 };
     for (int i = 0; i < 20; i++)
     {
-      double pt[3];
-      this->Points->GetPoint(i, pt);
+      const double* pt = pts[i];
       for (int j = 0; j < 3; j++)
       {
         fcol[j] += pt[j] * weights[i];
@@ -74,6 +74,17 @@ public:
     int subId, const double pcoords[3], const double* values, int dim, double* derivs) override;
   double* GetParametricCoords() override;
 
+  /**
+   * Variant of EvaluatePosition that starts Newton's iterations at the
+   * parametric coordinates passed in through pcoords instead of at the cell
+   * center. When successive queries are spatially coherent (probing along a
+   * ray, advecting a streamline) the previous result is a good starting
+   * point and the iteration typically converges in a step or two. A guess
+   * outside the cell's parametric range falls back to the cell center.
+   */
+  int EvaluatePositionWithGuess(const double x[3], double closestPoint[3], int& subId,
+    double pcoords[3], double& dist2, double weights[]);
+
   /**
    * Clip this quadratic hexahedron using scalar value provided. Like
    * contouring, except that it cuts the hex to produce linear
@@ -129,6 +140,12 @@ protected:
   vtkQuadraticHexahedron();
   ~vtkQuadraticHexahedron() override;
 
+  /**
+   * Newton's-method core of EvaluatePosition, started at initialPCoords.
+   */
+  int EvaluatePositionNewton(const double x[3], double closestPoint[3], int& subId,
+    double pcoords[3], double& dist2, double weights[], const double initialPCoords[3]);
+
   vtkQuadraticEdge* Edge;
   vtkQuadraticQuad* Face;
   vtkHexahedron* Hex;
@@ -136,17 +136,43 @@ const double VTK_TETRA_CONVERGED = 1.e-05;
 int vtkQuadraticTetra::EvaluatePosition(const double* x, double closestPoint[3], int& subId,
   double pcoords[3], double& dist2, double weights[])
 {
-  double params[3] = { .25, .25, .25 };
+  static const double center[3] = { .25, .25, .25 };
+  return this->EvaluatePositionNewton(x, closestPoint, subId, pcoords, dist2, weights, center);
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadraticTetra::EvaluatePositionWithGuess(const double x[3], double closestPoint[3],
+  int& subId, double pcoords[3], double& dist2, double weights[])
+{
+  double guess[3] = { pcoords[0], pcoords[1], pcoords[2] };
+  if (!(guess[0] >= 0.0 && guess[1] >= 0.0 && guess[2] >= 0.0 &&
+        guess[0] + guess[1] + guess[2] <= 1.0))
+  {
+    guess[0] = guess[1] = guess[2] = .25;
+  }
+  return this->EvaluatePositionNewton(x, closestPoint, subId, pcoords, dist2, weights, guess);
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadraticTetra::EvaluatePositionNewton(const double* x, double closestPoint[3], int& subId,
+  double pcoords[3], double& dist2, double weights[], const double initialPCoords[3])
+{
+  double params[3] = { initialPCoords[0], initialPCoords[1], initialPCoords[2] };
   double derivs[30];
 
+  // fetch the cell points once; Newton's iterations revisit all of them on
+  // every pass
+  double pts[10][3];
+  for (int i = 0; i < 10; i++)
+  {
+    this->Points->GetPoint(i, pts[i]);
+  }
+
   // compute a bound on the volume to get a scale for an acceptable determinant
   double longestEdge = 0;
   for (int i = 0; i < 6; i++)
   {
-    double pt0[3], pt1[3];
-    this->Points->GetPoint(TetraEdges[i][0], pt0);
-    this->Points->GetPoint(TetraEdges[i][1], pt1);
-    double d2 = vtkMath::Distance2BetweenPoints(pt0, pt1);
+    double d2 = vtkMath::Distance2BetweenPoints(pts[TetraEdges[i][0]], pts[TetraEdges[i][1]]);
     if (longestEdge < d2)
     {
       longestEdge = d2;
@@ -158,7 +184,9 @@ int vtkQuadraticTetra::EvaluatePosition(const double* x, double closestPoint[3],
 
   //  set initial position for Newton's method
   subId = 0;
-  pcoords[0] = pcoords[1] = pcoords[2] = 0.25;
+  pcoords[0] = params[0];
+  pcoords[1] = params[1];
+  pcoords[2] = params[2];
   //  enter iteration loop
   int converged = 0;
   for (int iteration = 0; !converged && (iteration < VTK_TETRA_MAX_ITERATION); iteration++)
@@ -172,8 +200,7 @@ int vtkQuadraticTetra::EvaluatePosition(const double* x, double closestPoint[3],
            tcol[3] = { 0, 0, 0 };
     for (int i = 0; i < 10; i++)
     {
-      double pt[3];
-      this->Points->GetPoint(i, pt);
+      const double* pt = pts[i];
       for (int j = 0; j < 3; j++)
       {
         fcol[j] += pt[j] * weights[i];
@@ -23,7 +23,9 @@
 #include "vtkCell.h"
 #include "vtkDataArray.h"
 #include "vtkEdgeListIterator.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
@@ -34,6 +36,7 @@
 #include <algorithm>
 #include <map>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 //------------------------------------------------------------------------------
@@ -546,8 +549,10 @@ public:
   void DeepCopy(Implementation* src);
 
   // Description:
-  // Data storage.
-  std::map<int, int> VertexStream;
+  // Data storage. The vertex stream is consulted once per vertex of every
+  // streamed simplex, so use a hash map rather than paying a tree lookup
+  // in the inner streaming loop.
+  std::unordered_map<int, int> VertexStream;
   std::vector<vtkReebCancellation> cancellationHistory;
   // Streaming support
   int VertexMapSize, VertexMapAllocatedSize, TriangleVertexMapSize, TriangleVertexMapAllocatedSize;
@@ -568,7 +573,7 @@ public:
   // CC
   int ConnectedComponentNumber;
 
-  std::map<int, double> ScalarField;
+  std::unordered_map<int, double> ScalarField;
 
   vtkIdType currentNodeId, currentArcId;
 
@@ -1734,7 +1739,7 @@ int vtkReebGraph::Implementation::CommitSimplification()
     {
       std::pair<int, double> scalarVertex;
       scalarVertex.first = after[i].second[j];
-      std::map<int, double>::iterator sIt;
+      std::unordered_map<int, double>::iterator sIt;
       sIt = ScalarField.find(scalarVertex.first);
       if (sIt != ScalarField.end())
       {
@@ -2993,7 +2998,7 @@ int vtkReebGraph::Implementation::StreamTetrahedron(vtkIdType vertex0Id, double
   }
 
   // Add the vertices to the stream
-  std::map<int, int>::iterator sIter;
+  std::unordered_map<int, int>::iterator sIter;
 
   // vertex0
   sIter = this->VertexStream.find(vertex0Id);
@@ -3092,7 +3097,7 @@ int vtkReebGraph::Implementation::StreamTriangle(vtkIdType vertex0Id, double sca
   }
 
   // Add the vertices to the stream
-  std::map<int, int>::iterator sIter;
+  std::unordered_map<int, int>::iterator sIter;
 
   // vertex0
   sIter = this->VertexStream.find(vertex0Id);
@@ -3135,10 +3140,11 @@ int vtkReebGraph::Implementation::StreamTriangle(vtkIdType vertex0Id, double sca
 //------------------------------------------------------------------------------
 int vtkReebGraph::Build(vtkPolyData* mesh, vtkDataArray* scalarField)
 {
+  // only the point ids are needed, so do not instantiate a vtkCell per cell
+  vtkNew<vtkIdList> trianglePointList;
   for (vtkIdType i = 0; i < mesh->GetNumberOfCells(); i++)
   {
-    vtkCell* triangle = mesh->GetCell(i);
-    vtkIdList* trianglePointList = triangle->GetPointIds();
+    mesh->GetCellPoints(i, trianglePointList);
     if (trianglePointList->GetNumberOfIds() != 3)
       return vtkReebGraph::ERR_NOT_A_SIMPLICIAL_MESH;
     StreamTriangle(trianglePointList->GetId(0),
@@ -3158,10 +3164,11 @@ int vtkReebGraph::Build(vtkPolyData* mesh, vtkDataArray* scalarField)
 //------------------------------------------------------------------------------
 int vtkReebGraph::Build(vtkUnstructuredGrid* mesh, vtkDataArray* scalarField)
 {
+  // only the point ids are needed, so do not instantiate a vtkCell per cell
+  vtkNew<vtkIdList> tetPointList;
   for (vtkIdType i = 0; i < mesh->GetNumberOfCells(); i++)
   {
-    vtkCell* tet = mesh->GetCell(i);
-    vtkIdList* tetPointList = tet->GetPointIds();
+    mesh->GetCellPoints(i, tetPointList);
     if (tetPointList->GetNumberOfIds() != 4)
       return vtkReebGraph::ERR_NOT_A_SIMPLICIAL_MESH;
     StreamTetrahedron(tetPointList->GetId(0), scalarField->GetComponent(tetPointList->GetId(0), 0),
@@ -13,8 +13,11 @@
 
 =========================================================================*/
 #include "vtkSphere.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 
@@ -41,6 +44,77 @@ double vtkSphere::EvaluateFunction(double x[3])
     this->Radius * this->Radius);
 }
 
+// Accelerate sphere evaluation over contiguous arrays of points
+namespace
+{
+template <typename InputArrayType, typename OutputArrayType>
+struct SphereWorker
+{
+  using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+
+  InputArrayType* Input;
+  OutputArrayType* Output;
+  OutputValueType Center[3];
+  OutputValueType Radius2;
+
+  SphereWorker(InputArrayType* in, OutputArrayType* out)
+    : Input(in)
+    , Output(out)
+  {
+  }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(this->Input, begin, end);
+    auto dstValues = vtk::DataArrayValueRange<1>(this->Output, begin, end);
+
+    using DstTupleCRefType = typename decltype(srcTuples)::ConstTupleReferenceType;
+
+    std::transform(srcTuples.cbegin(), srcTuples.cend(), dstValues.begin(),
+      [&](DstTupleCRefType tuple) -> OutputValueType {
+        const OutputValueType dx = static_cast<OutputValueType>(tuple[0]) - this->Center[0];
+        const OutputValueType dy = static_cast<OutputValueType>(tuple[1]) - this->Center[1];
+        const OutputValueType dz = static_cast<OutputValueType>(tuple[2]) - this->Center[2];
+        return dx * dx + dy * dy + dz * dz - this->Radius2;
+      });
+  }
+};
+
+struct SphereFunctionWorker
+{
+  double Center[3];
+  double Radius;
+  SphereFunctionWorker(double c[3], double r)
+    : Radius(r)
+  {
+    std::copy_n(c, 3, this->Center);
+  }
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    VTK_ASSUME(input->GetNumberOfComponents() == 3);
+    VTK_ASSUME(output->GetNumberOfComponents() == 1);
+    vtkIdType numTuples = input->GetNumberOfTuples();
+    SphereWorker<InputArrayType, OutputArrayType> sphere(input, output);
+    std::copy_n(Center, 3, sphere.Center);
+    sphere.Radius2 = Radius * Radius;
+    vtkSMPTools::For(0, numTuples, sphere);
+  }
+};
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+void vtkSphere::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  SphereFunctionWorker worker(this->Center, this->Radius);
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueType<InputTypes, OutputTypes> MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate sphere gradient.
 void vtkSphere::EvaluateGradient(double x[3], double n[3])
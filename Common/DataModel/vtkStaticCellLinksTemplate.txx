@@ -317,19 +317,22 @@ struct InsertLinks
   std::atomic<TIds>* Counts;
   const TIds* Offsets;
   TIds* Links;
+  TIds IdOffset; // Non-zero for the second and later polydata cell arrays
 
-  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links)
+  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links,
+    TIds idOffset = 0)
     : CellArray(cellArray)
     , Counts(counts)
     , Offsets(offsets)
     , Links(links)
+    , IdOffset(idOffset)
   {
   }
 
   void operator()(vtkIdType cellId, vtkIdType endCellId)
   {
     this->CellArray->Visit(vtkSCLT_detail::BuildLinksThreaded{}, this->Offsets, this->Counts,
-      this->Links, cellId, endCellId);
+      this->Links, cellId, endCellId, this->IdOffset);
   }
 };
 
@@ -457,18 +460,50 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkPolyData* pd)
   this->Links = new TIds[this->LinksSize + 1];
   this->Links[this->LinksSize] = this->NumPts;
   this->Offsets = new TIds[this->NumPts + 1];
-  this->Offsets[this->NumPts] = this->LinksSize;
-  std::fill_n(this->Offsets, this->NumPts + 1, 0);
 
-  // Now create the links.
   vtkIdType npts, CellId, ptId;
 
+  if (!this->SequentialProcessing)
+  {
+    // Threaded implementation, mirroring ThreadedBuildLinks(): count point
+    // uses with an array of atomics, prefix sum, then insert the cell ids in
+    // parallel. The cell id offset accounts for the concatenation of the
+    // four polydata cell arrays.
+    std::atomic<TIds>* counts = new std::atomic<TIds>[this->NumPts]();
+    for (j = 0; j < 4; ++j)
+    {
+      CountUses<TIds> count(cellArrays[j], counts);
+      vtkSMPTools::For(0, numCells[j], count);
+    }
+
+    this->Offsets[0] = 0;
+    for (ptId = 1; ptId < this->NumPts; ++ptId)
+    {
+      npts = counts[ptId - 1];
+      this->Offsets[ptId] = this->Offsets[ptId - 1] + npts;
+    }
+    this->Offsets[this->NumPts] = this->LinksSize;
+
+    for (CellId = 0, j = 0; j < 4; ++j)
+    {
+      InsertLinks<TIds> insertLinks(
+        cellArrays[j], counts, this->Offsets, this->Links, static_cast<TIds>(CellId));
+      vtkSMPTools::For(0, numCells[j], insertLinks);
+      CellId += numCells[j];
+    } // for each of the four polydata cell arrays
+
+    delete[] counts;
+    return;
+  }
+
+  // Serial implementation follows.
+  std::fill_n(this->Offsets, this->NumPts + 1, 0);
+
   // Visit the four arrays
-  for (CellId = 0, j = 0; j < 4; ++j)
+  for (j = 0; j < 4; ++j)
   {
     // Count number of point uses
-    cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j], CellId);
-    CellId += numCells[j];
+    cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j]);
   } // for each of the four polydata cell arrays
 
   // Perform prefix sum (inclusive scan)
@@ -23,12 +23,15 @@
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkMath.h"
 #include "vtkMergePoints.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
 #include <array>
@@ -1384,6 +1387,82 @@ vtkIdType vtkStaticCellLocator::FindCell(
   return this->Processor->FindCell(pos, cell, subId, pcoords, weights);
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::FindCells(
+  vtkPoints* queryPoints, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords)
+{
+  this->BuildLocator();
+  vtkIdType numQueries = (queryPoints ? queryPoints->GetNumberOfPoints() : 0);
+  cellIds->SetNumberOfTuples(numQueries);
+  pcoords->SetNumberOfComponents(3);
+  pcoords->SetNumberOfTuples(numQueries);
+  if (!this->Processor || numQueries < 1)
+  {
+    cellIds->Fill(-1);
+    pcoords->Fill(0.0);
+    return;
+  }
+
+  // Determine the bin each query point falls in, and sort the queries by
+  // bin. Consecutive queries then process the same run of cells, which is
+  // what provides the cache locality. Out-of-bounds points are tagged with
+  // bin -1 and grouped at the front.
+  std::vector<vtkIdType> bins(numQueries);
+  std::vector<vtkIdType> order(numQueries);
+  const double* bds = this->Bounds;
+  vtkCellBinner* binner = this->Binner;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType beginId, vtkIdType endId) {
+    double x[3];
+    for (vtkIdType i = beginId; i < endId; ++i)
+    {
+      order[i] = i;
+      queryPoints->GetPoint(i, x);
+      if (x[0] < bds[0] || x[0] > bds[1] || x[1] < bds[2] || x[1] > bds[3] || x[2] < bds[4] ||
+        x[2] > bds[5])
+      {
+        bins[i] = -1;
+      }
+      else
+      {
+        bins[i] = binner->GetBinIndex(x);
+      }
+    }
+  });
+  vtkSMPTools::Sort(order.begin(), order.end(), [&bins](vtkIdType a, vtkIdType b) {
+    return bins[a] < bins[b] || (bins[a] == bins[b] && a < b);
+  });
+
+  // Process the sorted queries; each thread maintains its own generic cell
+  // and weights scratch space.
+  vtkCellProcessor* processor = this->Processor;
+  int maxCellSize = this->DataSet->GetMaxCellSize();
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType beginId, vtkIdType endId) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& weights = tlWeights.Local();
+    weights.resize(static_cast<size_t>(maxCellSize));
+    double x[3], pc[3];
+    int subId;
+    for (vtkIdType i = beginId; i < endId; ++i)
+    {
+      vtkIdType queryId = order[i];
+      vtkIdType cellId = -1;
+      if (bins[queryId] >= 0)
+      {
+        queryPoints->GetPoint(queryId, x);
+        cellId = processor->FindCell(x, cell, subId, pc, weights.data());
+      }
+      if (cellId < 0)
+      {
+        pc[0] = pc[1] = pc[2] = 0.0;
+      }
+      cellIds->SetValue(queryId, cellId);
+      pcoords->SetTuple(queryId, pc);
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkStaticCellLocator::FindClosestPointWithinRadius(double x[3], double radius,
   double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
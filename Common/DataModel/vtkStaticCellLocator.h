@@ -57,6 +57,9 @@
 struct vtkCellBinner;
 struct vtkCellProcessor;
 
+class vtkDoubleArray;
+class vtkIdTypeArray;
+
 class VTKCOMMONDATAMODEL_EXPORT vtkStaticCellLocator : public vtkAbstractCellLocator
 {
   friend struct vtkCellBinner;
@@ -241,6 +244,18 @@ public:
   vtkIdType FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* GenCell, int& subId,
     double pcoords[3], double* weights) override;
 
+  /**
+   * Find the cells containing a batch of query points in one internally
+   * threaded sweep. On output, cellIds holds for each query point the id of
+   * the cell containing it (or -1 if no cell was found), and pcoords the
+   * corresponding parametric coordinates as 3-tuples ((0,0,0) on a miss).
+   * Both output arrays are resized to the number of query points. The
+   * queries are processed in bin-sorted order, which gives much better cache
+   * behavior than repeated single-point FindCell() invocations, and each
+   * thread manages its own intermediate cell storage.
+   */
+  void FindCells(vtkPoints* queryPoints, vtkIdTypeArray* cellIds, vtkDoubleArray* pcoords);
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * This function should be used ONLY after the locator is built.
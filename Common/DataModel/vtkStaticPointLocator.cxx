@@ -30,6 +30,8 @@
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 
 vtkStandardNewMacro(vtkStaticPointLocator);
@@ -38,6 +40,9 @@ vtkStandardNewMacro(vtkStaticPointLocator);
 // value. Too small and heap allocation kicks in.
 #define VTK_INITIAL_BUCKET_SIZE 10000
 
+// Block size for the batched candidate distance tests in the radius query.
+#define VTK_DIST_BLOCK_SIZE 128
+
 //------------------------------------------------------------------------------
 // The following code supports threaded point locator construction. The locator
 // is assumed to be constructed once (i.e., it does not allow incremental point
@@ -112,6 +117,7 @@ struct vtkBucketList
   // Virtuals for templated subclasses
   virtual ~vtkBucketList() = default;
   virtual void BuildLocator() = 0;
+  virtual bool Append(vtkIdType numTotalPts) = 0;
 
   // place points in appropriate buckets
   void GetBucketNeighbors(
@@ -491,6 +497,36 @@ struct BucketList : public vtkBucketList
     double radius, const double x[3], double inputDataLength, double& dist2);
   void FindClosestNPoints(int N, const double x[3], vtkIdList* result);
   void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result);
+
+  // Batched candidate test for the radius query: computes the squared
+  // distances for a block of bucket points in a tight, call-free loop that
+  // the compiler can unroll and vectorize, then inserts the ids that pass.
+  // Only used for explicit float/double point representations.
+  template <typename TPts>
+  void CollectPointsInBucket(const TPts* pts, const LocatorTuple<TIds>* ids, vtkIdType numIds,
+    const double x[3], double R2, vtkIdList* result)
+  {
+    double dist2[VTK_DIST_BLOCK_SIZE];
+    for (vtkIdType first = 0; first < numIds; first += VTK_DIST_BLOCK_SIZE)
+    {
+      vtkIdType num = std::min(numIds - first, static_cast<vtkIdType>(VTK_DIST_BLOCK_SIZE));
+      for (vtkIdType ii = 0; ii < num; ii++)
+      {
+        const TPts* p = pts + 3 * static_cast<vtkIdType>(ids[first + ii].PtId);
+        double dx = x[0] - static_cast<double>(p[0]);
+        double dy = x[1] - static_cast<double>(p[1]);
+        double dz = x[2] - static_cast<double>(p[2]);
+        dist2[ii] = dx * dx + dy * dy + dz * dz;
+      }
+      for (vtkIdType ii = 0; ii < num; ii++)
+      {
+        if (dist2[ii] <= R2)
+        {
+          result->InsertNextId(static_cast<vtkIdType>(ids[first + ii].PtId));
+        }
+      }
+    }
+  }
   int IntersectWithLine(double a0[3], double a1[3], double tol, double& t, double lineX[3],
     double ptX[3], vtkIdType& ptId);
   void MergePoints(double tol, vtkIdType* pointMap, int orderingMode);
@@ -1036,6 +1072,67 @@ struct BucketList : public vtkBucketList
     MapOffsets<TIds> offMapper(this);
     vtkSMPTools::For(0, numBatches, offMapper);
   }
+
+  // Incrementally add the points appended to the end of the dataset (i.e.,
+  // point ids in the range [NumPts,numTotalPts)) to the existing search
+  // structure. Only the new points are binned and sorted; the sorted runs
+  // are then merged and the bucket offsets rebuilt, both of which are O(N)
+  // memory-bound passes. This is much cheaper than a full rebuild when a
+  // small fraction of points is appended. Return false (leaving the
+  // current structure intact) if any new point falls outside the bounds
+  // the binning was computed with - such points would be clamped into
+  // boundary buckets and corrupt subsequent queries.
+  bool Append(vtkIdType numTotalPts) override
+  {
+    vtkIdType numNewPts = numTotalPts - this->NumPts;
+    if (numNewPts <= 0)
+    {
+      return true;
+    }
+
+    // Bin the new points, checking that they remain within the binning
+    // bounds. The generic GetPoint() path is used since the number of new
+    // points is expected to be small.
+    std::vector<LocatorTuple<TIds>> newTuples(numNewPts);
+    std::atomic<bool> inBounds(true);
+    vtkSMPTools::For(0, numNewPts, [this, numNewPts, &newTuples, &inBounds](
+                                     vtkIdType id, vtkIdType endId) {
+      double p[3];
+      for (; id < endId; ++id)
+      {
+        vtkIdType ptId = this->NumPts + id;
+        this->DataSet->GetPoint(ptId, p);
+        if (p[0] < this->Bounds[0] || p[0] > this->Bounds[1] || p[1] < this->Bounds[2] ||
+          p[1] > this->Bounds[3] || p[2] < this->Bounds[4] || p[2] > this->Bounds[5])
+        {
+          inBounds = false;
+          return;
+        }
+        newTuples[id].Bucket = static_cast<TIds>(this->GetBucketIndex(p));
+        newTuples[id].PtId = static_cast<TIds>(ptId);
+      }
+    });
+    if (!inBounds)
+    {
+      return false;
+    }
+    vtkSMPTools::Sort(newTuples.begin(), newTuples.end());
+
+    // Merge the two sorted runs into an enlarged map.
+    LocatorTuple<TIds>* newMap = new LocatorTuple<TIds>[numTotalPts + 1];
+    std::merge(this->Map, this->Map + this->NumPts, newTuples.begin(), newTuples.end(), newMap);
+    delete[] this->Map;
+    this->Map = newMap;
+    this->NumPts = numTotalPts;
+    this->Map[numTotalPts].Bucket = this->NumBuckets;
+    this->Offsets[this->NumBuckets] = static_cast<TIds>(numTotalPts);
+
+    // Finally rebuild the offsets against the merged map.
+    int numBatches = static_cast<int>(ceil(static_cast<double>(this->NumPts) / this->BatchSize));
+    MapOffsets<TIds> offMapper(this);
+    vtkSMPTools::For(0, numBatches, offMapper);
+    return true;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -1433,6 +1530,26 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
   // Clear out previous results
   result->Reset();
 
+  // Hoist the point-access dispatch out of the bucket loops. For explicit
+  // float/double point representations the candidate tests run over raw
+  // coordinates in batches; otherwise fall back to virtual point access.
+  const float* fPts = nullptr;
+  const double* dPts = nullptr;
+  vtkPointSet* ps = vtkPointSet::SafeDownCast(this->DataSet);
+  if (ps)
+  {
+    int dataType = ps->GetPoints()->GetDataType();
+    void* pts = ps->GetPoints()->GetVoidPointer(0);
+    if (dataType == VTK_FLOAT)
+    {
+      fPts = static_cast<float*>(pts);
+    }
+    else if (dataType == VTK_DOUBLE)
+    {
+      dPts = static_cast<double*>(pts);
+    }
+  }
+
   // Add points within footprint and radius
   for (k = ijkMin[2]; k <= ijkMax[2]; ++k)
   {
@@ -1447,17 +1564,28 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
         if ((numIds = this->GetNumberOfIds(cno)) > 0)
         {
           ids = this->GetIds(cno);
-          for (ii = 0; ii < numIds; ii++)
+          if (fPts)
           {
-            ptId = ids[ii].PtId;
-            this->DataSet->GetPoint(ptId, pt);
-            dist2 = vtkMath::Distance2BetweenPoints(x, pt);
-            if (dist2 <= R2)
+            this->CollectPointsInBucket(fPts, ids, numIds, x, R2, result);
+          }
+          else if (dPts)
+          {
+            this->CollectPointsInBucket(dPts, ids, numIds, x, R2, result);
+          }
+          else
+          {
+            for (ii = 0; ii < numIds; ii++)
             {
-              result->InsertNextId(ptId);
-            }
-          } // for all points in bucket
-        }   // if points in bucket
+              ptId = ids[ii].PtId;
+              this->DataSet->GetPoint(ptId, pt);
+              dist2 = vtkMath::Distance2BetweenPoints(x, pt);
+              if (dist2 <= R2)
+              {
+                result->InsertNextId(ptId);
+              }
+            } // for all points in bucket
+          }
+        } // if points in bucket
       }     // i-footprint
     }       // j-footprint
   }         // k-footprint
@@ -1978,6 +2106,40 @@ void vtkStaticPointLocator::ForceBuildLocator()
   this->BuildLocatorInternal();
 }
 
+//------------------------------------------------------------------------------
+// Incrementally take appended points into account. Falls back to a full
+// rebuild whenever the incremental update cannot be performed safely.
+void vtkStaticPointLocator::AppendPoints()
+{
+  vtkIdType numPts;
+  if (!this->DataSet || (numPts = this->DataSet->GetNumberOfPoints()) < 1)
+  {
+    vtkErrorMacro(<< "No points to locate");
+    return;
+  }
+
+  // A full build is required when no search structure exists, when points
+  // have been removed, or when appending would overflow the 32-bit internal
+  // ids the locator may have been built with.
+  if (!this->Buckets || numPts < this->Buckets->NumPts ||
+    (!this->LargeIds && (numPts >= VTK_INT_MAX || this->NumberOfBuckets >= VTK_INT_MAX)))
+  {
+    this->BuildLocatorInternal();
+    return;
+  }
+
+  // Merge the appended range into the existing bucket structure. If any new
+  // point lies outside the bounds the binning was computed with, the
+  // structure is unchanged and a full rebuild is performed instead.
+  if (!this->Buckets->Append(numPts))
+  {
+    this->BuildLocatorInternal();
+    return;
+  }
+
+  this->BuildTime.Modified();
+}
+
 //------------------------------------------------------------------------------
 //  Method to form subdivision of space based on the points provided and
 //  subject to the constraints of levels and NumberOfPointsPerBucket.
@@ -25,8 +25,10 @@
  *
  * vtkStaticPointLocator is an accelerated version of vtkPointLocator. It is
  * threaded (via vtkSMPTools), and supports one-time static construction
- * (i.e., incremental point insertion is not supported). If you need to
- * incrementally insert points, use the vtkPointLocator or its kin to do so.
+ * (i.e., incremental point insertion is not supported). The one exception
+ * is AppendPoints(), which efficiently updates the locator after points
+ * have been appended to the end of the dataset. If you need general
+ * incremental insertion, use the vtkPointLocator or its kin to do so.
  *
  * @warning
  * This class is templated. It may run slower than serial execution if the code
@@ -198,6 +200,20 @@ public:
   void BuildLocator(const double* inBounds);
   ///@}
 
+  /**
+   * Incrementally update the locator to take into account points appended
+   * to the end of the dataset since the locator was last built. Only the
+   * new point range is binned and merged into the existing bucket
+   * structure, which is much faster than a full rebuild when a small
+   * fraction of points is appended (e.g., streaming acquisition). The
+   * caller must guarantee that pre-existing points have not been modified
+   * or removed. A full rebuild is performed automatically when no search
+   * structure exists yet, when appended points fall outside the bounds the
+   * locator was built with, or when internal id sizes would overflow. Like
+   * BuildLocator(), this method is not thread safe.
+   */
+  void AppendPoints();
+
   /**
    * Populate a polydata with the faces of the bins that potentially contain cells.
    * Note that the level parameter has no effect on this method as there is no
@@ -71,6 +71,14 @@ protected:
   void FetchPoints() override;
   void FetchFaces() override;
 
+  /**
+   * Issue software prefetches for the storage behind the current cell --
+   * its type, and the coordinates of its points -- so the cache lines are
+   * in flight while the caller screens the cell. Called whenever the
+   * iterator advances. A no-op when the grid does not use linear storage.
+   */
+  void PrefetchCurrentCell();
+
   friend class vtkUnstructuredGrid;
   void SetUnstructuredGrid(vtkUnstructuredGrid* ug);
 
@@ -80,6 +88,20 @@ protected:
   vtkSmartPointer<vtkIdTypeArray> FaceLocs;
   vtkSmartPointer<vtkPoints> Coords;
 
+  ///@{
+  /**
+   * Raw storage pointers used by PrefetchCurrentCell(). These are only
+   * non-null when the grid's connectivity, offsets, and point coordinates
+   * all use standard (contiguous) memory layout.
+   */
+  const unsigned char* CellTypesPtr = nullptr;
+  const unsigned char* ConnectivityPtr = nullptr;
+  const unsigned char* OffsetsPtr = nullptr;
+  const unsigned char* CoordsPtr = nullptr;
+  int StorageValueSize = 0;
+  int CoordTupleSize = 0;
+  ///@}
+
 private:
   vtkUnstructuredGridCellIterator(const vtkUnstructuredGridCellIterator&) = delete;
   void operator=(const vtkUnstructuredGridCellIterator&) = delete;
@@ -0,0 +1,82 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestExecutionProfiler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkElevationFilter.h"
+#include "vtkExecutionProfiler.h"
+#include "vtkNew.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+int TestExecutionProfiler(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+
+  // Nothing is collected while the profiler is disabled.
+  elevation->Update();
+  if (vtkExecutionProfiler::GetNumberOfSpans() != 0)
+  {
+    std::cerr << "Spans were collected while the profiler was disabled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An update with the profiler enabled records spans for both algorithms.
+  vtkExecutionProfiler::SetEnabled(true);
+  sphere->Modified();
+  elevation->Update();
+  vtkExecutionProfiler::SetEnabled(false);
+
+  vtkIdType numSpans = vtkExecutionProfiler::GetNumberOfSpans();
+  if (numSpans < 2)
+  {
+    std::cerr << "Expected at least 2 spans, got " << numSpans << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::string fileName = "TestExecutionProfilerTrace.json";
+  if (!vtkExecutionProfiler::WriteTrace(fileName.c_str()))
+  {
+    std::cerr << "WriteTrace failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The trace must mention both algorithms and the data request.
+  std::ifstream file(fileName);
+  std::stringstream trace;
+  trace << file.rdbuf();
+  for (const char* expected :
+    { "\"traceEvents\"", "vtkSphereSource", "vtkElevationFilter", "REQUEST_DATA" })
+  {
+    if (trace.str().find(expected) == std::string::npos)
+    {
+      std::cerr << "Trace is missing '" << expected << "'." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkExecutionProfiler::Clear();
+  if (vtkExecutionProfiler::GetNumberOfSpans() != 0)
+  {
+    std::cerr << "Clear did not discard the collected spans." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
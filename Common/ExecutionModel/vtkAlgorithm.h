@@ -34,6 +34,7 @@
 
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkWrappingHints.h" // For VTK_UNBLOCKTHREADS
 
 class vtkAbstractArray;
 class vtkAlgorithmInternals;
@@ -530,8 +531,8 @@ public:
   /**
    * Bring this algorithm's outputs up-to-date.
    */
-  virtual void Update(int port);
-  virtual void Update();
+  VTK_UNBLOCKTHREADS virtual void Update(int port);
+  VTK_UNBLOCKTHREADS virtual void Update();
   ///@}
 
   /**
@@ -556,14 +557,14 @@ public:
    * Available requests include UPDATE_PIECE_NUMBER(), UPDATE_NUMBER_OF_PIECES()
    * UPDATE_EXTENT() etc etc.
    */
-  virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
+  VTK_UNBLOCKTHREADS virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
 
   /**
    * Convenience method to update an algorithm after passing requests
    * to its first output port. See documentation for
    * Update(int port, vtkInformationVector* requests) for details.
    */
-  virtual vtkTypeBool Update(vtkInformation* requests);
+  VTK_UNBLOCKTHREADS virtual vtkTypeBool Update(vtkInformation* requests);
 
   /**
    * Convenience method to update an algorithm after passing requests
@@ -571,7 +572,7 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports piece and extent (optional) requests.
    */
-  virtual int UpdatePiece(
+  VTK_UNBLOCKTHREADS virtual int UpdatePiece(
     int piece, int numPieces, int ghostLevels, const int extents[6] = nullptr);
 
   /**
@@ -579,7 +580,7 @@ public:
    * to its first output port.
    * Supports extent request.
    */
-  virtual int UpdateExtent(const int extents[6]);
+  VTK_UNBLOCKTHREADS virtual int UpdateExtent(const int extents[6]);
 
   /**
    * Convenience method to update an algorithm after passing requests
@@ -587,7 +588,7 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports time, piece (optional) and extent (optional) requests.
    */
-  virtual int UpdateTimeStep(double time, int piece = -1, int numPieces = 1, int ghostLevels = 0,
+  VTK_UNBLOCKTHREADS virtual int UpdateTimeStep(double time, int piece = -1, int numPieces = 1, int ghostLevels = 0,
     const int extents[6] = nullptr);
 
   /**
@@ -608,7 +609,7 @@ public:
   /**
    * Bring this algorithm's outputs up-to-date.
    */
-  virtual void UpdateWholeExtent();
+  VTK_UNBLOCKTHREADS virtual void UpdateWholeExtent();
 
   /**
    * Convenience routine to convert from a linear ordering of input
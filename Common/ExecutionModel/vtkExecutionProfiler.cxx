@@ -0,0 +1,216 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionProfiler.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkExecutionProfiler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkInformation.h"
+#include "vtkInformationIterator.h"
+#include "vtkInformationKey.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkTimerLog.h"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+vtkStandardNewMacro(vtkExecutionProfiler);
+
+namespace
+{
+
+struct vtkProfilerSpan
+{
+  std::string Name;
+  double Start; // seconds
+  double End;   // seconds
+};
+
+// Spans are appended to one of these per thread, so recording a span does
+// not take any lock. The registry below only hands a buffer out to each
+// thread the first time the thread records a span.
+struct vtkProfilerThreadBuffer
+{
+  std::vector<vtkProfilerSpan> Spans;
+  std::vector<std::pair<std::string, double>> OpenSpans;
+  size_t ThreadId = 0;
+};
+
+std::atomic<bool> vtkProfilerEnabled(false);
+
+// Guards the registry only, not the buffers it points to; buffers are kept
+// for the lifetime of the process since threads hold raw pointers to them.
+std::mutex vtkProfilerRegistryMutex;
+std::vector<vtkProfilerThreadBuffer*>& vtkProfilerBuffers()
+{
+  static std::vector<vtkProfilerThreadBuffer*> buffers;
+  return buffers;
+}
+
+vtkProfilerThreadBuffer& vtkProfilerLocalBuffer()
+{
+  static thread_local vtkProfilerThreadBuffer* buffer = nullptr;
+  if (!buffer)
+  {
+    buffer = new vtkProfilerThreadBuffer;
+    std::lock_guard<std::mutex> lock(vtkProfilerRegistryMutex);
+    buffer->ThreadId = vtkProfilerBuffers().size() + 1;
+    vtkProfilerBuffers().push_back(buffer);
+  }
+  return *buffer;
+}
+
+// The request information object is marked with a single REQUEST_* key
+// (REQUEST_DATA, REQUEST_INFORMATION, ...); find its name.
+const char* vtkProfilerRequestName(vtkInformation* request)
+{
+  vtkNew<vtkInformationIterator> iter;
+  iter->SetInformationWeak(request);
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    const char* name = iter->GetCurrentKey()->GetName();
+    if (name && strncmp(name, "REQUEST", 7) == 0)
+    {
+      return name;
+    }
+  }
+  return "REQUEST";
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::SetEnabled(bool enable)
+{
+  vtkProfilerEnabled.store(enable, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionProfiler::GetEnabled()
+{
+  return vtkProfilerEnabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::BeginSpan(vtkAlgorithm* algorithm, vtkInformation* request)
+{
+  if (!vtkExecutionProfiler::GetEnabled())
+  {
+    return;
+  }
+
+  std::string name = algorithm ? algorithm->GetClassName() : "unknown";
+  if (request)
+  {
+    name += "::";
+    name += vtkProfilerRequestName(request);
+  }
+
+  vtkProfilerThreadBuffer& buffer = vtkProfilerLocalBuffer();
+  buffer.OpenSpans.emplace_back(std::move(name), vtkTimerLog::GetUniversalTime());
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::EndSpan()
+{
+  if (!vtkExecutionProfiler::GetEnabled())
+  {
+    return;
+  }
+
+  vtkProfilerThreadBuffer& buffer = vtkProfilerLocalBuffer();
+  if (buffer.OpenSpans.empty())
+  {
+    return;
+  }
+
+  vtkProfilerSpan span;
+  span.Name = std::move(buffer.OpenSpans.back().first);
+  span.Start = buffer.OpenSpans.back().second;
+  span.End = vtkTimerLog::GetUniversalTime();
+  buffer.OpenSpans.pop_back();
+  buffer.Spans.push_back(std::move(span));
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkExecutionProfiler::GetNumberOfSpans()
+{
+  std::lock_guard<std::mutex> lock(vtkProfilerRegistryMutex);
+  vtkIdType count = 0;
+  for (vtkProfilerThreadBuffer* buffer : vtkProfilerBuffers())
+  {
+    count += static_cast<vtkIdType>(buffer->Spans.size());
+  }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionProfiler::WriteTrace(const char* fileName)
+{
+  if (!fileName)
+  {
+    return false;
+  }
+
+  std::ofstream file(fileName);
+  if (!file)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(vtkProfilerRegistryMutex);
+  file << "{\"traceEvents\":[";
+  bool first = true;
+  for (vtkProfilerThreadBuffer* buffer : vtkProfilerBuffers())
+  {
+    for (const vtkProfilerSpan& span : buffer->Spans)
+    {
+      if (!first)
+      {
+        file << ",";
+      }
+      first = false;
+      // complete ("X") events with microsecond timestamps
+      file << "\n{\"name\":\"" << span.Name << "\",\"cat\":\"vtk\",\"ph\":\"X\""
+           << ",\"pid\":1,\"tid\":" << buffer->ThreadId << ",\"ts\":" << span.Start * 1.0e6
+           << ",\"dur\":" << (span.End - span.Start) * 1.0e6 << "}";
+    }
+  }
+  file << "\n]}\n";
+  return file.good();
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::Clear()
+{
+  std::lock_guard<std::mutex> lock(vtkProfilerRegistryMutex);
+  for (vtkProfilerThreadBuffer* buffer : vtkProfilerBuffers())
+  {
+    buffer->Spans.clear();
+    buffer->OpenSpans.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << (vtkExecutionProfiler::GetEnabled() ? "On" : "Off") << "\n";
+  os << indent << "NumberOfSpans: " << vtkExecutionProfiler::GetNumberOfSpans() << "\n";
+}
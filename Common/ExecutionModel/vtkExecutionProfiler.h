@@ -0,0 +1,112 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkExecutionProfiler.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkExecutionProfiler
+ * @brief   per-thread timing of pipeline algorithm execution
+ *
+ * vtkExecutionProfiler records a timing span for every request a
+ * vtkExecutive forwards to its algorithm (REQUEST_INFORMATION,
+ * REQUEST_DATA, ...). Spans are appended to per-thread buffers without
+ * locking, so pipelines executing concurrently in several threads can be
+ * profiled without serializing on a global event list the way vtkTimerLog
+ * does. The collected spans can be written in the Chrome trace event
+ * format, which chrome://tracing, Perfetto and similar viewers read.
+ *
+ * Profiling is disabled by default; while disabled, the cost added to each
+ * request is a single flag test. All methods are static so the profiler
+ * can be enabled around a slow pipeline update without threading any
+ * object through the pipeline:
+ *
+ * @code
+ * vtkExecutionProfiler::SetEnabled(true);
+ * filter->Update();
+ * vtkExecutionProfiler::SetEnabled(false);
+ * vtkExecutionProfiler::WriteTrace("pipeline-trace.json");
+ * @endcode
+ *
+ * @warning
+ * WriteTrace() and Clear() read all per-thread buffers and should only be
+ * called while no pipeline is executing.
+ *
+ * @sa
+ * vtkTimerLog vtkExecutive
+ */
+
+#ifndef vtkExecutionProfiler_h
+#define vtkExecutionProfiler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+class vtkAlgorithm;
+class vtkInformation;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutionProfiler : public vtkObject
+{
+public:
+  static vtkExecutionProfiler* New();
+  vtkTypeMacro(vtkExecutionProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Enable or disable span collection. Disabled by default.
+   */
+  static void SetEnabled(bool enable);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Record the start of a span for the given algorithm and request on the
+   * calling thread. Does nothing when the profiler is disabled. Called by
+   * vtkExecutive::CallAlgorithm; may also be called directly to time other
+   * work, in which case each BeginSpan must be matched by an EndSpan on the
+   * same thread.
+   */
+  static void BeginSpan(vtkAlgorithm* algorithm, vtkInformation* request);
+
+  /**
+   * Record the end of the innermost open span on the calling thread. Does
+   * nothing if no span is open, e.g. when the profiler was enabled in the
+   * middle of a request.
+   */
+  static void EndSpan();
+
+  /**
+   * Return the number of completed spans collected so far on all threads.
+   */
+  static vtkIdType GetNumberOfSpans();
+
+  /**
+   * Write all collected spans to a file in the Chrome trace event format.
+   * Returns true on success.
+   */
+  static bool WriteTrace(const char* fileName);
+
+  /**
+   * Discard all collected spans.
+   */
+  static void Clear();
+
+protected:
+  vtkExecutionProfiler() = default;
+  ~vtkExecutionProfiler() override = default;
+
+private:
+  vtkExecutionProfiler(const vtkExecutionProfiler&) = delete;
+  void operator=(const vtkExecutionProfiler&) = delete;
+};
+
+#endif
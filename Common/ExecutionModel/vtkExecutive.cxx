@@ -17,6 +17,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
+#include "vtkExecutionProfiler.h"
 #include "vtkGarbageCollector.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -729,10 +730,20 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
   // Copy default information in the direction of information flow.
   this->CopyDefaultInformation(request, direction, inInfo, outInfo);
 
-  // Invoke the request on the algorithm.
+  // Invoke the request on the algorithm, recording a profiling span when
+  // span collection is enabled.
+  bool profile = vtkExecutionProfiler::GetEnabled();
+  if (profile)
+  {
+    vtkExecutionProfiler::BeginSpan(this->Algorithm, request);
+  }
   this->InAlgorithm = 1;
   int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
   this->InAlgorithm = 0;
+  if (profile)
+  {
+    vtkExecutionProfiler::EndSpan();
+  }
 
   // If the algorithm failed report it now.
   if (!result)
@@ -0,0 +1,115 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestMatrix4x4.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkMathUtilities.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+
+namespace
+{
+//------------------------------------------------------------------------------
+template <class ArrayT>
+bool CheckMultiplyPoints(vtkMatrix4x4* matrix, ArrayT* points, double tolerance)
+{
+  vtkNew<vtkDoubleArray> transformed;
+  matrix->MultiplyPoints(points, transformed);
+  if (transformed->GetNumberOfComponents() != 3 ||
+    transformed->GetNumberOfTuples() != points->GetNumberOfTuples())
+  {
+    vtkGenericWarningMacro("MultiplyPoints output has the wrong shape.");
+    return false;
+  }
+
+  for (vtkIdType i = 0; i < points->GetNumberOfTuples(); ++i)
+  {
+    double in[4] = { points->GetComponent(i, 0), points->GetComponent(i, 1),
+      points->GetComponent(i, 2), 1.0 };
+    double out[4];
+    matrix->MultiplyPoint(in, out);
+    for (int j = 0; j < 3; ++j)
+    {
+      if (!vtkMathUtilities::FuzzyCompare(
+            transformed->GetComponent(i, j), out[j] / out[3], tolerance))
+      {
+        vtkGenericWarningMacro("MultiplyPoints disagrees with MultiplyPoint for tuple "
+          << i << " component " << j << ": " << transformed->GetComponent(i, j) << " vs "
+          << out[j] / out[3]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestMatrix4x4(int, char*[])
+{
+  // A matrix with rotation, translation and a perspective row so that the
+  // homogeneous divide in MultiplyPoints is exercised.
+  vtkNew<vtkMatrix4x4> matrix;
+  matrix->SetElement(0, 0, 0.0);
+  matrix->SetElement(0, 1, -1.0);
+  matrix->SetElement(1, 0, 1.0);
+  matrix->SetElement(1, 1, 0.0);
+  matrix->SetElement(0, 3, 2.5);
+  matrix->SetElement(1, 3, -1.0);
+  matrix->SetElement(2, 3, 4.0);
+  matrix->SetElement(3, 2, 0.125);
+
+  vtkNew<vtkDoubleArray> doublePoints;
+  doublePoints->SetNumberOfComponents(3);
+  vtkNew<vtkFloatArray> floatPoints;
+  floatPoints->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> intPoints;
+  intPoints->SetNumberOfComponents(3);
+  for (int i = 0; i < 100; ++i)
+  {
+    double p[3] = { 0.1 * i, 20.0 - 0.3 * i, 1.0 + i % 7 };
+    doublePoints->InsertNextTuple(p);
+    floatPoints->InsertNextTuple(p);
+    intPoints->InsertNextTuple3(i, -i, i % 7);
+  }
+
+  if (!CheckMultiplyPoints(matrix, doublePoints.GetPointer(), 1e-10) ||
+    !CheckMultiplyPoints(matrix, floatPoints.GetPointer(), 1e-5) ||
+    !CheckMultiplyPoints(matrix, intPoints.GetPointer(), 1e-10))
+  {
+    return 1;
+  }
+
+  // In-place transformation must give the same result.
+  vtkNew<vtkDoubleArray> inPlace;
+  inPlace->DeepCopy(doublePoints);
+  matrix->MultiplyPoints(inPlace, inPlace);
+  vtkNew<vtkDoubleArray> expected;
+  matrix->MultiplyPoints(doublePoints, expected);
+  for (vtkIdType i = 0; i < expected->GetNumberOfTuples(); ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      if (!vtkMathUtilities::FuzzyCompare(
+            inPlace->GetComponent(i, j), expected->GetComponent(i, j), 1e-10))
+      {
+        vtkGenericWarningMacro("In-place MultiplyPoints gave a different result.");
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -13,8 +13,12 @@
 
 =========================================================================*/
 #include "vtkMatrix4x4.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <cmath>
 #include <cstdlib>
@@ -56,6 +60,41 @@ void vtkMatrix4x4MultiplyPoint(T1 elem[16], T2 in[4], T3 out[4])
   out[3] = v1 * elem[12] + v2 * elem[13] + v3 * elem[14] + v4 * elem[15];
 }
 
+// Worker for MultiplyPoints. Dispatching on the array value types gives the
+// compiler a virtual-call-free inner loop over contiguous tuples, which it
+// can keep in registers and auto-vectorize; vtkSMPTools spreads the tuple
+// range over threads for large point sets.
+struct vtkMatrix4x4MultiplyPointsWorker
+{
+  template <class InArrayT, class OutArrayT>
+  void operator()(InArrayT* input, OutArrayT* output, const double elements[16]) const
+  {
+    const auto inPts = vtk::DataArrayTupleRange<3>(input);
+    auto outPts = vtk::DataArrayTupleRange<3>(output);
+    using OutT = vtk::GetAPIType<OutArrayT>;
+
+    // copy the matrix into locals so it cannot alias the tuple data
+    double elem[16];
+    std::copy(elements, elements + 16, elem);
+
+    vtkSMPTools::For(0, inPts.size(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const auto inPt = inPts[ptId];
+        auto outPt = outPts[ptId];
+        const double v1 = inPt[0];
+        const double v2 = inPt[1];
+        const double v3 = inPt[2];
+        const double w = v1 * elem[12] + v2 * elem[13] + v3 * elem[14] + elem[15];
+        const double f = (w != 0.0) ? (1.0 / w) : 1.0;
+        outPt[0] = static_cast<OutT>((v1 * elem[0] + v2 * elem[1] + v3 * elem[2] + elem[3]) * f);
+        outPt[1] = static_cast<OutT>((v1 * elem[4] + v2 * elem[5] + v3 * elem[6] + elem[7]) * f);
+        outPt[2] = static_cast<OutT>((v1 * elem[8] + v2 * elem[9] + v3 * elem[10] + elem[11]) * f);
+      }
+    });
+  }
+};
+
 } // End anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -73,6 +112,36 @@ void vtkMatrix4x4::MultiplyPoint(const double elements[16], const double in[4],
   vtkMatrix4x4MultiplyPoint(elements, in, result);
 }
 
+//------------------------------------------------------------------------------
+void vtkMatrix4x4::MultiplyPoints(
+  const double elements[16], vtkDataArray* input, vtkDataArray* output)
+{
+  if (!input || !output)
+  {
+    vtkGenericWarningMacro("MultiplyPoints requires both an input and an output array.");
+    return;
+  }
+  if (input->GetNumberOfComponents() != 3)
+  {
+    vtkGenericWarningMacro("MultiplyPoints expects 3-component point tuples.");
+    return;
+  }
+  if (output != input)
+  {
+    output->SetNumberOfComponents(3);
+    output->SetNumberOfTuples(input->GetNumberOfTuples());
+  }
+
+  vtkMatrix4x4MultiplyPointsWorker worker;
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  if (!Dispatcher::Execute(input, output, worker, elements))
+  {
+    // non-real or non-standard arrays go through the generic tuple ranges
+    worker(input, output, elements);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkMatrix4x4::MatrixFromRotation(
   double angle, double x, double y, double z, vtkMatrix4x4* result)
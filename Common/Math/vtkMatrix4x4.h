@@ -32,6 +32,8 @@
 #include "vtkCommonMathModule.h" // For export macro
 #include "vtkObject.h"
 
+class vtkDataArray;
+
 class VTKCOMMONMATH_EXPORT vtkMatrix4x4 : public vtkObject
 {
 public:
@@ -180,6 +182,23 @@ public:
     return this->DoublePoint;
   }
 
+  ///@{
+  /**
+   * Multiply a whole array of 3-component points by this matrix in one
+   * call. Each input tuple is treated as the homogeneous coordinate
+   * (x, y, z, 1) and the result is divided by the output w component.
+   * The output array is resized to match the input. This avoids one
+   * virtual tuple access per point and lets the work be split over
+   * threads, which matters when transforming large point clouds.
+   * The input and output arrays may be the same array.
+   */
+  void MultiplyPoints(vtkDataArray* input, vtkDataArray* output)
+  {
+    vtkMatrix4x4::MultiplyPoints(*this->Element, input, output);
+  }
+  static void MultiplyPoints(const double elements[16], vtkDataArray* input, vtkDataArray* output);
+  ///@}
+
   ///@{
   /**
    * Multiplies matrices a and b and stores the result in c.
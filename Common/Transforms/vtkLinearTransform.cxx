@@ -299,6 +299,14 @@ void vtkLinearTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
   {
     vtkLinearTransformPoints(matrix, static_cast<double*>(inPtr), static_cast<double*>(outPtr), n);
   }
+  else if (m == 0)
+  {
+    // other array types: batch-dispatch on the value types instead of
+    // paying a virtual GetPoint()/SetPoint() pair per point. The bottom
+    // row of a linear transform is (0,0,0,1) so the homogeneous divide
+    // performed by MultiplyPoints is a no-op.
+    vtkMatrix4x4::MultiplyPoints(*matrix, inArray, outArray);
+  }
   else
   {
     double point[3];
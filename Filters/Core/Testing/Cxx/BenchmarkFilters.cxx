@@ -0,0 +1,218 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    BenchmarkFilters.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Timing harness for the filter hot paths. Each benchmark runs the filter
+// several times and reports the best wall-clock time as a CSV record
+//
+//   benchmark,size,threads,seconds
+//
+// so runs can be diffed mechanically between builds. By default the
+// benchmarks run at a small size so the ctest smoke run stays fast; real
+// measurements are taken by invoking the executable directly, e.g.
+//
+//   vtkFiltersBenchmarks BenchmarkFilters -sizes 64,128,256 \
+//     -threads 1,8,16 -repeat 5 -output timings.csv
+
+#include "vtkAlgorithm.h"
+#include "vtkFlyingEdges3D.h"
+#include "vtkGeometryFilter.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointSource.h"
+#include "vtkPolyData.h"
+#include "vtkProbeFilter.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkThreshold.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+  std::vector<int> Sizes{ 32 };
+  std::vector<int> Threads{ 0 }; // 0 keeps the backend default
+  int Repeat = 3;
+  std::string Output;
+};
+
+std::vector<int> ParseIntList(const std::string& arg)
+{
+  std::vector<int> values;
+  std::stringstream stream(arg);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    values.push_back(std::atoi(item.c_str()));
+  }
+  return values;
+}
+
+bool ParseOptions(int argc, char* argv[], BenchmarkOptions& options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "-sizes" && i + 1 < argc)
+    {
+      options.Sizes = ParseIntList(argv[++i]);
+    }
+    else if (arg == "-threads" && i + 1 < argc)
+    {
+      options.Threads = ParseIntList(argv[++i]);
+    }
+    else if (arg == "-repeat" && i + 1 < argc)
+    {
+      options.Repeat = std::atoi(argv[++i]);
+    }
+    else if (arg == "-output" && i + 1 < argc)
+    {
+      options.Output = argv[++i];
+    }
+  }
+  return !options.Sizes.empty() && !options.Threads.empty() && options.Repeat > 0;
+}
+
+// Re-execute the filter repeat times and return the best wall-clock time.
+double TimeFilter(vtkAlgorithm* filter, int repeat)
+{
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < repeat; ++i)
+  {
+    filter->Modified();
+    double start = vtkTimerLog::GetUniversalTime();
+    filter->Update();
+    best = std::min(best, vtkTimerLog::GetUniversalTime() - start);
+  }
+  return best;
+}
+
+void Report(std::ostream& os, const char* benchmark, int size, double seconds)
+{
+  os << benchmark << "," << size << "," << vtkSMPTools::GetEstimatedNumberOfThreads() << ","
+     << seconds << "\n";
+}
+
+void RunBenchmarks(std::ostream& os, int size, int repeat)
+{
+  // parameterized input: wavelet of size^3 points
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(0, size - 1, 0, size - 1, 0, size - 1);
+  wavelet->Update();
+
+  vtkNew<vtkFlyingEdges3D> flyingEdges;
+  flyingEdges->SetInputConnection(wavelet->GetOutputPort());
+  flyingEdges->SetValue(0, 150.0);
+  Report(os, "FlyingEdges3D", size, TimeFilter(flyingEdges, repeat));
+
+  vtkNew<vtkThreshold> threshold;
+  threshold->SetInputConnection(wavelet->GetOutputPort());
+  threshold->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+  threshold->SetLowerThreshold(100.0);
+  threshold->SetUpperThreshold(200.0);
+  Report(os, "Threshold", size, TimeFilter(threshold, repeat));
+
+  vtkNew<vtkGeometryFilter> geometry;
+  geometry->SetInputConnection(threshold->GetOutputPort());
+  Report(os, "GeometryFilter", size, TimeFilter(geometry, repeat));
+
+  // probe the wavelet at half its resolution
+  vtkNew<vtkRTAnalyticSource> probePoints;
+  probePoints->SetWholeExtent(0, size / 2, 0, size / 2, 0, size / 2);
+  vtkNew<vtkProbeFilter> probe;
+  probe->SetInputConnection(probePoints->GetOutputPort());
+  probe->SetSourceConnection(wavelet->GetOutputPort());
+  Report(os, "ProbeFilter", size, TimeFilter(probe, repeat));
+
+  // locator build and closest-point queries on size^3 random points
+  vtkNew<vtkPointSource> points;
+  points->SetNumberOfPoints(static_cast<vtkIdType>(size) * size * size);
+  points->SetRadius(10.0);
+  points->Update();
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(points->GetOutput());
+  double bestBuild = std::numeric_limits<double>::max();
+  for (int i = 0; i < repeat; ++i)
+  {
+    locator->Modified();
+    double start = vtkTimerLog::GetUniversalTime();
+    locator->BuildLocator();
+    bestBuild = std::min(bestBuild, vtkTimerLog::GetUniversalTime() - start);
+  }
+  Report(os, "StaticPointLocatorBuild", size, bestBuild);
+
+  vtkIdType numQueries = points->GetOutput()->GetNumberOfPoints();
+  double start = vtkTimerLog::GetUniversalTime();
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double x[3];
+    points->GetOutput()->GetPoint(i, x);
+    locator->FindClosestPoint(x);
+  }
+  Report(os, "StaticPointLocatorQuery", size, vtkTimerLog::GetUniversalTime() - start);
+}
+
+} // anonymous namespace
+
+int BenchmarkFilters(int argc, char* argv[])
+{
+  BenchmarkOptions options;
+  if (!ParseOptions(argc, argv, options))
+  {
+    std::cerr << "Usage: BenchmarkFilters [-sizes n,n,...] [-threads t,t,...] "
+                 "[-repeat r] [-output file.csv]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::stringstream results;
+  results << "benchmark,size,threads,seconds\n";
+  for (int threads : options.Threads)
+  {
+    if (threads > 0)
+    {
+      vtkSMPTools::Initialize(threads);
+    }
+    for (int size : options.Sizes)
+    {
+      RunBenchmarks(results, size, options.Repeat);
+    }
+  }
+
+  std::cout << results.str();
+  if (!options.Output.empty())
+  {
+    std::ofstream file(options.Output);
+    if (!file)
+    {
+      std::cerr << "Unable to write " << options.Output << std::endl;
+      return EXIT_FAILURE;
+    }
+    file << results.str();
+  }
+
+  return EXIT_SUCCESS;
+}
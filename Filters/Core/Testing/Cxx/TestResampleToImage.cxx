@@ -134,5 +134,44 @@ int TestResampleToImage(int, char*[])
     status = 1;
   }
 
+  // The memory-limited streamed execution must produce the same image as the
+  // one-pass execution. The limit below forces the resampling into several
+  // z-axis slabs.
+  vtkNew<vtkResampleToImage> streamed;
+  streamed->SetUseInputBounds(true);
+  streamed->SetSamplingDimensions(32, 32, 32);
+  streamed->SetMemoryLimit(64); // KiB
+  streamed->SetInputConnection(clip->GetOutputPort());
+  streamed->Update();
+
+  resample->Update();
+  vtkImageData* onePass = resample->GetOutput();
+  vtkImageData* slabbed = streamed->GetOutput();
+  if (slabbed->GetNumberOfPoints() != onePass->GetNumberOfPoints())
+  {
+    std::cout << "Streamed execution: expecting " << onePass->GetNumberOfPoints()
+              << " points, got " << slabbed->GetNumberOfPoints() << std::endl;
+    status = 1;
+  }
+  vtkDataArray* onePassScalars = onePass->GetPointData()->GetArray("RTData");
+  vtkDataArray* slabbedScalars = slabbed->GetPointData()->GetArray("RTData");
+  if (!slabbedScalars || !onePassScalars)
+  {
+    std::cout << "Streamed execution: missing RTData array" << std::endl;
+    status = 1;
+  }
+  else
+  {
+    for (vtkIdType i = 0; i < onePassScalars->GetNumberOfTuples(); ++i)
+    {
+      if (slabbedScalars->GetComponent(i, 0) != onePassScalars->GetComponent(i, 0))
+      {
+        std::cout << "Streamed execution: scalar mismatch at point " << i << std::endl;
+        status = 1;
+        break;
+      }
+    }
+  }
+
   return status;
 }
@@ -17,6 +17,7 @@
 #include "vtkDataSetAttributes.h"
 #include "vtkFloatArray.h"
 #include "vtkImageData.h"
+#include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkRTAnalyticSource.h"
@@ -127,5 +128,48 @@ int TestThreshold(int, char*[])
     return EXIT_FAILURE;
   }
 
+  //---------------------------------------------------
+  // The unstructured grid input takes the threaded two-pass path; its
+  // result must match the serial path taken by the image data input.
+  //---------------------------------------------------
+
+  // Convert the wavelet to an unstructured grid with a keep-everything
+  // threshold.
+  vtkNew<vtkThreshold> converter;
+  converter->SetInputData(ghostedWavelet);
+  converter->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+  converter->SetLowerThreshold(-vtkMath::Inf());
+  converter->SetUpperThreshold(vtkMath::Inf());
+
+  vtkNew<vtkThreshold> ugFilter;
+  ugFilter->SetInputConnection(converter->GetOutputPort());
+
+  for (int function : { vtkThreshold::THRESHOLD_BETWEEN, vtkThreshold::THRESHOLD_LOWER,
+         vtkThreshold::THRESHOLD_UPPER })
+  {
+    for (int allScalars : { 0, 1 })
+    {
+      filter->SetThresholdFunction(function);
+      filter->SetLowerThreshold(L);
+      filter->SetUpperThreshold(U);
+      filter->SetAllScalars(allScalars);
+      filter->Update();
+
+      ugFilter->SetThresholdFunction(function);
+      ugFilter->SetLowerThreshold(L);
+      ugFilter->SetUpperThreshold(U);
+      ugFilter->SetAllScalars(allScalars);
+      ugFilter->Update();
+
+      if (ugFilter->GetOutput()->GetNumberOfCells() != filter->GetOutput()->GetNumberOfCells() ||
+        ugFilter->GetOutput()->GetNumberOfPoints() != filter->GetOutput()->GetNumberOfPoints())
+      {
+        std::cerr << "Threaded unstructured grid path disagrees with serial path for function "
+                  << function << " with AllScalars " << allScalars << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
   return EXIT_SUCCESS;
 }
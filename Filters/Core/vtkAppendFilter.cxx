@@ -14,26 +14,28 @@
 =========================================================================*/
 #include "vtkAppendFilter.h"
 
-#include "vtkBoundingBox.h"
 #include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSetCollection.h"
 #include "vtkExecutive.h"
 #include "vtkIdTypeArray.h"
-#include "vtkIncrementalOctreePointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCleanUnstructuredGrid.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 vtkStandardNewMacro(vtkAppendFilter);
 
@@ -244,33 +246,61 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
   // For optionally merging duplicate points
   vtkIdType* globalIndices = new vtkIdType[totalNumPts];
 
-  vtkSmartPointer<vtkIncrementalOctreePointLocator> ptInserter;
-  if (reallyMergePoints)
+  // When merging by coincidence (no global point ids), stage all input
+  // points into a single array and derive a merge map in parallel with the
+  // staged hashing of vtkStaticPointLocator - the same approach that
+  // vtkStaticCleanPolyData uses. This replaces a serial incremental point
+  // inserter and scales across cores when appending many pieces.
+  bool stagedMerge = reallyMergePoints && !globalIdsArray;
+  if (stagedMerge)
   {
-    vtkBoundingBox outputBB;
+    vtkNew<vtkPoints> stagedPts;
+    stagedPts->SetDataType(newPts->GetDataType());
+    stagedPts->SetNumberOfPoints(totalNumPts);
+    vtkIdType stagedOffset = 0;
     inputs->InitTraversal(iter);
     while ((dataSet = inputs->GetNextDataSet(iter)))
     {
-      // Union of bounding boxes
-      double localBox[6];
-      dataSet->GetBounds(localBox);
-      outputBB.AddBounds(localBox);
-    }
-
-    double outputBounds[6];
-    outputBB.GetBounds(outputBounds);
-
-    ptInserter = vtkSmartPointer<vtkIncrementalOctreePointLocator>::New();
-    if (this->ToleranceIsAbsolute)
-    {
-      ptInserter->SetTolerance(this->Tolerance);
-    }
-    else
-    {
-      ptInserter->SetTolerance(this->Tolerance * outputBB.GetDiagonalLength());
+      vtkIdType dataSetNumPts = dataSet->GetNumberOfPoints();
+      if (vtkPointSet* ps = vtkPointSet::SafeDownCast(dataSet))
+      {
+        stagedPts->InsertPoints(stagedOffset, dataSetNumPts, 0, ps->GetPoints());
+      }
+      else
+      {
+        double x[3];
+        for (vtkIdType ptId = 0; ptId < dataSetNumPts; ++ptId)
+        {
+          dataSet->GetPoint(ptId, x);
+          stagedPts->SetPoint(stagedOffset + ptId, x);
+        }
+      }
+      stagedOffset += dataSetNumPts;
     }
-
-    ptInserter->InitPointInsertion(newPts, outputBounds);
+    this->UpdateProgress(0.125);
+
+    vtkNew<vtkPolyData> stagedMesh;
+    stagedMesh->SetPoints(stagedPts);
+    vtkNew<vtkStaticPointLocator> locator;
+    locator->SetDataSet(stagedMesh);
+    locator->BuildLocator();
+
+    double tol =
+      this->ToleranceIsAbsolute ? this->Tolerance : this->Tolerance * stagedMesh->GetLength();
+    std::vector<vtkIdType> mergeMap(totalNumPts);
+    locator->MergePoints(tol, mergeMap.data());
+    this->UpdateProgress(0.25);
+
+    // Renumber the merged points and copy the representative coordinates
+    // into the output points (threaded).
+    vtkIdType numNewPts =
+      vtkStaticCleanUnstructuredGrid::BuildPointMap(totalNumPts, globalIndices, nullptr, mergeMap);
+    newPts->SetNumberOfPoints(numNewPts);
+    vtkNew<vtkPointData> dummyInPD;
+    vtkNew<vtkPointData> dummyOutPD;
+    vtkStaticCleanUnstructuredGrid::CopyPoints(
+      stagedPts, dummyInPD, newPts, dummyOutPD, globalIndices);
+    this->UpdateProgress(0.375);
   }
 
   // append the blocks / pieces in terms of the geometry and topology
@@ -289,8 +319,9 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
       ? vtkIdTypeArray::SafeDownCast(dataSet->GetPointData()->GetGlobalIds())
       : nullptr;
 
-    // copy points
-    for (vtkIdType ptId = 0; ptId < dataSetNumPts && !abort; ++ptId)
+    // copy points; the staged merge path produced the merged points and the
+    // point map up front
+    for (vtkIdType ptId = 0; !stagedMerge && ptId < dataSetNumPts && !abort; ++ptId)
     {
       if (reallyMergePoints)
       {
@@ -312,10 +343,11 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
         }
         else
         {
-          vtkIdType globalPtId = 0;
-          ptInserter->InsertUniquePoint(dataSet->GetPoint(ptId), globalPtId);
-          globalIndices[ptId + ptOffset] = globalPtId;
-          // The point inserter puts the point into newPts, so we don't have to do that here.
+          // this input does not provide the global ids array; append its
+          // points without merging
+          globalIndices[ptId + ptOffset] = newPts->GetNumberOfPoints();
+          dataSet->GetPoint(ptId, p);
+          newPts->InsertNextPoint(p);
         }
       }
       else
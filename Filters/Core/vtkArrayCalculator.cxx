@@ -31,10 +31,62 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 #include "vtkTable.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <sstream>
+
+//------------------------------------------------------------------------------
+// Holds the per-thread function parsers used by the evaluation functor. They
+// live on the filter rather than on the functor so that an unchanged
+// expression is parsed and compiled once per thread instead of once per
+// thread on every execution; time series reuse the compiled expression at
+// each timestep.
+class vtkArrayCalculator::vtkInternals
+{
+public:
+  vtkSMPThreadLocal<vtkSmartPointer<vtkFunctionParser>> FunctionParsers;
+  vtkSMPThreadLocal<vtkSmartPointer<vtkExprTkFunctionParser>> ExprTkFunctionParsers;
+
+  // Signature of the function and variable layout the cached parsers were
+  // compiled for; when it no longer matches they are rebuilt from scratch.
+  std::string ParserSignature;
+
+  template <typename TFunctionParser>
+  vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>>& GetParsers();
+
+  void InvalidateParsers()
+  {
+    // Drop every thread's parser, including threads that may not participate
+    // in the next execution; none of them may keep a parser compiled for the
+    // previous function.
+    for (auto& parser : this->FunctionParsers)
+    {
+      parser = nullptr;
+    }
+    for (auto& parser : this->ExprTkFunctionParsers)
+    {
+      parser = nullptr;
+    }
+  }
+};
+
+template <>
+vtkSMPThreadLocal<vtkSmartPointer<vtkFunctionParser>>&
+vtkArrayCalculator::vtkInternals::GetParsers<vtkFunctionParser>()
+{
+  return this->FunctionParsers;
+}
+
+template <>
+vtkSMPThreadLocal<vtkSmartPointer<vtkExprTkFunctionParser>>&
+vtkArrayCalculator::vtkInternals::GetParsers<vtkExprTkFunctionParser>()
+{
+  return this->ExprTkFunctionParsers;
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkArrayCalculator);
 
@@ -63,6 +115,7 @@ vtkArrayCalculator::vtkArrayCalculator()
   this->ReplacementValue = 0.0;
   this->IgnoreMissingArrays = false;
   this->ResultArrayType = VTK_DOUBLE;
+  this->Internals = new vtkInternals;
 }
 
 //------------------------------------------------------------------------------
@@ -84,6 +137,9 @@ vtkArrayCalculator::~vtkArrayCalculator()
   this->CoordinateVectorVariableNames.clear();
   this->SelectedCoordinateScalarComponents.clear();
   this->SelectedCoordinateVectorComponents.clear();
+
+  delete this->Internals;
+  this->Internals = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -142,8 +198,10 @@ private:
 
   TResultArray* ResultArray;
 
-  // // thread local
-  vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>> FunctionParser;
+  // // thread local, owned by the filter's vtkInternals so the parsers
+  // survive across executions
+  vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>>& FunctionParser;
+  bool ReuseCompiledFunction;
   vtkSMPThreadLocal<std::vector<double>> Tuple;
   int MaxTupleSize;
 
@@ -163,7 +221,8 @@ public:
     const std::vector<vtkTuple<int, 3>>& selectedCoordinateVectorComponents,
     const std::vector<vtkDataArray*>& scalarArrays, const std::vector<vtkDataArray*>& vectorArrays,
     const std::vector<int>& scalarArrayIndices, const std::vector<int>& vectorArrayIndices,
-    TResultArray* resultArray)
+    vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>>& functionParser,
+    bool reuseCompiledFunction, TResultArray* resultArray)
     : DsInput(dsInput)
     , GraphInput(graphInput)
     , InFD(inFD)
@@ -191,6 +250,8 @@ public:
     , ScalarArrayIndices(scalarArrayIndices)
     , VectorArrayIndices(vectorArrayIndices)
     , ResultArray(resultArray)
+    , FunctionParser(functionParser)
+    , ReuseCompiledFunction(reuseCompiledFunction)
   {
     // find the maximum tuple size
     this->MaxTupleSize = 3;
@@ -216,6 +277,13 @@ public:
     auto tuple = this->Tuple.Local().data();
     int i;
 
+    if (this->ReuseCompiledFunction && functionParser != nullptr)
+    {
+      // This thread already holds a parser compiled for the current function
+      // and variable layout; skip the parse and the variable registration.
+      return;
+    }
+
     functionParser = vtkSmartPointer<TFunctionParser>::New();
     functionParser->SetFunction(this->Function);
     functionParser->SetReplaceInvalidValues(this->ReplaceInvalidValues);
@@ -414,7 +482,8 @@ struct vtkArrayCalculatorWorker
     const std::vector<vtkTuple<int, 3>>& selectedCoordinateVectorComponents,
     const std::vector<vtkDataArray*>& scalarArrays, const std::vector<vtkDataArray*>& vectorArrays,
     const std::vector<int>& scalarArrayIndices, const std::vector<int>& vectorArrayIndices,
-    vtkIdType numTuples)
+    vtkSMPThreadLocal<vtkSmartPointer<TFunctionParser>>& functionParser,
+    bool reuseCompiledFunction, vtkIdType numTuples)
   {
     // Execute functor for all tuples
     vtkArrayCalculatorFunctor<TFunctionParser, TResultArray> arrayCalculatorFunctor(dsInput,
@@ -423,12 +492,53 @@ struct vtkArrayCalculatorWorker
       vectorVariableNames, selectedScalarComponents, selectedVectorComponents,
       coordinateScalarVariableNames, coordinateVectorVariableNames,
       selectedCoordinateScalarComponents, selectedCoordinateVectorComponents, scalarArrays,
-      vectorArrays, scalarArrayIndices, vectorArrayIndices, resultArray);
+      vectorArrays, scalarArrayIndices, vectorArrayIndices, functionParser, reuseCompiledFunction,
+      resultArray);
 
     vtkSMPTools::For(1, numTuples, arrayCalculatorFunctor);
   }
 };
 
+//------------------------------------------------------------------------------
+std::string vtkArrayCalculator::BuildParserSignature(vtkDataSetAttributes* inFD)
+{
+  // Record everything that influences how the functor registers variables
+  // with the parser: the function itself, the variable names and selected
+  // components, and the component counts of the arrays backing them.
+  const char sep = '\x1f';
+  std::ostringstream signature;
+  signature << (this->Function ? this->Function : "") << sep << this->AttributeType << sep
+            << this->ReplaceInvalidValues << sep << this->ReplacementValue << sep
+            << this->IgnoreMissingArrays << sep;
+  for (size_t i = 0; i < this->ScalarArrayNames.size(); i++)
+  {
+    vtkDataArray* array = inFD->GetArray(this->ScalarArrayNames[i].c_str());
+    signature << this->ScalarVariableNames[i] << sep << this->SelectedScalarComponents[i] << sep
+              << (array ? array->GetNumberOfComponents() : -1) << sep;
+  }
+  for (size_t i = 0; i < this->VectorArrayNames.size(); i++)
+  {
+    vtkDataArray* array = inFD->GetArray(this->VectorArrayNames[i].c_str());
+    signature << this->VectorVariableNames[i] << sep << this->SelectedVectorComponents[i][0] << sep
+              << this->SelectedVectorComponents[i][1] << sep
+              << this->SelectedVectorComponents[i][2] << sep
+              << (array ? array->GetNumberOfComponents() : -1) << sep;
+  }
+  for (size_t i = 0; i < this->CoordinateScalarVariableNames.size(); i++)
+  {
+    signature << this->CoordinateScalarVariableNames[i] << sep
+              << this->SelectedCoordinateScalarComponents[i] << sep;
+  }
+  for (size_t i = 0; i < this->CoordinateVectorVariableNames.size(); i++)
+  {
+    signature << this->CoordinateVectorVariableNames[i] << sep
+              << this->SelectedCoordinateVectorComponents[i][0] << sep
+              << this->SelectedCoordinateVectorComponents[i][1] << sep
+              << this->SelectedCoordinateVectorComponents[i][2] << sep;
+  }
+  return signature.str();
+}
+
 //------------------------------------------------------------------------------
 template <typename TFunctionParser>
 int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* output)
@@ -694,6 +804,20 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
     }
   }
 
+  // Reuse the per-thread parsers compiled during a previous execution when
+  // the function and the variable layout are unchanged, e.g. when the same
+  // expression is evaluated for every timestep of a series. Variables were
+  // registered in the same order back then, so the indices resolved above
+  // remain valid for the cached parsers.
+  std::string parserSignature = this->BuildParserSignature(inFD);
+  bool reuseCompiledFunction = (parserSignature == this->Internals->ParserSignature);
+  if (!reuseCompiledFunction)
+  {
+    this->Internals->InvalidateParsers();
+    this->Internals->ParserSignature = parserSignature;
+  }
+  auto& parserPool = this->Internals->GetParsers<TFunctionParser>();
+
   vtkArrayCalculatorWorker<TFunctionParser> arrayCalculatorWorker;
   if (!vtkArrayDispatch::Dispatch::Execute(resultArray.Get(), arrayCalculatorWorker, dsInput,
         graphInput, inFD, attributeType, this->Function, this->ReplaceInvalidValues,
@@ -702,7 +826,8 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
         this->SelectedScalarComponents, this->SelectedVectorComponents,
         this->CoordinateScalarVariableNames, this->CoordinateVectorVariableNames,
         this->SelectedCoordinateScalarComponents, this->SelectedCoordinateVectorComponents,
-        scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, numTuples))
+        scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, parserPool,
+        reuseCompiledFunction, numTuples))
   {
     arrayCalculatorWorker(resultArray.Get(), dsInput, graphInput, inFD, attributeType,
       this->Function, this->ReplaceInvalidValues, this->ReplacementValue, this->IgnoreMissingArrays,
@@ -710,7 +835,8 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject* input, vtkDataObject* o
       this->VectorVariableNames, this->SelectedScalarComponents, this->SelectedVectorComponents,
       this->CoordinateScalarVariableNames, this->CoordinateVectorVariableNames,
       this->SelectedCoordinateScalarComponents, this->SelectedCoordinateVectorComponents,
-      scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, numTuples);
+      scalarArrays, vectorArrays, scalarArrayIndices, vectorArrayIndices, parserPool,
+      reuseCompiledFunction, numTuples);
   }
 
   output->ShallowCopy(input);
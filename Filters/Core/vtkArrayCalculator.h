@@ -79,6 +79,7 @@
 #include <vector>     // needed for vector
 
 class vtkDataSet;
+class vtkDataSetAttributes;
 
 class VTKFILTERSCORE_EXPORT vtkArrayCalculator : public vtkPassInputTypeAlgorithm
 {
@@ -376,6 +377,16 @@ private:
   // Do the bulk of the work
   template <typename TFunctionParser>
   int ProcessDataObject(vtkDataObject* input, vtkDataObject* output);
+
+  /**
+   * Build a signature describing the function and the variable layout it is
+   * compiled against; used to decide whether the per-thread parsers cached
+   * from a previous execution can be reused as-is.
+   */
+  std::string BuildParserSignature(vtkDataSetAttributes* inFD);
+
+  class vtkInternals;
+  vtkInternals* Internals;
 };
 
 #endif
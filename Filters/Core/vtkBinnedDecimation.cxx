@@ -139,6 +139,20 @@ struct BinPoints
   }
 };
 
+// Dispatch the binning of a single appended piece (explicit streaming
+// mode). Only the bin ids are retained; the piece is released after its
+// contribution has been accumulated.
+struct AppendBinWorker
+{
+  template <typename DataT>
+  void operator()(
+    DataT* pts, vtkIdType* binIds, const int* dims, const double* bounds, const double* spacing)
+  {
+    BinPoints<DataT, vtkIdType> binPoints(pts, binIds, dims, bounds, spacing);
+    vtkSMPTools::For(0, pts->GetNumberOfTuples(), binPoints);
+  }
+};
+
 // Generate the output triangles. This functor is common to
 // three of the algorithms #1-3.
 template <typename TIds, typename TPtMap>
@@ -1296,10 +1310,22 @@ vtkBinnedDecimation::vtkBinnedDecimation()
   this->ProducePointData = true;
   this->ProduceCellData = false;
   this->LargeIds = false;
+
+  this->BinSums = nullptr;
+  this->BinCounts = nullptr;
+  this->AppendTris = nullptr;
 }
 
 //----------------------------------------------------------------------------
-vtkBinnedDecimation::~vtkBinnedDecimation() = default;
+vtkBinnedDecimation::~vtkBinnedDecimation()
+{
+  delete[] this->BinSums;
+  delete[] this->BinCounts;
+  if (this->AppendTris)
+  {
+    this->AppendTris->Delete();
+  }
+}
 
 //----------------------------------------------------------------------------
 // Use the same approach as vtkQuadricClustering (which is a bit of a mess but
@@ -1310,10 +1336,6 @@ void vtkBinnedDecimation::ConfigureBinning(vtkPolyData* input, vtkIdType numPts)
   // general vtkPolyData::GetBounds() is much slower.
   double bounds[6];
   input->GetPoints()->GetBounds(bounds);
-  for (vtkIdType i = 0; i < 6; ++i)
-  {
-    this->Bounds[i] = bounds[i];
-  }
 
   // Estimate the number of divisions based on the number of points in the
   // input.  (To minimize chance of overflow, force math in vtkIdType type,
@@ -1341,6 +1363,19 @@ void vtkBinnedDecimation::ConfigureBinning(vtkPolyData* input, vtkIdType numPts)
     this->NumberOfDivisions[2] = this->NumberOfZDivisions;
   }
 
+  this->ConfigureBinning(bounds);
+}
+
+//----------------------------------------------------------------------------
+// Configure the binning over known bounds and divisions. This is shared
+// between the pipeline execution path and the append (streaming) path.
+void vtkBinnedDecimation::ConfigureBinning(const double bounds[6])
+{
+  for (vtkIdType i = 0; i < 6; ++i)
+  {
+    this->Bounds[i] = bounds[i];
+  }
+
   if (this->ComputeNumberOfDivisions)
   {
     // Extend the bounds so that it will not produce fractions of bins.
@@ -1487,6 +1522,225 @@ int vtkBinnedDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//----------------------------------------------------------------------------
+// Begin an explicit, piece-by-piece execution of the filter. Only the
+// per-bin accumulation state is retained between the Append() invocations,
+// keeping the memory footprint independent of the total input size.
+void vtkBinnedDecimation::StartAppend(double* bounds)
+{
+  // Dispose of any previous append session.
+  delete[] this->BinSums;
+  this->BinSums = nullptr;
+  delete[] this->BinCounts;
+  this->BinCounts = nullptr;
+  if (this->AppendTris)
+  {
+    this->AppendTris->Delete();
+    this->AppendTris = nullptr;
+  }
+
+  // The input points are not retained across pieces so they cannot be
+  // reused or selected for output.
+  if (this->PointGenerationMode == vtkBinnedDecimation::INPUT_POINTS ||
+    this->PointGenerationMode == vtkBinnedDecimation::BIN_POINTS)
+  {
+    vtkLog(WARNING,
+      "Input points are not retained in append mode: "
+      "using BIN_AVERAGES to generate output points.");
+    this->PointGenerationMode = vtkBinnedDecimation::BIN_AVERAGES;
+  }
+
+  // Configure the binning over the full model bounds. Since the total
+  // number of input points is unknown, AutoAdjustNumberOfDivisions cannot
+  // be honored here.
+  this->NumberOfDivisions[0] = this->NumberOfXDivisions;
+  this->NumberOfDivisions[1] = this->NumberOfYDivisions;
+  this->NumberOfDivisions[2] = this->NumberOfZDivisions;
+  this->ConfigureBinning(bounds);
+
+  vtkIdType numBins = static_cast<vtkIdType>(this->NumberOfDivisions[0]) *
+    this->NumberOfDivisions[1] * this->NumberOfDivisions[2];
+  this->BinCounts = new vtkIdType[numBins]();
+  if (this->PointGenerationMode == vtkBinnedDecimation::BIN_AVERAGES)
+  {
+    this->BinSums = new double[3 * numBins]();
+  }
+  this->AppendTris = vtkCellArray::New();
+}
+
+//----------------------------------------------------------------------------
+// Accumulate the contribution of one piece into the binning structure.
+void vtkBinnedDecimation::Append(vtkPolyData* piece)
+{
+  if (!this->BinCounts || !this->AppendTris)
+  {
+    vtkLog(ERROR, "Missing binning state: did you call StartAppend()?");
+    return;
+  }
+  vtkIdType numPts;
+  if (!piece || (numPts = piece->GetNumberOfPoints()) < 1)
+  {
+    return;
+  }
+  vtkPoints* pts = piece->GetPoints();
+
+  // Bin the piece's points in parallel.
+  std::vector<vtkIdType> binIds(numPts);
+  using vtkArrayDispatch::Reals;
+  using AppendDispatch = vtkArrayDispatch::DispatchByValueType<Reals>;
+  AppendBinWorker binWorker;
+  if (!AppendDispatch::Execute(pts->GetData(), binWorker, binIds.data(), this->NumberOfDivisions,
+        this->Bounds, this->DivisionSpacing))
+  { // Fallback to slowpath for other point types
+    binWorker(
+      pts->GetData(), binIds.data(), this->NumberOfDivisions, this->Bounds, this->DivisionSpacing);
+  }
+
+  // Accumulate the per-bin state.
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    vtkIdType bin = binIds[ptId];
+    ++this->BinCounts[bin];
+    if (this->BinSums)
+    {
+      pts->GetPoint(ptId, x);
+      double* sums = this->BinSums + 3 * bin;
+      sums[0] += x[0];
+      sums[1] += x[1];
+      sums[2] += x[2];
+    }
+  }
+
+  // Retain the triangles whose three points fall into separate bins. The
+  // connectivity is expressed in bin ids, remapped to compact point ids
+  // in EndAppend().
+  vtkCellArray* tris = piece->GetPolys();
+  if (tris != nullptr && tris->GetNumberOfCells() > 0)
+  {
+    vtkSmartPointer<vtkCellArrayIterator> cellIter;
+    cellIter.TakeReference(tris->NewIterator());
+    vtkIdType npts;
+    const vtkIdType* tri;
+    vtkIdType binTri[3];
+    for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+    {
+      cellIter->GetCurrentCell(npts, tri);
+      if (npts != 3)
+      {
+        continue;
+      }
+      binTri[0] = binIds[tri[0]];
+      binTri[1] = binIds[tri[1]];
+      binTri[2] = binIds[tri[2]];
+      if (binTri[0] != binTri[1] && binTri[0] != binTri[2] && binTri[1] != binTri[2])
+      {
+        this->AppendTris->InsertNextCell(3, binTri);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Produce the decimated output from the accumulated bin state, and release
+// that state.
+void vtkBinnedDecimation::EndAppend()
+{
+  vtkPolyData* output = this->GetOutput();
+  if (!this->BinCounts || !this->AppendTris || !output)
+  {
+    vtkLog(ERROR, "Missing binning state: did you call StartAppend()?");
+    return;
+  }
+
+  vtkIdType numBins = static_cast<vtkIdType>(this->NumberOfDivisions[0]) *
+    this->NumberOfDivisions[1] * this->NumberOfDivisions[2];
+
+  // Only bins referenced by output triangles produce output points. Mark
+  // the referenced bins (-2), then assign them compact output point ids.
+  std::vector<vtkIdType> ptMap(numBins, -1);
+  vtkSmartPointer<vtkCellArrayIterator> cellIter;
+  cellIter.TakeReference(this->AppendTris->NewIterator());
+  vtkIdType npts;
+  const vtkIdType* tri;
+  for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+  {
+    cellIter->GetCurrentCell(npts, tri);
+    ptMap[tri[0]] = ptMap[tri[1]] = ptMap[tri[2]] = (-2);
+  }
+  vtkIdType numNewPts = 0;
+  for (vtkIdType bin = 0; bin < numBins; ++bin)
+  {
+    if (ptMap[bin] == (-2))
+    {
+      ptMap[bin] = numNewPts++;
+    }
+  }
+
+  // Generate the output points, either at bin centers or from the average
+  // position of all points that fell into each bin.
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(VTK_FLOAT);
+  newPts->SetNumberOfPoints(numNewPts);
+  float* outPts = vtkFloatArray::FastDownCast(newPts->GetData())->GetPointer(0);
+  vtkIdType xD = this->NumberOfDivisions[0], xyD = xD * this->NumberOfDivisions[1];
+  for (vtkIdType bin = 0; bin < numBins; ++bin)
+  {
+    if (ptMap[bin] < 0)
+    {
+      continue;
+    }
+    float* xOut = outPts + 3 * ptMap[bin];
+    if (this->PointGenerationMode == vtkBinnedDecimation::BIN_CENTERS)
+    {
+      vtkIdType i = bin % xD;
+      vtkIdType j = (bin / xD) % this->NumberOfDivisions[1];
+      vtkIdType k = bin / xyD;
+      xOut[0] = this->Bounds[0] + ((0.5 + static_cast<double>(i)) * this->DivisionSpacing[0]);
+      xOut[1] = this->Bounds[2] + ((0.5 + static_cast<double>(j)) * this->DivisionSpacing[1]);
+      xOut[2] = this->Bounds[4] + ((0.5 + static_cast<double>(k)) * this->DivisionSpacing[2]);
+    }
+    else // PointGenerationMode == vtkBinnedDecimation::BIN_AVERAGES
+    {
+      const double* sums = this->BinSums + 3 * bin;
+      double count = static_cast<double>(this->BinCounts[bin]);
+      xOut[0] = sums[0] / count;
+      xOut[1] = sums[1] / count;
+      xOut[2] = sums[2] / count;
+    }
+  }
+  output->SetPoints(newPts);
+
+  // Rewrite the accumulated triangle connectivity from bin ids to the
+  // compact output point ids.
+  vtkIdType numOutTris = this->AppendTris->GetNumberOfCells();
+  vtkNew<vtkIdTypeArray> outConn;
+  vtkIdType* outTris = outConn->WritePointer(0, numOutTris * 3);
+  vtkNew<vtkIdTypeArray> outOffsets;
+  vtkIdType* outTriOffsets = outOffsets->WritePointer(0, numOutTris + 1);
+  vtkIdType triId = 0;
+  for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell(), ++triId)
+  {
+    cellIter->GetCurrentCell(npts, tri);
+    outTriOffsets[triId] = 3 * triId;
+    outTris[3 * triId] = ptMap[tri[0]];
+    outTris[3 * triId + 1] = ptMap[tri[1]];
+    outTris[3 * triId + 2] = ptMap[tri[2]];
+  }
+  outTriOffsets[numOutTris] = 3 * numOutTris;
+  vtkNew<vtkCellArray> outTrisArray;
+  outTrisArray->SetData(outOffsets, outConn);
+  output->SetPolys(outTrisArray);
+
+  // Release the accumulation state.
+  delete[] this->BinSums;
+  this->BinSums = nullptr;
+  delete[] this->BinCounts;
+  this->BinCounts = nullptr;
+  this->AppendTris->Delete();
+  this->AppendTris = nullptr;
+}
+
 //----------------------------------------------------------------------------
 void vtkBinnedDecimation::SetNumberOfDivisions(int div0, int div1, int div2)
 {
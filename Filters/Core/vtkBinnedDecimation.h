@@ -92,6 +92,8 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+class vtkCellArray;
+
 class VTKFILTERSCORE_EXPORT vtkBinnedDecimation : public vtkPolyDataAlgorithm
 {
 public:
@@ -213,8 +215,40 @@ public:
   vtkSetMacro(ProduceCellData, bool);
   vtkGetMacro(ProduceCellData, bool);
   vtkBooleanMacro(ProduceCellData, bool);
+  ///@}
 
+  ///@{
+  /**
+   * These methods provide an alternative, out-of-core way of executing the
+   * filter. The input can be added to the binning structure in pieces
+   * (append), with only the per-bin accumulation state held in memory, so
+   * that meshes much larger than physical memory can be decimated. In this
+   * mode, specify the bounds of the entire model as an argument to
+   * StartAppend(), then invoke Append() once per piece (typically produced
+   * by updating the upstream pipeline with a different UPDATE_PIECE_NUMBER /
+   * UPDATE_NUMBER_OF_PIECES), and finally EndAppend() to produce the
+   * decimated result. Since the input points are not retained, only the
+   * BIN_CENTERS and BIN_AVERAGES point generation modes are supported, and
+   * AutoAdjustNumberOfDivisions is ignored (the total number of input points
+   * is not known in advance). Point and cell attribute data is not produced
+   * in this mode.
+   */
+  void StartAppend(double* bounds);
+  void StartAppend(double x0, double x1, double y0, double y1, double z0, double z1)
+  {
+    double b[6];
+    b[0] = x0;
+    b[1] = x1;
+    b[2] = y0;
+    b[3] = y1;
+    b[4] = z0;
+    b[5] = z1;
+    this->StartAppend(b);
+  }
+  void Append(vtkPolyData* piece);
+  void EndAppend();
   ///@}
+
   /**
    * Return a flag indicating whether large ids were used during
    * execution. The value of this flag is only valid after filter
@@ -250,8 +284,14 @@ protected:
   bool ProduceCellData;
   bool LargeIds;
 
-  // Helper function
+  // Supporting state for the append (out-of-core streaming) mode.
+  double* BinSums;          // per-bin coordinate sums (BIN_AVERAGES only)
+  vtkIdType* BinCounts;     // per-bin point counts; >0 marks occupied bins
+  vtkCellArray* AppendTris; // accumulated triangles with bin-id connectivity
+
+  // Helper functions
   void ConfigureBinning(vtkPolyData* input, vtkIdType numPts);
+  void ConfigureBinning(const double bounds[6]);
 
 private:
   vtkBinnedDecimation(const vtkBinnedDecimation&) = delete;
@@ -18,6 +18,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
@@ -27,6 +28,8 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStaticCellLinks.h"
@@ -38,6 +41,7 @@
 #include <algorithm>
 #include <functional>
 #include <set>
+#include <vector>
 
 #define VTK_MAX_CELLS_PER_POINT 4096
 
@@ -111,6 +115,143 @@ void FastUnstructuredData(
   }
 }
 
+//------------------------------------------------------------------------------
+// Count the number of cells incident on each point by streaming the cell
+// connectivity, accumulating into per-thread counters that are merged in a
+// final pass over the points. Avoids building a cell links structure.
+void CountCellsPerPoint(
+  const std::vector<vtkCellArray*>& conns, vtkIdType npoints, std::vector<unsigned int>& counts)
+{
+  vtkSMPThreadLocal<std::vector<unsigned int>> tlCounts;
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  for (vtkCellArray* conn : conns)
+  {
+    vtkIdType numCells = conn ? conn->GetNumberOfCells() : 0;
+    if (numCells < 1)
+    {
+      continue;
+    }
+    vtkSMPTools::For(0, numCells, [&](vtkIdType beginCellId, vtkIdType endCellId) {
+      std::vector<unsigned int>& threadCounts = tlCounts.Local();
+      if (threadCounts.empty())
+      {
+        threadCounts.resize(npoints, 0);
+      }
+      vtkIdList* tempIds = tlCellPts.Local();
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (vtkIdType cid = beginCellId; cid < endCellId; ++cid)
+      {
+        conn->GetCellAtId(cid, npts, pts, tempIds);
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          ++threadCounts[pts[i]];
+        }
+      }
+    });
+  }
+
+  counts.resize(npoints);
+  std::vector<std::vector<unsigned int>*> countBuffers;
+  for (auto it = tlCounts.begin(); it != tlCounts.end(); ++it)
+  {
+    countBuffers.push_back(&*it);
+  }
+  vtkSMPTools::For(0, npoints, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+    for (vtkIdType pid = beginPtId; pid < endPtId; ++pid)
+    {
+      unsigned int numCells = 0;
+      for (std::vector<unsigned int>* buffer : countBuffers)
+      {
+        numCells += (*buffer)[pid];
+      }
+      counts[pid] = numCells;
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Link-free averaging for unstructured data. The cell connectivity is
+// streamed once, with each thread scattering cell values into its own
+// points-sized accumulation buffer; the per-thread buffers are then merged
+// and averaged in a parallel pass over the points. Compared to the links
+// based path this trades one accumulation buffer per thread for not having
+// to build (or store) the links at all, which is a large win on meshes
+// whose links are not already available.
+struct LinkFreeSpread
+{
+  template <typename SrcArrayT, typename DstArrayT>
+  void operator()(SrcArrayT* srcarray, DstArrayT* dstarray, const std::vector<vtkCellArray*>& conns,
+    const unsigned int* counts, vtkIdType npoints) const
+  {
+    using T = vtk::GetAPIType<DstArrayT>;
+    const auto srcTuples = vtk::DataArrayTupleRange(srcarray);
+    auto dstTuples = vtk::DataArrayTupleRange(dstarray);
+    const int ncomps = srcarray->GetNumberOfComponents();
+
+    // Scatter the cell values into per-thread accumulation buffers. For
+    // polydata the cell ids span the verts, lines, polys and strips arrays
+    // in that order, hence the running cell id offset.
+    vtkSMPThreadLocal<std::vector<double>> tlSums;
+    vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+    vtkIdType cellIdOffset = 0;
+    for (vtkCellArray* conn : conns)
+    {
+      vtkIdType numCells = conn ? conn->GetNumberOfCells() : 0;
+      if (numCells > 0)
+      {
+        vtkSMPTools::For(0, numCells, [&, cellIdOffset](vtkIdType beginCellId, vtkIdType endCellId) {
+          std::vector<double>& sums = tlSums.Local();
+          if (sums.empty())
+          {
+            sums.resize(static_cast<size_t>(npoints) * ncomps, 0.0);
+          }
+          vtkIdList* tempIds = tlCellPts.Local();
+          vtkIdType npts;
+          const vtkIdType* pts;
+          for (vtkIdType cid = beginCellId; cid < endCellId; ++cid)
+          {
+            conn->GetCellAtId(cid, npts, pts, tempIds);
+            const auto srcTuple = srcTuples[cellIdOffset + cid];
+            for (vtkIdType i = 0; i < npts; ++i)
+            {
+              double* sum = sums.data() + static_cast<size_t>(pts[i]) * ncomps;
+              for (int c = 0; c < ncomps; ++c)
+              {
+                sum[c] += static_cast<double>(srcTuple[c]);
+              }
+            }
+          }
+        });
+      }
+      cellIdOffset += numCells;
+    }
+
+    // Merge the per-thread buffers and average, in parallel over the points.
+    std::vector<std::vector<double>*> sumBuffers;
+    for (auto it = tlSums.begin(); it != tlSums.end(); ++it)
+    {
+      sumBuffers.push_back(&*it);
+    }
+    vtkSMPTools::For(0, npoints, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+      for (vtkIdType pid = beginPtId; pid < endPtId; ++pid)
+      {
+        auto dstTuple = dstTuples[pid];
+        const unsigned int denom = counts[pid];
+        for (int c = 0; c < ncomps; ++c)
+        {
+          double sum = 0.0;
+          for (std::vector<double>* buffer : sumBuffers)
+          {
+            sum += (*buffer)[static_cast<size_t>(pid) * ncomps + c];
+          }
+          dstTuple[c] = static_cast<T>(denom ? sum / denom : 0.0);
+        }
+      }
+    });
+  }
+};
+
 //------------------------------------------------------------------------------
 // Helper template function that implement the major part of the algorithm
 // which will be expanded by the vtkTemplateMacro. The template function is
@@ -518,19 +659,54 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
   // unstructured datasets. A common workflow requiring maximum performance.
   if (this->ContributingCellOption == vtkCellDataToPointData::All)
   {
+    // When the input already has cell links use them directly; otherwise do
+    // not build them at all, and instead stream the cell connectivity once,
+    // scattering cell values into per-thread accumulation buffers that are
+    // merged by reduction (see LinkFreeSpread above).
+    std::vector<vtkCellArray*> connectivities;
     if (auto uGrid = vtkUnstructuredGrid::SafeDownCast(src))
     {
-      uGrid->BuildLinks();
-      FastUnstructuredData(npoints, uGrid->GetLinks(), processedCellData, opd);
-      return 1;
+      if (uGrid->GetLinks())
+      {
+        FastUnstructuredData(npoints, uGrid->GetLinks(), processedCellData, opd);
+        return 1;
+      }
+      connectivities.push_back(uGrid->GetCells());
     }
-    else // polydata
+    else // polydata; cell ids span the verts, lines, polys and strips arrays
     {
       auto polyData = vtkPolyData::SafeDownCast(src);
-      polyData->BuildLinks();
-      FastUnstructuredData(npoints, polyData->GetLinks(), processedCellData, opd);
-      return 1;
+      if (polyData->GetLinks())
+      {
+        FastUnstructuredData(npoints, polyData->GetLinks(), processedCellData, opd);
+        return 1;
+      }
+      connectivities.push_back(polyData->GetVerts());
+      connectivities.push_back(polyData->GetLines());
+      connectivities.push_back(polyData->GetPolys());
+      connectivities.push_back(polyData->GetStrips());
     }
+
+    std::vector<unsigned int> cellsPerPoint;
+    CountCellsPerPoint(connectivities, npoints, cellsPerPoint);
+
+    auto average = [&](vtkAbstractArray* aa_srcarray, vtkAbstractArray* aa_dstarray) {
+      vtkDataArray* const srcarray = vtkDataArray::FastDownCast(aa_srcarray);
+      vtkDataArray* const dstarray = vtkDataArray::FastDownCast(aa_dstarray);
+      if (srcarray && dstarray)
+      {
+        dstarray->SetNumberOfTuples(npoints);
+        LinkFreeSpread worker;
+        using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+        if (!Dispatcher::Execute(
+              srcarray, dstarray, worker, connectivities, cellsPerPoint.data(), npoints))
+        { // fallback for unknown arrays:
+          worker(srcarray, dstarray, connectivities, cellsPerPoint.data(), npoints);
+        }
+      }
+    };
+    cfl.TransformData(0, processedCellData, opd, average);
+    return 1;
   } // fast path
 
   // If necessary, begin the slow, more general path.
@@ -427,6 +427,7 @@ int vtkContourFilter::RequestData(
         this->ScalarTree = vtkSpanSpace::New();
       }
       this->ScalarTree->SetDataSet(input);
+      this->ScalarTree->SetScalars(inScalars);
       cgrid->SetScalarTree(this->ScalarTree);
     }
     if (this->Locator)
@@ -590,6 +591,7 @@ int vtkContourFilter::RequestData(
         this->ScalarTree = vtkSpanSpace::New();
       }
       this->ScalarTree->SetDataSet(input);
+      this->ScalarTree->SetScalars(inScalars);
 
       vtkCell* cell;
       // Note: This will have problems when input contains 2D and 3D cells.
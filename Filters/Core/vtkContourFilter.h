@@ -140,7 +140,11 @@ public:
   ///@{
   /**
    * Enable the use of a scalar tree to accelerate contour extraction. By
-   * default, an instance of vtkSpanSpace is created when needed.
+   * default, an instance of vtkSpanSpace is created when needed. The tree is
+   * retained across executions and is only rebuilt when the input or the
+   * array to contour changes, so re-executing with different contour values
+   * (e.g., scrubbing an isovalue slider) skips straight to the
+   * value-dependent traversal.
    */
   vtkSetMacro(UseScalarTree, vtkTypeBool);
   vtkGetMacro(UseScalarTree, vtkTypeBool);
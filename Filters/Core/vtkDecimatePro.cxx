@@ -240,6 +240,9 @@ int vtkDecimatePro::RequestData(vtkInformation* vtkNotUsed(request),
     meshPD->DeepCopy(inPD);
     meshPD->CopyAllocate(meshPD, input->GetNumberOfPoints());
 
+    // The mesh links are edited during the decimation, so the mesh must be
+    // editable to get the editable vtkCellLinks out of BuildLinks().
+    this->Mesh->EditableOn();
     this->Mesh->BuildLinks();
   }
   else
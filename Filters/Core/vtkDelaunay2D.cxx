@@ -25,16 +25,58 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 #include "vtkTriangle.h"
 
+#include <numeric>
 #include <set>
 #include <vector>
 
 vtkStandardNewMacro(vtkDelaunay2D);
 vtkCxxSetObjectMacro(vtkDelaunay2D, Transform, vtkAbstractTransform);
 
+namespace
+{
+
+// Determine a spatially coherent order in which to insert points into the
+// triangulation. The points are binned on a uniform grid and emitted bin by
+// bin so that consecutive insertions land near one another, keeping the walk
+// from the previously visited triangle in FindTriangle() short. The binning
+// and the sort run in parallel; the insertion itself remains serial.
+void ComputeInsertionOrder(
+  vtkPoints* points, vtkIdType numPoints, const double bounds[6], std::vector<vtkIdType>& order)
+{
+  // Size the grid so bins hold a modest number of points.
+  int ndivs = static_cast<int>(ceil(sqrt(static_cast<double>(numPoints) / 64.0)));
+  ndivs = (ndivs < 1 ? 1 : ndivs);
+  double fx = (bounds[1] > bounds[0] ? ndivs / (bounds[1] - bounds[0]) : 0.0);
+  double fy = (bounds[3] > bounds[2] ? ndivs / (bounds[3] - bounds[2]) : 0.0);
+
+  std::vector<vtkIdType> binIds(numPoints);
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      int i = static_cast<int>((x[0] - bounds[0]) * fx);
+      int j = static_cast<int>((x[1] - bounds[2]) * fy);
+      i = (i < 0 ? 0 : (i >= ndivs ? ndivs - 1 : i));
+      j = (j < 0 ? 0 : (j >= ndivs ? ndivs - 1 : j));
+      binIds[ptId] = static_cast<vtkIdType>(j) * ndivs + i;
+    }
+  });
+
+  order.resize(numPoints);
+  std::iota(order.begin(), order.end(), 0);
+  vtkSMPTools::Sort(order.begin(), order.end(), [&binIds](vtkIdType a, vtkIdType b) {
+    return binIds[a] < binIds[b] || (binIds[a] == binIds[b] && a < b);
+  });
+}
+
+} // anonymous namespace
+
 // Construct object with Alpha = 0.0; Tolerance = 0.00001; Offset = 1.25;
 // BoundingTriangulation turned off.
 vtkDelaunay2D::vtkDelaunay2D()
@@ -411,7 +453,8 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
     tPoints = nullptr;
   }
 
-  const double* bounds = points->GetBounds();
+  double bounds[6];
+  points->GetBounds(bounds);
   center[0] = (bounds[0] + bounds[1]) / 2.0;
   center[1] = (bounds[2] + bounds[3]) / 2.0;
   center[2] = (bounds[4] + bounds[5]) / 2.0;
@@ -461,15 +504,23 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
 
   this->Mesh->SetPoints(points);
   this->Mesh->SetPolys(triangles);
+  this->Mesh->EditableOn(); // links are edited during triangulation
   this->Mesh->BuildLinks(); // build cell structure
 
+  // Determine a spatially coherent insertion order. Point ids are preserved,
+  // so only the order of insertion changes; successive points land near one
+  // another which keeps the walk from the previous triangle short.
+  std::vector<vtkIdType> insertionOrder;
+  ComputeInsertionOrder(points, numPoints, bounds, insertionOrder);
+
   // For each point; find triangle containing point. Then evaluate three
   // neighboring triangles for Delaunay criterion. Triangles that do not
   // satisfy criterion have their edges swapped. This continues recursively
   // until all triangles have been shown to be Delaunay.
   //
-  for (ptId = 0; ptId < numPoints; ptId++)
+  for (vtkIdType num = 0; num < numPoints; num++)
   {
+    ptId = insertionOrder[num];
     this->GetPoint(ptId, x);
     nei[0] = (-1); // where we are coming from...nowhere initially
 
@@ -564,10 +615,10 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
       tri[0] = 0; // no triangle found
     }
 
-    if (!(ptId % 1000))
+    if (!(num % 1000))
     {
       vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      this->UpdateProgress(static_cast<double>(num) / numPoints);
       if (this->GetAbortExecute())
       {
         break;
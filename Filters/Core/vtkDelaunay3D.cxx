@@ -25,12 +25,64 @@
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <numeric>
+#include <vector>
+
 vtkStandardNewMacro(vtkDelaunay3D);
 
+namespace
+{
+
+// Bin the input points on a uniform grid and produce an insertion order that
+// visits the bins one at a time. Because each insertion starts its search at
+// the closest previously inserted point, consecutive insertions that are
+// spatial neighbors keep the locator queries and the tetra walks short. The
+// binning and the sort are threaded; insertion itself stays serial.
+void DetermineInsertionOrder(vtkPoints* points, std::vector<vtkIdType>& order)
+{
+  vtkIdType numPoints = points->GetNumberOfPoints();
+  double bounds[6];
+  points->GetBounds(bounds);
+
+  // Aim for a modest number of points per bin.
+  int ndivs = static_cast<int>(ceil(pow(static_cast<double>(numPoints) / 64.0, 1.0 / 3.0)));
+  ndivs = (ndivs < 1 ? 1 : ndivs);
+  double f[3];
+  for (int d = 0; d < 3; ++d)
+  {
+    f[d] = (bounds[2 * d + 1] > bounds[2 * d] ? ndivs / (bounds[2 * d + 1] - bounds[2 * d]) : 0.0);
+  }
+
+  std::vector<vtkIdType> binIds(numPoints);
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    int ijk[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      for (int d = 0; d < 3; ++d)
+      {
+        ijk[d] = static_cast<int>((x[d] - bounds[2 * d]) * f[d]);
+        ijk[d] = (ijk[d] < 0 ? 0 : (ijk[d] >= ndivs ? ndivs - 1 : ijk[d]));
+      }
+      binIds[ptId] = (static_cast<vtkIdType>(ijk[2]) * ndivs + ijk[1]) * ndivs + ijk[0];
+    }
+  });
+
+  order.resize(numPoints);
+  std::iota(order.begin(), order.end(), 0);
+  vtkSMPTools::Sort(order.begin(), order.end(), [&binIds](vtkIdType a, vtkIdType b) {
+    return binIds[a] < binIds[b] || (binIds[a] == binIds[b] && a < b);
+  });
+}
+
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Structure used to represent sphere around tetrahedron
 //
@@ -486,20 +538,26 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
 
   Mesh = this->InitPointInsertion(center, this->Offset * tol, numPoints, points);
 
+  // Determine a spatially coherent insertion order. Point ids are preserved;
+  // only the order in which the points are injected changes.
+  std::vector<vtkIdType> insertionOrder;
+  DetermineInsertionOrder(inPoints, insertionOrder);
+
   // Insert each point into triangulation. Points laying "inside"
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
   // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  for (vtkIdType num = 0; num < numPoints; num++)
   {
+    ptId = insertionOrder[num];
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(num % 250))
     {
       vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      this->UpdateProgress(static_cast<double>(num) / numPoints);
       if (this->GetAbortExecute())
       {
         break;
@@ -802,6 +860,17 @@ vtkUnstructuredGrid* vtkDelaunay3D::InitPointInsertion(
   if (this->Locator == nullptr)
   {
     this->CreateDefaultLocator();
+
+    // Scale the bucket resolution with the size of the job. The default 25^3
+    // divisions leave thousands of points per bucket on large point clouds,
+    // so every closest-point query during insertion scans far too many
+    // candidates.
+    if (vtkPointLocator* defaultLocator = vtkPointLocator::SafeDownCast(this->Locator))
+    {
+      int ndivs = static_cast<int>(ceil(pow(static_cast<double>(numPtsToInsert) / 10.0, 1.0 / 3.0)));
+      ndivs = (ndivs < 25 ? 25 : ndivs);
+      defaultLocator->SetDivisions(ndivs, ndivs, ndivs);
+    }
   }
   this->Locator->InitPointInsertion(points, bounds);
 
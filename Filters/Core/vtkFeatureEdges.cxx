@@ -27,11 +27,15 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <map>
+#include <vector>
 
 vtkStandardNewMacro(vtkFeatureEdges);
 
@@ -218,7 +222,33 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
     newPolys = inPolys;
     Mesh->SetPolys(newPolys);
   }
-  Mesh->BuildLinks();
+
+  // Instead of building cell links and searching them edge by edge with
+  // GetCellEdgeNeighbors() (which degrades on high-degree point fans), gather
+  // every polygon edge in parallel and sort them into a static edge locator.
+  // All cells using an edge then sit in one contiguous run of the sorted
+  // edge array.
+  vtkIdType numNewPolys = newPolys->GetNumberOfCells();
+  vtkIdType numMeshEdges = newPolys->GetNumberOfConnectivityIds();
+  typedef EdgeTuple<vtkIdType, vtkIdType> MeshEdgeType;
+  std::vector<MeshEdgeType> meshEdges(numMeshEdges);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, numNewPolys, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* cellPts = tlCellPts.Local();
+    vtkIdType cellNPts;
+    const vtkIdType* cellPtsPtr;
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      newPolys->GetCellAtId(cid, cellNPts, cellPtsPtr, cellPts);
+      vtkIdType offset = newPolys->GetOffset(cid);
+      for (vtkIdType e = 0; e < cellNPts; ++e)
+      {
+        meshEdges[offset + e] = MeshEdgeType(cellPtsPtr[e], cellPtsPtr[(e + 1) % cellNPts], cid);
+      }
+    }
+  });
+  vtkStaticEdgeLocatorTemplate<vtkIdType, vtkIdType> edgeLocator;
+  edgeLocator.BuildLocator(numMeshEdges, meshEdges.data());
 
   // Allocate storage for lines/points (arbitrary allocation sizes)
   //
@@ -367,7 +397,20 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
       p1 = pts[i];
       p2 = pts[(i + 1) % npts];
 
-      Mesh->GetCellEdgeNeighbors(newCellId, p1, p2, neighbors);
+      // Collect the other cells using this edge from the sorted edge array;
+      // duplicates of an edge are contiguous.
+      neighbors->Reset();
+      vtkIdType meshEdgeId = edgeLocator.IsInsertedEdge(p1, p2);
+      if (meshEdgeId >= 0)
+      {
+        for (; meshEdgeId < numMeshEdges && meshEdges[meshEdgeId].IsEdge(p1, p2); ++meshEdgeId)
+        {
+          if (meshEdges[meshEdgeId].Data != newCellId)
+          {
+            neighbors->InsertNextId(meshEdges[meshEdgeId].Data);
+          }
+        }
+      }
       numNei = neighbors->GetNumberOfIds();
 
       vtkIdType numNeiWithoutGhosts = numNei;
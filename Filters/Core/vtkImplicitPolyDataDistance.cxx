@@ -18,9 +18,12 @@
 #include "vtkCellLocator.h"
 #include "vtkGenericCell.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTriangleFilter.h"
 
@@ -134,8 +137,55 @@ void vtkImplicitPolyDataDistance::EvaluateGradient(double x[3], double g[3])
     x, g, p); // get normal, returned distance value not used and closest point not used
 }
 
+//------------------------------------------------------------------------------
+void vtkImplicitPolyDataDistance::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  vtkIdType numPts = input->GetNumberOfTuples();
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(numPts);
+
+  // See if data set with polygons has been specified
+  if (this->Input == nullptr || this->Input->GetNumberOfCells() == 0)
+  {
+    vtkErrorMacro(<< "No polygons to evaluate function!");
+    output->Fill(this->NoValue);
+    return;
+  }
+
+  // Evaluate the points in parallel. The locator and the input links are
+  // only read during evaluation; all mutable working objects are
+  // per-thread.
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocalObject<vtkGenericCell> tlNeighborCell;
+  vtkSMPThreadLocalObject<vtkIdList> tlIdList;
+  vtkSMPTools::For(
+    0, numPts, [this, input, output, &tlCell, &tlNeighborCell, &tlIdList](
+                 vtkIdType begin, vtkIdType end) {
+      vtkGenericCell* cell = tlCell.Local();
+      vtkGenericCell* neighborCell = tlNeighborCell.Local();
+      vtkIdList* idList = tlIdList.Local();
+      double x[3], g[3], p[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        input->GetTuple(ptId, x);
+        output->SetComponent(
+          ptId, 0, this->SharedEvaluate(x, g, p, cell, neighborCell, idList));
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], double closestPoint[3])
+{
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkGenericCell> neighborCell;
+  vtkNew<vtkIdList> idList;
+  return this->SharedEvaluate(x, g, closestPoint, cell, neighborCell, idList);
+}
+
+//------------------------------------------------------------------------------
+double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], double closestPoint[3],
+  vtkGenericCell* cell, vtkGenericCell* neighborCell, vtkIdList* idList)
 {
   // Set defaults
   double ret = this->NoValue;
@@ -169,7 +219,6 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
   }
 
   // Get point id of closest point in data set.
-  vtkSmartPointer<vtkGenericCell> cell = vtkSmartPointer<vtkGenericCell>::New();
   this->Locator->FindClosestPoint(x, p, cell, cellId, subId, vlen2);
 
   if (cellId != -1) // point located
@@ -185,7 +234,6 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
     double dist2, weights[3], pcoords[3], awnorm[3] = { 0, 0, 0 };
     cell->EvaluatePosition(p, closestPoint, subId, pcoords, dist2, weights);
 
-    vtkIdList* idList = vtkIdList::New();
     int count = 0;
     for (int i = 0; i < 3; i++)
     {
@@ -238,7 +286,8 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
         }
         else
         {
-          vtkPolygon::ComputeNormal(this->Input->GetCell(idList->GetId(i))->GetPoints(), norm);
+          this->Input->GetCell(idList->GetId(i), neighborCell);
+          vtkPolygon::ComputeNormal(neighborCell->GetPoints(), norm);
         }
         awnorm[0] += norm[0];
         awnorm[1] += norm[1];
@@ -272,6 +321,7 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
       this->Input->GetPointCells(a, idList);
       for (int i = 0; i < idList->GetNumberOfIds(); i++)
       {
+        this->Input->GetCell(idList->GetId(i), neighborCell);
         double norm[3];
         if (cnorms)
         {
@@ -279,19 +329,19 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
         }
         else
         {
-          vtkPolygon::ComputeNormal(this->Input->GetCell(idList->GetId(i))->GetPoints(), norm);
+          vtkPolygon::ComputeNormal(neighborCell->GetPoints(), norm);
         }
 
         // Compute angle at point a
-        int b = this->Input->GetCell(idList->GetId(i))->GetPointId(0);
-        int c = this->Input->GetCell(idList->GetId(i))->GetPointId(1);
+        int b = neighborCell->GetPointId(0);
+        int c = neighborCell->GetPointId(1);
         if (a == b)
         {
-          b = this->Input->GetCell(idList->GetId(i))->GetPointId(2);
+          b = neighborCell->GetPointId(2);
         }
         else if (a == c)
         {
-          c = this->Input->GetCell(idList->GetId(i))->GetPointId(2);
+          c = neighborCell->GetPointId(2);
         }
         double pa[3], pb[3], pc[3];
         this->Input->GetPoint(a, pa);
@@ -311,7 +361,6 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
       }
       vtkMath::Normalize(awnorm);
     }
-    idList->Delete();
 
     // sign(dist) = dot(grad, cell normal)
     if (ret == 0)
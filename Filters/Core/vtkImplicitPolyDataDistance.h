@@ -44,6 +44,8 @@
 #include "vtkImplicitFunction.h"
 
 class vtkCellLocator;
+class vtkGenericCell;
+class vtkIdList;
 class vtkPolyData;
 
 class VTKFILTERSCORE_EXPORT vtkImplicitPolyDataDistance : public vtkImplicitFunction
@@ -64,6 +66,14 @@ public:
   using vtkImplicitFunction::EvaluateFunction;
   double EvaluateFunction(double x[3]) override;
 
+  /**
+   * Evaluate the signed distance for a whole array of points at once. The
+   * points are processed in parallel with vtkSMPTools; the locator queries
+   * and pseudonormal lookups use per-thread working storage, so this is
+   * much faster than point-at-a-time evaluation for large batches.
+   */
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
+
   /**
    * Evaluate function gradient of nearest triangle to point x[3].
    */
@@ -127,7 +137,16 @@ protected:
    */
   void CreateDefaultLocator();
 
+  ///@{
+  /**
+   * Common implementation behind the evaluate methods. The second form
+   * takes caller-provided working objects so that concurrent evaluations
+   * (one set of objects per thread) do not share any mutable state.
+   */
   double SharedEvaluate(double x[3], double g[3], double closestPoint[3]);
+  double SharedEvaluate(double x[3], double g[3], double closestPoint[3], vtkGenericCell* cell,
+    vtkGenericCell* neighborCell, vtkIdList* idList);
+  ///@}
 
   double NoGradient[3];
   double NoClosestPoint[3];
@@ -24,14 +24,19 @@
 #include "vtkMinimalStandardRandomSequence.h"
 #include "vtkObjectFactory.h"
 #include "vtkOctreePointLocator.h"
+#include "vtkPhiloxRandomSequence.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <random>
+#include <vector>
 
 namespace
 {
@@ -469,84 +474,72 @@ int vtkMaskPoints::RequestData(vtkInformation* vtkNotUsed(request),
       }
       case RANDOM_SAMPLING:
       {
-        // Vitter's algorithm D (without A)
-        // for generating random samples incrementally: O(samplesize)
-        vtkIdType ptId = -1;
-        double vprime = log(d_rand());
-        vtkIdType size = numPts;
+        // Assign every input point a uniform random key taken from a
+        // counter-based random sequence, then keep the samplesize points
+        // with the smallest keys. This is equivalent to a uniform random
+        // sample without replacement (as Vitter's sequential algorithm D
+        // produced), but because the key of a point depends only on the
+        // seed and the point id, the keys can be generated in parallel
+        // and the sample is reproducible across thread counts.
         vtkIdType samplesize = localMaxPts;
-        vtkIdType q1 = size - samplesize + 1;
+        std::vector<double> keys(numPts);
+        int seed = this->RandomSeed;
+        vtkSMPThreadLocalObject<vtkPhiloxRandomSequence> tlSequence;
+        vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+          vtkPhiloxRandomSequence* sequence = tlSequence.Local();
+          sequence->Initialize(seed);
+          sequence->SetIndex(static_cast<vtkTypeUInt64>(ptId));
+          for (; ptId < endPtId; ptId++)
+          {
+            keys[ptId] = sequence->GetValue();
+            sequence->Next();
+          }
+        });
 
-        while (samplesize > 1)
+        if (samplesize >= numPts)
         {
-          double q2 = (q1 - 1.0) / (size - 1.0);
-          double q3 = log(q2);
-          vtkIdType s;
-
-          while (true)
+          for (vtkIdType ptId = 0; ptId < numPts; ptId++)
           {
-            while (true)
-            {
-              s = (vtkIdType)(vprime / q3);
-              if (s < q1)
-              {
-                break;
-              }
-              vprime = log(d_rand());
-            }
-
-            double lhs = log(d_rand());
-            double rhs = s * (log((double)(q1 - s) / (size - s)) - q3);
-
-            if (lhs <= rhs)
-            {
-              vprime = lhs - rhs;
-              break;
-            }
-
-            double y = 1.0;
-            vtkIdType bottom;
-            vtkIdType limit;
-            if (samplesize - 1 > s)
-            {
-              bottom = size - samplesize;
-              limit = size - s;
-            }
-            else
-            {
-              bottom = size - s - 1;
-              limit = q1;
-            }
+            input->GetPoint(ptId, x);
+            id = newPts->InsertNextPoint(x);
+            outputPD->CopyData(pd, ptId, id);
+          }
+          break;
+        }
 
-            for (vtkIdType top = size - 1; top >= limit; top = top - 1)
-            {
-              y = y * top / bottom;
-              bottom = bottom - 1;
-            }
+        // the key of the samplesize'th smallest point is the selection
+        // threshold
+        std::vector<double> order(keys);
+        std::nth_element(order.begin(), order.begin() + (samplesize - 1), order.end());
+        double threshold = order[samplesize - 1];
+        order.clear();
+        order.shrink_to_fit();
+
+        // points strictly below the threshold are always in the sample;
+        // points on the threshold fill the remaining slots (ties are
+        // essentially impossible with 32 random bits per key but must not
+        // change the sample size)
+        vtkIdType numBelow = 0;
+        for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+        {
+          numBelow += (keys[ptId] < threshold) ? 1 : 0;
+        }
+        vtkIdType tiesLeft = samplesize - numBelow;
 
-            vprime = log(d_rand());
-            if (q3 <= -(log(y) + lhs) / s)
+        // emit the sample in point id order
+        for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+        {
+          if (keys[ptId] < threshold || (keys[ptId] == threshold && tiesLeft > 0))
+          {
+            if (keys[ptId] == threshold)
             {
-              break;
+              tiesLeft = tiesLeft - 1;
             }
+            input->GetPoint(ptId, x);
+            id = newPts->InsertNextPoint(x);
+            outputPD->CopyData(pd, ptId, id);
           }
-
-          // add a point
-          ptId = ptId + s + 1;
-          input->GetPoint(ptId, x);
-          id = newPts->InsertNextPoint(x);
-          outputPD->CopyData(pd, ptId, id);
-
-          size = size - s - 1;
-          samplesize = samplesize - 1;
-          q1 = q1 - s;
         }
-
-        // add last point
-        ptId = ptId + (vtkIdType)(d_rand() * size) + 1;
-        input->GetPoint(ptId, x);
-        id = newPts->InsertNextPoint(x);
-        outputPD->CopyData(pd, ptId, id);
         break;
       }
       case SPATIALLY_STRATIFIED:
@@ -105,11 +105,13 @@ public:
    * (plus Vitter's incremental random algorithms are more complex
    * than this, while not a proof it is good indication this isn't
    * a statistically random sample - the closest would be algorithm S)
-   * 1 - random sample: create a statistically random sample using Vitter's
-   * incremental algorithm D without A described in Vitter
-   * "Faster Mthods for Random Sampling", Communications of the ACM
-   * Volume 27, Issue 7, 1984
-   * (OnRatio and Offset are ignored) O(sample size)
+   * 1 - random sample: create a statistically random sample by giving
+   * every point a uniform random key from a counter-based random
+   * sequence (vtkPhiloxRandomSequence seeded with RandomSeed) and
+   * keeping the points with the smallest keys. The keys are generated
+   * in parallel with vtkSMPTools and the sample is reproducible across
+   * thread counts.
+   * (OnRatio and Offset are ignored) O(N)
    * 2 - spatially stratified random sample: create a spatially
    * stratified random sample using the first method described in
    * Woodring et al. "In-situ Sampling of a Large-Scale Particle
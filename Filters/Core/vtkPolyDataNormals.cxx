@@ -27,6 +27,8 @@
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangleStrip.h"
 
 vtkStandardNewMacro(vtkPolyDataNormals);
@@ -360,19 +362,25 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
     this->PolyNormals->SetTuple(cellId, n);
   }
 
-  for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); cellId++)
-  {
-    if ((cellId % 1000) == 0)
+  // Compute the cell normals in parallel. Cell access goes through the
+  // thread-safe GetCellAtId() overload; the thread-local id list is only
+  // used when the connectivity storage cannot be shared directly.
+  float* fPolyNormals0 = this->PolyNormals->WritePointer(3 * offsetCells, 3 * numPolys);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, numPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+    vtkIdList* cellPts = tlCellPts.Local();
+    vtkIdType cellSize;
+    const vtkIdType* cellPtIds;
+    double cn[3];
+    for (; polyId < endPolyId; ++polyId)
     {
-      this->UpdateProgress(0.333 + 0.333 * (double)cellId / (double)numPolys);
-      if (this->GetAbortExecute())
-      {
-        break;
-      }
+      newPolys->GetCellAtId(polyId, cellSize, cellPtIds, cellPts);
+      vtkPolygon::ComputeNormal(inPts, cellSize, cellPtIds, cn);
+      fPolyNormals0[3 * polyId] = static_cast<float>(cn[0]);
+      fPolyNormals0[3 * polyId + 1] = static_cast<float>(cn[1]);
+      fPolyNormals0[3 * polyId + 2] = static_cast<float>(cn[2]);
     }
-    vtkPolygon::ComputeNormal(inPts, npts, pts, n);
-    this->PolyNormals->SetTuple(offsetCells + cellId, n);
-  }
+  });
 
   // Split mesh if sharp features
   if (this->Splitting)
@@ -479,28 +487,64 @@ int vtkPolyDataNormals::RequestData(vtkInformation* vtkNotUsed(request),
 
   if (this->ComputePointNormals)
   {
-    for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); ++cellId)
+    if (!this->Splitting)
     {
-      for (vtkIdType i = 0; i < npts; ++i)
-      {
-        fNormals[3 * pts[i]] += fPolyNormals[3 * cellId];
-        fNormals[3 * pts[i] + 1] += fPolyNormals[3 * cellId + 1];
-        fNormals[3 * pts[i] + 2] += fPolyNormals[3 * cellId + 2];
-      }
+      // Without splitting the output point ids match the input, so the cell
+      // links built on OldMesh can be used to gather, per point, the normals
+      // of the cells using it. Each thread writes only its own range of
+      // points: no atomics or locks are needed, and normalization happens
+      // in the same pass while the accumulated normal is still in cache.
+      vtkSMPTools::For(0, numNewPts, [&](vtkIdType pointId, vtkIdType endPointId) {
+        vtkIdType nCells;
+        vtkIdType* cellIds;
+        for (; pointId < endPointId; ++pointId)
+        {
+          this->OldMesh->GetPointCells(pointId, nCells, cellIds);
+          float* pn = fNormals + 3 * pointId;
+          for (vtkIdType j = 0; j < nCells; ++j)
+          {
+            const float* cn = fPolyNormals + 3 * cellIds[j];
+            pn[0] += cn[0];
+            pn[1] += cn[1];
+            pn[2] += cn[2];
+          }
+          const double length = sqrt(pn[0] * pn[0] + pn[1] * pn[1] + pn[2] * pn[2]) * flipDirection;
+          if (length != 0.0)
+          {
+            pn[0] /= length;
+            pn[1] /= length;
+            pn[2] /= length;
+          }
+        }
+      });
     }
-
-    for (vtkIdType i = 0; i < numNewPts; ++i)
+    else
     {
-      const double length =
-        sqrt(fNormals[3 * i] * fNormals[3 * i] + fNormals[3 * i + 1] * fNormals[3 * i + 1] +
-          fNormals[3 * i + 2] * fNormals[3 * i + 2]) *
-        flipDirection;
-      if (length != 0.0)
+      // Splitting created new points, so scatter the cell normals serially
+      // over the updated connectivity; normalization is still threaded.
+      for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); ++cellId)
       {
-        fNormals[3 * i] /= length;
-        fNormals[3 * i + 1] /= length;
-        fNormals[3 * i + 2] /= length;
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          fNormals[3 * pts[i]] += fPolyNormals[3 * cellId];
+          fNormals[3 * pts[i] + 1] += fPolyNormals[3 * cellId + 1];
+          fNormals[3 * pts[i] + 2] += fPolyNormals[3 * cellId + 2];
+        }
       }
+
+      vtkSMPTools::For(0, numNewPts, [&](vtkIdType pointId, vtkIdType endPointId) {
+        for (; pointId < endPointId; ++pointId)
+        {
+          float* pn = fNormals + 3 * pointId;
+          const double length = sqrt(pn[0] * pn[0] + pn[1] * pn[1] + pn[2] * pn[2]) * flipDirection;
+          if (length != 0.0)
+          {
+            pn[0] /= length;
+            pn[1] /= length;
+            pn[2] /= length;
+          }
+        }
+      });
     }
   }
 
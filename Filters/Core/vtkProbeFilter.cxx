@@ -32,12 +32,14 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnstructuredGrid.h"
+#include "vtkVoxel.h"
 
 #include <algorithm>
 #include <vector>
@@ -87,6 +89,10 @@ vtkProbeFilter::vtkProbeFilter()
   this->Tolerance = 1.0;
   this->ComputeTolerance = true;
   this->SnapToCellWithClosestPoint = false;
+  this->UseWarmStart = false;
+  this->WarmStartSource = nullptr;
+  this->WarmStartSourceTime = 0;
+  this->WarmStartSrcIdx = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -367,6 +373,11 @@ void vtkProbeFilter::DoProbing(
     vtkImageData* outImage = vtkImageData::SafeDownCast(output);
     this->ProbePointsImageData(inImage, srcIdx, source, outImage);
   }
+  else if (vtkRectilinearGrid::SafeDownCast(source))
+  {
+    vtkRectilinearGrid* sourceGrid = vtkRectilinearGrid::SafeDownCast(source);
+    this->ProbeRectilinearGridPoints(input, srcIdx, sourceGrid, output);
+  }
   else
   {
     this->ProbeEmptyPoints(input, srcIdx, source, output);
@@ -396,6 +407,7 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
   vtkCharArray* MaskArray;
   double Tol2;
   int MaxCellSize;
+  vtkIdType* WarmStartCellIds;
 
   struct LocalData
   {
@@ -417,7 +429,8 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
 public:
   ProbeEmptyPointsWorklet(vtkProbeFilter* probeFilter, int sourceIndex, vtkDataSet* input,
     vtkDataSet* source, vtkPointData* outputPD, vtkFindCellStrategy* strategy,
-    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize)
+    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize,
+    vtkIdType* warmStartCellIds)
     : ProbeFilter(probeFilter)
     , SourceIdx(sourceIndex)
     , Input(input)
@@ -430,6 +443,7 @@ public:
     , MaskArray(maskArray)
     , Tol2(tol2)
     , MaxCellSize(maxCellSize)
+    , WarmStartCellIds(warmStartCellIds)
   {
     // instantiate the cell map for polydata
     vtkNew<vtkGenericCell> cell;
@@ -476,6 +490,7 @@ public:
   {
     // global data
     auto maskArray = this->MaskArray->GetPointer(0);
+    auto warmStartCellIds = this->WarmStartCellIds;
     // thread local data
     auto& tlData = this->TLData.Local();
     auto& strategy = tlData.Strategy;
@@ -508,6 +523,18 @@ public:
       // Get the xyz coordinate of the point in the input dataset
       this->Input->GetPoint(pointId, x);
 
+      if (warmStartCellIds && warmStartCellIds[pointId] >= 0 &&
+        warmStartCellIds[pointId] != lastCellId)
+      {
+        // Warm start: seed the cached cell with the cell that contained this
+        // point during the previous execution; for small probe motions the
+        // point is usually still inside it and the search below is skipped.
+        lastCellId = warmStartCellIds[pointId];
+        this->Source->GetCell(lastCellId, currentCell);
+        std::copy_n(currentCell->GetBounds(), 6, lastCellBounds);
+        lastLength2 = ProbeEmptyPointsWorklet::GetLength2(lastCellBounds);
+      }
+
       foundInCache = false;
       if (lastCellId != -1)
       {
@@ -611,6 +638,12 @@ public:
         }
       }
 
+      if (warmStartCellIds)
+      {
+        // Remember the result (or the miss) for the next execution.
+        warmStartCellIds[pointId] = lastCellId;
+      }
+
       if (lastCellId >= 0 && !::IsBlankedCell(this->SourceGhostFlags, lastCellId))
       {
         if (this->ProbeFilter->ComputeTolerance)
@@ -737,9 +770,34 @@ void vtkProbeFilter::ProbeEmptyPoints(
     }
   }
 
+  // Validate the warm-start cache: the cached cell ids are only meaningful
+  // when probing the same unmodified source with the same number of probe
+  // points as the previous execution. Warm starting only pays off for
+  // vtkPointSet sources, where FindCell() involves a locator search.
+  vtkIdType numPts = input->GetNumberOfPoints();
+  vtkIdType* warmStartCellIds = nullptr;
+  if (this->UseWarmStart && strategy)
+  {
+    if (this->WarmStartSource != source || this->WarmStartSourceTime != source->GetMTime() ||
+      this->WarmStartSrcIdx != srcIdx ||
+      this->WarmStartCellIds.size() != static_cast<size_t>(numPts))
+    {
+      this->WarmStartCellIds.assign(numPts, -1);
+      this->WarmStartSource = source;
+      this->WarmStartSourceTime = source->GetMTime();
+      this->WarmStartSrcIdx = srcIdx;
+    }
+    warmStartCellIds = this->WarmStartCellIds.data();
+  }
+  else
+  {
+    std::vector<vtkIdType>().swap(this->WarmStartCellIds);
+    this->WarmStartSource = nullptr;
+  }
+
   ProbeEmptyPointsWorklet worker(this, srcIdx, input, source, outPD, strategy, sourceGhostFlags,
-    this->MaskPoints, tol2, maxCellSize);
-  vtkSMPTools::For(0, input->GetNumberOfPoints(), worker);
+    this->MaskPoints, tol2, maxCellSize, warmStartCellIds);
+  vtkSMPTools::For(0, numPts, worker);
 
   this->MaskPoints->Modified();
 }
@@ -1109,6 +1167,194 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
   }
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+
+// Thread local storage
+struct ProbeRectilinearGridPointsThreadLocal
+{
+  bool BaseThread = false;
+  vtkSmartPointer<vtkIdList> PointIds;
+};
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkProbeFilter::ProbeRectilinearGridPointsWorklet
+{
+public:
+  ProbeRectilinearGridPointsWorklet(vtkProbeFilter* probeFilter, vtkDataSet* input,
+    vtkRectilinearGrid* source, int srcIdx, vtkPointData* outPD, char* maskArray)
+    : ProbeFilter(probeFilter)
+    , Input(input)
+    , Source(source)
+    , BlockId(srcIdx)
+    , OutPointData(outPD)
+    , MaskArray(maskArray)
+  {
+    // Cache the axis coordinates once as doubles so that the per-point
+    // binary search does not go through virtual data array access.
+    vtkDataArray* axes[3] = { source->GetXCoordinates(), source->GetYCoordinates(),
+      source->GetZCoordinates() };
+    for (int axis = 0; axis < 3; axis++)
+    {
+      vtkIdType numCoords = (axes[axis] ? axes[axis]->GetNumberOfTuples() : 0);
+      this->Coords[axis].resize(static_cast<size_t>(numCoords > 0 ? numCoords : 1), 0.0);
+      for (vtkIdType i = 0; i < numCoords; i++)
+      {
+        this->Coords[axis][i] = axes[axis]->GetComponent(i, 0);
+      }
+    }
+  }
+
+  void Initialize()
+  {
+    // BaseThread will be set 'true' for the thread that gets the first piece
+    ProbeRectilinearGridPointsThreadLocal& dataPoint = this->Thread.Local();
+    dataPoint.BaseThread = false;
+    dataPoint.PointIds = vtkSmartPointer<vtkIdList>::New();
+    dataPoint.PointIds->SetNumberOfIds(8);
+  }
+
+  void operator()(vtkIdType startId, vtkIdType endId)
+  {
+    if (startId == 0)
+    {
+      this->Thread.Local().BaseThread = true;
+    }
+    this->ProbeFilter->ProbeRectilinearGridPointsSMP(this->Input, this->Source, this->BlockId,
+      this->OutPointData, this->MaskArray, this->Coords,
+      this->Thread.Local().PointIds.GetPointer(), startId, endId, this->Thread.Local().BaseThread);
+  }
+
+  void Reduce() {}
+
+private:
+  vtkProbeFilter* ProbeFilter;
+  vtkDataSet* Input;
+  vtkRectilinearGrid* Source;
+  int BlockId;
+  vtkPointData* OutPointData;
+  char* MaskArray;
+  std::vector<double> Coords[3];
+  vtkSMPThreadLocal<ProbeRectilinearGridPointsThreadLocal> Thread;
+};
+
+//------------------------------------------------------------------------------
+void vtkProbeFilter::ProbeRectilinearGridPoints(
+  vtkDataSet* input, int srcIdx, vtkRectilinearGrid* sourceGrid, vtkDataSet* output)
+{
+  vtkPointData* outPD = output->GetPointData();
+  char* maskArray = this->MaskPoints->GetPointer(0);
+
+  // Estimate the granularity for multithreading
+  int threads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  vtkIdType numPts = input->GetNumberOfPoints();
+  vtkIdType grain = numPts / threads;
+  vtkIdType minGrain = 100;
+  vtkIdType maxGrain = 1000;
+  grain = vtkMath::ClampValue(grain, minGrain, maxGrain);
+
+  // Multithread the execution
+  ProbeRectilinearGridPointsWorklet worklet(this, input, sourceGrid, srcIdx, outPD, maskArray);
+  vtkSMPTools::For(0, numPts, grain, worklet);
+
+  this->MaskPoints->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkProbeFilter::ProbeRectilinearGridPointsSMP(vtkDataSet* input, vtkRectilinearGrid* source,
+  int srcIdx, vtkPointData* outPD, char* maskArray, const std::vector<double>* coords,
+  vtkIdList* pointIds, vtkIdType startId, vtkIdType endId, bool baseThread)
+{
+  vtkPointData* pd = source->GetPointData();
+  vtkCellData* cd = source->GetCellData();
+
+  int dims[3];
+  source->GetDimensions(dims);
+
+  auto sourceGhostFlags =
+    vtkUnsignedCharArray::SafeDownCast(cd->GetArray(vtkDataSetAttributes::GhostArrayName()));
+
+  // Loop over all input points, interpolating source data
+  vtkIdType progressInterval = endId / 20 + 1;
+  for (vtkIdType ptId = startId; ptId < endId && !GetAbortExecute(); ptId++)
+  {
+    if (baseThread && !(ptId % progressInterval))
+    {
+      // This is not ideal, because if the base thread executes more than one piece,
+      // then the progress will repeat its 0.0 to 1.0 progression for each piece.
+      this->UpdateProgress(static_cast<double>(ptId) / endId);
+    }
+
+    if (maskArray[ptId] == static_cast<char>(1))
+    {
+      // skip points which have already been probed with success.
+      // This is helpful for multiblock dataset probing.
+      continue;
+    }
+
+    // Get the xyz coordinate of the point in the input dataset
+    double x[3];
+    input->GetPoint(ptId, x);
+
+    // Locate the containing cell with a binary search along each axis,
+    // replicating the semantics of ComputeStructuredCoordinates() for
+    // monotonically increasing coordinates.
+    int ijk[3];
+    double pcoords[3];
+    bool outside = false;
+    for (int axis = 0; axis < 3; axis++)
+    {
+      const std::vector<double>& c = coords[axis];
+      vtkIdType numCoords = static_cast<vtkIdType>(c.size());
+      if (x[axis] < c.front() || x[axis] > c.back() ||
+        (x[axis] == c.back() && dims[axis] != 1))
+      {
+        outside = true;
+        break;
+      }
+      if (numCoords < 2)
+      {
+        ijk[axis] = 0;
+        pcoords[axis] = 0.0;
+      }
+      else
+      {
+        vtkIdType loc =
+          static_cast<vtkIdType>(std::upper_bound(c.begin(), c.end(), x[axis]) - c.begin()) - 1;
+        ijk[axis] = static_cast<int>(loc);
+        pcoords[axis] = (x[axis] - c[loc]) / (c[loc + 1] - c[loc]);
+      }
+    }
+    if (outside)
+    {
+      continue;
+    }
+
+    double weights[8];
+    vtkVoxel::InterpolationFunctions(pcoords, weights);
+    vtkIdType cellId = source->ComputeCellId(ijk);
+    if (cellId >= 0 && !::IsBlankedCell(sourceGhostFlags, cellId))
+    {
+      source->GetCellPoints(cellId, pointIds);
+
+      // Interpolate the point data
+      outPD->InterpolatePoint(*this->PointList, pd, srcIdx, ptId, pointIds, weights);
+      for (auto& cellArray : this->CellArrays)
+      {
+        vtkDataArray* inArray = cd->GetArray(cellArray->GetName());
+        if (inArray)
+        {
+          outPD->CopyTuple(inArray, cellArray, cellId, ptId);
+        }
+      }
+      maskArray[ptId] = static_cast<char>(1);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkProbeFilter::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -1242,6 +1488,7 @@ void vtkProbeFilter::PrintSelf(ostream& os, vtkIndent indent)
      << (this->ValidPointMaskArrayName ? this->ValidPointMaskArrayName : "vtkValidPointMask")
      << "\n";
   os << indent << "PassFieldArrays: " << (this->PassFieldArrays ? "On" : " Off") << "\n";
+  os << indent << "UseWarmStart: " << (this->UseWarmStart ? "On" : "Off") << "\n";
 
   os << indent << "FindCellStrategy: "
      << (this->FindCellStrategy ? this->FindCellStrategy->GetClassName() : "NULL") << "\n";
@@ -77,6 +77,7 @@ class vtkCharArray;
 class vtkIdTypeArray;
 class vtkImageData;
 class vtkPointData;
+class vtkRectilinearGrid;
 class vtkFindCellStrategy;
 
 class VTKFILTERSCORE_EXPORT vtkProbeFilter : public vtkDataSetAlgorithm
@@ -203,6 +204,27 @@ public:
   vtkGetMacro(SnapToCellWithClosestPoint, bool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether to warm start the containing-cell search across
+   * executions. When on, the cell found for each probe point is remembered
+   * and the next execution evaluates that cell first, falling back to the
+   * regular strategy / locator search on a miss. This greatly accelerates
+   * repeated probing with slowly moving probe geometry (e.g. a plane swept
+   * through a static volume), where most points remain in the cell found
+   * during the previous execution. The cache is discarded whenever the
+   * source, the source's MTime, or the number of probe points changes.
+   *
+   * Default is off.
+   *
+   * Note: This only affects probing of vtkPointSet sources; implicitly
+   * structured sources (image data) already locate cells in constant time.
+   */
+  vtkSetMacro(UseWarmStart, bool);
+  vtkBooleanMacro(UseWarmStart, bool);
+  vtkGetMacro(UseWarmStart, bool);
+  ///@}
+
   ///@{
   /**
    * Set whether to use the Tolerance field or precompute the tolerance.
@@ -286,6 +308,7 @@ protected:
   double Tolerance;
   bool ComputeTolerance;
   bool SnapToCellWithClosestPoint;
+  bool UseWarmStart;
 
   char* ValidPointMaskArrayName;
   vtkIdTypeArray* ValidPoints;
@@ -324,9 +347,27 @@ private:
 
   class ProbeImageDataPointsWorklet;
 
+  // A faster implementation for vtkRectilinearGrid source, using a binary
+  // search per axis instead of the generic FindCell() machinery.
+  void ProbeRectilinearGridPoints(
+    vtkDataSet* input, int srcIdx, vtkRectilinearGrid* sourceGrid, vtkDataSet* output);
+  void ProbeRectilinearGridPointsSMP(vtkDataSet* input, vtkRectilinearGrid* source, int srcIdx,
+    vtkPointData* outPD, char* maskArray, const std::vector<double>* coords, vtkIdList* pointIds,
+    vtkIdType startId, vtkIdType endId, bool baseThread);
+
+  class ProbeRectilinearGridPointsWorklet;
+
   class ProbeEmptyPointsWorklet;
 
   std::vector<vtkDataArray*> CellArrays;
+
+  // Warm-start support: the cell found for each probe point during the
+  // previous execution, along with the stamps used to validate the cache.
+  // The source pointer is weak and only ever compared for identity.
+  std::vector<vtkIdType> WarmStartCellIds;
+  vtkDataSet* WarmStartSource;
+  vtkMTimeType WarmStartSourceTime;
+  int WarmStartSrcIdx;
 };
 
 #endif
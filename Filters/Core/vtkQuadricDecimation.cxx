@@ -235,6 +235,7 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   pointData->Delete();
   this->Mesh->GetFieldData()->PassData(input->GetFieldData());
   this->Mesh->BuildCells();
+  this->Mesh->EditableOn(); // links are edited as edges are collapsed
   this->Mesh->BuildLinks();
 
   this->ErrorQuadrics = new vtkQuadricDecimation::ErrorQuadric[numPts];
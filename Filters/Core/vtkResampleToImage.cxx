@@ -37,6 +37,7 @@ vtkObjectFactoryNewMacro(vtkResampleToImage);
 //------------------------------------------------------------------------------
 vtkResampleToImage::vtkResampleToImage()
   : UseInputBounds(true)
+  , MemoryLimit(0)
 {
   this->SetNumberOfInputPorts(1);
   this->SetNumberOfOutputPorts(1);
@@ -59,6 +60,7 @@ void vtkResampleToImage::PrintSelf(ostream& os, vtkIndent indent)
      << this->SamplingBounds[4] << ", " << this->SamplingBounds[5] << "]" << endl;
   os << indent << "SamplingDimensions " << this->SamplingDimensions[0] << " x "
      << this->SamplingDimensions[1] << " x " << this->SamplingDimensions[2] << endl;
+  os << indent << "MemoryLimit " << this->MemoryLimit << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -165,6 +167,26 @@ inline void ComputeBoundingExtent(
   }
 }
 
+inline vtkDataSet* GetFirstLeafDataSet(vtkDataObject* data)
+{
+  if (vtkDataSet* ds = vtkDataSet::SafeDownCast(data))
+  {
+    return ds;
+  }
+  if (vtkCompositeDataSet* cdata = vtkCompositeDataSet::SafeDownCast(data))
+  {
+    using Opts = vtk::CompositeDataSetOptions;
+    for (vtkDataObject* dObj : vtk::Range(cdata, Opts::SkipEmptyNodes))
+    {
+      if (vtkDataSet* ds = vtkDataSet::SafeDownCast(dObj))
+      {
+        return ds;
+      }
+    }
+  }
+  return nullptr;
+}
+
 } // anonymous namespace
 
 void vtkResampleToImage::PerformResampling(vtkDataObject* input, const double samplingBounds[6],
@@ -224,6 +246,105 @@ void vtkResampleToImage::PerformResampling(vtkDataObject* input, const double sa
   output->GetFieldData()->PassData(input->GetFieldData());
 }
 
+//------------------------------------------------------------------------------
+void vtkResampleToImage::PerformStreamedResampling(
+  vtkDataObject* input, const double samplingBounds[6], vtkImageData* output)
+{
+  if (this->SamplingDimensions[0] <= 0 || this->SamplingDimensions[1] <= 0 ||
+    this->SamplingDimensions[2] <= 0)
+  {
+    return;
+  }
+
+  double origin[3] = { samplingBounds[0], samplingBounds[2], samplingBounds[4] };
+  double spacing[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    spacing[i] = (this->SamplingDimensions[i] == 1)
+      ? 0
+      : ((samplingBounds[i * 2 + 1] - samplingBounds[i * 2]) /
+          static_cast<double>(this->SamplingDimensions[i] - 1));
+  }
+
+  int wholeExtent[6];
+  std::copy(this->GetUpdateExtent(), this->GetUpdateExtent() + 6, wholeExtent);
+
+  output->SetOrigin(origin);
+  output->SetSpacing(spacing);
+  output->SetExtent(wholeExtent);
+
+  vtkIdType sliceSize = static_cast<vtkIdType>(wholeExtent[1] - wholeExtent[0] + 1) *
+    static_cast<vtkIdType>(wholeExtent[3] - wholeExtent[2] + 1);
+  vtkIdType numPoints = sliceSize * static_cast<vtkIdType>(wholeExtent[5] - wholeExtent[4] + 1);
+  if (numPoints < 1)
+  {
+    return;
+  }
+
+  // Estimate the memory the probing intermediates need per probed point so
+  // that the slab size honors the memory limit. The probe output carries the
+  // interpolated input point arrays plus the valid-points mask, and the slab
+  // structure and probe output co-exist while a slab is copied out.
+  vtkIdType bytesPerPoint = 1; // vtkValidPointMask
+  if (vtkDataSet* leaf = GetFirstLeafDataSet(input))
+  {
+    vtkPointData* inPD = leaf->GetPointData();
+    for (int i = 0; i < inPD->GetNumberOfArrays(); ++i)
+    {
+      if (vtkDataArray* array = inPD->GetArray(i))
+      {
+        bytesPerPoint += array->GetNumberOfComponents() * array->GetDataTypeSize();
+      }
+    }
+  }
+  bytesPerPoint *= 2;
+
+  vtkIdType maxPointsPerSlab =
+    static_cast<vtkIdType>(this->MemoryLimit) * 1024 / bytesPerPoint;
+  int zPerSlab = static_cast<int>(
+    vtkMath::ClampValue(maxPointsPerSlab / sliceSize, static_cast<vtkIdType>(1),
+      static_cast<vtkIdType>(wholeExtent[5] - wholeExtent[4] + 1)));
+
+  vtkPointData* outPD = output->GetPointData();
+  vtkNew<vtkCompositeDataProbeFilter> prober;
+  prober->SetSourceData(input);
+
+  bool firstSlab = true;
+  for (int z = wholeExtent[4]; z <= wholeExtent[5]; z += zPerSlab)
+  {
+    int slabExtent[6] = { wholeExtent[0], wholeExtent[1], wholeExtent[2], wholeExtent[3], z,
+      vtkMath::Min(z + zPerSlab - 1, wholeExtent[5]) };
+
+    vtkNew<vtkImageData> structure;
+    structure->SetOrigin(origin);
+    structure->SetSpacing(spacing);
+    structure->SetExtent(slabExtent);
+
+    prober->SetInputData(structure);
+    prober->Update();
+
+    vtkImageData* slab = vtkImageData::SafeDownCast(prober->GetOutput());
+    if (!slab)
+    {
+      vtkErrorMacro("Probing failed for slab starting at z index " << z);
+      return;
+    }
+
+    vtkPointData* slabPD = slab->GetPointData();
+    if (firstSlab)
+    {
+      // Create the full-size output arrays (and copy the active attribute
+      // designations) from the first probed slab.
+      outPD->CopyAllocate(slabPD, numPoints);
+      firstSlab = false;
+    }
+    vtkIdType dstStart = static_cast<vtkIdType>(z - wholeExtent[4]) * sliceSize;
+    outPD->CopyData(slabPD, dstStart, slab->GetNumberOfPoints(), 0);
+  }
+
+  output->GetFieldData()->PassData(input->GetFieldData());
+}
+
 //------------------------------------------------------------------------------
 namespace
 {
@@ -375,7 +496,14 @@ int vtkResampleToImage::RequestData(vtkInformation* vtkNotUsed(request),
     std::copy(this->SamplingBounds, this->SamplingBounds + 6, samplingBounds);
   }
 
-  this->PerformResampling(input, samplingBounds, false, nullptr, output);
+  if (this->MemoryLimit > 0)
+  {
+    this->PerformStreamedResampling(input, samplingBounds, output);
+  }
+  else
+  {
+    this->PerformResampling(input, samplingBounds, false, nullptr, output);
+  }
   this->SetBlankPointsAndCells(output);
 
   return 1;
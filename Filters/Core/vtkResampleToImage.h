@@ -67,6 +67,18 @@ public:
   vtkGetVector3Macro(SamplingDimensions, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the memory limit in kibibytes (1024 bytes) for the intermediate
+   * probe image. When non-zero, the filter probes the target image in z-axis
+   * slabs sized to keep the probing intermediates within the limit and
+   * assembles them into the output, instead of materializing a second
+   * full-size image while probing. The default is 0 (resample in one pass).
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
   /**
    * Get the output data for this algorithm.
    */
@@ -97,6 +109,14 @@ protected:
   void PerformResampling(vtkDataObject* input, const double samplingBounds[6],
     bool computeProbingExtent, const double inputBounds[6], vtkImageData* output);
 
+  /**
+   * Resample input vtkDataObject to a vtkImageData with the specified bounds,
+   * probing one z-axis slab at a time so that the probing intermediates stay
+   * within MemoryLimit.
+   */
+  void PerformStreamedResampling(
+    vtkDataObject* input, const double samplingBounds[6], vtkImageData* output);
+
   /**
    * Mark invalid points and cells of vtkImageData as hidden
    */
@@ -111,6 +131,7 @@ protected:
   bool UseInputBounds;
   double SamplingBounds[6];
   int SamplingDimensions[3];
+  unsigned long MemoryLimit;
 
 private:
   vtkResampleToImage(const vtkResampleToImage&) = delete;
@@ -234,8 +234,10 @@ protected:
   // Internal locator for performing point merging
   vtkSmartPointer<vtkStaticPointLocator> Locator;
 
-  // These methods are made static so that vtkStaticCleanPolyData can use them
+  // These methods are made static so that vtkStaticCleanPolyData and
+  // vtkAppendFilter can use them
   friend class vtkStaticCleanPolyData;
+  friend class vtkAppendFilter;
   static void MarkPointUses(vtkCellArray* ca, vtkIdType* mergeMap, unsigned char* ptUses);
   static vtkIdType BuildPointMap(
     vtkIdType numPts, vtkIdType* pmap, unsigned char* ptUses, std::vector<vtkIdType>& mergeMap);
@@ -14,22 +14,98 @@
 =========================================================================*/
 #include "vtkTensorGlyph.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkTensorGlyph);
 
+namespace
+{
+
+// Replicate the connectivity of one source cell array for every glyph. The
+// glyph of direction dir at input point inPtId references the source points
+// shifted by (numDirs * inPtId + dir) * numSourcePts. The replicated cells
+// are ordered by (input point, source cell, direction), matching the order
+// the serial implementation produced.
+vtkSmartPointer<vtkCellArray> ReplicateSourceCells(
+  vtkCellArray* sourceCells, vtkIdType numPts, int numDirs, vtkIdType numSourcePts)
+{
+  const vtkIdType srcNumCells = sourceCells->GetNumberOfCells();
+
+  // Flatten the source connectivity for random access.
+  std::vector<vtkIdType> srcOffsets(srcNumCells + 1);
+  std::vector<vtkIdType> srcConn;
+  srcConn.reserve(sourceCells->GetNumberOfConnectivityIds());
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType cellId = 0; cellId < srcNumCells; cellId++)
+  {
+    srcOffsets[cellId] = static_cast<vtkIdType>(srcConn.size());
+    sourceCells->GetCellAtId(cellId, npts, pts);
+    srcConn.insert(srcConn.end(), pts, pts + npts);
+  }
+  const vtkIdType srcConnSize = static_cast<vtkIdType>(srcConn.size());
+  srcOffsets[srcNumCells] = srcConnSize;
+
+  const vtkIdType totalCells = srcNumCells * numDirs * numPts;
+  const vtkIdType totalConn = srcConnSize * numDirs * numPts;
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(totalCells + 1);
+  vtkNew<vtkIdTypeArray> conn;
+  conn->SetNumberOfValues(totalConn);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = conn->GetPointer(0);
+
+  vtkSMPTools::For(0, numPts, [&](vtkIdType inPtId, vtkIdType endPtId) {
+    for (; inPtId < endPtId; inPtId++)
+    {
+      const vtkIdType cellBase = inPtId * srcNumCells * numDirs;
+      const vtkIdType connBase = inPtId * srcConnSize * numDirs;
+      for (vtkIdType cellId = 0; cellId < srcNumCells; cellId++)
+      {
+        const vtkIdType cellSize = srcOffsets[cellId + 1] - srcOffsets[cellId];
+        for (int dir = 0; dir < numDirs; dir++)
+        {
+          const vtkIdType subIncr = (numDirs * inPtId + dir) * numSourcePts;
+          const vtkIdType connIdx = connBase + numDirs * srcOffsets[cellId] + dir * cellSize;
+          offsetsPtr[cellBase + cellId * numDirs + dir] = connIdx;
+          for (vtkIdType i = 0; i < cellSize; i++)
+          {
+            connPtr[connIdx + i] = srcConn[srcOffsets[cellId] + i] + subIncr;
+          }
+        }
+      }
+    }
+  });
+  offsetsPtr[totalCells] = totalConn; // top off cell array offsets
+
+  auto cells = vtkSmartPointer<vtkCellArray>::New();
+  cells->SetData(offsets, conn);
+  return cells;
+}
+
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct object with scaling on and scale factor 1.0. Eigenvalues are
 // extracted, glyphs are colored with input scalar data, and logarithmic
@@ -103,42 +179,18 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
   vtkDataArray* inTensors;
-  double tensor[9];
   vtkDataArray* inScalars;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  int j;
+  vtkIdType numPts, numSourcePts;
   vtkPoints* sourcePts;
   vtkDataArray* sourceNormals;
-  vtkCellArray *sourceCells, *cells;
+  vtkCellArray* sourceCells;
   vtkPoints* newPts;
   vtkFloatArray* newScalars = nullptr;
   vtkFloatArray* newNormals = nullptr;
-  double x[3], s;
-  vtkTransform* trans;
-  vtkCell* cell;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdType* pts;
-  vtkIdType ptIncr, cellId;
-  vtkIdType subIncr;
-  int numDirs, dir, eigen_dir, symmetric_dir;
-  vtkMatrix4x4* matrix;
-  double *m[3], w[3], *v[3];
-  double m0[3], m1[3], m2[3];
-  double v0[3], v1[3], v2[3];
-  double xv[3], yv[3], zv[3];
-  double maxScale;
+  int numDirs;
 
   numDirs = (this->ThreeGlyphs ? 3 : 1) * (this->Symmetric + 1);
 
-  // set up working matrices
-  m[0] = m0;
-  m[1] = m1;
-  m[2] = m2;
-  v[0] = v0;
-  v[1] = v1;
-  v[2] = v2;
-
   vtkDebugMacro(<< "Generating tensor glyphs");
 
   vtkPointData* outPD = output->GetPointData();
@@ -152,59 +204,50 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  pts = new vtkIdType[source->GetMaxCellSize()];
-  trans = vtkTransform::New();
-  matrix = vtkMatrix4x4::New();
-
   //
-  // Allocate storage for output PolyData
+  // Allocate storage for output PolyData. Every input point produces
+  // numDirs glyph copies of the source, so the output has a fixed stride
+  // per input point and can be generated in parallel.
   //
   sourcePts = source->GetPoints();
   numSourcePts = sourcePts->GetNumberOfPoints();
-  numSourceCells = source->GetNumberOfCells();
+  const vtkIdType totalPts = numDirs * numPts * numSourcePts;
 
   newPts = vtkPoints::New();
-  newPts->Allocate(numDirs * numPts * numSourcePts);
+  newPts->SetNumberOfPoints(totalPts);
 
-  // Setting up for calls to PolyData::InsertNextCell()
+  //
+  // First copy all topology (transformation independent), replicating the
+  // source connectivity in bulk for every glyph.
+  //
   if ((sourceCells = source->GetVerts())->GetNumberOfCells() > 0)
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetVerts(cells);
-    cells->Delete();
+    output->SetVerts(ReplicateSourceCells(sourceCells, numPts, numDirs, numSourcePts));
   }
   if ((sourceCells = this->GetSource()->GetLines())->GetNumberOfCells() > 0)
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetLines(cells);
-    cells->Delete();
+    output->SetLines(ReplicateSourceCells(sourceCells, numPts, numDirs, numSourcePts));
   }
   if ((sourceCells = this->GetSource()->GetPolys())->GetNumberOfCells() > 0)
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetPolys(cells);
-    cells->Delete();
+    output->SetPolys(ReplicateSourceCells(sourceCells, numPts, numDirs, numSourcePts));
   }
   if ((sourceCells = this->GetSource()->GetStrips())->GetNumberOfCells() > 0)
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetStrips(cells);
-    cells->Delete();
+    output->SetStrips(ReplicateSourceCells(sourceCells, numPts, numDirs, numSourcePts));
   }
+  this->UpdateProgress(0.25);
 
   // only copy scalar data through
   vtkPointData* pd = this->GetSource()->GetPointData();
+  ArrayList ptData;
   // generate scalars if eigenvalues are chosen or if scalars exist.
   if (this->ColorGlyphs &&
     ((this->ColorMode == COLOR_BY_EIGENVALUES) ||
       (inScalars && (this->ColorMode == COLOR_BY_SCALARS))))
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numDirs * numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(totalPts);
     if (this->ColorMode == COLOR_BY_EIGENVALUES)
     {
       newScalars->SetName("MaxEigenvalue");
@@ -218,254 +261,269 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
   {
     outPD->CopyAllOff();
     outPD->CopyScalarsOn();
-    outPD->CopyAllocate(pd, numDirs * numPts * numSourcePts);
+    outPD->CopyAllocate(pd, totalPts);
+    ptData.AddArrays(totalPts, pd, outPD);
   }
   if ((sourceNormals = pd->GetNormals()))
   {
     newNormals = vtkFloatArray::New();
     newNormals->SetNumberOfComponents(3);
     newNormals->SetName("Normals");
-    newNormals->Allocate(numDirs * 3 * numPts * numSourcePts);
+    newNormals->SetNumberOfTuples(totalPts);
   }
+
   //
-  // First copy all topology (transformation independent)
+  // Traverse all Input points in parallel, transforming glyph at Source
+  // points. Each thread keeps its own transform, matrix and scratch
+  // buffers; every input point writes a disjoint range of the output.
   //
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    ptIncr = numDirs * inPtId * numSourcePts;
-    for (cellId = 0; cellId < numSourceCells; cellId++)
+  vtkSMPThreadLocalObject<vtkTransform> tlTrans;
+  vtkSMPThreadLocalObject<vtkMatrix4x4> tlMatrix;
+  vtkSMPThreadLocalObject<vtkPoints> tlGlyphPts;
+  vtkSMPThreadLocalObject<vtkFloatArray> tlGlyphNormals;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType inPtId, vtkIdType endPtId) {
+    vtkTransform* trans = tlTrans.Local();
+    trans->PreMultiply();
+    vtkMatrix4x4* matrix = tlMatrix.Local();
+    vtkPoints* glyphPts = tlGlyphPts.Local();
+    vtkFloatArray* glyphNormals = nullptr;
+    if (newNormals)
     {
-      cell = this->GetSource()->GetCell(cellId);
-      cellPts = cell->GetPointIds();
-      npts = cellPts->GetNumberOfIds();
-      for (dir = 0; dir < numDirs; dir++)
-      {
-        // This variable may be removed, but that
-        // will not improve readability
-        subIncr = ptIncr + dir * numSourcePts;
-        for (i = 0; i < npts; i++)
-        {
-          pts[i] = cellPts->GetId(i) + subIncr;
-        }
-        output->InsertNextCell(cell->GetCellType(), npts, pts);
-      }
+      glyphNormals = tlGlyphNormals.Local();
+      glyphNormals->SetNumberOfComponents(3);
     }
-  }
-  //
-  // Traverse all Input points, transforming glyph at Source points
-  //
-  trans->PreMultiply();
-
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    ptIncr = numDirs * inPtId * numSourcePts;
-
-    // Translation is postponed
-    // Symmetric tensor support
-    inTensors->GetTuple(inPtId, tensor);
-    if (inTensors->GetNumberOfComponents() == 6)
+    double tensor[9];
+    double m0[3], m1[3], m2[3];
+    double v0[3], v1[3], v2[3];
+    double* m[3] = { m0, m1, m2 };
+    double* v[3] = { v0, v1, v2 };
+    double w[3], x[3], s, p[3], n[3];
+    double xv[3], yv[3], zv[3];
+    double maxScale;
+    vtkIdType i;
+    int j, dir, eigen_dir, symmetric_dir;
+
+    for (; inPtId < endPtId; inPtId++)
     {
-      vtkMath::TensorFromSymmetricTensor(tensor);
-    }
+      vtkIdType ptIncr = numDirs * inPtId * numSourcePts;
 
-    // compute orientation vectors and scale factors from tensor
-    if (this->ExtractEigenvalues) // extract appropriate eigenfunctions
-    {
-      // We are interested in the symmetrical part of the tensor only, since
-      // eigenvalues are real if and only if the matrice of reals is symmetrical
-      for (j = 0; j < 3; j++)
-      {
-        for (i = 0; i < 3; i++)
-        {
-          m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
-        }
-      }
-      vtkMath::Jacobi(m, w, v);
-
-      // copy eigenvectors
-      xv[0] = v[0][0];
-      xv[1] = v[1][0];
-      xv[2] = v[2][0];
-      yv[0] = v[0][1];
-      yv[1] = v[1][1];
-      yv[2] = v[2][1];
-      zv[0] = v[0][2];
-      zv[1] = v[1][2];
-      zv[2] = v[2][2];
-    }
-    else // use tensor columns as eigenvectors
-    {
-      for (i = 0; i < 3; i++)
+      // Translation is postponed
+      // Symmetric tensor support
+      inTensors->GetTuple(inPtId, tensor);
+      if (inTensors->GetNumberOfComponents() == 6)
       {
-        xv[i] = tensor[i];
-        yv[i] = tensor[i + 3];
-        zv[i] = tensor[i + 6];
+        vtkMath::TensorFromSymmetricTensor(tensor);
       }
-      w[0] = vtkMath::Normalize(xv);
-      w[1] = vtkMath::Normalize(yv);
-      w[2] = vtkMath::Normalize(zv);
-    }
 
-    // compute scale factors
-    w[0] *= this->ScaleFactor;
-    w[1] *= this->ScaleFactor;
-    w[2] *= this->ScaleFactor;
-
-    if (this->ClampScaling)
-    {
-      for (maxScale = 0.0, i = 0; i < 3; i++)
+      // compute orientation vectors and scale factors from tensor
+      if (this->ExtractEigenvalues) // extract appropriate eigenfunctions
       {
-        if (maxScale < fabs(w[i]))
+        // We are interested in the symmetrical part of the tensor only, since
+        // eigenvalues are real if and only if the matrice of reals is symmetrical
+        for (j = 0; j < 3; j++)
         {
-          maxScale = fabs(w[i]);
+          for (i = 0; i < 3; i++)
+          {
+            m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
+          }
         }
+        vtkMath::Jacobi(m, w, v);
+
+        // copy eigenvectors
+        xv[0] = v[0][0];
+        xv[1] = v[1][0];
+        xv[2] = v[2][0];
+        yv[0] = v[0][1];
+        yv[1] = v[1][1];
+        yv[2] = v[2][1];
+        zv[0] = v[0][2];
+        zv[1] = v[1][2];
+        zv[2] = v[2][2];
       }
-      if (maxScale > this->MaxScaleFactor)
+      else // use tensor columns as eigenvectors
       {
-        maxScale = this->MaxScaleFactor / maxScale;
         for (i = 0; i < 3; i++)
         {
-          w[i] *= maxScale; // preserve overall shape of glyph
+          xv[i] = tensor[i];
+          yv[i] = tensor[i + 3];
+          zv[i] = tensor[i + 6];
         }
+        w[0] = vtkMath::Normalize(xv);
+        w[1] = vtkMath::Normalize(yv);
+        w[2] = vtkMath::Normalize(zv);
       }
-    }
 
-    // normalization is postponed
+      // compute scale factors
+      w[0] *= this->ScaleFactor;
+      w[1] *= this->ScaleFactor;
+      w[2] *= this->ScaleFactor;
 
-    // make sure scale is okay (non-zero) and scale data
-    for (maxScale = 0.0, i = 0; i < 3; i++)
-    {
-      if (w[i] > maxScale)
+      if (this->ClampScaling)
       {
-        maxScale = w[i];
-      }
-    }
-    if (maxScale == 0.0)
-    {
-      maxScale = 1.0;
-    }
-    for (i = 0; i < 3; i++)
-    {
-      if (w[i] == 0.0)
-      {
-        w[i] = maxScale * 1.0e-06;
+        for (maxScale = 0.0, i = 0; i < 3; i++)
+        {
+          if (maxScale < fabs(w[i]))
+          {
+            maxScale = fabs(w[i]);
+          }
+        }
+        if (maxScale > this->MaxScaleFactor)
+        {
+          maxScale = this->MaxScaleFactor / maxScale;
+          for (i = 0; i < 3; i++)
+          {
+            w[i] *= maxScale; // preserve overall shape of glyph
+          }
+        }
       }
-    }
 
-    // Now do the real work for each "direction"
+      // normalization is postponed
 
-    for (dir = 0; dir < numDirs; dir++)
-    {
-      eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
-      symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
-
-      // Remove previous scales ...
-      trans->Identity();
-
-      // translate Source to Input point
-      input->GetPoint(inPtId, x);
-      trans->Translate(x[0], x[1], x[2]);
-
-      // normalized eigenvectors rotate object for eigen direction 0
-      matrix->Element[0][0] = xv[0];
-      matrix->Element[0][1] = yv[0];
-      matrix->Element[0][2] = zv[0];
-      matrix->Element[1][0] = xv[1];
-      matrix->Element[1][1] = yv[1];
-      matrix->Element[1][2] = zv[1];
-      matrix->Element[2][0] = xv[2];
-      matrix->Element[2][1] = yv[2];
-      matrix->Element[2][2] = zv[2];
-      trans->Concatenate(matrix);
-
-      if (eigen_dir == 1)
-      {
-        trans->RotateZ(90.0);
-      }
-
-      if (eigen_dir == 2)
+      // make sure scale is okay (non-zero) and scale data
+      for (maxScale = 0.0, i = 0; i < 3; i++)
       {
-        trans->RotateY(-90.0);
+        if (w[i] > maxScale)
+        {
+          maxScale = w[i];
+        }
       }
-
-      if (this->ThreeGlyphs)
+      if (maxScale == 0.0)
       {
-        trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        maxScale = 1.0;
       }
-      else
+      for (i = 0; i < 3; i++)
       {
-        trans->Scale(w[0], w[1], w[2]);
+        if (w[i] == 0.0)
+        {
+          w[i] = maxScale * 1.0e-06;
+        }
       }
 
-      // Mirror second set to the symmetric position
-      if (symmetric_dir == 1)
-      {
-        trans->Scale(-1., 1., 1.);
-      }
+      // Now do the real work for each "direction"
 
-      // if the eigenvalue is negative, shift to reverse direction.
-      // The && is there to ensure that we do not change the
-      // old behaviour of vtkTensorGlyphs (which only used one dir),
-      // in case there is an oriented glyph, e.g. an arrow.
-      if (w[eigen_dir] < 0 && numDirs > 1)
+      for (dir = 0; dir < numDirs; dir++)
       {
-        trans->Translate(-this->Length, 0., 0.);
-      }
+        eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
+        symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
+
+        // Remove previous scales ...
+        trans->Identity();
+
+        // translate Source to Input point
+        input->GetPoint(inPtId, x);
+        trans->Translate(x[0], x[1], x[2]);
+
+        // normalized eigenvectors rotate object for eigen direction 0
+        matrix->Element[0][0] = xv[0];
+        matrix->Element[0][1] = yv[0];
+        matrix->Element[0][2] = zv[0];
+        matrix->Element[1][0] = xv[1];
+        matrix->Element[1][1] = yv[1];
+        matrix->Element[1][2] = zv[1];
+        matrix->Element[2][0] = xv[2];
+        matrix->Element[2][1] = yv[2];
+        matrix->Element[2][2] = zv[2];
+        trans->Concatenate(matrix);
+
+        if (eigen_dir == 1)
+        {
+          trans->RotateZ(90.0);
+        }
+
+        if (eigen_dir == 2)
+        {
+          trans->RotateY(-90.0);
+        }
 
-      // multiply points (and normals if available) by resulting
-      // matrix
-      trans->TransformPoints(sourcePts, newPts);
+        if (this->ThreeGlyphs)
+        {
+          trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        }
+        else
+        {
+          trans->Scale(w[0], w[1], w[2]);
+        }
 
-      // Apply the transformation to a series of points,
-      // and append the results to outPts.
-      if (newNormals)
-      {
-        // a negative determinant means the transform turns the
-        // glyph surface inside out, and its surface normals all
-        // point inward. The following scale corrects the surface
-        // normals to point outward.
-        if (trans->GetMatrix()->Determinant() < 0)
+        // Mirror second set to the symmetric position
+        if (symmetric_dir == 1)
         {
-          trans->Scale(-1.0, -1.0, -1.0);
+          trans->Scale(-1., 1., 1.);
         }
-        trans->TransformNormals(sourceNormals, newNormals);
-      }
 
-      // Copy point data from source
-      if (this->ColorGlyphs && inScalars && (this->ColorMode == COLOR_BY_SCALARS))
-      {
-        s = inScalars->GetComponent(inPtId, 0);
-        for (i = 0; i < numSourcePts; i++)
+        // if the eigenvalue is negative, shift to reverse direction.
+        // The && is there to ensure that we do not change the
+        // old behaviour of vtkTensorGlyphs (which only used one dir),
+        // in case there is an oriented glyph, e.g. an arrow.
+        if (w[eigen_dir] < 0 && numDirs > 1)
         {
-          newScalars->InsertTuple(ptIncr + i, &s);
+          trans->Translate(-this->Length, 0., 0.);
         }
-      }
-      else if (this->ColorGlyphs && (this->ColorMode == COLOR_BY_EIGENVALUES))
-      {
-        // If ThreeGlyphs is false we use the first (largest)
-        // eigenvalue as scalar.
-        s = w[eigen_dir];
+
+        // multiply points (and normals if available) by resulting
+        // matrix. The transform appends to its output, so transform into
+        // a per-thread scratch buffer and bulk copy into this glyph's
+        // range of the output.
+        glyphPts->Reset();
+        trans->TransformPoints(sourcePts, glyphPts);
         for (i = 0; i < numSourcePts; i++)
         {
-          newScalars->InsertTuple(ptIncr + i, &s);
+          glyphPts->GetPoint(i, p);
+          newPts->SetPoint(ptIncr + i, p);
         }
-      }
-      else
-      {
-        for (i = 0; i < numSourcePts; i++)
+
+        if (newNormals)
         {
-          outPD->CopyData(pd, i, ptIncr + i);
+          // a negative determinant means the transform turns the
+          // glyph surface inside out, and its surface normals all
+          // point inward. The following scale corrects the surface
+          // normals to point outward.
+          if (trans->GetMatrix()->Determinant() < 0)
+          {
+            trans->Scale(-1.0, -1.0, -1.0);
+          }
+          glyphNormals->Reset();
+          trans->TransformNormals(sourceNormals, glyphNormals);
+          for (i = 0; i < numSourcePts; i++)
+          {
+            glyphNormals->GetTuple(i, n);
+            newNormals->SetTuple(ptIncr + i, n);
+          }
         }
+
+        // Copy point data from source
+        if (this->ColorGlyphs && inScalars && (this->ColorMode == COLOR_BY_SCALARS))
+        {
+          s = inScalars->GetComponent(inPtId, 0);
+          for (i = 0; i < numSourcePts; i++)
+          {
+            newScalars->SetTuple(ptIncr + i, &s);
+          }
+        }
+        else if (this->ColorGlyphs && (this->ColorMode == COLOR_BY_EIGENVALUES))
+        {
+          // If ThreeGlyphs is false we use the first (largest)
+          // eigenvalue as scalar.
+          s = w[eigen_dir];
+          for (i = 0; i < numSourcePts; i++)
+          {
+            newScalars->SetTuple(ptIncr + i, &s);
+          }
+        }
+        else
+        {
+          for (i = 0; i < numSourcePts; i++)
+          {
+            ptData.Copy(i, ptIncr + i);
+          }
+        }
+        ptIncr += numSourcePts;
       }
-      ptIncr += numSourcePts;
     }
-  }
+  });
   vtkDebugMacro(<< "Generated " << numPts << " tensor glyphs");
   //
   // Update output and release memory
   //
-  delete[] pts;
-
   output->SetPoints(newPts);
   newPts->Delete();
 
@@ -482,10 +540,6 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
     newNormals->Delete();
   }
 
-  output->Squeeze();
-  trans->Delete();
-  matrix->Delete();
-
   return 1;
 }
 
@@ -74,6 +74,11 @@
  * additional capability over the vtkGlyph3D object. That is, the
  * glyph can be oriented in three directions instead of one.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. The source topology is
+ * replicated in bulk, and the per-point eigen decomposition and glyph
+ * transformation run in parallel across the input points.
+ *
  * @par Thanks:
  * Thanks to Jose Paulo Moitinho de Almeida for enhancements.
  *
@@ -16,21 +16,30 @@
 #include "vtkThreshold.h"
 
 #include "vtkCell.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
+#include <vector>
 
 vtkStandardNewMacro(vtkThreshold);
 
@@ -140,6 +149,21 @@ int vtkThreshold::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
+  // are we using pointScalars?
+  int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
+  bool usePointScalars = fieldAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
+
+  // Unstructured grids without polyhedral cells take a threaded two-pass
+  // path that bulk-copies the extracted cells instead of inserting them one
+  // at a time.
+  vtkUnstructuredGrid* ugInput = vtkUnstructuredGrid::SafeDownCast(input);
+  if (ugInput && ugInput->GetCells() &&
+    !(ugInput->GetFaces() && ugInput->GetFaceLocations() &&
+      ugInput->GetFaceLocations()->GetRange(0)[1] != -1))
+  {
+    return this->ThresholdUnstructuredGrid(ugInput, output, inScalars, usePointScalars);
+  }
+
   outPD->CopyGlobalIdsOn();
   outPD->CopyAllocate(pd);
   outCD->CopyGlobalIdsOn();
@@ -184,10 +208,6 @@ int vtkThreshold::RequestData(vtkInformation* vtkNotUsed(request),
 
   vtkSmartPointer<vtkIdList> newCellPts = vtkSmartPointer<vtkIdList>::Take(vtkIdList::New());
 
-  // are we using pointScalars?
-  int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
-  bool usePointScalars = fieldAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
-
   vtkUnsignedCharArray* ghosts = input->GetCellData()->GetGhostArray();
 
   // Check that the scalars of each cell satisfy the threshold criterion
@@ -297,6 +317,245 @@ int vtkThreshold::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkThreshold::ThresholdUnstructuredGrid(vtkUnstructuredGrid* input,
+  vtkUnstructuredGrid* output, vtkDataArray* inScalars, bool usePointScalars)
+{
+  vtkPointData *pd = input->GetPointData(), *outPD = output->GetPointData();
+  vtkCellData *cd = input->GetCellData(), *outCD = output->GetCellData();
+
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  vtkCellArray* inCells = input->GetCells();
+  vtkUnsignedCharArray* inTypes = input->GetCellTypesArray();
+  vtkUnsignedCharArray* ghosts = cd->GetGhostArray();
+
+  // First pass: flag in parallel the cells satisfying the threshold
+  // criterion and record their connectivity length.
+  std::vector<unsigned char> keepCells(numCells);
+  std::vector<vtkIdType> cellSizes(numCells);
+  vtkSMPThreadLocal<vtkSmartPointer<vtkCellArrayIterator>> iterStorage;
+  vtkSMPThreadLocalObject<vtkIdList> tempIds; // for the continuous-range evaluation
+
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    auto& cellIter = iterStorage.Local();
+    if (cellIter.GetPointer() == nullptr)
+    {
+      cellIter.TakeReference(inCells->NewIterator());
+    }
+    vtkIdType npts;
+    const vtkIdType* cellPts;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      keepCells[cellId] = 0;
+      cellSizes[cellId] = 0;
+      if (ghosts && (ghosts->GetValue(cellId) & vtkDataSetAttributes::HIDDENCELL))
+      {
+        continue;
+      }
+      if (inTypes->GetValue(cellId) == VTK_EMPTY_CELL)
+      {
+        continue;
+      }
+      cellIter->GetCellAtId(cellId, npts, cellPts);
+
+      int keepCell(0);
+      if (usePointScalars)
+      {
+        if (this->AllScalars)
+        {
+          keepCell = 1;
+          for (vtkIdType i = 0; keepCell && (i < npts); i++)
+          {
+            keepCell = this->EvaluateComponents(inScalars, cellPts[i]);
+          }
+        }
+        else if (!this->UseContinuousCellRange)
+        {
+          for (vtkIdType i = 0; (!keepCell) && (i < npts); i++)
+          {
+            keepCell = this->EvaluateComponents(inScalars, cellPts[i]);
+          }
+        }
+        else
+        {
+          vtkIdList* ids = tempIds.Local();
+          ids->SetNumberOfIds(npts);
+          std::copy(cellPts, cellPts + npts, ids->GetPointer(0));
+          keepCell = this->EvaluateCell(inScalars, ids, static_cast<int>(npts));
+        }
+      }
+      else // use cell scalars
+      {
+        keepCell = this->EvaluateComponents(inScalars, cellId);
+      }
+
+      // Invert the keep flag if the Invert option is enabled.
+      keepCell = this->Invert ? (1 - keepCell) : keepCell;
+
+      if (npts > 0 && keepCell)
+      {
+        keepCells[cellId] = 1;
+        cellSizes[cellId] = npts;
+      }
+    }
+  });
+  this->UpdateProgress(0.25);
+
+  // Prefix sums sizing the output: destination cell id and connectivity
+  // offset for each kept cell.
+  std::vector<vtkIdType> cellDest(numCells);
+  std::vector<vtkIdType> connStart(numCells);
+  vtkIdType numOutCells = 0;
+  vtkIdType connSize = 0;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    cellDest[cellId] = numOutCells;
+    connStart[cellId] = connSize;
+    numOutCells += keepCells[cellId];
+    connSize += cellSizes[cellId];
+  }
+
+  // Second pass: flag the points used by the kept cells, then number them
+  // in input order.
+  std::vector<vtkIdType> pointMap(numPts, 0); // maps old point ids into new
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    auto& cellIter = iterStorage.Local();
+    if (cellIter.GetPointer() == nullptr)
+    {
+      cellIter.TakeReference(inCells->NewIterator());
+    }
+    vtkIdType npts;
+    const vtkIdType* cellPts;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      if (!keepCells[cellId])
+      {
+        continue;
+      }
+      cellIter->GetCellAtId(cellId, npts, cellPts);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        pointMap[cellPts[i]] = 1;
+      }
+    }
+  });
+
+  vtkIdType numOutPts = 0;
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    pointMap[ptId] = pointMap[ptId] ? numOutPts++ : -1;
+  }
+  this->UpdateProgress(0.5);
+
+  // Copy the kept points in parallel, honoring the requested precision.
+  vtkNew<vtkPoints> newPoints;
+  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+  {
+    newPoints->SetDataType(
+      input->GetPoints() ? input->GetPoints()->GetDataType() : VTK_FLOAT);
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+  {
+    newPoints->SetDataType(VTK_FLOAT);
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    newPoints->SetDataType(VTK_DOUBLE);
+  }
+  newPoints->SetNumberOfPoints(numOutPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      if (pointMap[ptId] >= 0)
+      {
+        input->GetPoint(ptId, x);
+        newPoints->SetPoint(pointMap[ptId], x);
+      }
+    }
+  });
+
+  // Bulk-copy the point and cell attributes of the kept elements.
+  vtkNew<vtkIdList> srcPtIds;
+  srcPtIds->Allocate(numOutPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    if (pointMap[ptId] >= 0)
+    {
+      srcPtIds->InsertNextId(ptId);
+    }
+  }
+  vtkNew<vtkIdList> dstPtIds;
+  dstPtIds->SetNumberOfIds(numOutPts);
+  std::iota(dstPtIds->GetPointer(0), dstPtIds->GetPointer(numOutPts), 0);
+  outPD->CopyGlobalIdsOn();
+  outPD->CopyAllocate(pd, numOutPts);
+  outPD->CopyData(pd, srcPtIds, dstPtIds);
+
+  vtkNew<vtkIdList> srcCellIds;
+  srcCellIds->Allocate(numOutCells);
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    if (keepCells[cellId])
+    {
+      srcCellIds->InsertNextId(cellId);
+    }
+  }
+  vtkNew<vtkIdList> dstCellIds;
+  dstCellIds->SetNumberOfIds(numOutCells);
+  std::iota(dstCellIds->GetPointer(0), dstCellIds->GetPointer(numOutCells), 0);
+  outCD->CopyGlobalIdsOn();
+  outCD->CopyAllocate(cd, numOutCells);
+  outCD->CopyData(cd, srcCellIds, dstCellIds);
+  this->UpdateProgress(0.75);
+
+  // Third pass: bulk-copy the mapped connectivity, offsets and cell types
+  // of the kept cells into preallocated arrays.
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numOutCells + 1);
+  offsets->SetValue(numOutCells, connSize);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connSize);
+  vtkNew<vtkUnsignedCharArray> newTypes;
+  newTypes->SetNumberOfValues(numOutCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    auto& cellIter = iterStorage.Local();
+    if (cellIter.GetPointer() == nullptr)
+    {
+      cellIter.TakeReference(inCells->NewIterator());
+    }
+    vtkIdType npts;
+    const vtkIdType* cellPts;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      if (!keepCells[cellId])
+      {
+        continue;
+      }
+      cellIter->GetCellAtId(cellId, npts, cellPts);
+      const vtkIdType dest = cellDest[cellId];
+      offsets->SetValue(dest, connStart[cellId]);
+      newTypes->SetValue(dest, inTypes->GetValue(cellId));
+      vtkIdType* conn = connectivity->GetPointer(connStart[cellId]);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        conn[i] = pointMap[cellPts[i]];
+      }
+    }
+  });
+
+  vtkNew<vtkCellArray> outCells;
+  outCells->SetData(offsets, connectivity);
+
+  vtkDebugMacro(<< "Extracted " << numOutCells << " number of cells.");
+
+  output->SetPoints(newPoints);
+  output->SetCells(newTypes, outCells);
+
+  return 1;
+}
+
 int vtkThreshold::EvaluateCell(vtkDataArray* scalars, vtkIdList* cellPts, int numCellPts)
 {
   int c(0);
@@ -51,6 +51,7 @@
 
 class vtkDataArray;
 class vtkIdList;
+class vtkUnstructuredGrid;
 
 class VTKFILTERSCORE_EXPORT vtkThreshold : public vtkUnstructuredGridAlgorithm
 {
@@ -241,6 +242,17 @@ protected:
   int EvaluateCell(vtkDataArray* scalars, vtkIdList* cellPts, int numCellPts);
   int EvaluateCell(vtkDataArray* scalars, int c, vtkIdList* cellPts, int numCellPts);
 
+  /**
+   * Threaded two-pass implementation used for vtkUnstructuredGrid inputs
+   * without polyhedral cells: a parallel pass flags the cells to keep, a
+   * prefix sum sizes the output, then the connectivity, cell types and
+   * points are bulk-copied in parallel into preallocated arrays that are
+   * handed to the output via vtkCellArray::SetData(). Other inputs go
+   * through the serial cell-by-cell path in RequestData().
+   */
+  int ThresholdUnstructuredGrid(vtkUnstructuredGrid* input, vtkUnstructuredGrid* output,
+    vtkDataArray* inScalars, bool usePointScalars);
+
 private:
   vtkThreshold(const vtkThreshold&) = delete;
   void operator=(const vtkThreshold&) = delete;
@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkTubeFilter.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkFloatArray.h"
@@ -24,8 +25,11 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolyLine.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
+#include <vector>
 
 vtkStandardNewMacro(vtkTubeFilter);
 
@@ -150,14 +154,11 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     newPts->SetDataType(VTK_DOUBLE);
   }
 
-  newPts->Allocate(numNewPts);
   newNormals = vtkFloatArray::New();
   newNormals->SetName("TubeNormals");
   newNormals->SetNumberOfComponents(3);
-  newNormals->Allocate(3 * numNewPts);
   newStrips = vtkCellArray::New();
   newStrips->AllocateEstimate(1, numNewPts);
-  vtkCellArray* singlePolyline = vtkCellArray::New();
 
   // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
   outPD->CopyNormalsOff();
@@ -167,10 +168,8 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   {
     newTCoords = vtkFloatArray::New();
     newTCoords->SetNumberOfComponents(2);
-    newTCoords->Allocate(numNewPts);
     outPD->CopyTCoordsOff();
   }
-  outPD->CopyAllocate(pd, numNewPts);
 
   int generateNormals = 0;
   if (!(inNormals = pd->GetNormals()) || this->UseDefaultNormal)
@@ -235,66 +234,157 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   //  triangle strips. Texture coordinates are optionally generated.
   //
   this->Theta = 2.0 * vtkMath::Pi() / this->NumberOfSides;
-  vtkPolyLine* lineNormalGenerator = vtkPolyLine::New();
+
+  // First pass: gather the polylines that can be tubed, remove their
+  // degenerate points, and prefix sum the number of output points each line
+  // produces. This gives every line a disjoint range of the output arrays
+  // so the lines can be processed in parallel.
+  struct TubeLine
+  {
+    vtkIdType Start;    // index of the first (deduplicated) point id in lineIds
+    vtkIdType NPts;     // number of (deduplicated) points
+    vtkIdType Offset;   // first output point id of this line's tube
+    vtkIdType InCellId; // input cell id, for cell data copying
+  };
+  std::vector<TubeLine> lines;
+  lines.reserve(numLines);
+  // Copies of the point indices to avoid modifying input polydata cells
+  // while removing degenerate points.
+  std::vector<vtkIdType> lineIds;
+  lineIds.reserve(numPts);
+
   // the line cellIds start after the last vert cellId
   inCellId = input->GetNumberOfVerts();
   for (inLines->InitTraversal(); inLines->GetNextCell(npts, ptsOrig) && !abort; inCellId++)
   {
-    this->UpdateProgress((double)inCellId / numLines);
     abort = this->GetAbortExecute();
 
-    // Make a copy of point indices to avoid modifying input polydata cells
-    // while removing degenerate lines.
     if (npts < 2)
     {
       continue; // skip tubing this polyline
     }
-    std::vector<vtkIdType> ptsCopy(ptsOrig, ptsOrig + npts);
-    vtkIdType* pts = ptsCopy.data();
+    size_t start = lineIds.size();
+    lineIds.insert(lineIds.end(), ptsOrig, ptsOrig + npts);
+    vtkIdType* pts = lineIds.data() + start;
 
     // remove degenerate lines to avoid warnings
     npts = static_cast<vtkIdType>(std::unique(pts, pts + npts, IdPointsEqual(inPts)) - pts);
+    lineIds.resize(start + npts);
     if (npts < 2)
     {
+      lineIds.resize(start);
       continue; // skip tubing this polyline
     }
 
-    // If necessary calculate normals, each polyline calculates its
-    // normals independently, avoiding conflicts at shared vertices.
-    if (generateNormals)
-    {
-      singlePolyline->Reset(); // avoid instantiation
-      singlePolyline->InsertNextCell(npts, pts);
-      vtkPolyLine::GenerateSlidingNormals(inPts, singlePolyline, inNormals);
-    }
-
-    // Generate the points around the polyline. The tube is not stripped
-    // if the polyline is bad.
-    //
-    if (!this->GeneratePoints(offset, npts, pts, inPts, newPts, pd, outPD, newNormals, inScalars,
-          range, inVectors, maxSpeed, inNormals))
-    {
-      vtkWarningMacro(<< "Could not generate points!");
-      continue; // skip tubing this polyline
-    }
-
-    // Generate the strips for this polyline (including caps)
-    //
-    this->GenerateStrips(offset, npts, pts, inCellId, cd, outCD, newStrips);
-
-    // Generate the texture coordinates for this polyline
-    //
-    if (newTCoords)
-    {
-      this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
-    }
+    lines.push_back({ static_cast<vtkIdType>(start), npts, offset, inCellId });
 
     // Compute the new offset for the next polyline
     offset = this->ComputeOffset(offset, npts);
-
   } // for all polylines
+  const vtkIdType totalNewPts = offset;
+  const vtkIdType numTubedLines = static_cast<vtkIdType>(lines.size());
+
+  // Size the output point-centered arrays exactly; the threads write
+  // directly into disjoint ranges of them.
+  newPts->SetNumberOfPoints(totalNewPts);
+  newNormals->SetNumberOfTuples(totalNewPts);
+  if (newTCoords)
+  {
+    newTCoords->SetNumberOfTuples(totalNewPts);
+  }
+  outPD->CopyAllocate(pd, totalNewPts);
+  ArrayList ptData;
+  ptData.AddArrays(totalNewPts, pd, outPD);
+  this->UpdateProgress(0.1);
+
+  // Second pass: generate the points, normals and texture coordinates of
+  // the tubes in parallel across the polylines. When sliding normals must
+  // be computed, each thread computes them into its own scratch array since
+  // polylines may share vertices. Lines whose geometry cannot be computed
+  // (e.g. a normal parallel to the line direction) are flagged so that no
+  // strips are generated for them.
+  vtkSMPThreadLocalObject<vtkFloatArray> tlNormals;
+  vtkSMPThreadLocalObject<vtkCellArray> tlPolyline;
+  std::vector<unsigned char> lineValid(numTubedLines, 1);
+  vtkSMPTools::For(0, numTubedLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    vtkFloatArray* localNormals = tlNormals.Local();
+    vtkCellArray* singlePolyline = tlPolyline.Local();
+    for (; lineId < endLineId; lineId++)
+    {
+      const TubeLine& line = lines[lineId];
+      const vtkIdType* pts = lineIds.data() + line.Start;
+
+      // If necessary calculate normals, each polyline calculates its
+      // normals independently, avoiding conflicts at shared vertices.
+      vtkDataArray* normals = inNormals;
+      if (generateNormals)
+      {
+        if (localNormals->GetNumberOfTuples() != numPts)
+        {
+          localNormals->SetNumberOfComponents(3);
+          localNormals->SetNumberOfTuples(numPts);
+        }
+        singlePolyline->Reset(); // avoid instantiation
+        singlePolyline->InsertNextCell(line.NPts, pts);
+        vtkPolyLine::GenerateSlidingNormals(inPts, singlePolyline, localNormals);
+        normals = localNormals;
+      }
 
-  singlePolyline->Delete();
+      // Generate the points around the polyline. The tube is not stripped
+      // if the polyline is bad.
+      //
+      if (!this->GeneratePoints(line.Offset, line.NPts, pts, inPts, newPts, ptData, newNormals,
+            inScalars, range, inVectors, maxSpeed, normals))
+      {
+        // Keep the output arrays well defined by collapsing this line's
+        // range onto its first point; no strips will reference it.
+        lineValid[lineId] = 0;
+        double px[3];
+        inPts->GetPoint(pts[0], px);
+        const vtkIdType nextOffset = this->ComputeOffset(line.Offset, line.NPts);
+        for (vtkIdType id = line.Offset; id < nextOffset; id++)
+        {
+          newPts->SetPoint(id, px);
+          newNormals->SetTuple(id, this->DefaultNormal);
+          ptData.Copy(pts[0], id);
+          if (newTCoords)
+          {
+            newTCoords->SetTuple2(id, 0.0, 0.0);
+          }
+        }
+        continue;
+      }
+
+      // Generate the texture coordinates for this polyline
+      //
+      if (newTCoords)
+      {
+        this->GenerateTextureCoords(line.Offset, line.NPts, pts, inPts, inScalars, newTCoords);
+      }
+    }
+  });
+  this->UpdateProgress(0.75);
+
+  // Third pass: generate the strips (including caps) and copy the cell
+  // data. Cell array insertion grows the connectivity incrementally, so
+  // this pass remains serial.
+  vtkIdType numBadLines = 0;
+  for (vtkIdType lineId = 0; lineId < numTubedLines && !abort; lineId++)
+  {
+    abort = this->GetAbortExecute();
+    if (!lineValid[lineId])
+    {
+      numBadLines++;
+      continue; // skip tubing this polyline
+    }
+    const TubeLine& line = lines[lineId];
+    this->GenerateStrips(
+      line.Offset, line.NPts, lineIds.data() + line.Start, line.InCellId, cd, outCD, newStrips);
+  }
+  if (numBadLines > 0)
+  {
+    vtkWarningMacro(<< "Could not generate points for " << numBadLines << " line(s)!");
+  }
 
   // reset the radius to ite original value if necessary
   if (this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
@@ -323,7 +413,6 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   outPD->SetNormals(newNormals);
   newNormals->Delete();
-  lineNormalGenerator->Delete();
 
   output->Squeeze();
 
@@ -331,9 +420,9 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 }
 
 int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
-  vtkPoints* inPts, vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD,
-  vtkFloatArray* newNormals, vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors,
-  double maxSpeed, vtkDataArray* inNormals)
+  vtkPoints* inPts, vtkPoints* newPts, ArrayList& ptData, vtkFloatArray* newNormals,
+  vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
+  vtkDataArray* inNormals)
 {
   vtkIdType j;
   int i, k;
@@ -396,7 +485,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
 
     if (vtkMath::Normalize(sNext) == 0.0)
     {
-      vtkWarningMacro(<< "Coincident points!");
+      // coincident points; the caller reports failed lines
       return 0;
     }
 
@@ -434,8 +523,8 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     vtkMath::Cross(s, n, w);
     if (vtkMath::Normalize(w) == 0.0)
     {
-      vtkWarningMacro(<< "Bad normal s = " << s[0] << " " << s[1] << " " << s[2] << " n = " << n[0]
-                      << " " << n[1] << " " << n[2]);
+      // bad normal, parallel to the line direction; the caller reports
+      // failed lines
       return 0;
     }
 
@@ -451,7 +540,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     }
     else if (inVectors && this->VaryRadius == VTK_VARY_RADIUS_BY_VECTOR)
     {
-      sFactor = sqrt((double)maxSpeed / vtkMath::Norm(inVectors->GetTuple(pts[j])));
+      double vector[3];
+      inVectors->GetTuple(pts[j], vector);
+      sFactor = sqrt((double)maxSpeed / vtkMath::Norm(vector));
       if (sFactor > this->RadiusFactor)
       {
         sFactor = this->RadiusFactor;
@@ -459,15 +550,16 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     }
     else if (inVectors && this->VaryRadius == VTK_VARY_RADIUS_BY_VECTOR_NORM)
     {
-      sFactor =
-        1.0 + (this->RadiusFactor - 1.0) * vtkMath::Norm(inVectors->GetTuple(pts[j])) / maxSpeed;
+      double vector[3];
+      inVectors->GetTuple(pts[j], vector);
+      sFactor = 1.0 + (this->RadiusFactor - 1.0) * vtkMath::Norm(vector) / maxSpeed;
     }
     else if (inScalars && this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
     {
       sFactor = inScalars->GetComponent(pts[j], 0);
       if (sFactor < 0.0)
       {
-        vtkWarningMacro(<< "Scalar value less than zero, skipping line");
+        // scalar value less than zero; the caller reports failed lines
         return 0;
       }
     }
@@ -484,7 +576,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
         }
         newPts->InsertPoint(ptId, s);
         newNormals->InsertTuple(ptId, normal);
-        outPD->CopyData(pd, pts[j], ptId);
+        ptData.Copy(pts[j], ptId);
         ptId++;
       } // for each side
     }
@@ -511,10 +603,10 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
         }
         newPts->InsertPoint(ptId, s);
         newNormals->InsertTuple(ptId, n_right);
-        outPD->CopyData(pd, pts[j], ptId);
+        ptData.Copy(pts[j], ptId);
         newPts->InsertPoint(ptId + 1, s);
         newNormals->InsertTuple(ptId + 1, n_left);
-        outPD->CopyData(pd, pts[j], ptId + 1);
+        ptData.Copy(pts[j], ptId + 1);
         ptId += 2;
       } // for each side
     }   // else separate vertices
@@ -537,7 +629,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
       newPts->GetPoint(offset + k, s);
       newPts->InsertPoint(ptId, s);
       newNormals->InsertTuple(ptId, startCapNorm);
-      outPD->CopyData(pd, pts[0], ptId);
+      ptData.Copy(pts[0], ptId);
       ptId++;
     }
     // the end cap
@@ -551,7 +643,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
       newPts->GetPoint(endOffset + k, s);
       newPts->InsertPoint(ptId, s);
       newNormals->InsertTuple(ptId, endCapNorm);
-      outPD->CopyData(pd, pts[npts - 1], ptId);
+      ptData.Copy(pts[npts - 1], ptId);
       ptId++;
     }
   } // if capping
@@ -673,10 +765,10 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
   double s0, s;
   if (this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS)
   {
-    s0 = inScalars->GetTuple1(pts[0]);
+    s0 = inScalars->GetComponent(pts[0], 0);
     for (i = 0; i < npts; i++)
     {
-      s = inScalars->GetTuple1(pts[i]);
+      s = inScalars->GetComponent(pts[i], 0);
       tc = (s - s0) / this->TextureLength;
       for (k = 0; k < numSides; k++)
       {
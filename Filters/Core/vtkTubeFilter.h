@@ -45,6 +45,11 @@
  * can be removed with vtkCleanPolyData.) If a line does not meet this
  * criteria, then that line is not tubed.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. The points, normals, and
+ * texture coordinates of the tubes are generated in parallel across the
+ * input polylines.
+ *
  * @sa
  * vtkRibbonFilter vtkStreamTracer vtkTubeBender
  *
@@ -75,6 +80,7 @@ class vtkDataArray;
 class vtkFloatArray;
 class vtkPointData;
 class vtkPoints;
+struct ArrayList; // for threaded point data copying, see vtkArrayListTemplate.h
 
 class VTKFILTERSCORE_EXPORT vtkTubeFilter : public vtkPolyDataAlgorithm
 {
@@ -252,11 +258,12 @@ protected:
   int OutputPointsPrecision;
   double TextureLength; // this length is mapped to [0,1) texture space
 
-  // Helper methods
+  // Helper methods. GeneratePoints() may run concurrently on different
+  // polylines, each writing into a disjoint, preallocated range of the
+  // output arrays starting at offset.
   int GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkPoints* inPts,
-    vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD, vtkFloatArray* newNormals,
-    vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
-    vtkDataArray* inNormals);
+    vtkPoints* newPts, ArrayList& ptData, vtkFloatArray* newNormals, vtkDataArray* inScalars,
+    double range[2], vtkDataArray* inVectors, double maxSpeed, vtkDataArray* inNormals);
   void GenerateStrips(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkIdType inCellId,
     vtkCellData* cd, vtkCellData* outCD, vtkCellArray* newStrips);
   void GenerateTextureCoords(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
@@ -14,8 +14,10 @@
 =========================================================================*/
 #include "vtkExtractSelection.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkBlockSelector.h"
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObjectTree.h"
@@ -40,6 +42,7 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtkValueSelector.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <numeric>
@@ -158,6 +161,55 @@ vtkDataObject::AttributeTypes vtkExtractSelection::GetAttributeTypeOfSelection(
 
 namespace
 {
+//----------------------------------------------------------------------------
+// Compact the element ids flagged in the insidedness array into a flat id
+// vector using a chunked, prefix-summed parallel sweep: per-chunk counts are
+// gathered in parallel, a serial scan converts them to write offsets, and a
+// second parallel pass emits the ids in order.
+std::vector<vtkIdType> CompactSelectedIds(vtkSignedCharArray* inside, vtkIdType numElements)
+{
+  const signed char* flags = inside->GetPointer(0);
+  constexpr vtkIdType chunkSize = 4096;
+  const vtkIdType numChunks = (numElements + chunkSize - 1) / chunkSize;
+
+  std::vector<vtkIdType> chunkOffsets(numChunks + 1, 0);
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+    for (; chunk < endChunk; ++chunk)
+    {
+      const vtkIdType end = std::min(numElements, (chunk + 1) * chunkSize);
+      vtkIdType count = 0;
+      for (vtkIdType cc = chunk * chunkSize; cc < end; ++cc)
+      {
+        count += (flags[cc] != 0) ? 1 : 0;
+      }
+      chunkOffsets[chunk + 1] = count;
+    }
+  });
+
+  for (vtkIdType chunk = 0; chunk < numChunks; ++chunk)
+  {
+    chunkOffsets[chunk + 1] += chunkOffsets[chunk];
+  }
+
+  std::vector<vtkIdType> ids(chunkOffsets[numChunks]);
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+    for (; chunk < endChunk; ++chunk)
+    {
+      const vtkIdType end = std::min(numElements, (chunk + 1) * chunkSize);
+      vtkIdType offset = chunkOffsets[chunk];
+      for (vtkIdType cc = chunk * chunkSize; cc < end; ++cc)
+      {
+        if (flags[cc] != 0)
+        {
+          ids[offset++] = cc;
+        }
+      }
+    }
+  });
+
+  return ids;
+}
+
 //----------------------------------------------------------------------------
 void InvertSelection(vtkSignedCharArray* array)
 {
@@ -546,15 +598,7 @@ void vtkExtractSelection::ExtractSelectedCells(
   else
   {
     // convert insideness array to cell ids to extract.
-    std::vector<vtkIdType> ids;
-    ids.reserve(numCells);
-    for (vtkIdType cc = 0; cc < numCells; ++cc)
-    {
-      if (cellInside->GetValue(cc) != 0)
-      {
-        ids.push_back(cc);
-      }
-    }
+    std::vector<vtkIdType> ids = ::CompactSelectedIds(cellInside, numCells);
     extractor->SetAssumeSortedAndUniqueIds(true);
     extractor->SetCellIds(&ids.front(), static_cast<vtkIdType>(ids.size()));
   }
@@ -579,6 +623,11 @@ void vtkExtractSelection::ExtractSelectedPoints(
   vtkPointData* pd = input->GetPointData();
   vtkPointData* outputPD = output->GetPointData();
 
+  // Compact the flagged points into an ordered list of original point ids
+  // with a prefix-summed parallel sweep.
+  std::vector<vtkIdType> ids = ::CompactSelectedIds(pointInside, numPts);
+  const vtkIdType numNewPts = static_cast<vtkIdType>(ids.size());
+
   // To copy points in a type agnostic way later
   auto pointSet = vtkPointSet::SafeDownCast(input);
 
@@ -587,53 +636,45 @@ void vtkExtractSelection::ExtractSelectedPoints(
   {
     newPts->SetDataType(pointSet->GetPoints()->GetDataType());
   }
-  newPts->Allocate(numPts / 4, numPts);
-
-  vtkNew<vtkIdList> newCellPts;
-  newCellPts->Allocate(VTK_CELL_SIZE);
+  newPts->SetNumberOfPoints(numNewPts);
 
   outputPD->SetCopyGlobalIds(1);
   outputPD->CopyFieldOff("vtkOriginalPointIds");
-  outputPD->CopyAllocate(pd);
-
-  double x[3];
+  outputPD->CopyAllocate(pd, numNewPts);
+  ArrayList arrays;
+  arrays.AddArrays(numNewPts, pd, outputPD);
 
   vtkNew<vtkIdTypeArray> originalPointIds;
   originalPointIds->SetNumberOfComponents(1);
   originalPointIds->SetName("vtkOriginalPointIds");
-  outputPD->AddArray(originalPointIds);
-
-  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
-  {
-    signed char isInside;
-    assert(ptId < pointInside->GetNumberOfValues());
-    pointInside->GetTypedTuple(ptId, &isInside);
-    if (isInside)
+  originalPointIds->SetNumberOfTuples(numNewPts);
+  vtkIdType* origIds = originalPointIds->GetPointer(0);
+
+  // Copy point coordinates, attribute data, and original ids with bulk
+  // threaded sweeps into the exact-sized output.
+  vtkSMPTools::For(0, numNewPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3];
+    for (; ptId < endPtId; ++ptId)
     {
-      vtkIdType newPointId = -1;
-      if (pointSet)
-      {
-        newPointId = newPts->GetNumberOfPoints();
-        newPts->InsertPoints(newPointId, 1, ptId, pointSet->GetPoints());
-      }
-      else
-      {
-        input->GetPoint(ptId, x);
-        newPointId = newPts->InsertNextPoint(x);
-      }
-      assert(newPointId >= 0);
-      outputPD->CopyData(pd, ptId, newPointId);
-      originalPointIds->InsertNextValue(ptId);
+      const vtkIdType inPtId = ids[ptId];
+      input->GetPoint(inPtId, x);
+      newPts->SetPoint(ptId, x);
+      arrays.Copy(inPtId, ptId);
+      origIds[ptId] = inPtId;
     }
-  }
+  });
+  outputPD->AddArray(originalPointIds);
 
   // produce a new vtk_vertex cell for each accepted point
-  for (vtkIdType ptId = 0; ptId < newPts->GetNumberOfPoints(); ++ptId)
-  {
-    newCellPts->Reset();
-    newCellPts->InsertId(0, ptId);
-    output->InsertNextCell(VTK_VERTEX, newCellPts);
-  }
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numNewPts + 1);
+  std::iota(offsets->GetPointer(0), offsets->GetPointer(0) + numNewPts + 1, 0);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(numNewPts);
+  std::iota(connectivity->GetPointer(0), connectivity->GetPointer(0) + numNewPts, 0);
+  vtkNew<vtkCellArray> verts;
+  verts->SetData(offsets, connectivity);
+  output->SetCells(VTK_VERTEX, verts);
   output->SetPoints(newPts);
 }
 
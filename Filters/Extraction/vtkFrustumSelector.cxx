@@ -83,8 +83,13 @@ public:
     // Hacky PrepareForMultithreadedAccess()
     // call everything we will call on the data object on the main thread first
     // so that it can build its caching structures
-    vtkNew<vtkGenericCell> cell;
-    this->Input->GetCell(0, cell);
+    if (this->Input && this->Input->GetNumberOfCells() > 0)
+    {
+      vtkNew<vtkGenericCell> cell;
+      this->Input->GetCell(0, cell);
+      double bounds[6];
+      this->Input->GetCellBounds(0, bounds);
+    }
 
     vtkIdType i;
     double x[3];
@@ -109,9 +114,27 @@ public:
 
     for (vtkIdType cellId = begin; cellId < end; ++cellId)
     {
-      this->Input->GetCell(cellId, cell);
-      cell->GetBounds(bounds);
-      int isect = this->ABoxFrustumIsect(bounds, cell);
+      // Coarse pass: classify the cell bounds against the frustum without
+      // extracting the cell geometry. GetCellBounds() has fast
+      // implementations for the common dataset types, so the cell only has
+      // to be built for cells whose bounds straddle the frustum boundary
+      // (or are degenerate) and require the exact clipping tests.
+      this->Input->GetCellBounds(cellId, bounds);
+      int isect;
+      if (bounds[0] > bounds[1] || bounds[2] > bounds[3] || bounds[4] > bounds[5])
+      {
+        this->Input->GetCell(cellId, cell);
+        isect = this->IsectDegenerateCell(cell);
+      }
+      else
+      {
+        isect = this->FrustumBoundsTest(bounds);
+        if (isect < 0)
+        {
+          this->Input->GetCell(cellId, cell);
+          isect = this->FrustumClipCell(bounds, cell);
+        }
+      }
       if (isect == 1)
       {
         this->Array->SetValue(cellId, 1);
@@ -133,7 +156,21 @@ public:
     {
       return this->IsectDegenerateCell(cell);
     }
+    int result = this->FrustumBoundsTest(bounds);
+    if (result >= 0)
+    {
+      return result;
+    }
+    return this->FrustumClipCell(bounds, cell);
+  }
 
+  //--------------------------------------------------------------------------
+  // Coarse test of a (non-degenerate) bounding box against the frustum
+  // planes. Returns 0 when the box is entirely outside, 1 when it is
+  // entirely inside, and -1 when the box straddles the frustum boundary
+  // and exact clipping tests against the cell geometry are required.
+  int FrustumBoundsTest(double* bounds)
+  {
     // convert bounds to 8 vertices
     double verts[8][3];
     verts[0][0] = bounds[0];
@@ -161,8 +198,6 @@ public:
     verts[7][1] = bounds[3];
     verts[7][2] = bounds[5];
 
-    int intersect = 0;
-
     // reject if any plane rejects the entire bbox
     auto& plane = this->TLPlane.Local();
     for (int pid = 0; pid < MAXPLANE; pid++)
@@ -181,18 +216,20 @@ public:
       dist = plane->EvaluateFunction(verts[pvid]);
       if (dist > 0.0)
       {
-        intersect = 1;
-        break;
+        return -1;
       }
     }
 
-    // accept if entire bbox is inside all planes
-    if (!intersect)
-    {
-      return 1;
-    }
+    // accept: the entire bbox is inside all planes
+    return 1;
+  }
 
-    // otherwise, we have to do clipping tests to decide if actually insects
+  //--------------------------------------------------------------------------
+  // The bounding box straddles the frustum boundary, so we have to do
+  // clipping tests against the cell geometry to decide if it actually
+  // intersects.
+  int FrustumClipCell(double* bounds, vtkCell* cell)
+  {
     vtkCell* face;
     vtkCell* edge;
     vtkPoints* pts = nullptr;
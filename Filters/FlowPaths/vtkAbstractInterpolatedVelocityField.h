@@ -255,6 +255,17 @@ public:
   int GetLastLocalCoordinates(double pcoords[3]);
   ///@}
 
+  /**
+   * Get the cell cached from the last evaluation, or nullptr if the cache is
+   * not valid. The returned cell is owned by the velocity field and is only
+   * valid until the next evaluation; callers such as vtkStreamTracer use it
+   * to avoid re-extracting the cell from the dataset at every step.
+   */
+  vtkGenericCell* GetLastCell()
+  {
+    return (this->LastCellId != -1) ? this->CurrentCell.Get() : nullptr;
+  }
+
   ///@{
   /**
    * Set / get the strategy used to perform the FindCell() operation. This
@@ -365,10 +376,6 @@ protected:
   bool InterpolatePoint(vtkPointData* outPD, vtkIdType outIndex);
   bool InterpolatePoint(
     vtkAbstractInterpolatedVelocityField* inIVF, vtkPointData* outPD, vtkIdType outIndex);
-  vtkGenericCell* GetLastCell()
-  {
-    return (this->LastCellId != -1) ? this->CurrentCell.Get() : nullptr;
-  }
   ///@}
 
   ///@{
@@ -1068,8 +1068,15 @@ struct TracerIntegrator
       input = func->GetLastDataSet();
       inputPD = input->GetPointData();
       inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
-      // Convert intervals to arc-length unit
-      input->GetCell(func->GetLastCellId(), cell);
+      // Convert intervals to arc-length unit. Reuse the cell cached by the
+      // velocity field during the last evaluation instead of re-extracting
+      // it from the dataset.
+      cell = func->GetLastCell();
+      if (cell == nullptr)
+      {
+        cell = localOutput.Cell;
+        input->GetCell(func->GetLastCellId(), cell);
+      }
       cellLength = std::sqrt(static_cast<double>(cell->GetLength2()));
       speed = vtkMath::Norm(velocity);
       // Never call conversion methods if speed == 0
@@ -1232,13 +1239,26 @@ struct TracerIntegrator
         // Calculate propagation (using the same units as MaximumPropagation
         propagation += std::abs(stepSize.Interval);
 
-        // Make sure we use the dataset found by the vtkAbstractInterpolatedVelocityField
-        input = func->GetLastDataSet();
-        inputPD = input->GetPointData();
-        inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
+        // Make sure we use the dataset found by the
+        // vtkAbstractInterpolatedVelocityField. The by-name array lookup is
+        // only refreshed when the streamline crosses into another dataset of
+        // a composite input.
+        if (input != func->GetLastDataSet())
+        {
+          input = func->GetLastDataSet();
+          inputPD = input->GetPointData();
+          inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
+        }
 
-        // Calculate cell length and speed to be used in unit conversions
-        input->GetCell(func->GetLastCellId(), cell);
+        // Calculate cell length and speed to be used in unit conversions.
+        // As above, the cell cached by the velocity field is reused rather
+        // than rebuilt from the dataset at every step.
+        cell = func->GetLastCell();
+        if (cell == nullptr)
+        {
+          cell = localOutput.Cell;
+          input->GetCell(func->GetLastCellId(), cell);
+        }
         cellLength = std::sqrt(static_cast<double>(cell->GetLength2()));
         speed = speed2;
 
@@ -33,6 +33,7 @@
 #include "vtkPlane.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -43,6 +44,37 @@
 vtkStandardNewMacro(vtkClipDataSet);
 vtkCxxSetObjectMacro(vtkClipDataSet, ClipFunction, vtkImplicitFunction);
 
+namespace
+{
+
+// Threaded evaluation of the clip function over the input points.
+struct vtkClipDataSetEvaluateClipScalars
+{
+  vtkDataSet* Input;
+  vtkImplicitFunction* Function;
+  float* Scalars;
+
+  vtkClipDataSetEvaluateClipScalars(vtkDataSet* input, vtkImplicitFunction* func, float* scalars)
+    : Input(input)
+    , Function(func)
+    , Scalars(scalars)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3];
+    float* s = this->Scalars + ptId;
+    for (; ptId < endPtId; ++ptId)
+    {
+      this->Input->GetPoint(ptId, x);
+      *s++ = this->Function->FunctionValue(x);
+    }
+  }
+};
+
+} // end anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct with user-specified implicit function; InsideOut turned off; value
 // set to 0.0; and generate clip scalars turned off.
@@ -306,11 +338,9 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     {
       inPD->SetScalars(tmpScalars);
     }
-    for (i = 0; i < numPts; i++)
-    {
-      s = this->ClipFunction->FunctionValue(input->GetPoint(i));
-      tmpScalars->SetTuple1(i, s);
-    }
+    vtkClipDataSetEvaluateClipScalars evaluate(
+      input, this->ClipFunction, tmpScalars->GetPointer(0));
+    vtkSMPTools::For(0, numPts, evaluate);
     clipScalars = tmpScalars;
   }
   else // using input scalars
@@ -14,22 +14,31 @@
 =========================================================================*/
 #include "vtkDataSetTriangleFilter.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellType.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOrderedTriangulator.h"
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkStructuredPoints.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkDataSetTriangleFilter);
 
 vtkDataSetTriangleFilter::vtkDataSetTriangleFilter()
@@ -206,18 +215,8 @@ void vtkDataSetTriangleFilter::UnstructuredExecute(
 {
   vtkPointSet* input = static_cast<vtkPointSet*>(dataSetInput); // has to be
   vtkIdType numCells = input->GetNumberOfCells();
-  vtkGenericCell* cell;
-  vtkIdType newCellId, j;
-  int k;
   vtkCellData* inCD = input->GetCellData();
   vtkCellData* outCD = output->GetCellData();
-  vtkPoints* cellPts;
-  vtkIdList* cellPtIds;
-  vtkIdType ptId, numTets, ncells;
-  int numPts, type;
-  int numSimplices, dim;
-  vtkIdType pts[4];
-  double x[3];
 
   if (numCells == 0)
   {
@@ -261,143 +260,179 @@ void vtkDataSetTriangleFilter::UnstructuredExecute(
     }
   }
 
-  cell = vtkGenericCell::New();
-  cellPts = vtkPoints::New();
-  cellPtIds = vtkIdList::New();
-
   // Create an array of points
   vtkCellData* tempCD = vtkCellData::New();
   tempCD->ShallowCopy(inCD);
   tempCD->SetActiveGlobalIds(nullptr);
 
-  outCD->CopyAllocate(tempCD, input->GetNumberOfCells() * 5);
-  output->Allocate(input->GetNumberOfCells() * 5);
-
   // Points are passed through
   output->SetPoints(input->GetPoints());
   output->GetPointData()->PassData(input->GetPointData());
 
-  int abort = 0;
-  vtkIdType updateTime = numCells / 20 + 1; // update roughly every 5%
-  for (vtkIdType cellId = 0; cellId < numCells && !abort; cellId++)
+  // Make sure the input's internal structures are built up front so that
+  // concurrent GetCell() invocations only read them.
+  vtkNew<vtkGenericCell> firstCell;
+  input->GetCell(0, firstCell);
+
+  // First pass: triangulate the cells in parallel, storing the simplices of
+  // each cell separately. 3D cells go through a per-thread ordered
+  // triangulator whose templates provide the static subdivision tables for
+  // the primary (convex) cells; polyhedra and lower dimensional cells
+  // triangulate themselves.
+  struct CellSimplices
   {
-    if (!(cellId % updateTime))
+    std::vector<vtkIdType> Conn; // numSimplices * (Dim + 1) point ids
+    int Dim = 0;                 // topological dimension of the simplices
+  };
+  std::vector<CellSimplices> simplices(numCells);
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocalObject<vtkOrderedTriangulator> tlTriangulator;
+  vtkSMPThreadLocalObject<vtkCellArray> tlTets;
+  vtkSMPThreadLocalObject<vtkPoints> tlCellPts;
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPtIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkGenericCell* cell = tlCell.Local();
+    vtkOrderedTriangulator* triangulator = tlTriangulator.Local();
+    triangulator->PreSortedOff();
+    triangulator->UseTemplatesOn();
+    vtkCellArray* tets = tlTets.Local();
+    vtkPoints* cellPts = tlCellPts.Local();
+    vtkIdList* cellPtIds = tlCellPtIds.Local();
+    vtkIdType j, ptId;
+    double x[3];
+
+    for (; cellId < endCellId; cellId++)
     {
-      this->UpdateProgress(static_cast<double>(cellId) / numCells);
-      abort = this->GetAbortExecute();
-    }
+      CellSimplices& result = simplices[cellId];
+      input->GetCell(cellId, cell);
+      int dim = cell->GetCellDimension();
 
-    input->GetCell(cellId, cell);
-    dim = cell->GetCellDimension();
-
-    if (cell->GetCellType() == VTK_POLYHEDRON) // polyhedron
-    {
-      dim = 4;
-      cell->Triangulate(0, cellPtIds, cellPts);
-      numPts = cellPtIds->GetNumberOfIds();
-
-      numSimplices = numPts / dim;
-      type = VTK_TETRA;
-
-      for (j = 0; j < numSimplices; j++)
+      if (cell->GetCellType() == VTK_POLYHEDRON) // polyhedron
       {
-        for (k = 0; k < dim; k++)
-        {
-          pts[k] = cellPtIds->GetId(dim * j + k);
-        }
-        // copy cell data
-        newCellId = output->InsertNextCell(type, dim, pts);
-        outCD->CopyData(tempCD, cellId, newCellId);
+        result.Dim = 3;
+        cell->Triangulate(0, cellPtIds, cellPts);
+        result.Conn.assign(
+          cellPtIds->GetPointer(0), cellPtIds->GetPointer(0) + cellPtIds->GetNumberOfIds());
       }
-    }
 
-    else if (dim == 3) // use ordered triangulation
-    {
-      numPts = cell->GetNumberOfPoints();
-      double *p, *pPtr = cell->GetParametricCoords();
-      this->Triangulator->InitTriangulation(0.0, 1.0, 0.0, 1.0, 0.0, 1.0, numPts);
-      for (p = pPtr, j = 0; j < numPts; j++, p += 3)
+      else if (dim == 3) // use ordered triangulation
       {
-        // the wedge is "flipped" compared to other cells in that
-        // the normal of the first face points out instead of in
-        // so we flip the way we pass the points to the triangulator
-        const vtkIdType wedgemap[18] = { 3, 4, 5, 0, 1, 2, 9, 10, 11, 6, 7, 8, 12, 13, 14, 15, 16,
-          17 };
-        type = cell->GetCellType();
-        if (type == VTK_WEDGE || type == VTK_QUADRATIC_WEDGE ||
-          type == VTK_QUADRATIC_LINEAR_WEDGE || type == VTK_BIQUADRATIC_QUADRATIC_WEDGE)
+        int numPts = cell->GetNumberOfPoints();
+        double *p, *pPtr = cell->GetParametricCoords();
+        triangulator->InitTriangulation(0.0, 1.0, 0.0, 1.0, 0.0, 1.0, numPts);
+        for (p = pPtr, j = 0; j < numPts; j++, p += 3)
+        {
+          // the wedge is "flipped" compared to other cells in that
+          // the normal of the first face points out instead of in
+          // so we flip the way we pass the points to the triangulator
+          const vtkIdType wedgemap[18] = { 3, 4, 5, 0, 1, 2, 9, 10, 11, 6, 7, 8, 12, 13, 14, 15,
+            16, 17 };
+          int type = cell->GetCellType();
+          if (type == VTK_WEDGE || type == VTK_QUADRATIC_WEDGE ||
+            type == VTK_QUADRATIC_LINEAR_WEDGE || type == VTK_BIQUADRATIC_QUADRATIC_WEDGE)
+          {
+            ptId = cell->PointIds->GetId(wedgemap[j]);
+            cell->Points->GetPoint(wedgemap[j], x);
+          }
+          else
+          {
+            ptId = cell->PointIds->GetId(j);
+            cell->Points->GetPoint(j, x);
+          }
+          triangulator->InsertPoint(ptId, x, p, 0);
+        }                          // for all cell points
+        if (cell->IsPrimaryCell()) // use templates if topology is fixed
         {
-          ptId = cell->PointIds->GetId(wedgemap[j]);
-          cell->Points->GetPoint(wedgemap[j], x);
+          int numEdges = cell->GetNumberOfEdges();
+          triangulator->TemplateTriangulate(cell->GetCellType(), numPts, numEdges);
         }
-        else
+        else // use ordered triangulator
         {
-          ptId = cell->PointIds->GetId(j);
-          cell->Points->GetPoint(j, x);
+          triangulator->Triangulate();
         }
-        this->Triangulator->InsertPoint(ptId, x, p, 0);
-      }                          // for all cell points
-      if (cell->IsPrimaryCell()) // use templates if topology is fixed
-      {
-        int numEdges = cell->GetNumberOfEdges();
-        this->Triangulator->TemplateTriangulate(cell->GetCellType(), numPts, numEdges);
-      }
-      else // use ordered triangulator
-      {
-        this->Triangulator->Triangulate();
-      }
 
-      ncells = output->GetNumberOfCells();
-      numTets = this->Triangulator->AddTetras(0, output);
-
-      for (j = 0; j < numTets; j++)
-      {
-        outCD->CopyData(tempCD, cellId, ncells + j);
+        tets->Reset();
+        vtkIdType numTets = triangulator->AddTetras(0, tets);
+        result.Dim = 3;
+        result.Conn.reserve(4 * numTets);
+        vtkIdType npts;
+        const vtkIdType* tetPts;
+        for (j = 0; j < numTets; j++)
+        {
+          tets->GetCellAtId(j, npts, tetPts);
+          result.Conn.insert(result.Conn.end(), tetPts, tetPts + npts);
+        }
       }
-    }
 
-    else if (!this->TetrahedraOnly) // 2D or lower dimension
-    {
-      dim++;
-      cell->Triangulate(0, cellPtIds, cellPts);
-      numPts = cellPtIds->GetNumberOfIds();
-
-      numSimplices = numPts / dim;
-      type = 0;
-      switch (dim)
+      else if (!this->TetrahedraOnly) // 2D or lower dimension
       {
-        case 1:
-          type = VTK_VERTEX;
-          break;
-        case 2:
-          type = VTK_LINE;
-          break;
-        case 3:
-          type = VTK_TRIANGLE;
-          break;
+        result.Dim = dim;
+        cell->Triangulate(0, cellPtIds, cellPts);
+        result.Conn.assign(
+          cellPtIds->GetPointer(0), cellPtIds->GetPointer(0) + cellPtIds->GetNumberOfIds());
       }
+    } // for all cells
+  });
+  this->UpdateProgress(0.5);
+  if (this->GetAbortExecute())
+  {
+    tempCD->Delete();
+    return;
+  }
+
+  // Second pass: prefix sum the per-cell simplex counts, then bulk write
+  // the output connectivity, offsets and types and copy the cell data in
+  // parallel.
+  std::vector<vtkIdType> cellOffsets(numCells); // first output cell of each input cell
+  std::vector<vtkIdType> connOffsets(numCells); // first connectivity entry of each input cell
+  vtkIdType totalCells = 0, totalConn = 0;
+  for (vtkIdType cellId = 0; cellId < numCells; cellId++)
+  {
+    cellOffsets[cellId] = totalCells;
+    connOffsets[cellId] = totalConn;
+    const vtkIdType connSize = static_cast<vtkIdType>(simplices[cellId].Conn.size());
+    totalCells += connSize / (simplices[cellId].Dim + 1);
+    totalConn += connSize;
+  }
 
-      for (j = 0; j < numSimplices; j++)
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(totalCells + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(totalConn);
+  vtkNew<vtkUnsignedCharArray> types;
+  types->SetNumberOfValues(totalCells);
+  outCD->CopyAllocate(tempCD, totalCells);
+  ArrayList cellData;
+  cellData.AddArrays(totalCells, tempCD, outCD);
+
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connPtr = connectivity->GetPointer(0);
+  unsigned char* typesPtr = types->GetPointer(0);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    const unsigned char simplexTypes[4] = { VTK_VERTEX, VTK_LINE, VTK_TRIANGLE, VTK_TETRA };
+    for (; cellId < endCellId; cellId++)
+    {
+      const CellSimplices& result = simplices[cellId];
+      const int dim = result.Dim + 1;
+      const vtkIdType numSimplices = static_cast<vtkIdType>(result.Conn.size()) / dim;
+      const vtkIdType outCellId = cellOffsets[cellId];
+      const vtkIdType connIdx = connOffsets[cellId];
+      std::copy(result.Conn.begin(), result.Conn.end(), connPtr + connIdx);
+      for (vtkIdType j = 0; j < numSimplices; j++)
       {
-        for (k = 0; k < dim; k++)
-        {
-          pts[k] = cellPtIds->GetId(dim * j + k);
-        }
-        // copy cell data
-        newCellId = output->InsertNextCell(type, dim, pts);
-        outCD->CopyData(tempCD, cellId, newCellId);
+        offsetsPtr[outCellId + j] = connIdx + j * dim;
+        typesPtr[outCellId + j] = simplexTypes[result.Dim];
+        cellData.Copy(cellId, outCellId + j);
       }
-    } // if 2D or less cell
-  }   // for all cells
+    }
+  });
+  offsetsPtr[totalCells] = totalConn; // top off cell array offsets
 
-  // Update output
-  output->Squeeze();
+  vtkNew<vtkCellArray> outCells;
+  outCells->SetData(offsets, connectivity);
+  output->SetCells(types, outCells);
 
   tempCD->Delete();
-
-  cellPts->Delete();
-  cellPtIds->Delete();
-  cell->Delete();
 }
 
 int vtkDataSetTriangleFilter::FillInputPortInformation(int, vtkInformation* info)
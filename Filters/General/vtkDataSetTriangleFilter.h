@@ -27,6 +27,11 @@
  * This approach produces templates on the fly for triangulating the
  * cells. The templates are then used to do the actual triangulation.
  *
+ * @warning
+ * This class has been threaded with vtkSMPTools. For unstructured input
+ * the cells are triangulated in parallel (each thread uses its own ordered
+ * triangulator) and the output connectivity is written in bulk.
+ *
  * @sa
  * vtkOrderedTriangulator vtkTriangleFilter
  */
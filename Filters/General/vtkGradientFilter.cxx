@@ -24,6 +24,7 @@
 #include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkCellDataToPointData.h"
+#include "vtkCellTypes.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
@@ -393,6 +394,28 @@ int vtkGradientFilter::RequestData(vtkInformation* vtkNotUsed(request),
 // Threaded fast path for unstructured grids.
 namespace // begin anonymous namespace
 {
+// Build a flat per-cell dimension array once so that the gradient workers can
+// filter cells by dimension without constructing them. The dimension comes
+// from the cell type, which is cheap to query for all data set types.
+void BuildCellDimensions(vtkDataSet* input, std::vector<unsigned char>& cellDimensions)
+{
+  vtkIdType numCells = input->GetNumberOfCells();
+  cellDimensions.resize(numCells);
+  if (numCells < 1)
+  {
+    return;
+  }
+  // make sure the cell structures are built before threading the type queries
+  input->GetCellType(0);
+  vtkSMPTools::For(0, numCells, [input, &cellDimensions](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      cellDimensions[cellId] = static_cast<unsigned char>(
+        vtkCellTypes::GetDimension(static_cast<unsigned char>(input->GetCellType(cellId))));
+    }
+  });
+}
+
 template <typename TData>
 struct GradientsBase
 {
@@ -419,17 +442,19 @@ struct PointGradients : public GradientsBase<TData>
 {
   vtkDataSet* Input;
   vtkStaticCellLinks* Links;
+  const unsigned char* CellDimensions;
   int HighestDim;
   int CellOption;
   vtkSMPThreadLocal<vtkSmartPointer<vtkGenericCell>> Cell;
   vtkSMPThreadLocal<std::vector<double>> Values;
   vtkSMPThreadLocal<std::vector<double>> Gradient;
 
-  PointGradients(vtkDataSet* input, vtkStaticCellLinks* links, TData* a, int numComp, TData* g,
-    TData* v, TData* q, TData* d, int highestDim, int cellOption)
+  PointGradients(vtkDataSet* input, vtkStaticCellLinks* links, const unsigned char* cellDims,
+    TData* a, int numComp, TData* g, TData* v, TData* q, TData* d, int highestDim, int cellOption)
     : GradientsBase<TData>(a, numComp, g, v, q, d)
     , Input(input)
     , Links(links)
+    , CellDimensions(cellDims)
     , HighestDim(highestDim)
     , CellOption(cellOption)
   {
@@ -471,8 +496,7 @@ struct PointGradients : public GradientsBase<TData>
         this->HighestDim = 0;
         for (vtkIdType neighbor = 0; neighbor < numCellNeighbors; neighbor++)
         {
-          input->GetCell(cellsOnPoint[neighbor], cell);
-          int cellDimension = cell->GetCellDimension();
+          int cellDimension = this->CellDimensions[cellsOnPoint[neighbor]];
           if (cellDimension > this->HighestDim)
           {
             this->HighestDim = cellDimension;
@@ -486,12 +510,13 @@ struct PointGradients : public GradientsBase<TData>
       vtkIdType numValidCellNeighbors = 0;
 
       // Iterate on all cells and find all points connected to current point
-      // by an edge.
+      // by an edge. The precomputed dimensions allow skipping cells without
+      // constructing them.
       for (vtkIdType neighbor = 0; neighbor < numCellNeighbors; neighbor++)
       {
-        input->GetCell(cellsOnPoint[neighbor], cell);
-        if (cell->GetCellDimension() >= this->HighestDim)
+        if (this->CellDimensions[cellsOnPoint[neighbor]] >= this->HighestDim)
         {
+          input->GetCell(cellsOnPoint[neighbor], cell);
           int subId;
           double parametricCoord[3], derivative[3];
           int nPts = cell->GetNumberOfPoints();
@@ -563,14 +588,14 @@ struct PointGradientsWorker
 {
   template <typename DataT>
   void operator()(DataT* array, vtkDataSet* input, vtkStaticCellLinks* links,
-    vtkDataArray* gradients, vtkDataArray* vorticity, vtkDataArray* qCriterion,
-    vtkDataArray* divergence, int highestDim, int cellOption)
+    const unsigned char* cellDims, vtkDataArray* gradients, vtkDataArray* vorticity,
+    vtkDataArray* qCriterion, vtkDataArray* divergence, int highestDim, int cellOption)
   {
     vtkIdType numPts = input->GetNumberOfPoints();
     int numComp = array->GetNumberOfComponents();
 
-    PointGradients<DataT> pg(input, links, array, numComp, (DataT*)gradients, (DataT*)vorticity,
-      (DataT*)qCriterion, (DataT*)divergence, highestDim, cellOption);
+    PointGradients<DataT> pg(input, links, cellDims, array, numComp, (DataT*)gradients,
+      (DataT*)vorticity, (DataT*)qCriterion, (DataT*)divergence, highestDim, cellOption);
 
     vtkSMPTools::For(0, numPts, pg);
   }
@@ -799,13 +824,14 @@ int vtkGradientFilter::ComputeUnstructuredGridGradient(vtkDataArray* array, int
   // vtkDataArray, tuple interface approach.
   int highestCellDimension = 0;
 
-  // Slower path
+  // Slower path. The dimension comes from the cell type so that no cell has
+  // to be constructed.
   if (this->ContributingCellOption == vtkGradientFilter::DataSetMax)
   {
     int maxDimension = input->IsA("vtkPolyData") == 1 ? 2 : 3;
     for (vtkIdType i = 0; i < input->GetNumberOfCells(); i++)
     {
-      int dim = input->GetCell(i)->GetCellDimension();
+      int dim = vtkCellTypes::GetDimension(static_cast<unsigned char>(input->GetCellType(i)));
       if (dim > highestCellDimension)
       {
         highestCellDimension = dim;
@@ -826,13 +852,17 @@ int vtkGradientFilter::ComputeUnstructuredGridGradient(vtkDataArray* array, int
       vtkNew<vtkStaticCellLinks> cellLinks;
       cellLinks->BuildLinks(input);
 
+      std::vector<unsigned char> cellDimensions;
+      BuildCellDimensions(input, cellDimensions);
+
       using PointGradientsDispatch = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>;
       PointGradientsWorker pgWorker;
-      if (!PointGradientsDispatch::Execute(array, pgWorker, input, cellLinks, gradients, vorticity,
-            qCriterion, divergence, highestCellDimension, this->ContributingCellOption))
+      if (!PointGradientsDispatch::Execute(array, pgWorker, input, cellLinks,
+            cellDimensions.data(), gradients, vorticity, qCriterion, divergence,
+            highestCellDimension, this->ContributingCellOption))
       {
-        pgWorker(array, input, cellLinks, gradients, vorticity, qCriterion, divergence,
-          highestCellDimension, this->ContributingCellOption);
+        pgWorker(array, input, cellLinks, cellDimensions.data(), gradients, vorticity, qCriterion,
+          divergence, highestCellDimension, this->ContributingCellOption);
       }
 
       if (gradients)
@@ -40,8 +40,11 @@
 #include "vtkTriangleFilter.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <set>
+#include <utility>
 
 //------------------------------------------------------------------------------
 // Helper typedefs and data structures.
@@ -165,6 +168,11 @@ public:
   IntersectionMapType* IntersectionPtsMap[2];
   IntersectionMapType* PointMapper;
 
+  // Unordered end point pairs of the intersection lines added so far.
+  // Used to reject duplicate lines without rebuilding links over the
+  // accumulated line set for every candidate.
+  std::set<std::pair<vtkIdType, vtkIdType>> IntersectionLinePairs;
+
   // Map from point to an edge on which it resides, the ID of the
   // cell, and the ID of the line.
   PointEdgeMapType* PointEdgeMap[2];
@@ -350,23 +358,19 @@ int vtkIntersectionPolyDataFilter::Impl ::FindTriangleIntersections(
               // Check to see if duplicate line. Line can only be a duplicate
               // line if both points are not unique and they don't
               // equal each other
-              if (!unique[0] && !unique[1] && ptId0 != ptId1)
+              std::pair<vtkIdType, vtkIdType> linePair(
+                std::min(ptId0, ptId1), std::max(ptId0, ptId1));
+              if (!unique[0] && !unique[1] && ptId0 != ptId1 &&
+                info->IntersectionLinePairs.find(linePair) != info->IntersectionLinePairs.end())
               {
-                vtkSmartPointer<vtkPolyData> lineTest = vtkSmartPointer<vtkPolyData>::New();
-                lineTest->SetPoints(pointMerger->GetPoints());
-                lineTest->SetLines(intersectionLines);
-                lineTest->BuildLinks();
-                int newLine = info->CheckLine(lineTest, ptId0, ptId1);
-                if (newLine == 0)
-                {
-                  addline = 0;
-                }
+                addline = 0;
               }
               if (addline)
               {
                 // If the line is new and does not consist of two identical
                 // points, add the line to the intersection and update
                 // mapping information
+                info->IntersectionLinePairs.insert(linePair);
                 intersectionLines->InsertNextCell(2);
                 intersectionLines->InsertCellPoint(ptId0);
                 intersectionLines->InsertCellPoint(ptId1);
@@ -16,12 +16,15 @@
 
 #include "vtkCellArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -991,6 +994,57 @@ int vtkOBBTree::IntersectWithLine(const double a0[3], const double a1[3], double
   return 0;
 }
 
+//------------------------------------------------------------------------------
+void vtkOBBTree::IntersectWithLines(vtkDataArray* startPoints, vtkDataArray* endPoints, double tol,
+  vtkIdTypeArray* cellIds, vtkPoints* hitPoints)
+{
+  if (startPoints == nullptr || endPoints == nullptr || cellIds == nullptr)
+  {
+    vtkErrorMacro("IntersectWithLines: start points, end points and cell ids are required");
+    return;
+  }
+  vtkIdType numLines = startPoints->GetNumberOfTuples();
+  if (endPoints->GetNumberOfTuples() != numLines)
+  {
+    vtkErrorMacro("IntersectWithLines: mismatched numbers of start and end points");
+    return;
+  }
+
+  cellIds->SetNumberOfValues(numLines);
+  if (hitPoints)
+  {
+    hitPoints->SetNumberOfPoints(numLines);
+  }
+
+  // The tree is only read during traversal; the single mutable query
+  // object is the cell, which is per-thread.
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numLines,
+    [this, startPoints, endPoints, tol, cellIds, hitPoints, &tlCell](
+      vtkIdType begin, vtkIdType end) {
+      vtkGenericCell* cell = tlCell.Local();
+      double a0[3], a1[3], x[3], pcoords[3];
+      double t;
+      int subId;
+      for (vtkIdType lineId = begin; lineId < end; ++lineId)
+      {
+        startPoints->GetTuple(lineId, a0);
+        endPoints->GetTuple(lineId, a1);
+        vtkIdType cellId = -1;
+        if (!this->IntersectWithLine(a0, a1, tol, t, x, pcoords, subId, cellId, cell))
+        {
+          cellId = -1;
+          x[0] = x[1] = x[2] = 0.0;
+        }
+        cellIds->SetValue(lineId, cellId);
+        if (hitPoints)
+        {
+          hitPoints->SetPoint(lineId, x);
+        }
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 void vtkOBBNode::DebugPrintTree(int level, double* leaf_vol, int* minCells, int* maxCells)
 {
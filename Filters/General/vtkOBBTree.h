@@ -69,6 +69,8 @@
 #include "vtkAbstractCellLocator.h"
 #include "vtkFiltersGeneralModule.h" // For export macro
 
+class vtkDataArray;
+class vtkIdTypeArray;
 class vtkMatrix4x4;
 
 // Special class defines node for the OBB tree
@@ -133,6 +135,20 @@ public:
   int IntersectWithLine(
     const double a0[3], const double a1[3], vtkPoints* points, vtkIdList* cellIds) override;
 
+  /**
+   * Intersect a batch of line segments with the OBB tree in parallel.
+   * The start and end points of the i'th segment are the i'th tuples of
+   * startPoints and endPoints (both must have three components and the
+   * same number of tuples). On return, the i'th value of cellIds is the
+   * id of the first cell hit by the segment, or -1 if it missed, and the
+   * i'th point of hitPoints (when not nullptr) is the corresponding
+   * intersection point. Both output containers are sized by this method.
+   * The segments are processed with vtkSMPTools using per-thread cells,
+   * so this is much faster than looping over IntersectWithLine.
+   */
+  void IntersectWithLines(vtkDataArray* startPoints, vtkDataArray* endPoints, double tol,
+    vtkIdTypeArray* cellIds, vtkPoints* hitPoints = nullptr);
+
   /**
    * Compute an OBB from the list of points given. Return the corner point
    * and the three axes defining the orientation of the OBB. Also return
@@ -53,6 +53,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -63,6 +64,38 @@
 vtkStandardNewMacro(vtkTableBasedClipDataSet);
 vtkCxxSetObjectMacro(vtkTableBasedClipDataSet, ClipFunction, vtkImplicitFunction);
 
+namespace
+{
+
+// Threaded evaluation of the clip function over the input points.
+struct vtkTableBasedClipperEvaluateClipScalars
+{
+  vtkDataSet* Input;
+  vtkImplicitFunction* Function;
+  double* Scalars;
+
+  vtkTableBasedClipperEvaluateClipScalars(
+    vtkDataSet* input, vtkImplicitFunction* func, double* scalars)
+    : Input(input)
+    , Function(func)
+    , Scalars(scalars)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3];
+    double* s = this->Scalars + ptId;
+    for (; ptId < endPtId; ++ptId)
+    {
+      this->Input->GetPoint(ptId, x);
+      *s++ = this->Function->FunctionValue(x);
+    }
+  }
+};
+
+} // end anonymous namespace
+
 // ============================================================================
 // ============== vtkTableBasedClipperDataSetFromVolume (begin) ===============
 // ============================================================================
@@ -1711,7 +1744,6 @@ int vtkTableBasedClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   theInput = nullptr;
   vtkDebugMacro(<< "Clipping dataset" << endl);
 
-  int i;
   vtkIdType numbPnts = cpyInput->GetNumberOfPoints();
 
   // handling exceptions
@@ -1746,11 +1778,9 @@ int vtkTableBasedClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
       cpyInput->GetPointData()->SetScalars(pScalars);
     }
 
-    for (i = 0; i < numbPnts; i++)
-    {
-      double s = this->ClipFunction->FunctionValue(cpyInput->GetPoint(i));
-      pScalars->SetTuple1(i, s);
-    }
+    vtkTableBasedClipperEvaluateClipScalars evaluate(
+      cpyInput, this->ClipFunction, pScalars->GetPointer(0));
+    vtkSMPTools::For(0, numbPnts, evaluate);
 
     clipAray = pScalars;
   }
@@ -25,6 +25,7 @@
 
 #include "vtkTemporalStatistics.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
@@ -38,6 +39,7 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -138,6 +140,88 @@ struct AccumulateStdDev
   }
 };
 
+//------------------------------------------------------------------------------
+// Fused accumulation of all requested statistics in a single sweep over the
+// input array: each input value is loaded once per time step instead of once
+// per statistic, and the sweep is threaded with vtkSMPTools. The accumulators
+// are created by InitializeArray() as standard (AOS) arrays of the input's
+// data type, which is what the pointer-based updates below rely on; if an
+// accumulator has an unexpected type, Success stays false and the caller
+// falls back to the per-statistic workers above.
+struct AccumulateFused
+{
+  bool Success = false;
+
+  template <typename InArrayT>
+  void operator()(InArrayT* inArray, vtkDataArray* avgDa, vtkDataArray* minDa, vtkDataArray* maxDa,
+    vtkDataArray* stdevDa, vtkDataArray* compDa, int passIn)
+  {
+    using T = vtk::GetAPIType<InArrayT>;
+    using OutArrayT = vtkAOSDataArrayTemplate<T>;
+
+    OutArrayT* avgArray = vtkArrayDownCast<OutArrayT>(avgDa);
+    OutArrayT* minArray = vtkArrayDownCast<OutArrayT>(minDa);
+    OutArrayT* maxArray = vtkArrayDownCast<OutArrayT>(maxDa);
+    OutArrayT* stdevArray = vtkArrayDownCast<OutArrayT>(stdevDa);
+    OutArrayT* compArray = vtkArrayDownCast<OutArrayT>(compDa);
+    if ((avgDa && !avgArray) || (minDa && !minArray) || (maxDa && !maxArray) ||
+      (stdevDa && !stdevArray) || (compDa && !compArray))
+    {
+      return;
+    }
+    this->Success = true;
+
+    T* avg = avgArray ? avgArray->GetPointer(0) : nullptr;
+    T* mn = minArray ? minArray->GetPointer(0) : nullptr;
+    T* mx = maxArray ? maxArray->GetPointer(0) : nullptr;
+    T* stdev = stdevArray ? stdevArray->GetPointer(0) : nullptr;
+    T* comp = compArray ? compArray->GetPointer(0) : nullptr;
+
+    const auto in = vtk::DataArrayValueRange(inArray);
+    const double pass = static_cast<double>(passIn);
+
+    vtkSMPTools::For(
+      0, inArray->GetNumberOfValues(), [&](vtkIdType valueIdx, vtkIdType endValueIdx) {
+        for (; valueIdx < endValueIdx; ++valueIdx)
+        {
+          const T value = in[valueIdx];
+
+          // The standard deviation update must see the running sum of the
+          // previous passes, so it comes before the average update.
+          if (stdev)
+          {
+            const double temp = value - (avg[valueIdx] / pass);
+            stdev[valueIdx] += static_cast<T>(pass * temp * temp / (pass + 1.));
+          }
+          if (avg)
+          {
+            if (comp)
+            {
+              // Kahan compensated summation: the compensation term carries
+              // the low-order bits the running sum cannot represent.
+              const T y = value - comp[valueIdx];
+              const T t = avg[valueIdx] + y;
+              comp[valueIdx] = (t - avg[valueIdx]) - y;
+              avg[valueIdx] = t;
+            }
+            else
+            {
+              avg[valueIdx] += value;
+            }
+          }
+          if (mn)
+          {
+            mn[valueIdx] = std::min(mn[valueIdx], value);
+          }
+          if (mx)
+          {
+            mx[valueIdx] = std::max(mx[valueIdx], value);
+          }
+        }
+      });
+  }
+};
+
 //------------------------------------------------------------------------------
 struct FinishAverage
 {
@@ -179,6 +263,7 @@ vtkTemporalStatistics::vtkTemporalStatistics()
   this->ComputeMinimum = 1;
   this->ComputeMaximum = 1;
   this->ComputeStandardDeviation = 1;
+  this->UseCompensatedSummation = 0;
 
   this->CurrentTimeIndex = 0;
   this->GeneratedChangingTopologyWarning = false;
@@ -194,6 +279,7 @@ void vtkTemporalStatistics::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ComputeMinimum: " << this->ComputeMinimum << endl;
   os << indent << "ComputeMaximum: " << this->ComputeMaximum << endl;
   os << indent << "ComputeStandardDeviation: " << this->ComputeStandardDeviation << endl;
+  os << indent << "UseCompensatedSummation: " << this->UseCompensatedSummation << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -312,6 +398,10 @@ int vtkTemporalStatistics::RequestData(
 //------------------------------------------------------------------------------
 void vtkTemporalStatistics::InitializeStatistics(vtkDataObject* input, vtkDataObject* output)
 {
+  // Drop any compensation terms left over from a previous series of time
+  // steps; they are recreated lazily on the first accumulation pass.
+  this->CompensationArrays.clear();
+
   if (input->IsA("vtkDataSet"))
   {
     this->InitializeStatistics(vtkDataSet::SafeDownCast(input), vtkDataSet::SafeDownCast(output));
@@ -526,66 +616,108 @@ void vtkTemporalStatistics::AccumulateArrays(vtkFieldData* inFd, vtkFieldData* o
   for (int i = 0; i < numArrays; i++)
   {
     vtkDataArray* inArray = inFd->GetArray(i);
-    vtkDataArray* outArray;
     if (!inArray)
     {
       continue;
     }
 
-    outArray = this->GetArray(outFd, inArray, AVERAGE_SUFFIX);
-    if (outArray)
+    vtkDataArray* avgArray = this->GetArray(outFd, inArray, AVERAGE_SUFFIX);
+    vtkDataArray* minArray = this->GetArray(outFd, inArray, MINIMUM_SUFFIX);
+    vtkDataArray* maxArray = this->GetArray(outFd, inArray, MAXIMUM_SUFFIX);
+    vtkDataArray* stdevArray =
+      avgArray ? this->GetArray(outFd, inArray, STANDARD_DEVIATION_SUFFIX) : nullptr;
+    if (!avgArray && !minArray && !maxArray)
     {
+      continue;
+    }
 
-      vtkDataArray* stdevOutArray = this->GetArray(outFd, inArray, STANDARD_DEVIATION_SUFFIX);
-      if (stdevOutArray)
+    // The compensation array shadows the average accumulator when
+    // compensated summation is requested. It is created on the first
+    // accumulation pass and released in PostExecute().
+    vtkDataArray* compArray = nullptr;
+    if (this->UseCompensatedSummation && avgArray)
+    {
+      vtkSmartPointer<vtkDataArray>& comp = this->CompensationArrays[avgArray];
+      if (!comp)
       {
-        using Dispatcher = vtkArrayDispatch::Dispatch3SameValueType;
+        comp.TakeReference(
+          vtkArrayDownCast<vtkDataArray>(vtkAbstractArray::CreateArray(avgArray->GetDataType())));
+        comp->SetNumberOfComponents(avgArray->GetNumberOfComponents());
+        comp->SetNumberOfTuples(avgArray->GetNumberOfTuples());
+        comp->Fill(0.);
+      }
+      compArray = comp;
+    }
+
+    // Update every requested statistic in one threaded sweep over the input.
+    using Dispatcher = vtkArrayDispatch::Dispatch;
+    AccumulateFused fused;
+    if (!Dispatcher::Execute(
+          inArray, fused, avgArray, minArray, maxArray, stdevArray, compArray,
+          this->CurrentTimeIndex))
+    { // Fallback to slow path:
+      fused(inArray, avgArray, minArray, maxArray, stdevArray, compArray, this->CurrentTimeIndex);
+    }
+
+    if (!fused.Success)
+    {
+      // Unexpected accumulator array types: fall back to the original
+      // per-statistic updates (no compensation on this path).
+      if (stdevArray)
+      {
+        using StdDevDispatcher = vtkArrayDispatch::Dispatch3SameValueType;
         AccumulateStdDev worker;
-        if (!Dispatcher::Execute(inArray, stdevOutArray, outArray, worker, this->CurrentTimeIndex))
+        if (!StdDevDispatcher::Execute(inArray, stdevArray, avgArray, worker,
+              this->CurrentTimeIndex))
         { // Fallback to slow path:
-          worker(inArray, stdevOutArray, outArray, this->CurrentTimeIndex);
+          worker(inArray, stdevArray, avgArray, this->CurrentTimeIndex);
         }
-
-        // Alert change in data.
-        stdevOutArray->DataChanged();
       }
-
-      using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
-      AccumulateAverage worker;
-      if (!Dispatcher::Execute(inArray, outArray, worker))
-      { // Fallback to slow path:
-        worker(inArray, stdevOutArray);
+      if (avgArray)
+      {
+        using AvgDispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+        AccumulateAverage worker;
+        if (!AvgDispatcher::Execute(inArray, avgArray, worker))
+        { // Fallback to slow path:
+          worker(inArray, avgArray);
+        }
+      }
+      if (minArray)
+      {
+        using MinDispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+        AccumulateMinimum worker;
+        if (!MinDispatcher::Execute(inArray, minArray, worker))
+        { // Fallback to slow path:
+          worker(inArray, minArray);
+        }
+      }
+      if (maxArray)
+      {
+        using MaxDispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+        AccumulateMaximum worker;
+        if (!MaxDispatcher::Execute(inArray, maxArray, worker))
+        { // Fallback to slow path:
+          worker(inArray, maxArray);
+        }
       }
-
-      // Alert change in data.
-      outArray->DataChanged();
     }
 
-    outArray = this->GetArray(outFd, inArray, MINIMUM_SUFFIX);
-    if (outArray)
+    // Alert change in data.
+    if (stdevArray)
     {
-      using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
-      AccumulateMinimum worker;
-      if (!Dispatcher::Execute(inArray, outArray, worker))
-      { // Fallback to slow path:
-        worker(inArray, outArray);
-      }
-
-      // Alert change in data.
-      outArray->DataChanged();
+      stdevArray->DataChanged();
     }
-
-    outArray = this->GetArray(outFd, inArray, MAXIMUM_SUFFIX);
-    if (outArray)
+    if (avgArray)
     {
-      using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
-      AccumulateMaximum worker;
-      if (!Dispatcher::Execute(inArray, outArray, worker))
-      { // Fallback to slow path:
-        worker(inArray, outArray);
-      }
-      // Alert change in data.
-      outArray->DataChanged();
+      avgArray->DataChanged();
+    }
+    if (minArray)
+    {
+      minArray->DataChanged();
+    }
+    if (maxArray)
+    {
+      maxArray->DataChanged();
     }
   }
 }
@@ -593,6 +725,9 @@ void vtkTemporalStatistics::AccumulateArrays(vtkFieldData* inFd, vtkFieldData* o
 //------------------------------------------------------------------------------
 void vtkTemporalStatistics::PostExecute(vtkDataObject* input, vtkDataObject* output)
 {
+  // The accumulation is over; release the compensation terms.
+  this->CompensationArrays.clear();
+
   if (input->IsA("vtkDataSet"))
   {
     this->PostExecute(vtkDataSet::SafeDownCast(input), vtkDataSet::SafeDownCast(output));
@@ -54,8 +54,12 @@
 
 #include "vtkFiltersGeneralModule.h" // For export macro
 #include "vtkPassInputTypeAlgorithm.h"
+#include "vtkSmartPointer.h" // For compensated summation arrays
+
+#include <map> // For compensated summation arrays
 
 class vtkCompositeDataSet;
+class vtkDataArray;
 class vtkDataSet;
 class vtkFieldData;
 class vtkGraph;
@@ -110,6 +114,22 @@ public:
   vtkSetMacro(ComputeStandardDeviation, vtkTypeBool);
   vtkBooleanMacro(ComputeStandardDeviation, vtkTypeBool);
 
+  ///@{
+  /**
+   * Turn on/off compensated (Kahan) summation for the average and standard
+   * deviation accumulation.  Off by default.  The accumulators are kept in
+   * the precision of the input arrays, so a running sum over many time steps
+   * of single precision data drops low-order bits; compensated summation
+   * carries those bits in a shadow array, at the cost of a few extra
+   * operations per value and one extra array of memory per accumulated
+   * array.  The shadow arrays are released when the last time step has been
+   * processed.
+   */
+  vtkGetMacro(UseCompensatedSummation, vtkTypeBool);
+  vtkSetMacro(UseCompensatedSummation, vtkTypeBool);
+  vtkBooleanMacro(UseCompensatedSummation, vtkTypeBool);
+  ///@}
+
 protected:
   vtkTemporalStatistics();
   ~vtkTemporalStatistics() override;
@@ -118,10 +138,16 @@ protected:
   vtkTypeBool ComputeMaximum;
   vtkTypeBool ComputeMinimum;
   vtkTypeBool ComputeStandardDeviation;
+  vtkTypeBool UseCompensatedSummation;
 
   // Used when iterating the pipeline to keep track of which timestep we are on.
   int CurrentTimeIndex;
 
+  // Shadow arrays carrying the summation compensation terms, keyed by the
+  // average accumulator they belong to. Only populated while iterating over
+  // the time steps with UseCompensatedSummation on.
+  std::map<vtkDataArray*, vtkSmartPointer<vtkDataArray>> CompensationArrays;
+
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
   int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector,
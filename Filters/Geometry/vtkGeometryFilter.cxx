@@ -1440,6 +1440,62 @@ struct ExtractCellBoundaries
   }
 };
 
+// Return the points of a cell as vtkIdType. When the connectivity storage
+// is vtkIdType-wide the pointer is shared directly; otherwise (e.g. 32-bit
+// storage) the ids are converted into the supplied thread-local buffer.
+inline const vtkIdType* GetCellPointsAsIdType(
+  const vtkIdType* cellConn, vtkIdType vtkNotUsed(npts), vtkIdList* vtkNotUsed(buffer))
+{
+  return cellConn;
+}
+template <typename ValueType>
+inline const vtkIdType* GetCellPointsAsIdType(
+  const ValueType* cellConn, vtkIdType npts, vtkIdList* buffer)
+{
+  buffer->SetNumberOfIds(npts);
+  vtkIdType* pts = buffer->GetPointer(0);
+  for (vtkIdType i = 0; i < npts; ++i)
+  {
+    pts[i] = static_cast<vtkIdType>(cellConn[i]);
+  }
+  return pts;
+}
+
+// Worker run through vtkCellArray::Visit so the 32/64-bit connectivity
+// storage dispatch happens once per batch of cells instead of inside
+// GetCellPoints() for every cell.
+struct ExtractUGCellsWorker
+{
+  template <typename CellStateT, typename TExtract, typename TLocalData, typename TFaceMap>
+  void operator()(CellStateT& state, TExtract* extract, TLocalData* localData, TFaceMap* faceMap,
+    const unsigned char* cellTypes, vtkIdType beginCellId, vtkIdType endCellId)
+  {
+    using ValueType = typename CellStateT::ValueType;
+    const ValueType* conn = state.GetConnectivity()->GetPointer(0);
+    const ValueType* offsets = state.GetOffsets()->GetPointer(0);
+    vtkIdList* cellPointIds = localData->CellPointIds;
+
+    for (vtkIdType cellId = beginCellId; cellId < endCellId && !extract->Self->GetAbortExecute();
+         ++cellId)
+    {
+      const bool isGhost = extract->CellGhosts && extract->CellGhosts[cellId] & MASKED_CELL_VALUE;
+      const unsigned char type = cellTypes[cellId];
+      if (isGhost && (vtkCellTypes::GetDimension(type) < 3 || !extract->RemoveGhostInterfaces))
+      {
+        continue;
+      }
+      // If the cell is visible process it
+      if (!extract->CellVis || extract->CellVis[cellId])
+      {
+        const vtkIdType npts = static_cast<vtkIdType>(offsets[cellId + 1] - offsets[cellId]);
+        const vtkIdType* pts =
+          GetCellPointsAsIdType(conn + offsets[cellId], npts, cellPointIds);
+        ExtractCellGeometry(extract->Grid, cellId, type, npts, pts, localData, faceMap, isGhost);
+      } // if cell visible
+    }   // for all cells in this batch
+  }
+};
+
 // Extract unstructured grid boundary by visiting each cell and examining
 // cell features.
 template <typename TInputIdType>
@@ -1494,25 +1550,12 @@ struct ExtractUG : public ExtractCellBoundaries<TInputIdType>
     bool isGhost;
     if (this->Grid)
     {
-      const auto& cellTypes =
-        vtk::DataArrayValueRange<1>(this->Grid->GetCellTypesArray(), beginCellId, endCellId);
-      auto cellTypesItr = cellTypes.begin();
-      for (vtkIdType cellId = beginCellId; cellId < endCellId && !this->Self->GetAbortExecute();
-           ++cellId, ++cellTypesItr)
-      {
-        isGhost = this->CellGhosts && this->CellGhosts[cellId] & MASKED_CELL_VALUE;
-        type = *cellTypesItr;
-        if (isGhost && (vtkCellTypes::GetDimension(type) < 3 || !this->RemoveGhostInterfaces))
-        {
-          continue;
-        }
-        // If the cell is visible process it
-        if (!this->CellVis || this->CellVis[cellId])
-        {
-          this->Grid->GetCellPoints(cellId, npts, pts, cellPointIds);
-          ExtractCellGeometry(this->Grid, cellId, type, npts, pts, &localData, faceMap, isGhost);
-        } // if cell visible
-      }   // for all cells in this batch
+      // Dispatch on the concrete connectivity storage once per batch; the
+      // worker loop then reads offsets and connectivity without per-cell
+      // storage checks.
+      const unsigned char* cellTypes = this->Grid->GetCellTypesArray()->GetPointer(0);
+      this->Grid->GetCells()->Visit(
+        ExtractUGCellsWorker{}, this, &localData, faceMap, cellTypes, beginCellId, endCellId);
     }
     else
     {
@@ -0,0 +1,182 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTemporalCacheMemoryLimit.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCommand.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalDataSetCache.h"
+
+#include <vector>
+
+//
+// This test exercises the MemoryLimit of vtkTemporalDataSetCache: when the
+// cached time steps exceed the budget, the least recently used ones must be
+// ejected and re-requested from upstream, while recently used steps are
+// still served from the cache.
+//
+
+//------------------------------------------------------------------------------
+// A source that announces ten time steps and produces a sphere for each.
+//------------------------------------------------------------------------------
+class vtkMemLimitSphereSource : public vtkSphereSource
+{
+public:
+  static vtkMemLimitSphereSource* New();
+  vtkTypeMacro(vtkMemLimitSphereSource, vtkSphereSource);
+
+protected:
+  vtkMemLimitSphereSource() = default;
+
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    if (!this->Superclass::RequestInformation(request, inputVector, outputVector))
+    {
+      return 0;
+    }
+    std::vector<double> timeSteps(10);
+    for (int i = 0; i < 10; ++i)
+    {
+      timeSteps[i] = i;
+    }
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), timeSteps.data(),
+      static_cast<int>(timeSteps.size()));
+    double timeRange[2] = { timeSteps.front(), timeSteps.back() };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    if (!this->Superclass::RequestData(request, inputVector, outputVector))
+    {
+      return 0;
+    }
+    if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+    {
+      double t = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), t);
+    }
+    return 1;
+  }
+};
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkMemLimitSphereSource);
+
+//------------------------------------------------------------------------------
+// Count how many times the upstream source actually executes.
+//------------------------------------------------------------------------------
+class vtkMemLimitExecuteCallback : public vtkCommand
+{
+public:
+  static vtkMemLimitExecuteCallback* New() { return new vtkMemLimitExecuteCallback; }
+
+  void Execute(vtkObject*, unsigned long, void*) override { ++this->Count; }
+
+  unsigned int Count = 0;
+};
+
+//------------------------------------------------------------------------------
+int TestTemporalCacheMemoryLimit(int, char*[])
+{
+  vtkNew<vtkMemLimitSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+
+  vtkMemLimitExecuteCallback* executecb = vtkMemLimitExecuteCallback::New();
+  sphere->AddObserver(vtkCommand::StartEvent, executecb);
+  executecb->Delete();
+
+  vtkNew<vtkTemporalDataSetCache> cache;
+  cache->SetInputConnection(sphere->GetOutputPort());
+  cache->SetCacheSize(10);
+  if (cache->GetMemoryLimit() != 0)
+  {
+    std::cerr << "MemoryLimit must default to 0 (disabled)" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkInformation* info = cache->GetOutputInformation(0);
+  cache->UpdateInformation();
+
+  // With no memory limit, revisiting time steps must be served from the
+  // cache without re-executing the source.
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), static_cast<double>(i));
+      cache->Update();
+    }
+  }
+  if (executecb->Count != 4)
+  {
+    std::cerr << "Expected 4 source executions with an unbounded cache, got " << executecb->Count
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Measure the size of one cached time step and set a budget that can hold
+  // roughly two of them.
+  unsigned long stepSize = cache->GetOutputDataObject(0)->GetActualMemorySize();
+  if (stepSize == 0)
+  {
+    std::cerr << "Cached time step reports zero memory" << std::endl;
+    return EXIT_FAILURE;
+  }
+  cache->SetMemoryLimit(2 * stepSize + stepSize / 2);
+
+  // Revisiting the most recent step stays within the budget and must not
+  // trigger an upstream execution even after trimming kicks in.
+  executecb->Count = 0;
+  info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 3.0);
+  cache->Update();
+  info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), 3.0);
+  cache->Update();
+  if (executecb->Count != 0)
+  {
+    std::cerr << "Most recently used time step was evicted" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Sweeping over more steps than fit in the budget must eject the least
+  // recently used ones, so a second sweep re-executes the source each time.
+  executecb->Count = 0;
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (int i = 0; i < 6; ++i)
+    {
+      info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), static_cast<double>(i));
+      cache->Update();
+    }
+  }
+  if (executecb->Count < 8)
+  {
+    std::cerr << "Expected the memory limit to force re-executions, got " << executecb->Count
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -32,6 +33,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProp3D.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
 #include "vtkSignedCharArray.h"
 #include "vtkTransform.h"
@@ -105,24 +108,8 @@ void getCellCenterDepth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
     pds->BuildCells();
   }
 
-  // compute cell centers
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    // get the cell point ids using the fast api
-    const vtkIdType* pids = nullptr;
-    vtkIdType nPids = 0;
-    pds->GetCellPoints(cid, nPids, pids);
-
-    // compute the center of the cell bounds
-    cx[cid] = getCellBoundsCenter(pids, nPids, px);
-    cy[cid] = getCellBoundsCenter(pids, nPids, py);
-    cz[cid] = getCellBoundsCenter(pids, nPids, pz);
-  }
-
-  // compute the distance to the cell center
+  // compute the distance to the center of each cell's bounds. each thread
+  // needs its own id list for the thread safe GetCellPoints api
   T x0 = static_cast<T>(origin[0]);
   T y0 = static_cast<T>(origin[1]);
   T z0 = static_cast<T>(origin[2]);
@@ -130,14 +117,23 @@ void getCellCenterDepth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
   T vy = static_cast<T>(direction[1]);
   T vz = static_cast<T>(direction[2]);
   depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
-  }
-
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType beginCid, vtkIdType endCid) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    for (vtkIdType cid = beginCid; cid < endCid; ++cid)
+    {
+      // get the cell point ids using the fast api
+      const vtkIdType* pids = nullptr;
+      vtkIdType nPids = 0;
+      pds->GetCellPoints(cid, nPids, pids, ptIds);
+
+      // compute the center of the cell bounds
+      T cx = getCellBoundsCenter(pids, nPids, px);
+      T cy = getCellBoundsCenter(pids, nPids, py);
+      T cz = getCellBoundsCenter(pids, nPids, pz);
+      depth[cid] = (cx - x0) * vx + (cy - y0) * vy + (cz - z0) * vz;
+    }
+  });
 }
 
 template <typename T>
@@ -161,22 +157,8 @@ void getCellPoint0Depth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
     pds->BuildCells();
   }
 
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  const vtkIdType* pids = nullptr;
-  vtkIdType nPids = 0;
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    // get the cell point ids using the fast api
-    pds->GetCellPoints(cid, nPids, pids);
-    vtkIdType ii = pids[0];
-    cx[cid] = px[3 * ii];
-    cy[cid] = py[3 * ii];
-    cz[cid] = pz[3 * ii];
-  }
-
-  // compute the distance to the cell's first point
+  // compute the distance to the cell's first point. each thread needs its
+  // own id list for the thread safe GetCellPoints api
   T x0 = static_cast<T>(origin[0]);
   T y0 = static_cast<T>(origin[1]);
   T z0 = static_cast<T>(origin[2]);
@@ -184,14 +166,19 @@ void getCellPoint0Depth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
   T vy = static_cast<T>(direction[1]);
   T vz = static_cast<T>(direction[2]);
   depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
-  }
-
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType beginCid, vtkIdType endCid) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    const vtkIdType* pids = nullptr;
+    vtkIdType nPids = 0;
+    for (vtkIdType cid = beginCid; cid < endCid; ++cid)
+    {
+      // get the cell point ids using the fast api
+      pds->GetCellPoints(cid, nPids, pids, ptIds);
+      vtkIdType ii = pids[0];
+      depth[cid] = (px[3 * ii] - x0) * vx + (py[3 * ii] - y0) * vy + (pz[3 * ii] - z0) * vz;
+    }
+  });
 }
 };
 
@@ -305,10 +292,10 @@ int vtkDepthSortPolyData::RequestData(vtkInformation* vtkNotUsed(request),
           // sort cell ids by depth
           if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK) {
             ::lessf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
+            vtkSMPTools::Sort(order, order + nCells, comp);
           } else {
             ::greaterf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
+            vtkSMPTools::Sort(order, order + nCells, comp);
           }
 
           delete[] depth;);
@@ -340,12 +327,12 @@ int vtkDepthSortPolyData::RequestData(vtkInformation* vtkNotUsed(request),
       if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK)
       {
         ::lessf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
+        vtkSMPTools::Sort(order, order + nCells, comp);
       }
       else
       {
         ::greaterf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
+        vtkSMPTools::Sort(order, order + nCells, comp);
       }
 
       delete[] weight;
@@ -866,6 +866,7 @@ int vtkGreedyTerrainDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   // call reallocates the links from the points to the using triangles.
   this->Mesh->SetPoints(newPts);
   this->Mesh->SetPolys(triangles);
+  this->Mesh->EditableOn();       // links are edited as points are inserted
   this->Mesh->BuildLinks(numPts); // build cell structure; give it initial size
 
   // Update all (two) triangles connected to this mesh point. The single point
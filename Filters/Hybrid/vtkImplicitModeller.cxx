@@ -20,6 +20,7 @@
 #include "vtkCommand.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
 #include "vtkImageIterator.h"
 #include "vtkImageProgressIterator.h"
@@ -578,6 +579,123 @@ void vtkImplicitModellerAppendExecute(
   delete[] weights;
 }
 
+//------------------------------------------------------------------------------
+// Templated recomputation of a region of the output. Structured like the
+// VTK_CELL_MODE append, except that cells whose distance function cannot
+// reach the region are skipped and voxel updates are clamped to the region.
+template <class OT>
+void vtkImplicitModellerUpdateExecute(vtkImplicitModeller* self, vtkDataSet* input,
+  vtkImageData* outData, int regionExt[6], const double regionBounds[6], double maxDistance, OT*)
+{
+  int i, j, k, emptyExtent;
+  vtkIdType cellNum;
+  double adjBounds[6];
+  double pcoords[3];
+  int outExt[6];
+  double x[3], prevDistance2, distance, distance2;
+  int subId;
+  double closestPoint[3];
+  double* weights = new double[input->GetMaxCellSize()];
+  double maxDistance2;
+  double *spacing, *origin;
+
+  spacing = outData->GetSpacing();
+  origin = outData->GetOrigin();
+
+  maxDistance2 = maxDistance * maxDistance;
+
+  // so we know how to scale if desired
+  double scaleFactor = 0;         // 0 used to indicate not scaling
+  double toDoubleScaleFactor = 0; // 0 used to indicate not scaling
+  double capValue = 0;            // 0 used to indicate not clamping (float or double)
+  if (self->GetOutputScalarType() != VTK_FLOAT && self->GetOutputScalarType() != VTK_DOUBLE)
+  {
+    capValue = self->GetCapValue();
+    if (self->GetScaleToMaximumDistance())
+    {
+      scaleFactor = capValue / maxDistance;
+      toDoubleScaleFactor = maxDistance / capValue;
+    }
+  }
+
+  //
+  // Traverse all cells; computing distance function on the region's points.
+  //
+  vtkCell* cell;
+  for (cellNum = 0; cellNum < input->GetNumberOfCells(); cellNum++)
+  {
+    cell = input->GetCell(cellNum);
+    const double* bounds = cell->GetBounds();
+    for (i = 0; i < 3; i++)
+    {
+      adjBounds[2 * i] = bounds[2 * i] - maxDistance;
+      adjBounds[2 * i + 1] = bounds[2 * i + 1] + maxDistance;
+    }
+
+    // skip cells too far away to affect any voxel of the region
+    if (adjBounds[0] > regionBounds[1] || adjBounds[1] < regionBounds[0] ||
+      adjBounds[2] > regionBounds[3] || adjBounds[3] < regionBounds[2] ||
+      adjBounds[4] > regionBounds[5] || adjBounds[5] < regionBounds[4])
+    {
+      continue;
+    }
+
+    // compute dimensional bounds in data set, clamped to the region
+    emptyExtent = 0;
+    for (i = 0; i < 3; i++)
+    {
+      outExt[i * 2] = (int)((double)(adjBounds[2 * i] - origin[i]) / spacing[i]);
+      outExt[i * 2 + 1] = (int)((double)(adjBounds[2 * i + 1] - origin[i]) / spacing[i]);
+      if (outExt[i * 2] < regionExt[i * 2])
+      {
+        outExt[i * 2] = regionExt[i * 2];
+      }
+      if (outExt[i * 2 + 1] > regionExt[i * 2 + 1])
+      {
+        outExt[i * 2 + 1] = regionExt[i * 2 + 1];
+      }
+      if (outExt[i * 2] > outExt[i * 2 + 1])
+      {
+        emptyExtent = 1;
+        break;
+      }
+    }
+    if (emptyExtent)
+    {
+      continue;
+    }
+
+    vtkImageIterator<OT> outIt(outData, outExt);
+
+    for (k = outExt[4]; k <= outExt[5]; k++)
+    {
+      x[2] = spacing[2] * k + origin[2];
+      for (j = outExt[2]; j <= outExt[3]; j++)
+      {
+        x[1] = spacing[1] * j + origin[1];
+        OT* outSI = outIt.BeginSpan();
+        for (i = outExt[0]; i <= outExt[1]; i++)
+        {
+          x[0] = spacing[0] * i + origin[0];
+
+          ConvertToDoubleDistance(*outSI, distance, prevDistance2, toDoubleScaleFactor);
+
+          // union combination of distances
+          if (cell->EvaluatePosition(x, closestPoint, subId, pcoords, distance2, weights) != -1 &&
+            distance2 < prevDistance2 && distance2 <= maxDistance2)
+          {
+            distance = sqrt(distance2);
+            SetOutputDistance(distance, outSI, capValue, scaleFactor);
+          }
+          outSI++;
+        }
+        outIt.NextSpan();
+      }
+    }
+  }
+  delete[] weights;
+}
+
 // Append a data set to the existing output. To use this function,
 // you'll have to invoke the StartAppend() method before doing
 // successive appends. It's also a good idea to specify the model
@@ -814,6 +932,119 @@ void vtkImplicitModeller::EndAppend()
   this->UpdateProgress(1.0);
 }
 
+//------------------------------------------------------------------------------
+// Incrementally update the model in the voxels within MaximumDistance of the
+// given bounds; the rest of the volume keeps its previous distances.
+void vtkImplicitModeller::UpdateRegion(vtkDataSet* input, const double bounds[6])
+{
+  int i, j, k;
+  double regionBounds[6];
+  int regionExt[6];
+  vtkIdType rowStart, rowSize, sliceSize;
+  double *spacing, *origin;
+
+  vtkDebugMacro(<< "Updating region");
+
+  vtkImageData* output = this->GetOutput();
+  vtkDataArray* newScalars = output->GetPointData()->GetScalars();
+  if (!this->DataAppended || !newScalars)
+  {
+    vtkErrorMacro(<< "UpdateRegion requires a previously computed model.");
+    return;
+  }
+  if (!this->BoundsComputed)
+  {
+    this->ComputeModelBounds(input);
+  }
+
+  spacing = output->GetSpacing();
+  origin = output->GetOrigin();
+
+  // the voxels the modified geometry could have affected
+  for (i = 0; i < 3; i++)
+  {
+    regionBounds[2 * i] = bounds[2 * i] - this->InternalMaxDistance * 1.00001;
+    regionBounds[2 * i + 1] = bounds[2 * i + 1] + this->InternalMaxDistance * 1.00001;
+    regionExt[2 * i] = (int)((double)(regionBounds[2 * i] - origin[i]) / spacing[i]);
+    regionExt[2 * i + 1] = (int)((double)(regionBounds[2 * i + 1] - origin[i]) / spacing[i]) + 1;
+    if (regionExt[2 * i] < 0)
+    {
+      regionExt[2 * i] = 0;
+    }
+    if (regionExt[2 * i + 1] >= this->SampleDimensions[i])
+    {
+      regionExt[2 * i + 1] = this->SampleDimensions[i] - 1;
+    }
+    if (regionExt[2 * i] > regionExt[2 * i + 1]) // region entirely outside the model
+    {
+      return;
+    }
+  }
+
+  // reset the region to the CapValue, as StartAppend does for the whole volume
+  rowSize = this->SampleDimensions[0];
+  sliceSize = rowSize * this->SampleDimensions[1];
+  for (k = regionExt[4]; k <= regionExt[5]; k++)
+  {
+    for (j = regionExt[2]; j <= regionExt[3]; j++)
+    {
+      rowStart = k * sliceSize + j * rowSize;
+      for (i = regionExt[0]; i <= regionExt[1]; i++)
+      {
+        newScalars->SetComponent(rowStart + i, 0, this->CapValue);
+      }
+    }
+  }
+
+  // recompute the distance function there from every cell that can reach it
+  switch (this->OutputScalarType)
+  {
+    vtkTemplateMacro(vtkImplicitModellerUpdateExecute(this, input, output, regionExt, regionBounds,
+      this->InternalMaxDistance, static_cast<VTK_TT*>(nullptr)));
+  }
+
+  if (this->Capping) // the reset may have overwritten capped boundary voxels
+  {
+    this->Cap(newScalars);
+  }
+  this->UpdateProgress(1.0);
+}
+
+//------------------------------------------------------------------------------
+// Incrementally update the model in the voxels within MaximumDistance of the
+// listed cells of the input.
+void vtkImplicitModeller::UpdateCells(vtkDataSet* input, vtkIdList* modifiedCells)
+{
+  vtkIdType cellNum, numCells;
+  double bounds[6], cellBounds[6];
+  int i;
+
+  if (input == nullptr || modifiedCells == nullptr ||
+    (numCells = modifiedCells->GetNumberOfIds()) == 0)
+  {
+    return;
+  }
+
+  input->GetCellBounds(modifiedCells->GetId(0), bounds);
+  for (cellNum = 1; cellNum < numCells; cellNum++)
+  {
+    input->GetCellBounds(modifiedCells->GetId(cellNum), cellBounds);
+    for (i = 0; i < 3; i++)
+    {
+      if (cellBounds[2 * i] < bounds[2 * i])
+      {
+        bounds[2 * i] = cellBounds[2 * i];
+      }
+      if (cellBounds[2 * i + 1] > bounds[2 * i + 1])
+      {
+        bounds[2 * i + 1] = cellBounds[2 * i + 1];
+      }
+    }
+  }
+
+  this->UpdateRegion(input, bounds);
+}
+
 //------------------------------------------------------------------------------
 int vtkImplicitModeller::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
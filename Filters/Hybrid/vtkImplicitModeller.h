@@ -96,6 +96,7 @@
 
 class vtkDataArray;
 class vtkExtractGeometry;
+class vtkIdList;
 class vtkMultiThreader;
 
 class VTKFILTERSHYBRID_EXPORT vtkImplicitModeller : public vtkImageAlgorithm
@@ -275,6 +276,26 @@ public:
    */
   void EndAppend();
 
+  ///@{
+  /**
+   * Incrementally update a previously computed model after part of the input
+   * geometry has changed, instead of recomputing the whole volume. The given
+   * bounds must enclose both the old and the new positions of the modified
+   * cells. All voxels within MaximumDistance of the bounds are reset to the
+   * CapValue and the distance function is then recomputed there from every
+   * cell of the input whose distance function can reach the region; voxels
+   * outside the region keep their previous values. The filter must have
+   * executed (or StartAppend/Append/EndAppend must have been invoked) before
+   * these methods are used, and the model bounds cannot change. The second
+   * form computes the bounds from the current bounds of the listed cells of
+   * the input; if cells have moved, either invoke it once before and once
+   * after the move, or use the first form with the union of the old and new
+   * bounds.
+   */
+  void UpdateRegion(vtkDataSet* input, const double bounds[6]);
+  void UpdateCells(vtkDataSet* input, vtkIdList* modifiedCells);
+  ///@}
+
   // See the vtkAlgorithm for a description of what these do
   vtkTypeBool ProcessRequest(
     vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
@@ -63,6 +63,7 @@ vtkStandardNewMacro(vtkTemporalDataSetCache);
 vtkTemporalDataSetCache::vtkTemporalDataSetCache()
 {
   this->CacheSize = 10;
+  this->MemoryLimit = 0;
   this->SetNumberOfInputPorts(1);
   this->SetNumberOfOutputPorts(1);
   this->CacheInMemkind = false;
@@ -139,6 +140,8 @@ void vtkTemporalDataSetCache::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << " KiB" << (this->MemoryLimit ? "" : " (disabled)")
+     << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -485,9 +488,48 @@ int vtkTemporalDataSetCache::RequestData(vtkInformation* vtkNotUsed(request),
       }
     }
   }
+
+  // enforce the memory budget, ejecting least recently used entries
+  this->TrimToMemoryLimit();
+
   return 1;
 }
 
+//------------------------------------------------------------------------------
+void vtkTemporalDataSetCache::TrimToMemoryLimit()
+{
+  if (this->MemoryLimit == 0)
+  {
+    return;
+  }
+
+  // Eject the least recently used time steps (smallest update time stamp)
+  // until the accumulated cost fits the budget. The most recently used
+  // entry is always kept so that scrubbing to the current time step still
+  // hits the cache.
+  while (this->Cache.size() > 1)
+  {
+    unsigned long totalSize = 0;
+    CacheType::iterator pos = this->Cache.begin();
+    CacheType::iterator lruPos = this->Cache.begin();
+    for (; pos != this->Cache.end(); ++pos)
+    {
+      totalSize += pos->second.second->GetActualMemorySize();
+      if (pos->second.first < lruPos->second.first)
+      {
+        lruPos = pos;
+      }
+    }
+    if (totalSize <= this->MemoryLimit)
+    {
+      break;
+    }
+    this->SetEjected(lruPos->second.second);
+    lruPos->second.second->UnRegister(this);
+    this->Cache.erase(lruPos);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkTemporalDataSetCache::ReplaceCacheItem(
   vtkDataObject* input, double inTime, vtkMTimeType outputUpdateTime)
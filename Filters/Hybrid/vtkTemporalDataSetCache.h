@@ -53,6 +53,21 @@ public:
   vtkGetMacro(CacheSize, int);
   ///@}
 
+  ///@{
+  /**
+   * This is the maximum amount of memory, in kibibytes, that the cached time
+   * steps may occupy. The cost of each entry is computed with
+   * vtkDataObject::GetActualMemorySize(). When the limit is exceeded, the
+   * least recently used time steps are ejected until the cache fits the
+   * budget; the most recently used time step is always retained. A value of
+   * 0 (the default) disables the memory bound, leaving only the CacheSize
+   * count limit in effect. Note that cached time steps are shallow copies,
+   * so memory shared with the input may be accounted for more than once.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
   ///@{
   /**
    * Tells the filter that it should store the dataobjects it holds in memkind
@@ -78,6 +93,7 @@ protected:
   ~vtkTemporalDataSetCache() override;
 
   int CacheSize;
+  unsigned long MemoryLimit;
 
   typedef std::map<double, std::pair<unsigned long, vtkDataObject*>> CacheType;
   CacheType Cache;
@@ -106,6 +122,7 @@ private:
   void operator=(const vtkTemporalDataSetCache&) = delete;
 
   void ReplaceCacheItem(vtkDataObject* input, double inTime, vtkMTimeType outputUpdateTime);
+  void TrimToMemoryLimit();
   bool CacheInMemkind;
   bool IsASource;
 
@@ -28,6 +28,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -50,6 +51,7 @@ vtkTemporalInterpolator::vtkTemporalInterpolator()
 
   this->CacheData = true;
   this->NumberOfCacheEntries = 2;
+  this->ReuseInterpolationBuffers = false;
 }
 
 //------------------------------------------------------------------------------
@@ -62,6 +64,8 @@ void vtkTemporalInterpolator::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ResampleFactor: " << this->ResampleFactor << "\n";
   os << indent << "DiscreteTimeStepInterval: " << this->DiscreteTimeStepInterval << "\n";
+  os << indent
+     << "ReuseInterpolationBuffers: " << (this->ReuseInterpolationBuffers ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -209,6 +213,13 @@ int vtkTemporalInterpolator::Execute(vtkInformation*,
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
   vtkDataObject* outData = vtkDataObject::GetData(outInfo);
 
+  // Rotate the reusable output buffers. InterpolateDataArray() re-matches
+  // entries against the current bracketing arrays; anything not re-matched
+  // (i.e. whose bracketing time steps changed) is released at the end of
+  // this execution.
+  this->PreviousInterpolationBuffers.swap(this->InterpolationBuffers);
+  this->InterpolationBuffers.clear();
+
   // get the requested update times
   double upTime = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
 
@@ -251,6 +262,8 @@ int vtkTemporalInterpolator::Execute(vtkInformation*,
     originalTimes->SetValue(i, inputs[i]->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()));
   }
   outData->GetFieldData()->AddArray(originalTimes);
+
+  this->PreviousInterpolationBuffers.clear();
   return 1;
 }
 
@@ -579,10 +592,12 @@ struct vtkTemporalExecute
     auto in2 = vtk::DataArrayValueRange(input2);
     auto out = vtk::DataArrayValueRange(output);
 
-    for (vtkIdType i = 0; i < in1.size(); i++)
-    {
-      out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
-    }
+    vtkSMPTools::For(0, in1.size(), [&](vtkIdType i, vtkIdType end) {
+      for (; i < end; i++)
+      {
+        out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
+      }
+    });
   }
 };
 }
@@ -591,19 +606,32 @@ struct vtkTemporalExecute
 vtkDataArray* vtkTemporalInterpolator ::InterpolateDataArray(
   double ratio, vtkDataArray** arrays, vtkIdType numTuples)
 {
-  //
-  // Create the output
-  //
-  vtkAbstractArray* aa = vtkDataArray::CreateArray(arrays[0]->GetDataType());
-  vtkDataArray* output = vtkArrayDownCast<vtkDataArray>(aa);
-
   int numComp = arrays[0]->GetNumberOfComponents();
 
   //
-  // initialize the output
+  // Create the output, or refill the allocation retained from the previous
+  // request when the bracketing input arrays are unchanged.
   //
-  output->SetNumberOfComponents(numComp);
-  output->SetNumberOfTuples(numTuples);
+  vtkDataArray* output = nullptr;
+  if (this->ReuseInterpolationBuffers)
+  {
+    auto cached = this->PreviousInterpolationBuffers.find(arrays[0]);
+    if (cached != this->PreviousInterpolationBuffers.end() &&
+      cached->second->GetDataType() == arrays[0]->GetDataType() &&
+      cached->second->GetNumberOfComponents() == numComp &&
+      cached->second->GetNumberOfTuples() == numTuples)
+    {
+      output = cached->second;
+      output->Register(this); // the caller owns a reference
+    }
+  }
+  if (!output)
+  {
+    vtkAbstractArray* aa = vtkDataArray::CreateArray(arrays[0]->GetDataType());
+    output = vtkArrayDownCast<vtkDataArray>(aa);
+    output->SetNumberOfComponents(numComp);
+    output->SetNumberOfTuples(numTuples);
+  }
   output->SetName(arrays[0]->GetName());
 
   if (!vtkArrayDispatch::Dispatch3SameValueType::Execute(
@@ -612,5 +640,11 @@ vtkDataArray* vtkTemporalInterpolator ::InterpolateDataArray(
     vtkTemporalExecute{}(arrays[0], arrays[1], output, ratio);
   }
 
+  if (this->ReuseInterpolationBuffers)
+  {
+    this->InterpolationBuffers[arrays[0]] = output;
+    output->DataChanged();
+  }
+
   return output;
 }
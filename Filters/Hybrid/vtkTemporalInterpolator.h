@@ -58,6 +58,8 @@
 #include "vtkFiltersHybridModule.h" // For export macro
 #include "vtkMultiTimeStepAlgorithm.h"
 
+#include <map> // For reused interpolation buffers
+
 class vtkDataSet;
 class VTKFILTERSHYBRID_EXPORT vtkTemporalInterpolator : public vtkMultiTimeStepAlgorithm
 {
@@ -103,6 +105,23 @@ public:
   vtkGetMacro(CacheData, bool);
   ///@}
 
+  ///@{
+  /**
+   * When on, the interpolated output arrays are retained across requests
+   * and refilled in place as long as the bracketing input arrays are
+   * unchanged. Combined with CacheData, stepping an animation between two
+   * cached time steps then costs a single memory-bandwidth pass over the
+   * data rather than fresh allocations and copies for every requested
+   * time. Note that in this mode the arrays handed downstream are
+   * overwritten in place by the next request, so consumers must not rely
+   * on the arrays of a previous request remaining unchanged. Off by
+   * default.
+   */
+  vtkSetMacro(ReuseInterpolationBuffers, bool);
+  vtkGetMacro(ReuseInterpolationBuffers, bool);
+  vtkBooleanMacro(ReuseInterpolationBuffers, bool);
+  ///@}
+
 protected:
   vtkTemporalInterpolator();
   ~vtkTemporalInterpolator() override;
@@ -160,6 +179,15 @@ protected:
   double DeltaT;
   double Tfrac;
 
+  bool ReuseInterpolationBuffers;
+
+  // Output allocations retained across executions when
+  // ReuseInterpolationBuffers is on, keyed by the first bracketing input
+  // array. The maps are rotated on every execution so that buffers whose
+  // bracketing arrays changed are released.
+  std::map<vtkDataArray*, vtkSmartPointer<vtkDataArray>> InterpolationBuffers;
+  std::map<vtkDataArray*, vtkSmartPointer<vtkDataArray>> PreviousInterpolationBuffers;
+
 private:
   vtkTemporalInterpolator(const vtkTemporalInterpolator&) = delete;
   void operator=(const vtkTemporalInterpolator&) = delete;
@@ -21,7 +21,9 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkUniformHyperTreeGrid.h"
 
 #include "vtkHyperTreeGridNonOrientedCursor.h"
@@ -140,20 +142,39 @@ int vtkHyperTreeGridThreshold::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObje
   {
     output->ShallowCopy(input);
 
-    this->OutMask->SetNumberOfTuples(output->GetNumberOfCells());
+    vtkIdType numCells = output->GetNumberOfCells();
+    this->OutMask->SetNumberOfTuples(numCells);
 
-    // Iterate over all input and output hyper trees
+    // Collect the root indices, then process one tree per task: each
+    // recursion only reads the scalars and writes the per-cell flags of its
+    // own subtree, so the trees are independent. The flags are packed into
+    // the output mask afterwards, because concurrent vtkBitArray writes to
+    // neighboring cells would race on shared bytes.
+    this->DiscardFlags.assign(numCells, 1);
+    std::vector<vtkIdType> rootIndices;
     vtkIdType outIndex;
     vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
     output->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
     while (it.GetNextTree(outIndex))
     {
-      // Initialize new grid cursor at root of current input tree
-      output->InitializeNonOrientedCursor(outCursor, outIndex);
-      // Limit depth recursively
-      this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
-    } // it
+      rootIndices.push_back(outIndex);
+    }
+    vtkSMPTools::For(0, static_cast<vtkIdType>(rootIndices.size()),
+      [this, output, &rootIndices](vtkIdType begin, vtkIdType end) {
+        vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
+        for (vtkIdType tree = begin; tree < end; ++tree)
+        {
+          // Initialize new grid cursor at root of current tree
+          output->InitializeNonOrientedCursor(outCursor, rootIndices[tree]);
+          // Limit depth recursively
+          this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
+        }
+      });
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      this->OutMask->SetValue(cellId, this->DiscardFlags[cellId]);
+    }
+    std::vector<unsigned char>().swap(this->DiscardFlags);
   }
   else
   {
@@ -282,7 +303,7 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
   if (this->InMask && this->InMask->GetValue(outId))
   {
     // Mask output cell if necessary
-    this->OutMask->InsertTuple1(outId, discard);
+    this->DiscardFlags[outId] = 1;
 
     // Return whether current node is within range
     return discard;
@@ -305,13 +326,16 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
   }   // if (! inCursor->IsLeaf() && inCursor->GetCurrentDepth() < this->Depth)
   else
   {
-    // Input cursor is at leaf, check whether it is within range
-    double value = this->InScalars->GetTuple1(outId);
+    // Input cursor is at leaf, check whether it is within range. The tuple
+    // is read into local storage so that concurrent tree tasks do not share
+    // the data array's internal tuple buffer.
+    double value = 0.;
+    this->InScalars->GetTuple(outId, &value);
     discard = value < this->LowerThreshold || value > this->UpperThreshold;
   } // else
 
   // Mask output cell if necessary
-  this->OutMask->InsertTuple1(outId, discard);
+  this->DiscardFlags[outId] = static_cast<unsigned char>(discard);
 
   // Return whether current node is within range
   return discard;
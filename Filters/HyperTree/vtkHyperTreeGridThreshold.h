@@ -43,6 +43,8 @@
 #include "vtkFiltersHyperTreeModule.h" // For export macro
 #include "vtkHyperTreeGridAlgorithm.h"
 
+#include <vector> // For the per-cell discard flags
+
 class vtkBitArray;
 class vtkHyperTreeGrid;
 
@@ -140,6 +142,12 @@ protected:
    */
   bool JustCreateNewMask;
 
+  /**
+   * Scratch per-cell discard flags filled by the parallel mask creation
+   * path, packed into the output mask once all trees are processed.
+   */
+  std::vector<unsigned char> DiscardFlags;
+
 private:
   vtkHyperTreeGridThreshold(const vtkHyperTreeGridThreshold&) = delete;
   void operator=(const vtkHyperTreeGridThreshold&) = delete;
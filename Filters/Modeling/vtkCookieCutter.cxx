@@ -1345,6 +1345,7 @@ void vtkCookieCutterHelper::CropPoly(vtkIdType cellId, vtkIdType cellOffset, vtk
       }
     }
   }
+  pData->EditableOn(); // ResolveTopology() may edit the links
   pData->BuildLinks();
 
   // Check the topology of the edges and ensure that it is valid.  If there
@@ -24,9 +24,14 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSphere.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
 #include "vtkTriangleStrip.h"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkFillHolesFilter);
 
 //------------------------------------------------------------------------------
@@ -94,7 +99,6 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
     newPolys = inPolys;
     Mesh->SetPolys(newPolys);
   }
-  Mesh->BuildLinks();
 
   // Allocate storage for lines/points (arbitrary allocation sizes)
   //
@@ -104,36 +108,48 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
   Lines->SetLines(newLines);
   Lines->SetPoints(inPts);
 
-  // grab all free edges and place them into a temporary polydata
-  int abort = 0;
-  vtkIdType cellId, p1, p2, numNei, i, numCells = newPolys->GetNumberOfCells();
-  vtkIdType progressInterval = numCells / 20 + 1;
-  vtkIdList* neighbors = vtkIdList::New();
-  neighbors->Allocate(VTK_CELL_SIZE);
-  for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts) && !abort; cellId++)
-  {
-    if (!(cellId % progressInterval)) // manage progress / early abort
+  // Grab all free edges and place them into a temporary polydata. The mesh
+  // edges are gathered in parallel and duplicates grouped with a static edge
+  // locator: an edge referenced by exactly one polygon is free. This replaces
+  // a per-edge GetCellEdgeNeighbors() search, which degrades badly on
+  // high-degree point fans.
+  vtkIdType cellId, i, numCells = newPolys->GetNumberOfCells();
+  vtkIdType numMeshEdges = newPolys->GetNumberOfConnectivityIds();
+  typedef EdgeTuple<vtkIdType, vtkIdType> MeshEdgeType;
+  std::vector<MeshEdgeType> meshEdges(numMeshEdges);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* cellPts = tlCellPts.Local();
+    vtkIdType cellNPts;
+    const vtkIdType* cellPtsPtr;
+    for (vtkIdType cid = begin; cid < end; ++cid)
     {
-      this->UpdateProgress(static_cast<double>(cellId) / numCells);
-      abort = this->GetAbortExecute();
+      newPolys->GetCellAtId(cid, cellNPts, cellPtsPtr, cellPts);
+      vtkIdType offset = newPolys->GetOffset(cid);
+      for (vtkIdType e = 0; e < cellNPts; ++e)
+      {
+        meshEdges[offset + e] = MeshEdgeType(cellPtsPtr[e], cellPtsPtr[(e + 1) % cellNPts], cid);
+      }
     }
+  });
 
-    for (i = 0; i < npts; i++)
+  vtkIdType numUniqueEdges;
+  vtkStaticEdgeLocatorTemplate<vtkIdType, vtkIdType> edgeLocator;
+  const vtkIdType* edgeOffsets = edgeLocator.MergeEdges(numMeshEdges, meshEdges.data(), numUniqueEdges);
+  for (vtkIdType edgeId = 0; edgeId < numUniqueEdges; ++edgeId)
+  {
+    if ((edgeOffsets[edgeId + 1] - edgeOffsets[edgeId]) == 1)
     {
-      p1 = pts[i];
-      p2 = pts[(i + 1) % npts];
-
-      Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
-      numNei = neighbors->GetNumberOfIds();
-
-      if (numNei < 1)
-      {
-        newLines->InsertNextCell(2);
-        newLines->InsertCellPoint(p1);
-        newLines->InsertCellPoint(p2);
-      }
+      const MeshEdgeType& edge = meshEdges[edgeOffsets[edgeId]];
+      newLines->InsertNextCell(2);
+      newLines->InsertCellPoint(edge.V0);
+      newLines->InsertCellPoint(edge.V1);
     }
   }
+  this->UpdateProgress(0.5);
+  int abort = this->GetAbortExecute();
+  vtkIdList* neighbors = vtkIdList::New();
+  neighbors->Allocate(VTK_CELL_SIZE);
 
   // Track all free edges and see whether polygons can be built from them.
   // For each polygon of appropriate HoleSize, triangulate the hole and
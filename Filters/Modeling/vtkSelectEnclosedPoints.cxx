@@ -35,6 +35,9 @@
 #include "vtkStaticCellLocator.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkSelectEnclosedPoints);
 
 //------------------------------------------------------------------------------
@@ -43,6 +46,12 @@ vtkStandardNewMacro(vtkSelectEnclosedPoints);
 namespace
 {
 
+// Maximum number of rays fired per point and the vote margin for the in/out
+// decision, matching the serial IsInsideSurface() path (see VTK_MAX_ITER and
+// VTK_VOTE_THRESHOLD below).
+constexpr int VTK_VOTE_MAX_RAYS = 9;
+constexpr int VTK_VOTE_MARGIN = 2;
+
 //------------------------------------------------------------------------------
 // The threaded core of the algorithm. Thread on point type.
 struct SelectInOutCheck
@@ -59,11 +68,14 @@ struct SelectInOutCheck
   vtkTypeBool InsideOut;
   vtkRandomPool* Sequence;
   vtkSMPThreadLocal<vtkIntersectionCounter> Counter;
+  vtkSMPThreadLocal<vtkIntersectionCounter> Counter2;
 
   // Don't want to allocate working arrays on every thread invocation. Thread local
   // storage eliminates lots of new/delete.
   vtkSMPThreadLocalObject<vtkIdList> CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> CellIds2;
   vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Batch;
 
   SelectInOutCheck(vtkIdType numPts, vtkDataSet* ds, vtkPolyData* surface, double bds[6],
     double tol, vtkStaticCellLocator* loc, unsigned char* hits, vtkSelectEnclosedPoints* sel,
@@ -98,24 +110,128 @@ struct SelectInOutCheck
   {
     vtkIdList*& cellIds = this->CellIds.Local();
     cellIds->Allocate(512);
+    vtkIdList*& cellIds2 = this->CellIds2.Local();
+    cellIds2->Allocate(512);
     vtkIntersectionCounter& counter = this->Counter.Local();
     counter.SetTolerance(this->Tolerance);
+    vtkIntersectionCounter& counter2 = this->Counter2.Local();
+    counter2.SetTolerance(this->Tolerance);
+  }
+
+  // Batched multi-direction in/out vote. The two ray directions of a voting
+  // round are generated together and their candidate cells gathered up front,
+  // so a surface cell lying along more than one ray of the round is
+  // instantiated from the connectivity only once and intersected against all
+  // rays while hot in cache. Since candidate lists of rays emanating from the
+  // same point overlap near the point, this cuts the cell construction work
+  // of the one-ray-at-a-time loop. The vote is identical to the serial path:
+  // the vote delta changes by one per ray so it can only reach the margin of
+  // two on even ray counts, exactly where round boundaries fall.
+  int IsInsideBatched(double x[3], vtkIdType seqIdx)
+  {
+    // do a quick inside bounds check against the surface bounds
+    double* bds = this->Bounds;
+    if (x[0] < bds[0] || x[0] > bds[1] || x[1] < bds[2] || x[1] > bds[3] || x[2] < bds[4] ||
+      x[2] > bds[5])
+    {
+      return 0;
+    }
+
+    // The rays must be long enough to go from the test point all the way
+    // through the enclosing surface.
+    double offset[3], totalLength;
+    offset[0] = x[0] - ((bds[0] + bds[1]) / 2.0);
+    offset[1] = x[1] - ((bds[2] + bds[3]) / 2.0);
+    offset[2] = x[2] - ((bds[4] + bds[5]) / 2.0);
+    totalLength = this->Length + vtkMath::Norm(offset);
+
+    vtkGenericCell*& cell = this->Cell.Local();
+    vtkIdList* rayCellIds[2] = { this->CellIds.Local(), this->CellIds2.Local() };
+    vtkIntersectionCounter* counters[2] = { &this->Counter.Local(), &this->Counter2.Local() };
+    std::vector<vtkIdType>& batch = this->Batch.Local();
+
+    double rayMag, ray[3], xray[2][3], t, pcoords[3], xint[3];
+    int subId, deltaVotes = 0;
+    double tol = this->Tolerance * this->Length;
+
+    for (int numRaysFired = 0;
+         (numRaysFired < VTK_VOTE_MAX_RAYS) && (abs(deltaVotes) < VTK_VOTE_MARGIN);)
+    {
+      int raysInRound = (VTK_VOTE_MAX_RAYS - numRaysFired) > 1 ? 2 : 1;
+
+      // Define the random rays of this round and gather their candidate
+      // cells before any intersection test runs.
+      batch.clear();
+      for (int r = 0; r < raysInRound; r++)
+      {
+        rayMag = 0.0;
+        while (rayMag == 0.0)
+        {
+          ray[0] = 2.0 * (0.5 - this->Sequence->GetValue(seqIdx++));
+          ray[1] = 2.0 * (0.5 - this->Sequence->GetValue(seqIdx++));
+          ray[2] = 2.0 * (0.5 - this->Sequence->GetValue(seqIdx++));
+          rayMag = vtkMath::Norm(ray);
+        }
+        for (int i = 0; i < 3; i++)
+        {
+          xray[r][i] = x[i] + 2.0 * totalLength * (ray[i] / rayMag);
+        }
+
+        this->Locator->FindCellsAlongLine(x, xray[r], tol, rayCellIds[r]);
+        vtkIdType numCells = rayCellIds[r]->GetNumberOfIds();
+        for (vtkIdType idx = 0; idx < numCells; idx++)
+        {
+          batch.push_back(rayCellIds[r]->GetId(idx));
+        }
+        counters[r]->Reset();
+      }
+      std::sort(batch.begin(), batch.end());
+      batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+
+      // Intersect every candidate cell with all the rays of the round. Any
+      // intersection found is genuine, regardless of which ray produced the
+      // candidate.
+      for (vtkIdType cellId : batch)
+      {
+        this->Surface->GetCell(cellId, cell);
+        for (int r = 0; r < raysInRound; r++)
+        {
+          if (cell->IntersectWithLine(x, xray[r], tol, t, xint, pcoords, subId))
+          {
+            counters[r]->AddIntersection(t);
+          }
+        }
+      }
+
+      // Tally the votes of the round.
+      for (int r = 0; r < raysInRound; r++)
+      {
+        if ((counters[r]->CountIntersections() % 2) == 0) // if outside
+        {
+          --deltaVotes;
+        }
+        else // if inside
+        {
+          ++deltaVotes;
+        }
+      }
+      numRaysFired += raysInRound;
+    } // try another round of rays
+
+    // If the number of votes is positive, the point is inside
+    return (deltaVotes < 0 ? 0 : 1);
   }
 
   void operator()(vtkIdType ptId, vtkIdType endPtId)
   {
     double x[3];
     unsigned char* hits = this->Hits + ptId;
-    vtkGenericCell*& cell = this->Cell.Local();
-    vtkIdList*& cellIds = this->CellIds.Local();
-    vtkIntersectionCounter& counter = this->Counter.Local();
 
     for (; ptId < endPtId; ++ptId)
     {
       this->DataSet->GetPoint(ptId, x);
 
-      if (vtkSelectEnclosedPoints::IsInsideSurface(x, this->Surface, this->Bounds, this->Length,
-            this->Tolerance, this->Locator, cellIds, cell, counter, this->Sequence, ptId))
+      if (this->IsInsideBatched(x, ptId))
       {
         *hits++ = (this->InsideOut ? 0 : 1);
       }
@@ -146,6 +262,7 @@ vtkSelectEnclosedPoints::vtkSelectEnclosedPoints()
 
   this->CheckSurface = false;
   this->InsideOut = 0;
+  this->RetainSearchStructure = 0;
   this->Tolerance = 0.0001;
 
   this->InsideOutsideArray = nullptr;
@@ -273,7 +390,10 @@ void vtkSelectEnclosedPoints::Initialize(vtkPolyData* surface)
   surface->GetBounds(this->Bounds);
   this->Length = surface->GetLength();
 
-  // Set up structures for acceleration ray casting
+  // Set up structures for acceleration ray casting. BuildLocator() is keyed
+  // on the surface modified time: when the search structure was retained
+  // from a previous execution over the same, unmodified surface this is a
+  // no-op and the structure is reused.
   this->CellLocator->SetDataSet(surface);
   this->CellLocator->BuildLocator();
 }
@@ -485,7 +605,10 @@ int vtkSelectEnclosedPoints::FillInputPortInformation(int port, vtkInformation*
 //------------------------------------------------------------------------------
 void vtkSelectEnclosedPoints::Complete()
 {
-  this->CellLocator->FreeSearchStructure();
+  if (!this->RetainSearchStructure)
+  {
+    this->CellLocator->FreeSearchStructure();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -506,5 +629,8 @@ void vtkSelectEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Inside Out: " << (this->InsideOut ? "On\n" : "Off\n");
 
+  os << indent
+     << "Retain Search Structure: " << (this->RetainSearchStructure ? "On\n" : "Off\n");
+
   os << indent << "Tolerance: " << this->Tolerance << "\n";
 }
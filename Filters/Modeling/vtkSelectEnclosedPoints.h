@@ -130,12 +130,27 @@ public:
   vtkGetMacro(Tolerance, double);
   ///@}
 
+  ///@{
+  /**
+   * Specify whether to retain the cell locator built over the enclosing
+   * surface across executions of the filter. The locator is keyed on the
+   * surface and its modified time, so when only the query points change
+   * between executions (e.g., per-frame classification against a static
+   * hull) the search structure is reused instead of rebuilt. By default
+   * this is off and the search structure is released after each execution
+   * to save memory.
+   */
+  vtkSetMacro(RetainSearchStructure, vtkTypeBool);
+  vtkGetMacro(RetainSearchStructure, vtkTypeBool);
+  vtkBooleanMacro(RetainSearchStructure, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * This is a backdoor that can be used to test many points for containment.
    * First initialize the instance, then repeated calls to IsInsideSurface()
    * can be used without rebuilding the search structures. The Complete()
-   * method releases memory.
+   * method releases memory (unless RetainSearchStructure is on).
    */
   void Initialize(vtkPolyData* surface);
   int IsInsideSurface(double x[3]);
@@ -169,6 +184,7 @@ protected:
 
   vtkTypeBool CheckSurface;
   vtkTypeBool InsideOut;
+  vtkTypeBool RetainSearchStructure;
   double Tolerance;
 
   vtkUnsignedCharArray* InsideOutsideArray;
@@ -16,9 +16,11 @@
 
 #include "vtkGhostCellsGenerator.h"
 
+#include "vtkCommunicator.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYGhostUtilities.h"
+#include "vtkDataSet.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTreeRange.h"
 #include "vtkExplicitStructuredGrid.h"
@@ -43,11 +45,31 @@
 vtkStandardNewMacro(vtkGhostCellsGenerator);
 vtkCxxSetObjectMacro(vtkGhostCellsGenerator, Controller, vtkMultiProcessController);
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Combined modified time of all the leaves of the input, so that composite
+// inputs whose tree structure did not change still invalidate the cache when
+// one of their leaves does.
+vtkMTimeType GetInputMTime(vtkDataObject* inputDO)
+{
+  vtkMTimeType mtime = inputDO->GetMTime();
+  for (vtkDataSet* ds : vtkCompositeDataSet::GetDataSets<vtkDataSet>(inputDO))
+  {
+    mtime = std::max(mtime, ds->GetMTime());
+  }
+  return mtime;
+}
+}
+
 //----------------------------------------------------------------------------
 vtkGhostCellsGenerator::vtkGhostCellsGenerator()
   : Controller(nullptr)
   , NumberOfGhostLayers(1)
   , BuildIfRequired(true)
+  , UseOutputCache(false)
+  , CachedInputMTime(0)
+  , CachedGhostLayers(0)
 {
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
@@ -63,6 +85,10 @@ void vtkGhostCellsGenerator::Initialize()
 {
   this->NumberOfGhostLayers = 1;
   this->BuildIfRequired = true;
+  this->UseOutputCache = false;
+  this->CachedOutput = nullptr;
+  this->CachedInputMTime = 0;
+  this->CachedGhostLayers = 0;
   this->SetController(nullptr);
 }
 
@@ -91,6 +117,31 @@ int vtkGhostCellsGenerator::RequestData(
   int numberOfGhostLayersToCompute =
     this->BuildIfRequired ? reqGhostLayers : std::max(reqGhostLayers, this->NumberOfGhostLayers);
 
+  if (this->UseOutputCache)
+  {
+    // The cached output can be reused when the input is unchanged and enough
+    // ghost layers were generated last time. The decision has to be unanimous
+    // across all ranks, as regenerating on a subset of them would deadlock
+    // the ghost exchange.
+    int cacheIsValid = this->CachedOutput &&
+        this->CachedOutput->GetDataObjectType() == outputDO->GetDataObjectType() &&
+        this->CachedInputMTime == GetInputMTime(inputDO) &&
+        this->CachedGhostLayers >= numberOfGhostLayersToCompute
+      ? 1
+      : 0;
+    if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+    {
+      int globalCacheIsValid = 0;
+      this->Controller->AllReduce(&cacheIsValid, &globalCacheIsValid, 1, vtkCommunicator::MIN_OP);
+      cacheIsValid = globalCacheIsValid;
+    }
+    if (cacheIsValid)
+    {
+      outputDO->ShallowCopy(this->CachedOutput);
+      return 1;
+    }
+  }
+
   std::vector<vtkDataObject*> inputPDSs, outputPDSs;
 
   if (auto inputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(inputDO))
@@ -205,6 +256,18 @@ int vtkGhostCellsGenerator::RequestData(
         inputsPD, outputsPD, numberOfGhostLayersToCompute, this->Controller);
   }
 
+  if (this->UseOutputCache && retVal && !error)
+  {
+    this->CachedOutput.TakeReference(outputDO->NewInstance());
+    this->CachedOutput->ShallowCopy(outputDO);
+    this->CachedInputMTime = GetInputMTime(inputDO);
+    this->CachedGhostLayers = numberOfGhostLayersToCompute;
+  }
+  else
+  {
+    this->CachedOutput = nullptr;
+  }
+
   return retVal && !error;
 }
 
@@ -224,4 +287,5 @@ void vtkGhostCellsGenerator::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "UseOutputCache: " << this->UseOutputCache << endl;
 }
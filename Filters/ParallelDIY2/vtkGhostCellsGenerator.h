@@ -78,6 +78,7 @@
 
 #include "vtkFiltersParallelDIY2Module.h" // for export macros
 #include "vtkPassInputTypeAlgorithm.h"
+#include "vtkSmartPointer.h" // for the cached output
 
 class vtkMultiProcessController;
 
@@ -128,6 +129,21 @@ public:
   vtkSetClampMacro(NumberOfGhostLayers, int, 0, VTK_INT_MAX);
   ///@}
 
+  ///@{
+  /**
+   * When on, the filter keeps a reference to its last generated output and
+   * reuses it as long as the input has not been modified since and at least
+   * as many ghost layers were generated as are being requested. This skips
+   * the ghost exchange entirely when the pipeline re-executes this filter
+   * with an unchanged input, for instance because the requested number of
+   * ghost levels went down. The cache holds a shallow copy of the output and
+   * is released whenever the input changes. Default is off.
+   */
+  vtkSetMacro(UseOutputCache, bool);
+  vtkGetMacro(UseOutputCache, bool);
+  vtkBooleanMacro(UseOutputCache, bool);
+  ///@}
+
 protected:
   vtkGhostCellsGenerator();
   ~vtkGhostCellsGenerator() override;
@@ -145,6 +161,18 @@ protected:
   int NumberOfGhostLayers;
   bool BuildIfRequired;
 
+  ///@{
+  /**
+   * Output caching state. The cached output is valid for any request of at
+   * most CachedGhostLayers layers as long as the combined modified time of
+   * the input leaves still matches CachedInputMTime.
+   */
+  bool UseOutputCache;
+  vtkSmartPointer<vtkDataObject> CachedOutput;
+  vtkMTimeType CachedInputMTime;
+  int CachedGhostLayers;
+  ///@}
+
 private:
   vtkGhostCellsGenerator(const vtkGhostCellsGenerator&) = delete;
   void operator=(const vtkGhostCellsGenerator&) = delete;
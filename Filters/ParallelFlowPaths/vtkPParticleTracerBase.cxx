@@ -273,6 +273,24 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
   // Broadcast and receive size to/from all other processes.
   this->Controller->AllGather(&numParticles, allNumParticles.data(), 1);
 
+  // In the common quiescent case no rank has migrating particles; skip the
+  // message assembly and the two remaining collectives for this pass.
+  bool anyParticles = false;
+  for (int i = 0; i < this->Controller->GetNumberOfProcesses(); ++i)
+  {
+    if (allNumParticles[i] > 0)
+    {
+      anyParticles = true;
+      break;
+    }
+  }
+  if (!anyParticles)
+  {
+    rParticles.clear();
+    this->MPISendList.clear();
+    return false;
+  }
+
   // write the message
   const int size1 = sizeof(ParticleInformation);
   const int nArrays = this->ProtoPD->GetNumberOfArrays();
@@ -336,6 +354,13 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
     {
       ParticleInformation tmpParticle;
       memcpy(&tmpParticle, &recvMessage[i * typeSize], size1);
+      // cheap bounds rejection first: with the all-gathered exchange every
+      // rank sees every migrating particle, and most of them belong to some
+      // other rank's domain, so skip the locator test whenever possible
+      if (!this->InsideBounds(tmpParticle.CurrentPosition.x))
+      {
+        continue;
+      }
       // since this is first test, avoid bad cache tests
       this->GetInterpolator()->ClearCache();
       int searchResult = this->GetInterpolator()->TestPoint(tmpParticle.CurrentPosition.x);
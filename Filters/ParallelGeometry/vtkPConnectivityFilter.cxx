@@ -34,6 +34,7 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkThreshold.h"
 #include "vtkTypeList.h"
 #include "vtkUnsignedCharArray.h"
@@ -192,13 +193,14 @@ struct AssemblePointsAndRegionIdsWorker : public WorkerBase
   {
   }
 
-  bool Execute(const std::vector<int>& regionStarts,
+  bool Execute(const std::vector<int>& regionStarts, const std::vector<int>& myNeighbors,
     const vtkSmartPointer<vtkDataArray>& allBoundsArray,
     const vtkSmartPointer<vtkPointSet>& localResult,
     std::map<int, vtkSmartPointer<vtkDataArray>>& pointsForMyNeighbors,
     std::map<int, vtkSmartPointer<vtkIdTypeArray>>& regionIdsForMyNeighbors)
   {
     this->RegionStarts = &regionStarts;
+    this->MyNeighbors = &myNeighbors;
     this->LocalResult = localResult;
 
     // Output
@@ -223,13 +225,11 @@ struct AssemblePointsAndRegionIdsWorker : public WorkerBase
     TArray* pointArray = TArray::SafeDownCast(outputPoints->GetData());
     vtkPointData* outputPD = this->LocalResult->GetPointData();
     vtkIdTypeArray* pointRegionIds = vtkIdTypeArray::SafeDownCast(outputPD->GetArray("RegionId"));
-    for (int p = 0; p < this->SubController->GetNumberOfProcesses(); ++p)
+    // Only ranks whose bounds intersect ours can share points, so only
+    // assemble candidate points for those; scanning every rank makes this
+    // loop quadratic in the number of processes.
+    for (int p : *this->MyNeighbors)
     {
-      if (myRank == p)
-      {
-        continue;
-      }
-
       TArray* typedPointsForMyNeighbor = TArray::New();
       typedPointsForMyNeighbor->SetNumberOfComponents(3);
       (*this->PointsForMyNeighbors)[p].TakeReference(typedPointsForMyNeighbor);
@@ -262,6 +262,9 @@ protected:
   // Input - Starting index of the first region on each rank.
   const std::vector<int>* RegionStarts;
 
+  // Input - The ranks whose bounds intersect this rank's bounds.
+  const std::vector<int>* MyNeighbors{ nullptr };
+
   // Input - Output from the local connectivity operation.
   vtkWeakPointer<vtkPointSet> LocalResult;
 
@@ -549,8 +552,8 @@ int vtkPConnectivityFilter::RequestData(
   AssemblePointsAndRegionIdsWorker assemblePointsAndRegionIds(subController);
   std::map<int, vtkSmartPointer<vtkDataArray>> pointsForMyNeighbors;
   std::map<int, vtkSmartPointer<vtkIdTypeArray>> regionIdsForMyNeighbors;
-  if (!assemblePointsAndRegionIds.Execute(
-        regionStarts, allBoundsArray, output, pointsForMyNeighbors, regionIdsForMyNeighbors))
+  if (!assemblePointsAndRegionIds.Execute(regionStarts, myNeighbors, allBoundsArray, output,
+        pointsForMyNeighbors, regionIdsForMyNeighbors))
   {
     vtkErrorMacro(
       "Unsupported points array type encountered when assembling points and region ids.");
@@ -666,65 +669,42 @@ int vtkPConnectivityFilter::RequestData(
   subController->AllGatherV(localLinks.data(), allLinks.data(),
     static_cast<vtkIdType>(localLinks.size()), linkCounts.data(), linkStarts.data());
 
-  // Set up a graph of all the region-to-region links.
-  typedef struct _RegionNode
-  {
-    // Stored for relabeling step
-    vtkIdType OriginalRegionId;
-
-    // Current local region id
-    vtkIdType CurrentRegionId;
-
-    std::vector<vtkIdType> Links;
-  } RegionNode;
-
-  size_t linkIdx = 0;
-  std::vector<RegionNode> regionNodes(regionStarts[numRanks]);
-  for (vtkIdType regionId = 0; regionId < regionStarts[numRanks]; ++regionId)
-  {
-    regionNodes[regionId].OriginalRegionId = regionId;
-    regionNodes[regionId].CurrentRegionId = regionId;
-
-    while (linkIdx < allLinks.size() && allLinks[linkIdx] == regionId)
+  // Resolve the connected components of the region-to-region link graph with
+  // a union-find (path halving, union to the lower root). Since a union
+  // always attaches the greater root below the smaller one, the root of each
+  // set is the lowest region id in the connected component, matching the
+  // labels the previous multi-pass relabeling converged to, in near-linear
+  // time over the links.
+  vtkIdType numGlobalRegions = regionStarts[numRanks];
+  std::vector<vtkIdType> parent(numGlobalRegions);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto findRoot = [&parent](vtkIdType x) {
+    while (parent[x] != x)
     {
-      regionNodes[regionId].Links.push_back(allLinks[linkIdx + 1]);
-      linkIdx += 2;
+      parent[x] = parent[parent[x]];
+      x = parent[x];
     }
-  }
-
-  // Now run connected components on this graph. The algorithm labels all
-  // connected nodes in the graph with the lowest region id in the connected
-  // component. This is a breadth-first algorithm. I'm not 100% sure that the
-  // multiple passes in the do-while loop are required, but I suspect there may
-  // be graph configurations where a single pass is not sufficient for the
-  // relabeling to converge.
-  bool componentChanged = false;
-  do
+    return x;
+  };
+  for (size_t linkIdx = 0; linkIdx + 1 < allLinks.size(); linkIdx += 2)
   {
-    componentChanged = false;
-    for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-         nodeIter != regionNodes.end(); ++nodeIter)
+    vtkIdType rootA = findRoot(allLinks[linkIdx]);
+    vtkIdType rootB = findRoot(allLinks[linkIdx + 1]);
+    if (rootA < rootB)
     {
-      for (std::vector<vtkIdType>::iterator linkIter = nodeIter->Links.begin();
-           linkIter != nodeIter->Links.end(); ++linkIter)
-      {
-        vtkIdType linkedRegionId = *linkIter;
-        if (nodeIter->CurrentRegionId < regionNodes[linkedRegionId].CurrentRegionId)
-        {
-          regionNodes[linkedRegionId].CurrentRegionId = nodeIter->CurrentRegionId;
-          componentChanged = true;
-        }
-      }
+      parent[rootB] = rootA;
     }
-  } while (componentChanged);
+    else if (rootB < rootA)
+    {
+      parent[rootA] = rootB;
+    }
+  }
 
-  // Collect all the current ids remaining after the connected components
-  // algorithm.
+  // Collect the component roots remaining after the union-find.
   std::set<vtkIdType> currentRegionIds;
-  for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-       nodeIter != regionNodes.end(); ++nodeIter)
+  for (vtkIdType regionId = 0; regionId < numGlobalRegions; ++regionId)
   {
-    currentRegionIds.insert(nodeIter->CurrentRegionId);
+    currentRegionIds.insert(findRoot(regionId));
   }
 
   // Create a map from current region id after relabeling to a new, contiguous
@@ -737,30 +717,33 @@ int vtkPConnectivityFilter::RequestData(
     relabeledRegionMap[*setIter] = contiguousLabel++;
   }
 
-  // Now do the relabing to the contiguous region id.
-  std::vector<vtkIdType> regionIdMap(regionNodes.size(), -1);
-  for (std::vector<RegionNode>::iterator nodeIter = regionNodes.begin();
-       nodeIter != regionNodes.end(); ++nodeIter)
+  // Now map each global region id to its contiguous region id.
+  std::vector<vtkIdType> regionIdMap(numGlobalRegions, -1);
+  for (vtkIdType regionId = 0; regionId < numGlobalRegions; ++regionId)
   {
-    nodeIter->CurrentRegionId = relabeledRegionMap[nodeIter->CurrentRegionId];
+    regionIdMap[regionId] = relabeledRegionMap[findRoot(regionId)];
   }
 
   // Relabel the points and cells according to the contiguous renumbering.
   vtkCellData* outputCD = output->GetCellData();
   vtkIdTypeArray* cellRegionIds = vtkIdTypeArray::SafeDownCast(outputCD->GetArray("RegionId"));
-  for (vtkIdType i = 0; i < output->GetNumberOfCells(); ++i)
-  {
-    // Offset the cellRegionId by the starting region id on this rank.
-    vtkIdType cellRegionId = cellRegionIds->GetValue(i) + regionStarts[myRank];
-    cellRegionIds->SetValue(i, regionNodes[cellRegionId].CurrentRegionId);
-  }
+  vtkSMPTools::For(0, output->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      // Offset the cellRegionId by the starting region id on this rank.
+      vtkIdType cellRegionId = cellRegionIds->GetValue(i) + regionStarts[myRank];
+      cellRegionIds->SetValue(i, regionIdMap[cellRegionId]);
+    }
+  });
 
-  for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
-  {
-    // Offset the pointRegionId by the starting region id on this rank.
-    vtkIdType pointRegionId = pointRegionIds->GetValue(i) + regionStarts[myRank];
-    pointRegionIds->SetValue(i, regionNodes[pointRegionId].CurrentRegionId);
-  }
+  vtkSMPTools::For(0, output->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      // Offset the pointRegionId by the starting region id on this rank.
+      vtkIdType pointRegionId = pointRegionIds->GetValue(i) + regionStarts[myRank];
+      pointRegionIds->SetValue(i, regionIdMap[pointRegionId]);
+    }
+  });
 
   // Sum up number of cells in each region.
   vtkIdType numContiguousLabels = contiguousLabel;
@@ -15,6 +15,9 @@
 #include "vtkInterpolationKernel.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
 #include "vtkPointData.h"
 
 //------------------------------------------------------------------------------
@@ -80,6 +83,47 @@ void vtkInterpolationKernel::Initialize(
   }
 }
 
+//------------------------------------------------------------------------------
+// Default batch evaluation: invoke the one-at-a-time virtual API per probe,
+// concatenating the results into the caller-provided flat arrays. Kernels
+// that can share locator work across neighboring probes may override this.
+vtkIdType vtkInterpolationKernel::ComputeWeightsBatch(
+  vtkIdType numProbes, const double* probes, vtkIdList* pIds, vtkIdList* offsets,
+  vtkDoubleArray* weights)
+{
+  vtkNew<vtkIdList> basis;
+  vtkNew<vtkDoubleArray> basisWeights;
+  double x[3];
+  vtkIdType numNonEmpty = 0, total = 0;
+
+  pIds->Reset();
+  weights->Reset();
+  offsets->SetNumberOfIds(numProbes + 1);
+  offsets->SetId(0, 0);
+
+  for (vtkIdType probe = 0; probe < numProbes; ++probe)
+  {
+    x[0] = probes[3 * probe];
+    x[1] = probes[3 * probe + 1];
+    x[2] = probes[3 * probe + 2];
+
+    if (this->ComputeBasis(x, basis) > 0)
+    {
+      vtkIdType numWeights = this->ComputeWeights(x, basis, basisWeights);
+      for (vtkIdType i = 0; i < numWeights; ++i)
+      {
+        pIds->InsertNextId(basis->GetId(i));
+        weights->InsertNextValue(basisWeights->GetValue(i));
+      }
+      total += numWeights;
+      ++numNonEmpty;
+    }
+    offsets->SetId(probe + 1, total);
+  }
+
+  return numNonEmpty;
+}
+
 //------------------------------------------------------------------------------
 void vtkInterpolationKernel::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -117,6 +117,26 @@ public:
    */
   virtual vtkIdType ComputeWeights(double x[3], vtkIdList* pIds, vtkDoubleArray* weights) = 0;
 
+  /**
+   * Compute the interpolation basis and weights for a batch of probe points
+   * in a single call. The numProbes probe positions are provided in the flat
+   * array probes (3*numProbes values); callers should order the probes so
+   * that consecutive probes are spatially near one another, which keeps the
+   * locator traversal cache friendly. On output, pIds holds the concatenated
+   * basis point ids of all probes, weights the matching interpolation
+   * weights, and offsets (numProbes+1 entries) delimits the slice of
+   * pIds/weights belonging to each probe; an empty slice marks a probe with
+   * no interpolation basis (i.e., a null point). The output arrays are
+   * provided by the caller and reused across calls, so the per-probe
+   * allocations of the one-at-a-time API are amortized away. The default
+   * implementation invokes ComputeBasis() and ComputeWeights() per probe;
+   * kernels able to share work across neighboring probes may override
+   * it. The method returns the number of probes with a non-empty basis.
+   */
+  virtual vtkIdType ComputeWeightsBatch(
+    vtkIdType numProbes, const double* probes, vtkIdList* pIds, vtkIdList* offsets,
+    vtkDoubleArray* weights);
+
 protected:
   vtkInterpolationKernel();
   ~vtkInterpolationKernel() override;
@@ -31,11 +31,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -47,6 +49,11 @@ vtkCxxSetObjectMacro(vtkPointInterpolator, Kernel, vtkInterpolationKernel);
 // Helper classes to support efficient computing, and threaded execution.
 namespace
 {
+// Number of probe points handed to the kernel in one batched call. Large
+// enough to amortize the call and scratch array growth, small enough to keep
+// the flat batch results resident in cache.
+constexpr vtkIdType PROBE_BATCH_SIZE = 256;
+
 // The threaded core of the algorithm
 struct ProbePoints
 {
@@ -66,6 +73,12 @@ struct ProbePoints
   vtkSMPThreadLocalObject<vtkIdList> PIds;
   vtkSMPThreadLocalObject<vtkDoubleArray> Weights;
 
+  // Flat scratch arrays for batched kernel evaluation, reused per thread.
+  vtkSMPThreadLocal<std::vector<double>> BatchCoords;
+  vtkSMPThreadLocalObject<vtkIdList> BatchIds;
+  vtkSMPThreadLocalObject<vtkIdList> BatchOffsets;
+  vtkSMPThreadLocalObject<vtkDoubleArray> BatchWeights;
+
   ProbePoints(vtkPointInterpolator* ptInt, vtkDataSet* input, vtkPointData* inPD,
     vtkPointData* outPD, char* valid)
     : PointInterpolator(ptInt)
@@ -102,6 +115,42 @@ struct ProbePoints
     pIds->Allocate(128); // allocate some memory
     vtkDoubleArray*& weights = this->Weights.Local();
     weights->Allocate(128);
+    vtkIdList*& batchIds = this->BatchIds.Local();
+    batchIds->Allocate(128);
+    vtkIdList*& batchOffsets = this->BatchOffsets.Local();
+    batchOffsets->Allocate(PROBE_BATCH_SIZE + 1);
+    vtkDoubleArray*& batchWeights = this->BatchWeights.Local();
+    batchWeights->Allocate(128);
+  }
+
+  // Interpolate a batch of probes whose basis and weights have been gathered
+  // into the flat batch arrays by a single kernel call. Probes with an empty
+  // basis slice are null points.
+  void InterpolateBatch(vtkIdType ptId, vtkIdType batchSize, const std::vector<double>& coords,
+    vtkIdList* batchIds, vtkIdList* batchOffsets, vtkDoubleArray* batchWeights)
+  {
+    double x[3];
+    vtkIdList*& pIds = this->PIds.Local();
+    vtkDoubleArray*& weights = this->Weights.Local();
+    vtkIdType* ids = batchIds->GetPointer(0);
+    double* w = batchWeights->GetPointer(0);
+
+    for (vtkIdType i = 0; i < batchSize; ++i)
+    {
+      vtkIdType offset = batchOffsets->GetId(i);
+      vtkIdType numWeights = batchOffsets->GetId(i + 1) - offset;
+      if (numWeights > 0)
+      {
+        this->Arrays.Interpolate(numWeights, ids + offset, w + offset, ptId + i);
+      }
+      else
+      {
+        x[0] = coords[3 * i];
+        x[1] = coords[3 * i + 1];
+        x[2] = coords[3 * i + 2];
+        this->AssignNullPoint(x, pIds, weights, ptId + i);
+      } // null point
+    }
   }
 
   // When null point is encountered
@@ -127,28 +176,31 @@ struct ProbePoints
     }
   }
 
-  // Threaded interpolation method
+  // Threaded interpolation method. Probes are gathered and evaluated in
+  // batches so the kernel is invoked once per neighborhood sweep rather than
+  // once per point, with flat scratch arrays reused per thread.
   void operator()(vtkIdType ptId, vtkIdType endPtId)
   {
-    double x[3];
-    vtkIdList*& pIds = this->PIds.Local();
-    vtkIdType numWeights;
-    vtkDoubleArray*& weights = this->Weights.Local();
+    std::vector<double>& coords = this->BatchCoords.Local();
+    vtkIdList*& batchIds = this->BatchIds.Local();
+    vtkIdList*& batchOffsets = this->BatchOffsets.Local();
+    vtkDoubleArray*& batchWeights = this->BatchWeights.Local();
 
-    for (; ptId < endPtId; ++ptId)
+    while (ptId < endPtId)
     {
-      this->Input->GetPoint(ptId, x);
-
-      if (this->Kernel->ComputeBasis(x, pIds) > 0)
+      vtkIdType batchSize = std::min(endPtId - ptId, PROBE_BATCH_SIZE);
+      coords.resize(3 * batchSize);
+      for (vtkIdType i = 0; i < batchSize; ++i)
       {
-        numWeights = this->Kernel->ComputeWeights(x, pIds, weights);
-        this->Arrays.Interpolate(numWeights, pIds->GetPointer(0), weights->GetPointer(0), ptId);
+        this->Input->GetPoint(ptId + i, coords.data() + 3 * i);
       }
-      else
-      {
-        this->AssignNullPoint(x, pIds, weights, ptId);
-      } // null point
-    }   // for all dataset points
+
+      this->Kernel->ComputeWeightsBatch(
+        batchSize, coords.data(), batchIds, batchOffsets, batchWeights);
+      this->InterpolateBatch(ptId, batchSize, coords, batchIds, batchOffsets, batchWeights);
+
+      ptId += batchSize;
+    } // for all dataset points
   }
 
   void Reduce() {}
@@ -174,46 +226,44 @@ struct ImageProbePoints : public ProbePoints
     }
   }
 
-  // Threaded interpolation method specialized to image traversal
+  // Threaded interpolation method specialized to image traversal. Each
+  // x-row is evaluated as one kernel batch; consecutive probes along a row
+  // are spatially adjacent so the locator sweep stays cache friendly.
   void operator()(vtkIdType slice, vtkIdType sliceEnd)
   {
-    double x[3];
-    vtkIdType numWeights;
     double* origin = this->Origin;
     double* spacing = this->Spacing;
     int* dims = this->Dims;
-    vtkIdType ptId, jOffset, kOffset, sliceSize = dims[0] * dims[1];
-    vtkIdList*& pIds = this->PIds.Local();
-    vtkDoubleArray*& weights = this->Weights.Local();
+    vtkIdType jOffset, kOffset, sliceSize = dims[0] * dims[1];
+    std::vector<double>& coords = this->BatchCoords.Local();
+    vtkIdList*& batchIds = this->BatchIds.Local();
+    vtkIdList*& batchOffsets = this->BatchOffsets.Local();
+    vtkDoubleArray*& batchWeights = this->BatchWeights.Local();
+    coords.resize(3 * dims[0]);
 
     for (; slice < sliceEnd; ++slice)
     {
-      x[2] = origin[2] + slice * spacing[2];
+      double z = origin[2] + slice * spacing[2];
       kOffset = slice * sliceSize;
 
       for (int j = 0; j < dims[1]; ++j)
       {
-        x[1] = origin[1] + j * spacing[1];
+        double y = origin[1] + j * spacing[1];
         jOffset = j * dims[0];
 
         for (int i = 0; i < dims[0]; ++i)
         {
-          x[0] = origin[0] + i * spacing[0];
-          ptId = i + jOffset + kOffset;
-
-          if (this->Kernel->ComputeBasis(x, pIds) > 0)
-          {
-            numWeights = this->Kernel->ComputeWeights(x, pIds, weights);
-            this->Arrays.Interpolate(numWeights, pIds->GetPointer(0), weights->GetPointer(0), ptId);
-          }
-          else
-          {
-            this->AssignNullPoint(x, pIds, weights, ptId);
-          } // null point
-
-        } // over i
-      }   // over j
-    }     // over slices
+          coords[3 * i] = origin[0] + i * spacing[0];
+          coords[3 * i + 1] = y;
+          coords[3 * i + 2] = z;
+        }
+
+        this->Kernel->ComputeWeightsBatch(
+          dims[0], coords.data(), batchIds, batchOffsets, batchWeights);
+        this->InterpolateBatch(
+          jOffset + kOffset, dims[0], coords, batchIds, batchOffsets, batchWeights);
+      } // over j
+    }   // over slices
   }
 }; // ImageProbePoints
 
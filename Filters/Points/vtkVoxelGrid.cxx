@@ -49,6 +49,7 @@ struct Subsample
   const vtkIdType* BinMap;
   ArrayList Arrays;
   T* OutPoints;
+  double* Covariance; // may be nullptr if covariance output is not requested
 
   // Don't want to allocate working arrays on every thread invocation. Thread local
   // storage prevents lots of new/delete.
@@ -56,12 +57,13 @@ struct Subsample
   vtkSMPThreadLocalObject<vtkDoubleArray> Weights;
 
   Subsample(T* inPts, vtkPointData* inPD, vtkPointData* outPD, vtkStaticPointLocator* loc,
-    vtkInterpolationKernel* k, vtkIdType numOutPts, vtkIdType* binMap, T* outPts)
+    vtkInterpolationKernel* k, vtkIdType numOutPts, vtkIdType* binMap, T* outPts, double* cov)
     : InPoints(inPts)
     , Locator(loc)
     , Kernel(k)
     , BinMap(binMap)
     , OutPoints(outPts)
+    , Covariance(cov)
   {
     this->Arrays.AddArrays(numOutPts, inPD, outPD);
   }
@@ -109,6 +111,33 @@ struct Subsample
       *py++ = y[1];
       *py++ = y[2];
 
+      // If requested, compute the covariance of the point positions in this
+      // bin (about the mean position just computed). The six unique terms of
+      // the symmetric 3x3 matrix are produced in the order (xx,xy,xz,yy,yz,zz).
+      if (this->Covariance != nullptr)
+      {
+        double c[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+        double dx, dy, dz;
+        for (id = 0; id < numIds; ++id)
+        {
+          px = this->InPoints + 3 * pIds->GetId(id);
+          dx = static_cast<double>(px[0]) - y[0];
+          dy = static_cast<double>(px[1]) - y[1];
+          dz = static_cast<double>(px[2]) - y[2];
+          c[0] += dx * dx;
+          c[1] += dx * dy;
+          c[2] += dx * dz;
+          c[3] += dy * dy;
+          c[4] += dy * dz;
+          c[5] += dz * dz;
+        }
+        double* cov = this->Covariance + 6 * pointId;
+        for (int i = 0; i < 6; ++i)
+        {
+          cov[i] = c[i] / count;
+        }
+      }
+
       // Now interpolate attributes
       numWeights = this->Kernel->ComputeWeights(y, pIds, weights);
       this->Arrays.Interpolate(numWeights, pIds->GetPointer(0), weights->GetPointer(0), pointId);
@@ -118,9 +147,9 @@ struct Subsample
   void Reduce() {}
 
   static void Execute(T* inPts, vtkPointData* inPD, vtkPointData* outPD, vtkStaticPointLocator* loc,
-    vtkInterpolationKernel* k, vtkIdType numOutPts, vtkIdType* binMap, T* outPts)
+    vtkInterpolationKernel* k, vtkIdType numOutPts, vtkIdType* binMap, T* outPts, double* cov)
   {
-    Subsample subsample(inPts, inPD, outPD, loc, k, numOutPts, binMap, outPts);
+    Subsample subsample(inPts, inPD, outPD, loc, k, numOutPts, binMap, outPts, cov);
     vtkSMPTools::For(0, numOutPts, subsample);
   }
 
@@ -138,6 +167,7 @@ vtkVoxelGrid::vtkVoxelGrid()
   this->Divisions[0] = this->Divisions[1] = this->Divisions[2] = 50;
   this->LeafSize[0] = this->LeafSize[1] = this->LeafSize[2] = 1.0;
   this->NumberOfPointsPerBin = 10;
+  this->ComputeCovariance = false;
 
   this->Kernel = vtkLinearKernel::New();
 }
@@ -215,13 +245,24 @@ int vtkVoxelGrid::RequestData(vtkInformation* vtkNotUsed(request),
   this->Locator->GetDivisions(this->Divisions);
 
   // Run through the locator and compute the number of output points,
-  // and build a map of the bin number to output point. This is a prefix sum.
-  vtkIdType numOutPts = 0;
+  // and build a map of the bin number to output point. The occupancy
+  // queries are performed in parallel (over very fine grids there can be
+  // many more bins than occupied bins); the subsequent compaction into the
+  // map is a fast serial sweep over the flags.
   vtkIdType binNum, numBins = this->Locator->GetNumberOfBuckets();
+  std::vector<unsigned char> occupied(numBins);
+  vtkStaticPointLocator* loc = this->Locator;
+  vtkSMPTools::For(0, numBins, [&occupied, loc](vtkIdType bin, vtkIdType endBin) {
+    for (; bin < endBin; ++bin)
+    {
+      occupied[bin] = (loc->GetNumberOfPointsInBucket(bin) > 0 ? 1 : 0);
+    }
+  });
+  vtkIdType numOutPts = 0;
   std::vector<vtkIdType> binMap;
   for (binNum = 0; binNum < numBins; ++binNum)
   {
-    if (this->Locator->GetNumberOfPointsInBucket(binNum) > 0)
+    if (occupied[binNum])
     {
       binMap.push_back(binNum);
       ++numOutPts;
@@ -241,12 +282,31 @@ int vtkVoxelGrid::RequestData(vtkInformation* vtkNotUsed(request),
   points->SetNumberOfPoints(numOutPts);
   output->SetPoints(points);
 
+  // Optionally produce the per-voxel covariance of the binned point
+  // positions.
+  vtkDoubleArray* covArray = nullptr;
+  double* covPtr = nullptr;
+  if (this->ComputeCovariance)
+  {
+    covArray = vtkDoubleArray::New();
+    covArray->SetName("Covariance");
+    covArray->SetNumberOfComponents(6);
+    covArray->SetNumberOfTuples(numOutPts);
+    covPtr = covArray->GetPointer(0);
+  }
+
   void* inPtr = input->GetPoints()->GetVoidPointer(0);
   void* outPtr = output->GetPoints()->GetVoidPointer(0);
   switch (output->GetPoints()->GetDataType())
   {
     vtkTemplateMacro(Subsample<VTK_TT>::Execute((VTK_TT*)inPtr, inPD, outPD, this->Locator,
-      this->Kernel, numOutPts, binMap.data(), (VTK_TT*)outPtr));
+      this->Kernel, numOutPts, binMap.data(), (VTK_TT*)outPtr, covPtr));
+  }
+
+  if (covArray != nullptr)
+  {
+    outPD->AddArray(covArray);
+    covArray->Delete();
   }
 
   // Send attributes to output
@@ -284,4 +344,6 @@ void vtkVoxelGrid::PrintSelf(ostream& os, vtkIndent indent)
      << this->LeafSize[2] << ")\n";
 
   os << indent << "Number of Points Per Bin: " << this->NumberOfPointsPerBin << endl;
+
+  os << indent << "Compute Covariance: " << (this->ComputeCovariance ? "On\n" : "Off\n");
 }
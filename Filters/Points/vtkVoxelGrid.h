@@ -135,6 +135,21 @@ public:
   vtkGetObjectMacro(Kernel, vtkInterpolationKernel);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to compute, for each output point, the covariance of
+   * the input point positions falling into the associated bin. If enabled, a
+   * 6-component point data array named "Covariance" is produced containing
+   * the unique terms of the symmetric covariance matrix in the order
+   * (xx,xy,xz,yy,yz,zz). The covariance captures the local shape of the
+   * point cloud within each voxel (e.g., for surface normal or planarity
+   * estimation on the subsampled output). By default this is disabled.
+   */
+  vtkSetMacro(ComputeCovariance, vtkTypeBool);
+  vtkGetMacro(ComputeCovariance, vtkTypeBool);
+  vtkBooleanMacro(ComputeCovariance, vtkTypeBool);
+  ///@}
+
 protected:
   vtkVoxelGrid();
   ~vtkVoxelGrid() override;
@@ -146,6 +161,7 @@ protected:
   double LeafSize[3];
   int NumberOfPointsPerBin;
   vtkInterpolationKernel* Kernel;
+  vtkTypeBool ComputeCovariance;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int port, vtkInformation* info) override;
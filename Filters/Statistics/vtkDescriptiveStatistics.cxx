@@ -24,6 +24,7 @@
 #include "vtkDescriptiveStatistics.h"
 #include "vtkStatisticsAlgorithmPrivate.h"
 
+#include "vtkDataArray.h"
 #include "vtkDataObjectCollection.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
@@ -33,6 +34,8 @@
 #include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
@@ -46,6 +49,125 @@
 
 vtkObjectFactoryNewMacro(vtkDescriptiveStatistics);
 
+namespace
+{
+// One-pass (Welford-style) accumulator for the extrema and the first four
+// centered moments of a sample.
+struct MomentsAccumulator
+{
+  double N = 0.;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::min();
+  double Mean = 0.;
+  double M2 = 0.;
+  double M3 = 0.;
+  double M4 = 0.;
+
+  void Insert(double val)
+  {
+    double nm1 = this->N;
+    this->N += 1.;
+    double delta = val - this->Mean;
+    double A = delta / this->N;
+
+    this->Mean += A;
+    this->M4 +=
+      A * (A * A * delta * nm1 * (this->N * (this->N - 3.) + 3.) + 6. * A * this->M2 - 4. * this->M3);
+
+    double B = val - this->Mean;
+    this->M3 += A * (B * delta * (this->N - 2.) - 3. * this->M2);
+    this->M2 += delta * B;
+
+    this->Minimum = std::min(this->Minimum, val);
+    this->Maximum = std::max(this->Maximum, val);
+  }
+
+  // Combine another accumulator into this one, using the same pairwise
+  // update that Aggregate() applies between partial models.
+  void Merge(const MomentsAccumulator& other)
+  {
+    if (other.N == 0.)
+    {
+      return;
+    }
+    if (this->N == 0.)
+    {
+      *this = other;
+      return;
+    }
+
+    double n = this->N;
+    double n_c = other.N;
+    double N = n + n_c;
+
+    double delta = other.Mean - this->Mean;
+    double delta_sur_N = delta / N;
+    double delta2_sur_N2 = delta_sur_N * delta_sur_N;
+
+    double n2 = n * n;
+    double n_c2 = n_c * n_c;
+    double prod_n = n * n_c;
+
+    this->M4 += other.M4 + delta2_sur_N2 * delta2_sur_N2 * prod_n * (n * n2 + n_c * n_c2) +
+      6. * (n2 * other.M2 + n_c2 * this->M2) * delta2_sur_N2 +
+      4. * (n * other.M3 - n_c * this->M3) * delta_sur_N;
+
+    this->M3 += other.M3 + prod_n * (n - n_c) * delta * delta2_sur_N2 +
+      3. * (n * other.M2 - n_c * this->M2) * delta_sur_N;
+
+    this->M2 += other.M2 + prod_n * delta * delta_sur_N;
+
+    this->Mean += n_c * delta_sur_N;
+    this->N = N;
+
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+  }
+};
+
+// Accumulate the moments of a single-component data column in parallel,
+// one accumulator per thread.
+class MomentsFunctor
+{
+public:
+  MomentsFunctor(vtkDataArray* data, vtkUnsignedCharArray* ghosts, unsigned char ghostsToSkip)
+    : Data(data)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    MomentsAccumulator& acc = this->TLAccumulator.Local();
+    for (vtkIdType r = begin; r < end; ++r)
+    {
+      if (this->Ghosts && (this->Ghosts->GetValue(r) & this->GhostsToSkip))
+      {
+        continue;
+      }
+      acc.Insert(this->Data->GetComponent(r, 0));
+    }
+  }
+
+  MomentsAccumulator GetResult()
+  {
+    MomentsAccumulator result;
+    for (MomentsAccumulator& acc : this->TLAccumulator)
+    {
+      result.Merge(acc);
+    }
+    return result;
+  }
+
+private:
+  vtkDataArray* Data;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+  vtkSMPThreadLocal<MomentsAccumulator> TLAccumulator;
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 vtkDescriptiveStatistics::vtkDescriptiveStatistics()
 {
@@ -442,33 +564,55 @@ void vtkDescriptiveStatistics::Learn(
 
     if (numberOfGhostlessRow)
     {
-      double n, inv_n, val, delta, A, B;
-      vtkIdType numberOfSkippedElements = 0;
-      for (vtkIdType r = 0; r < nRow; ++r)
+      vtkDataArray* vals = vtkArrayDownCast<vtkDataArray>(inData->GetColumnByName(varName));
+      if (vals && vals->GetNumberOfComponents() == 1)
       {
-        if (ghosts && (ghosts->GetValue(r) & this->GhostsToSkip))
+        // Numeric column: accumulate the moments in a single parallel pass,
+        // one accumulator per thread, merged with the same pairwise update
+        // that Aggregate() uses between partial models.
+        MomentsFunctor functor(vals, ghosts, this->GhostsToSkip);
+        vtkSMPTools::For(0, nRow, functor);
+        MomentsAccumulator acc = functor.GetResult();
+
+        minVal = acc.Minimum;
+        maxVal = acc.Maximum;
+        mean = acc.Mean;
+        mom2 = acc.M2;
+        mom3 = acc.M3;
+        mom4 = acc.M4;
+      }
+      else
+      {
+        // Columns that are not single-component data arrays go through the
+        // variant interface one value at a time.
+        double n, inv_n, val, delta, A, B;
+        vtkIdType numberOfSkippedElements = 0;
+        for (vtkIdType r = 0; r < nRow; ++r)
         {
-          ++numberOfSkippedElements;
-          continue;
+          if (ghosts && (ghosts->GetValue(r) & this->GhostsToSkip))
+          {
+            ++numberOfSkippedElements;
+            continue;
+          }
+          n = r + 1. - numberOfSkippedElements;
+          inv_n = 1. / n;
+
+          val = inData->GetValueByName(r, varName).ToDouble();
+          delta = val - mean;
+
+          A = delta * inv_n;
+          mean += A;
+          mom4 += A *
+            (A * A * delta * (r - numberOfSkippedElements) * (n * (n - 3.) + 3.) + 6. * A * mom2 -
+              4. * mom3);
+
+          B = val - mean;
+          mom3 += A * (B * delta * (n - 2.) - 3. * mom2);
+          mom2 += delta * B;
+
+          minVal = std::min(minVal, val);
+          maxVal = std::max(maxVal, val);
         }
-        n = r + 1. - numberOfSkippedElements;
-        inv_n = 1. / n;
-
-        val = inData->GetValueByName(r, varName).ToDouble();
-        delta = val - mean;
-
-        A = delta * inv_n;
-        mean += A;
-        mom4 += A *
-          (A * A * delta * (r - numberOfSkippedElements) * (n * (n - 3.) + 3.) + 6. * A * mom2 -
-            4. * mom3);
-
-        B = val - mean;
-        mom3 += A * (B * delta * (n - 2.) - 3. * mom2);
-        mom2 += delta * B;
-
-        minVal = std::min(minVal, val);
-        maxVal = std::max(maxVal, val);
       }
     }
 
@@ -439,6 +439,36 @@ void vtkKMeansStatistics::Learn(
 
   vtkUnsignedCharArray* ghosts = inData->GetRowData()->GetGhostArray();
 
+  // When the default squared-Euclidean distance functor is in use, the
+  // per-iteration assignment step can run in parallel over a contiguous
+  // snapshot of the observation coordinates. Stateful functors (e.g.
+  // vtkKMeansDistanceFunctorCalculator) are not safe to invoke concurrently,
+  // so they keep the serial path.
+  bool parallelAssignment =
+    strcmp(this->DistanceFunctor->GetClassName(), "vtkKMeansDistanceFunctor") == 0;
+  vtkIdType numCoords = dataElements->GetNumberOfColumns();
+  vtkIdType numDataRows = dataElements->GetNumberOfRows();
+  std::vector<double> dataCoords;
+  std::vector<double> clusterCoords;
+  std::vector<vtkIdType> nearestCluster;
+  std::vector<double> nearestDistance;
+  if (parallelAssignment)
+  {
+    dataCoords.resize(numDataRows * numCoords);
+    for (vtkIdType c = 0; c < numCoords; ++c)
+    {
+      vtkDataArray* col = vtkArrayDownCast<vtkDataArray>(dataElements->GetColumn(c));
+      for (vtkIdType r = 0; r < numDataRows; ++r)
+      {
+        dataCoords[r * numCoords + c] =
+          col ? col->GetComponent(r, 0) : dataElements->GetValue(r, c).ToDouble();
+      }
+    }
+    clusterCoords.resize(numToAllocate * numCoords);
+    nearestCluster.resize(numDataRows * numRuns, -1);
+    nearestDistance.resize(numDataRows * numRuns, 0.);
+  }
+
   // Iterate until new cluster centers have converged OR we have reached a max number of iterations
   do
   {
@@ -464,41 +494,88 @@ void vtkKMeansStatistics::Learn(
     vtkIdType localMemberID, offsetLocalMemberID;
     double minDistance, curDistance;
     vtkIdType numberOfSkipedObservations = 0;
-    for (vtkIdType observation = 0; observation < dataElements->GetNumberOfRows(); observation++)
+    if (parallelAssignment)
     {
-      if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
+      // Snapshot the current cluster centers into a contiguous block.
+      for (vtkIdType j = 0; j < numToAllocate; ++j)
       {
-        ++numberOfSkipedObservations;
-        continue;
+        for (vtkIdType c = 0; c < numCoords; ++c)
+        {
+          clusterCoords[j * numCoords + c] = curClusterElements->GetValue(j, c).ToDouble();
+        }
       }
-      for (int runID = 0; runID < numRuns; runID++)
-      {
-        if (computeRun->GetValue(runID))
+
+      // Compute the nearest cluster of every observation in parallel...
+      vtkSMPTools::For(0, numDataRows, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType observation = begin; observation < end; ++observation)
         {
-          vtkIdType runStartIdx = startRunID->GetValue(runID);
-          vtkIdType runEndIdx = endRunID->GetValue(runID);
-          if (runStartIdx >= runEndIdx)
+          if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
           {
             continue;
           }
-          vtkIdType j = runStartIdx;
-          localMemberID = 0;
-          offsetLocalMemberID = runStartIdx;
-          (*this->DistanceFunctor)(
-            minDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
-          curDistance = minDistance;
-          ++j;
-          for (/* no init */; j < runEndIdx; j++)
+          const double* x = dataCoords.data() + observation * numCoords;
+          for (int runID = 0; runID < numRuns; runID++)
           {
-            (*this->DistanceFunctor)(
-              curDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
-            if (curDistance < minDistance)
+            if (!computeRun->GetValue(runID))
+            {
+              continue;
+            }
+            vtkIdType runStartIdx = startRunID->GetValue(runID);
+            vtkIdType runEndIdx = endRunID->GetValue(runID);
+            if (runStartIdx >= runEndIdx)
+            {
+              continue;
+            }
+            vtkIdType best = runStartIdx;
+            double bestDistance = 0.;
+            for (vtkIdType comp = 0; comp < numCoords; ++comp)
+            {
+              double diff = clusterCoords[runStartIdx * numCoords + comp] - x[comp];
+              bestDistance += diff * diff;
+            }
+            for (vtkIdType j = runStartIdx + 1; j < runEndIdx; ++j)
             {
-              minDistance = curDistance;
-              localMemberID = j - runStartIdx;
-              offsetLocalMemberID = j;
+              const double* center = clusterCoords.data() + j * numCoords;
+              double dist = 0.;
+              for (vtkIdType comp = 0; comp < numCoords; ++comp)
+              {
+                double diff = center[comp] - x[comp];
+                dist += diff * diff;
+              }
+              if (dist < bestDistance)
+              {
+                bestDistance = dist;
+                best = j;
+              }
             }
+            nearestCluster[observation * numRuns + runID] = best;
+            nearestDistance[observation * numRuns + runID] = bestDistance;
           }
+        }
+      });
+
+      // ... then fold the assignments into the shared model serially.
+      for (vtkIdType observation = 0; observation < numDataRows; observation++)
+      {
+        if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
+        {
+          ++numberOfSkipedObservations;
+          continue;
+        }
+        for (int runID = 0; runID < numRuns; runID++)
+        {
+          if (!computeRun->GetValue(runID))
+          {
+            continue;
+          }
+          vtkIdType runStartIdx = startRunID->GetValue(runID);
+          if (runStartIdx >= endRunID->GetValue(runID))
+          {
+            continue;
+          }
+          offsetLocalMemberID = nearestCluster[observation * numRuns + runID];
+          localMemberID = offsetLocalMemberID - runStartIdx;
+          minDistance = nearestDistance[observation * numRuns + runID];
           vtkIdType id = (observation - numberOfSkipedObservations) * numRuns + runID;
           // We've located the nearest cluster center. Has it changed since the last iteration?
           if (clusterMemberID->GetValue(id) != localMemberID)
@@ -506,9 +583,6 @@ void vtkKMeansStatistics::Learn(
             numMembershipChanges->SetValue(runID, numMembershipChanges->GetValue(runID) + 1);
             clusterMemberID->SetValue(id, localMemberID);
           }
-          // Give the distance functor a chance to modify any derived quantities used to
-          // change the cluster centers between iterations, now that we know which cluster
-          // center the observation is assigned to.
           vtkIdType newCardinality = numDataElementsInCluster->GetValue(offsetLocalMemberID) + 1;
           numDataElementsInCluster->SetValue(offsetLocalMemberID, newCardinality);
           this->DistanceFunctor->PairwiseUpdate(newClusterElements, offsetLocalMemberID,
@@ -518,6 +592,64 @@ void vtkKMeansStatistics::Learn(
         }
       }
     }
+    else
+    {
+      for (vtkIdType observation = 0; observation < dataElements->GetNumberOfRows(); observation++)
+      {
+        if (ghosts && (ghosts->GetValue(observation) & this->GhostsToSkip))
+        {
+          ++numberOfSkipedObservations;
+          continue;
+        }
+        for (int runID = 0; runID < numRuns; runID++)
+        {
+          if (computeRun->GetValue(runID))
+          {
+            vtkIdType runStartIdx = startRunID->GetValue(runID);
+            vtkIdType runEndIdx = endRunID->GetValue(runID);
+            if (runStartIdx >= runEndIdx)
+            {
+              continue;
+            }
+            vtkIdType j = runStartIdx;
+            localMemberID = 0;
+            offsetLocalMemberID = runStartIdx;
+            (*this->DistanceFunctor)(
+              minDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
+            curDistance = minDistance;
+            ++j;
+            for (/* no init */; j < runEndIdx; j++)
+            {
+              (*this->DistanceFunctor)(
+                curDistance, curClusterElements->GetRow(j), dataElements->GetRow(observation));
+              if (curDistance < minDistance)
+              {
+                minDistance = curDistance;
+                localMemberID = j - runStartIdx;
+                offsetLocalMemberID = j;
+              }
+            }
+            vtkIdType id = (observation - numberOfSkipedObservations) * numRuns + runID;
+            // We've located the nearest cluster center. Has it changed since the last iteration?
+            if (clusterMemberID->GetValue(id) != localMemberID)
+            {
+              numMembershipChanges->SetValue(runID, numMembershipChanges->GetValue(runID) + 1);
+              clusterMemberID->SetValue(id, localMemberID);
+            }
+            // Give the distance functor a chance to modify any derived quantities used to
+            // change the cluster centers between iterations, now that we know which cluster
+            // center the observation is assigned to.
+            vtkIdType newCardinality = numDataElementsInCluster->GetValue(offsetLocalMemberID) + 1;
+            numDataElementsInCluster->SetValue(offsetLocalMemberID, newCardinality);
+            this->DistanceFunctor->PairwiseUpdate(newClusterElements, offsetLocalMemberID,
+              dataElements->GetRow(observation), 1, newCardinality);
+            // Update the error for this cluster center to account for this observation.
+            error->SetValue(
+              offsetLocalMemberID, error->GetValue(offsetLocalMemberID) + minDistance);
+          }
+        }
+      }
+    }
     // update cluster centers
     this->UpdateClusterCenters(newClusterElements, curClusterElements, numMembershipChanges,
       numDataElementsInCluster, error, startRunID, endRunID, computeRun);
@@ -37,6 +37,8 @@ vtkStandardNewMacro(vtkADIOS2VTXReader);
 vtkADIOS2VTXReader::vtkADIOS2VTXReader()
   : FileName(nullptr)
   , SchemaManager(new vtx::VTXSchemaManager)
+  , CachedStep(0)
+  , HaveCachedStep(false)
 {
   this->SetNumberOfInputPorts(0);
   this->SetNumberOfOutputPorts(1);
@@ -85,7 +87,20 @@ int vtkADIOS2VTXReader::RequestData(vtkInformation* vtkNotUsed(inputVector),
   vtkMultiBlockDataSet* multiBlock = vtkMultiBlockDataSet::SafeDownCast(output);
 
   output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), this->SchemaManager->Time);
+
+  if (this->HaveCachedStep && this->CachedStep == this->SchemaManager->Step)
+  {
+    // same step requested again, reuse the decoded blocks
+    multiBlock->ShallowCopy(this->CachedBlocks);
+    return 1;
+  }
+
   this->SchemaManager->Fill(multiBlock, this->SchemaManager->Step);
+
+  this->CachedBlocks = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  this->CachedBlocks->ShallowCopy(multiBlock);
+  this->CachedStep = this->SchemaManager->Step;
+  this->HaveCachedStep = true;
   return 1;
 }
 
@@ -30,6 +30,7 @@
 
 #include "vtkIOADIOS2Module.h" // For export macro
 #include "vtkMultiBlockDataSetAlgorithm.h"
+#include "vtkSmartPointer.h" // For the cached step data
 
 // forward declaring to keep it private
 namespace vtx
@@ -40,6 +41,7 @@ class VTXSchemaManager;
 class vtkIndent;
 class vtkInformation;
 class vtkInformationvector;
+class vtkMultiBlockDataSet;
 
 class VTKIOADIOS2_EXPORT vtkADIOS2VTXReader : public vtkMultiBlockDataSetAlgorithm
 {
@@ -68,6 +70,14 @@ protected:
 private:
   char* FileName;
   std::unique_ptr<vtx::VTXSchemaManager> SchemaManager;
+
+  // Decoded blocks of the most recently filled step. When the pipeline asks
+  // for the same step again (re-renders, repeated passes over a paused
+  // stream) the blocks are shallow copied from here instead of re-reading
+  // and re-decoding from the adios2 engine.
+  vtkSmartPointer<vtkMultiBlockDataSet> CachedBlocks;
+  size_t CachedStep;
+  bool HaveCachedStep;
 };
 
 #endif /* vtkADIOS2VTXReader_h */
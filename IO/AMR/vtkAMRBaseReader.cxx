@@ -207,6 +207,22 @@ bool vtkAMRBaseReader::IsBlockMine(const int blockIdx)
   return myRank == this->GetBlockProcessId(blockIdx);
 }
 
+//------------------------------------------------------------------------------
+void vtkAMRBaseReader::SetMaxCachedBlocks(int n)
+{
+  if (this->Cache && this->Cache->GetMaxNumberOfBlocks() != n)
+  {
+    this->Cache->SetMaxNumberOfBlocks(n);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkAMRBaseReader::GetMaxCachedBlocks()
+{
+  return (this->Cache ? this->Cache->GetMaxNumberOfBlocks() : 0);
+}
+
 //------------------------------------------------------------------------------
 void vtkAMRBaseReader::InitializeArraySelections()
 {
@@ -58,6 +58,17 @@ public:
   bool IsCachingEnabled() const { return ((this->EnableCaching) ? true : false); };
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the maximum number of blocks kept in the internal cache when
+   * caching is enabled. Once the limit is reached, the least recently used
+   * blocks are dropped and re-read from disk on their next request. The
+   * default of 0 caches without bound.
+   */
+  void SetMaxCachedBlocks(int n);
+  int GetMaxCachedBlocks();
+  ///@}
+
   ///@{
   /**
    * Set/Get a multiprocess-controller for reading in parallel.
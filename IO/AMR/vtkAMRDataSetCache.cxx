@@ -24,7 +24,10 @@
 
 vtkStandardNewMacro(vtkAMRDataSetCache);
 
-vtkAMRDataSetCache::vtkAMRDataSetCache() = default;
+vtkAMRDataSetCache::vtkAMRDataSetCache()
+{
+  this->MaxNumberOfBlocks = 0;
+}
 
 //------------------------------------------------------------------------------
 vtkAMRDataSetCache::~vtkAMRDataSetCache()
@@ -43,6 +46,44 @@ vtkAMRDataSetCache::~vtkAMRDataSetCache()
 void vtkAMRDataSetCache::PrintSelf(std::ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxNumberOfBlocks: " << this->MaxNumberOfBlocks << endl;
+  os << indent << "NumberOfCachedBlocks: " << this->Cache.size() << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkAMRDataSetCache::Touch(int compositeIdx)
+{
+  std::map<int, std::list<int>::iterator>::iterator pos = this->LRUPosition.find(compositeIdx);
+  if (pos != this->LRUPosition.end())
+  {
+    this->LRUList.erase(pos->second);
+  }
+  this->LRUList.push_front(compositeIdx);
+  this->LRUPosition[compositeIdx] = this->LRUList.begin();
+}
+
+//------------------------------------------------------------------------------
+void vtkAMRDataSetCache::EvictIfNeeded()
+{
+  if (this->MaxNumberOfBlocks <= 0)
+  {
+    return;
+  }
+  while (static_cast<int>(this->Cache.size()) > this->MaxNumberOfBlocks && !this->LRUList.empty())
+  {
+    int victim = this->LRUList.back();
+    this->LRUList.pop_back();
+    this->LRUPosition.erase(victim);
+    AMRCacheType::iterator iter = this->Cache.find(victim);
+    if (iter != this->Cache.end())
+    {
+      if (iter->second != nullptr)
+      {
+        iter->second->Delete();
+      }
+      this->Cache.erase(iter);
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -54,6 +95,8 @@ void vtkAMRDataSetCache::InsertAMRBlock(int compositeIdx, vtkUniformGrid* amrGri
   if (!this->HasAMRBlock(compositeIdx))
   {
     this->Cache[compositeIdx] = amrGrid;
+    this->Touch(compositeIdx);
+    this->EvictIfNeeded();
   }
   vtkTimerLog::MarkEndEvent("AMRCache::InsertBlock");
 }
@@ -154,6 +197,7 @@ vtkUniformGrid* vtkAMRDataSetCache::GetAMRBlock(const int compositeIdx)
 {
   if (this->HasAMRBlock(compositeIdx))
   {
+    this->Touch(compositeIdx);
     return this->Cache[compositeIdx];
   }
   return nullptr;
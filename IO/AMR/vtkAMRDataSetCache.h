@@ -27,7 +27,8 @@
 
 #include "vtkIOAMRModule.h" // For export macro
 #include "vtkObject.h"
-#include <map> // For STL map used as the data-structure for the cache.
+#include <list> // For the LRU recency list.
+#include <map>  // For STL map used as the data-structure for the cache.
 
 class vtkUniformGrid;
 class vtkDataArray;
@@ -39,6 +40,16 @@ public:
   vtkTypeMacro(vtkAMRDataSetCache, vtkObject);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Set/Get the maximum number of blocks retained by the cache. When the
+   * limit is exceeded, the least recently used blocks are evicted. The
+   * default is 0, which retains every block ever inserted.
+   */
+  vtkSetMacro(MaxNumberOfBlocks, int);
+  vtkGetMacro(MaxNumberOfBlocks, int);
+  ///@}
+
   /**
    * Inserts an AMR block to the cache
    */
@@ -100,6 +111,19 @@ protected:
   typedef std::map<int, vtkUniformGrid*> AMRCacheType;
   AMRCacheType Cache;
 
+  ///@{
+  /**
+   * LRU bookkeeping: most recently used block ids are kept at the front of
+   * the recency list. Touch() moves a block to the front, EvictIfNeeded()
+   * deletes blocks from the back while the cache exceeds MaxNumberOfBlocks.
+   */
+  void Touch(int compositeIdx);
+  void EvictIfNeeded();
+  int MaxNumberOfBlocks;
+  std::list<int> LRUList;
+  std::map<int, std::list<int>::iterator> LRUPosition;
+  ///@}
+
 private:
   vtkAMRDataSetCache(const vtkAMRDataSetCache&) = delete;
   void operator=(const vtkAMRDataSetCache&) = delete;
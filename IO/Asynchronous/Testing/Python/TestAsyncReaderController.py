@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+import sys
+
+import vtk
+
+# Exercise vtkAsyncReaderController with a temporal pipeline: a sphere
+# source run through vtkGenerateTimeSteps stands in for a time-aware
+# reader.
+timeSteps = [0.0, 1.0, 2.0, 3.0]
+
+source = vtk.vtkSphereSource()
+generator = vtk.vtkGenerateTimeSteps()
+generator.SetInputConnection(source.GetOutputPort())
+for t in timeSteps:
+    generator.AddTimeStepValue(t)
+
+controller = vtk.vtkAsyncReaderController()
+controller.SetReader(generator)
+
+if not controller.UpdateInformation():
+    print('UpdateInformation failed')
+    sys.exit(1)
+
+if controller.GetNumberOfTimeSteps() != len(timeSteps):
+    print('Expected %d time steps, got %d'
+          % (len(timeSteps), controller.GetNumberOfTimeSteps()))
+    sys.exit(1)
+
+# Playback loop: fetch the current step and prefetch the next one while
+# "processing" the current data.
+controller.Initialize()
+for i in range(controller.GetNumberOfTimeSteps()):
+    t = controller.GetTimeStep(i)
+    data = controller.FetchTimeStep(t)
+    if i + 1 < controller.GetNumberOfTimeSteps():
+        controller.Prefetch(controller.GetTimeStep(i + 1))
+    if data is None or data.GetNumberOfPoints() == 0:
+        print('Fetched empty data for t=%g' % t)
+        sys.exit(1)
+    dataTime = data.GetInformation().Get(vtk.vtkDataObject.DATA_TIME_STEP())
+    if dataTime != t:
+        print('Fetched t=%g but data reports t=%g' % (t, dataTime))
+        sys.exit(1)
+
+# Fetching an already prefetched step again must also work.
+data = controller.FetchTimeStep(timeSteps[1])
+if data is None or data.GetNumberOfPoints() == 0:
+    print('Re-fetch of t=%g failed' % timeSteps[1])
+    sys.exit(1)
+controller.Finalize()
+
+# Without a worker thread FetchTimeStep reads synchronously.
+data = controller.FetchTimeStep(timeSteps[2])
+if data is None or data.GetNumberOfPoints() == 0:
+    print('Synchronous fallback failed')
+    sys.exit(1)
+
+print('All checks passed')
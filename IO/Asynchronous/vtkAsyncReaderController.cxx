@@ -0,0 +1,278 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAsyncReaderController.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAsyncReaderController.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//****************************************************************************
+class vtkAsyncReaderController::vtkInternals
+{
+public:
+  std::thread Worker;
+  std::mutex Mutex;
+  // signaled when a request is queued or the worker should exit
+  std::condition_variable RequestCondition;
+  // signaled when a read completed
+  std::condition_variable ResultCondition;
+
+  // the queued request, the read in flight, and the buffered result
+  bool HaveRequest = false;
+  double RequestedTime = 0.0;
+  bool Busy = false;
+  double BusyTime = 0.0;
+  bool HaveResult = false;
+  double ResultTime = 0.0;
+  vtkSmartPointer<vtkDataObject> Result;
+
+  bool Exit = false;
+
+  std::vector<double> TimeSteps;
+};
+
+vtkStandardNewMacro(vtkAsyncReaderController);
+
+//----------------------------------------------------------------------------
+vtkAsyncReaderController::vtkAsyncReaderController()
+{
+  this->Reader = nullptr;
+  this->OutputPort = 0;
+  this->Internals = new vtkInternals();
+}
+
+//----------------------------------------------------------------------------
+vtkAsyncReaderController::~vtkAsyncReaderController()
+{
+  this->Finalize();
+  this->SetReader(nullptr);
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkAsyncReaderController, Reader, vtkAlgorithm);
+
+//----------------------------------------------------------------------------
+bool vtkAsyncReaderController::UpdateInformation()
+{
+  if (!this->Reader)
+  {
+    vtkErrorMacro("No reader has been set.");
+    return false;
+  }
+
+  vtkInternals& internals = (*this->Internals);
+  internals.TimeSteps.clear();
+
+  this->Reader->UpdateInformation();
+  vtkInformation* outInfo = this->Reader->GetOutputInformation(this->OutputPort);
+  if (outInfo && outInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  {
+    int numTimeSteps = outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    double* timeSteps = outInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    internals.TimeSteps.assign(timeSteps, timeSteps + numTimeSteps);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkAsyncReaderController::GetNumberOfTimeSteps()
+{
+  return static_cast<vtkIdType>(this->Internals->TimeSteps.size());
+}
+
+//----------------------------------------------------------------------------
+double vtkAsyncReaderController::GetTimeStep(vtkIdType index)
+{
+  vtkInternals& internals = (*this->Internals);
+  if (index < 0 || index >= static_cast<vtkIdType>(internals.TimeSteps.size()))
+  {
+    vtkErrorMacro("Invalid time step index " << index);
+    return 0.0;
+  }
+  return internals.TimeSteps[index];
+}
+
+//----------------------------------------------------------------------------
+void vtkAsyncReaderController::Initialize()
+{
+  if (!this->Reader)
+  {
+    vtkErrorMacro("No reader has been set.");
+    return;
+  }
+
+  // wait for a running worker to terminate and start fresh
+  this->Finalize();
+
+  vtkInternals& internals = (*this->Internals);
+  internals.Exit = false;
+  internals.HaveRequest = false;
+  internals.Busy = false;
+  internals.HaveResult = false;
+  internals.Result = nullptr;
+
+  internals.Worker = std::thread([this, &internals]() {
+    for (;;)
+    {
+      double time;
+      {
+        std::unique_lock<std::mutex> lock(internals.Mutex);
+        internals.RequestCondition.wait(
+          lock, [&internals]() { return internals.HaveRequest || internals.Exit; });
+        if (internals.Exit)
+        {
+          return;
+        }
+        time = internals.RequestedTime;
+        internals.HaveRequest = false;
+        internals.Busy = true;
+        internals.BusyTime = time;
+      }
+
+      vtkSmartPointer<vtkDataObject> data = this->ReadTimeStep(time);
+
+      {
+        std::unique_lock<std::mutex> lock(internals.Mutex);
+        internals.Busy = false;
+        internals.Result = data;
+        internals.ResultTime = time;
+        internals.HaveResult = true;
+      }
+      internals.ResultCondition.notify_all();
+    }
+  });
+}
+
+//----------------------------------------------------------------------------
+void vtkAsyncReaderController::Prefetch(double time)
+{
+  vtkInternals& internals = (*this->Internals);
+  if (!internals.Worker.joinable())
+  {
+    vtkErrorMacro("Initialize() must be called before Prefetch().");
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(internals.Mutex);
+    if ((internals.HaveResult && internals.ResultTime == time) ||
+      (internals.Busy && internals.BusyTime == time))
+    {
+      return;
+    }
+    internals.RequestedTime = time;
+    internals.HaveRequest = true;
+  }
+  internals.RequestCondition.notify_one();
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkAsyncReaderController::FetchTimeStep(double time)
+{
+  vtkInternals& internals = (*this->Internals);
+  if (!internals.Worker.joinable())
+  {
+    // synchronous fallback when no worker is running
+    return this->ReadTimeStep(time);
+  }
+
+  std::unique_lock<std::mutex> lock(internals.Mutex);
+  for (;;)
+  {
+    if (internals.HaveResult && internals.ResultTime == time)
+    {
+      vtkSmartPointer<vtkDataObject> result = internals.Result;
+      internals.Result = nullptr;
+      internals.HaveResult = false;
+      return result;
+    }
+
+    // queue the request unless a read for this time is already pending
+    bool pending = (internals.HaveRequest && internals.RequestedTime == time) ||
+      (internals.Busy && internals.BusyTime == time);
+    if (!pending)
+    {
+      internals.RequestedTime = time;
+      internals.HaveRequest = true;
+      internals.RequestCondition.notify_one();
+    }
+    internals.ResultCondition.wait(lock);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkAsyncReaderController::ReadTimeStep(double time)
+{
+  vtkInformation* outInfo = this->Reader->GetOutputInformation(this->OutputPort);
+  if (outInfo)
+  {
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), time);
+  }
+  this->Reader->Update(this->OutputPort);
+  vtkDataObject* output = this->Reader->GetOutputDataObject(this->OutputPort);
+  if (!output)
+  {
+    return nullptr;
+  }
+
+  // snapshot the output so the reader can be reused for the next time step
+  // while the caller processes this one
+  vtkSmartPointer<vtkDataObject> snapshot;
+  snapshot.TakeReference(output->NewInstance());
+  snapshot->ShallowCopy(output);
+  return snapshot;
+}
+
+//----------------------------------------------------------------------------
+void vtkAsyncReaderController::Finalize()
+{
+  vtkInternals& internals = (*this->Internals);
+  if (!internals.Worker.joinable())
+  {
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(internals.Mutex);
+    internals.Exit = true;
+  }
+  internals.RequestCondition.notify_one();
+  internals.Worker.join();
+}
+
+//----------------------------------------------------------------------------
+void vtkAsyncReaderController::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  if (this->Reader)
+  {
+    os << indent << "Reader:\n";
+    this->Reader->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << indent << "Reader: (none)\n";
+  }
+  os << indent << "OutputPort: " << this->OutputPort << "\n";
+  os << indent << "NumberOfTimeSteps: " << this->GetNumberOfTimeSteps() << "\n";
+}
@@ -0,0 +1,148 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkAsyncReaderController.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class    vtkAsyncReaderController
+ * @brief    drive a reader on a worker thread and prefetch time steps
+ *
+ * @details  vtkAsyncReaderController runs any vtkAlgorithm-derived reader on
+ *           a worker thread so that reading a time step can overlap with the
+ *           processing of the previous one. The typical playback loop is:
+ *
+ *           \code
+ *           controller->SetReader(reader);
+ *           controller->UpdateInformation();
+ *           controller->Initialize();
+ *           for (vtkIdType i = 0; i < controller->GetNumberOfTimeSteps(); ++i)
+ *           {
+ *             auto data = controller->FetchTimeStep(controller->GetTimeStep(i));
+ *             if (i + 1 < controller->GetNumberOfTimeSteps())
+ *             {
+ *               controller->Prefetch(controller->GetTimeStep(i + 1));
+ *             }
+ *             // ... process data while the next step is being read ...
+ *           }
+ *           controller->Finalize();
+ *           \endcode
+ *
+ *           Time step values are the ones the reader announces through
+ *           vtkStreamingDemandDrivenPipeline::TIME_STEPS(). Each fetched
+ *           time step is returned as a shallow-copied snapshot of the reader
+ *           output, so the worker can reuse the reader for the next request.
+ *           The reader must not be updated or reconfigured by the caller
+ *           between Initialize() and Finalize().
+ */
+
+#ifndef vtkAsyncReaderController_h
+#define vtkAsyncReaderController_h
+
+#include "vtkIOAsynchronousModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For return values
+
+class vtkAlgorithm;
+class vtkDataObject;
+
+class VTKIOASYNCHRONOUS_EXPORT vtkAsyncReaderController : public vtkObject
+{
+public:
+  static vtkAsyncReaderController* New();
+  vtkTypeMacro(vtkAsyncReaderController, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the reader to drive. The controller takes a reference to the
+   * reader. Do not change the reader while the worker thread is running.
+   */
+  void SetReader(vtkAlgorithm*);
+  vtkGetObjectMacro(Reader, vtkAlgorithm);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the output port of the reader to read from. Defaults to 0.
+   */
+  vtkSetMacro(OutputPort, int);
+  vtkGetMacro(OutputPort, int);
+  ///@}
+
+  /**
+   * Update the reader information and collect the time steps it announces
+   * through vtkStreamingDemandDrivenPipeline::TIME_STEPS(). Returns false if
+   * no reader is set. Must be called before Initialize(), or after
+   * Finalize() when the reader configuration changed.
+   */
+  bool UpdateInformation();
+
+  ///@{
+  /**
+   * The time steps collected by UpdateInformation(). A reader without time
+   * support reports zero time steps; FetchTimeStep() may still be used with
+   * an arbitrary time value in that case.
+   */
+  vtkIdType GetNumberOfTimeSteps();
+  double GetTimeStep(vtkIdType index);
+  ///@}
+
+  /**
+   * Start the worker thread. Needs to be called again after Finalize() to
+   * restart the worker. Without a call to Initialize(), FetchTimeStep()
+   * falls back to reading synchronously on the calling thread.
+   */
+  void Initialize();
+
+  /**
+   * Request that the worker thread starts reading the given time step so a
+   * later FetchTimeStep() for the same value returns without waiting for
+   * I/O. Only one prefetch is buffered: a new request replaces a pending
+   * one. Does nothing when the result for this time is already buffered.
+   */
+  void Prefetch(double time);
+
+  /**
+   * Return the data for the given time step, waiting for the worker when a
+   * read for it is in flight, or issuing the read if it was not prefetched.
+   * Returns a snapshot of the reader output, or nullptr if reading failed.
+   */
+  vtkSmartPointer<vtkDataObject> FetchTimeStep(double time);
+
+  /**
+   * Wait for any in-flight read to complete and stop the worker thread.
+   */
+  void Finalize();
+
+protected:
+  vtkAsyncReaderController();
+  ~vtkAsyncReaderController() override;
+
+  /**
+   * Update the reader for the given time and snapshot its output. This is
+   * what the worker thread executes; it is also used for the synchronous
+   * fallback.
+   */
+  vtkSmartPointer<vtkDataObject> ReadTimeStep(double time);
+
+  vtkAlgorithm* Reader;
+  int OutputPort;
+
+private:
+  vtkAsyncReaderController(const vtkAsyncReaderController&) = delete;
+  void operator=(const vtkAsyncReaderController&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
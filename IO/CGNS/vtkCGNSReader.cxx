@@ -520,6 +520,8 @@ public:
   CGNSRead::vtkCGNSCache<vtkPoints> MeshPointsCache; // Cache for the mesh points
   CGNSRead::vtkCGNSCache<vtkUnstructuredGrid>
     ConnectivitiesCache; // Cache for the mesh connectivities
+  CGNSRead::vtkCGNSCache<vtkIdList>
+    PatchPointIdsCache; // Zone point ids used by cached boundary patches
 };
 
 // Helpers for FlowSolutionxxxPointers
@@ -593,6 +595,7 @@ vtkCGNSReader::vtkPrivate::~vtkPrivate()
 {
   this->MeshPointsCache.ClearCache();
   this->ConnectivitiesCache.ClearCache();
+  this->PatchPointIdsCache.ClearCache();
 
   delete this->Internal;
   this->Internal = nullptr;
@@ -3110,6 +3113,45 @@ int vtkCGNSReader::GetUnstructuredZone(
             BCInformationUns binfo(this->cgioNum, *bciter, cellDim);
             if (CGNSRead::ReadPatch(this, baseInfo, zoneInfo, binfo.FamilyName))
             {
+              // Reuse the decoded patch from the cache when stepping through
+              // time, so only the coordinates and BC data are refreshed and
+              // the NGON_n face connectivity is not re-read from the file.
+              std::string keyPatch;
+              if (this->CacheConnectivity)
+              {
+                std::ostringstream query;
+                query << "/" << baseInfo.name << "/" << zoneInfo.name << "/patch/" << binfo.Name;
+                keyPatch = query.str();
+
+                vtkSmartPointer<vtkUnstructuredGrid> cachedPatch =
+                  this->Internals->ConnectivitiesCache.Find(keyPatch);
+                vtkSmartPointer<vtkIdList> cachedPtIds =
+                  this->Internals->PatchPointIdsCache.Find(keyPatch);
+                if (cachedPatch.Get() != nullptr && cachedPtIds.Get() != nullptr)
+                {
+                  // the coordinates may move over time while the connectivity
+                  // does not; refresh them from the current zone points
+                  vtkSmartPointer<vtkPoints> bcPoints = vtkSmartPointer<vtkPoints>::New();
+                  bcPoints->SetDataType(points->GetDataType());
+                  bcPoints->SetNumberOfPoints(cachedPtIds->GetNumberOfIds());
+                  points->GetPoints(cachedPtIds.Get(), bcPoints.Get());
+                  cachedPatch->SetPoints(bcPoints.Get());
+
+                  vtkCGNSReader::vtkPrivate::readBCData(
+                    *bciter, cellDim, physicalDim, binfo.Location, cachedPatch.Get(), this);
+
+                  const unsigned int idx = patchesMB->GetNumberOfBlocks();
+                  patchesMB->SetBlock(idx, cachedPatch.Get());
+                  if (!binfo.FamilyName.empty())
+                  {
+                    patchesMB->GetMetaData(idx)->Set(
+                      vtkCGNSReader::FAMILY(), binfo.FamilyName.c_str());
+                  }
+                  patchesMB->GetMetaData(idx)->Set(vtkCompositeDataSet::NAME(), binfo.Name);
+                  continue;
+                }
+              }
+
               std::vector<vtkIdList*> bndFaceList;
               //
               // Read Polygons ...
@@ -3423,6 +3465,16 @@ int vtkCGNSReader::GetUnstructuredZone(
                 *bciter, cellDim, physicalDim, binfo.Location, bcGrid.Get(), this);
               // For Pointdata, it can be extracted from the unstructured Volume.
               //
+              if (this->CacheConnectivity)
+              {
+                // remember the patch and the zone point ids it uses so later
+                // time steps can rebuild its coordinates without touching
+                // the face connectivity in the file
+                vtkSmartPointer<vtkIdList> patchPtIds = vtkSmartPointer<vtkIdList>::New();
+                patchPtIds->DeepCopy(sortedBCPtIds.GetPointer());
+                this->Internals->PatchPointIdsCache.Insert(keyPatch, patchPtIds);
+                this->Internals->ConnectivitiesCache.Insert(keyPatch, bcGrid);
+              }
               const unsigned int idx = patchesMB->GetNumberOfBlocks();
               vtkPrivate::AddIsPatchArray(bcGrid, true);
               patchesMB->SetBlock(idx, bcGrid.Get());
@@ -5094,6 +5146,7 @@ void vtkCGNSReader::SetCacheConnectivity(bool enable)
   if (!enable)
   {
     this->Internals->ConnectivitiesCache.ClearCache();
+    this->Internals->PatchPointIdsCache.ClearCache();
   }
 }
 
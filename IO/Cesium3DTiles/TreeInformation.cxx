@@ -41,6 +41,7 @@
 #include "vtkPolyData.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkTransform.h"
@@ -438,14 +439,14 @@ void TreeInformation::SaveTilesMesh()
     }
   }
   SaveTileMeshData aux(vtkSelectionNode::CELL, textureImage);
-  this->PostOrderTraversal(&TreeInformation::SaveTileMesh, this->Root, &aux);
+  this->ForEachLeaf(&TreeInformation::SaveTileMesh, &aux);
 }
 
 //------------------------------------------------------------------------------
 void TreeInformation::SaveTilesPoints()
 {
   int selectionField = vtkSelectionNode::POINT;
-  this->PostOrderTraversal(&TreeInformation::SaveTilePoints, this->Root, &selectionField);
+  this->ForEachLeaf(&TreeInformation::SaveTilePoints, &selectionField);
 }
 
 //------------------------------------------------------------------------------
@@ -478,6 +479,49 @@ void TreeInformation::PreOrderTraversal(
   }
 }
 
+//------------------------------------------------------------------------------
+void TreeInformation::ForEachLeaf(
+  void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux), void* aux)
+{
+  std::vector<vtkIncrementalOctreeNode*> leaves;
+  std::vector<vtkIncrementalOctreeNode*> stack = { this->Root };
+  while (!stack.empty())
+  {
+    vtkIncrementalOctreeNode* node = stack.back();
+    stack.pop_back();
+    if (node->IsLeaf())
+    {
+      leaves.push_back(node);
+    }
+    else
+    {
+      for (int i = 0; i < 8; i++)
+      {
+        stack.push_back(node->GetChild(i));
+      }
+    }
+  }
+  // Saving a tile only reads the shared input, so tiles can be extracted and
+  // encoded concurrently.  Build the input's lazily computed structures up
+  // front so the worker threads do not race to create them.
+  if (this->Mesh)
+  {
+    this->Mesh->BuildCells();
+    this->Mesh->GetBounds();
+  }
+  if (this->Points)
+  {
+    this->Points->GetBounds();
+  }
+  vtkSMPTools::For(
+    0, static_cast<vtkIdType>(leaves.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        (this->*Visit)(leaves[i], aux);
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 void TreeInformation::SaveTileBuildings(vtkIncrementalOctreeNode* node, void* aux)
 {
@@ -102,6 +102,12 @@ protected:
     vtkIncrementalOctreeNode* node, void* aux);
   void PreOrderTraversal(void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux),
     vtkIncrementalOctreeNode* node, void* aux);
+  /**
+   * Visit every leaf of the octree in parallel. Used for saving tiles, which
+   * only reads the shared input data set.
+   */
+  void ForEachLeaf(
+    void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux), void* aux);
   void SaveTileset(vtkIncrementalOctreeNode* root, const std::string& output);
   nlohmann::json GenerateTileJson(vtkIncrementalOctreeNode* node);
   bool ConvertTileCartesianBuildings(vtkIncrementalOctreeNode* node);
@@ -0,0 +1,163 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCompressedImageCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// .NAME Test of vtkCompressedImageCache
+// .SECTION Description
+//
+
+#include "vtkCompressedImageCache.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+int TestCompressedImageCache(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(32, 32, 32);
+  image->AllocateScalars(VTK_FLOAT, 1);
+
+  vtkFloatArray* scalars = vtkFloatArray::SafeDownCast(image->GetPointData()->GetScalars());
+  const vtkIdType numberOfTuples = scalars->GetNumberOfTuples();
+  for (vtkIdType i = 0; i < numberOfTuples; ++i)
+  {
+    // Compressible but non-constant data.
+    scalars->SetValue(i, static_cast<float>(i % 100));
+  }
+
+  vtkNew<vtkCompressedImageCache> cache;
+  // Several blocks for this volume.
+  cache->SetBlockSize(16384);
+
+  if (!cache->Compress(image))
+  {
+    cerr << "Compress failed on a valid image" << endl;
+    return 1;
+  }
+  if (!cache->IsCompressed(image))
+  {
+    cerr << "Image not reported as compressed" << endl;
+    return 1;
+  }
+  if (image->GetPointData()->GetScalars())
+  {
+    cerr << "Scalars still resident after compression" << endl;
+    return 1;
+  }
+  if (cache->GetTotalUncompressedSize() != static_cast<size_t>(numberOfTuples) * sizeof(float))
+  {
+    cerr << "Wrong uncompressed size bookkeeping" << endl;
+    return 1;
+  }
+
+  if (!cache->Decompress(image))
+  {
+    cerr << "Decompress failed" << endl;
+    return 1;
+  }
+  if (cache->IsCompressed(image))
+  {
+    cerr << "Image still reported as compressed" << endl;
+    return 1;
+  }
+
+  scalars = vtkFloatArray::SafeDownCast(image->GetPointData()->GetScalars());
+  if (!scalars || scalars->GetNumberOfTuples() != numberOfTuples)
+  {
+    cerr << "Scalars not restored" << endl;
+    return 1;
+  }
+  for (vtkIdType i = 0; i < numberOfTuples; ++i)
+  {
+    if (scalars->GetValue(i) != static_cast<float>(i % 100))
+    {
+      cerr << "Data mismatch after round trip at tuple " << i << endl;
+      return 1;
+    }
+  }
+
+  // A pinned image must not be compressed.
+  cache->Pin(image);
+  if (cache->Compress(image))
+  {
+    cerr << "Compress succeeded on a pinned image" << endl;
+    return 1;
+  }
+  cache->Unpin(image);
+  if (!cache->Compress(image))
+  {
+    cerr << "Compress failed after unpinning" << endl;
+    return 1;
+  }
+
+  // Forget must restore the scalars before releasing the entry.
+  cache->Forget(image);
+  if (!image->GetPointData()->GetScalars())
+  {
+    cerr << "Forget dropped the scalars" << endl;
+    return 1;
+  }
+  if (cache->GetTotalCompressedSize() != 0)
+  {
+    cerr << "Cache not empty after Forget" << endl;
+    return 1;
+  }
+
+  // An unnamed active scalar array must round trip as well.
+  vtkNew<vtkImageData> unnamedImage;
+  unnamedImage->SetDimensions(16, 16, 16);
+  unnamedImage->AllocateScalars(VTK_FLOAT, 1);
+
+  scalars = vtkFloatArray::SafeDownCast(unnamedImage->GetPointData()->GetScalars());
+  scalars->SetName(nullptr);
+  const vtkIdType numberOfUnnamedTuples = scalars->GetNumberOfTuples();
+  for (vtkIdType i = 0; i < numberOfUnnamedTuples; ++i)
+  {
+    scalars->SetValue(i, static_cast<float>(i % 50));
+  }
+
+  if (!cache->Compress(unnamedImage))
+  {
+    cerr << "Compress failed on unnamed scalars" << endl;
+    return 1;
+  }
+  if (unnamedImage->GetPointData()->GetScalars() ||
+    unnamedImage->GetPointData()->GetNumberOfArrays() != 0)
+  {
+    cerr << "Unnamed scalars still resident after compression" << endl;
+    return 1;
+  }
+  if (!cache->Decompress(unnamedImage))
+  {
+    cerr << "Decompress failed on unnamed scalars" << endl;
+    return 1;
+  }
+  scalars = vtkFloatArray::SafeDownCast(unnamedImage->GetPointData()->GetScalars());
+  if (!scalars || scalars->GetName() != nullptr ||
+    scalars->GetNumberOfTuples() != numberOfUnnamedTuples)
+  {
+    cerr << "Unnamed scalars not restored" << endl;
+    return 1;
+  }
+  for (vtkIdType i = 0; i < numberOfUnnamedTuples; ++i)
+  {
+    if (scalars->GetValue(i) != static_cast<float>(i % 50))
+    {
+      cerr << "Unnamed data mismatch after round trip at tuple " << i << endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,313 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCompressedImageCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCompressedImageCache.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkLZ4DataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkCompressedImageCache);
+
+//------------------------------------------------------------------------------
+class vtkCompressedImageCache::vtkInternals
+{
+public:
+  struct Entry
+  {
+    // Keep the image alive while we hold its scalars; the map key would
+    // otherwise dangle.
+    vtkSmartPointer<vtkImageData> Image;
+    // Compressed blocks and the uncompressed size of each block, in order.
+    std::vector<vtkSmartPointer<vtkUnsignedCharArray>> Blocks;
+    std::vector<size_t> BlockSizes;
+    // Everything needed to recreate the scalar array.
+    std::string ArrayName;
+    int DataType = VTK_VOID;
+    int NumberOfComponents = 0;
+    vtkIdType NumberOfTuples = 0;
+    int PinCount = 0;
+
+    bool IsCompressed() const { return !this->Blocks.empty(); }
+  };
+
+  std::map<vtkImageData*, Entry> Entries;
+};
+
+//------------------------------------------------------------------------------
+vtkCompressedImageCache::vtkCompressedImageCache()
+{
+  this->Compressor = vtkLZ4DataCompressor::New();
+  this->BlockSize = 1 << 20;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkCompressedImageCache::~vtkCompressedImageCache()
+{
+  this->Clear();
+  delete this->Internals;
+  this->SetCompressor(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::SetCompressor(vtkDataCompressor* compressor)
+{
+  if (this->Compressor == compressor)
+  {
+    return;
+  }
+  if (this->Compressor)
+  {
+    this->Compressor->UnRegister(this);
+  }
+  this->Compressor = compressor;
+  if (this->Compressor)
+  {
+    this->Compressor->Register(this);
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompressedImageCache::Compress(vtkImageData* image)
+{
+  if (!image || !this->Compressor)
+  {
+    return false;
+  }
+
+  auto it = this->Internals->Entries.find(image);
+  if (it != this->Internals->Entries.end())
+  {
+    if (it->second.PinCount > 0)
+    {
+      return false;
+    }
+    if (it->second.IsCompressed())
+    {
+      return true;
+    }
+  }
+
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  if (!scalars || scalars->GetNumberOfTuples() == 0)
+  {
+    return false;
+  }
+
+  vtkInternals::Entry entry;
+  entry.Image = image;
+  entry.ArrayName = scalars->GetName() ? scalars->GetName() : "";
+  entry.DataType = scalars->GetDataType();
+  entry.NumberOfComponents = scalars->GetNumberOfComponents();
+  entry.NumberOfTuples = scalars->GetNumberOfTuples();
+  if (it != this->Internals->Entries.end())
+  {
+    entry.PinCount = it->second.PinCount;
+  }
+
+  const unsigned char* data = static_cast<const unsigned char*>(scalars->GetVoidPointer(0));
+  size_t remaining = static_cast<size_t>(entry.NumberOfTuples) * entry.NumberOfComponents *
+    scalars->GetDataTypeSize();
+  while (remaining > 0)
+  {
+    size_t blockSize = remaining < this->BlockSize ? remaining : this->BlockSize;
+    vtkUnsignedCharArray* block = this->Compressor->Compress(data, blockSize);
+    if (!block)
+    {
+      vtkErrorMacro("Compression failed; leaving image uncompressed.");
+      return false;
+    }
+    entry.Blocks.emplace_back(vtkSmartPointer<vtkUnsignedCharArray>::Take(block));
+    entry.BlockSizes.push_back(blockSize);
+    data += blockSize;
+    remaining -= blockSize;
+  }
+
+  // Only now that every block compressed successfully, drop the scalars.
+  // Remove by index: removing by name would be a no-op for an unnamed
+  // array, whose GetName() is nullptr.
+  vtkPointData* pointData = image->GetPointData();
+  for (int i = 0; i < pointData->GetNumberOfArrays(); ++i)
+  {
+    if (pointData->GetAbstractArray(i) == scalars)
+    {
+      pointData->RemoveArray(i);
+      break;
+    }
+  }
+  this->Internals->Entries[image] = std::move(entry);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompressedImageCache::Decompress(vtkImageData* image)
+{
+  auto it = this->Internals->Entries.find(image);
+  if (it == this->Internals->Entries.end())
+  {
+    return false;
+  }
+  vtkInternals::Entry& entry = it->second;
+  if (!entry.IsCompressed())
+  {
+    return true;
+  }
+
+  vtkSmartPointer<vtkDataArray> scalars =
+    vtkSmartPointer<vtkDataArray>::Take(vtkDataArray::CreateDataArray(entry.DataType));
+  scalars->SetName(entry.ArrayName.empty() ? nullptr : entry.ArrayName.c_str());
+  scalars->SetNumberOfComponents(entry.NumberOfComponents);
+  scalars->SetNumberOfTuples(entry.NumberOfTuples);
+
+  unsigned char* data = static_cast<unsigned char*>(scalars->GetVoidPointer(0));
+  for (size_t i = 0; i < entry.Blocks.size(); ++i)
+  {
+    vtkUnsignedCharArray* block = entry.Blocks[i];
+    size_t uncompressedSize = entry.BlockSizes[i];
+    if (this->Compressor->Uncompress(block->GetPointer(0),
+          static_cast<size_t>(block->GetNumberOfTuples()), data,
+          uncompressedSize) != uncompressedSize)
+    {
+      vtkErrorMacro("Decompression failed; compressed copy kept.");
+      return false;
+    }
+    data += uncompressedSize;
+  }
+
+  image->GetPointData()->SetScalars(scalars);
+  entry.Blocks.clear();
+  entry.BlockSizes.clear();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::Pin(vtkImageData* image)
+{
+  if (!image)
+  {
+    return;
+  }
+  auto it = this->Internals->Entries.find(image);
+  if (it == this->Internals->Entries.end())
+  {
+    vtkInternals::Entry entry;
+    entry.Image = image;
+    entry.PinCount = 1;
+    this->Internals->Entries[image] = std::move(entry);
+    return;
+  }
+  this->Decompress(image);
+  ++it->second.PinCount;
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::Unpin(vtkImageData* image)
+{
+  auto it = this->Internals->Entries.find(image);
+  if (it != this->Internals->Entries.end() && it->second.PinCount > 0)
+  {
+    --it->second.PinCount;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompressedImageCache::IsCompressed(vtkImageData* image)
+{
+  auto it = this->Internals->Entries.find(image);
+  return it != this->Internals->Entries.end() && it->second.IsCompressed();
+}
+
+//------------------------------------------------------------------------------
+size_t vtkCompressedImageCache::GetTotalCompressedSize()
+{
+  size_t total = 0;
+  for (auto& pair : this->Internals->Entries)
+  {
+    for (auto& block : pair.second.Blocks)
+    {
+      total += static_cast<size_t>(block->GetNumberOfTuples());
+    }
+  }
+  return total;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkCompressedImageCache::GetTotalUncompressedSize()
+{
+  size_t total = 0;
+  for (auto& pair : this->Internals->Entries)
+  {
+    for (size_t size : pair.second.BlockSizes)
+    {
+      total += size;
+    }
+  }
+  return total;
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::Forget(vtkImageData* image)
+{
+  auto it = this->Internals->Entries.find(image);
+  if (it == this->Internals->Entries.end())
+  {
+    return;
+  }
+  if (it->second.IsCompressed())
+  {
+    this->Decompress(image);
+  }
+  this->Internals->Entries.erase(image);
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::Clear()
+{
+  for (auto& pair : this->Internals->Entries)
+  {
+    if (pair.second.IsCompressed())
+    {
+      this->Decompress(pair.first);
+    }
+  }
+  this->Internals->Entries.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressedImageCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Compressor: ";
+  if (this->Compressor)
+  {
+    os << endl;
+    this->Compressor->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << "(none)" << endl;
+  }
+  os << indent << "BlockSize: " << this->BlockSize << endl;
+  os << indent << "NumberOfImages: " << this->Internals->Entries.size() << endl;
+}
@@ -0,0 +1,140 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCompressedImageCache.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkCompressedImageCache
+ * @brief   Keep idle image data resident in compressed form.
+ *
+ * vtkCompressedImageCache reduces the memory footprint of applications that
+ * hold many vtkImageData volumes but actively use only a few of them at a
+ * time.  Compress() replaces the active point scalars of an image with a
+ * block-compressed in-memory copy; Decompress() restores the scalars so the
+ * image can be rendered or processed again.  Compression is performed in
+ * fixed-size blocks so decompression never needs more transient memory than
+ * one block, and uses a vtkDataCompressor (vtkLZ4DataCompressor by default
+ * for fast round trips).
+ *
+ * Images that are about to be used repeatedly can be pinned with Pin(),
+ * which decompresses them and protects them from Compress() until Unpin()
+ * is called.  The cache keeps a reference to every image it manages, so
+ * entries must be released with Forget() or Clear() when an image is no
+ * longer needed.
+ *
+ * @sa
+ * vtkDataCompressor vtkLZ4DataCompressor
+ */
+
+#ifndef vtkCompressedImageCache_h
+#define vtkCompressedImageCache_h
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+class vtkDataCompressor;
+class vtkImageData;
+
+class VTKIOCORE_EXPORT vtkCompressedImageCache : public vtkObject
+{
+public:
+  static vtkCompressedImageCache* New();
+  vtkTypeMacro(vtkCompressedImageCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/get the compressor used for the in-memory copies.  The default is a
+   * vtkLZ4DataCompressor, which favors round-trip speed over ratio.
+   */
+  virtual void SetCompressor(vtkDataCompressor* compressor);
+  vtkGetObjectMacro(Compressor, vtkDataCompressor);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the uncompressed size in bytes of the blocks the scalars are
+   * split into before compression.  Default is 1 MiB.
+   */
+  vtkSetClampMacro(BlockSize, size_t, 1024, VTK_INT_MAX);
+  vtkGetMacro(BlockSize, size_t);
+  ///@}
+
+  /**
+   * Replace the active point scalars of the given image with a compressed
+   * in-memory copy and release the uncompressed array.  Returns false if
+   * the image is pinned, has no scalars, or compression fails; the image is
+   * left untouched on failure.  Calling this on an already compressed image
+   * is a no-op that returns true.
+   */
+  bool Compress(vtkImageData* image);
+
+  /**
+   * Restore the scalars of an image previously handed to Compress() and
+   * release the compressed copy.  Returns false if the image is not managed
+   * by this cache or decompression fails.  Calling this on an image that is
+   * already uncompressed is a no-op that returns true.
+   */
+  bool Decompress(vtkImageData* image);
+
+  ///@{
+  /**
+   * Pin decompresses the image if needed and prevents Compress() from
+   * touching it until Unpin() is called.  Pin/Unpin calls nest.
+   */
+  void Pin(vtkImageData* image);
+  void Unpin(vtkImageData* image);
+  ///@}
+
+  /**
+   * Return true if the scalars of the given image are currently held in
+   * compressed form.
+   */
+  bool IsCompressed(vtkImageData* image);
+
+  ///@{
+  /**
+   * Return the total number of bytes currently held in compressed form and
+   * the number of bytes those scalars occupy when uncompressed.  The ratio
+   * of the two is the memory saved by the cache.
+   */
+  size_t GetTotalCompressedSize();
+  size_t GetTotalUncompressedSize();
+  ///@}
+
+  /**
+   * Stop managing the given image.  If its scalars are compressed they are
+   * decompressed first so no data is lost.
+   */
+  void Forget(vtkImageData* image);
+
+  /**
+   * Decompress every compressed entry and stop managing all images.
+   */
+  void Clear();
+
+protected:
+  vtkCompressedImageCache();
+  ~vtkCompressedImageCache() override;
+
+  vtkDataCompressor* Compressor;
+  size_t BlockSize;
+
+private:
+  vtkCompressedImageCache(const vtkCompressedImageCache&) = delete;
+  void operator=(const vtkCompressedImageCache&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -202,6 +202,10 @@ public:
   typedef std::map<MapKey, MapValue>::value_type value_type;
 
   std::map<MapKey, MapValue> Map;
+
+  // Number of time steps per file, so the full-file counting scan is only
+  // performed once per transient geometry file.
+  std::map<MapKey, int> TimeStepCountMap;
 };
 
 // This is half the precision of an int.
@@ -402,16 +406,29 @@ int vtkEnSightGoldBinaryReader::ReadGeometryFile(
     return 0;
   }
 
-  // this will close the file, so we need to reinitialize it
-  int numberOfTimeStepsInFile = this->CountTimeSteps();
-
-  if (!this->InitializeFile(fileName))
-  {
-    return 0;
-  }
-
   if (this->UseFileSets)
   {
+    // Counting the time steps scans the entire file, which dominates load
+    // time for large transient cases.  Do it only on the first visit and
+    // reuse the cached count for every subsequent time step.
+    int numberOfTimeStepsInFile;
+    auto countIter = this->FileOffsets->TimeStepCountMap.find(fileName);
+    if (countIter != this->FileOffsets->TimeStepCountMap.end())
+    {
+      numberOfTimeStepsInFile = countIter->second;
+    }
+    else
+    {
+      // this will close the file, so we need to reinitialize it
+      numberOfTimeStepsInFile = this->CountTimeSteps();
+      this->FileOffsets->TimeStepCountMap[fileName] = numberOfTimeStepsInFile;
+
+      if (!this->InitializeFile(fileName))
+      {
+        return 0;
+      }
+    }
+
     if (numberOfTimeStepsInFile > 1)
     {
       this->AddFileIndexToCache(fileName);
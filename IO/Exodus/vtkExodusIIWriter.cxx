@@ -39,6 +39,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPlatform.h" // for VTK_MAXPATH
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -951,6 +952,28 @@ int vtkExodusIIWriter::ConstructBlockInfoMap()
     index++;
   }
 
+  // Cache the output element index of every input cell.  The per-variable
+  // extraction loops used to look the block up in BlockInfoMap for each cell
+  // of each component of each variable at each timestep; resolve the mapping
+  // once here instead.
+  this->CellToElementIndex.resize(this->FlattenedInput.size());
+  for (size_t i = 0; i < this->FlattenedInput.size(); i++)
+  {
+    vtkIdType ncells = this->FlattenedInput[i]->GetNumberOfCells();
+    this->CellToElementIndex[i].resize(ncells);
+    for (vtkIdType j = 0; j < ncells; j++)
+    {
+      iter = this->BlockInfoMap.find(this->BlockIdList[i]->GetValue(j));
+      if (iter == this->BlockInfoMap.end())
+      {
+        vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
+        this->CellToElementIndex[i][j] = -1;
+        continue;
+      }
+      this->CellToElementIndex[i][j] = iter->second.ElementStartIndex + CellToElementOffset[i][j];
+    }
+  }
+
   return 1;
 }
 
@@ -2845,6 +2868,28 @@ double vtkExodusIIWriterGetComponent(iterT* it, vtkIdType ind)
   return v.ToDouble();
 }
 
+// Gather one component of `it` into the output buffer handed to the Exodus
+// library.  The type dispatch happens once per array rather than once per
+// value, and the gather is threaded since every value lands at a distinct
+// destination.  `destIndices` maps each tuple to its output element index
+// (negative entries are skipped); when null, values are stored sequentially.
+template <typename iterT, typename OutT>
+void vtkExodusIIWriterExtractComponent(
+  iterT* it, vtkIdType ntuples, vtkIdType ncomp, int comp, const int* destIndices, OutT* out)
+{
+  vtkSMPTools::For(0, ntuples, [=](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType j = begin; j < end; j++)
+    {
+      if (destIndices && destIndices[j] < 0)
+      {
+        continue;
+      }
+      vtkVariant v(it->GetValue(j * ncomp + comp));
+      out[destIndices ? destIndices[j] : j] = static_cast<OutT>(v.ToDouble());
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 double vtkExodusIIWriter::ExtractGlobalData(const char* name, int comp, int ts)
 {
@@ -2882,24 +2927,27 @@ void vtkExodusIIWriter::ExtractCellData(const char* name, int comp, vtkDataArray
   {
     vtkDataArray* da = this->FlattenedInput[i]->GetCellData()->GetArray(name);
     int ncells = this->FlattenedInput[i]->GetNumberOfCells();
+    const int* cellToIndex = this->CellToElementIndex[i].data();
     if (da)
     {
       vtkArrayIterator* arrayIter = da->NewIterator();
       vtkIdType ncomp = da->GetNumberOfComponents();
-      for (vtkIdType j = 0; j < ncells; j++)
+      if (buffer->IsA("vtkDoubleArray"))
       {
-        std::map<int, Block>::const_iterator blockIter =
-          this->BlockInfoMap.find(this->BlockIdList[i]->GetValue(j));
-        if (blockIter == this->BlockInfoMap.end())
+        double* out = vtkArrayDownCast<vtkDoubleArray>(buffer)->GetPointer(0);
+        switch (da->GetDataType())
         {
-          vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
-          continue;
+          vtkArrayIteratorTemplateMacro(vtkExodusIIWriterExtractComponent(
+            static_cast<VTK_TT*>(arrayIter), ncells, ncomp, comp, cellToIndex, out));
         }
-        int index = blockIter->second.ElementStartIndex + CellToElementOffset[i][j];
+      }
+      else /* (buffer->IsA ("vtkFloatArray")) */
+      {
+        float* out = vtkArrayDownCast<vtkFloatArray>(buffer)->GetPointer(0);
         switch (da->GetDataType())
         {
-          vtkArrayIteratorTemplateMacro(buffer->SetTuple1(index,
-            vtkExodusIIWriterGetComponent(static_cast<VTK_TT*>(arrayIter), j * ncomp + comp)));
+          vtkArrayIteratorTemplateMacro(vtkExodusIIWriterExtractComponent(
+            static_cast<VTK_TT*>(arrayIter), ncells, ncomp, comp, cellToIndex, out));
         }
       }
       arrayIter->Delete();
@@ -2908,15 +2956,11 @@ void vtkExodusIIWriter::ExtractCellData(const char* name, int comp, vtkDataArray
     {
       for (vtkIdType j = 0; j < ncells; j++)
       {
-        std::map<int, Block>::const_iterator blockIter =
-          this->BlockInfoMap.find(this->BlockIdList[i]->GetValue(j));
-        if (blockIter == this->BlockInfoMap.end())
+        if (cellToIndex[j] < 0)
         {
-          vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
           continue;
         }
-        int index = blockIter->second.ElementStartIndex + CellToElementOffset[i][j];
-        buffer->SetTuple1(index, 0);
+        buffer->SetTuple1(cellToIndex[j], 0);
       }
     }
   }
@@ -2934,15 +2978,26 @@ void vtkExodusIIWriter::ExtractPointData(const char* name, int comp, vtkDataArra
     {
       vtkArrayIterator* iter = da->NewIterator();
       vtkIdType ncomp = da->GetNumberOfComponents();
-      vtkIdType nvals = ncomp * da->GetNumberOfTuples();
-      for (vtkIdType j = comp; j < nvals; j += ncomp)
+      vtkIdType ntuples = da->GetNumberOfTuples();
+      if (buffer->IsA("vtkDoubleArray"))
+      {
+        double* out = vtkArrayDownCast<vtkDoubleArray>(buffer)->GetPointer(index);
+        switch (da->GetDataType())
+        {
+          vtkArrayIteratorTemplateMacro(vtkExodusIIWriterExtractComponent(
+            static_cast<VTK_TT*>(iter), ntuples, ncomp, comp, nullptr, out));
+        }
+      }
+      else /* (buffer->IsA ("vtkFloatArray")) */
       {
+        float* out = vtkArrayDownCast<vtkFloatArray>(buffer)->GetPointer(index);
         switch (da->GetDataType())
         {
-          vtkArrayIteratorTemplateMacro(buffer->SetTuple1(
-            index++, vtkExodusIIWriterGetComponent(static_cast<VTK_TT*>(iter), j)));
+          vtkArrayIteratorTemplateMacro(vtkExodusIIWriterExtractComponent(
+            static_cast<VTK_TT*>(iter), ntuples, ncomp, comp, nullptr, out));
         }
       }
+      index += ntuples;
       iter->Delete();
     }
     else
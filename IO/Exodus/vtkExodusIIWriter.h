@@ -272,6 +272,11 @@ protected:
 
   std::vector<std::vector<int>> CellToElementOffset;
 
+  // Per flattened input, the output element index of each cell (block start
+  // index plus offset within the block), resolved once in
+  // ConstructBlockInfoMap so the extraction loops need no map lookups.
+  std::vector<std::vector<int>> CellToElementIndex;
+
   // By BlockId, and within block ID by element variable, with variables
   // appearing in the same order in which they appear in OutputElementArrayNames
 
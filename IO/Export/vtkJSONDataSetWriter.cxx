@@ -27,6 +27,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTypeInt32Array.h"
 #include "vtkTypeInt64Array.h"
@@ -36,6 +37,8 @@
 #include "vtksys/MD5.h"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <climits>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -143,13 +146,17 @@ std::string vtkJSONDataSetWriter::WriteArray(
 {
   bool needConvert;
   std::string id = vtkJSONDataSetWriter::GetUID(array, needConvert);
-  std::stringstream arrayPath;
-  arrayPath << "data/" << id;
-  bool success = vtkJSONDataSetWriter::WriteArrayContents(array, arrayPath.str().c_str());
-
-  if (!success)
+  // Arrays with the same unique identifier have the same contents and map to
+  // the same file, so serialize them only once per Write().
+  if (this->WrittenArrayIds.insert(id).second)
   {
-    return "{}";
+    std::stringstream arrayPath;
+    arrayPath << "data/" << id;
+    if (!this->WriteArrayContents(array, arrayPath.str().c_str()))
+    {
+      this->WrittenArrayIds.erase(id);
+      return "{}";
+    }
   }
 
   const char* INDENT = "    ";
@@ -178,6 +185,7 @@ void vtkJSONDataSetWriter::Write(vtkDataSet* dataset)
   vtkImageData* imageData = vtkImageData::SafeDownCast(dataset);
   vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataset);
   this->ValidDataSet = false;
+  this->WrittenArrayIds.clear();
 
   // Get input and check data
   if (dataset == nullptr)
@@ -311,10 +319,12 @@ bool vtkJSONDataSetWriter::WriteArrayContents(vtkDataArray* input, const char* f
         vtkNew<vtkTypeUInt32Array> uint32;
         uint32->SetNumberOfValues(arraySize);
         uint32->SetName(input->GetName());
-        for (vtkIdType i = 0; i < arraySize; i++)
-        {
-          uint32->SetValue(i, srcUInt64->GetValue(i));
-        }
+        vtkSMPTools::For(0, arraySize, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; i++)
+          {
+            uint32->SetValue(i, srcUInt64->GetValue(i));
+          }
+        });
         arrayToWrite = uint32;
       }
       break;
@@ -328,10 +338,12 @@ bool vtkJSONDataSetWriter::WriteArrayContents(vtkDataArray* input, const char* f
         vtkNew<vtkTypeInt32Array> int32;
         int32->SetNumberOfTuples(arraySize);
         int32->SetName(input->GetName());
-        for (vtkIdType i = 0; i < arraySize; i++)
-        {
-          int32->SetValue(i, srcInt64->GetValue(i));
-        }
+        vtkSMPTools::For(0, arraySize, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; i++)
+          {
+            int32->SetValue(i, srcInt64->GetValue(i));
+          }
+        });
         arrayToWrite = int32;
       }
       break;
@@ -399,7 +411,7 @@ int vtkJSONDataSetWriter::FillInputPortInformation(int, vtkInformation* info)
 // Static helper functions
 //------------------------------------------------------------------------------
 
-void vtkJSONDataSetWriter::ComputeMD5(const unsigned char* content, int size, std::string& hash)
+void vtkJSONDataSetWriter::ComputeMD5(const unsigned char* content, size_t size, std::string& hash)
 {
   unsigned char digest[16];
   char md5Hash[33];
@@ -407,7 +419,15 @@ void vtkJSONDataSetWriter::ComputeMD5(const unsigned char* content, int size, st
 
   vtksysMD5* md5 = vtksysMD5_New();
   vtksysMD5_Initialize(md5);
-  vtksysMD5_Append(md5, content, size);
+  // vtksysMD5_Append takes an int length, so digest buffers larger than 2GB
+  // in chunks
+  while (size > static_cast<size_t>(INT_MAX))
+  {
+    vtksysMD5_Append(md5, content, INT_MAX);
+    content += INT_MAX;
+    size -= INT_MAX;
+  }
+  vtksysMD5_Append(md5, content, static_cast<int>(size));
   vtksysMD5_Finalize(md5, digest);
   vtksysMD5_DigestToHex(digest, md5Hash);
   vtksysMD5_Delete(md5);
@@ -482,7 +502,8 @@ std::string vtkJSONDataSetWriter::GetShortType(vtkDataArray* input, bool& needCo
 std::string vtkJSONDataSetWriter::GetUID(vtkDataArray* input, bool& needConversion)
 {
   const unsigned char* content = (const unsigned char*)input->GetVoidPointer(0);
-  int size = input->GetNumberOfValues() * input->GetDataTypeSize();
+  size_t size =
+    static_cast<size_t>(input->GetNumberOfValues()) * static_cast<size_t>(input->GetDataTypeSize());
   std::string hash;
   vtkJSONDataSetWriter::ComputeMD5(content, size, hash);
 
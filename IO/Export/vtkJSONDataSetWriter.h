@@ -42,6 +42,7 @@
 
 #include "vtkWriter.h"
 
+#include <set>    // For WrittenArrayIds
 #include <string> // std::string used as parameters in a few methods
 
 class vtkDataSet;
@@ -59,7 +60,7 @@ public:
    * Compute a MD5 digest of a void/(const unsigned char) pointer to compute a
    *  string hash
    */
-  static void ComputeMD5(const unsigned char* content, int size, std::string& hash);
+  static void ComputeMD5(const unsigned char* content, size_t size, std::string& hash);
   ///@}
 
   ///@{
@@ -144,6 +145,9 @@ protected:
   vtkArchiver* Archiver;
   bool ValidDataSet;
   int ValidStringCount;
+  // Unique identifiers already serialized during the current Write(). Arrays
+  // shared between fields (or with identical contents) are written only once.
+  std::set<std::string> WrittenArrayIds;
 
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
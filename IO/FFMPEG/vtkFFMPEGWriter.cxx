@@ -36,6 +36,17 @@ extern "C"
 extern "C"
 {
 #include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+#endif
+
+// hardware device/frame contexts and per-encoder hardware configurations
+// appeared with FFmpeg 4.0
+#if defined(LIBAVCODEC_VERSION_MAJOR) && LIBAVCODEC_VERSION_MAJOR >= 58
+#define VTK_FFMPEG_HAS_HWACCEL
+extern "C"
+{
+#include <libavutil/hwcontext.h>
 }
 #endif
 
@@ -67,6 +78,13 @@ private:
 
   AVCodecContext* avCodecContext;
 
+  SwsContext* swsContext;
+
+#ifdef VTK_FFMPEG_HAS_HWACCEL
+  AVBufferRef* hwDeviceContext;
+  AVBufferRef* hwFramesContext;
+#endif
+
   int openedFile;
   int closedFile;
 };
@@ -87,6 +105,13 @@ vtkFFMPEGWriterInternal::vtkFFMPEGWriterInternal(vtkFFMPEGWriter* creator)
   this->rgbInput = nullptr;
   this->yuvOutput = nullptr;
 
+  this->swsContext = nullptr;
+
+#ifdef VTK_FFMPEG_HAS_HWACCEL
+  this->hwDeviceContext = nullptr;
+  this->hwFramesContext = nullptr;
+#endif
+
   this->openedFile = 0;
   this->closedFile = 1;
 
@@ -114,8 +139,20 @@ int vtkFFMPEGWriterInternal::Start()
   av_log_set_level(AV_LOG_ERROR);
 #endif
 
-  // choose avi media file format
-  this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  const char* encoderName = this->Writer->GetEncoderName();
+  bool customEncoder = (encoderName && encoderName[0] != '\0');
+
+  // choose avi media file format, or guess the container from the file name
+  // when a specific encoder was requested (H.264 streams are usually wanted
+  // in an mp4 or mkv container rather than avi)
+  if (customEncoder)
+  {
+    this->avOutputFormat = av_guess_format(nullptr, this->Writer->GetFileName(), nullptr);
+  }
+  if (!this->avOutputFormat)
+  {
+    this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  }
   if (!this->avOutputFormat)
   {
     vtkGenericWarningMacro(<< "Could not open the avi media file format.");
@@ -135,7 +172,18 @@ int vtkFFMPEGWriterInternal::Start()
   }
 
   vtk_ff_const59 AVCodec* codec;
-  if (!(codec = avcodec_find_encoder(video_codec)))
+  if (customEncoder)
+  {
+    if (!(codec = avcodec_find_encoder_by_name(encoderName)))
+    {
+      vtkGenericWarningMacro(
+        << "Failed to find the requested encoder " << encoderName
+        << ". Check that this FFmpeg build lists it in `ffmpeg -encoders`.");
+      return 0;
+    }
+    video_codec = codec->id;
+  }
+  else if (!(codec = avcodec_find_encoder(video_codec)))
   {
     vtkGenericWarningMacro(<< "Failed to get video codec.");
     return 0;
@@ -160,14 +208,49 @@ int vtkFFMPEGWriterInternal::Start()
   this->avStream->codecpar->codec_type = AVMEDIA_TYPE_VIDEO;
   this->avStream->codecpar->width = this->Dim[0];
   this->avStream->codecpar->height = this->Dim[1];
-  if (this->Writer->GetCompression())
+
+  // the pixel format handed to the codec, and the system memory format the
+  // input frames are converted into (they differ for pure hardware encoders)
+  enum AVPixelFormat codecFormat;
+  enum AVPixelFormat swFormat;
+  enum AVPixelFormat hwFormat = AV_PIX_FMT_NONE;
+  if (customEncoder)
+  {
+    // prefer the encoder's first system memory pixel format; pure hardware
+    // encoders such as h264_vaapi only advertise hardware surface formats
+    swFormat = AV_PIX_FMT_NONE;
+    if (codec->pix_fmts)
+    {
+      for (const enum AVPixelFormat* fmt = codec->pix_fmts; *fmt != AV_PIX_FMT_NONE; ++fmt)
+      {
+        const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(*fmt);
+        if (desc && !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+        {
+          swFormat = *fmt;
+          break;
+        }
+      }
+      if (swFormat == AV_PIX_FMT_NONE)
+      {
+        hwFormat = codec->pix_fmts[0];
+        swFormat = AV_PIX_FMT_NV12;
+      }
+    }
+    else
+    {
+      swFormat = AV_PIX_FMT_YUV420P;
+    }
+    codecFormat = (hwFormat != AV_PIX_FMT_NONE) ? hwFormat : swFormat;
+  }
+  else if (this->Writer->GetCompression())
   {
-    this->avStream->codecpar->format = AV_PIX_FMT_YUVJ420P;
+    codecFormat = swFormat = AV_PIX_FMT_YUVJ420P;
   }
   else
   {
-    this->avStream->codecpar->format = AV_PIX_FMT_BGR24;
+    codecFormat = swFormat = AV_PIX_FMT_BGR24;
   }
+  this->avStream->codecpar->format = codecFormat;
   this->avStream->time_base.den = this->FrameRate;
   this->avStream->time_base.num = 1;
 
@@ -214,6 +297,58 @@ int vtkFFMPEGWriterInternal::Start()
   }
   avcodec_parameters_from_context(this->avStream->codecpar, this->avCodecContext);
 
+  if (hwFormat != AV_PIX_FMT_NONE)
+  {
+#ifdef VTK_FFMPEG_HAS_HWACCEL
+    // the encoder only accepts hardware surfaces, so create the hardware
+    // device and a pool of hardware frames the input will be uploaded to
+    enum AVHWDeviceType deviceType = AV_HWDEVICE_TYPE_NONE;
+    for (int i = 0;; ++i)
+    {
+      const AVCodecHWConfig* config = avcodec_get_hw_config(codec, i);
+      if (!config)
+      {
+        break;
+      }
+      if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX) &&
+        config->pix_fmt == hwFormat)
+      {
+        deviceType = config->device_type;
+        break;
+      }
+    }
+    if (deviceType == AV_HWDEVICE_TYPE_NONE ||
+      av_hwdevice_ctx_create(&this->hwDeviceContext, deviceType, nullptr, nullptr, 0) < 0)
+    {
+      vtkGenericWarningMacro(
+        << "Could not create a hardware device context for encoder " << encoderName << ".");
+      return 0;
+    }
+    this->hwFramesContext = av_hwframe_ctx_alloc(this->hwDeviceContext);
+    if (!this->hwFramesContext)
+    {
+      vtkGenericWarningMacro(<< "Could not allocate the hardware frame context.");
+      return 0;
+    }
+    AVHWFramesContext* framesContext =
+      reinterpret_cast<AVHWFramesContext*>(this->hwFramesContext->data);
+    framesContext->format = hwFormat;
+    framesContext->sw_format = swFormat;
+    framesContext->width = this->Dim[0];
+    framesContext->height = this->Dim[1];
+    if (av_hwframe_ctx_init(this->hwFramesContext) < 0)
+    {
+      vtkGenericWarningMacro(<< "Could not initialize the hardware frame context.");
+      return 0;
+    }
+    this->avCodecContext->hw_frames_ctx = av_buffer_ref(this->hwFramesContext);
+#else
+    vtkGenericWarningMacro(<< "Encoder " << encoderName
+                           << " needs hardware surfaces, which requires FFmpeg 4.0 or later.");
+    return 0;
+#endif
+  }
+
   if (avcodec_open2(this->avCodecContext, codec, nullptr) < 0)
   {
     vtkGenericWarningMacro(<< "Could not open codec.");
@@ -239,7 +374,7 @@ int vtkFFMPEGWriterInternal::Start()
     vtkGenericWarningMacro(<< "Could not make yuvOutput avframe.");
     return 0;
   }
-  this->yuvOutput->format = this->avCodecContext->pix_fmt;
+  this->yuvOutput->format = swFormat;
   this->yuvOutput->width = this->avCodecContext->width;
   this->yuvOutput->height = this->avCodecContext->height;
   this->yuvOutput->pts = 0;
@@ -279,30 +414,50 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
     memcpy((void*)dest, (void*)src, this->avCodecContext->width * 3);
   }
 
-  // convert that to YUV for input to the codec
-  SwsContext* convert_ctx =
-    sws_getContext(this->avCodecContext->width, this->avCodecContext->height, AV_PIX_FMT_RGB24,
-      this->avCodecContext->width, this->avCodecContext->height, this->avCodecContext->pix_fmt,
-      SWS_BICUBIC, nullptr, nullptr, nullptr);
+  // convert that to the codec's input format; the context is cached across
+  // frames since the conversion parameters never change during a movie
+  this->swsContext = sws_getCachedContext(this->swsContext, this->avCodecContext->width,
+    this->avCodecContext->height, AV_PIX_FMT_RGB24, this->avCodecContext->width,
+    this->avCodecContext->height, static_cast<enum AVPixelFormat>(this->yuvOutput->format),
+    SWS_BICUBIC, nullptr, nullptr, nullptr);
 
-  if (convert_ctx == nullptr)
+  if (this->swsContext == nullptr)
   {
     vtkGenericWarningMacro(<< "swscale context initialization failed");
     return 0;
   }
 
-  int result = sws_scale(convert_ctx, this->rgbInput->data, this->rgbInput->linesize, 0,
+  int result = sws_scale(this->swsContext, this->rgbInput->data, this->rgbInput->linesize, 0,
     this->avCodecContext->height, this->yuvOutput->data, this->yuvOutput->linesize);
 
-  sws_freeContext(convert_ctx);
-
   if (!result)
   {
     vtkGenericWarningMacro(<< "sws_scale() failed");
     return 0;
   }
 
-  int ret = avcodec_send_frame(this->avCodecContext, this->yuvOutput);
+  int ret;
+#ifdef VTK_FFMPEG_HAS_HWACCEL
+  if (this->hwFramesContext)
+  {
+    // upload the converted frame to a hardware surface and encode that
+    AVFrame* hwFrame = av_frame_alloc();
+    if (!hwFrame || av_hwframe_get_buffer(this->hwFramesContext, hwFrame, 0) < 0 ||
+      av_hwframe_transfer_data(hwFrame, this->yuvOutput, 0) < 0)
+    {
+      vtkGenericWarningMacro(<< "Could not upload the frame to the hardware encoder.");
+      av_frame_free(&hwFrame);
+      return 0;
+    }
+    hwFrame->pts = this->yuvOutput->pts;
+    ret = avcodec_send_frame(this->avCodecContext, hwFrame);
+    av_frame_free(&hwFrame);
+  }
+  else
+#endif
+  {
+    ret = avcodec_send_frame(this->avCodecContext, this->yuvOutput);
+  }
   this->yuvOutput->pts++;
 
   if (ret < 0)
@@ -338,6 +493,26 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 //------------------------------------------------------------------------------
 void vtkFFMPEGWriterInternal::End()
 {
+  if (this->avCodecContext && this->openedFile)
+  {
+    // drain delayed frames out of the encoder; MJPEG and raw video encode
+    // with no delay but libx264 and the hardware encoders buffer frames
+    int ret = avcodec_send_frame(this->avCodecContext, nullptr);
+    AVPacket* pkt = av_packet_alloc();
+    while (ret >= 0)
+    {
+      ret = avcodec_receive_packet(this->avCodecContext, pkt);
+      if (ret < 0)
+      {
+        break;
+      }
+      pkt->stream_index = this->avStream->index;
+      av_write_frame(this->avFormatContext, pkt);
+      av_packet_unref(pkt);
+    }
+    av_packet_free(&pkt);
+  }
+
   if (this->yuvOutput)
   {
     av_frame_free(&this->yuvOutput);
@@ -350,6 +525,23 @@ void vtkFFMPEGWriterInternal::End()
     this->rgbInput = nullptr;
   }
 
+  if (this->swsContext)
+  {
+    sws_freeContext(this->swsContext);
+    this->swsContext = nullptr;
+  }
+
+#ifdef VTK_FFMPEG_HAS_HWACCEL
+  if (this->hwFramesContext)
+  {
+    av_buffer_unref(&this->hwFramesContext);
+  }
+  if (this->hwDeviceContext)
+  {
+    av_buffer_unref(&this->hwDeviceContext);
+  }
+#endif
+
   if (this->avFormatContext)
   {
     if (this->openedFile)
@@ -671,12 +863,14 @@ vtkFFMPEGWriter::vtkFFMPEGWriter()
   this->Rate = 25;
   this->BitRate = 0;
   this->BitRateTolerance = 0;
+  this->EncoderName = nullptr;
 }
 
 //------------------------------------------------------------------------------
 vtkFFMPEGWriter::~vtkFFMPEGWriter()
 {
   delete this->Internals;
+  this->SetEncoderName(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -785,4 +979,5 @@ void vtkFFMPEGWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Rate: " << this->Rate << endl;
   os << indent << "BitRate: " << this->BitRate << endl;
   os << indent << "BitRateTolerance: " << this->BitRateTolerance << endl;
+  os << indent << "EncoderName: " << (this->EncoderName ? this->EncoderName : "(none)") << endl;
 }
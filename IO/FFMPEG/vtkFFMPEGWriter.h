@@ -98,6 +98,22 @@ public:
   vtkGetMacro(BitRateTolerance, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the name of a specific FFMPEG encoder to use, for example
+   * "h264_nvenc", "h264_qsv", "h264_vaapi" or "libx264". When set, the
+   * container format is guessed from the file name instead of defaulting
+   * to AVI, the Compression flag is ignored, and encoders that only accept
+   * hardware surfaces get a hardware device and frame context created for
+   * them, so encoding runs on the GPU's media engine instead of the CPU.
+   * When unset (the default) the writer keeps its historical MJPEG / raw
+   * video AVI behavior. Requires FFmpeg 4.0 or later; with older FFmpeg
+   * versions the request is ignored.
+   */
+  vtkSetStringMacro(EncoderName);
+  vtkGetStringMacro(EncoderName);
+  ///@}
+
 protected:
   vtkFFMPEGWriter();
   ~vtkFFMPEGWriter() override;
@@ -110,6 +126,7 @@ protected:
   int BitRate;
   int BitRateTolerance;
   bool Compression;
+  char* EncoderName;
 
 private:
   vtkFFMPEGWriter(const vtkFFMPEGWriter&) = delete;
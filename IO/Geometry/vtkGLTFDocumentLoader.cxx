@@ -37,6 +37,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkQuaternion.h"
+#include "vtkSMPTools.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedShortArray.h"
 #include "vtksys/FStream.hxx"
@@ -216,65 +217,67 @@ struct vtkGLTFDocumentLoader::BufferDataExtractionWorker
     // element.
     size_t step = this->ByteStride == 0 ? this->NumberOfComponents * size : this->ByteStride;
 
-    output->Allocate(this->NumberOfComponents * this->Count);
+    // Size the output up front so the decode writes straight into the array's
+    // memory.  Each tuple's location in the buffer follows from its index, so
+    // the tuples can be decoded in parallel.
+    const int outComponents = output->GetNumberOfComponents();
+    output->SetNumberOfTuples(this->Count);
 
-    // keeps track of the last tuple's index. Only used if this->NormalizeTuples is set to true
-    int tupleCount = 0;
-    // iterate across elements
-    for (auto it = this->Inbuf->begin() + this->ByteOffset;
-         it != this->Inbuf->begin() + this->ByteOffset + this->Count * step; it += step)
-    {
-      // iterate across element components
-      for (auto elemIt = it; elemIt != it + this->NumberOfComponents * size; elemIt += size)
+    const char* inbuf = this->Inbuf->data() + this->ByteOffset;
+    vtkSMPTools::For(0, this->Count, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType tupleId = begin; tupleId < end; tupleId++)
       {
-        if (this->LoadTangents && (elemIt - it) == 3 * static_cast<int>(size))
-        {
-          break;
-        }
-        Type val;
-        std::copy(elemIt, elemIt + size, reinterpret_cast<char*>(&val));
-        if (this->Normalized)
+        const char* elemIt = inbuf + tupleId * step;
+        vtkIdType valueId = tupleId * outComponents;
+        // iterate across element components
+        for (int comp = 0; comp < outComponents; comp++, elemIt += size)
         {
-          // Convert from normalized integer ([min val;max val]) to normalized real ([0.0;1.0] for
-          // unsigned types, or [-1.0;1.0] for signed types), using the specification's equations
-          float max = static_cast<float>(std::numeric_limits<Type>::max());
-          float realVal = 0.0f;
-          if (std::numeric_limits<Type>::is_signed)
+          Type val;
+          std::copy(elemIt, elemIt + size, reinterpret_cast<char*>(&val));
+          if (this->Normalized)
           {
-            realVal = vtkMath::Max(val / max, -1.0f);
+            // Convert from normalized integer ([min val;max val]) to normalized real ([0.0;1.0]
+            // for unsigned types, or [-1.0;1.0] for signed types), using the specification's
+            // equations
+            float max = static_cast<float>(std::numeric_limits<Type>::max());
+            float realVal = 0.0f;
+            if (std::numeric_limits<Type>::is_signed)
+            {
+              realVal = vtkMath::Max(val / max, -1.0f);
+            }
+            else
+            {
+              realVal = val / max;
+            }
+            output->SetValue(valueId + comp, realVal);
           }
           else
           {
-            realVal = val / max;
+            output->SetValue(valueId + comp, val);
           }
-          output->InsertNextValue(realVal);
-        }
-        else
-        {
-          output->InsertNextValue(val);
         }
-      }
-      // normalize the previous tuple
-
-      if (this->NormalizeTuples)
-      {
-        std::vector<double> tuple(output->GetNumberOfComponents(), 0);
-        output->GetTuple(tupleCount, tuple.data());
-        // compute sum
-        double tupleSum = std::accumulate(tuple.begin(), tuple.end(), 0.0);
-        // check sum value
-        if (tupleSum != 1 && tupleSum != 0)
+        // normalize the tuple
+        if (this->NormalizeTuples)
         {
-          // normalize
-          for (int i = 0; i < output->GetNumberOfComponents(); i++)
+          double tupleSum = 0.0;
+          for (int comp = 0; comp < outComponents; comp++)
           {
-            tuple[i] /= tupleSum;
-            output->SetComponent(tupleCount, i, tuple[i]);
+            tupleSum += static_cast<double>(output->GetValue(valueId + comp));
+          }
+          // check sum value
+          if (tupleSum != 1 && tupleSum != 0)
+          {
+            // normalize
+            for (int comp = 0; comp < outComponents; comp++)
+            {
+              output->SetValue(valueId + comp,
+                static_cast<typename ArrayType::ValueType>(output->GetValue(valueId + comp) /
+                  tupleSum));
+            }
           }
         }
-        tupleCount++;
       }
-    }
+    });
   }
 };
 
@@ -22,6 +22,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include <cctype>
+#include <cmath>
 #include <sstream>
 #include <unordered_map>
 #include <vtksys/SystemTools.hxx>
@@ -107,6 +108,125 @@ p <v_a> <v_b> ...
 
 \*---------------------------------------------------------------------------*/
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Locale-independent float parsing. The std::stringstream previously used
+// for this allocated and consulted the imbued locale on every vertex line,
+// which dominated the import time of large files.
+bool ParseFloat(const char*& p, const char* end, float& value)
+{
+  while (p < end && isspace(static_cast<unsigned char>(*p)))
+  {
+    p++;
+  }
+  if (p >= end)
+  {
+    return false;
+  }
+  bool negative = false;
+  if (*p == '+' || *p == '-')
+  {
+    negative = (*p == '-');
+    p++;
+  }
+  double mantissa = 0.0;
+  int digits = 0;
+  int exponent = 0;
+  while (p < end && *p >= '0' && *p <= '9')
+  {
+    mantissa = mantissa * 10.0 + (*p - '0');
+    p++;
+    digits++;
+  }
+  if (p < end && *p == '.')
+  {
+    p++;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+      mantissa = mantissa * 10.0 + (*p - '0');
+      exponent--;
+      p++;
+      digits++;
+    }
+  }
+  if (digits == 0)
+  {
+    return false;
+  }
+  if (p < end && (*p == 'e' || *p == 'E'))
+  {
+    p++;
+    bool expNegative = false;
+    if (p < end && (*p == '+' || *p == '-'))
+    {
+      expNegative = (*p == '-');
+      p++;
+    }
+    int expDigits = 0;
+    int expValue = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+      expValue = expValue * 10 + (*p - '0');
+      p++;
+      expDigits++;
+    }
+    if (expDigits == 0)
+    {
+      return false;
+    }
+    exponent += expNegative ? -expValue : expValue;
+  }
+  double result = exponent ? mantissa * std::pow(10.0, exponent) : mantissa;
+  value = static_cast<float>(negative ? -result : result);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ParseFloats(const char* p, const char* end, float* values, int count)
+{
+  for (int i = 0; i < count; i++)
+  {
+    if (!ParseFloat(p, end, values[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Replacement for the sscanf("%d", ...) calls in the face/line/point index
+// parsing; sscanf rescans the remainder of the line on every call.
+bool ParseInt(const char*& p, const char* end, int& value)
+{
+  if (p >= end)
+  {
+    return false;
+  }
+  bool negative = false;
+  if (*p == '+' || *p == '-')
+  {
+    negative = (*p == '-');
+    p++;
+  }
+  int digits = 0;
+  long parsed = 0;
+  while (p < end && *p >= '0' && *p <= '9')
+  {
+    parsed = parsed * 10 + (*p - '0');
+    p++;
+    digits++;
+  }
+  if (digits == 0)
+  {
+    return false;
+  }
+  value = static_cast<int>(negative ? -parsed : parsed);
+  return true;
+}
+} // anonymous namespace
+
 int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
@@ -268,16 +388,11 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "vt") == 0)
       {
         // this is a tcoord, expect two floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
+        if (ParseFloats(pLine, pEnd, xyz, 2))
         {
-          dataStream >> xyz[0] >> xyz[1];
           verticesTextureList.emplace_back(xyz[0], xyz[1]);
         }
-        catch (const std::exception&)
+        else
         {
           vtkErrorMacro(<< "Error reading 'vt' at line " << lineNr);
         }
@@ -359,17 +474,12 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "v") == 0)
       {
         // vertex definition, expect three floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
+        if (ParseFloats(pLine, pEnd, xyz, 3))
         {
-          dataStream >> xyz[0] >> xyz[1] >> xyz[2];
           points->InsertNextPoint(xyz);
           numPoints++;
         }
-        catch (const std::exception&)
+        else
         {
           vtkErrorMacro(<< "Error reading 'v' at line " << lineNr);
           everything_ok = false;
@@ -413,18 +523,13 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
       else if (strcmp(cmd, "vn") == 0)
       {
         // vertex normal, expect three floats, separated by whitespace:
-        std::stringstream dataStream;
-        dataStream.imbue(std::locale::classic());
-        dataStream << pLine;
-
-        try
+        if (ParseFloats(pLine, pEnd, xyz, 3))
         {
-          dataStream >> xyz[0] >> xyz[1] >> xyz[2];
           normals->InsertNextTuple(xyz);
           hasNormals = true;
           numNormals++;
         }
-        catch (const std::exception&)
+        else
         {
           vtkErrorMacro(<< "Error reading 'vn' at line " << lineNr);
           everything_ok = false;
@@ -448,7 +553,8 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
           if (pLine < pEnd) // there is still data left on this line
           {
             int iVert;
-            if (sscanf(pLine, "%d", &iVert) == 1)
+            const char* pRef = pLine;
+            if (ParseInt(pRef, pEnd, iVert))
             {
               if (iVert < 0)
               {
@@ -517,21 +623,10 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
 
           if (pLine < pEnd) // there is still data left on this line
           {
-            int iVert, dummyInt;
-            if (sscanf(pLine, "%d/%d", &iVert, &dummyInt) == 2)
-            {
-              // we simply ignore texture information
-              if (iVert < 0)
-              {
-                lineElems->InsertCellPoint(numPoints + iVert);
-              }
-              else
-              {
-                lineElems->InsertCellPoint(iVert - 1);
-              }
-              nVerts++;
-            }
-            else if (sscanf(pLine, "%d", &iVert) == 1)
+            int iVert;
+            const char* pRef = pLine;
+            // any texture index after a '/' is simply ignored
+            if (ParseInt(pRef, pEnd, iVert))
             {
               if (iVert < 0)
               {
@@ -603,8 +698,23 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
 
           if (pLine < pEnd) // there is still data left on this line
           {
-            int iVert, iTCoord, iNormal;
-            if (sscanf(pLine, "%d/%d/%d", &iVert, &iTCoord, &iNormal) == 3)
+            // decode one v, v/t, v//n or v/t/n reference in a single pass
+            int iVert = 0, iTCoord = 0, iNormal = 0;
+            const char* pRef = pLine;
+            bool haveVert = ParseInt(pRef, pEnd, iVert);
+            bool haveSlash1 = haveVert && pRef < pEnd && *pRef == '/';
+            if (haveSlash1)
+            {
+              pRef++;
+            }
+            bool haveTCoord = haveSlash1 && ParseInt(pRef, pEnd, iTCoord);
+            bool haveSlash2 = haveSlash1 && pRef < pEnd && *pRef == '/';
+            if (haveSlash2)
+            {
+              pRef++;
+            }
+            bool haveNormal = haveSlash2 && ParseInt(pRef, pEnd, iNormal);
+            if (haveVert && haveTCoord && haveNormal)
             {
               if (iVert < 0)
               {
@@ -648,7 +758,7 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
                 normals_same_as_verts = false;
               }
             }
-            else if (sscanf(pLine, "%d//%d", &iVert, &iNormal) == 2)
+            else if (haveVert && !haveTCoord && haveNormal)
             {
               if (iVert < 0)
               {
@@ -673,7 +783,7 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
               if (iNormal != iVert)
                 normals_same_as_verts = false;
             }
-            else if (sscanf(pLine, "%d/%d", &iVert, &iTCoord) == 2)
+            else if (haveVert && haveTCoord)
             {
               if (iVert < 0)
               {
@@ -701,7 +811,7 @@ int vtkOBJReader::RequestData(vtkInformation* vtkNotUsed(request),
                 tcoords_same_as_verts = false;
               }
             }
-            else if (sscanf(pLine, "%d", &iVert) == 1)
+            else if (haveVert)
             {
               if (iVert < 0)
               {
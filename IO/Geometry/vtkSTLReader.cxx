@@ -19,6 +19,8 @@
 #include "vtkCellData.h"
 #include "vtkErrorCode.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -26,14 +28,19 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 vtkStandardNewMacro(vtkSTLReader);
@@ -79,6 +86,94 @@ vtkMTimeType vtkSTLReader::GetMTime()
   return mTime1;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Merge exactly coincident points using a staged, threaded merge map (the
+// same mechanism vtkStaticCleanPolyData uses) rather than feeding the points
+// one at a time through an incremental locator. Triangles that collapse to a
+// line or point after merging are culled, matching the incremental path.
+void stlStaticMergePoints(vtkPoints* newPts, vtkCellArray* newPolys, vtkFloatArray* newScalars,
+  vtkPoints* mergedPts, vtkCellArray* mergedPolys, vtkFloatArray* mergedScalars)
+{
+  vtkIdType numPts = newPts->GetNumberOfPoints();
+  vtkNew<vtkPolyData> tmpData;
+  tmpData->SetPoints(newPts);
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(tmpData);
+  locator->BuildLocator();
+  std::vector<vtkIdType> mergeMap(numPts);
+  locator->MergePoints(0.0, mergeMap.data());
+
+  // Representative points (those that merge onto themselves) receive
+  // sequential output ids; the rest inherit their representative's id.
+  std::vector<vtkIdType> pointMap(numPts);
+  vtkIdType numNewPts = 0;
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    if (mergeMap[ptId] == ptId)
+    {
+      pointMap[ptId] = numNewPts++;
+    }
+  }
+  vtkSMPTools::For(0, numPts, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+    for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
+    {
+      if (mergeMap[ptId] != ptId)
+      {
+        pointMap[ptId] = pointMap[mergeMap[ptId]];
+      }
+    }
+  });
+
+  // Copy the coordinates of the representative points.
+  mergedPts->SetDataType(newPts->GetDataType());
+  mergedPts->SetNumberOfPoints(numNewPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+    double x[3];
+    for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
+    {
+      if (mergeMap[ptId] == ptId)
+      {
+        newPts->GetPoint(ptId, x);
+        mergedPts->SetPoint(pointMap[ptId], x);
+      }
+    }
+  });
+
+  // Remap the triangle connectivity, flagging degenerate triangles.
+  vtkIdType numTris = newPolys->GetNumberOfCells();
+  std::vector<vtkIdType> remapped(3 * numTris);
+  std::vector<unsigned char> keep(numTris);
+  vtkSMPThreadLocalObject<vtkIdList> tlCell;
+  vtkSMPTools::For(0, numTris, [&](vtkIdType beginTri, vtkIdType endTri) {
+    vtkIdList* cell = tlCell.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (vtkIdType triId = beginTri; triId < endTri; ++triId)
+    {
+      newPolys->GetCellAtId(triId, npts, pts, cell);
+      vtkIdType* nodes = remapped.data() + 3 * triId;
+      nodes[0] = pointMap[pts[0]];
+      nodes[1] = pointMap[pts[1]];
+      nodes[2] = pointMap[pts[2]];
+      keep[triId] = (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2]) ? 1 : 0;
+    }
+  });
+  for (vtkIdType triId = 0; triId < numTris; ++triId)
+  {
+    if (keep[triId])
+    {
+      mergedPolys->InsertNextCell(3, remapped.data() + 3 * triId);
+      if (newScalars)
+      {
+        mergedScalars->InsertNextValue(newScalars->GetValue(triId));
+      }
+    }
+  }
+}
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
@@ -173,30 +268,42 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
     {
       locator.TakeReference(this->NewDefaultLocator());
     }
-    locator->InitPointInsertion(mergedPts, newPts->GetBounds());
 
-    int nextCell = 0;
-    const vtkIdType* pts = nullptr;
-    vtkIdType npts;
-    for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
+    if (this->Locator == nullptr && strcmp(locator->GetClassName(), "vtkMergePoints") == 0)
     {
-      vtkIdType nodes[3];
-      for (int i = 0; i < 3; i++)
-      {
-        double x[3];
-        newPts->GetPoint(pts[i], x);
-        locator->InsertUniquePoint(x, nodes[i]);
-      }
+      // The stock locator merges exactly coincident points, which a threaded
+      // merge map reproduces much faster on large files. A user-supplied or
+      // subclass-provided locator keeps the incremental path since it may
+      // apply a tolerance.
+      stlStaticMergePoints(newPts, newPolys, newScalars, mergedPts, mergedPolys, mergedScalars);
+    }
+    else
+    {
+      locator->InitPointInsertion(mergedPts, newPts->GetBounds());
 
-      if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+      int nextCell = 0;
+      const vtkIdType* pts = nullptr;
+      vtkIdType npts;
+      for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
       {
-        mergedPolys->InsertNextCell(3, nodes);
-        if (newScalars)
+        vtkIdType nodes[3];
+        for (int i = 0; i < 3; i++)
+        {
+          double x[3];
+          newPts->GetPoint(pts[i], x);
+          locator->InsertUniquePoint(x, nodes[i]);
+        }
+
+        if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
         {
-          mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          mergedPolys->InsertNextCell(3, nodes);
+          if (newScalars)
+          {
+            mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          }
         }
+        nextCell++;
       }
-      nextCell++;
     }
 
     vtkDebugMacro(<< "Merged to: " << mergedPts->GetNumberOfPoints() << " points, "
@@ -283,12 +390,80 @@ bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newP
     numTris = static_cast<int>(ulFileLength);
   }
 
-  // now we can allocate the memory we need for this STL file
-  newPts->Allocate(numTris * 3);
-  newPolys->AllocateEstimate(numTris, 3);
+  // Bulk-read the 50 byte facet records in large chunks and convert them to
+  // points in parallel. The implicit connectivity (triangle t uses points 3t,
+  // 3t+1, 3t+2) is filled in directly; any records past the verified count
+  // are picked up by the per-facet loop below.
+  vtkIdType bulkTris = 0;
+  if (numTris > 0)
+  {
+    constexpr size_t recordSize = 50;
+    newPts->SetDataTypeToFloat();
+    newPts->SetNumberOfPoints(3 * static_cast<vtkIdType>(numTris));
+    float* ptsPtr = static_cast<float*>(newPts->GetVoidPointer(0));
+
+    constexpr vtkIdType chunkTris = 65536;
+    std::vector<unsigned char> records(recordSize * chunkTris);
+    while (bulkTris < numTris)
+    {
+      vtkIdType request = std::min(chunkTris, static_cast<vtkIdType>(numTris) - bulkTris);
+      vtkIdType got = static_cast<vtkIdType>(fread(records.data(), recordSize, request, fp));
+      if (got <= 0)
+      {
+        break;
+      }
+      float* chunkPts = ptsPtr + 9 * bulkTris;
+      const unsigned char* rec = records.data();
+      vtkSMPTools::For(0, got, [&](vtkIdType beginTri, vtkIdType endTri) {
+        for (vtkIdType t = beginTri; t < endTri; ++t)
+        {
+          // Skip the 12 byte facet normal; copy the three vertices.
+          float* v = chunkPts + 9 * t;
+          memcpy(v, rec + recordSize * t + 12, 9 * sizeof(float));
+          vtkByteSwap::Swap4LERange(v, 9);
+        }
+      });
+      bulkTris += got;
+      vtkDebugMacro(<< "triangle# " << bulkTris);
+      this->UpdateProgress(static_cast<double>(bulkTris) / numTris);
+      if (got < request)
+      {
+        break;
+      }
+    }
+    if (bulkTris < numTris)
+    {
+      newPts->SetNumberOfPoints(3 * bulkTris);
+    }
+
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(bulkTris + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(3 * bulkTris);
+    vtkIdType* off = offsets->GetPointer(0);
+    vtkIdType* conn = connectivity->GetPointer(0);
+    vtkSMPTools::For(0, bulkTris + 1, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType t = begin; t < end; ++t)
+      {
+        off[t] = 3 * t;
+      }
+    });
+    vtkSMPTools::For(0, 3 * bulkTris, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType k = begin; k < end; ++k)
+      {
+        conn[k] = k;
+      }
+    });
+    newPolys->SetData(offsets, connectivity);
+  }
+  else
+  {
+    newPts->Allocate(numTris * 3);
+    newPolys->AllocateEstimate(numTris, 3);
+  }
 
   facet_t facet;
-  for (int i = 0; fread(&facet, 50, 1, fp) > 0; i++)
+  for (vtkIdType i = bulkTris; fread(&facet, 50, 1, fp) > 0; i++)
   {
     vtkByteSwap::Swap4LE(facet.n);
     vtkByteSwap::Swap4LE(facet.n + 1);
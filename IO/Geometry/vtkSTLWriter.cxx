@@ -26,6 +26,8 @@
 #include "vtkTriangle.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
+
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 #if !defined(_WIN32) || defined(__CYGWIN__)
@@ -38,6 +40,57 @@ namespace
 {
 // For C format strings
 constexpr int max_double_digits = std::numeric_limits<double>::max_digits10;
+
+// Accumulates the 50 byte binary facet records in memory and flushes them to
+// the file in large writes, replacing five small fwrite() calls per triangle.
+class stlBinaryRecordBuffer
+{
+public:
+  stlBinaryRecordBuffer(FILE* fp)
+    : Fp(fp)
+  {
+    this->Buffer.reserve(BufferSize);
+  }
+  ~stlBinaryRecordBuffer() { this->Flush(); }
+
+  // Append one facet record: normal, three vertices, attribute byte count.
+  void WriteFacet(const double n[3], const double v1[3], const double v2[3], const double v3[3])
+  {
+    if (this->Buffer.size() + RecordSize > BufferSize)
+    {
+      this->Flush();
+    }
+    this->AppendVector(n);
+    this->AppendVector(v1);
+    this->AppendVector(v2);
+    this->AppendVector(v3);
+    const unsigned char attr[2] = { 0, 0 };
+    this->Buffer.insert(this->Buffer.end(), attr, attr + 2);
+  }
+
+  void Flush()
+  {
+    if (!this->Buffer.empty())
+    {
+      fwrite(this->Buffer.data(), 1, this->Buffer.size(), this->Fp);
+      this->Buffer.clear();
+    }
+  }
+
+private:
+  void AppendVector(const double v[3])
+  {
+    float f[3] = { static_cast<float>(v[0]), static_cast<float>(v[1]), static_cast<float>(v[2]) };
+    vtkByteSwap::Swap4LERange(f, 3);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(f);
+    this->Buffer.insert(this->Buffer.end(), bytes, bytes + sizeof(f));
+  }
+
+  static constexpr size_t RecordSize = 50;
+  static constexpr size_t BufferSize = RecordSize * 65536;
+  FILE* Fp;
+  std::vector<unsigned char> Buffer;
+};
 }
 
 vtkStandardNewMacro(vtkSTLWriter);
@@ -240,7 +293,6 @@ void vtkSTLWriter::WriteBinarySTL(vtkPoints* pts, vtkCellArray* polys, vtkCellAr
   double dn[3], v1[3], v2[3], v3[3];
   vtkIdType npts = 0;
   const vtkIdType* indx = nullptr;
-  unsigned short ibuff2 = 0;
 
   if ((fp = vtksys::SystemTools::Fopen(this->FileName, "wb")) == nullptr)
   {
@@ -320,6 +372,8 @@ void vtkSTLWriter::WriteBinarySTL(vtkPoints* pts, vtkCellArray* polys, vtkCellAr
   unsigned long numTris = 0;
   fwrite(&numTris, 1, 4, fp);
 
+  stlBinaryRecordBuffer recordBuffer(fp);
+
   //  Write out triangle strips
   //
   numTris += polyStrips->GetNumberOfCells();
@@ -330,40 +384,7 @@ void vtkSTLWriter::WriteBinarySTL(vtkPoints* pts, vtkCellArray* polys, vtkCellAr
     pts->GetPoint(indx[2], v3);
 
     vtkTriangle::ComputeNormal(pts, npts, indx, dn);
-    float n[3];
-    n[0] = (float)dn[0];
-    n[1] = (float)dn[1];
-    n[2] = (float)dn[2];
-    vtkByteSwap::Swap4LE(n);
-    vtkByteSwap::Swap4LE(n + 1);
-    vtkByteSwap::Swap4LE(n + 2);
-    fwrite(n, 4, 3, fp);
-
-    n[0] = (float)v1[0];
-    n[1] = (float)v1[1];
-    n[2] = (float)v1[2];
-    vtkByteSwap::Swap4LE(n);
-    vtkByteSwap::Swap4LE(n + 1);
-    vtkByteSwap::Swap4LE(n + 2);
-    fwrite(n, 4, 3, fp);
-
-    n[0] = (float)v2[0];
-    n[1] = (float)v2[1];
-    n[2] = (float)v2[2];
-    vtkByteSwap::Swap4LE(n);
-    vtkByteSwap::Swap4LE(n + 1);
-    vtkByteSwap::Swap4LE(n + 2);
-    fwrite(n, 4, 3, fp);
-
-    n[0] = (float)v3[0];
-    n[1] = (float)v3[1];
-    n[2] = (float)v3[2];
-    vtkByteSwap::Swap4LE(n);
-    vtkByteSwap::Swap4LE(n + 1);
-    vtkByteSwap::Swap4LE(n + 2);
-    fwrite(n, 4, 3, fp);
-
-    fwrite(&ibuff2, 2, 1, fp);
+    recordBuffer.WriteFacet(dn, v1, v2, v3);
   }
 
   // Write out triangle polygons. If not a triangle polygon, triangulate it
@@ -378,39 +399,7 @@ void vtkSTLWriter::WriteBinarySTL(vtkPoints* pts, vtkCellArray* polys, vtkCellAr
       pts->GetPoint(indx[2], v3);
 
       vtkTriangle::ComputeNormal(pts, npts, indx, dn);
-      float n[3];
-      n[0] = (float)dn[0];
-      n[1] = (float)dn[1];
-      n[2] = (float)dn[2];
-      vtkByteSwap::Swap4LE(n);
-      vtkByteSwap::Swap4LE(n + 1);
-      vtkByteSwap::Swap4LE(n + 2);
-      fwrite(n, 4, 3, fp);
-
-      n[0] = (float)v1[0];
-      n[1] = (float)v1[1];
-      n[2] = (float)v1[2];
-      vtkByteSwap::Swap4LE(n);
-      vtkByteSwap::Swap4LE(n + 1);
-      vtkByteSwap::Swap4LE(n + 2);
-      fwrite(n, 4, 3, fp);
-
-      n[0] = (float)v2[0];
-      n[1] = (float)v2[1];
-      n[2] = (float)v2[2];
-      vtkByteSwap::Swap4LE(n);
-      vtkByteSwap::Swap4LE(n + 1);
-      vtkByteSwap::Swap4LE(n + 2);
-      fwrite(n, 4, 3, fp);
-
-      n[0] = (float)v3[0];
-      n[1] = (float)v3[1];
-      n[2] = (float)v3[2];
-      vtkByteSwap::Swap4LE(n);
-      vtkByteSwap::Swap4LE(n + 1);
-      vtkByteSwap::Swap4LE(n + 2);
-      fwrite(n, 4, 3, fp);
-      fwrite(&ibuff2, 2, 1, fp);
+      recordBuffer.WriteFacet(dn, v1, v2, v3);
       numTris++;
     }
     else if (npts > 3)
@@ -435,35 +424,17 @@ void vtkSTLWriter::WriteBinarySTL(vtkPoints* pts, vtkCellArray* polys, vtkCellAr
       for (vtkIdType i = 0; i < numSimplices; ++i)
       {
         vtkTriangle::ComputeNormal(poly->GetPoints(), 3, ptIds->GetPointer(3 * i), dn);
-
-        float n[3];
-        n[0] = (float)dn[0];
-        n[1] = (float)dn[1];
-        n[2] = (float)dn[2];
-        vtkByteSwap::Swap4LE(n);
-        vtkByteSwap::Swap4LE(n + 1);
-        vtkByteSwap::Swap4LE(n + 2);
-        fwrite(n, 4, 3, fp);
-
-        for (vtkIdType j = 0; j < 3; ++j)
-        {
-          vtkIdType ptId = ptIds->GetId(3 * i + j);
-          poly->GetPoints()->GetPoint(ptId, v1);
-
-          n[0] = (float)v1[0];
-          n[1] = (float)v1[1];
-          n[2] = (float)v1[2];
-          vtkByteSwap::Swap4LE(n);
-          vtkByteSwap::Swap4LE(n + 1);
-          vtkByteSwap::Swap4LE(n + 2);
-          fwrite(n, 4, 3, fp);
-        }
-        fwrite(&ibuff2, 2, 1, fp);
+        poly->GetPoints()->GetPoint(ptIds->GetId(3 * i), v1);
+        poly->GetPoints()->GetPoint(ptIds->GetId(3 * i + 1), v2);
+        poly->GetPoints()->GetPoint(ptIds->GetId(3 * i + 2), v3);
+        recordBuffer.WriteFacet(dn, v1, v2, v3);
         numTris++;
       }
     }
   }
 
+  recordBuffer.Flush();
+
   vtkByteSwap::Swap4LE(&numTris);
   fseek(fp, 80, SEEK_SET);
   fwrite(&numTris, 1, 4, fp);
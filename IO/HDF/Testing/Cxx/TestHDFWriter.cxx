@@ -0,0 +1,214 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkFloatArray.h"
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTesting.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <string>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool CompareArrays(vtkDataArray* array, vtkDataArray* expectedArray)
+{
+  if (!array || !expectedArray ||
+    array->GetNumberOfTuples() != expectedArray->GetNumberOfTuples() ||
+    array->GetNumberOfComponents() != expectedArray->GetNumberOfComponents())
+  {
+    vtkLog(ERROR, "Array structure mismatch");
+    return false;
+  }
+  for (vtkIdType i = 0; i < array->GetNumberOfTuples(); ++i)
+  {
+    for (int j = 0; j < array->GetNumberOfComponents(); ++j)
+    {
+      if (array->GetComponent(i, j) != expectedArray->GetComponent(i, j))
+      {
+        vtkLog(ERROR, "Array value mismatch at tuple " << i << " component " << j);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int TestImageDataRoundTrip(const std::string& tempDir, int compressionLevel)
+{
+  std::string filePath = tempDir + "/TestHDFWriter_image.hdf";
+
+  vtkNew<vtkImageData> expected;
+  expected->SetExtent(0, 9, 0, 7, 0, 5);
+  expected->SetOrigin(1.0, 2.0, 3.0);
+  expected->SetSpacing(0.5, 0.25, 2.0);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(expected->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < scalars->GetNumberOfTuples(); ++i)
+  {
+    scalars->SetValue(i, static_cast<float>(i % 97) * 0.25f);
+  }
+  expected->GetPointData()->SetScalars(scalars);
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(expected);
+  writer->SetFileName(filePath.c_str());
+  writer->SetCompressionLevel(compressionLevel);
+  writer->Write();
+
+  vtkNew<vtkHDFReader> reader;
+  if (!reader->CanReadFile(filePath.c_str()))
+  {
+    vtkLog(ERROR, "vtkHDFReader cannot read back " << filePath);
+    return EXIT_FAILURE;
+  }
+  reader->SetFileName(filePath.c_str());
+  reader->Update();
+  vtkImageData* data = vtkImageData::SafeDownCast(reader->GetOutputAsDataSet());
+  if (!data)
+  {
+    vtkLog(ERROR, "Round-tripped output is not an image data");
+    return EXIT_FAILURE;
+  }
+
+  int expectedExtent[6];
+  int extent[6];
+  expected->GetExtent(expectedExtent);
+  data->GetExtent(extent);
+  if (!std::equal(extent, extent + 6, expectedExtent))
+  {
+    vtkLog(ERROR, "Extent mismatch after round trip");
+    return EXIT_FAILURE;
+  }
+  if (!CompareArrays(data->GetPointData()->GetArray("Scalars"),
+        expected->GetPointData()->GetArray("Scalars")))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+int TestUnstructuredGridRoundTrip(const std::string& tempDir)
+{
+  std::string filePath = tempDir + "/TestHDFWriter_ug.hdf";
+
+  // Two hexahedra sharing a face plus a tetrahedron: mixed cell types and
+  // a non-trivial connectivity array.
+  vtkNew<vtkUnstructuredGrid> expected;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+  points->InsertNextPoint(3.0, 0.5, 0.5);
+  expected->SetPoints(points);
+
+  const vtkIdType hexa0[8] = { 0, 1, 4, 3, 6, 7, 10, 9 };
+  const vtkIdType hexa1[8] = { 1, 2, 5, 4, 7, 8, 11, 10 };
+  const vtkIdType tetra[4] = { 2, 5, 8, 12 };
+  expected->InsertNextCell(VTK_HEXAHEDRON, 8, hexa0);
+  expected->InsertNextCell(VTK_HEXAHEDRON, 8, hexa1);
+  expected->InsertNextCell(VTK_TETRA, 4, tetra);
+
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(expected->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < vectors->GetNumberOfTuples(); ++i)
+  {
+    vectors->SetTuple3(i, i * 1.0, i * 2.0, i * 3.0);
+  }
+  expected->GetPointData()->SetVectors(vectors);
+
+  vtkNew<vtkFloatArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  cellScalars->SetNumberOfTuples(expected->GetNumberOfCells());
+  for (vtkIdType i = 0; i < cellScalars->GetNumberOfTuples(); ++i)
+  {
+    cellScalars->SetValue(i, 10.0f + i);
+  }
+  expected->GetCellData()->SetScalars(cellScalars);
+
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputData(expected);
+  writer->SetFileName(filePath.c_str());
+  writer->SetChunkSize(1024);
+  writer->SetCompressionLevel(2);
+  writer->Write();
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(filePath.c_str());
+  reader->Update();
+  vtkUnstructuredGrid* data = vtkUnstructuredGrid::SafeDownCast(reader->GetOutputAsDataSet());
+  if (!data)
+  {
+    vtkLog(ERROR, "Round-tripped output is not an unstructured grid");
+    return EXIT_FAILURE;
+  }
+  if (data->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    data->GetNumberOfCells() != expected->GetNumberOfCells())
+  {
+    vtkLog(ERROR, "Geometry size mismatch after round trip");
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < expected->GetNumberOfCells(); ++i)
+  {
+    if (data->GetCellType(i) != expected->GetCellType(i))
+    {
+      vtkLog(ERROR, "Cell type mismatch for cell " << i);
+      return EXIT_FAILURE;
+    }
+  }
+  if (!CompareArrays(data->GetPoints()->GetData(), expected->GetPoints()->GetData()) ||
+    !CompareArrays(data->GetPointData()->GetArray("Vectors"), vectors) ||
+    !CompareArrays(data->GetCellData()->GetArray("CellScalars"), cellScalars))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestHDFWriter(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testHelper;
+  testHelper->AddArguments(argc, argv);
+  std::string tempDir = testHelper->GetTempDirectory();
+
+  if (TestImageDataRoundTrip(tempDir, 0) != EXIT_SUCCESS ||
+    TestImageDataRoundTrip(tempDir, 5) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+  return TestUnstructuredGridRoundTrip(tempDir);
+}
@@ -42,6 +42,9 @@ DefineScopedHandle(F);
 // Defines ScopedH5GHandle closed with H5Gclose
 DefineScopedHandle(G);
 
+// Defines ScopedH5PHandle closed with H5Pclose
+DefineScopedHandle(P);
+
 // Defines ScopedH5SHandle closed with H5Sclose
 DefineScopedHandle(S);
 
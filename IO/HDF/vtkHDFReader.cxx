@@ -214,6 +214,75 @@ const char* vtkHDFReader::GetCellArrayName(int index)
   return this->DataArraySelection[vtkDataObject::CELL]->GetArrayName(index);
 }
 
+//----------------------------------------------------------------------------
+int vtkHDFReader::GetNumberOfFieldArrays()
+{
+  return this->DataArraySelection[vtkDataObject::FIELD]->GetNumberOfArrays();
+}
+
+//----------------------------------------------------------------------------
+const char* vtkHDFReader::GetFieldArrayName(int index)
+{
+  return this->DataArraySelection[vtkDataObject::FIELD]->GetArrayName(index);
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFReader::GetPointArrayStatus(const char* name)
+{
+  return this->DataArraySelection[vtkDataObject::POINT]->ArrayIsEnabled(name);
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFReader::GetCellArrayStatus(const char* name)
+{
+  return this->DataArraySelection[vtkDataObject::CELL]->ArrayIsEnabled(name);
+}
+
+//----------------------------------------------------------------------------
+int vtkHDFReader::GetFieldArrayStatus(const char* name)
+{
+  return this->DataArraySelection[vtkDataObject::FIELD]->ArrayIsEnabled(name);
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFReader::SetPointArrayStatus(const char* name, int status)
+{
+  if (status)
+  {
+    this->DataArraySelection[vtkDataObject::POINT]->EnableArray(name);
+  }
+  else
+  {
+    this->DataArraySelection[vtkDataObject::POINT]->DisableArray(name);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFReader::SetCellArrayStatus(const char* name, int status)
+{
+  if (status)
+  {
+    this->DataArraySelection[vtkDataObject::CELL]->EnableArray(name);
+  }
+  else
+  {
+    this->DataArraySelection[vtkDataObject::CELL]->DisableArray(name);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkHDFReader::SetFieldArrayStatus(const char* name, int status)
+{
+  if (status)
+  {
+    this->DataArraySelection[vtkDataObject::FIELD]->EnableArray(name);
+  }
+  else
+  {
+    this->DataArraySelection[vtkDataObject::FIELD]->DisableArray(name);
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkHDFReader::RequestDataObject(vtkInformation*, vtkInformationVector** vtkNotUsed(inputVector),
   vtkInformationVector* outputVector)
@@ -269,11 +338,17 @@ int vtkHDFReader::RequestDataObject(vtkInformation*, vtkInformationVector** vtkN
     for (int i = 0; i < vtkHDFReader::GetNumberOfAttributeTypes(); ++i)
     {
       this->DataArraySelection[i]->RemoveAllArrays();
-      std::vector<std::string> arrayNames = this->Impl->GetArrayNames(i);
-      for (const std::string& arrayName : arrayNames)
-      {
-        this->DataArraySelection[i]->AddArray(arrayName.c_str());
-      }
+    }
+  }
+  // Keep the selections in sync with the file's arrays. AddArray is a no-op
+  // for known arrays, so the enabled/disabled state chosen by the user
+  // survives switching to another file of the same dataset type.
+  for (int i = 0; i < vtkHDFReader::GetNumberOfAttributeTypes(); ++i)
+  {
+    std::vector<std::string> arrayNames = this->Impl->GetArrayNames(i);
+    for (const std::string& arrayName : arrayNames)
+    {
+      this->DataArraySelection[i]->AddArray(arrayName.c_str());
     }
   }
   return 1;
@@ -405,6 +480,10 @@ int vtkHDFReader::AddFieldArrays(vtkDataObject* data)
   std::vector<std::string> names = this->Impl->GetArrayNames(vtkDataObject::FIELD);
   for (const std::string& name : names)
   {
+    if (!this->DataArraySelection[vtkDataObject::FIELD]->ArrayIsEnabled(name.c_str()))
+    {
+      continue;
+    }
     vtkSmartPointer<vtkAbstractArray> array;
     if ((array = vtk::TakeSmartPointer(this->Impl->NewFieldArray(name.c_str()))) == nullptr)
     {
@@ -90,19 +90,35 @@ public:
 
   //@{
   /**
-   * Get the number of point or cell arrays available in the input.
+   * Get the number of point, cell or field arrays available in the input.
    */
   int GetNumberOfPointArrays();
   int GetNumberOfCellArrays();
+  int GetNumberOfFieldArrays();
   //@}
 
   //@{
   /**
-   * Get the name of the point or cell array with the given index in
+   * Get the name of the point, cell or field array with the given index in
    * the input.
    */
   const char* GetPointArrayName(int index);
   const char* GetCellArrayName(int index);
+  const char* GetFieldArrayName(int index);
+  //@}
+
+  //@{
+  /**
+   * Get/Set whether the point, cell or field array with the given name is to
+   * be read. Only enabled arrays are read from the file; disabled arrays are
+   * never touched, so deselecting unused arrays avoids their I/O entirely.
+   */
+  int GetPointArrayStatus(const char* name);
+  int GetCellArrayStatus(const char* name);
+  int GetFieldArrayStatus(const char* name);
+  void SetPointArrayStatus(const char* name, int status);
+  void SetCellArrayStatus(const char* name, int status);
+  void SetFieldArrayStatus(const char* name, int status);
   //@}
 
   vtkSetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
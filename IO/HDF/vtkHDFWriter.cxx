@@ -0,0 +1,491 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHDFWriter.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkErrorCode.h"
+#include "vtkFieldData.h"
+#include "vtk_hdf5.h" // For hid_t, included before vtkHDF5ScopedHandle.h
+#include "vtkHDF5ScopedHandle.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMatrix3x3.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkHDFWriter);
+
+//------------------------------------------------------------------------------
+// Hides the HDF5 handles and low level dataset / attribute creation from the
+// writer's pipeline code.
+class vtkHDFWriter::Implementation
+{
+public:
+  Implementation(vtkHDFWriter* writer)
+    : Writer(writer)
+    , File(H5I_INVALID_HID)
+    , VTKGroup(H5I_INVALID_HID)
+  {
+  }
+
+  ~Implementation()
+  {
+    if (this->VTKGroup >= 0)
+    {
+      H5Gclose(this->VTKGroup);
+    }
+    if (this->File >= 0)
+    {
+      H5Fclose(this->File);
+    }
+  }
+
+  /**
+   * Create the output file and the VTKHDF group with its Version and Type
+   * attributes. Returns false on error.
+   */
+  bool CreateFile(const char* fileName, const char* dataSetType);
+
+  /**
+   * Write a chunked (and optionally deflate-compressed, following the
+   * writer's settings) dataset with the given dimensions into the group.
+   */
+  bool WriteDataset(hid_t group, const char* name, hid_t fileType, hid_t memType,
+    const std::vector<hsize_t>& dims, const void* data);
+
+  /**
+   * Write a vtkDataArray as a dataset named after the array. The tuple
+   * dimensions default to {numberOfTuples}; image data passes the reversed
+   * extent dimensions instead. A component dimension is appended when the
+   * array has more than one component.
+   */
+  bool WriteArray(hid_t group, vtkDataArray* array, const std::vector<hsize_t>& tupleDims);
+
+  /**
+   * Write the PointData/CellData/FieldData groups for the given data set.
+   * Image data passes its point and cell dimensions, reversed to match the
+   * file's C order; unstructured data passes empty vectors.
+   */
+  bool WriteAttributeData(
+    vtkDataSet* data, const std::vector<hsize_t>& pointDims, const std::vector<hsize_t>& cellDims);
+
+  ///@{
+  /**
+   * Write a rank-1 attribute on the VTKHDF group.
+   */
+  bool WriteAttribute(const char* name, int numValues, const int* values);
+  bool WriteAttribute(const char* name, int numValues, const double* values);
+  ///@}
+
+  /**
+   * Returns the in-file HDF5 type for a VTK scalar type, or a negative
+   * handle if the type cannot be written.
+   */
+  static hid_t VtkToHdfType(int dataType);
+
+  hid_t GetVTKGroup() { return this->VTKGroup; }
+
+private:
+  vtkHDFWriter* Writer;
+  hid_t File;
+  hid_t VTKGroup;
+};
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::CreateFile(const char* fileName, const char* dataSetType)
+{
+  this->File = H5Fcreate(fileName, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if (this->File < 0)
+  {
+    return false;
+  }
+  this->VTKGroup = H5Gcreate(this->File, "/VTKHDF", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (this->VTKGroup < 0)
+  {
+    return false;
+  }
+
+  const int version[2] = { 1, 0 };
+  if (!this->WriteAttribute("Version", 2, version))
+  {
+    return false;
+  }
+
+  vtkHDF::ScopedH5THandle typeOfType = H5Tcopy(H5T_C_S1);
+  if (typeOfType < 0 || H5Tset_size(typeOfType, std::strlen(dataSetType)) < 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5SHandle scalarSpace = H5Screate(H5S_SCALAR);
+  if (scalarSpace < 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5AHandle typeAttribute =
+    H5Acreate(this->VTKGroup, "Type", typeOfType, scalarSpace, H5P_DEFAULT, H5P_DEFAULT);
+  if (typeAttribute < 0 || H5Awrite(typeAttribute, typeOfType, dataSetType) < 0)
+  {
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteAttribute(const char* name, int numValues, const int* values)
+{
+  hsize_t dims[1] = { static_cast<hsize_t>(numValues) };
+  vtkHDF::ScopedH5SHandle space = H5Screate_simple(1, dims, nullptr);
+  if (space < 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5AHandle attribute =
+    H5Acreate(this->VTKGroup, name, H5T_STD_I64LE, space, H5P_DEFAULT, H5P_DEFAULT);
+  return attribute >= 0 && H5Awrite(attribute, H5T_NATIVE_INT, values) >= 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteAttribute(
+  const char* name, int numValues, const double* values)
+{
+  hsize_t dims[1] = { static_cast<hsize_t>(numValues) };
+  vtkHDF::ScopedH5SHandle space = H5Screate_simple(1, dims, nullptr);
+  if (space < 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5AHandle attribute =
+    H5Acreate(this->VTKGroup, name, H5T_IEEE_F64LE, space, H5P_DEFAULT, H5P_DEFAULT);
+  return attribute >= 0 && H5Awrite(attribute, H5T_NATIVE_DOUBLE, values) >= 0;
+}
+
+//------------------------------------------------------------------------------
+hid_t vtkHDFWriter::Implementation::VtkToHdfType(int dataType)
+{
+  switch (dataType)
+  {
+    case VTK_CHAR:
+    case VTK_SIGNED_CHAR:
+      return H5T_NATIVE_SCHAR;
+    case VTK_UNSIGNED_CHAR:
+      return H5T_NATIVE_UCHAR;
+    case VTK_SHORT:
+      return H5T_NATIVE_SHORT;
+    case VTK_UNSIGNED_SHORT:
+      return H5T_NATIVE_USHORT;
+    case VTK_INT:
+      return H5T_NATIVE_INT;
+    case VTK_UNSIGNED_INT:
+      return H5T_NATIVE_UINT;
+    case VTK_LONG:
+      return H5T_NATIVE_LONG;
+    case VTK_UNSIGNED_LONG:
+      return H5T_NATIVE_ULONG;
+    case VTK_LONG_LONG:
+    case VTK_ID_TYPE:
+      return H5T_NATIVE_LLONG;
+    case VTK_UNSIGNED_LONG_LONG:
+      return H5T_NATIVE_ULLONG;
+    case VTK_FLOAT:
+      return H5T_NATIVE_FLOAT;
+    case VTK_DOUBLE:
+      return H5T_NATIVE_DOUBLE;
+    default:
+      return H5I_INVALID_HID;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteDataset(hid_t group, const char* name, hid_t fileType,
+  hid_t memType, const std::vector<hsize_t>& dims, const void* data)
+{
+  vtkHDF::ScopedH5SHandle space =
+    H5Screate_simple(static_cast<int>(dims.size()), dims.data(), nullptr);
+  if (space < 0)
+  {
+    return false;
+  }
+
+  // Chunking is required for compression; it also determines the
+  // granularity of appends and partial reads done by consumers.
+  vtkHDF::ScopedH5PHandle properties = H5Pcreate(H5P_DATASET_CREATE);
+  if (properties < 0)
+  {
+    return false;
+  }
+  vtkIdType chunkSize = this->Writer->GetChunkSize();
+  const int compressionLevel = this->Writer->GetCompressionLevel();
+  if (chunkSize == 0 && compressionLevel > 0)
+  {
+    // Pick a chunk that keeps roughly a few MiB per chunk for common types.
+    chunkSize = 1 << 18;
+  }
+  if (chunkSize > 0 && !dims.empty() && dims[0] > 0)
+  {
+    std::vector<hsize_t> chunkDims = dims;
+    chunkDims[0] = std::min(dims[0], static_cast<hsize_t>(chunkSize));
+    if (H5Pset_chunk(properties, static_cast<int>(chunkDims.size()), chunkDims.data()) < 0)
+    {
+      return false;
+    }
+    if (compressionLevel > 0 && H5Pset_deflate(properties, compressionLevel) < 0)
+    {
+      return false;
+    }
+  }
+
+  vtkHDF::ScopedH5DHandle dataset =
+    H5Dcreate(group, name, fileType, space, H5P_DEFAULT, properties, H5P_DEFAULT);
+  if (dataset < 0)
+  {
+    return false;
+  }
+  return H5Dwrite(dataset, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) >= 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteArray(
+  hid_t group, vtkDataArray* array, const std::vector<hsize_t>& tupleDims)
+{
+  const hid_t hdfType = vtkHDFWriter::Implementation::VtkToHdfType(array->GetDataType());
+  if (hdfType < 0)
+  {
+    vtkWarningWithObjectMacro(this->Writer,
+      "Skipping array " << (array->GetName() ? array->GetName() : "(nameless)")
+                        << ": unsupported data type " << array->GetDataType());
+    return true;
+  }
+
+  std::vector<hsize_t> dims = tupleDims;
+  if (dims.empty())
+  {
+    dims.push_back(static_cast<hsize_t>(array->GetNumberOfTuples()));
+  }
+  if (array->GetNumberOfComponents() > 1)
+  {
+    dims.push_back(static_cast<hsize_t>(array->GetNumberOfComponents()));
+  }
+  return this->WriteDataset(
+    group, array->GetName(), hdfType, hdfType, dims, array->GetVoidPointer(0));
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::WriteAttributeData(
+  vtkDataSet* data, const std::vector<hsize_t>& pointDims, const std::vector<hsize_t>& cellDims)
+{
+  const char* groupNames[3] = { "PointData", "CellData", "FieldData" };
+  vtkFieldData* fields[3] = { data->GetPointData(), data->GetCellData(), data->GetFieldData() };
+  const std::vector<hsize_t>* tupleDims[3] = { &pointDims, &cellDims, nullptr };
+  const std::vector<hsize_t> noDims;
+
+  for (int attributeType = 0; attributeType < 3; ++attributeType)
+  {
+    vtkFieldData* field = fields[attributeType];
+    if (!field || field->GetNumberOfArrays() == 0)
+    {
+      continue;
+    }
+    vtkHDF::ScopedH5GHandle group = H5Gcreate(
+      this->VTKGroup, groupNames[attributeType], H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if (group < 0)
+    {
+      return false;
+    }
+    for (int i = 0; i < field->GetNumberOfArrays(); ++i)
+    {
+      vtkDataArray* array = vtkDataArray::SafeDownCast(field->GetAbstractArray(i));
+      if (!array || !array->GetName())
+      {
+        continue;
+      }
+      const std::vector<hsize_t>& dims =
+        tupleDims[attributeType] ? *tupleDims[attributeType] : noDims;
+      if (!this->WriteArray(group, array, dims))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Dataset dimensions for an extent, reversed to the file's C order and
+// reduced to the number of non-flat dimensions, matching what
+// vtkHDFReader expects.
+std::vector<hsize_t> ExtentToDims(const int* extent, int pointOffset)
+{
+  int ndims = 3;
+  if (extent[5] - extent[4] == 0)
+  {
+    --ndims;
+  }
+  if (extent[3] - extent[2] == 0)
+  {
+    --ndims;
+  }
+  std::vector<hsize_t> dims(ndims);
+  for (int i = 0; i < ndims; ++i)
+  {
+    const int axis = ndims - 1 - i;
+    dims[i] = static_cast<hsize_t>(
+      std::max(extent[2 * axis + 1] - extent[2 * axis] + pointOffset, 1));
+  }
+  return dims;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::vtkHDFWriter()
+{
+  this->FileName = nullptr;
+  this->ChunkSize = 0;
+  this->CompressionLevel = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkHDFWriter::~vtkHDFWriter()
+{
+  this->SetFileName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkDataSet* vtkHDFWriter::GetInput()
+{
+  return vtkDataSet::SafeDownCast(this->Superclass::GetInput());
+}
+
+//------------------------------------------------------------------------------
+vtkDataSet* vtkHDFWriter::GetInput(int port)
+{
+  return vtkDataSet::SafeDownCast(this->Superclass::GetInput(port));
+}
+
+//------------------------------------------------------------------------------
+int vtkHDFWriter::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::WriteData()
+{
+  if (!this->FileName)
+  {
+    vtkErrorMacro("No FileName specified! Can't write!");
+    this->SetErrorCode(vtkErrorCode::NoFileNameError);
+    return;
+  }
+
+  vtkImageData* image = vtkImageData::SafeDownCast(this->GetInput());
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(this->GetInput());
+  if (!image && !grid)
+  {
+    vtkErrorMacro(
+      "Unsupported input type: " << (this->GetInput() ? this->GetInput()->GetClassName() : "null")
+                                 << ". Image data and unstructured grid are implemented.");
+    return;
+  }
+
+  Implementation impl(this);
+  if (!impl.CreateFile(this->FileName, image ? "ImageData" : "UnstructuredGrid"))
+  {
+    vtkErrorMacro("Could not create " << this->FileName);
+    this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+    return;
+  }
+
+  bool success;
+  if (image)
+  {
+    success = impl.WriteAttribute("WholeExtent", 6, image->GetExtent()) &&
+      impl.WriteAttribute("Origin", 3, image->GetOrigin()) &&
+      impl.WriteAttribute("Spacing", 3, image->GetSpacing()) &&
+      impl.WriteAttribute("Direction", 9, image->GetDirectionMatrix()->GetData()) &&
+      impl.WriteAttributeData(
+        image, ::ExtentToDims(image->GetExtent(), 1), ::ExtentToDims(image->GetExtent(), 0));
+  }
+  else
+  {
+    vtkCellArray* cells = grid->GetCells();
+    const vtkIdType numberOfPoints = grid->GetNumberOfPoints();
+    const vtkIdType numberOfCells = grid->GetNumberOfCells();
+    const vtkIdType numberOfConnectivityIds =
+      cells ? cells->GetNumberOfConnectivityIds() : 0;
+    const hid_t group = impl.GetVTKGroup();
+
+    success =
+      impl.WriteDataset(group, "NumberOfPoints", H5T_STD_I64LE, H5T_NATIVE_LLONG, { 1 },
+        &numberOfPoints) &&
+      impl.WriteDataset(
+        group, "NumberOfCells", H5T_STD_I64LE, H5T_NATIVE_LLONG, { 1 }, &numberOfCells) &&
+      impl.WriteDataset(group, "NumberOfConnectivityIds", H5T_STD_I64LE, H5T_NATIVE_LLONG, { 1 },
+        &numberOfConnectivityIds);
+    if (success && numberOfPoints > 0)
+    {
+      vtkDataArray* pointArray = grid->GetPoints()->GetData();
+      const hid_t pointType = Implementation::VtkToHdfType(pointArray->GetDataType());
+      success = impl.WriteDataset(group, "Points", pointType, pointType,
+        { static_cast<hsize_t>(numberOfPoints), 3 }, pointArray->GetVoidPointer(0));
+    }
+    if (success && cells)
+    {
+      vtkDataArray* offsets = cells->GetOffsetsArray();
+      vtkDataArray* connectivity = cells->GetConnectivityArray();
+      const hid_t offsetsType = Implementation::VtkToHdfType(offsets->GetDataType());
+      const hid_t connectivityType = Implementation::VtkToHdfType(connectivity->GetDataType());
+      success = impl.WriteDataset(group, "Types", H5T_NATIVE_UCHAR, H5T_NATIVE_UCHAR,
+                  { static_cast<hsize_t>(numberOfCells) },
+                  grid->GetCellTypesArray()->GetVoidPointer(0)) &&
+        impl.WriteDataset(group, "Offsets", offsetsType, offsetsType,
+          { static_cast<hsize_t>(numberOfCells + 1) }, offsets->GetVoidPointer(0)) &&
+        impl.WriteDataset(group, "Connectivity", connectivityType, connectivityType,
+          { static_cast<hsize_t>(numberOfConnectivityIds) }, connectivity->GetVoidPointer(0));
+    }
+    if (success)
+    {
+      success = impl.WriteAttributeData(grid, {}, {});
+    }
+  }
+
+  if (!success)
+  {
+    vtkErrorMacro("Error writing " << this->FileName);
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
+  os << indent << "CompressionLevel: " << this->CompressionLevel << "\n";
+}
@@ -0,0 +1,101 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHDFWriter.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHDFWriter
+ * @brief   VTKHDF format writer.
+ *
+ * Writes data in the VTK HDF format that vtkHDFReader understands.
+ * Image data and unstructured grid inputs are currently implemented.
+ * The HDF5 chunk size used for the point, cell and connectivity
+ * datasets can be controlled through ChunkSize, and the datasets can
+ * optionally be deflate-compressed by setting CompressionLevel to a
+ * non-zero value. Chunked, compressed output can be appended to or
+ * subset efficiently by downstream HDF5 consumers.
+ */
+
+#ifndef vtkHDFWriter_h
+#define vtkHDFWriter_h
+
+#include "vtkIOHDFModule.h" // For export macro
+#include "vtkWriter.h"
+
+class vtkDataSet;
+class vtkImageData;
+class vtkUnstructuredGrid;
+
+class VTKIOHDF_EXPORT vtkHDFWriter : public vtkWriter
+{
+public:
+  static vtkHDFWriter* New();
+  vtkTypeMacro(vtkHDFWriter, vtkWriter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Get the input to this writer.
+   */
+  vtkDataSet* GetInput();
+  vtkDataSet* GetInput(int port);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the name of the output file.
+   */
+  vtkSetFilePathMacro(FileName);
+  vtkGetFilePathMacro(FileName);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the number of tuples per HDF5 chunk used for the array
+   * datasets. Chunking is required for compression and makes appending
+   * and partial reads efficient. A value of 0 (the default) writes
+   * contiguous, unchunked datasets.
+   */
+  vtkSetClampMacro(ChunkSize, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(ChunkSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the deflate compression level applied to the array datasets,
+   * between 0 (no compression, the default) and 9 (best compression).
+   * Compression implies chunking: when the level is non-zero and
+   * ChunkSize is 0, a chunk size is picked automatically.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 0, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
+protected:
+  vtkHDFWriter();
+  ~vtkHDFWriter() override;
+
+  void WriteData() override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  char* FileName;
+  vtkIdType ChunkSize;
+  int CompressionLevel;
+
+private:
+  vtkHDFWriter(const vtkHDFWriter&) = delete;
+  void operator=(const vtkHDFWriter&) = delete;
+
+  class Implementation;
+};
+
+#endif // vtkHDFWriter_h
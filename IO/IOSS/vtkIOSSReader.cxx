@@ -249,7 +249,7 @@ public:
    */
   void ClearCache() { this->Cache.Clear(); }
   void ResetCacheAccessCounts() { this->Cache.ResetAccessCounts(); }
-  void ClearCacheUnused()
+  void ClearCacheUnused(vtkTypeUInt64 budget)
   {
     switch (this->Format)
     {
@@ -259,7 +259,7 @@ public:
         this->Cache.Clear();
         break;
       default:
-        this->Cache.ClearUnused();
+        this->Cache.ClearUnused(budget);
         break;
     }
   }
@@ -2379,6 +2379,7 @@ vtkIOSSReader::vtkIOSSReader()
   , ApplyDisplacements(true)
   , ReadGlobalFields(true)
   , ReadQAAndInformationRecords(true)
+  , CacheMemoryBudget(0)
   , DatabaseTypeOverride(nullptr)
   , AssemblyTag(0)
   , FileRange{ 0, -1 }
@@ -2712,7 +2713,7 @@ int vtkIOSSReader::ReadMesh(
     }
   }
 
-  internals.ClearCacheUnused();
+  internals.ClearCacheUnused(this->CacheMemoryBudget);
   internals.ReleaseRegions();
   return 1;
 }
@@ -3041,6 +3042,7 @@ void vtkIOSSReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DisplacementMagnitude: " << this->Internals->GetDisplacementMagnitude() << endl;
   os << indent << "ReadGlobalFields: " << this->ReadGlobalFields << endl;
   os << indent << "ReadQAAndInformationRecords: " << this->ReadQAAndInformationRecords << endl;
+  os << indent << "CacheMemoryBudget: " << this->CacheMemoryBudget << endl;
   os << indent << "DatabaseTypeOverride: "
      << (this->DatabaseTypeOverride ? this->DatabaseTypeOverride : "(nullptr)") << endl;
 
@@ -337,6 +337,20 @@ public:
   vtkBooleanMacro(ReadQAAndInformationRecords, bool);
   ///@}
 
+  ///@{
+  /**
+   * The reader caches decoded data (connectivity, coordinates, field
+   * arrays) between update passes. By default, cache entries that were not
+   * used in the most recent pass are released at the end of it. Set a
+   * non-zero budget, in kibibytes, to additionally retain the most recently
+   * used of those entries within the budget. This makes scrubbing back and
+   * forth in time reuse data decoded for previously visited timesteps
+   * instead of re-reading it from the database. Default is 0.
+   */
+  vtkSetMacro(CacheMemoryBudget, vtkTypeUInt64);
+  vtkGetMacro(CacheMemoryBudget, vtkTypeUInt64);
+  ///@}
+
   ///@{
   /**
    * Get/Set the controller to use when working in parallel. Initialized to
@@ -617,6 +631,7 @@ private:
   bool ApplyDisplacements;
   bool ReadGlobalFields;
   bool ReadQAAndInformationRecords;
+  vtkTypeUInt64 CacheMemoryBudget;
   char* DatabaseTypeOverride;
   int AssemblyTag;
   int FileRange[2];
@@ -39,7 +39,9 @@
 #include <Ioss_SideBlock.h>
 #include <Ioss_SideSet.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace vtkIOSSUtilities
 {
@@ -49,8 +51,34 @@ class Cache::CacheInternals
 {
 public:
   using KeyType = std::pair<std::string, std::string>;
-  using ValueType = std::pair<vtkSmartPointer<vtkObject>, bool>;
+  struct ValueType
+  {
+    vtkSmartPointer<vtkObject> Object;
+    bool Used = false;
+    vtkTypeUInt64 LastAccess = 0;
+  };
   std::map<KeyType, ValueType> CacheMap;
+  vtkTypeUInt64 AccessCounter = 0;
+
+  // size of a cached entry in kibibytes, following
+  // vtkAbstractArray::GetActualMemorySize
+  static vtkTypeUInt64 GetSize(vtkObject* object)
+  {
+    if (auto array = vtkAbstractArray::SafeDownCast(object))
+    {
+      return array->GetActualMemorySize();
+    }
+    if (auto points = vtkPoints::SafeDownCast(object))
+    {
+      return points->GetData() ? points->GetData()->GetActualMemorySize() : 0;
+    }
+    if (auto cells = vtkCellArray::SafeDownCast(object))
+    {
+      return cells->GetActualMemorySize();
+    }
+    // unknown type: count something so a budget still bounds growth
+    return 1;
+  }
 
   static std::string GetPath(const Ioss::GroupingEntity* entity)
   {
@@ -93,18 +121,46 @@ void Cache::ResetAccessCounts()
 {
   for (auto& pair : this->Internals->CacheMap)
   {
-    pair.second.second = false;
+    pair.second.Used = false;
   }
 }
 
 //----------------------------------------------------------------------------
-void Cache::ClearUnused()
+void Cache::ClearUnused(vtkTypeUInt64 budget)
 {
   auto& internals = (*this->Internals);
+  if (budget > 0)
+  {
+    // retain the most recently accessed unused entries within the budget by
+    // marking them used; the rest is erased below.
+    std::vector<std::map<CacheInternals::KeyType, CacheInternals::ValueType>::iterator> unused;
+    for (auto iter = internals.CacheMap.begin(); iter != internals.CacheMap.end(); ++iter)
+    {
+      if (!iter->second.Used)
+      {
+        unused.push_back(iter);
+      }
+    }
+    std::sort(unused.begin(), unused.end(),
+      [](const decltype(unused)::value_type& lhs, const decltype(unused)::value_type& rhs) {
+        return lhs->second.LastAccess > rhs->second.LastAccess;
+      });
+    vtkTypeUInt64 total = 0;
+    for (auto& iter : unused)
+    {
+      total += CacheInternals::GetSize(iter->second.Object);
+      if (total > budget)
+      {
+        break;
+      }
+      iter->second.Used = true;
+    }
+  }
+
   auto iter = internals.CacheMap.begin();
   while (iter != internals.CacheMap.end())
   {
-    if (!iter->second.second)
+    if (!iter->second.Used)
     {
       iter = internals.CacheMap.erase(iter);
     }
@@ -130,8 +186,9 @@ vtkObject* Cache::Find(const Ioss::GroupingEntity* entity, const std::string& ca
   auto iter = internals.CacheMap.find(key);
   if (iter != internals.CacheMap.end())
   {
-    iter->second.second = true;
-    return iter->second.first.GetPointer();
+    iter->second.Used = true;
+    iter->second.LastAccess = ++internals.AccessCounter;
+    return iter->second.Object.GetPointer();
   }
   return nullptr;
 }
@@ -143,8 +200,9 @@ void Cache::Insert(
   auto& internals = (*this->Internals);
   auto key = CacheInternals::KeyType(CacheInternals::GetPath(entity), cachekey);
   auto& value = internals.CacheMap[key];
-  value.first = array;
-  value.second = true;
+  value.Object = array;
+  value.Used = true;
+  value.LastAccess = ++internals.AccessCounter;
 }
 
 //============================================================================
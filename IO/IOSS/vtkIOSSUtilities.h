@@ -82,10 +82,14 @@ public:
   void ResetAccessCounts();
 
   /**
-   * Removes all cached entries not accessed since
-   * most recent call to `ResetAccessCounts`.
+   * Removes cached entries not accessed since the most recent call to
+   * `ResetAccessCounts`. If `budget` is non-zero, the most recently
+   * accessed of those entries are retained as long as their cumulative
+   * size stays within `budget` kibibytes (the unit reported by
+   * `vtkAbstractArray::GetActualMemorySize`), so that revisiting a
+   * timestep can reuse data decoded for it earlier.
    */
-  void ClearUnused();
+  void ClearUnused(vtkTypeUInt64 budget = 0);
 
   /**
    * Clears the cache.
@@ -23,6 +23,7 @@
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 
@@ -30,6 +31,10 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 vtkStandardNewMacro(vtkImageReader2);
 
 //------------------------------------------------------------------------------
@@ -666,12 +671,116 @@ void vtkImageReader2::SeekFile(int i, int j, int k)
   }
 }
 
+//------------------------------------------------------------------------------
+// This function reads the slices of a file series in parallel, each thread
+// opening its own stream, so decoding a many-slice series is not serialized
+// on one file handle. File names and header sizes are resolved up front
+// because computing them mutates the reader.
+template <class OT>
+void vtkImageReader2UpdateSeries(vtkImageReader2* self, vtkImageData* data, OT* outPtr)
+{
+  vtkIdType outIncr[3];
+  int outExtent[6];
+  int dataExtent[6];
+
+  data->GetExtent(outExtent);
+  data->GetIncrements(outIncr);
+  self->GetDataExtent(dataExtent);
+  int nComponents = data->GetNumberOfScalarComponents();
+
+  // length of a row, num pixels read at a time
+  int pixelRead = outExtent[1] - outExtent[0] + 1;
+  long streamRead = (long)(pixelRead * nComponents * sizeof(OT));
+
+  // increments within a slice file
+  unsigned long fileIncr0 = nComponents * sizeof(OT);
+  unsigned long fileIncr1 = fileIncr0 * (dataExtent[1] - dataExtent[0] + 1);
+
+  int numSlices = outExtent[5] - outExtent[4] + 1;
+  std::vector<std::string> sliceNames(numSlices);
+  std::vector<unsigned long> headerSizes(numSlices);
+  for (int slice = 0; slice < numSlices; ++slice)
+  {
+    headerSizes[slice] = self->GetHeaderSize(outExtent[4] + slice);
+    self->ComputeInternalFileName(outExtent[4] + slice);
+    if (!self->GetInternalFileName())
+    {
+      return;
+    }
+    sliceNames[slice] = self->GetInternalFileName();
+  }
+
+  vtkTypeBool fileLowerLeft = self->GetFileLowerLeft();
+  vtkTypeBool swapBytes = self->GetSwapBytes();
+  std::atomic<bool> readFailed(false);
+
+  vtkSMPTools::For(0, numSlices, [&](vtkIdType begin, vtkIdType end) {
+    std::ios_base::openmode mode = ios::in;
+#ifdef _WIN32
+    mode |= ios::binary;
+#endif
+    for (vtkIdType slice = begin; slice < end; ++slice)
+    {
+      if (self->AbortExecute || readFailed)
+      {
+        return;
+      }
+      vtksys::ifstream file(sliceNames[slice].c_str(), mode);
+      if (file.fail())
+      {
+        readFailed = true;
+        return;
+      }
+      OT* outPtr1 = outPtr + slice * outIncr[2];
+      for (int idx1 = outExtent[2]; idx1 <= outExtent[3]; ++idx1)
+      {
+        // seek to the correct row
+        unsigned long streamStart = (outExtent[0] - dataExtent[0]) * fileIncr0;
+        if (fileLowerLeft)
+        {
+          streamStart += (idx1 - dataExtent[2]) * fileIncr1;
+        }
+        else
+        {
+          streamStart += (dataExtent[3] - dataExtent[2] - idx1) * fileIncr1;
+        }
+        streamStart += headerSizes[slice];
+        file.seekg((long)streamStart, ios::beg);
+        // read the row.
+        if (!file.read((char*)outPtr1, streamRead))
+        {
+          readFailed = true;
+          return;
+        }
+        // handle swapping
+        if (swapBytes && sizeof(OT) > 1)
+        {
+          vtkByteSwap::SwapVoidRange(outPtr1, pixelRead * nComponents, sizeof(OT));
+        }
+        outPtr1 += outIncr[1];
+      }
+    }
+  });
+
+  if (readFailed)
+  {
+    vtkGenericWarningMacro("File operation failed while reading the slice series.");
+  }
+}
+
 //------------------------------------------------------------------------------
 // This function reads in one data of data.
 // templated to handle different data types.
 template <class OT>
 void vtkImageReader2Update(vtkImageReader2* self, vtkImageData* data, OT* outPtr)
 {
+  // slice-per-file series: read the slices concurrently
+  if (self->GetFileDimensionality() == 2)
+  {
+    vtkImageReader2UpdateSeries(self, data, outPtr);
+    return;
+  }
+
   vtkIdType outIncr[3];
   OT *outPtr1, *outPtr2;
   long streamRead;
@@ -695,25 +804,14 @@ void vtkImageReader2Update(vtkImageReader2* self, vtkImageData* data, OT* outPtr
   target++;
 
   // read the data row by row
-  if (self->GetFileDimensionality() == 3)
+  self->ComputeInternalFileName(0);
+  if (!self->OpenFile())
   {
-    self->ComputeInternalFileName(0);
-    if (!self->OpenFile())
-    {
-      return;
-    }
+    return;
   }
   outPtr2 = outPtr;
   for (idx2 = outExtent[4]; idx2 <= outExtent[5]; ++idx2)
   {
-    if (self->GetFileDimensionality() == 2)
-    {
-      self->ComputeInternalFileName(idx2);
-      if (!self->OpenFile())
-      {
-        return;
-      }
-    }
     outPtr1 = outPtr2;
     for (idx1 = outExtent[2]; !self->AbortExecute && idx1 <= outExtent[3]; ++idx1)
     {
@@ -18,6 +18,8 @@
 #include "vtkDataArray.h"
 #include "vtkErrorCode.h"
 #include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtksys/SystemTools.hxx"
@@ -635,6 +637,24 @@ void vtkTIFFReader::Process(OT* outPtr, int outExtent[6], vtkIdType outIncr[3])
   }
 }
 
+//------------------------------------------------------------------------------
+int vtkTIFFReader::RequestInformation(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->Superclass::RequestInformation(request, inputVector, outputVector))
+  {
+    return 0;
+  }
+  // tiled single-page files decode only the tiles intersecting a requested
+  // sub-extent, so let consumers stream pieces of large images
+  if (this->InternalImage->NumberOfTiles > 0 && this->InternalImage->NumberOfPages <= 1)
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    outInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
+  }
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // This function reads a data from a file.  The datas extent/axes
 // are assumed to be the same as the file extent/order.
@@ -850,118 +870,64 @@ void vtkTIFFReader::ReadVolume(T* buffer)
   }
 }
 
-/** Read a tiled tiff */
+/** Read a tiled tiff, decoding only the tiles that intersect OutputExtent */
 void vtkTIFFReader::ReadTiles(void* buffer)
 {
   unsigned char* volume = reinterpret_cast<unsigned char*>(buffer);
   unsigned char* tile = new unsigned char[TIFFTileSize(this->InternalImage->Image)];
 
-  const unsigned int width = this->InternalImage->Width;
-  const unsigned int height = this->InternalImage->Height;
-  const unsigned int tileWidth = this->InternalImage->TileWidth;
-  const unsigned int tileHeight = this->InternalImage->TileHeight;
-  const unsigned int pixelSize = this->InternalImage->SamplesPerPixel;
-  const bool rowMultiple = height % tileHeight == 0;
-  const bool colMultiple = width % tileWidth == 0;
+  const int width = static_cast<int>(this->InternalImage->Width);
+  const int height = static_cast<int>(this->InternalImage->Height);
+  const int tileWidth = static_cast<int>(this->InternalImage->TileWidth);
+  const int tileHeight = static_cast<int>(this->InternalImage->TileHeight);
+  const int samplesPerPixel = static_cast<int>(this->InternalImage->SamplesPerPixel);
+  const int bytesPerSample = (this->InternalImage->BitsPerSample + 7) / 8;
+  const int pixelSize = samplesPerPixel * bytesPerSample;
   const bool flip = this->InternalImage->Orientation != ORIENTATION_TOPLEFT;
 
-  for (unsigned int slice = 0; slice < this->InternalImage->NumberOfPages; ++slice)
+  const int xStart = this->OutputExtent[0];
+  const int xEnd = this->OutputExtent[1];
+  // output rows mirror the file rows for bottom-up orientations
+  const int yFileStart = flip ? height - 1 - this->OutputExtent[3] : this->OutputExtent[2];
+  const int yFileEnd = flip ? height - 1 - this->OutputExtent[2] : this->OutputExtent[3];
+
+  for (int slice = this->OutputExtent[4]; slice <= this->OutputExtent[5]; ++slice)
   {
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
+    for (int row = (yFileStart / tileHeight) * tileHeight; row <= yFileEnd; row += tileHeight)
     {
-      const unsigned int r = flip ? height - row - tileHeight : row;
-      for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
+      for (int col = (xStart / tileWidth) * tileWidth; col <= xEnd; col += tileWidth)
       {
-        if (TIFFReadTile(this->InternalImage->Image, tile, col, r, slice, 0) < 0)
+        if (TIFFReadTile(this->InternalImage->Image, tile, col, row, slice, 0) < 0)
         {
-          vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
+          vtkErrorMacro(<< "Cannot read tile : " << row << "," << col << " from file");
           delete[] tile;
           return;
         }
-        // Currently not using tile depth
-        unsigned int zz = 0;
-        for (unsigned int yy = 0; yy < tileHeight; ++yy)
+
+        // clip the tile against the image and the requested extent; edge
+        // tiles are padded to the full tile size in the file
+        const int rowStart = std::max(row, yFileStart);
+        const int rowEnd = std::min(std::min(row + tileHeight - 1, height - 1), yFileEnd);
+        const int colStart = std::max(col, xStart);
+        const int colEnd = std::min(std::min(col + tileWidth - 1, width - 1), xEnd);
+        const vtkIdType copyBytes = static_cast<vtkIdType>(colEnd - colStart + 1) * pixelSize;
+
+        for (int fileRow = rowStart; fileRow <= rowEnd; ++fileRow)
         {
-          const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-          memcpy(volume + (((slice + zz) * height + row + y) * width + col) * pixelSize,
-            tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
+          const int outRow = flip ? height - 1 - fileRow : fileRow;
+          unsigned char* dest = volume +
+            (static_cast<vtkIdType>(slice - this->OutputExtent[4]) * this->OutputIncrements[2] +
+              static_cast<vtkIdType>(outRow - this->OutputExtent[2]) * this->OutputIncrements[1] +
+              static_cast<vtkIdType>(colStart - this->OutputExtent[0]) *
+                this->OutputIncrements[0]) *
+              bytesPerSample;
+          const unsigned char* src = tile +
+            (static_cast<vtkIdType>(fileRow - row) * tileWidth + (colStart - col)) * pixelSize;
+          memcpy(dest, src, copyBytes);
         }
       }
     }
   }
-  // Fill the boundaries
-  if (!colMultiple)
-  {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-    const unsigned int tilexWidth = lenx;
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
-    {
-      const unsigned int r = flip ? height - row - tileHeight - 1 : row;
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, r, 0, 0) < 0)
-      {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
-      }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < tileHeight; ++yy)
-      {
-        const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + row + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
-      }
-    }
-  }
-  if (!rowMultiple)
-  {
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int r = flip ? 0 : row;
-    for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
-    {
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
-      {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
-      }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < leny; ++yy)
-      {
-        const unsigned int y = flip ? leny - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
-      }
-    }
-  }
-  if (!colMultiple && !rowMultiple)
-  {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int tilexWidth = lenx;
-
-    const unsigned int r = flip ? 0 : row;
-    if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
-    {
-      vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-      delete[] tile;
-      return;
-    }
-    const unsigned int zz = 0;
-    unsigned int y;
-    for (unsigned int yy = 0; yy < leny; ++yy)
-    {
-      y = flip ? leny - yy - 1 : yy;
-      memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-        tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
-    }
-  }
   delete[] tile;
 }
 
@@ -20,6 +20,7 @@
 
 #include "vtkDelimitedTextReader.h"
 #include "vtkCommand.h"
+#include "vtkDataArraySelection.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
@@ -57,6 +58,21 @@
 namespace
 {
 
+// The byte-level fast path below requires that every delimiter be an ASCII
+// character so that the bytes of a multi-byte UTF-8 sequence can never
+// collide with a delimiter.
+bool AllAscii(const std::string& text)
+{
+  for (char c : text)
+  {
+    if (static_cast<unsigned char>(c) >= 0x80)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 class DelimitedTextIterator : public vtkTextCodec::OutputIterator
 {
 public:
@@ -69,7 +85,8 @@ public:
   DelimitedTextIterator(const vtkIdType max_records, const std::string& record_delimiters,
     const std::string& field_delimiters, const std::string& string_delimiters,
     const std::string& whitespace, const std::string& escape, bool have_headers,
-    bool merg_cons_delimiters, bool use_string_delimeter, vtkTable* const output_table)
+    bool merg_cons_delimiters, bool use_string_delimeter,
+    vtkDataArraySelection* const column_selection, vtkTable* const output_table)
     : MaxRecords(max_records)
     , MaxRecordIndex(have_headers ? max_records + 1 : max_records)
     , RecordDelimiters(record_delimiters.begin(), record_delimiters.end())
@@ -79,6 +96,7 @@ public:
     , EscapeDelimiter(escape.begin(), escape.end())
     , HaveHeaders(have_headers)
     , WhiteSpaceOnlyString(true)
+    , ColumnSelection(column_selection)
     , OutputTable(output_table)
     , CurrentRecordIndex(0)
     , CurrentFieldIndex(0)
@@ -88,6 +106,21 @@ public:
     , UseStringDelimiter(use_string_delimeter)
     , WithinString(0)
   {
+    // Classify ASCII bytes once so that ParseBytes() can skip over runs of
+    // ordinary characters in bulk.
+    std::fill(this->SpecialByte, this->SpecialByte + 128, static_cast<unsigned char>(0));
+    const std::set<vtkTypeUInt32>* charSets[] = { &this->RecordDelimiters, &this->FieldDelimiters,
+      &this->StringDelimiters, &this->Whitespace, &this->EscapeDelimiter };
+    for (const std::set<vtkTypeUInt32>* charSet : charSets)
+    {
+      for (vtkTypeUInt32 value : *charSet)
+      {
+        if (value < 128)
+        {
+          this->SpecialByte[value] = 1;
+        }
+      }
+    }
   }
 
   ~DelimitedTextIterator() override
@@ -125,6 +158,51 @@ public:
     }
   }
 
+  /// Scan a buffer of UTF-8 (or plain ASCII) text directly, without routing
+  /// every character through a codec. Runs of ordinary bytes between
+  /// delimiters are appended to the current field in bulk; only delimiter,
+  /// whitespace and escape bytes take the per-character path. Only valid
+  /// when every delimiter is ASCII, so that multi-byte sequences can be
+  /// copied verbatim.
+  void ParseBytes(const char* buffer, size_t size)
+  {
+    const char* current = buffer;
+    const char* end = buffer + size;
+    while (current != end)
+    {
+      unsigned char byte = static_cast<unsigned char>(*current);
+      if (!this->ProcessEscapeSequence && (byte >= 128 || !this->SpecialByte[byte]))
+      {
+        const char* runStart = current;
+        do
+        {
+          ++current;
+        } while (current != end &&
+          (static_cast<unsigned char>(*current) >= 128 ||
+            !this->SpecialByte[static_cast<unsigned char>(*current)]));
+
+        // Everything is ignored once the maximum number of records is reached.
+        if (this->MaxRecords && this->CurrentRecordIndex == this->MaxRecordIndex)
+        {
+          return;
+        }
+        this->RecordAdjacent = false;
+        this->WhiteSpaceOnlyString = false;
+        this->CurrentField.append(runStart, current);
+      }
+      else if (this->ProcessEscapeSequence && byte >= 128)
+      {
+        // Escape handling needs the decoded code point.
+        (*this) = utf8::next(current, end);
+      }
+      else
+      {
+        (*this) = static_cast<vtkTypeUInt32>(byte);
+        ++current;
+      }
+    }
+  }
+
   DelimitedTextIterator& operator=(const vtkTypeUInt32& value) override
   {
     // If we've already read our maximum number of records, we're done ...
@@ -249,28 +327,50 @@ public:
 private:
   void InsertField()
   {
-    if (this->CurrentFieldIndex >= this->OutputTable->GetNumberOfColumns() &&
+    if (this->CurrentFieldIndex >= static_cast<vtkIdType>(this->ColumnMap.size()) &&
       0 == this->CurrentRecordIndex)
     {
-      vtkAbstractArray* array = vtkStringArray::New();
-
+      std::string name;
       if (this->HaveHeaders)
       {
-        array->SetName(this->CurrentField.c_str());
+        name = this->CurrentField;
       }
       else
       {
         std::stringstream buffer;
         buffer << "Field " << this->CurrentFieldIndex;
-        array->SetName(buffer.str().c_str());
-        vtkArrayDownCast<vtkStringArray>(array)->InsertValue(
-          this->CurrentRecordIndex, this->CurrentField);
+        name = buffer.str();
       }
+
+      // Register the column with the selection and skip it when disabled,
+      // so that projecting out columns avoids both the parse and the
+      // storage costs.
+      const bool enabled = this->ColumnSelection->ArrayIsEnabled(name.c_str()) != 0;
+      this->ColumnSelection->AddArray(name.c_str(), enabled);
+      if (!enabled)
+      {
+        this->ColumnMap.push_back(-1);
+        return;
+      }
+
+      vtkStringArray* array = vtkStringArray::New();
+      array->SetName(name.c_str());
+      if (!this->HaveHeaders)
+      {
+        array->InsertValue(this->CurrentRecordIndex, this->CurrentField);
+      }
+      this->ColumnMap.push_back(this->OutputTable->GetNumberOfColumns());
       this->OutputTable->AddColumn(array);
       array->Delete();
     }
-    else if (this->CurrentFieldIndex < this->OutputTable->GetNumberOfColumns())
+    else if (this->CurrentFieldIndex < static_cast<vtkIdType>(this->ColumnMap.size()))
     {
+      vtkIdType column = this->ColumnMap[this->CurrentFieldIndex];
+      if (column < 0)
+      {
+        return;
+      }
+
       // Handle case where input file has header information ...
       vtkIdType rec_index = this->CurrentRecordIndex;
       if (this->HaveHeaders)
@@ -279,7 +379,7 @@ private:
       }
 
       vtkStringArray* sarray =
-        vtkArrayDownCast<vtkStringArray>(this->OutputTable->GetColumn(this->CurrentFieldIndex));
+        vtkArrayDownCast<vtkStringArray>(this->OutputTable->GetColumn(column));
       sarray->InsertValue(rec_index, this->CurrentField);
     }
   }
@@ -293,6 +393,7 @@ private:
   std::set<vtkTypeUInt32> EscapeDelimiter;
   bool HaveHeaders;
   bool WhiteSpaceOnlyString;
+  vtkDataArraySelection* ColumnSelection;
   vtkTable* OutputTable;
   vtkIdType CurrentRecordIndex;
   vtkIdType CurrentFieldIndex;
@@ -302,6 +403,10 @@ private:
   bool ProcessEscapeSequence;
   bool UseStringDelimiter;
   vtkTypeUInt32 WithinString;
+  // Maps input field index to output column index (-1 for disabled columns).
+  std::vector<vtkIdType> ColumnMap;
+  // Marks the ASCII bytes that need per-character handling in ParseBytes().
+  unsigned char SpecialByte[128];
 };
 
 } // End anonymous namespace
@@ -344,6 +449,12 @@ vtkDelimitedTextReader::vtkDelimitedTextReader()
   this->DefaultIntegerValue = 0;
   this->DefaultDoubleValue = 0.0;
   this->TrimWhitespacePriorToNumericConversion = false;
+
+  // All columns are loaded by default; columns not yet known to the
+  // selection are treated as enabled.
+  this->ColumnArraySelection->SetUnknownArraySetting(1);
+  this->ColumnArraySelection->AddObserver(
+    vtkCommand::ModifiedEvent, this, &vtkDelimitedTextReader::Modified);
 }
 
 vtkDelimitedTextReader::~vtkDelimitedTextReader()
@@ -395,6 +506,8 @@ void vtkDelimitedTextReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OutputPedigreeIds: " << (this->OutputPedigreeIds ? "true" : "false") << endl;
   os << indent << "AddTabFieldDelimiter: " << (this->AddTabFieldDelimiter ? "true" : "false")
      << endl;
+  os << indent << "ColumnArraySelection:" << endl;
+  this->ColumnArraySelection->PrintSelf(os, indent.GetNextIndent());
 }
 
 void vtkDelimitedTextReader::SetInputString(const char* in)
@@ -469,6 +582,33 @@ const char* vtkDelimitedTextReader::GetUTF8StringDelimiters()
   return this->UnicodeStringDelimiters.c_str();
 }
 
+int vtkDelimitedTextReader::GetNumberOfColumnArrays()
+{
+  return this->ColumnArraySelection->GetNumberOfArrays();
+}
+
+const char* vtkDelimitedTextReader::GetColumnArrayName(int index)
+{
+  return this->ColumnArraySelection->GetArrayName(index);
+}
+
+void vtkDelimitedTextReader::SetColumnArrayStatus(const char* name, int status)
+{
+  if (status)
+  {
+    this->ColumnArraySelection->EnableArray(name);
+  }
+  else
+  {
+    this->ColumnArraySelection->DisableArray(name);
+  }
+}
+
+int vtkDelimitedTextReader::GetColumnArrayStatus(const char* name)
+{
+  return this->ColumnArraySelection->ArrayIsEnabled(name);
+}
+
 vtkStdString vtkDelimitedTextReader::GetLastError()
 {
   return this->LastError;
@@ -502,9 +642,12 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
       throw std::runtime_error("You must specify a pedigree id array name");
     }
 
-    istream* input_stream_pt = nullptr;
-    vtksys::ifstream file_stream;
-    std::istringstream string_stream;
+    // Pull the entire input into a contiguous buffer using large block
+    // reads. Parsing out of memory avoids per-character stream overhead
+    // and enables the bulk delimiter scan below.
+    std::vector<char> content;
+    const char* buffer = nullptr;
+    size_t buffer_size = 0;
 
     if (!this->ReadFromInputString)
     {
@@ -513,32 +656,29 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
       {
         return 1;
       }
-      // Get the total size of the input file in bytes
-      file_stream.open(this->FileName, ios::binary);
+      vtksys::ifstream file_stream(this->FileName, ios::binary);
       if (!file_stream.good())
       {
         throw std::runtime_error("Unable to open input file " + std::string(this->FileName));
       }
 
-      file_stream.seekg(0, ios::end);
-      // const vtkIdType total_bytes = file_stream.tellg();
-      file_stream.seekg(0, ios::beg);
-
-      input_stream_pt = &file_stream;
+      const size_t block_size = 1 << 20;
+      while (file_stream)
+      {
+        content.resize(buffer_size + block_size);
+        file_stream.read(content.data() + buffer_size, block_size);
+        buffer_size += static_cast<size_t>(file_stream.gcount());
+      }
+      content.resize(buffer_size);
+      buffer = content.data();
     }
-    else
+    else if (this->InputString && this->InputStringLength > 0)
     {
-      string_stream.str(this->InputString);
-      input_stream_pt = &string_stream;
+      buffer = this->InputString;
+      buffer_size = static_cast<size_t>(this->InputStringLength);
     }
 
-    vtkTextCodec* transCodec = nullptr;
-
-    if (this->UnicodeCharacterSet)
-    {
-      transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
-    }
-    else
+    if (!this->UnicodeCharacterSet)
     {
       char tstring[2];
       tstring[1] = '\0';
@@ -552,23 +692,53 @@ int vtkDelimitedTextReader::ReadData(vtkTable* const output_table)
       }
       this->UnicodeFieldDelimiters = fieldDelimiterCharacters;
       this->UnicodeStringDelimiters = tstring;
-      transCodec = vtkTextCodecFactory::CodecToHandle(*input_stream_pt);
-    }
-
-    if (nullptr == transCodec)
-    {
-      // should this use the locale instead??
-      return 1;
     }
 
     DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
       this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
       this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
-      this->UseStringDelimiter, output_table);
+      this->UseStringDelimiter, this->ColumnArraySelection, output_table);
+
+    // Scan the buffer directly whenever the input is valid UTF-8 (of which
+    // plain ASCII is a subset) and every delimiter is an ASCII character.
+    // Everything else -- UTF-16, code-page fallbacks -- takes the original
+    // codec route.
+    const bool ascii_delimiters = AllAscii(this->UnicodeRecordDelimiters) &&
+      AllAscii(this->UnicodeFieldDelimiters) && AllAscii(this->UnicodeStringDelimiters) &&
+      AllAscii(this->UnicodeWhitespace) && AllAscii(this->UnicodeEscapeCharacter);
+    const bool utf8_input =
+      !this->UnicodeCharacterSet || 0 == strcmp(this->UnicodeCharacterSet, "UTF-8");
+
+    if (ascii_delimiters && utf8_input && utf8::is_valid(buffer, buffer + buffer_size))
+    {
+      iterator.ParseBytes(buffer, buffer_size);
+      iterator.ReachedEndOfInput();
+    }
+    else
+    {
+      std::istringstream string_stream(buffer ? std::string(buffer, buffer_size) : std::string());
+      std::vector<char>().swap(content); // the stream holds its own copy
+
+      vtkTextCodec* transCodec = nullptr;
+      if (this->UnicodeCharacterSet)
+      {
+        transCodec = vtkTextCodecFactory::CodecForName(this->UnicodeCharacterSet);
+      }
+      else
+      {
+        transCodec = vtkTextCodecFactory::CodecToHandle(string_stream);
+      }
 
-    transCodec->ToUnicode(*input_stream_pt, iterator);
-    iterator.ReachedEndOfInput();
-    transCodec->Delete();
+      if (nullptr == transCodec)
+      {
+        // should this use the locale instead??
+        return 1;
+      }
+
+      transCodec->ToUnicode(string_stream, iterator);
+      iterator.ReachedEndOfInput();
+      transCodec->Delete();
+    }
 
     if (this->OutputPedigreeIds)
     {
@@ -64,9 +64,12 @@
 #define vtkDelimitedTextReader_h
 
 #include "vtkIOInfovisModule.h" // For export macro
+#include "vtkNew.h"             // Needed for vtkNew
 #include "vtkStdString.h"       // Needed for vtkStdString
 #include "vtkTableAlgorithm.h"
 
+class vtkDataArraySelection;
+
 class VTKIOINFOVIS_EXPORT vtkDelimitedTextReader : public vtkTableAlgorithm
 {
 public:
@@ -305,6 +308,25 @@ public:
   vtkBooleanMacro(AddTabFieldDelimiter, bool);
   ///@}
 
+  ///@{
+  /**
+   * Access the selection of columns to load (column projection). Columns
+   * are registered in the selection as they are discovered, using the
+   * header names when HaveHeaders is on and "Field N" otherwise, and are
+   * enabled by default. Fields belonging to disabled columns are skipped
+   * entirely during parsing, so loading a few columns of a wide file is
+   * substantially cheaper than loading all of them. To restrict the
+   * selection before the file has ever been read, call
+   * GetColumnArraySelection()->SetUnknownArraySetting(0) and enable the
+   * desired columns by name.
+   */
+  vtkDataArraySelection* GetColumnArraySelection() { return this->ColumnArraySelection; }
+  int GetNumberOfColumnArrays();
+  const char* GetColumnArrayName(int index);
+  void SetColumnArrayStatus(const char* name, int status);
+  int GetColumnArrayStatus(const char* name);
+  ///@}
+
   /**
    * Returns a human-readable description of the most recent error, if any.
    * Otherwise, returns an empty string.  Note that the result is only valid
@@ -358,6 +380,7 @@ protected:
   bool AddTabFieldDelimiter;
   vtkStdString LastError;
   vtkTypeUInt32 ReplacementCharacter;
+  vtkNew<vtkDataArraySelection> ColumnArraySelection;
 
 private:
   vtkDelimitedTextReader(const vtkDelimitedTextReader&) = delete;
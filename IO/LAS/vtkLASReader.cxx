@@ -31,7 +31,6 @@
 
 #include <fstream>
 #include <iostream>
-#include <valarray>
 
 vtkStandardNewMacro(vtkLASReader);
 
@@ -39,6 +38,7 @@ vtkStandardNewMacro(vtkLASReader);
 vtkLASReader::vtkLASReader()
 {
   this->FileName = nullptr;
+  this->MaximumNumberOfPoints = 0;
 
   this->SetNumberOfInputPorts(0);
   this->SetNumberOfOutputPorts(1);
@@ -103,20 +103,53 @@ void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* poin
   intensity->SetNumberOfComponents(1);
 
   liblas::Header header = liblas::Header(reader.GetHeader());
-  std::valarray<double> scale = { header.GetScaleX(), header.GetScaleY(), header.GetScaleZ() };
-  std::valarray<double> offset = { header.GetOffsetX(), header.GetOffsetY(), header.GetOffsetZ() };
   liblas::PointFormatName pointFormat = header.GetDataFormatId();
-  int pointRecordsCount = header.GetPointRecordsCount();
+  vtkIdType pointRecordsCount = header.GetPointRecordsCount();
 
-  for (int i = 0; i < pointRecordsCount && reader.ReadNextPoint(); i++)
+  // When a point budget is set, keep every n-th record so that no more than
+  // MaximumNumberOfPoints points are produced.
+  vtkIdType stride = 1;
+  if (this->MaximumNumberOfPoints > 0 && pointRecordsCount > this->MaximumNumberOfPoints)
   {
+    stride = (pointRecordsCount + this->MaximumNumberOfPoints - 1) / this->MaximumNumberOfPoints;
+  }
+  vtkIdType expectedPoints = (pointRecordsCount + stride - 1) / stride;
+
+  // Size the points and the scalar arrays from the header's record count so
+  // the read fills them in place instead of growing them point by point;
+  // incremental growth reallocates repeatedly on billion-point files.
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(expectedPoints);
+  intensity->SetNumberOfTuples(expectedPoints);
+  switch (pointFormat)
+  {
+    case liblas::ePointFormat2:
+    case liblas::ePointFormat3:
+    case liblas::ePointFormat5:
+      color->SetNumberOfTuples(expectedPoints);
+      break;
+
+    case liblas::ePointFormat0:
+    case liblas::ePointFormat1:
+      classification->SetNumberOfTuples(expectedPoints);
+      break;
+
+    case liblas::ePointFormatUnknown:
+    default:
+      break;
+  }
+
+  vtkIdType pointId = 0;
+  for (vtkIdType i = 0; i < pointRecordsCount && reader.ReadNextPoint(); i++)
+  {
+    if (i % stride != 0)
+    {
+      continue;
+    }
     liblas::Point const& p = reader.GetPoint();
-    std::valarray<double> lasPoint = { p.GetX(), p.GetY(), p.GetZ() };
-    points->InsertNextPoint(&lasPoint[0]);
-    // std::valarray<double> point = lasPoint * scale + offset;
     // We have seen a file where the scaled points were much smaller than the offset
     // So, all points ended up in the same place.
-    std::valarray<double> point = lasPoint * scale;
+    points->SetPoint(pointId, p.GetX(), p.GetY(), p.GetZ());
     switch (pointFormat)
     {
       case liblas::ePointFormat2:
@@ -127,22 +160,38 @@ void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* poin
         c[0] = p.GetColor().GetRed();
         c[1] = p.GetColor().GetGreen();
         c[2] = p.GetColor().GetBlue();
-        color->InsertNextTypedTuple(c);
-        intensity->InsertNextValue(p.GetIntensity());
+        color->SetTypedTuple(pointId, c);
+        intensity->SetValue(pointId, p.GetIntensity());
       }
       break;
 
       case liblas::ePointFormat0:
       case liblas::ePointFormat1:
-        classification->InsertNextValue(p.GetClassification().GetClass());
-        intensity->InsertNextValue(p.GetIntensity());
+        classification->SetValue(pointId, p.GetClassification().GetClass());
+        intensity->SetValue(pointId, p.GetIntensity());
         break;
 
       case liblas::ePointFormatUnknown:
       default:
-        intensity->InsertNextValue(p.GetIntensity());
+        intensity->SetValue(pointId, p.GetIntensity());
         break;
     }
+    pointId++;
+  }
+
+  // Trim in case the file held fewer records than the header advertised.
+  if (pointId < expectedPoints)
+  {
+    points->SetNumberOfPoints(pointId);
+    intensity->SetNumberOfTuples(pointId);
+    if (color->GetNumberOfTuples() > 0)
+    {
+      color->SetNumberOfTuples(pointId);
+    }
+    if (classification->GetNumberOfTuples() > 0)
+    {
+      classification->SetNumberOfTuples(pointId);
+    }
   }
 
   pointsPolyData->SetPoints(points);
@@ -172,4 +221,5 @@ void vtkLASReader::PrintSelf(ostream& os, vtkIndent indent)
   Superclass::PrintSelf(os, indent);
   os << "vtkLASReader" << std::endl;
   os << "Filename: " << this->FileName << std::endl;
+  os << "MaximumNumberOfPoints: " << this->MaximumNumberOfPoints << std::endl;
 }
@@ -56,6 +56,16 @@ public:
   vtkSetFilePathMacro(FileName);
   vtkGetFilePathMacro(FileName);
 
+  ///@{
+  /**
+   * Upper bound on the number of points produced. When the file holds more
+   * point records than this, the reader keeps every n-th record so the
+   * output stays within the budget. 0 (the default) reads all points.
+   */
+  vtkSetMacro(MaximumNumberOfPoints, vtkIdType);
+  vtkGetMacro(MaximumNumberOfPoints, vtkIdType);
+  ///@}
+
 protected:
   vtkLASReader();
   ~vtkLASReader() override;
@@ -72,6 +82,7 @@ protected:
   void ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData);
 
   char* FileName;
+  vtkIdType MaximumNumberOfPoints;
 };
 
 #endif // vtkLASReader_h
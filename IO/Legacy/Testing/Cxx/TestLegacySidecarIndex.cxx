@@ -0,0 +1,141 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestLegacySidecarIndex.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+// Tests the optional sidecar index used to speed up repeat
+// characterization of legacy .vtk files.
+
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataReader.h"
+#include "vtkPolyDataWriter.h"
+#include "vtkTesting.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+namespace
+{
+
+bool CheckNames(vtkPolyDataReader* reader)
+{
+  if (reader->GetNumberOfScalarsInFile() != 1 ||
+    std::string(reader->GetScalarsNameInFile(0)) != "distance")
+  {
+    std::cerr << "Expected one scalar array named 'distance', found "
+              << reader->GetNumberOfScalarsInFile() << " array(s)." << std::endl;
+    return false;
+  }
+  if (reader->GetNumberOfVectorsInFile() != 1 ||
+    std::string(reader->GetVectorsNameInFile(0)) != "displacement")
+  {
+    std::cerr << "Expected one vector array named 'displacement', found "
+              << reader->GetNumberOfVectorsInFile() << " array(s)." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+int TestLegacySidecarIndex(int argc, char* argv[])
+{
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  std::string fileName = testing->GetTempDirectory();
+  fileName += "/TestLegacySidecarIndex.vtk";
+  std::string indexName = fileName + ".idx";
+  vtksys::SystemTools::RemoveFile(indexName);
+
+  // Write a small data set with named point attributes.
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("distance");
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("displacement");
+  vectors->SetNumberOfComponents(3);
+  for (vtkIdType i = 0; i < 10; ++i)
+  {
+    points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+    scalars->InsertNextValue(static_cast<double>(i));
+    vectors->InsertNextTuple3(0.0, static_cast<double>(i), 0.0);
+  }
+  polyData->SetPoints(points);
+  polyData->GetPointData()->SetScalars(scalars);
+  polyData->GetPointData()->SetVectors(vectors);
+
+  vtkNew<vtkPolyDataWriter> writer;
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputData(polyData);
+  writer->Write();
+
+  // First characterization scans the file and writes the sidecar index.
+  vtkNew<vtkPolyDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UseSidecarIndexOn();
+  if (!CheckNames(reader))
+  {
+    return EXIT_FAILURE;
+  }
+  if (!vtksys::SystemTools::FileExists(indexName, true))
+  {
+    std::cerr << "Sidecar index " << indexName << " was not written." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (reader->GetIndexedOffset("scalars", "distance") < 0 ||
+    reader->GetIndexedOffset("vectors", "displacement") < 0 ||
+    reader->GetIndexedOffset("points", nullptr) < 0)
+  {
+    std::cerr << "Sidecar index is missing expected section offsets." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (reader->GetIndexedOffset("tensors", nullptr) != -1)
+  {
+    std::cerr << "Sidecar index reports an offset for an absent section." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A second reader characterizes from the index without re-scanning.
+  vtkNew<vtkPolyDataReader> reader2;
+  reader2->SetFileName(fileName.c_str());
+  reader2->UseSidecarIndexOn();
+  if (!CheckNames(reader2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Modifying the data file must invalidate the index: the new attribute
+  // name has to show up even though the stale index is still on disk.
+  scalars->SetName("temperature");
+  writer->Write();
+  vtkNew<vtkPolyDataReader> reader3;
+  reader3->SetFileName(fileName.c_str());
+  reader3->UseSidecarIndexOn();
+  if (reader3->GetNumberOfScalarsInFile() != 1 ||
+    std::string(reader3->GetScalarsNameInFile(0)) != "temperature")
+  {
+    std::cerr << "Stale sidecar index was not invalidated after the data file "
+              << "changed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtksys::SystemTools::RemoveFile(indexName);
+  vtksys::SystemTools::RemoveFile(fileName);
+  return EXIT_SUCCESS;
+}
@@ -73,6 +73,21 @@
 // so it would be nice to put this in a common file.
 static int my_getline(istream& in, vtkStdString& output, char delim = '\n');
 
+//------------------------------------------------------------------------------
+// Offsets of the sections found while characterizing a file, optionally
+// persisted in a binary sidecar file next to the data file.
+class vtkDataReader::vtkSidecarIndex
+{
+public:
+  struct Entry
+  {
+    std::string Keyword; // lower case section keyword, e.g. "scalars"
+    std::string Name;    // array name, empty for structural sections
+    vtkTypeInt64 Offset; // byte offset of the keyword line in the data file
+  };
+  std::vector<Entry> Entries;
+};
+
 vtkStandardNewMacro(vtkDataReader);
 
 vtkCxxSetObjectMacro(vtkDataReader, InputArray, vtkCharArray);
@@ -126,6 +141,8 @@ vtkDataReader::vtkDataReader()
   this->ReadAllColorScalars = 0;
   this->ReadAllTCoords = 0;
   this->ReadAllFields = 0;
+  this->UseSidecarIndex = 0;
+  this->SidecarIndex = new vtkSidecarIndex;
   this->FileMajorVersion = 0;
   this->FileMinorVersion = 0;
 
@@ -149,6 +166,7 @@ vtkDataReader::~vtkDataReader()
 
   this->SetInputArray(nullptr);
   this->InitializeCharacteristics();
+  delete this->SidecarIndex;
   delete this->IS;
 }
 
@@ -3526,6 +3544,33 @@ int vtkDataReader::CharacterizeFile()
   this->InitializeCharacteristics();
   this->CharacteristicsTime.Modified();
 
+  const bool useSidecar = (this->UseSidecarIndex != 0) && !this->ReadFromInputString;
+  this->SidecarIndex->Entries.clear();
+
+  // A valid sidecar index makes re-scanning the data file unnecessary: the
+  // attribute names are replayed from the recorded entries.
+  if (useSidecar && this->LoadSidecarIndex())
+  {
+    char line[256];
+    for (const auto& entry : this->SidecarIndex->Entries)
+    {
+      snprintf(line, sizeof(line), "%s %s", entry.Keyword.c_str(), entry.Name.c_str());
+      this->CheckFor("scalars", line, this->NumberOfScalarsInFile, this->ScalarsNameInFile,
+        this->ScalarsNameAllocSize);
+      this->CheckFor("vectors", line, this->NumberOfVectorsInFile, this->VectorsNameInFile,
+        this->VectorsNameAllocSize);
+      this->CheckFor("tensors", line, this->NumberOfTensorsInFile, this->TensorsNameInFile,
+        this->TensorsNameAllocSize);
+      this->CheckFor("normals", line, this->NumberOfNormalsInFile, this->NormalsNameInFile,
+        this->NormalsNameAllocSize);
+      this->CheckFor("tcoords", line, this->NumberOfTCoordsInFile, this->TCoordsNameInFile,
+        this->TCoordsNameAllocSize);
+      this->CheckFor("field", line, this->NumberOfFieldDataInFile, this->FieldDataNameInFile,
+        this->FieldDataNameAllocSize);
+    }
+    return 1;
+  }
+
   // Open the file
   if (!this->OpenVTKFile() || !this->ReadHeader())
   {
@@ -3533,9 +3578,52 @@ int vtkDataReader::CharacterizeFile()
     return 0;
   }
 
+  // Section keywords worth indexing: the named attribute sections plus the
+  // structural sections a reader seeks to.
+  static const char* namedKeywords[] = { "scalars", "vectors", "tensors", "normals", "tcoords",
+    "field", "color_scalars", "lookup_table" };
+  static const char* structuralKeywords[] = { "dataset", "points", "cells", "cell_types",
+    "point_data", "cell_data", "polygons", "lines", "vertices", "triangle_strips" };
+
   char line[256];
-  while (this->ReadLine(line))
+  for (;;)
   {
+    const vtkTypeInt64 lineOffset = static_cast<vtkTypeInt64>(this->IS->tellg());
+    if (!this->ReadLine(line))
+    {
+      break;
+    }
+
+    // CheckFor() lower-cases the line in place, so record the index entry
+    // from a lower-cased copy first.
+    char lowerLine[256];
+    strncpy(lowerLine, line, sizeof(lowerLine) - 1);
+    lowerLine[sizeof(lowerLine) - 1] = '\0';
+    this->LowerCase(lowerLine, sizeof(lowerLine));
+    for (const char* keyword : namedKeywords)
+    {
+      size_t len = strlen(keyword);
+      if (!strncmp(lowerLine, keyword, len) && (lowerLine[len] == ' ' || lowerLine[len] == '\t'))
+      {
+        char nameOfAttribute[256];
+        nameOfAttribute[0] = '\0';
+        sscanf(line, "%*s %255s", nameOfAttribute);
+        this->SidecarIndex->Entries.push_back({ keyword, nameOfAttribute, lineOffset });
+        break;
+      }
+    }
+    for (const char* keyword : structuralKeywords)
+    {
+      size_t len = strlen(keyword);
+      if (!strncmp(lowerLine, keyword, len) &&
+        (lowerLine[len] == ' ' || lowerLine[len] == '\t' || lowerLine[len] == '\0' ||
+          lowerLine[len] == '\r'))
+      {
+        this->SidecarIndex->Entries.push_back({ keyword, "", lineOffset });
+        break;
+      }
+    }
+
     this->CheckFor("scalars", line, this->NumberOfScalarsInFile, this->ScalarsNameInFile,
       this->ScalarsNameAllocSize);
     this->CheckFor("vectors", line, this->NumberOfVectorsInFile, this->VectorsNameInFile,
@@ -3551,9 +3639,146 @@ int vtkDataReader::CharacterizeFile()
   }
 
   this->CloseVTKFile();
+  if (useSidecar)
+  {
+    this->StoreSidecarIndex();
+  }
   return 1;
 }
 
+//------------------------------------------------------------------------------
+std::string vtkDataReader::GetSidecarIndexFileName()
+{
+  const char* fname = this->GetFileName();
+  if (!fname || !fname[0])
+  {
+    return std::string();
+  }
+  return std::string(fname) + ".idx";
+}
+
+//------------------------------------------------------------------------------
+int vtkDataReader::LoadSidecarIndex()
+{
+  const std::string idxName = this->GetSidecarIndexFileName();
+  const char* fname = this->GetFileName();
+  if (idxName.empty() || !vtksys::SystemTools::FileExists(idxName, true))
+  {
+    return 0;
+  }
+
+  vtksys::ifstream idx(idxName.c_str(), ios::in | ios::binary);
+  if (!idx)
+  {
+    return 0;
+  }
+
+  // the index is only trusted when it matches the current data file
+  char magic[8];
+  vtkTypeInt64 fileLength, modifiedTime, numEntries;
+  idx.read(magic, 8);
+  idx.read(reinterpret_cast<char*>(&fileLength), sizeof(fileLength));
+  idx.read(reinterpret_cast<char*>(&modifiedTime), sizeof(modifiedTime));
+  idx.read(reinterpret_cast<char*>(&numEntries), sizeof(numEntries));
+  if (!idx || strncmp(magic, "VTKIDX01", 8) != 0 ||
+    fileLength != static_cast<vtkTypeInt64>(vtksys::SystemTools::FileLength(fname)) ||
+    modifiedTime != static_cast<vtkTypeInt64>(vtksys::SystemTools::ModifiedTime(fname)) ||
+    numEntries < 0)
+  {
+    return 0;
+  }
+
+  std::vector<vtkSidecarIndex::Entry> entries;
+  for (vtkTypeInt64 i = 0; i < numEntries; ++i)
+  {
+    vtkTypeInt64 lengths[2];
+    idx.read(reinterpret_cast<char*>(lengths), sizeof(lengths));
+    if (!idx || lengths[0] < 0 || lengths[0] > 255 || lengths[1] < 0 || lengths[1] > 255)
+    {
+      return 0;
+    }
+    vtkSidecarIndex::Entry entry;
+    entry.Keyword.resize(static_cast<size_t>(lengths[0]));
+    entry.Name.resize(static_cast<size_t>(lengths[1]));
+    idx.read(&entry.Keyword[0], lengths[0]);
+    idx.read(&entry.Name[0], lengths[1]);
+    idx.read(reinterpret_cast<char*>(&entry.Offset), sizeof(entry.Offset));
+    if (!idx)
+    {
+      return 0;
+    }
+    entries.push_back(entry);
+  }
+
+  this->SidecarIndex->Entries.swap(entries);
+  vtkDebugMacro(<< "Loaded sidecar index " << idxName << " with "
+                << this->SidecarIndex->Entries.size() << " entries");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkDataReader::StoreSidecarIndex()
+{
+  const std::string idxName = this->GetSidecarIndexFileName();
+  const char* fname = this->GetFileName();
+  if (idxName.empty())
+  {
+    return;
+  }
+
+  vtksys::ofstream idx(idxName.c_str(), ios::out | ios::binary | ios::trunc);
+  if (!idx)
+  {
+    // a read-only location is not an error; the index is just a cache
+    vtkDebugMacro(<< "Could not write sidecar index " << idxName);
+    return;
+  }
+
+  const vtkTypeInt64 fileLength =
+    static_cast<vtkTypeInt64>(vtksys::SystemTools::FileLength(fname));
+  const vtkTypeInt64 modifiedTime =
+    static_cast<vtkTypeInt64>(vtksys::SystemTools::ModifiedTime(fname));
+  const vtkTypeInt64 numEntries =
+    static_cast<vtkTypeInt64>(this->SidecarIndex->Entries.size());
+
+  idx.write("VTKIDX01", 8);
+  idx.write(reinterpret_cast<const char*>(&fileLength), sizeof(fileLength));
+  idx.write(reinterpret_cast<const char*>(&modifiedTime), sizeof(modifiedTime));
+  idx.write(reinterpret_cast<const char*>(&numEntries), sizeof(numEntries));
+  for (const auto& entry : this->SidecarIndex->Entries)
+  {
+    vtkTypeInt64 lengths[2] = { static_cast<vtkTypeInt64>(entry.Keyword.size()),
+      static_cast<vtkTypeInt64>(entry.Name.size()) };
+    idx.write(reinterpret_cast<const char*>(lengths), sizeof(lengths));
+    idx.write(entry.Keyword.data(), lengths[0]);
+    idx.write(entry.Name.data(), lengths[1]);
+    idx.write(reinterpret_cast<const char*>(&entry.Offset), sizeof(entry.Offset));
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkDataReader::GetIndexedOffset(const char* keyword, const char* name)
+{
+  if (!keyword)
+  {
+    return -1;
+  }
+  this->CharacterizeFile();
+
+  std::string lowerKeyword(keyword);
+  std::transform(lowerKeyword.begin(), lowerKeyword.end(), lowerKeyword.begin(),
+    [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+  for (const auto& entry : this->SidecarIndex->Entries)
+  {
+    if (entry.Keyword == lowerKeyword && (!name || entry.Name == name))
+    {
+      return entry.Offset;
+    }
+  }
+  return -1;
+}
+
 //------------------------------------------------------------------------------
 void vtkDataReader::CheckFor(const char* name, char* line, int& num, char**& array, int& allocSize)
 {
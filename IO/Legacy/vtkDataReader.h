@@ -343,6 +343,34 @@ public:
   vtkBooleanMacro(ReadAllFields, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * When on, maintain a binary sidecar index (<FileName>.idx) recording the
+   * byte offsets of the sections and named attribute arrays in the file.
+   * The index is written the first time the file is characterized and is
+   * validated against the data file's size and modification time on later
+   * reads, so repeatedly interrogating large archival files (for example
+   * with GetScalarsNameInFile()) reads the small index instead of
+   * re-scanning the whole data file. The index is a machine-local cache;
+   * it is ignored and rewritten when it does not match the data file.
+   * Has no effect when reading from the input string. Default is off.
+   */
+  vtkSetMacro(UseSidecarIndex, vtkTypeBool);
+  vtkGetMacro(UseSidecarIndex, vtkTypeBool);
+  vtkBooleanMacro(UseSidecarIndex, vtkTypeBool);
+  ///@}
+
+  /**
+   * Return the byte offset recorded in the sidecar index for the given
+   * section keyword (for example "SCALARS" or "POINT_DATA") and, for
+   * attribute sections, the array name; pass nullptr as the name to match
+   * the first section with the given keyword. The offset locates the start
+   * of the section's keyword line in the data file. Returns -1 when no
+   * such entry exists. This characterizes the file if that has not
+   * happened yet.
+   */
+  vtkTypeInt64 GetIndexedOffset(const char* keyword, const char* name);
+
   /**
    * Open a vtk data file. Returns zero if error.
    */
@@ -597,6 +625,7 @@ protected:
   vtkTypeBool ReadAllColorScalars;
   vtkTypeBool ReadAllTCoords;
   vtkTypeBool ReadAllFields;
+  vtkTypeBool UseSidecarIndex;
 
   std::locale CurrentLocale;
 
@@ -604,6 +633,21 @@ protected:
   int CharacterizeFile(); // read entire file, storing important characteristics
   void CheckFor(const char* name, char* line, int& num, char**& array, int& allocSize);
 
+  ///@{
+  /**
+   * Sidecar index support: load an existing <FileName>.idx that matches the
+   * data file's current size and modification time, or write one from the
+   * section offsets gathered by CharacterizeFile(). LoadSidecarIndex()
+   * returns nonzero when a valid index was read.
+   */
+  int LoadSidecarIndex();
+  void StoreSidecarIndex();
+  std::string GetSidecarIndexFileName();
+  ///@}
+
+  class vtkSidecarIndex;
+  vtkSidecarIndex* SidecarIndex;
+
   vtkCharArray* InputArray;
 
   /**
@@ -868,6 +868,33 @@ int vtkNetCDFReader::LoadVariable(int ncFD, const char* varName, double time, vt
   dataArray->SetNumberOfComponents(1);
   dataArray->SetNumberOfTuples(arraySize);
 
+  // If the variable is stored in netCDF-4 chunks, size its chunk cache to
+  // hold every chunk the requested hyperslab intersects.  With the default
+  // cache, a partial-extent read whose rows cross more chunks than the cache
+  // holds decompresses the same chunks over and over.  Both calls fail
+  // harmlessly on classic-format files, so their status is not checked.
+  int chunkStorage = NC_CONTIGUOUS;
+  size_t chunkSizes[4];
+  if ((nc_inq_var_chunking(ncFD, varId, &chunkStorage, chunkSizes) == NC_NOERR) &&
+    (chunkStorage == NC_CHUNKED))
+  {
+    size_t typeSize;
+    CALL_NETCDF(nc_inq_type(ncFD, ncType, nullptr, &typeSize));
+    size_t chunkBytes = typeSize;
+    size_t numChunks = 1;
+    for (int i = 0; i < numDims + timeIndexOffset; i++)
+    {
+      chunkBytes *= chunkSizes[i];
+      size_t firstChunk = start[i] / chunkSizes[i];
+      size_t lastChunk = (start[i] + count[i] - 1) / chunkSizes[i];
+      numChunks *= lastChunk - firstChunk + 1;
+    }
+    // Cap the cache so a pathological chunking cannot exhaust memory.
+    const size_t maxCacheBytes = 256 * 1024 * 1024;
+    size_t cacheBytes = std::min(numChunks * chunkBytes, maxCacheBytes);
+    nc_set_var_chunk_cache(ncFD, varId, cacheBytes, 4 * numChunks + 1, 0.75f);
+  }
+
   // Read the array from the file.
   CALL_NETCDF(nc_get_vars(ncFD, varId, start, count, nullptr, dataArray->GetVoidPointer(0)));
 
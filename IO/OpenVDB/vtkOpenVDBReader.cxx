@@ -0,0 +1,256 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenVDBReader.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenVDBReader.h"
+
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+#include <openvdb/openvdb.h>
+#include <openvdb/tools/Dense.h>
+
+namespace
+{
+// Fill `array` (already sized for `bbox`) from `grid` by wrapping the
+// array's memory in a dense buffer. copyToDense runs over the leaf blocks
+// in parallel and, with delayed loading, only decodes the blocks that
+// intersect the requested bounding box; everything else in the buffer is
+// set to the grid's background value.
+template <typename GridType, typename ValueType>
+void CopyGridToArray(
+  typename GridType::Ptr grid, const openvdb::CoordBBox& bbox, ValueType* buffer)
+{
+  openvdb::tools::Dense<ValueType, openvdb::tools::LayoutXYZ> dense(bbox, buffer);
+  openvdb::tools::copyToDense(*grid, dense);
+}
+}
+
+vtkStandardNewMacro(vtkOpenVDBReader);
+
+//-----------------------------------------------------------------------------
+vtkOpenVDBReader::vtkOpenVDBReader()
+{
+  // openvdb::initialize() can be called multiple times
+  openvdb::initialize();
+  this->FileName = nullptr;
+  this->SetNumberOfInputPorts(0);
+  this->SetNumberOfOutputPorts(1);
+}
+
+//-----------------------------------------------------------------------------
+vtkOpenVDBReader::~vtkOpenVDBReader()
+{
+  this->SetFileName(nullptr);
+}
+
+//-----------------------------------------------------------------------------
+int vtkOpenVDBReader::CanReadFile(const char* fname)
+{
+  if (!fname || !vtksys::SystemTools::FileExists(fname))
+  {
+    return 0;
+  }
+  try
+  {
+    openvdb::io::File file(fname);
+    file.open();
+    file.close();
+  }
+  catch (const openvdb::Exception&)
+  {
+    return 0;
+  }
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+int vtkOpenVDBReader::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  if (!this->FileName)
+  {
+    vtkErrorMacro("A filename was not specified.");
+    return 0;
+  }
+
+  openvdb::CoordBBox wholeBBox;
+  openvdb::math::Transform::Ptr transform;
+  try
+  {
+    openvdb::io::File file(this->FileName);
+    file.open();
+    for (auto nameIter = file.beginName(); nameIter != file.endName(); ++nameIter)
+    {
+      openvdb::GridBase::Ptr grid = file.readGridMetadata(nameIter.gridName());
+      if (!grid || !grid->transform().isLinear())
+      {
+        continue;
+      }
+      // the bounding box of the voxels written to the file is stored in the
+      // grid metadata, so the trees do not have to be loaded here
+      openvdb::CoordBBox gridBBox;
+      try
+      {
+        gridBBox = grid->getMetadata<openvdb::Vec3IMetadata>("file_bbox_min")
+          ? openvdb::CoordBBox(
+              openvdb::Coord(grid->getMetadata<openvdb::Vec3IMetadata>("file_bbox_min")->value()),
+              openvdb::Coord(grid->getMetadata<openvdb::Vec3IMetadata>("file_bbox_max")->value()))
+          : openvdb::CoordBBox();
+      }
+      catch (const openvdb::Exception&)
+      {
+        gridBBox = openvdb::CoordBBox();
+      }
+      if (gridBBox.empty())
+      {
+        // fall back to reading the grid topology
+        openvdb::GridBase::Ptr fullGrid = file.readGrid(nameIter.gridName());
+        gridBBox = fullGrid->evalActiveVoxelBoundingBox();
+      }
+      if (gridBBox.empty())
+      {
+        continue;
+      }
+      if (!transform)
+      {
+        transform = grid->transform().copy();
+        wholeBBox = gridBBox;
+      }
+      else
+      {
+        wholeBBox.expand(gridBBox);
+      }
+    }
+    file.close();
+  }
+  catch (const openvdb::Exception& e)
+  {
+    vtkErrorMacro("Could not read " << this->FileName << ": " << e.what());
+    return 0;
+  }
+
+  if (!transform)
+  {
+    vtkErrorMacro("No uniform grids found in " << this->FileName);
+    return 0;
+  }
+
+  int wholeExtent[6] = { wholeBBox.min().x(), wholeBBox.max().x(), wholeBBox.min().y(),
+    wholeBBox.max().y(), wholeBBox.min().z(), wholeBBox.max().z() };
+  const openvdb::Vec3d voxelSize = transform->voxelSize();
+  const openvdb::Vec3d origin = transform->indexToWorld(openvdb::Vec3d(0., 0., 0.));
+
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent, 6);
+  double spacing[3] = { voxelSize.x(), voxelSize.y(), voxelSize.z() };
+  double dataOrigin[3] = { origin.x(), origin.y(), origin.z() };
+  outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+  outInfo->Set(vtkDataObject::ORIGIN(), dataOrigin, 3);
+  outInfo->Set(CAN_PRODUCE_SUB_EXTENT(), 1);
+  vtkDataObject::SetPointDataActiveScalarInfo(outInfo, VTK_FLOAT, 1);
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkImageData* output = vtkImageData::GetData(outInfo);
+  if (!output)
+  {
+    vtkErrorMacro("Bad output type.");
+    return 0;
+  }
+
+  int updateExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+  output->SetExtent(updateExtent);
+  output->SetSpacing(outInfo->Get(vtkDataObject::SPACING()));
+  output->SetOrigin(outInfo->Get(vtkDataObject::ORIGIN()));
+
+  const openvdb::CoordBBox bbox(
+    openvdb::Coord(updateExtent[0], updateExtent[2], updateExtent[4]),
+    openvdb::Coord(updateExtent[1], updateExtent[3], updateExtent[5]));
+  const vtkIdType numberOfPoints = output->GetNumberOfPoints();
+
+  try
+  {
+    openvdb::io::File file(this->FileName);
+    // with delayed loading only the leaf blocks that copyToDense touches
+    // are read from the file
+    file.open();
+    for (auto nameIter = file.beginName(); nameIter != file.endName(); ++nameIter)
+    {
+      openvdb::GridBase::Ptr baseGrid = file.readGrid(nameIter.gridName());
+      if (!baseGrid || !baseGrid->transform().isLinear())
+      {
+        continue;
+      }
+      if (openvdb::FloatGrid::Ptr floatGrid = openvdb::gridPtrCast<openvdb::FloatGrid>(baseGrid))
+      {
+        vtkNew<vtkFloatArray> array;
+        array->SetName(nameIter.gridName().c_str());
+        array->SetNumberOfComponents(1);
+        array->SetNumberOfTuples(numberOfPoints);
+        CopyGridToArray<openvdb::FloatGrid>(floatGrid, bbox, array->GetPointer(0));
+        output->GetPointData()->AddArray(array);
+      }
+      else if (openvdb::Vec3SGrid::Ptr vecGrid = openvdb::gridPtrCast<openvdb::Vec3SGrid>(baseGrid))
+      {
+        vtkNew<vtkFloatArray> array;
+        array->SetName(nameIter.gridName().c_str());
+        array->SetNumberOfComponents(3);
+        array->SetNumberOfTuples(numberOfPoints);
+        CopyGridToArray<openvdb::Vec3SGrid>(
+          vecGrid, bbox, reinterpret_cast<openvdb::Vec3f*>(array->GetPointer(0)));
+        output->GetPointData()->AddArray(array);
+      }
+      else
+      {
+        vtkDebugMacro("Skipping grid " << nameIter.gridName() << " of unsupported type "
+                                       << baseGrid->type());
+      }
+    }
+    file.close();
+  }
+  catch (const openvdb::Exception& e)
+  {
+    vtkErrorMacro("Could not read " << this->FileName << ": " << e.what());
+    return 0;
+  }
+
+  if (!output->GetPointData()->GetScalars() && output->GetPointData()->GetNumberOfArrays() > 0)
+  {
+    output->GetPointData()->SetActiveScalars(output->GetPointData()->GetArrayName(0));
+  }
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+void vtkOpenVDBReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "none") << endl;
+}
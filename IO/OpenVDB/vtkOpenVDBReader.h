@@ -0,0 +1,73 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenVDBReader.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenVDBReader
+ * @brief   OpenVDB reader producing vtkImageData
+ *
+ * Reads the uniform float and Vec3f grids of a VDB file into a vtkImageData
+ * with one point data array per grid. The whole extent covers the union of
+ * the grids' active voxel bounding boxes; voxels outside a grid's active
+ * regions receive that grid's background value. The reader produces
+ * sub extents, and only the VDB leaf blocks intersecting the requested
+ * update extent are decoded, so a small region of a large sparse volume can
+ * be read without densifying the whole file.
+ *
+ * @sa
+ * vtkOpenVDBWriter
+ */
+
+#ifndef vtkOpenVDBReader_h
+#define vtkOpenVDBReader_h
+
+#include "vtkIOOpenVDBModule.h" //needed for exports
+#include "vtkImageAlgorithm.h"
+
+class VTKIOOPENVDB_EXPORT vtkOpenVDBReader : public vtkImageAlgorithm
+{
+public:
+  static vtkOpenVDBReader* New();
+  vtkTypeMacro(vtkOpenVDBReader, vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Get/Set the filename for the file.
+   */
+  vtkSetFilePathMacro(FileName);
+  vtkGetFilePathMacro(FileName);
+  //@}
+
+  /**
+   * Returns 1 if the given file can be read by this reader, 0 otherwise.
+   */
+  virtual int CanReadFile(VTK_FILEPATH const char* fname);
+
+protected:
+  vtkOpenVDBReader();
+  ~vtkOpenVDBReader() override;
+
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  char* FileName;
+
+private:
+  vtkOpenVDBReader(const vtkOpenVDBReader&) = delete;
+  void operator=(const vtkOpenVDBReader&) = delete;
+};
+
+#endif
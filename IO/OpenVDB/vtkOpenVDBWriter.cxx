@@ -26,6 +26,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkScalarsToColors.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -42,9 +43,58 @@
 
 #include <openvdb/openvdb.h>
 #include <openvdb/points/PointConversion.h>
+#include <openvdb/tools/Dense.h>
 
 namespace
 {
+void GetDenseValue(vtkDataArray* data, vtkIdType id, int component, float& value)
+{
+  value = data->GetComponent(id, component);
+}
+
+void GetDenseValue(vtkDataArray* data, vtkIdType id, int vtkNotUsed(component), openvdb::Vec3f& value)
+{
+  double tuple[3];
+  data->GetTuple(id, tuple);
+  value = openvdb::Vec3f(tuple[0], tuple[1], tuple[2]);
+}
+
+// Convert one component (or the full 3-vector) of `data` over `ext` into
+// `grid` through a dense buffer. copyFromDense builds the VDB leaf blocks in
+// parallel and marks voxels holding the background value inactive, so
+// constant (e.g. empty) regions stay sparse instead of being set voxel by
+// voxel through an accessor.
+template <typename GridType>
+void ConvertDenseComponent(
+  vtkImageData* imageData, vtkDataArray* data, int component, bool isCellData, const int ext[6],
+  typename GridType::Ptr grid)
+{
+  using ValueType = typename GridType::ValueType;
+  const openvdb::CoordBBox bbox(
+    openvdb::Coord(ext[0], ext[2], ext[4]), openvdb::Coord(ext[1], ext[3], ext[5]));
+  openvdb::tools::Dense<ValueType, openvdb::tools::LayoutXYZ> dense(bbox);
+  const vtkIdType nx = ext[1] - ext[0] + 1;
+  const vtkIdType ny = ext[3] - ext[2] + 1;
+  ValueType* buffer = dense.data();
+  vtkSMPTools::For(ext[4], ext[5] + 1, [&](vtkIdType kBegin, vtkIdType kEnd) {
+    for (vtkIdType k = kBegin; k < kEnd; ++k)
+    {
+      for (vtkIdType j = ext[2]; j <= ext[3]; ++j)
+      {
+        ValueType* row = buffer + nx * ((j - ext[2]) + ny * (k - ext[4]));
+        int vtkijk[3] = { ext[0], static_cast<int>(j), static_cast<int>(k) };
+        // ids are contiguous along a row for both points and cells
+        vtkIdType id =
+          isCellData ? imageData->ComputeCellId(vtkijk) : imageData->ComputePointId(vtkijk);
+        for (vtkIdType i = 0; i < nx; ++i, ++id)
+        {
+          GetDenseValue(data, id, component, row[i]);
+        }
+      }
+    }
+  });
+  openvdb::tools::copyFromDense(dense, *grid, openvdb::zeroVal<ValueType>());
+}
 std::string GetVDBGridName(const char* arrayName, int component, int numberOfComponents)
 {
   std::string vdbName = arrayName;
@@ -631,41 +681,59 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       std::string vdbName = GetVDBGridName(arrayName, component, numberOfComponents);
       grid->setName(vdbName);
       vecGrid->setName(vdbName);
-      openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
-      openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
-      openvdb::Coord ijk;
-
-      int &i = ijk[0], &j = ijk[1], &k = ijk[2];
-      int vtkijk[3];
-      for (k = pointExtent[4]; k <= pointExtent[5]; ++k)
+      if (!pointGhostType)
       {
-        vtkijk[2] = k;
-        for (j = pointExtent[2]; j <= pointExtent[3]; ++j)
+        // no ghost values to mask out, so the whole extent can be handed to
+        // OpenVDB as a dense buffer and converted to leaf blocks in parallel
+        if (numberOfComponents == 3)
         {
-          vtkijk[1] = j;
-          for (i = pointExtent[0]; i <= pointExtent[1]; ++i)
-          {
-            vtkijk[0] = i;
-            vtkIdType pointId = imageData->ComputePointId(vtkijk);
-            if (needToUpdateBounds && pointGhostType && pointGhostType->GetTuple1(pointId) == 0)
-            {
-              double coords[3];
-              imageData->GetPoint(pointId, coords);
-              boundingBox.AddPoint(coords);
-            }
+          ConvertDenseComponent<openvdb::Vec3SGrid>(
+            imageData, data, 0, false, pointExtent, vecGrid);
+        }
+        else
+        {
+          ConvertDenseComponent<openvdb::FloatGrid>(
+            imageData, data, component, false, pointExtent, grid);
+        }
+      }
+      else
+      {
+        openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
+        openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
+        openvdb::Coord ijk;
 
-            if (!pointGhostType || pointGhostType->GetTuple1(pointId) == 0)
+        int &i = ijk[0], &j = ijk[1], &k = ijk[2];
+        int vtkijk[3];
+        for (k = pointExtent[4]; k <= pointExtent[5]; ++k)
+        {
+          vtkijk[2] = k;
+          for (j = pointExtent[2]; j <= pointExtent[3]; ++j)
+          {
+            vtkijk[1] = j;
+            for (i = pointExtent[0]; i <= pointExtent[1]; ++i)
             {
-              if (numberOfComponents == 3)
+              vtkijk[0] = i;
+              vtkIdType pointId = imageData->ComputePointId(vtkijk);
+              if (needToUpdateBounds && pointGhostType->GetTuple1(pointId) == 0)
               {
-                double tuple[3];
-                data->GetTuple(pointId, tuple);
-                openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
-                vecAccessor.setValue(ijk, ftuple);
+                double coords[3];
+                imageData->GetPoint(pointId, coords);
+                boundingBox.AddPoint(coords);
               }
-              else
+
+              if (pointGhostType->GetTuple1(pointId) == 0)
               {
-                accessor.setValue(ijk, data->GetComponent(pointId, component));
+                if (numberOfComponents == 3)
+                {
+                  double tuple[3];
+                  data->GetTuple(pointId, tuple);
+                  openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
+                  vecAccessor.setValue(ijk, ftuple);
+                }
+                else
+                {
+                  accessor.setValue(ijk, data->GetComponent(pointId, component));
+                }
               }
             }
           }
@@ -731,42 +799,62 @@ void vtkOpenVDBWriter::WriteImageData(vtkImageData* imageData)
       std::string vdbName = GetVDBGridName(arrayName, component, numberOfComponents);
       grid->setName(vdbName);
       vecGrid->setName(vdbName);
-      openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
-      openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
-      openvdb::Coord ijk;
-
-      int &i = ijk[0], &j = ijk[1], &k = ijk[2];
-      for (k = extent[4]; k < extent[5]; ++k)
+      int cellExtent[6] = { extent[0], extent[1] - 1, extent[2], extent[3] - 1, extent[4],
+        extent[5] - 1 };
+      if (!cellGhostType && cellExtent[1] >= cellExtent[0] && cellExtent[3] >= cellExtent[2] &&
+        cellExtent[5] >= cellExtent[4])
       {
-        for (j = extent[2]; j < extent[3]; ++j)
+        // no ghost values to mask out, so the whole extent can be handed to
+        // OpenVDB as a dense buffer and converted to leaf blocks in parallel
+        if (numberOfComponents == 3)
+        {
+          ConvertDenseComponent<openvdb::Vec3SGrid>(imageData, data, 0, true, cellExtent, vecGrid);
+        }
+        else
         {
-          for (i = extent[0]; i < extent[1]; ++i)
+          ConvertDenseComponent<openvdb::FloatGrid>(
+            imageData, data, component, true, cellExtent, grid);
+        }
+      }
+      else
+      {
+        openvdb::FloatGrid::Accessor accessor = grid->getAccessor();
+        openvdb::Vec3SGrid::Accessor vecAccessor = vecGrid->getAccessor();
+        openvdb::Coord ijk;
+
+        int &i = ijk[0], &j = ijk[1], &k = ijk[2];
+        for (k = extent[4]; k < extent[5]; ++k)
+        {
+          for (j = extent[2]; j < extent[3]; ++j)
           {
-            int vtkijk[3] = { i, j, k };
-            vtkIdType cellId = imageData->ComputeCellId(vtkijk);
-            if (needToUpdateBounds && cellGhostType && cellGhostType->GetTuple1(cellId) == 0)
-            {
-              double coords[3];
-              vtkIdType pointId = imageData->ComputePointId(vtkijk);
-              imageData->GetPoint(pointId, coords);
-              for (int c = 0; c < 3; c++)
-              {
-                coords[c] += halfCellSize[c];
-              }
-              bounds.AddPoint(coords);
-            }
-            if (!cellGhostType || cellGhostType->GetTuple1(cellId) == 0)
+            for (i = extent[0]; i < extent[1]; ++i)
             {
-              if (numberOfComponents == 3)
+              int vtkijk[3] = { i, j, k };
+              vtkIdType cellId = imageData->ComputeCellId(vtkijk);
+              if (needToUpdateBounds && cellGhostType && cellGhostType->GetTuple1(cellId) == 0)
               {
-                double tuple[3];
-                data->GetTuple(cellId, tuple);
-                openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
-                vecAccessor.setValue(ijk, ftuple);
+                double coords[3];
+                vtkIdType pointId = imageData->ComputePointId(vtkijk);
+                imageData->GetPoint(pointId, coords);
+                for (int c = 0; c < 3; c++)
+                {
+                  coords[c] += halfCellSize[c];
+                }
+                bounds.AddPoint(coords);
               }
-              else
+              if (!cellGhostType || cellGhostType->GetTuple1(cellId) == 0)
               {
-                accessor.setValue(ijk, data->GetComponent(cellId, component));
+                if (numberOfComponents == 3)
+                {
+                  double tuple[3];
+                  data->GetTuple(cellId, tuple);
+                  openvdb::Vec3f ftuple(tuple[0], tuple[1], tuple[2]);
+                  vecAccessor.setValue(ijk, ftuple);
+                }
+                else
+                {
+                  accessor.setValue(ijk, data->GetComponent(cellId, component));
+                }
               }
             }
           }
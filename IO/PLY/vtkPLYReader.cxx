@@ -25,10 +25,12 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPLY.h"
+#include "vtkEndian.h" // for VTK_WORDS_BIGENDIAN
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkUnsignedCharArray.h"
@@ -38,6 +40,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstddef>
+#include <cstring>
 #include <vector>
 
 vtkStandardNewMacro(vtkPLYReader);
@@ -132,6 +135,143 @@ typedef struct _plyFace
   unsigned char ntexcoord; // number of texcoord in list
   float* texcoord;         // texcoord list
 } plyFace;
+
+// Byte size of a PLY scalar type as stored in the file, 0 for list or
+// unknown types.
+int plyScalarTypeSize(int type)
+{
+  switch (type)
+  {
+    case PLY_CHAR:
+    case PLY_INT8:
+    case PLY_UCHAR:
+    case PLY_UINT8:
+      return 1;
+    case PLY_SHORT:
+    case PLY_INT16:
+    case PLY_USHORT:
+    case PLY_UINT16:
+      return 2;
+    case PLY_INT:
+    case PLY_INT32:
+    case PLY_UINT:
+    case PLY_UINT32:
+    case PLY_FLOAT:
+    case PLY_FLOAT32:
+      return 4;
+    case PLY_DOUBLE:
+    case PLY_FLOAT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+// Describes where the properties the reader consumes live inside a
+// fixed-size binary vertex record. Offsets index into vertProps order
+// (x y z u v nx ny nz red green blue alpha); -1 marks a property that is
+// not present in the file.
+struct plyVertexLayout
+{
+  size_t RecordSize;
+  ptrdiff_t Offsets[12];
+};
+
+// Compute the fixed record layout of the vertex element. Returns false when
+// the element contains list properties (variable size records) or when a
+// consumed property is stored with an unexpected type; in those cases the
+// callback based path must be used.
+bool plyComputeVertexLayout(
+  PlyElement* elem, const PlyProperty vertProps[12], plyVertexLayout& layout)
+{
+  layout.RecordSize = 0;
+  for (int w = 0; w < 12; ++w)
+  {
+    layout.Offsets[w] = -1;
+  }
+  for (int p = 0; p < elem->nprops; ++p)
+  {
+    PlyProperty* prop = elem->props[p];
+    int size = plyScalarTypeSize(prop->external_type);
+    if (prop->is_list || size == 0)
+    {
+      return false;
+    }
+    for (int w = 0; w < 12; ++w)
+    {
+      if (strcmp(prop->name, vertProps[w].name) == 0)
+      {
+        bool isFloat = prop->external_type == PLY_FLOAT || prop->external_type == PLY_FLOAT32;
+        bool isUChar = prop->external_type == PLY_UCHAR || prop->external_type == PLY_UINT8;
+        if ((w < 8 && !isFloat) || (w >= 8 && !isUChar))
+        {
+          return false;
+        }
+        layout.Offsets[w] = static_cast<ptrdiff_t>(layout.RecordSize);
+        break;
+      }
+    }
+    layout.RecordSize += size;
+  }
+  return layout.Offsets[0] >= 0 && layout.Offsets[1] >= 0 && layout.Offsets[2] >= 0;
+}
+
+// Read the vertex block of a binary little endian PLY file in large chunks
+// and de-interleave the fixed size records into the output arrays in
+// parallel. This bypasses the per-property callbacks of the PLY library,
+// which dominate the time needed to open large scan meshes. Returns false
+// when the file ends prematurely.
+bool plyReadVertexBlockLE(std::istream* is, const plyVertexLayout& layout, vtkIdType numPts,
+  float* pts, float* tex, float* nrml, unsigned char* rgb, int rgbComps)
+{
+  const vtkIdType chunkSize = 1 << 20; // records per chunk, keeps memory bounded
+  std::vector<char> buffer(static_cast<size_t>(std::min(chunkSize, numPts)) * layout.RecordSize);
+
+  for (vtkIdType start = 0; start < numPts; start += chunkSize)
+  {
+    vtkIdType n = std::min(chunkSize, numPts - start);
+    std::streamsize bytes = static_cast<std::streamsize>(n * layout.RecordSize);
+    is->read(buffer.data(), bytes);
+    if (is->gcount() != bytes)
+    {
+      return false;
+    }
+
+    const char* records = buffer.data();
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const char* rec = records + static_cast<size_t>(i) * layout.RecordSize;
+        vtkIdType id = start + i;
+        memcpy(&pts[3 * id], rec + layout.Offsets[0], sizeof(float));
+        memcpy(&pts[3 * id + 1], rec + layout.Offsets[1], sizeof(float));
+        memcpy(&pts[3 * id + 2], rec + layout.Offsets[2], sizeof(float));
+        if (tex)
+        {
+          memcpy(&tex[2 * id], rec + layout.Offsets[3], sizeof(float));
+          memcpy(&tex[2 * id + 1], rec + layout.Offsets[4], sizeof(float));
+        }
+        if (nrml)
+        {
+          memcpy(&nrml[3 * id], rec + layout.Offsets[5], sizeof(float));
+          memcpy(&nrml[3 * id + 1], rec + layout.Offsets[6], sizeof(float));
+          memcpy(&nrml[3 * id + 2], rec + layout.Offsets[7], sizeof(float));
+        }
+        if (rgb)
+        {
+          rgb[rgbComps * id] = static_cast<unsigned char>(rec[layout.Offsets[8]]);
+          rgb[rgbComps * id + 1] = static_cast<unsigned char>(rec[layout.Offsets[9]]);
+          rgb[rgbComps * id + 2] = static_cast<unsigned char>(rec[layout.Offsets[10]]);
+          if (rgbComps == 4)
+          {
+            rgb[rgbComps * id + 3] = static_cast<unsigned char>(rec[layout.Offsets[11]]);
+          }
+        }
+      }
+    });
+  }
+  return true;
+}
 }
 
 int vtkPLYReader::RequestData(vtkInformation* vtkNotUsed(request),
@@ -363,6 +503,52 @@ int vtkPLYReader::RequestData(vtkInformation* vtkNotUsed(request),
       pts->SetDataTypeToFloat();
       pts->SetNumberOfPoints(numPts);
 
+      bool bulkRead = false;
+#ifndef VTK_WORDS_BIGENDIAN
+      // Fast path: little endian binary files with fixed size vertex records
+      // can be read in bulk and de-interleaved in parallel instead of going
+      // through the per-property callbacks of the PLY library.
+      plyVertexLayout layout;
+      if (ply->file_type == PLY_BINARY_LE &&
+        (elem = vtkPLY::find_element(ply, "vertex")) != nullptr &&
+        plyComputeVertexLayout(elem, vertProps, layout))
+      {
+        if (texCoordsPointsAvailable)
+        {
+          texCoordsPoints->SetNumberOfTuples(numPts);
+        }
+        if (normalPointsAvailable)
+        {
+          normals->SetNumberOfTuples(numPts);
+        }
+        if (rgbPointsAvailable)
+        {
+          rgbPoints->SetNumberOfTuples(numPts);
+        }
+        if (!plyReadVertexBlockLE(ply->is, layout, numPts,
+              static_cast<float*>(pts->GetVoidPointer(0)),
+              texCoordsPointsAvailable ? texCoordsPoints->GetPointer(0) : nullptr,
+              normalPointsAvailable ? normals->GetPointer(0) : nullptr,
+              rgbPointsAvailable ? rgbPoints->GetPointer(0) : nullptr,
+              rgbPointsHaveAlpha ? 4 : 3))
+        {
+          vtkErrorMacro(<< "Premature EOF while reading vertices");
+          pts->Delete();
+          vtkPLY::ply_close(ply);
+          return 0;
+        }
+        bulkRead = true;
+      }
+#endif
+      if (bulkRead)
+      {
+        output->SetPoints(pts);
+        pts->Delete();
+        free(elist[i]);
+        elist[i] = nullptr;
+        continue;
+      }
+
       // Setup to read the PLY elements
       vtkPLY::ply_get_property(ply, elemName, &vertProps[0]);
       vtkPLY::ply_get_property(ply, elemName, &vertProps[1]);
@@ -58,6 +58,17 @@ public:
   vtkGetObjectMacro(Query, vtkRowQuery);
   ///@}
 
+  ///@{
+  /**
+   * The maximum number of rows to fetch into the output table. Fetching
+   * stops once the limit is reached, which is useful when the query text
+   * itself cannot be amended with a LIMIT clause. The default of 0 fetches
+   * every row of the result set.
+   */
+  vtkSetMacro(MaxNumberOfRows, vtkIdType);
+  vtkGetMacro(MaxNumberOfRows, vtkIdType);
+  ///@}
+
   /**
    * Update the modified time based on the query.
    */
@@ -69,6 +80,8 @@ protected:
 
   vtkRowQuery* Query;
 
+  vtkIdType MaxNumberOfRows;
+
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
 private:
@@ -45,14 +45,20 @@ short vtkSegYIOUtils::readShortInteger(std::istream& in)
 {
   char buffer[2];
   in.read(buffer, sizeof(buffer));
+  return this->readShortInteger(buffer);
+}
 
+//------------------------------------------------------------------------------
+short vtkSegYIOUtils::readShortInteger(const char* buffer)
+{
+  char bytes[2] = { buffer[0], buffer[1] };
   if (!this->IsBigEndian)
   {
-    swap(buffer, buffer + 1);
+    swap(bytes, bytes + 1);
   }
 
   short num;
-  memcpy(&num, buffer, 2);
+  memcpy(&num, bytes, 2);
   return num;
 }
 
@@ -68,15 +74,21 @@ int vtkSegYIOUtils::readLongInteger(std::istream& in)
 {
   char buffer[4];
   in.read(buffer, sizeof(buffer));
+  return this->readLongInteger(buffer);
+}
 
+//------------------------------------------------------------------------------
+int vtkSegYIOUtils::readLongInteger(const char* buffer)
+{
+  char bytes[4] = { buffer[0], buffer[1], buffer[2], buffer[3] };
   if (!this->IsBigEndian)
   {
-    swap(buffer, buffer + 3);
-    swap(buffer + 1, buffer + 2);
+    swap(bytes, bytes + 3);
+    swap(bytes + 1, bytes + 2);
   }
 
   int num;
-  memcpy(&num, buffer, 4);
+  memcpy(&num, bytes, 4);
   return num;
 }
 
@@ -85,15 +97,21 @@ float vtkSegYIOUtils::readFloat(std::istream& in)
 {
   char buffer[4];
   in.read(buffer, sizeof(buffer));
+  return this->readFloat(buffer);
+}
 
+//------------------------------------------------------------------------------
+float vtkSegYIOUtils::readFloat(const char* buffer)
+{
+  char bytes[4] = { buffer[0], buffer[1], buffer[2], buffer[3] };
   if (!this->IsBigEndian)
   {
-    swap(buffer, buffer + 3);
-    swap(buffer + 1, buffer + 2);
+    swap(bytes, bytes + 3);
+    swap(bytes + 1, bytes + 2);
   }
 
   float num;
-  memcpy(&num, buffer, 4);
+  memcpy(&num, bytes, 4);
   return num;
 }
 
@@ -102,13 +120,12 @@ float vtkSegYIOUtils::readIBMFloat(std::istream& in)
 {
   char buffer[4];
   in.read(buffer, sizeof(buffer));
+  return this->readIBMFloat(buffer);
+}
 
-  if (!this->IsBigEndian)
-  {
-    swap(buffer, buffer + 3);
-    swap(buffer + 1, buffer + 2);
-  }
-
+//------------------------------------------------------------------------------
+float vtkSegYIOUtils::readIBMFloat(const char* buffer)
+{
   // The IBM Hex single precision floating point representation:
   //
   //  1      7                           24                    (width in bits)
@@ -127,17 +144,25 @@ float vtkSegYIOUtils::readIBMFloat(std::istream& in)
   // More details at
   // https://en.m.wikipedia.org/wiki/IBM_Floating_Point_Architecture
 
-  uint32_t* longbuffer = reinterpret_cast<uint32_t*>(buffer);
-  int sign = longbuffer[0] >> 31 & 0x01;
-  int exponent = longbuffer[0] >> 24 & 0x7F;
-  float fraction = (longbuffer[0] & 0x00ffffff) / powf(2.0f, 24.0f);
-  if (fraction == 0.0f)
+  uint32_t raw;
+  memcpy(&raw, buffer, 4);
+  if (!this->IsBigEndian)
+  {
+    raw = (raw >> 24) | ((raw >> 8) & 0x0000ff00) | ((raw << 8) & 0x00ff0000) | (raw << 24);
+  }
+
+  int sign = raw >> 31 & 0x01;
+  int exponent = raw >> 24 & 0x7F;
+  uint32_t fraction = raw & 0x00ffffff;
+  if (fraction == 0)
   {
     // Value is 0
     return 0.0f;
   }
-  float num = (1 - 2 * sign) * fraction * powf(16.0f, exponent - 64.0f);
-  return num;
+  // (0.F)(16^(E - 64)) rewritten as F 2^(4E - 280) so the scaling is a
+  // single exponent adjustment instead of two powf calls per sample
+  float num = std::ldexp(static_cast<float>(fraction), 4 * exponent - 280);
+  return sign ? -num : num;
 }
 
 //------------------------------------------------------------------------------
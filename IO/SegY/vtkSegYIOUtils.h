@@ -24,10 +24,14 @@ public:
   char readChar(std::istream& in);
   short readShortInteger(std::streamoff pos, std::istream& in);
   short readShortInteger(std::istream& in);
+  short readShortInteger(const char* buffer);
   int readLongInteger(std::streamoff pos, std::istream& in);
   int readLongInteger(std::istream& in);
+  int readLongInteger(const char* buffer);
   float readFloat(std::istream& in);
+  float readFloat(const char* buffer);
   float readIBMFloat(std::istream& in);
+  float readIBMFloat(const char* buffer);
   unsigned char readUChar(std::istream& in);
   void swap(char* a, char* b);
   static vtkSegYIOUtils* Instance();
@@ -124,16 +124,43 @@ int vtkSegYReader::RequestData(vtkInformation* vtkNotUsed(request),
       return 1;
     }
   }
-  this->Reader->LoadTraces(this->DataExtent);
-  this->UpdateProgress(0.5);
   if (this->Is3D && !this->StructuredGrid)
   {
     vtkImageData* imageData = vtkImageData::SafeDownCast(output);
-    this->Reader->ExportData(
-      imageData, this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign);
+
+    // map the requested sub-extent to the trace/sample window it comes
+    // from; axes with a negative spacing sign read from the mirrored end
+    // of the survey
+    int updateExtent[6];
+    int loadExtent[6];
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      updateExtent[2 * axis] = std::max(updateExtent[2 * axis], this->DataExtent[2 * axis]);
+      updateExtent[2 * axis + 1] =
+        std::min(updateExtent[2 * axis + 1], this->DataExtent[2 * axis + 1]);
+      if (this->DataSpacingSign[axis] > 0)
+      {
+        loadExtent[2 * axis] = updateExtent[2 * axis];
+        loadExtent[2 * axis + 1] = updateExtent[2 * axis + 1];
+      }
+      else
+      {
+        loadExtent[2 * axis] =
+          this->DataExtent[2 * axis] + this->DataExtent[2 * axis + 1] - updateExtent[2 * axis + 1];
+        loadExtent[2 * axis + 1] =
+          this->DataExtent[2 * axis] + this->DataExtent[2 * axis + 1] - updateExtent[2 * axis];
+      }
+    }
+    this->Reader->LoadTraces(loadExtent, true);
+    this->UpdateProgress(0.5);
+    this->Reader->ExportData(imageData, updateExtent, loadExtent, this->DataOrigin,
+      this->DataSpacing, this->DataSpacingSign);
   }
   else
   {
+    this->Reader->LoadTraces(this->DataExtent, this->Is3D);
+    this->UpdateProgress(0.5);
     vtkStructuredGrid* grid = vtkStructuredGrid::SafeDownCast(output);
     this->Reader->ExportData(grid, this->DataExtent, this->DataOrigin, this->DataSpacing);
     grid->Squeeze();
@@ -160,6 +187,8 @@ int vtkSegYReader::RequestInformation(vtkInformation* vtkNotUsed(request),
       vtkMath::Norm(this->DataSpacing[2]) };
     outInfo->Set(vtkDataObject::ORIGIN(), this->DataOrigin, 3);
     outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+    // cropped inline/crossline/depth requests only load the matching traces
+    outInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
   }
   return 1;
 }
@@ -77,19 +77,39 @@ void vtkSegYReaderInternal::SetVerticalCRS(int v)
 }
 
 //------------------------------------------------------------------------------
-void vtkSegYReaderInternal::LoadTraces(int* extent)
+void vtkSegYReaderInternal::LoadTraces(int* extent, bool is3d)
 {
   std::streamoff traceStartPos = FIRST_TRACE_START_POS;
   std::streamoff fileSize = vtkSegYIOUtils::Instance()->getFileSize(this->In);
 
-  // allocate traces vector
+  // allocate traces vector, releasing whatever a previous update loaded
   int dims[3] = { extent[1] - extent[0] + 1, extent[3] - extent[2] + 1, extent[5] - extent[4] + 1 };
 
-  bool is3d = extent[3] - extent[2] > 1;
+  for (auto trace : this->Traces)
+  {
+    delete trace;
+  }
+  this->Traces.clear();
   this->Traces.resize(dims[0] * dims[1], nullptr);
   size_t traceCount = 0;
   while (traceStartPos + 240 < fileSize)
   {
+    if (is3d)
+    {
+      // peek at the trace header first so traces outside of the requested
+      // extent are skipped without decoding their samples
+      std::streamoff nextTraceStartPos = traceStartPos;
+      int inlineNumber, crosslineNumber, xCoord, yCoord;
+      short coordMultiplier;
+      this->TraceReader->ReadInlineCrossline(nextTraceStartPos, this->In, this->FormatCode,
+        &inlineNumber, &crosslineNumber, &xCoord, &yCoord, &coordMultiplier);
+      if (crosslineNumber < extent[0] || crosslineNumber > extent[1] ||
+        inlineNumber < extent[2] || inlineNumber > extent[3])
+      {
+        traceStartPos = nextTraceStartPos;
+        continue;
+      }
+    }
     vtkSegYTrace* pTrace = new vtkSegYTrace();
     this->TraceReader->ReadTrace(traceStartPos, this->In, this->FormatCode, pTrace);
     size_t loc = traceCount;
@@ -295,8 +315,8 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
 }
 
 //------------------------------------------------------------------------------
-void vtkSegYReaderInternal::ExportData(
-  vtkImageData* imageData, int* extent, double origin[3], double spacing[3][3], int* spacingSign)
+void vtkSegYReaderInternal::ExportData(vtkImageData* imageData, int* extent, int* loadedExtent,
+  double origin[3], double spacing[3][3], int* spacingSign)
 {
   imageData->SetExtent(extent);
   imageData->SetOrigin(origin);
@@ -321,7 +341,7 @@ void vtkSegYReaderInternal::ExportData(
       {
         destI = (spacingSign[0] > 0 ? i : dims[0] - i - 1);
         vtkSegYTrace* trace = this->Traces[destJ * dims[0] + destI];
-        scalars->SetValue(id++, trace ? trace->Data[destK] : 0.0);
+        scalars->SetValue(id++, trace ? trace->Data[loadedExtent[4] + destK] : 0.0);
       }
     }
   }
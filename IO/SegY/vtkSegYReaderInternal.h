@@ -39,10 +39,15 @@ public:
 public:
   bool Is3DComputeParameters(
     int* extent, double origin[3], double spacing[3][3], int* spacingSign, bool force2D);
-  void LoadTraces(int* extent);
+  // Load the traces whose crossline/inline numbers fall inside extent,
+  // skipping over the sample blocks of traces outside of it.
+  void LoadTraces(int* extent, bool is3d);
 
-  void ExportData(
-    vtkImageData*, int* extent, double origin[3], double spacing[3][3], int* spacingSign);
+  // extent is the image extent produced, loadedExtent the trace/sample
+  // window passed to LoadTraces; they have the same dimensions but are
+  // mirrored relative to each other along axes with negative spacing sign.
+  void ExportData(vtkImageData*, int* extent, int* loadedExtent, double origin[3],
+    double spacing[3][3], int* spacingSign);
   void ExportData(vtkStructuredGrid*, int* extent, double origin[3], double spacing[3][3]);
 
   void SetXYCoordBytePositions(int x, int y);
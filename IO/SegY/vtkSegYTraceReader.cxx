@@ -83,56 +83,69 @@ void vtkSegYTraceReader::PrintTraceHeader(std::istream& in, int startPos)
 void vtkSegYTraceReader::ReadTrace(
   std::streamoff& startPos, std::istream& in, int formatCode, vtkSegYTrace* trace)
 {
-  trace->InlineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.InlineNumber, in);
+  vtkSegYIOUtils* ioUtil = vtkSegYIOUtils::Instance();
+
+  // read the 240 byte trace header with one call and decode it in memory
+  char traceHeader[240];
+  in.seekg(startPos, std::istream::beg);
+  in.read(traceHeader, sizeof(traceHeader));
+
+  trace->InlineNumber = ioUtil->readLongInteger(traceHeader + traceHeaderBytesPos.InlineNumber);
   trace->CrosslineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.CrosslineNumber, in);
-  int numSamples =
-    vtkSegYIOUtils::Instance()->readShortInteger(startPos + traceHeaderBytesPos.NumberSamples, in);
-  trace->CoordinateMultiplier = vtkSegYIOUtils::Instance()->readShortInteger(
-    startPos + traceHeaderBytesPos.CoordinateMultiplier, in);
-  trace->XCoordinate =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->XCoordinate, in);
-  trace->YCoordinate =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->YCoordinate, in);
+    ioUtil->readLongInteger(traceHeader + traceHeaderBytesPos.CrosslineNumber);
+  int numSamples = ioUtil->readShortInteger(traceHeader + traceHeaderBytesPos.NumberSamples);
+  trace->CoordinateMultiplier =
+    ioUtil->readShortInteger(traceHeader + traceHeaderBytesPos.CoordinateMultiplier);
+  trace->XCoordinate = ioUtil->readLongInteger(traceHeader + this->XCoordinate);
+  trace->YCoordinate = ioUtil->readLongInteger(traceHeader + this->YCoordinate);
   trace->SampleInterval =
-    vtkSegYIOUtils::Instance()->readShortInteger(startPos + traceHeaderBytesPos.SampleInterval, in);
+    ioUtil->readShortInteger(traceHeader + traceHeaderBytesPos.SampleInterval);
 
-  in.seekg(startPos + 240, std::istream::beg);
-  float value;
   switch (formatCode)
   {
     case 1:
-      for (int i = 0; i < numSamples; i++)
+    case 3:
+    case 5:
+    case 8:
+    {
+      // read the whole sample block at once and convert in memory instead of
+      // issuing one stream read per sample
+      this->SampleBuffer.resize(this->GetTraceSize(numSamples, formatCode));
+      in.read(this->SampleBuffer.data(), static_cast<std::streamsize>(this->SampleBuffer.size()));
+      const char* samples = this->SampleBuffer.data();
+      trace->Data.resize(numSamples);
+      if (formatCode == 1)
       {
-        value = vtkSegYIOUtils::Instance()->readIBMFloat(in);
-        trace->Data.push_back(value);
+        for (int i = 0; i < numSamples; i++)
+        {
+          trace->Data[i] = ioUtil->readIBMFloat(samples + 4 * i);
+        }
       }
-      break;
-    case 3:
-      for (int i = 0; i < numSamples; i++)
+      else if (formatCode == 3)
       {
-        value = vtkSegYIOUtils::Instance()->readShortInteger(in);
-        trace->Data.push_back(value);
+        for (int i = 0; i < numSamples; i++)
+        {
+          trace->Data[i] = ioUtil->readShortInteger(samples + 2 * i);
+        }
       }
-      break;
-    case 5:
-      for (int i = 0; i < numSamples; i++)
+      else if (formatCode == 5)
       {
-        value = vtkSegYIOUtils::Instance()->readFloat(in);
-        trace->Data.push_back(value);
+        for (int i = 0; i < numSamples; i++)
+        {
+          trace->Data[i] = ioUtil->readFloat(samples + 4 * i);
+        }
       }
-      break;
-    case 8:
-      for (int i = 0; i < numSamples; i++)
+      else // formatCode == 8
       {
-        value = vtkSegYIOUtils::Instance()->readChar(in);
-        trace->Data.push_back(value);
+        for (int i = 0; i < numSamples; i++)
+        {
+          trace->Data[i] = samples[i];
+        }
       }
       break;
+    }
     default:
       std::cerr << "Data sample format code " << formatCode << " not supported." << std::endl;
-      value = 0;
   }
 
   startPos += 240 + this->GetTraceSize(numSamples, formatCode);
@@ -143,17 +156,19 @@ void vtkSegYTraceReader::ReadInlineCrossline(std::streamoff& startPos, std::istr
   int formatCode, int* inlineNumber, int* crosslineNumber, int* xCoord, int* yCoord,
   short* coordMultiplier)
 {
-  *inlineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.InlineNumber, in);
-  *crosslineNumber =
-    vtkSegYIOUtils::Instance()->readLongInteger(startPos + traceHeaderBytesPos.CrosslineNumber, in);
-  int numSamples =
-    vtkSegYIOUtils::Instance()->readShortInteger(startPos + traceHeaderBytesPos.NumberSamples, in);
+  vtkSegYIOUtils* ioUtil = vtkSegYIOUtils::Instance();
 
-  *xCoord = vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->XCoordinate, in);
-  *yCoord = vtkSegYIOUtils::Instance()->readLongInteger(startPos + this->YCoordinate, in);
-  *coordMultiplier = vtkSegYIOUtils::Instance()->readShortInteger(
-    startPos + traceHeaderBytesPos.CoordinateMultiplier, in);
+  char traceHeader[240];
+  in.seekg(startPos, std::istream::beg);
+  in.read(traceHeader, sizeof(traceHeader));
+
+  *inlineNumber = ioUtil->readLongInteger(traceHeader + traceHeaderBytesPos.InlineNumber);
+  *crosslineNumber = ioUtil->readLongInteger(traceHeader + traceHeaderBytesPos.CrosslineNumber);
+  int numSamples = ioUtil->readShortInteger(traceHeader + traceHeaderBytesPos.NumberSamples);
+
+  *xCoord = ioUtil->readLongInteger(traceHeader + this->XCoordinate);
+  *yCoord = ioUtil->readLongInteger(traceHeader + this->YCoordinate);
+  *coordMultiplier = ioUtil->readShortInteger(traceHeader + traceHeaderBytesPos.CoordinateMultiplier);
   startPos += 240 + this->GetTraceSize(numSamples, formatCode);
 }
 
@@ -47,6 +47,9 @@ private:
   int XCoordinate;
   int YCoordinate;
 
+  // scratch space for reading a whole sample block in one call
+  std::vector<char> SampleBuffer;
+
 public:
   vtkSegYTraceReader();
 
@@ -0,0 +1,66 @@
+#include <vtkCompositeDataSet.h>
+#include <vtkDataArraySelection.h>
+#include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkSphereSource.h>
+#include <vtkTesting.h>
+#include <vtkXMLMultiBlockDataReader.h>
+#include <vtkXMLMultiBlockDataWriter.h>
+
+int TestXMLMultiBlockDataReaderBlockSelection(int argc, char* argv[])
+{
+  vtkNew<vtkSphereSource> sp;
+  sp->Update();
+
+  vtkNew<vtkMultiBlockDataSet> outMB;
+  outMB->SetBlock(0, sp->GetOutput());
+  outMB->GetMetaData(0u)->Set(vtkCompositeDataSet::NAME(), "Left");
+  outMB->SetBlock(1, sp->GetOutput());
+  outMB->GetMetaData(1u)->Set(vtkCompositeDataSet::NAME(), "Right");
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+
+  std::ostringstream filename_stream;
+  filename_stream << testing->GetTempDirectory() << "/TestXMLMultiBlockDataReaderBlockSelection.vtm";
+
+  vtkNew<vtkXMLMultiBlockDataWriter> writer;
+  writer->SetFileName(filename_stream.str().c_str());
+  writer->SetInputDataObject(outMB);
+  writer->Write();
+
+  vtkNew<vtkXMLMultiBlockDataReader> reader;
+  reader->SetFileName(filename_stream.str().c_str());
+  reader->UpdateInformation();
+
+  vtkDataArraySelection* selection = reader->GetBlockSelection();
+  if (!selection->ArrayExists("Left") || !selection->ArrayExists("Right"))
+  {
+    cerr << "ERROR: block selection was not populated from the file!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  selection->DisableArray("Right");
+  reader->Update();
+
+  auto inMB = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutputDataObject(0));
+  if (inMB->GetNumberOfBlocks() != 2 || vtkPolyData::SafeDownCast(inMB->GetBlock(0)) == nullptr ||
+    inMB->GetBlock(1) != nullptr)
+  {
+    cerr << "ERROR: disabled block was not skipped!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  selection->EnableArray("Right");
+  reader->Update();
+
+  inMB = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutputDataObject(0));
+  if (vtkPolyData::SafeDownCast(inMB->GetBlock(1)) == nullptr)
+  {
+    cerr << "ERROR: re-enabled block was not read!" << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkXMLMultiBlockDataReader.h"
 
+#include "vtkCallbackCommand.h"
 #include "vtkCompositeDataPipeline.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataArraySelection.h"
@@ -26,17 +27,59 @@
 #include "vtkSmartPointer.h"
 #include "vtkXMLDataElement.h"
 
+#include <sstream>
+
 vtkStandardNewMacro(vtkXMLMultiBlockDataReader);
 //------------------------------------------------------------------------------
-vtkXMLMultiBlockDataReader::vtkXMLMultiBlockDataReader() = default;
+vtkXMLMultiBlockDataReader::vtkXMLMultiBlockDataReader()
+{
+  this->BlockSelection->AddObserver(vtkCommand::ModifiedEvent, this->SelectionObserver);
+}
 
 //------------------------------------------------------------------------------
-vtkXMLMultiBlockDataReader::~vtkXMLMultiBlockDataReader() = default;
+vtkXMLMultiBlockDataReader::~vtkXMLMultiBlockDataReader()
+{
+  this->BlockSelection->RemoveObserver(this->SelectionObserver);
+}
 
 //------------------------------------------------------------------------------
 void vtkXMLMultiBlockDataReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "BlockSelection:\n";
+  this->BlockSelection->PrintSelf(os, indent.GetNextIndent());
+}
+
+//------------------------------------------------------------------------------
+vtkDataArraySelection* vtkXMLMultiBlockDataReader::GetBlockSelection()
+{
+  return this->BlockSelection;
+}
+
+//------------------------------------------------------------------------------
+std::string vtkXMLMultiBlockDataReader::GetBlockName(
+  vtkXMLDataElement* childXML, unsigned int dataSetIndex)
+{
+  const char* name = childXML ? childXML->GetAttribute("name") : nullptr;
+  if (name && name[0] != '\0')
+  {
+    return name;
+  }
+  std::ostringstream str;
+  str << "Block " << dataSetIndex;
+  return str.str();
+}
+
+//------------------------------------------------------------------------------
+bool vtkXMLMultiBlockDataReader::IsBlockSelected(
+  vtkXMLDataElement* childXML, unsigned int dataSetIndex)
+{
+  const std::string name = vtkXMLMultiBlockDataReader::GetBlockName(childXML, dataSetIndex);
+  if (this->BlockSelection->ArrayExists(name.c_str()))
+  {
+    return this->BlockSelection->ArrayIsEnabled(name.c_str()) != 0;
+  }
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -145,7 +188,8 @@ void vtkXMLMultiBlockDataReader::ReadComposite(vtkXMLDataElement* element,
     {
       vtkSmartPointer<vtkDataObject> childDS;
       const char* name = nullptr;
-      if (this->ShouldReadDataSet(dataSetIndex, index, numPieces))
+      if (this->ShouldReadDataSet(dataSetIndex, index, numPieces) &&
+        this->IsBlockSelected(childXML, dataSetIndex))
       {
         // Read
         childDS.TakeReference(this->ReadDataObject(childXML, filePath));
@@ -168,8 +212,17 @@ void vtkXMLMultiBlockDataReader::ReadComposite(vtkXMLDataElement* element,
     else if (mblock != nullptr && strcmp(tagName, "Block") == 0)
     {
       vtkMultiBlockDataSet* childDS = vtkMultiBlockDataSet::New();
-      this->ReadComposite(childXML, childDS, filePath, dataSetIndex);
       const char* name = childXML->GetAttribute("name");
+      if (name && !this->IsBlockSelected(childXML, dataSetIndex))
+      {
+        // skip the whole subtree without opening any of its files, but
+        // keep the inorder leaf ranking in sync for the blocks that follow
+        dataSetIndex += vtkXMLCompositeDataReader::CountNestedElements(childXML, "DataSet");
+      }
+      else
+      {
+        this->ReadComposite(childXML, childDS, filePath, dataSetIndex);
+      }
       mblock->SetBlock(index, childDS);
       mblock->GetMetaData(index)->Set(vtkCompositeDataSet::NAME(), name);
       childDS->Delete();
@@ -191,8 +244,17 @@ void vtkXMLMultiBlockDataReader::ReadComposite(vtkXMLDataElement* element,
         // Child is not multipiece, so it is safe to create a vtkMultiPieceDataSet
         childDS = vtkMultiPieceDataSet::New();
       }
-      this->ReadComposite(childXML, childDS, filePath, dataSetIndex);
       const char* name = childXML->GetAttribute("name");
+      if (name && !this->IsBlockSelected(childXML, dataSetIndex))
+      {
+        // skip the whole subtree without opening any of its files, but
+        // keep the inorder leaf ranking in sync for the blocks that follow
+        dataSetIndex += vtkXMLCompositeDataReader::CountNestedElements(childXML, "DataSet");
+      }
+      else
+      {
+        this->ReadComposite(childXML, childDS, filePath, dataSetIndex);
+      }
       mblock->SetBlock(index, childDS);
       mblock->GetMetaData(index)->Set(vtkCompositeDataSet::NAME(), name);
       childDS->Delete();
@@ -266,6 +328,8 @@ int vtkXMLMultiBlockDataReader::FillMetaData(vtkCompositeDataSet* metadata,
     const char* tagName = childXML->GetName();
     if (strcmp(tagName, "DataSet") == 0)
     {
+      this->BlockSelection->AddArray(
+        vtkXMLMultiBlockDataReader::GetBlockName(childXML, dataSetIndex).c_str());
       vtkInformation* piece_metadata = CreateMetaDataIfNecessary(mblock, mpiece, index);
       double bounding_box[6];
       if (childXML->GetVectorAttribute("bounding_box", 6, bounding_box) == 6)
@@ -302,6 +366,12 @@ int vtkXMLMultiBlockDataReader::FillMetaData(vtkCompositeDataSet* metadata,
     // Child is a multiblock dataset itself. Create it.
     else if (mblock != nullptr && strcmp(tagName, "Block") == 0)
     {
+      // only named non-leaf blocks are selectable; the fall-back key uses
+      // the inorder leaf ranking, which would collide with leaf entries
+      if (const char* name = childXML->GetAttribute("name"))
+      {
+        this->BlockSelection->AddArray(name);
+      }
       vtkMultiBlockDataSet* childDS = vtkMultiBlockDataSet::New();
       this->FillMetaData(childDS, childXML, filePath, dataSetIndex);
       if (mblock)
@@ -333,6 +403,12 @@ int vtkXMLMultiBlockDataReader::FillMetaData(vtkCompositeDataSet* metadata,
         childDS = vtkMultiPieceDataSet::New();
       }
 
+      // only named non-leaf blocks are selectable; the fall-back key uses
+      // the inorder leaf ranking, which would collide with leaf entries
+      if (const char* name = childXML->GetAttribute("name"))
+      {
+        this->BlockSelection->AddArray(name);
+      }
       this->FillMetaData(childDS, childXML, filePath, dataSetIndex);
       mblock->SetBlock(index, childDS);
       childDS->Delete();
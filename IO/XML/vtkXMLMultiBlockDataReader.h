@@ -30,8 +30,10 @@
 #define vtkXMLMultiBlockDataReader_h
 
 #include "vtkIOXMLModule.h" // For export macro
+#include "vtkNew.h"          // for vtkNew
 #include "vtkXMLCompositeDataReader.h"
 
+class vtkDataArraySelection;
 class vtkMultiBlockDataSet;
 
 class VTKIOXML_EXPORT vtkXMLMultiBlockDataReader : public vtkXMLCompositeDataReader
@@ -41,6 +43,17 @@ public:
   vtkTypeMacro(vtkXMLMultiBlockDataReader, vtkXMLCompositeDataReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  /**
+   * Get the selection of blocks to load. The selection is populated with
+   * the names of the blocks and leaf datasets found in the file after
+   * UpdateInformation. All blocks are enabled by default; disabling a leaf
+   * skips reading its file entirely, and disabling a non-leaf block skips
+   * its whole subtree, so individual parts of large assemblies can be
+   * loaded without touching the other files. Unnamed entries are keyed as
+   * "Block <index>" using the inorder leaf index.
+   */
+  vtkDataArraySelection* GetBlockSelection();
+
 protected:
   vtkXMLMultiBlockDataReader();
   ~vtkXMLMultiBlockDataReader() override;
@@ -64,6 +77,16 @@ protected:
   virtual int FillMetaData(vtkCompositeDataSet* metadata, vtkXMLDataElement* element,
     const std::string& filePath, unsigned int& dataSetIndex);
 
+  // Returns the selection key for the given element: its "name" attribute
+  // when present, otherwise "Block <dataSetIndex>".
+  static std::string GetBlockName(vtkXMLDataElement* childXML, unsigned int dataSetIndex);
+
+  // Whether the block selection allows the given element to be read.
+  // Entries that were never registered are treated as enabled.
+  bool IsBlockSelected(vtkXMLDataElement* childXML, unsigned int dataSetIndex);
+
+  vtkNew<vtkDataArraySelection> BlockSelection;
+
 private:
   vtkXMLMultiBlockDataReader(const vtkXMLMultiBlockDataReader&) = delete;
   void operator=(const vtkXMLMultiBlockDataReader&) = delete;
@@ -14,8 +14,10 @@
 =========================================================================*/
 #include "vtkXMLReader.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkBitArray.h"
+#include "vtkEndian.h"
 #include "vtkCallbackCommand.h"
 #include "vtkDataArray.h"
 #include "vtkDataArraySelection.h"
@@ -53,12 +55,22 @@
 #include <algorithm>
 #include <cassert>
 #include <cctype>
+#include <cstring>
 #include <functional>
 #include <locale> // C++ locale
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <fcntl.h>    // For open()
+#include <sys/mman.h> // For mmap()/munmap()
+#include <sys/stat.h> // For fstat()
+#include <unistd.h>   // For close()
+#endif
+
 vtkCxxSetObjectMacro(vtkXMLReader, ReaderErrorObserver, vtkCommand);
 vtkCxxSetObjectMacro(vtkXMLReader, ParserErrorObserver, vtkCommand);
 
@@ -139,6 +151,7 @@ vtkXMLReader::vtkXMLReader()
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
   this->InputString = "";
+  this->MemoryMapAppendedData = false;
   this->XMLParser = nullptr;
   this->ReaderErrorObserver = nullptr;
   this->ParserErrorObserver = nullptr;
@@ -234,6 +247,8 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Stream: (none)\n";
   }
+  os << indent << "MemoryMapAppendedData: " << (this->MemoryMapAppendedData ? "On" : "Off")
+     << "\n";
   os << indent << "TimeStep:" << this->TimeStep << "\n";
   os << indent << "ActiveTimeDataArrayName:"
      << (this->ActiveTimeDataArrayName ? this->ActiveTimeDataArrayName : "(null)") << "\n";
@@ -901,6 +916,206 @@ int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xml
   return result;
 }
 
+#if !defined(_WIN32)
+// Book-keeping for arrays whose memory lives in a private mapping of the
+// input file.  Keyed by the data pointer handed to the array so that the
+// array's free function can find and release the enclosing mapping.
+struct vtkXMLReaderMappedRegion
+{
+  void* MapBase;
+  size_t MapLength;
+};
+
+std::mutex vtkXMLReaderMappedRegionsMutex;
+std::map<void*, vtkXMLReaderMappedRegion>& vtkXMLReaderMappedRegions()
+{
+  static std::map<void*, vtkXMLReaderMappedRegion> regions;
+  return regions;
+}
+
+//------------------------------------------------------------------------------
+void vtkXMLReaderFreeMappedMemory(void* ptr)
+{
+  std::lock_guard<std::mutex> lock(vtkXMLReaderMappedRegionsMutex);
+  auto& regions = vtkXMLReaderMappedRegions();
+  auto it = regions.find(ptr);
+  if (it != regions.end())
+  {
+    munmap(it->second.MapBase, it->second.MapLength);
+    regions.erase(it);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Map [position, position+length) of the named file privately and register
+// the resulting data pointer for later release.  Returns nullptr on failure.
+void* vtkXMLReaderMapFileRegion(const char* fileName, vtkTypeInt64 position, size_t length)
+{
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+  {
+    return nullptr;
+  }
+
+  struct stat fileInfo;
+  if (fstat(fd, &fileInfo) != 0 ||
+    static_cast<vtkTypeInt64>(fileInfo.st_size) < position + static_cast<vtkTypeInt64>(length))
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  // mmap requires a page-aligned file offset; map from the enclosing page
+  // and hand out an adjusted pointer.  MAP_PRIVATE gives copy-on-write
+  // semantics so callers may modify the data without touching the file.
+  const vtkTypeInt64 pageSize = static_cast<vtkTypeInt64>(sysconf(_SC_PAGESIZE));
+  const vtkTypeInt64 alignedPosition = (position / pageSize) * pageSize;
+  const size_t pageOffset = static_cast<size_t>(position - alignedPosition);
+  const size_t mapLength = length + pageOffset;
+
+  void* mapBase =
+    mmap(nullptr, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, alignedPosition);
+  close(fd);
+  if (mapBase == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+  void* dataPtr = static_cast<char*>(mapBase) + pageOffset;
+  std::lock_guard<std::mutex> lock(vtkXMLReaderMappedRegionsMutex);
+  vtkXMLReaderMappedRegions()[dataPtr] = { mapBase, mapLength };
+  return dataPtr;
+}
+
+//------------------------------------------------------------------------------
+struct vtkXMLReaderAdoptMappedMemoryWorker
+{
+  void* DataPtr;
+  vtkIdType NumValues;
+  int Result = 0;
+
+  template <class T>
+  void DoAdopt(vtkAOSDataArrayTemplate<T>* aosArray)
+  {
+    if (!aosArray || reinterpret_cast<uintptr_t>(this->DataPtr) % sizeof(T) != 0)
+    {
+      return;
+    }
+    aosArray->SetArray(static_cast<T*>(this->DataPtr), this->NumValues, 0,
+      vtkAOSDataArrayTemplate<T>::VTK_DATA_ARRAY_USER_DEFINED);
+    aosArray->SetArrayFreeFunction(&vtkXMLReaderFreeMappedMemory);
+    this->Result = 1;
+  }
+};
+#endif // !defined(_WIN32)
+
+}
+
+//------------------------------------------------------------------------------
+int vtkXMLReader::MapArrayFromAppendedData(vtkXMLDataElement* da, vtkAbstractArray* array,
+  vtkIdType arrayIndex, vtkIdType startIndex, vtkIdType numValues)
+{
+#if defined(_WIN32)
+  (void)da;
+  (void)array;
+  (void)arrayIndex;
+  (void)startIndex;
+  (void)numValues;
+  return 0;
+#else
+  // Only whole-array reads of numeric arrays with in-memory file layout
+  // qualify; partial reads and bit/string arrays use the buffered path.
+  if (arrayIndex != 0 || startIndex != 0 || numValues != array->GetNumberOfValues() ||
+    numValues == 0)
+  {
+    return 0;
+  }
+  if (!this->FileName || this->ReadFromInputString || !this->XMLParser)
+  {
+    return 0;
+  }
+  if (this->XMLParser->GetCompressor() || !this->XMLParser->IsAppendedDataRawEncoded())
+  {
+    return 0;
+  }
+#ifdef VTK_WORDS_BIGENDIAN
+  if (this->XMLParser->GetByteOrder() != vtkXMLDataParser::BigEndian)
+#else
+  if (this->XMLParser->GetByteOrder() != vtkXMLDataParser::LittleEndian)
+#endif
+  {
+    return 0;
+  }
+
+  vtkDataArray* dataArray = vtkDataArray::FastDownCast(array);
+  if (!dataArray || dataArray->GetDataType() == VTK_BIT || !dataArray->HasStandardMemoryLayout())
+  {
+    return 0;
+  }
+
+  if (!da->GetAttribute("offset"))
+  {
+    return 0;
+  }
+  vtkTypeInt64 offset = 0;
+  da->GetScalarAttribute("offset", offset);
+
+  const size_t wordSize = this->XMLParser->GetWordTypeSize(dataArray->GetDataType());
+  const size_t numBytes = static_cast<size_t>(numValues) * wordSize;
+  const size_t headerSize = static_cast<size_t>(this->XMLParser->GetHeaderType()) / 8;
+  const vtkTypeInt64 headerPosition = this->XMLParser->GetAppendedDataPosition() + offset;
+
+  void* headerPtr = vtkXMLReaderMapFileRegion(this->FileName, headerPosition,
+    headerSize + numBytes);
+  if (!headerPtr)
+  {
+    return 0;
+  }
+
+  // The uncompressed-data header is a single byte count; verify it matches
+  // what the XML declared before adopting the mapped memory.
+  vtkTypeUInt64 declaredBytes = 0;
+  if (headerSize == 8)
+  {
+    memcpy(&declaredBytes, headerPtr, 8);
+  }
+  else
+  {
+    vtkTypeUInt32 declaredBytes32 = 0;
+    memcpy(&declaredBytes32, headerPtr, 4);
+    declaredBytes = declaredBytes32;
+  }
+  if (declaredBytes != static_cast<vtkTypeUInt64>(numBytes))
+  {
+    vtkXMLReaderFreeMappedMemory(headerPtr);
+    return 0;
+  }
+
+  // Re-register the region under the data pointer the array will own.
+  void* dataPtr = static_cast<char*>(headerPtr) + headerSize;
+  {
+    std::lock_guard<std::mutex> lock(vtkXMLReaderMappedRegionsMutex);
+    auto& regions = vtkXMLReaderMappedRegions();
+    auto it = regions.find(headerPtr);
+    regions[dataPtr] = it->second;
+    regions.erase(it);
+  }
+
+  vtkXMLReaderAdoptMappedMemoryWorker worker;
+  worker.DataPtr = dataPtr;
+  worker.NumValues = numValues;
+  switch (dataArray->GetDataType())
+  {
+    vtkTemplateMacro(
+      worker.DoAdopt(vtkAOSDataArrayTemplate<VTK_TT>::FastDownCast(dataArray)));
+  }
+  if (!worker.Result)
+  {
+    vtkXMLReaderFreeMappedMemory(dataPtr);
+    return 0;
+  }
+  return 1;
+#endif // defined(_WIN32)
 }
 
 //------------------------------------------------------------------------------
@@ -913,6 +1128,16 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
     return 0;
   }
   this->InReadData = 1;
+
+  if (this->MemoryMapAppendedData &&
+    this->MapArrayFromAppendedData(da, array, arrayIndex, startIndex, numValues))
+  {
+    this->ConvertGhostLevelsToGhostType(fieldType, array, startIndex, numValues);
+    array->Modified();
+    this->InReadData = 0;
+    return 1;
+  }
+
   int result;
   vtkArrayIterator* iter = array->NewIterator();
   if (arrayIndex + numValues > array->GetNumberOfValues())
@@ -910,8 +910,9 @@ void vtkXMLUnstructuredDataWriter::WriteCellsAppendedDataWorker(
 
       vtkMTimeType mtime = allcells[i]->GetMTime();
       vtkMTimeType& cellsMTime = cellsManager->GetElement(i).GetLastMTime();
-      // Only write cells if MTime has changed
-      if (cellsMTime != mtime)
+      // Only write cells if MTime has changed. The first time step must
+      // always be written, since there is no earlier offset to forward.
+      if (cellsMTime != mtime || timestep == 0)
       {
         cellsMTime = mtime;
         // Write the connectivity array.
@@ -1013,6 +1014,21 @@ struct ConvertCellsVisitor
 //------------------------------------------------------------------------------
 void vtkXMLUnstructuredDataWriter::ConvertCells(vtkCellArray* cells)
 {
+  if (cells && this->NumberOfTimeSteps > 1)
+  {
+    // When writing a time series, reuse the wrappers created for this cell
+    // array as long as it has not been modified. This keeps their MTime
+    // stable, so that WriteCellsAppendedDataWorker() recognizes the topology
+    // as unchanged and does not append another copy of it for each step.
+    auto it = this->ConvertedCellsCache.find(cells);
+    if (it != this->ConvertedCellsCache.end() && it->second.MTime == cells->GetMTime())
+    {
+      this->CellPoints = it->second.Connectivity;
+      this->CellOffsets = it->second.Offsets;
+      return;
+    }
+  }
+
   ConvertCellsVisitor visitor;
   if (cells)
   {
@@ -1020,6 +1036,14 @@ void vtkXMLUnstructuredDataWriter::ConvertCells(vtkCellArray* cells)
   }
   this->CellPoints = visitor.Connectivity;
   this->CellOffsets = visitor.Offsets;
+
+  if (cells && this->NumberOfTimeSteps > 1)
+  {
+    ConvertedCellsEntry& entry = this->ConvertedCellsCache[cells];
+    entry.MTime = cells->GetMTime();
+    entry.Connectivity = this->CellPoints;
+    entry.Offsets = this->CellOffsets;
+  }
 }
 
 //------------------------------------------------------------------------------
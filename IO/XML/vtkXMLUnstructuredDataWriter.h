@@ -28,6 +28,8 @@
 
 #include <vtkSmartPointer.h> // for vtkSmartPointer
 
+#include <map> // for std::map
+
 class vtkPointSet;
 class vtkCellArray;
 class vtkCellIterator;
@@ -163,6 +165,19 @@ protected:
   vtkSmartPointer<vtkDataArray> CellPoints;
   vtkSmartPointer<vtkDataArray> CellOffsets;
 
+  // Cache of the wrapper arrays created by ConvertCells(vtkCellArray*),
+  // keyed by the source cell array. Only used when writing a time series:
+  // reusing the wrappers while the source is unmodified keeps their MTime
+  // stable, so the appended-data writer can forward the previous time
+  // step's offsets instead of appending another copy of the topology.
+  struct ConvertedCellsEntry
+  {
+    vtkMTimeType MTime;
+    vtkSmartPointer<vtkDataArray> Connectivity;
+    vtkSmartPointer<vtkDataArray> Offsets;
+  };
+  std::map<vtkSmartPointer<vtkCellArray>, ConvertedCellsEntry> ConvertedCellsCache;
+
   int CurrentPiece;
 
   // Hold the face arrays for polyhedron cells.
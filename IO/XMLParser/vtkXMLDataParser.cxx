@@ -21,12 +21,14 @@
 #include "vtkEndian.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
 #undef vtkXMLDataHeaderPrivate_DoNotInclude
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <memory>
@@ -178,6 +180,14 @@ void vtkXMLDataParser::StartElement(const char* name, const char** atts)
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLDataParser::IsAppendedDataRawEncoded()
+{
+  // StartElement() replaces the base64 decoder by a plain vtkInputStream
+  // when the AppendedData element declares encoding="raw".
+  return vtkBase64InputStream::SafeDownCast(this->AppendedDataStream) == nullptr;
+}
+
 //------------------------------------------------------------------------------
 void vtkXMLDataParser::SeekInlineDataPosition(vtkXMLDataElement* element)
 {
@@ -807,21 +817,65 @@ size_t vtkXMLDataParser::ReadCompressedData(
     // Report progress.
     this->UpdateProgress(float(outputPointer - data) / length);
 
-    unsigned int currentBlock = firstBlock + 1;
-    for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    // Process the complete blocks in batches: the compressed bytes of each
+    // batch are read in one sequential pass (the blocks are contiguous in
+    // the stream), then the blocks are uncompressed and byte swapped in
+    // parallel. The batch bounds the staging memory while still keeping all
+    // cores busy, since decompression dominates the read time.
+    vtkTypeUInt64 const blocksPerBatch = 128;
+    std::vector<unsigned char> compressedBuffer;
+    std::vector<size_t> compressedOffsets;
+    vtkTypeUInt64 currentBlock = firstBlock + 1;
+    while (currentBlock != lastBlock && !this->Abort)
     {
-      // Read this block.
-      if (!this->ReadBlock(currentBlock, outputPointer))
+      vtkTypeUInt64 batchEnd = currentBlock + blocksPerBatch;
+      if (batchEnd > lastBlock)
+      {
+        batchEnd = lastBlock;
+      }
+      vtkTypeUInt64 numBatchBlocks = batchEnd - currentBlock;
+
+      // Read the compressed bytes of the whole batch.
+      compressedOffsets.resize(numBatchBlocks);
+      size_t compressedLength = 0;
+      for (vtkTypeUInt64 i = 0; i < numBatchBlocks; ++i)
+      {
+        compressedOffsets[i] = compressedLength;
+        compressedLength += this->BlockCompressedSizes[currentBlock + i];
+      }
+      compressedBuffer.resize(compressedLength);
+      if (!this->DataStream->Seek(this->BlockStartOffsets[currentBlock]) ||
+        this->DataStream->Read(compressedBuffer.data(), compressedLength) < compressedLength)
       {
         return 0;
       }
 
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
+      // Uncompress and byte swap the blocks in parallel. Note that
+      // blockSize will always be an integer multiple of the word size.
+      std::atomic<bool> uncompressOK(true);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(numBatchBlocks),
+        [this, &compressedBuffer, &compressedOffsets, &uncompressOK, currentBlock, outputPointer,
+          blockSize, wordSize](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            unsigned char* blockOutput = outputPointer + i * blockSize;
+            if (this->Compressor->Uncompress(compressedBuffer.data() + compressedOffsets[i],
+                  this->BlockCompressedSizes[currentBlock + i], blockOutput, blockSize) == 0)
+            {
+              uncompressOK = false;
+              return;
+            }
+            this->PerformByteSwap(blockOutput, blockSize / wordSize, wordSize);
+          }
+        });
+      if (!uncompressOK)
+      {
+        return 0;
+      }
 
-      // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
+      // Advance the pointer past the batch.
+      outputPointer += numBatchBlocks * blockSize;
+      currentBlock = batchEnd;
 
       // Report progress.
       this->UpdateProgress(float(outputPointer - data) / length);
@@ -158,6 +158,23 @@ public:
    */
   vtkTypeInt64 GetAppendedDataPosition() { return this->AppendedDataPosition; }
 
+  ///@{
+  /**
+   * Returns the byte order and binary header type (32 or 64 bit) declared
+   * by the file's root element.  Valid after the XML is parsed.
+   */
+  vtkGetMacro(ByteOrder, int);
+  vtkGetMacro(HeaderType, int);
+  ///@}
+
+  /**
+   * Returns true if the appended data section uses raw encoding rather
+   * than base64.  Valid after the XML is parsed.  Together with
+   * GetAppendedDataPosition() this lets readers access uncompressed
+   * appended data in place, e.g. through a memory mapping.
+   */
+  bool IsAppendedDataRawEncoded();
+
 protected:
   vtkXMLDataParser();
   ~vtkXMLDataParser() override;
@@ -15,6 +15,7 @@
 #include "vtkExtractVOI.h"
 
 #include "vtkCellData.h"
+#include "vtkDataArray.h"
 #include "vtkExtractStructuredGridHelper.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
@@ -26,6 +27,46 @@
 
 vtkStandardNewMacro(vtkExtractVOI);
 
+namespace
+{
+// Populate outDSA with arrays that alias a contiguous range of tuples of the
+// arrays in dsa. Returns false, leaving outDSA untouched, when some array
+// cannot be aliased (not a data array, or not in contiguous AOS layout).
+bool AliasAttributeArrays(
+  vtkDataSetAttributes* dsa, vtkDataSetAttributes* outDSA, vtkIdType tupleOffset, vtkIdType numTuples)
+{
+  int numArrays = dsa->GetNumberOfArrays();
+  for (int i = 0; i < numArrays; ++i)
+  {
+    vtkDataArray* array = vtkDataArray::SafeDownCast(dsa->GetAbstractArray(i));
+    if (!array || !array->HasStandardMemoryLayout())
+    {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < numArrays; ++i)
+  {
+    vtkDataArray* array = vtkDataArray::SafeDownCast(dsa->GetAbstractArray(i));
+    int numComps = array->GetNumberOfComponents();
+    vtkDataArray* view = array->NewInstance();
+    view->SetNumberOfComponents(numComps);
+    view->SetName(array->GetName());
+    // The "save" flag makes the view a non-owning alias of the input buffer.
+    view->SetVoidArray(array->GetVoidPointer(tupleOffset * numComps),
+      numTuples * static_cast<vtkIdType>(numComps), 1);
+    int attrIdx = dsa->IsArrayAnAttribute(i);
+    int outIdx = outDSA->AddArray(view);
+    if (attrIdx >= 0)
+    {
+      outDSA->SetActiveAttribute(outIdx, attrIdx);
+    }
+    view->Delete();
+  }
+  return true;
+}
+} // anonymous namespace
+
 // Construct object to extract all of the input data.
 vtkExtractVOI::vtkExtractVOI()
 {
@@ -34,6 +75,7 @@ vtkExtractVOI::vtkExtractVOI()
 
   this->SampleRate[0] = this->SampleRate[1] = this->SampleRate[2] = 1;
   this->IncludeBoundary = 0;
+  this->AllowContiguousVOIViews = 0;
 
   this->Internal = vtkExtractStructuredGridHelper::New();
 }
@@ -289,6 +331,40 @@ bool vtkExtractVOI::RequestDataImpl(
   }
   output->SetDirectionMatrix(input->GetDirectionMatrix());
 
+  // When the VOI is a whole slab of the input along the k direction, the
+  // point and cell values form contiguous runs of the input buffers and the
+  // output can alias them instead of copying.
+  const int* outExt = output->GetExtent();
+  if (this->AllowContiguousVOIViews && !resampled && outExt[0] == inExt[0] &&
+    outExt[1] == inExt[1] && outExt[2] == inExt[2] && outExt[3] == inExt[3])
+  {
+    vtkIdType nxy = static_cast<vtkIdType>(inExt[1] - inExt[0] + 1) * (inExt[3] - inExt[2] + 1);
+    vtkIdType ptOffset = static_cast<vtkIdType>(outExt[4] - inExt[4]) * nxy;
+    vtkIdType numPts = static_cast<vtkIdType>(outExt[5] - outExt[4] + 1) * nxy;
+    if (AliasAttributeArrays(pd, outPD, ptOffset, numPts))
+    {
+      vtkDebugMacro(<< "Returning zero-copy view of VOI");
+      // A degenerate (single point-plane) output has 2D cells that do not
+      // correspond to any contiguous run of input cells, so those are still
+      // copied through the helper.
+      bool cellView = !(outExt[4] == outExt[5] && inExt[4] != inExt[5]);
+      if (cellView)
+      {
+        vtkIdType ncxy = static_cast<vtkIdType>(inExt[1] > inExt[0] ? inExt[1] - inExt[0] : 1) *
+          (inExt[3] > inExt[2] ? inExt[3] - inExt[2] : 1);
+        vtkIdType cellOffset = static_cast<vtkIdType>(outExt[4] - inExt[4]) * ncxy;
+        vtkIdType numCells =
+          static_cast<vtkIdType>(outExt[5] > outExt[4] ? outExt[5] - outExt[4] : 1) * ncxy;
+        cellView = AliasAttributeArrays(cd, outCD, cellOffset, numCells);
+      }
+      if (!cellView)
+      {
+        this->Internal->CopyCellData(inExt, output->GetExtent(), cd, outCD);
+      }
+      return true;
+    }
+  }
+
   vtkDebugMacro(<< "Extracting Grid");
   this->Internal->CopyPointsAndPointData(inExt, output->GetExtent(), pd, nullptr, outPD, nullptr);
   this->Internal->CopyCellData(inExt, output->GetExtent(), cd, outCD);
@@ -310,4 +386,7 @@ void vtkExtractVOI::PrintSelf(ostream& os, vtkIndent indent)
      << this->SampleRate[2] << ")\n";
 
   os << indent << "Include Boundary: " << (this->IncludeBoundary ? "On\n" : "Off\n");
+
+  os << indent
+     << "AllowContiguousVOIViews: " << (this->AllowContiguousVOIViews ? "On\n" : "Off\n");
 }
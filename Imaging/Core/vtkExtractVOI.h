@@ -91,6 +91,22 @@ public:
   vtkBooleanMacro(IncludeBoundary, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * When on and the sample rates are all 1, a VOI that forms a whole slab of
+   * the input along the slowest (k) direction is returned as a zero-copy
+   * view: the output arrays alias the contiguous sub-range of the input
+   * buffers instead of copying it. The aliased arrays do not own their
+   * memory, so the input image must outlive the output; in particular the
+   * input must not have its data released (e.g. via ReleaseDataFlag) while
+   * the output is in use. Off by default. VOIs that are not contiguous in
+   * memory are copied as usual.
+   */
+  vtkSetMacro(AllowContiguousVOIViews, vtkTypeBool);
+  vtkGetMacro(AllowContiguousVOIViews, vtkTypeBool);
+  vtkBooleanMacro(AllowContiguousVOIViews, vtkTypeBool);
+  ///@}
+
 protected:
   vtkExtractVOI();
   ~vtkExtractVOI() override;
@@ -111,6 +127,7 @@ protected:
   int VOI[6];
   int SampleRate[3];
   vtkTypeBool IncludeBoundary;
+  vtkTypeBool AllowContiguousVOIViews;
 
   vtkExtractStructuredGridHelper* Internal;
 
@@ -490,7 +490,11 @@ void vtkImageInterpolatorGetInterpolationFunc(
 //------------------------------------------------------------------------------
 // Interpolation for precomputed weights
 
-template <class F, class T>
+// The struct is also templated over the component count N so that the
+// common pixel formats get inner component loops with a compile-time trip
+// count, which the compiler can unroll and vectorize. N == 0 means the
+// component count is only known at run time.
+template <class F, class T, int N = 0>
 struct vtkImageNLCRowInterpolate
 {
   static void Nearest(
@@ -505,8 +509,8 @@ struct vtkImageNLCRowInterpolate
 
 //------------------------------------------------------------------------------
 // helper function for nearest neighbor interpolation
-template <class F, class T>
-void vtkImageNLCRowInterpolate<F, T>::Nearest(
+template <class F, class T, int N>
+void vtkImageNLCRowInterpolate<F, T, N>::Nearest(
   vtkInterpolationWeights* weights, int idX, int idY, int idZ, F* outPtr, int n)
 {
   const vtkIdType* iX = weights->Positions[0] + idX;
@@ -515,7 +519,7 @@ void vtkImageNLCRowInterpolate<F, T>::Nearest(
   const T* inPtr0 = static_cast<const T*>(weights->Pointer) + iY[0] + iZ[0];
 
   // get the number of components per pixel
-  int numscalars = weights->NumberOfComponents;
+  int numscalars = (N > 0 ? N : weights->NumberOfComponents);
 
   // This is a hot loop.
   for (int i = n; i > 0; --i)
@@ -532,8 +536,8 @@ void vtkImageNLCRowInterpolate<F, T>::Nearest(
 
 //------------------------------------------------------------------------------
 // helper function for linear interpolation
-template <class F, class T>
-void vtkImageNLCRowInterpolate<F, T>::Trilinear(
+template <class F, class T, int N>
+void vtkImageNLCRowInterpolate<F, T, N>::Trilinear(
   vtkInterpolationWeights* weights, int idX, int idY, int idZ, F* outPtr, int n)
 {
   int stepX = weights->KernelSize[0];
@@ -551,7 +555,7 @@ void vtkImageNLCRowInterpolate<F, T>::Trilinear(
   const T* inPtr = static_cast<const T*>(weights->Pointer);
 
   // get the number of components per pixel
-  int numscalars = weights->NumberOfComponents;
+  int numscalars = (N > 0 ? N : weights->NumberOfComponents);
 
   // create a 2x2 bilinear kernel in local variables
   vtkIdType i00 = iY[0] + iZ[0];
@@ -686,8 +690,8 @@ void vtkImageNLCRowInterpolate<F, T>::Trilinear(
 
 //------------------------------------------------------------------------------
 // helper function for tricubic interpolation
-template <class F, class T>
-void vtkImageNLCRowInterpolate<F, T>::Tricubic(
+template <class F, class T, int N>
+void vtkImageNLCRowInterpolate<F, T, N>::Tricubic(
   vtkInterpolationWeights* weights, int idX, int idY, int idZ, F* outPtr, int n)
 {
   int stepX = weights->KernelSize[0];
@@ -705,7 +709,7 @@ void vtkImageNLCRowInterpolate<F, T>::Tricubic(
   const T* inPtr = static_cast<const T*>(weights->Pointer);
 
   // get the number of components per pixel
-  int numscalars = weights->NumberOfComponents;
+  int numscalars = (N > 0 ? N : weights->NumberOfComponents);
 
   for (int i = n; i > 0; --i)
   {
@@ -772,11 +776,13 @@ void vtkImageNLCRowInterpolate<F, T>::Tricubic(
 
 //------------------------------------------------------------------------------
 // get row interpolation function for different interpolation modes
-// and different scalar types
+// and different scalar types. The common pixel formats (one through four
+// components) get kernels specialized on the component count, which makes
+// the inner loops vectorizable (see vtkImageNLCRowInterpolate above).
 template <class F>
 void vtkImageInterpolatorGetRowInterpolationFunc(
   void (**summation)(vtkInterpolationWeights* weights, int idX, int idY, int idZ, F* outPtr, int n),
-  int scalarType, int interpolationMode)
+  int scalarType, int interpolationMode, int numComponents)
 {
   switch (interpolationMode)
   {
@@ -789,19 +795,101 @@ void vtkImageInterpolatorGetRowInterpolationFunc(
       }
       break;
     case VTK_LINEAR_INTERPOLATION:
-      switch (scalarType)
+      switch (numComponents)
       {
-        vtkTemplateAliasMacro(*summation = &(vtkImageNLCRowInterpolate<F, VTK_TT>::Trilinear));
+        case 1:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 1>::Trilinear));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 2:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 2>::Trilinear));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 3:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 3>::Trilinear));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 4:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 4>::Trilinear));
+            default:
+              *summation = nullptr;
+          }
+          break;
         default:
-          *summation = nullptr;
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(*summation = &(vtkImageNLCRowInterpolate<F, VTK_TT>::Trilinear));
+            default:
+              *summation = nullptr;
+          }
+          break;
       }
       break;
     case VTK_CUBIC_INTERPOLATION:
-      switch (scalarType)
+      switch (numComponents)
       {
-        vtkTemplateAliasMacro(*summation = &(vtkImageNLCRowInterpolate<F, VTK_TT>::Tricubic));
+        case 1:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 1>::Tricubic));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 2:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 2>::Tricubic));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 3:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 3>::Tricubic));
+            default:
+              *summation = nullptr;
+          }
+          break;
+        case 4:
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(
+              *summation = &(vtkImageNLCRowInterpolate<F, VTK_TT, 4>::Tricubic));
+            default:
+              *summation = nullptr;
+          }
+          break;
         default:
-          *summation = nullptr;
+          switch (scalarType)
+          {
+            vtkTemplateAliasMacro(*summation = &(vtkImageNLCRowInterpolate<F, VTK_TT>::Tricubic));
+            default:
+              *summation = nullptr;
+          }
+          break;
       }
       break;
   }
@@ -1026,16 +1114,16 @@ void vtkImageInterpolator::GetInterpolationFunc(
 void vtkImageInterpolator::GetRowInterpolationFunc(
   void (**func)(vtkInterpolationWeights*, int, int, int, double*, int))
 {
-  vtkImageInterpolatorGetRowInterpolationFunc(
-    func, this->InterpolationInfo->ScalarType, this->InterpolationMode);
+  vtkImageInterpolatorGetRowInterpolationFunc(func, this->InterpolationInfo->ScalarType,
+    this->InterpolationMode, this->InterpolationInfo->NumberOfComponents);
 }
 
 //------------------------------------------------------------------------------
 void vtkImageInterpolator::GetRowInterpolationFunc(
   void (**func)(vtkInterpolationWeights*, int, int, int, float*, int))
 {
-  vtkImageInterpolatorGetRowInterpolationFunc(
-    func, this->InterpolationInfo->ScalarType, this->InterpolationMode);
+  vtkImageInterpolatorGetRowInterpolationFunc(func, this->InterpolationInfo->ScalarType,
+    this->InterpolationMode, this->InterpolationInfo->NumberOfComponents);
 }
 
 //------------------------------------------------------------------------------
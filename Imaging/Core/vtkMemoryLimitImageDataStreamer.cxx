@@ -0,0 +1,80 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMemoryLimitImageDataStreamer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkMemoryLimitImageDataStreamer.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+vtkStandardNewMacro(vtkMemoryLimitImageDataStreamer);
+
+//------------------------------------------------------------------------------
+vtkMemoryLimitImageDataStreamer::vtkMemoryLimitImageDataStreamer()
+{
+  // 50 mebibytes by default.
+  this->MemoryLimit = 50 * 1024;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryLimitImageDataStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "MemoryLimit (in kb): " << this->MemoryLimit << endl;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkMemoryLimitImageDataStreamer::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // Compute the number of divisions once per update, before the first
+  // piece is requested from the input.
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()) &&
+    this->CurrentDivision == 0)
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+    int outExt[6];
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+
+    vtkIdType numPoints = static_cast<vtkIdType>(outExt[1] - outExt[0] + 1) *
+      (outExt[3] - outExt[2] + 1) * (outExt[5] - outExt[4] + 1);
+
+    int scalarSize = vtkDataArray::GetDataTypeSize(vtkImageData::GetScalarType(inInfo));
+    int numComponents = vtkImageData::GetNumberOfScalarComponents(inInfo);
+
+    // Size of the full request in kibibytes, rounded up.
+    vtkTypeUInt64 totalKb =
+      (static_cast<vtkTypeUInt64>(numPoints) * scalarSize * numComponents + 1023) / 1024;
+
+    vtkIdType divisions = 1;
+    if (this->MemoryLimit > 0)
+    {
+      divisions = static_cast<vtkIdType>((totalKb + this->MemoryLimit - 1) / this->MemoryLimit);
+    }
+    // Pieces smaller than a point are meaningless.
+    if (divisions > numPoints)
+    {
+      divisions = (numPoints > 0 ? numPoints : 1);
+    }
+    this->NumberOfStreamDivisions = static_cast<int>(divisions);
+  }
+
+  return this->Superclass::ProcessRequest(request, inputVector, outputVector);
+}
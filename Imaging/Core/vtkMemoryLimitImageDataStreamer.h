@@ -0,0 +1,65 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkMemoryLimitImageDataStreamer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkMemoryLimitImageDataStreamer
+ * @brief   Initiates streaming on image data.
+ *
+ * To satisfy a request, this filter calls update on its input many times
+ * with smaller update extents. All upstream processing is done on smaller
+ * pieces, so any intermediate images allocated by upstream filters stay
+ * piece sized. Unlike vtkImageDataStreamer, the number of divisions is
+ * computed from a memory limit rather than set directly: the requested
+ * extent is split into just enough pieces that each one fits within the
+ * limit. Each upstream filter still pads the piece with whatever overlap
+ * its own RequestUpdateExtent demands (e.g. convolution kernels).
+ */
+
+#ifndef vtkMemoryLimitImageDataStreamer_h
+#define vtkMemoryLimitImageDataStreamer_h
+
+#include "vtkImageDataStreamer.h"
+#include "vtkImagingCoreModule.h" // For export macro
+
+class VTKIMAGINGCORE_EXPORT vtkMemoryLimitImageDataStreamer : public vtkImageDataStreamer
+{
+public:
+  static vtkMemoryLimitImageDataStreamer* New();
+  vtkTypeMacro(vtkMemoryLimitImageDataStreamer, vtkImageDataStreamer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the memory limit in kibibytes (1024 bytes).
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  // See the vtkAlgorithm for a description of what these do
+  vtkTypeBool ProcessRequest(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+protected:
+  vtkMemoryLimitImageDataStreamer();
+  ~vtkMemoryLimitImageDataStreamer() override = default;
+
+  unsigned long MemoryLimit;
+
+private:
+  vtkMemoryLimitImageDataStreamer(const vtkMemoryLimitImageDataStreamer&) = delete;
+  void operator=(const vtkMemoryLimitImageDataStreamer&) = delete;
+};
+
+#endif
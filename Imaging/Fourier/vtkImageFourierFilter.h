@@ -132,6 +132,8 @@ protected:
   ~vtkImageFourierFilter() override = default;
 
   void ExecuteFftStep2(vtkImageComplex* p_in, vtkImageComplex* p_out, int N, int bsize, int fb);
+  void ExecuteFftStep2Table(vtkImageComplex* p_in, vtkImageComplex* p_out, int N, int bsize,
+    const vtkImageComplex* twiddles, int stride);
   void ExecuteFftStepN(
     vtkImageComplex* p_in, vtkImageComplex* p_out, int N, int bsize, int n, int fb);
   void ExecuteFftForwardBackward(vtkImageComplex* in, vtkImageComplex* out, int N, int fb);
@@ -22,6 +22,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkSMPTools.h"
@@ -55,7 +56,10 @@ public:
   // Cap the boundaries with the specified cap value (if requested).
   void Cap();
 
-  // Interface implicit function computation to SMP tools.
+  // Interface implicit function computation to SMP tools. Rows of contiguous
+  // sample points are evaluated through the array form of FunctionValue() so
+  // that functions with an array fast path (e.g. vtkPlane, vtkSphere) amortize
+  // the virtual dispatch over a whole x-row rather than paying it per point.
   template <class TT>
   class FunctionValueOp
   {
@@ -65,22 +69,36 @@ public:
 
     void operator()(vtkIdType k, vtkIdType end)
     {
-      double x[3];
       vtkIdType* extent = this->Algo->Extent;
       vtkIdType i, j, jOffset, kOffset;
+      const vtkIdType rowSize = this->Algo->Dims[0];
+      vtkNew<vtkDoubleArray> rowCoords;
+      rowCoords->SetNumberOfComponents(3);
+      rowCoords->SetNumberOfTuples(rowSize);
+      vtkNew<vtkDoubleArray> rowValues;
+      rowValues->SetNumberOfTuples(rowSize);
+      double* coords = rowCoords->GetPointer(0);
+      const double* values = rowValues->GetPointer(0);
       for (; k < end; ++k)
       {
-        x[2] = this->Algo->Origin[2] + k * this->Algo->Spacing[2];
+        const double z = this->Algo->Origin[2] + k * this->Algo->Spacing[2];
         kOffset = (k - extent[4]) * this->Algo->SliceSize;
         for (j = extent[2]; j <= extent[3]; ++j)
         {
-          x[1] = this->Algo->Origin[1] + j * this->Algo->Spacing[1];
-          jOffset = (j - extent[2]) * this->Algo->Dims[0];
+          const double y = this->Algo->Origin[1] + j * this->Algo->Spacing[1];
+          jOffset = (j - extent[2]) * rowSize;
           for (i = extent[0]; i <= extent[1]; ++i)
           {
-            x[0] = this->Algo->Origin[0] + i * this->Algo->Spacing[0];
-            this->Algo->Scalars[(i - extent[0]) + jOffset + kOffset] =
-              static_cast<TT>(this->Algo->ImplicitFunction->FunctionValue(x));
+            double* c = coords + 3 * (i - extent[0]);
+            c[0] = this->Algo->Origin[0] + i * this->Algo->Spacing[0];
+            c[1] = y;
+            c[2] = z;
+          }
+          this->Algo->ImplicitFunction->FunctionValue(rowCoords, rowValues);
+          TT* s = this->Algo->Scalars + jOffset + kOffset;
+          for (i = 0; i < rowSize; ++i)
+          {
+            s[i] = static_cast<TT>(values[i]);
           }
         }
       }
@@ -21,9 +21,13 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <limits>
+#include <vector>
 
 vtkStandardNewMacro(vtkImageAccumulate);
 
@@ -115,6 +119,167 @@ vtkImageStencilData* vtkImageAccumulate::GetStencil()
   return vtkImageStencilData::SafeDownCast(this->GetExecutive()->GetInputData(1, 0));
 }
 
+namespace
+{
+
+// Per-thread accumulation state: a private copy of the histogram bins plus
+// the running statistics, merged in Reduce().
+struct vtkImageAccumulateThreadLocal
+{
+  std::vector<vtkIdType> Bins;
+  double Sum[3];
+  double SumSqr[3];
+  double Min[3];
+  double Max[3];
+  vtkIdType Count = 0;
+};
+
+// Threaded histogram accumulation. The update extent is swept one row at a
+// time (rows are distributed across threads), each thread binning into its
+// private histogram so no synchronization is needed in the hot loop. When
+// the scalars are integers and the binning is the identity mapping (unit
+// spacing, integral origin) the bin index is a plain integer subtraction
+// rather than a double divide and floor, which is the common 8/16-bit case.
+template <class T>
+struct vtkImageAccumulateFunctor
+{
+  vtkImageData* InData;
+  vtkImageStencilData* Stencil;
+  const int* UpdateExtent;
+  int NumC;
+  int OutExtent[6];
+  vtkIdType OutIncs[3];
+  double Origin[3];
+  double Spacing[3];
+  int OriginInt[3];
+  vtkIdType Size;
+  int Dim1;
+  bool ReverseStencil;
+  bool IgnoreZero;
+  bool IntegerBinning;
+
+  vtkSMPThreadLocal<vtkImageAccumulateThreadLocal> Blocks;
+
+  // Merged results.
+  vtkIdType* OutPtr;
+  double *MinOut, *MaxOut;
+  double Sum[3], SumSqr[3];
+  vtkIdType* VoxelCount;
+
+  void Initialize() {}
+
+  void operator()(vtkIdType row, vtkIdType endRow)
+  {
+    vtkImageAccumulateThreadLocal& block = this->Blocks.Local();
+    if (block.Bins.empty())
+    {
+      block.Bins.resize(this->Size, 0);
+      for (int c = 0; c < 3; ++c)
+      {
+        block.Sum[c] = block.SumSqr[c] = 0.0;
+        block.Min[c] = VTK_DOUBLE_MAX;
+        block.Max[c] = VTK_DOUBLE_MIN;
+      }
+    }
+    vtkIdType* bins = block.Bins.data();
+
+    for (; row < endRow; ++row)
+    {
+      int ext[6];
+      ext[0] = this->UpdateExtent[0];
+      ext[1] = this->UpdateExtent[1];
+      ext[2] = ext[3] = this->UpdateExtent[2] + static_cast<int>(row % this->Dim1);
+      ext[4] = ext[5] = this->UpdateExtent[4] + static_cast<int>(row / this->Dim1);
+
+      vtkImageStencilIterator<T> inIter(this->InData, this->Stencil, ext, nullptr);
+      while (!inIter.IsAtEnd())
+      {
+        if (inIter.IsInStencil() ^ this->ReverseStencil)
+        {
+          T* inPtr = inIter.BeginSpan();
+          T* spanEndPtr = inIter.EndSpan();
+
+          while (inPtr != spanEndPtr)
+          {
+            // find the bin for this pixel.
+            bool outOfBounds = false;
+            vtkIdType binIdx = 0;
+            for (int idxC = 0; idxC < this->NumC; ++idxC)
+            {
+              double v = static_cast<double>(*inPtr++);
+              if (!this->IgnoreZero || v != 0)
+              {
+                // gather statistics
+                block.Sum[idxC] += v;
+                block.SumSqr[idxC] += v * v;
+                if (v > block.Max[idxC])
+                {
+                  block.Max[idxC] = v;
+                }
+                if (v < block.Min[idxC])
+                {
+                  block.Min[idxC] = v;
+                }
+                block.Count++;
+              }
+
+              // compute the index
+              int outIdx = this->IntegerBinning
+                ? static_cast<int>(v) - this->OriginInt[idxC]
+                : vtkMath::Floor((v - this->Origin[idxC]) / this->Spacing[idxC]);
+
+              // verify that it is in range
+              if (outIdx >= this->OutExtent[idxC * 2] && outIdx <= this->OutExtent[idxC * 2 + 1])
+              {
+                binIdx += (outIdx - this->OutExtent[idxC * 2]) * this->OutIncs[idxC];
+              }
+              else
+              {
+                outOfBounds = true;
+              }
+            }
+
+            // increment the bin
+            if (!outOfBounds)
+            {
+              ++bins[binIdx];
+            }
+          }
+        }
+
+        inIter.NextSpan();
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto blockIter = this->Blocks.begin(); blockIter != this->Blocks.end(); ++blockIter)
+    {
+      vtkImageAccumulateThreadLocal& block = *blockIter;
+      if (block.Bins.empty())
+      {
+        continue;
+      }
+      const vtkIdType* bins = block.Bins.data();
+      for (vtkIdType j = 0; j < this->Size; ++j)
+      {
+        this->OutPtr[j] += bins[j];
+      }
+      for (int c = 0; c < 3; ++c)
+      {
+        this->Sum[c] += block.Sum[c];
+        this->SumSqr[c] += block.SumSqr[c];
+        this->MinOut[c] = (block.Min[c] < this->MinOut[c]) ? block.Min[c] : this->MinOut[c];
+        this->MaxOut[c] = (block.Max[c] > this->MaxOut[c]) ? block.Max[c] : this->MaxOut[c];
+      }
+      *this->VoxelCount += block.Count;
+    }
+  }
+};
+
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // This templated function executes the filter for any type of data.
 template <class T>
@@ -122,11 +287,6 @@ int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*
   vtkImageData* outData, vtkIdType* outPtr, double min[3], double max[3], double mean[3],
   double standardDeviation[3], vtkIdType* voxelCount, int* updateExtent)
 {
-  // variables used to compute statistics (filter handles max 3 components)
-  double sum[3];
-  sum[0] = sum[1] = sum[2] = 0.0;
-  double sumSqr[3];
-  sumSqr[0] = sumSqr[1] = sumSqr[2] = 0.0;
   min[0] = min[1] = min[2] = VTK_DOUBLE_MAX;
   max[0] = max[1] = max[2] = VTK_DOUBLE_MIN;
   standardDeviation[0] = standardDeviation[1] = standardDeviation[2] = 0.0;
@@ -159,68 +319,48 @@ int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*
     outPtr[j] = 0;
   }
 
-  vtkImageStencilData* stencil = self->GetStencil();
-  bool reverseStencil = (self->GetReverseStencil() != 0);
-  bool ignoreZero = (self->GetIgnoreZero() != 0);
-
-  vtkImageStencilIterator<T> inIter(inData, stencil, updateExtent, self);
-
-  while (!inIter.IsAtEnd())
+  vtkImageAccumulateFunctor<T> functor;
+  functor.InData = inData;
+  functor.Stencil = self->GetStencil();
+  functor.UpdateExtent = updateExtent;
+  functor.NumC = numC;
+  functor.Size = size;
+  functor.ReverseStencil = (self->GetReverseStencil() != 0);
+  functor.IgnoreZero = (self->GetIgnoreZero() != 0);
+  functor.IntegerBinning = std::numeric_limits<T>::is_integer;
+  for (int c = 0; c < 3; ++c)
   {
-    if (inIter.IsInStencil() ^ reverseStencil)
+    functor.OutExtent[2 * c] = outExtent[2 * c];
+    functor.OutExtent[2 * c + 1] = outExtent[2 * c + 1];
+    functor.OutIncs[c] = outIncs[c];
+    functor.Origin[c] = origin[c];
+    functor.Spacing[c] = spacing[c];
+    functor.OriginInt[c] = static_cast<int>(origin[c]);
+    // The integer fast path requires the bin mapping to be a plain shift.
+    if (spacing[c] != 1.0 || origin[c] != std::floor(origin[c]))
     {
-      T* inPtr = inIter.BeginSpan();
-      T* spanEndPtr = inIter.EndSpan();
-
-      while (inPtr != spanEndPtr)
-      {
-        // find the bin for this pixel.
-        bool outOfBounds = false;
-        vtkIdType* outPtrC = outPtr;
-        for (int idxC = 0; idxC < numC; ++idxC)
-        {
-          double v = static_cast<double>(*inPtr++);
-          if (!ignoreZero || v != 0)
-          {
-            // gather statistics
-            sum[idxC] += v;
-            sumSqr[idxC] += v * v;
-            if (v > max[idxC])
-            {
-              max[idxC] = v;
-            }
-            if (v < min[idxC])
-            {
-              min[idxC] = v;
-            }
-            (*voxelCount)++;
-          }
-
-          // compute the index
-          int outIdx = vtkMath::Floor((v - origin[idxC]) / spacing[idxC]);
-
-          // verify that it is in range
-          if (outIdx >= outExtent[idxC * 2] && outIdx <= outExtent[idxC * 2 + 1])
-          {
-            outPtrC += (outIdx - outExtent[idxC * 2]) * outIncs[idxC];
-          }
-          else
-          {
-            outOfBounds = true;
-          }
-        }
-
-        // increment the bin
-        if (!outOfBounds)
-        {
-          ++(*outPtrC);
-        }
-      }
+      functor.IntegerBinning = false;
     }
-
-    inIter.NextSpan();
+    functor.Sum[c] = functor.SumSqr[c] = 0.0;
+  }
+  functor.OutPtr = outPtr;
+  functor.MinOut = min;
+  functor.MaxOut = max;
+  functor.VoxelCount = voxelCount;
+
+  // Distribute the rows of the update extent across threads, each thread
+  // binning into private histograms which are merged in Reduce().
+  functor.Dim1 = updateExtent[3] - updateExtent[2] + 1;
+  const vtkIdType numRows =
+    static_cast<vtkIdType>(functor.Dim1) * (updateExtent[5] - updateExtent[4] + 1);
+  if (updateExtent[1] >= updateExtent[0] && numRows > 0)
+  {
+    vtkSMPTools::For(0, numRows, functor);
   }
 
+  const double* sum = functor.Sum;
+  const double* sumSqr = functor.SumSqr;
+
   // initialize the statistics
   mean[0] = 0;
   mean[1] = 0;
@@ -53,13 +53,16 @@ POSSIBILITY OF SUCH DAMAGES.
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSignedCharArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -281,6 +284,15 @@ bool EdgeLocator::InterpolateEdge(vtkPoints* points, vtkPoints* outPoints, vtkId
 // Select contours within slice z
 void vtkPolyDataToImageStencil::PolyDataSelector(
   vtkPolyData* input, vtkPolyData* output, double z, double thickness)
+{
+  vtkNew<vtkIdList> scratch;
+  vtkPolyDataToImageStencil::PolyDataSelector(input, output, z, thickness, nullptr, 0, scratch);
+}
+
+//------------------------------------------------------------------------------
+// Select contours within slice z, restricted to the candidate cells
+void vtkPolyDataToImageStencil::PolyDataSelector(vtkPolyData* input, vtkPolyData* output, double z,
+  double thickness, const vtkIdType* cellIds, vtkIdType numCellIds, vtkIdList* scratch)
 {
   vtkPoints* points = input->GetPoints();
   vtkCellArray* lines = input->GetLines();
@@ -296,13 +308,14 @@ void vtkPolyDataToImageStencil::PolyDataSelector(
   // use a map to avoid adding duplicate points
   std::map<vtkIdType, vtkIdType> pointLocator;
 
-  vtkIdType numCells = lines->GetNumberOfCells();
-  for (vtkIdType cellId = 0; cellId < numCells; cellId++)
+  vtkIdType numCandidates = (cellIds ? numCellIds : lines->GetNumberOfCells());
+  for (vtkIdType candidate = 0; candidate < numCandidates; candidate++)
   {
+    vtkIdType cellId = (cellIds ? cellIds[candidate] : candidate);
     // check if all points in cell are within the slice
     vtkIdType npts;
     const vtkIdType* ptIds;
-    lines->GetCellAtId(cellId, npts, ptIds);
+    lines->GetCellAtId(cellId, npts, ptIds, scratch);
     vtkIdType i;
     for (i = 0; i < npts; i++)
     {
@@ -346,6 +359,14 @@ void vtkPolyDataToImageStencil::PolyDataSelector(
 
 //------------------------------------------------------------------------------
 void vtkPolyDataToImageStencil::PolyDataCutter(vtkPolyData* input, vtkPolyData* output, double z)
+{
+  vtkNew<vtkIdList> scratch;
+  vtkPolyDataToImageStencil::PolyDataCutter(input, output, z, nullptr, 0, scratch);
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyDataToImageStencil::PolyDataCutter(vtkPolyData* input, vtkPolyData* output, double z,
+  const vtkIdType* cellIds, vtkIdType numCellIds, vtkIdList* scratch)
 {
   vtkPoints* points = input->GetPoints();
   vtkCellArray* inputPolys = input->GetPolys();
@@ -359,25 +380,27 @@ void vtkPolyDataToImageStencil::PolyDataCutter(vtkPolyData* input, vtkPolyData*
   // An edge locator to avoid point duplication while clipping
   EdgeLocator edgeLocator;
 
-  // Go through all cells and clip them.
+  // Go through all candidate cells and clip them.
   vtkIdType numPolys = input->GetNumberOfPolys();
   vtkIdType numStrips = input->GetNumberOfStrips();
   vtkIdType numCells = numPolys + numStrips;
 
-  vtkIdType realCellId = 0;
-  vtkCellArray* cellArray = inputPolys;
-  for (vtkIdType cellId = 0; cellId < numCells; cellId++)
+  vtkIdType numCandidates = (cellIds ? numCellIds : numCells);
+  for (vtkIdType candidate = 0; candidate < numCandidates; candidate++)
   {
-    // switch to strips when polys are done
-    if (cellId == numPolys)
+    // polys are numbered before strips
+    vtkIdType cellId = (cellIds ? cellIds[candidate] : candidate);
+    vtkCellArray* cellArray = inputPolys;
+    vtkIdType realCellId = cellId;
+    if (cellId >= numPolys)
     {
       cellArray = inputStrips;
-      realCellId = 0;
+      realCellId = cellId - numPolys;
     }
 
     vtkIdType npts;
     const vtkIdType* ptIds;
-    cellArray->GetCellAtId(realCellId++, npts, ptIds);
+    cellArray->GetCellAtId(realCellId, npts, ptIds, scratch);
 
     vtkIdType numSubCells = 1;
     if (cellArray == inputStrips)
@@ -443,15 +466,17 @@ void vtkPolyDataToImageStencil::PolyDataCutter(vtkPolyData* input, vtkPolyData*
 
 //------------------------------------------------------------------------------
 void vtkPolyDataToImageStencil::ThreadedExecute(
-  vtkImageStencilData* data, int extent[6], int threadId)
+  vtkImageStencilData* data, int extent[6], int vtkNotUsed(threadId))
 {
   // Description of algorithm:
-  // 1) cut the polydata at each z slice to create polylines
-  // 2) find all "loose ends" and connect them to make polygons
+  // 1) bin the cells of the polydata by the z slices their z range touches
+  // 2) for each z slice (in parallel), cut the candidate cells to create
+  //    polylines
+  // 3) find all "loose ends" and connect them to make polygons
   //    (if the input polydata is closed, there will be no loose ends)
-  // 3) go through all line segments, and for each integer y value on
+  // 4) go through all line segments, and for each integer y value on
   //    a line segment, store the x value at that point in a bucket
-  // 4) for each z integer index, find all the stored x values
+  // 5) for each z integer index, find all the stored x values
   //    and use them to create one z slice of the vtkStencilData
 
   // the spacing and origin of the generated stencil
@@ -464,6 +489,100 @@ void vtkPolyDataToImageStencil::ThreadedExecute(
     return;
   }
 
+  // get the input data
+  vtkPolyData* input = this->GetInput();
+  vtkPoints* points = input->GetPoints();
+
+  bool useCutter = (input->GetNumberOfPolys() > 0 || input->GetNumberOfStrips() > 0);
+
+  // Bin the cells by the z slices their z range touches. The bins are
+  // built once and then shared read-only by all threads, so each slice
+  // only visits the cells that can actually contribute to it.
+  int numSlices = extent[5] - extent[4] + 1;
+  std::vector<std::vector<vtkIdType>> sliceCells(numSlices);
+
+  double invspacingZ = 1.0 / spacing[2];
+
+  // Overlap slack: the cutter needs the cells whose z range crosses the
+  // slice plane, while the selector needs the cells within half a slice
+  // thickness of it. The bins over-approximate; the exact per-point tests
+  // remain in the cutter and selector.
+  double slack = (useCutter ? 0.0 : 0.5 * spacing[2]);
+
+  auto binCell = [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* ptIds) {
+    double zmin = VTK_DOUBLE_MAX;
+    double zmax = -VTK_DOUBLE_MAX;
+    double point[3];
+    for (vtkIdType j = 0; j < npts; j++)
+    {
+      points->GetPoint(ptIds[j], point);
+      zmin = std::min(zmin, point[2]);
+      zmax = std::max(zmax, point[2]);
+    }
+    if (zmin > zmax)
+    {
+      return;
+    }
+    double t0 = (zmin - slack - origin[2]) * invspacingZ;
+    double t1 = (zmax + slack - origin[2]) * invspacingZ;
+    int idxLo = static_cast<int>(std::ceil(std::min(t0, t1)));
+    int idxHi = static_cast<int>(std::floor(std::max(t0, t1)));
+    idxLo = std::max(idxLo, extent[4]);
+    idxHi = std::min(idxHi, extent[5]);
+    for (int idxZ = idxLo; idxZ <= idxHi; idxZ++)
+    {
+      sliceCells[idxZ - extent[4]].push_back(cellId);
+    }
+  };
+
+  vtkNew<vtkIdList> scratch;
+  vtkIdType npts;
+  const vtkIdType* ptIds;
+  if (useCutter)
+  {
+    // polys are numbered before strips, matching PolyDataCutter()
+    vtkCellArray* polys = input->GetPolys();
+    vtkIdType numPolys = input->GetNumberOfPolys();
+    for (vtkIdType cellId = 0; cellId < numPolys; cellId++)
+    {
+      polys->GetCellAtId(cellId, npts, ptIds, scratch);
+      binCell(cellId, npts, ptIds);
+    }
+    vtkCellArray* strips = input->GetStrips();
+    vtkIdType numStrips = input->GetNumberOfStrips();
+    for (vtkIdType cellId = 0; cellId < numStrips; cellId++)
+    {
+      strips->GetCellAtId(cellId, npts, ptIds, scratch);
+      binCell(numPolys + cellId, npts, ptIds);
+    }
+  }
+  else
+  {
+    vtkCellArray* lines = input->GetLines();
+    vtkIdType numLines = lines->GetNumberOfCells();
+    for (vtkIdType cellId = 0; cellId < numLines; cellId++)
+    {
+      lines->GetCellAtId(cellId, npts, ptIds, scratch);
+      binCell(cellId, npts, ptIds);
+    }
+  }
+
+  // Rasterize the slices in parallel: each slice writes only its own z
+  // rows of the stencil, so the threads never touch the same memory.
+  vtkSMPTools::For(extent[4], extent[5] + 1, [&](vtkIdType zBegin, vtkIdType zEnd) {
+    this->ProcessSlices(
+      data, extent, static_cast<int>(zBegin), static_cast<int>(zEnd), useCutter, sliceCells);
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyDataToImageStencil::ProcessSlices(vtkImageStencilData* data, const int extent[6],
+  int zBegin, int zEnd, bool useCutter, const std::vector<std::vector<vtkIdType>>& sliceCells)
+{
+  // the spacing and origin of the generated stencil
+  double* spacing = data->GetSpacing();
+  double* origin = data->GetOrigin();
+
   // Only divide once
   double invspacing[3];
   invspacing[0] = 1.0 / spacing[0];
@@ -476,6 +595,9 @@ void vtkPolyDataToImageStencil::ThreadedExecute(
   // the output produced by cutting the polydata with the Z plane
   vtkPolyData* slice = vtkPolyData::New();
 
+  // a scratch id list to keep cell access thread safe
+  vtkNew<vtkIdList> scratch;
+
   // This raster stores all line segments by recording all "x"
   // positions on the surface for each y integer position.
   vtkImageStencilRaster raster(&extent[2]);
@@ -491,27 +613,30 @@ void vtkPolyDataToImageStencil::ThreadedExecute(
   sliceExtent[5] = extent[4];
 
   // Loop through the slices
-  for (int idxZ = extent[4]; idxZ <= extent[5]; idxZ++)
+  for (int idxZ = zBegin; idxZ < zEnd; idxZ++)
   {
-    if (threadId == 0)
+    double z = idxZ * spacing[2] + origin[2];
+
+    const std::vector<vtkIdType>& candidates = sliceCells[idxZ - extent[4]];
+    if (candidates.empty())
     {
-      this->UpdateProgress((idxZ - extent[4]) * 1.0 / (extent[5] - extent[4] + 1));
+      continue;
     }
 
-    double z = idxZ * spacing[2] + origin[2];
-
     slice->PrepareForNewData();
     raster.PrepareForNewData();
 
-    // Step 1: Cut the data into slices
-    if (input->GetNumberOfPolys() > 0 || input->GetNumberOfStrips() > 0)
+    // Step 1: Cut the candidate cells into slices
+    if (useCutter)
     {
-      this->PolyDataCutter(input, slice, z);
+      vtkPolyDataToImageStencil::PolyDataCutter(input, slice, z, candidates.data(),
+        static_cast<vtkIdType>(candidates.size()), scratch);
     }
     else
     {
       // if no polys, select polylines instead
-      this->PolyDataSelector(input, slice, z, spacing[2]);
+      vtkPolyDataToImageStencil::PolyDataSelector(input, slice, z, spacing[2], candidates.data(),
+        static_cast<vtkIdType>(candidates.size()), scratch);
     }
 
     if (!slice->GetNumberOfLines())
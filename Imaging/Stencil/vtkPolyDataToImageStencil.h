@@ -65,6 +65,9 @@ POSSIBILITY OF SUCH DAMAGES.
 #include "vtkImageStencilSource.h"
 #include "vtkImagingStencilModule.h" // For export macro
 
+#include <vector> // For the per-slice cell cache
+
+class vtkIdList;
 class vtkMergePoints;
 class vtkDataSet;
 class vtkPolyData;
@@ -106,6 +109,20 @@ protected:
 
   static void PolyDataSelector(vtkPolyData* input, vtkPolyData* output, double z, double thickness);
 
+  ///@{
+  /**
+   * Variants of PolyDataCutter() and PolyDataSelector() that only visit the
+   * given candidate cells (global cell indices, with polys numbered before
+   * strips for the cutter). Cell access goes through the supplied scratch
+   * id list, so these may be called concurrently on the same input from
+   * multiple threads.
+   */
+  static void PolyDataCutter(vtkPolyData* input, vtkPolyData* output, double z,
+    const vtkIdType* cellIds, vtkIdType numCellIds, vtkIdList* scratch);
+  static void PolyDataSelector(vtkPolyData* input, vtkPolyData* output, double z, double thickness,
+    const vtkIdType* cellIds, vtkIdType numCellIds, vtkIdList* scratch);
+  ///@}
+
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
   int FillInputPortInformation(int, vtkInformation*) override;
@@ -116,6 +133,14 @@ protected:
   double Tolerance;
 
 private:
+  /**
+   * Rasterize the given range of z slices into the stencil. Used by the
+   * parallel loop in ThreadedExecute(). Each slice writes only its own z
+   * rows of the stencil, so distinct ranges may be processed concurrently.
+   */
+  void ProcessSlices(vtkImageStencilData* data, const int extent[6], int zBegin, int zEnd,
+    bool useCutter, const std::vector<std::vector<vtkIdType>>& sliceCells);
+
   vtkPolyDataToImageStencil(const vtkPolyDataToImageStencil&) = delete;
   void operator=(const vtkPolyDataToImageStencil&) = delete;
 };
@@ -32,9 +32,13 @@
 #include "vtkOutEdgeIterator.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTree.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkForceDirectedLayoutStrategy);
 
 vtkForceDirectedLayoutStrategy::vtkForceDirectedLayoutStrategy()
@@ -200,39 +204,106 @@ void vtkForceDirectedLayoutStrategy::Layout()
   vtkIdType numVertices = this->Graph->GetNumberOfVertices();
   vtkIdType numEdges = this->Graph->GetNumberOfEdges();
 
+  // The repulsive force is truncated to zero beyond 2 * optDist, so only
+  // vertex pairs within that radius can interact.  Bin the vertices into a
+  // uniform grid whose cells are at least the cutoff radius in size; each
+  // vertex then only tests the vertices in its own and the adjacent bins
+  // instead of every other vertex.  The contributing pairs are exactly those
+  // of the brute-force loop, only the order of accumulation differs.
+  const double cutoff = 2.0 * this->optDist;
+  const int maxDim = this->ThreeDimensionalLayout ? 64 : 512;
+  std::vector<vtkIdType> binHead;
+  std::vector<vtkIdType> binNext(numVertices);
+  std::vector<vtkIdType> binOfVertex(numVertices);
+  int dims[3];
+  double binOrigin[3], binSize[3];
+
   // Begin iterations.
-  double norm, fr, fa, minimum;
+  double norm, fa, minimum;
   double diff[3];
   for (int i = 0; i < this->IterationsPerLayout; i++)
   {
-    // Calculate the repulsive forces.
+    // Bin the vertices on their current positions.
+    double bds[6] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX,
+      VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    for (vtkIdType j = 0; j < numVertices; j++)
+    {
+      for (int a = 0; a < 3; a++)
+      {
+        bds[2 * a] = std::min(bds[2 * a], v[j].x[a]);
+        bds[2 * a + 1] = std::max(bds[2 * a + 1], v[j].x[a]);
+      }
+    }
+    for (int a = 0; a < 3; a++)
+    {
+      double len = bds[2 * a + 1] - bds[2 * a];
+      // capping the number of bins per axis only makes the bins larger than
+      // the cutoff, which keeps the one-ring neighbor search sufficient
+      dims[a] = (cutoff > 0.0 && len > cutoff)
+        ? std::min(maxDim, static_cast<int>(len / cutoff))
+        : 1;
+      binOrigin[a] = bds[2 * a];
+      binSize[a] = (dims[a] > 1) ? (len / dims[a]) : 1.0;
+    }
+    binHead.assign(static_cast<size_t>(dims[0]) * dims[1] * dims[2], -1);
     for (vtkIdType j = 0; j < numVertices; j++)
     {
-      v[j].d[0] = 0.0;
-      v[j].d[1] = 0.0;
-      v[j].d[2] = 0.0;
-      for (vtkIdType l = 0; l < numVertices; l++)
+      vtkIdType b = 0;
+      for (int a = 2; a >= 0; a--)
       {
-        if (j != l)
+        int idx = static_cast<int>((v[j].x[a] - binOrigin[a]) / binSize[a]);
+        idx = std::min(dims[a] - 1, std::max(0, idx));
+        b = b * dims[a] + idx;
+      }
+      binOfVertex[j] = b;
+      binNext[j] = binHead[b];
+      binHead[b] = j;
+    }
+
+    // Calculate the repulsive forces.
+    vtkSMPTools::For(0, numVertices, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType j = begin; j < end; j++)
+      {
+        v[j].d[0] = 0.0;
+        v[j].d[1] = 0.0;
+        v[j].d[2] = 0.0;
+        const vtkIdType b = binOfVertex[j];
+        const int bx = static_cast<int>(b % dims[0]);
+        const int by = static_cast<int>((b / dims[0]) % dims[1]);
+        const int bz = static_cast<int>(b / (static_cast<vtkIdType>(dims[0]) * dims[1]));
+        for (int nz = std::max(0, bz - 1); nz <= std::min(dims[2] - 1, bz + 1); nz++)
         {
-          diff[0] = v[j].x[0] - v[l].x[0];
-          diff[1] = v[j].x[1] - v[l].x[1];
-          diff[2] = v[j].x[2] - v[l].x[2];
-          norm = vtkMath::Normalize(diff);
-          if (norm > 2 * optDist)
-          {
-            fr = 0;
-          }
-          else
+          for (int ny = std::max(0, by - 1); ny <= std::min(dims[1] - 1, by + 1); ny++)
           {
-            fr = forceRepulse(norm, optDist);
+            for (int nx = std::max(0, bx - 1); nx <= std::min(dims[0] - 1, bx + 1); nx++)
+            {
+              const vtkIdType nb = (static_cast<vtkIdType>(nz) * dims[1] + ny) * dims[0] + nx;
+              for (vtkIdType l = binHead[nb]; l != -1; l = binNext[l])
+              {
+                if (j != l)
+                {
+                  double d[3] = { v[j].x[0] - v[l].x[0], v[j].x[1] - v[l].x[1],
+                    v[j].x[2] - v[l].x[2] };
+                  double dist = vtkMath::Normalize(d);
+                  double fr;
+                  if (dist > cutoff)
+                  {
+                    fr = 0;
+                  }
+                  else
+                  {
+                    fr = forceRepulse(dist, optDist);
+                  }
+                  v[j].d[0] += d[0] * fr;
+                  v[j].d[1] += d[1] * fr;
+                  v[j].d[2] += d[2] * fr;
+                }
+              }
+            }
           }
-          v[j].d[0] += diff[0] * fr;
-          v[j].d[1] += diff[1] * fr;
-          v[j].d[2] += diff[2] * fr;
         }
       }
-    }
+    });
 
     // Calculate the attractive forces.
     for (vtkIdType j = 0; j < numEdges; j++)
@@ -15,6 +15,8 @@
 #include "vtkCommunicator.h"
 
 #include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObjectTypes.h"
@@ -31,10 +33,14 @@
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
 #include "vtkStructuredPoints.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkTable.h"
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
@@ -209,9 +215,24 @@ int vtkCommunicator::Send(vtkDataObject* data, int remoteHandle, int tag)
   }
 }
 
+// Markers exchanged ahead of an elemental data object so that both ends agree
+// on the protocol used for the payload.
+#define VTK_COMMUNICATOR_MARSHALED_PROTOCOL 0
+#define VTK_COMMUNICATOR_DIRECT_PROTOCOL 1
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  if (vtkCommunicator::CanSendDataObjectDirect(data))
+  {
+    int protocol = VTK_COMMUNICATOR_DIRECT_PROTOCOL;
+    this->Send(&protocol, 1, remoteHandle, tag);
+    return this->SendDataObjectDirect(data, remoteHandle, tag);
+  }
+
+  int protocol = VTK_COMMUNICATOR_MARSHALED_PROTOCOL;
+  this->Send(&protocol, 1, remoteHandle, tag);
+
   VTK_CREATE(vtkCharArray, buffer);
   if (vtkCommunicator::MarshalDataObject(data, buffer))
   {
@@ -222,6 +243,290 @@ int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHand
   return 0;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCommunicator::CanSendDataObjectDirect(vtkDataObject* data)
+{
+  int type = data ? data->GetDataObjectType() : -1;
+  if (type != VTK_POLY_DATA && type != VTK_UNSTRUCTURED_GRID)
+  {
+    return false;
+  }
+  if (type == VTK_UNSTRUCTURED_GRID)
+  {
+    // polyhedral cells carry an extra face stream; keep them on the
+    // marshaled path
+    vtkUnstructuredGrid* ug = static_cast<vtkUnstructuredGrid*>(data);
+    if (ug->GetFaces() && ug->GetFaceLocations())
+    {
+      return false;
+    }
+  }
+
+  // all attributes must be numeric arrays so their buffers can be shipped
+  // directly
+  vtkDataSet* ds = static_cast<vtkDataSet*>(data);
+  vtkFieldData* fds[3] = { ds->GetPointData(), ds->GetCellData(), ds->GetFieldData() };
+  for (vtkFieldData* fd : fds)
+  {
+    for (int i = 0; i < fd->GetNumberOfArrays(); ++i)
+    {
+      if (!vtkDataArray::SafeDownCast(fd->GetAbstractArray(i)))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendDataArrayDirect(vtkDataArray* array, int remoteHandle, int tag)
+{
+  // type, number of components, name length; the tuple count needs the wider
+  // vtkIdType and goes separately
+  int header[3];
+  header[0] = array ? array->GetDataType() : -1;
+  header[1] = array ? array->GetNumberOfComponents() : 0;
+  const char* name = array ? array->GetName() : nullptr;
+  header[2] = name ? static_cast<int>(strlen(name)) + 1 : 0;
+  this->Send(header, 3, remoteHandle, tag);
+  if (!array)
+  {
+    return 1;
+  }
+
+  vtkIdType numTuples = array->GetNumberOfTuples();
+  this->Send(&numTuples, 1, remoteHandle, tag);
+
+  if (header[2] > 0)
+  {
+    this->Send(name, header[2], remoteHandle, tag);
+  }
+
+  vtkIdType size = numTuples * header[1];
+  if (size > 0)
+  {
+    return this->SendVoidArray(array->GetVoidPointer(0), size, header[0], remoteHandle, tag);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkCommunicator::ReceiveDataArrayDirect(int remoteHandle, int tag)
+{
+  int header[3];
+  if (!this->Receive(header, 3, remoteHandle, tag))
+  {
+    return nullptr;
+  }
+  if (header[0] == -1)
+  {
+    return nullptr;
+  }
+
+  vtkIdType numTuples;
+  this->Receive(&numTuples, 1, remoteHandle, tag);
+
+  vtkSmartPointer<vtkDataArray> array;
+  array.TakeReference(vtkDataArray::CreateDataArray(header[0]));
+  array->SetNumberOfComponents(header[1]);
+
+  if (header[2] > 0)
+  {
+    std::vector<char> name(header[2]);
+    this->Receive(name.data(), header[2], remoteHandle, tag);
+    array->SetName(name.data());
+  }
+
+  array->SetNumberOfTuples(numTuples);
+  vtkIdType size = numTuples * header[1];
+  if (size > 0 &&
+    !this->ReceiveVoidArray(array->GetVoidPointer(0), size, header[0], remoteHandle, tag))
+  {
+    return nullptr;
+  }
+  return array;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendFieldDataDirect(
+  vtkFieldData* fd, vtkDataSetAttributes* dsa, int remoteHandle, int tag)
+{
+  int numArrays = fd->GetNumberOfArrays();
+  this->Send(&numArrays, 1, remoteHandle, tag);
+  for (int i = 0; i < numArrays; ++i)
+  {
+    int attributeType = dsa ? dsa->IsArrayAnAttribute(i) : -1;
+    this->Send(&attributeType, 1, remoteHandle, tag);
+    if (!this->SendDataArrayDirect(fd->GetArray(i), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::ReceiveFieldDataDirect(
+  vtkFieldData* fd, vtkDataSetAttributes* dsa, int remoteHandle, int tag)
+{
+  int numArrays;
+  if (!this->Receive(&numArrays, 1, remoteHandle, tag))
+  {
+    return 0;
+  }
+  for (int i = 0; i < numArrays; ++i)
+  {
+    int attributeType;
+    this->Receive(&attributeType, 1, remoteHandle, tag);
+    vtkSmartPointer<vtkDataArray> array = this->ReceiveDataArrayDirect(remoteHandle, tag);
+    if (!array)
+    {
+      return 0;
+    }
+    int index = fd->AddArray(array);
+    if (dsa && attributeType >= 0)
+    {
+      dsa->SetActiveAttribute(index, attributeType);
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendCellArrayDirect(vtkCellArray* cells, int remoteHandle, int tag)
+{
+  int hasCells = cells ? 1 : 0;
+  this->Send(&hasCells, 1, remoteHandle, tag);
+  if (!hasCells)
+  {
+    return 1;
+  }
+  return this->SendDataArrayDirect(cells->GetOffsetsArray(), remoteHandle, tag) &&
+    this->SendDataArrayDirect(cells->GetConnectivityArray(), remoteHandle, tag);
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> vtkCommunicator::ReceiveCellArrayDirect(int remoteHandle, int tag)
+{
+  int hasCells;
+  if (!this->Receive(&hasCells, 1, remoteHandle, tag) || !hasCells)
+  {
+    return nullptr;
+  }
+  vtkSmartPointer<vtkDataArray> offsets = this->ReceiveDataArrayDirect(remoteHandle, tag);
+  vtkSmartPointer<vtkDataArray> connectivity = this->ReceiveDataArrayDirect(remoteHandle, tag);
+  if (!offsets || !connectivity)
+  {
+    return nullptr;
+  }
+  vtkSmartPointer<vtkCellArray> cells = vtkSmartPointer<vtkCellArray>::New();
+  if (!cells->SetData(offsets, connectivity))
+  {
+    return nullptr;
+  }
+  return cells;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendDataObjectDirect(vtkDataObject* data, int remoteHandle, int tag)
+{
+  // Mirror the ANY_SOURCE handling of Send(vtkDataArray): send the actual
+  // source and a mangled tag first so that the messages that follow are
+  // guaranteed to be matched in order.
+  static int tagMangler = 1000;
+  int mangledTag = tag + tagMangler++;
+  int header[2];
+  header[0] = this->LocalProcessId;
+  header[1] = mangledTag;
+  this->Send(header, 2, remoteHandle, tag);
+  tag = mangledTag;
+
+  vtkPointSet* ps = static_cast<vtkPointSet*>(data);
+
+  int hasPoints = ps->GetPoints() ? 1 : 0;
+  this->Send(&hasPoints, 1, remoteHandle, tag);
+  if (hasPoints && !this->SendDataArrayDirect(ps->GetPoints()->GetData(), remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  if (vtkPolyData* pd = vtkPolyData::SafeDownCast(data))
+  {
+    if (!this->SendCellArrayDirect(pd->GetVerts(), remoteHandle, tag) ||
+      !this->SendCellArrayDirect(pd->GetLines(), remoteHandle, tag) ||
+      !this->SendCellArrayDirect(pd->GetPolys(), remoteHandle, tag) ||
+      !this->SendCellArrayDirect(pd->GetStrips(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  else if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(data))
+  {
+    if (!this->SendCellArrayDirect(ug->GetCells(), remoteHandle, tag) ||
+      !this->SendDataArrayDirect(ug->GetCellTypesArray(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+
+  vtkDataSet* ds = static_cast<vtkDataSet*>(data);
+  return this->SendFieldDataDirect(ds->GetPointData(), ds->GetPointData(), remoteHandle, tag) &&
+    this->SendFieldDataDirect(ds->GetCellData(), ds->GetCellData(), remoteHandle, tag) &&
+    this->SendFieldDataDirect(ds->GetFieldData(), nullptr, remoteHandle, tag);
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::ReceiveDataObjectDirect(vtkDataObject* data, int remoteHandle, int tag)
+{
+  int header[2];
+  this->Receive(header, 2, remoteHandle, tag);
+  if (remoteHandle == vtkMultiProcessController::ANY_SOURCE)
+  {
+    remoteHandle = header[0];
+  }
+  tag = header[1];
+
+  data->Initialize();
+  vtkPointSet* ps = static_cast<vtkPointSet*>(data);
+
+  int hasPoints;
+  this->Receive(&hasPoints, 1, remoteHandle, tag);
+  if (hasPoints)
+  {
+    vtkSmartPointer<vtkDataArray> pointArray = this->ReceiveDataArrayDirect(remoteHandle, tag);
+    if (!pointArray)
+    {
+      return 0;
+    }
+    vtkNew<vtkPoints> points;
+    points->SetData(pointArray);
+    ps->SetPoints(points);
+  }
+
+  if (vtkPolyData* pd = vtkPolyData::SafeDownCast(data))
+  {
+    pd->SetVerts(this->ReceiveCellArrayDirect(remoteHandle, tag));
+    pd->SetLines(this->ReceiveCellArrayDirect(remoteHandle, tag));
+    pd->SetPolys(this->ReceiveCellArrayDirect(remoteHandle, tag));
+    pd->SetStrips(this->ReceiveCellArrayDirect(remoteHandle, tag));
+  }
+  else if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(data))
+  {
+    vtkSmartPointer<vtkCellArray> cells = this->ReceiveCellArrayDirect(remoteHandle, tag);
+    vtkSmartPointer<vtkDataArray> cellTypes = this->ReceiveDataArrayDirect(remoteHandle, tag);
+    if (cells && vtkUnsignedCharArray::SafeDownCast(cellTypes))
+    {
+      ug->SetCells(vtkUnsignedCharArray::SafeDownCast(cellTypes), cells);
+    }
+  }
+
+  vtkDataSet* ds = static_cast<vtkDataSet*>(data);
+  return this->ReceiveFieldDataDirect(ds->GetPointData(), ds->GetPointData(), remoteHandle, tag) &&
+    this->ReceiveFieldDataDirect(ds->GetCellData(), ds->GetCellData(), remoteHandle, tag) &&
+    this->ReceiveFieldDataDirect(ds->GetFieldData(), nullptr, remoteHandle, tag);
+}
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::Send(vtkDataArray* data, int remoteHandle, int tag)
 {
@@ -407,6 +712,17 @@ int vtkCommunicator::ReceiveDataObject(vtkDataObject* data, int remoteHandle, in
 //------------------------------------------------------------------------------
 int vtkCommunicator::ReceiveElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  int protocol;
+  if (!this->Receive(&protocol, 1, remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  if (protocol == VTK_COMMUNICATOR_DIRECT_PROTOCOL)
+  {
+    return this->ReceiveDataObjectDirect(data, remoteHandle, tag);
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (!this->Receive(buffer, remoteHandle, tag))
   {
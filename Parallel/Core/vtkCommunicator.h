@@ -38,8 +38,11 @@
 #include <vector>                  // needed for std::vector
 
 class vtkBoundingBox;
+class vtkCellArray;
 class vtkCharArray;
 class vtkDataArray;
+class vtkDataSetAttributes;
+class vtkFieldData;
 class vtkDataObject;
 class vtkDataSet;
 class vtkIdTypeArray;
@@ -1302,6 +1305,29 @@ protected:
 
   // Internal methods called by Send/Receive(vtkDataObject *... ) above.
   int SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag);
+
+  ///@{
+  /**
+   * Direct binary protocol for elemental data objects. Instead of marshaling
+   * through the legacy writer, which copies every array into an intermediate
+   * string, the raw vtkDataArray buffers of the points, the connectivity and
+   * the attributes are shipped one after the other with a compact header
+   * each. This path is used for vtkPolyData and vtkUnstructuredGrid whenever
+   * all of their arrays are numeric; other inputs fall back to the marshaled
+   * protocol. Sender and receiver agree on the chosen protocol through a
+   * marker exchanged ahead of the payload.
+   */
+  static bool CanSendDataObjectDirect(vtkDataObject* data);
+  int SendDataObjectDirect(vtkDataObject* data, int remoteHandle, int tag);
+  int ReceiveDataObjectDirect(vtkDataObject* data, int remoteHandle, int tag);
+  int SendDataArrayDirect(vtkDataArray* array, int remoteHandle, int tag);
+  vtkSmartPointer<vtkDataArray> ReceiveDataArrayDirect(int remoteHandle, int tag);
+  int SendFieldDataDirect(vtkFieldData* fd, vtkDataSetAttributes* dsa, int remoteHandle, int tag);
+  int ReceiveFieldDataDirect(
+    vtkFieldData* fd, vtkDataSetAttributes* dsa, int remoteHandle, int tag);
+  int SendCellArrayDirect(vtkCellArray* cells, int remoteHandle, int tag);
+  vtkSmartPointer<vtkCellArray> ReceiveCellArrayDirect(int remoteHandle, int tag);
+  ///@}
   ///@{
   /**
    * GatherV collects arrays in the process with id \c destProcessId.
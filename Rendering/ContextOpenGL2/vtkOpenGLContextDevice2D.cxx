@@ -778,22 +778,24 @@ void vtkOpenGLContextDevice2D::DrawPoly(float* f, int n, unsigned char* colors,
   this->SetMatrices(cbo->Program);
 
   // for line stipple we need to compute the scaled
-  // cumulative linear distance
+  // cumulative linear distance. A solid pen ignores the distances in the
+  // shader, so skip the per-vertex square roots and leave them zeroed.
   double* scale = this->ModelMatrix->GetScale();
-  std::vector<float> distances;
-  distances.resize(n * 2);
-  float totDist = 0.0;
-  distances[0] = 0.0;
-  for (int i = 1; i < n; i++)
-  {
-    float xDel = scale[0] * (f[i * 2] - f[i * 2 - 2]);
-    float yDel = scale[1] * (f[i * 2 + 1] - f[i * 2 - 1]);
-    // discarding infinite coordinates
-    totDist += (std::abs(yDel) != std::numeric_limits<float>::infinity() &&
-                 std::abs(xDel) != std::numeric_limits<float>::infinity())
-      ? sqrt(xDel * xDel + yDel * yDel)
-      : 0;
-    distances[i * 2] = totDist;
+  std::vector<float> distances(n * 2, 0.f);
+  if (this->LinePattern != 0xFFFF)
+  {
+    float totDist = 0.0;
+    for (int i = 1; i < n; i++)
+    {
+      float xDel = scale[0] * (f[i * 2] - f[i * 2 - 2]);
+      float yDel = scale[1] * (f[i * 2 + 1] - f[i * 2 - 1]);
+      // discarding infinite coordinates
+      totDist += (std::abs(yDel) != std::numeric_limits<float>::infinity() &&
+                   std::abs(xDel) != std::numeric_limits<float>::infinity())
+        ? sqrt(xDel * xDel + yDel * yDel)
+        : 0;
+      distances[i * 2] = totDist;
+    }
   }
 
   // For GL2PS captures, use the path that draws lines instead of triangles --
@@ -807,7 +809,12 @@ void vtkOpenGLContextDevice2D::DrawPoly(float* f, int n, unsigned char* colors,
     // OpenGL no longer supports wide lines directly
     float hwidth = this->Pen->GetWidth() / 2.0;
     std::vector<float> newVerts;
+    newVerts.reserve((n - 1) * 12);
     std::vector<unsigned char> newColors;
+    if (colors)
+    {
+      newColors.reserve((n - 1) * 6 * nc);
+    }
     std::vector<float> newDistances;
     newDistances.resize((n - 1) * 12);
     for (int i = 0; i < n - 1; i++)
@@ -925,18 +932,20 @@ void vtkOpenGLContextDevice2D::DrawLines(float* f, int n, unsigned char* colors,
   this->SetMatrices(cbo->Program);
 
   // for line stipple we need to compute the scaled
-  // cumulative linear distance
+  // cumulative linear distance. A solid pen ignores the distances in the
+  // shader, so skip the per-vertex square roots and leave them zeroed.
   double* scale = this->ModelMatrix->GetScale();
-  std::vector<float> distances;
-  distances.resize(n * 2);
-  float totDist = 0.0;
-  distances[0] = 0.0;
-  for (int i = 1; i < n; i++)
+  std::vector<float> distances(n * 2, 0.f);
+  if (this->LinePattern != 0xFFFF)
   {
-    float xDel = scale[0] * (f[i * 2] - f[i * 2 - 2]);
-    float yDel = scale[1] * (f[i * 2 + 1] - f[i * 2 - 1]);
-    totDist += sqrt(xDel * xDel + yDel * yDel);
-    distances[i * 2] = totDist;
+    float totDist = 0.0;
+    for (int i = 1; i < n; i++)
+    {
+      float xDel = scale[0] * (f[i * 2] - f[i * 2 - 2]);
+      float yDel = scale[1] * (f[i * 2 + 1] - f[i * 2 - 1]);
+      totDist += sqrt(xDel * xDel + yDel * yDel);
+      distances[i * 2] = totDist;
+    }
   }
 
   if (this->Pen->GetWidth() > 1.0)
@@ -945,7 +954,12 @@ void vtkOpenGLContextDevice2D::DrawLines(float* f, int n, unsigned char* colors,
     // OpenGL no longer supports wide lines directly
     float hwidth = this->Pen->GetWidth() / 2.0;
     std::vector<float> newVerts;
+    newVerts.reserve((n / 2) * 12);
     std::vector<unsigned char> newColors;
+    if (colors)
+    {
+      newColors.reserve((n / 2) * 6 * nc);
+    }
     std::vector<float> newDistances;
     newDistances.resize((n / 2) * 12);
     for (int i = 0; i < n - 1; i += 2)
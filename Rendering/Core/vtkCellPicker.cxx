@@ -40,6 +40,7 @@
 #include "vtkPoints.h"
 #include "vtkPolygon.h"
 #include "vtkRenderer.h"
+#include "vtkStaticCellLocator.h"
 #include "vtkTexture.h"
 #include "vtkTransform.h"
 #include "vtkUniformHyperTreeGrid.h"
@@ -56,6 +57,7 @@ vtkCellPicker::vtkCellPicker()
 {
   // List of locators for accelerating polydata picking
   this->Locators = vtkCollection::New();
+  this->UseCachedCellLocators = 0;
 
   // For polydata picking
   this->Cell = vtkGenericCell::New();
@@ -108,6 +110,9 @@ void vtkCellPicker::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "PickTextureData: " << (this->PickTextureData ? "On" : "Off") << "\n";
 
+  os << indent << "UseCachedCellLocators: " << (this->UseCachedCellLocators ? "On" : "Off")
+     << "\n";
+
   os << indent << "PointId: " << this->PointId << "\n";
   os << indent << "CellId: " << this->CellId << "\n";
   os << indent << "SubId: " << this->SubId << "\n";
@@ -200,6 +205,7 @@ void vtkCellPicker::RemoveLocator(vtkAbstractCellLocator* locator)
 void vtkCellPicker::RemoveAllLocators()
 {
   this->Locators->RemoveAllItems();
+  this->CachedLocators.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -640,6 +646,22 @@ bool vtkCellPicker::IntersectDataSetWithLine(vtkDataSet* dataSet, const double p
     }
   }
 
+  // If no user-supplied locator was found, lazily build and cache one so
+  // that repeated picks on the same data set skip the exhaustive search.
+  if (locator == nullptr && this->UseCachedCellLocators)
+  {
+    std::pair<vtkMTimeType, vtkSmartPointer<vtkAbstractCellLocator>>& entry =
+      this->CachedLocators[dataSet];
+    if (entry.second == nullptr || entry.first < dataSet->GetMTime())
+    {
+      entry.second = vtkSmartPointer<vtkStaticCellLocator>::New();
+      entry.second->SetDataSet(dataSet);
+      entry.second->BuildLocator();
+      entry.first = dataSet->GetMTime();
+    }
+    locator = entry.second;
+  }
+
   if (locator)
   {
     double t = tMin;
@@ -43,6 +43,9 @@
 
 #include "vtkPicker.h"
 #include "vtkRenderingCoreModule.h" // For export macro
+#include "vtkSmartPointer.h"        // For the locator cache
+
+#include <map> // For the locator cache
 
 class vtkMapper;
 class vtkTexture;
@@ -102,10 +105,27 @@ public:
   void RemoveLocator(vtkAbstractCellLocator* locator);
 
   /**
-   * Remove all locators associated with this picker.
+   * Remove all locators associated with this picker.  This also discards
+   * any locators that were built automatically by the picker, see
+   * UseCachedCellLocators.
    */
   void RemoveAllLocators();
 
+  ///@{
+  /**
+   * Automatically build and cache a vtkStaticCellLocator for any data set
+   * that is picked without a user-supplied locator.  The cached locator is
+   * keyed on the data set and is rebuilt only when the data set is modified,
+   * so repeated picks on a large, static mesh (e.g. continuous hover
+   * probing) skip the exhaustive cell traversal after the first pick.  This
+   * is off by default because the locator path can resolve ties between
+   * coincident cells differently than the exhaustive search.
+   */
+  vtkSetMacro(UseCachedCellLocators, vtkTypeBool);
+  vtkGetMacro(UseCachedCellLocators, vtkTypeBool);
+  vtkBooleanMacro(UseCachedCellLocators, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set the opacity isovalue to use for defining volume surfaces.  The
@@ -313,6 +333,9 @@ protected:
     vtkPiecewiseFunction* gradientOpacity);
 
   vtkCollection* Locators;
+  vtkTypeBool UseCachedCellLocators;
+  std::map<vtkDataSet*, std::pair<vtkMTimeType, vtkSmartPointer<vtkAbstractCellLocator>>>
+    CachedLocators;
 
   double VolumeOpacityIsovalue;
   vtkTypeBool UseVolumeGradientOpacity;
@@ -18,6 +18,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <cmath>
@@ -1621,6 +1622,61 @@ static void vtkColorTransferFunctionMapData(vtkColorTransferFunction* self, unsi
   }
 }
 
+//------------------------------------------------------------------------------
+// Number of output bytes written per mapped value.
+static int vtkColorTransferFunctionOutputFormatSize(int outFormat)
+{
+  switch (outFormat)
+  {
+    case VTK_RGBA:
+      return 4;
+    case VTK_RGB:
+      return 3;
+    case VTK_LUMINANCE_ALPHA:
+      return 2;
+    default: // VTK_LUMINANCE
+      return 1;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Map large batches of real-typed scalars in parallel. Color evaluation
+// through GetColor() only reads the node list, so independent spans can be
+// mapped concurrently, each writing a disjoint part of the output.
+template <class T>
+void vtkColorTransferFunctionMapDataThreaded(vtkColorTransferFunction* self, T* input,
+  unsigned char* output, int length, int inIncr, int outFormat, long tag)
+{
+  constexpr int VTK_SMP_THRESHOLD = 200000;
+  if (length < VTK_SMP_THRESHOLD)
+  {
+    vtkColorTransferFunctionMapData(self, input, output, length, inIncr, outFormat, tag);
+    return;
+  }
+
+  const int outIncr = vtkColorTransferFunctionOutputFormatSize(outFormat);
+  vtkSMPTools::For(0, length, [&](vtkIdType begin, vtkIdType end) {
+    vtkColorTransferFunctionMapData(self, input + begin * inIncr, output + begin * outIncr,
+      static_cast<int>(end - begin), inIncr, outFormat, tag);
+  });
+}
+
+//------------------------------------------------------------------------------
+// The unsigned char and unsigned short inputs already map through a flat
+// table snapshot cached per MTime; keep their specializations.
+static void vtkColorTransferFunctionMapDataThreaded(vtkColorTransferFunction* self,
+  unsigned char* input, unsigned char* output, int length, int inIncr, int outFormat, int tag)
+{
+  vtkColorTransferFunctionMapData(self, input, output, length, inIncr, outFormat, tag);
+}
+
+//------------------------------------------------------------------------------
+static void vtkColorTransferFunctionMapDataThreaded(vtkColorTransferFunction* self,
+  unsigned short* input, unsigned char* output, int length, int inIncr, int outFormat, int tag)
+{
+  vtkColorTransferFunctionMapData(self, input, output, length, inIncr, outFormat, tag);
+}
+
 //------------------------------------------------------------------------------
 template <class T>
 void vtkColorTransferFunctionIndexedMapData(vtkColorTransferFunction* self, T* input,
@@ -1809,8 +1865,8 @@ void vtkColorTransferFunction::MapScalarsThroughTable2(void* input, unsigned cha
   {
     switch (inputDataType)
     {
-      vtkTemplateMacro(vtkColorTransferFunctionMapData(this, static_cast<VTK_TT*>(input), output,
-        numberOfValues, inputIncrement, outputFormat, 1));
+      vtkTemplateMacro(vtkColorTransferFunctionMapDataThreaded(this, static_cast<VTK_TT*>(input),
+        output, numberOfValues, inputIncrement, outputFormat, 1));
       default:
         vtkErrorMacro(<< "MapImageThroughTable: Unknown input ScalarType");
         return;
@@ -82,6 +82,8 @@ vtkGraphMapper::vtkGraphMapper()
   this->EdgeLineWidth = 1;
   this->ScaledGlyphs = false;
   this->ScalingArrayName = nullptr;
+  this->ConvertedInput = nullptr;
+  this->ConvertedInputTime = 0;
 
   this->VertexMapper->SetScalarModeToUsePointData();
   this->VertexMapper->SetLookupTable(this->VertexLookupTable);
@@ -465,20 +467,28 @@ void vtkGraphMapper::Render(vtkRenderer* ren, vtkActor* vtkNotUsed(act))
     vtkErrorMacro(<< "Input is not a graph!\n");
     return;
   }
-  vtkGraph* graph = nullptr;
-  if (vtkDirectedGraph::SafeDownCast(input))
+  // Only shallow copy and reconvert the graph when it has been modified.
+  // Handing a fresh copy to the converters on every render would force them
+  // (and the mappers downstream of them) to re-execute on unchanged input.
+  if (input != this->ConvertedInput || input->GetMTime() > this->ConvertedInputTime)
   {
-    graph = vtkDirectedGraph::New();
-  }
-  else
-  {
-    graph = vtkUndirectedGraph::New();
-  }
-  graph->ShallowCopy(input);
+    vtkGraph* graph = nullptr;
+    if (vtkDirectedGraph::SafeDownCast(input))
+    {
+      graph = vtkDirectedGraph::New();
+    }
+    else
+    {
+      graph = vtkUndirectedGraph::New();
+    }
+    graph->ShallowCopy(input);
 
-  this->GraphToPoly->SetInputData(graph);
-  this->VertexGlyph->SetInputData(graph);
-  graph->Delete();
+    this->GraphToPoly->SetInputData(graph);
+    this->VertexGlyph->SetInputData(graph);
+    graph->Delete();
+    this->ConvertedInput = input;
+    this->ConvertedInputTime = input->GetMTime();
+  }
   this->GraphToPoly->Update();
   this->VertexGlyph->Update();
   vtkPolyData* edgePd = this->GraphToPoly->GetOutput();
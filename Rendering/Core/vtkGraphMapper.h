@@ -322,6 +322,12 @@ private:
   // Helper function
   vtkPolyData* CreateCircle(bool filled);
 
+  // Input graph and its modified time at the last conversion to polydata.
+  // While these are unchanged the shallow copy and re-extraction are skipped
+  // so the downstream mappers can reuse their uploaded buffers.
+  vtkGraph* ConvertedInput;
+  vtkMTimeType ConvertedInputTime;
+
   float VertexPointSize;
   float EdgeLineWidth;
   bool ScaledGlyphs;
@@ -21,6 +21,7 @@
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
 #include "vtkProp.h"
+#include "vtkPropCollection.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkSelection.h"
@@ -202,6 +203,13 @@ vtkHardwareSelector::vtkHardwareSelector()
   this->UseProcessIdFromData = false;
   this->ActorPassOnly = false;
   this->CaptureZValues = false;
+  this->UseBufferCaching = false;
+  this->CapturedSceneMTime = 0;
+  this->CapturedArea[0] = this->CapturedArea[1] = this->CapturedArea[2] = this->CapturedArea[3] = 0;
+  this->CapturedFieldAssociation = -1;
+  this->CapturedActorPassOnly = false;
+  this->CapturedCaptureZValues = false;
+  this->CapturedProcessID = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -252,11 +260,64 @@ vtkSelection* vtkHardwareSelector::Select()
   if (this->CaptureBuffers())
   {
     sel = this->GenerateSelection();
-    this->ReleasePixBuffers();
+    // keep the buffers around when caching so that the next selection into
+    // an unchanged scene can reuse them
+    if (!this->UseBufferCaching)
+    {
+      this->ReleasePixBuffers();
+    }
   }
   return sel;
 }
 
+//------------------------------------------------------------------------------
+void vtkHardwareSelector::InvalidateCachedBuffers()
+{
+  this->ReleasePixBuffers();
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkHardwareSelector::GetSceneRedrawMTime()
+{
+  vtkMTimeType mtime = this->Renderer->GetMTime();
+  vtkRenderWindow* rwin = this->Renderer->GetRenderWindow();
+  if (rwin && rwin->GetMTime() > mtime)
+  {
+    mtime = rwin->GetMTime();
+  }
+  vtkPropCollection* props = this->Renderer->GetViewProps();
+  vtkCollectionSimpleIterator pit;
+  vtkProp* prop;
+  for (props->InitTraversal(pit); (prop = props->GetNextProp(pit));)
+  {
+    vtkMTimeType redrawMTime = prop->GetRedrawMTime();
+    if (redrawMTime > mtime)
+    {
+      mtime = redrawMTime;
+    }
+  }
+  return mtime;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHardwareSelector::CachedBuffersValid()
+{
+  if (!this->UseBufferCaching || !this->PixBuffer[ACTOR_PASS])
+  {
+    return false;
+  }
+
+  // the selection parameters must match the ones the buffers were captured
+  // with, and the scene must not have been modified since the capture
+  return this->CapturedArea[0] == this->Area[0] && this->CapturedArea[1] == this->Area[1] &&
+    this->CapturedArea[2] == this->Area[2] && this->CapturedArea[3] == this->Area[3] &&
+    this->CapturedFieldAssociation == this->FieldAssociation &&
+    this->CapturedActorPassOnly == this->ActorPassOnly &&
+    this->CapturedCaptureZValues == this->CaptureZValues &&
+    this->CapturedProcessID == this->ProcessID &&
+    this->CapturedSceneMTime == this->GetSceneRedrawMTime();
+}
+
 //------------------------------------------------------------------------------
 bool vtkHardwareSelector::CaptureBuffers()
 {
@@ -266,6 +327,12 @@ bool vtkHardwareSelector::CaptureBuffers()
     return false;
   }
 
+  // reuse the buffers from the previous capture when nothing has changed
+  if (this->CachedBuffersValid())
+  {
+    return true;
+  }
+
   vtkRenderWindow* rwin = this->Renderer->GetRenderWindow();
   rwin->MakeCurrent();
 
@@ -325,6 +392,17 @@ bool vtkHardwareSelector::CaptureBuffers()
   this->Renderer->SetGradientBackground(this->Internals->OriginalGradient);
   this->Renderer->GetRenderWindow()->SwapBuffersOn();
   this->InvokeEvent(vtkCommand::EndEvent);
+
+  // record the state the buffers were captured with for cache validation
+  for (int cc = 0; cc < 4; cc++)
+  {
+    this->CapturedArea[cc] = this->Area[cc];
+  }
+  this->CapturedFieldAssociation = this->FieldAssociation;
+  this->CapturedActorPassOnly = this->ActorPassOnly;
+  this->CapturedCaptureZValues = this->CaptureZValues;
+  this->CapturedProcessID = this->ProcessID;
+  this->CapturedSceneMTime = this->GetSceneRedrawMTime();
   return true;
 }
 
@@ -881,4 +959,5 @@ void vtkHardwareSelector::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Renderer: " << this->Renderer << endl;
   os << indent << "UseProcessIdFromData: " << this->UseProcessIdFromData << endl;
   os << indent << "ActorPassOnly: " << this->ActorPassOnly << endl;
+  os << indent << "UseBufferCaching: " << this->UseBufferCaching << endl;
 }
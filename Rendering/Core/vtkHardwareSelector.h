@@ -280,6 +280,28 @@ public:
   vtkSetMacro(CaptureZValues, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set whether the captured pixel buffers are cached between selections.
+   * When on, a Select() or CaptureBuffers() call reuses the buffers from the
+   * previous capture as long as the scene has not been modified since and the
+   * selection parameters (area, passes) are unchanged, skipping the selection
+   * re-renders entirely. This makes repeated picks into a static scene, such
+   * as hover-driven selection, very cheap. Off by default.
+   */
+  vtkGetMacro(UseBufferCaching, bool);
+  vtkSetMacro(UseBufferCaching, bool);
+  vtkBooleanMacro(UseBufferCaching, bool);
+  ///@}
+
+  /**
+   * Discard any cached pixel buffers so that the next selection re-renders
+   * the capture passes. Only relevant when UseBufferCaching is on; the cache
+   * also invalidates itself when the scene or the selection parameters
+   * change.
+   */
+  void InvalidateCachedBuffers();
+
   ///@{
   /**
    * Called by the mapper before and after rendering each prop.
@@ -489,6 +511,17 @@ protected:
   virtual void BeginSelection();
   virtual void EndSelection();
 
+  ///@{
+  /**
+   * Buffer caching support. GetSceneRedrawMTime returns the latest
+   * modification time of the renderer, its render window and the redraw time
+   * of each of its props; CachedBuffersValid compares it and the cached
+   * selection parameters against the state of the last capture.
+   */
+  vtkMTimeType GetSceneRedrawMTime();
+  bool CachedBuffersValid();
+  ///@}
+
   virtual void ProcessPixelBuffers();
   void BuildPropHitList(unsigned char* rgbData);
 
@@ -519,6 +552,15 @@ protected:
 
   bool CaptureZValues;
 
+  // buffer caching state
+  bool UseBufferCaching;
+  vtkMTimeType CapturedSceneMTime;
+  unsigned int CapturedArea[4];
+  int CapturedFieldAssociation;
+  bool CapturedActorPassOnly;
+  bool CapturedCaptureZValues;
+  int CapturedProcessID;
+
 private:
   vtkHardwareSelector(const vtkHardwareSelector&) = delete;
   void operator=(const vtkHardwareSelector&) = delete;
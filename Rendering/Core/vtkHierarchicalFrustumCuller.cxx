@@ -0,0 +1,410 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHierarchicalFrustumCuller.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkHierarchicalFrustumCuller.h"
+
+#include "vtkCamera.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkProp.h"
+#include "vtkRenderer.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+vtkStandardNewMacro(vtkHierarchicalFrustumCuller);
+
+//------------------------------------------------------------------------------
+class vtkHierarchicalFrustumCuller::vtkInternals
+{
+public:
+  // A node covers PropIndices[First .. First + Count) and is a leaf when it
+  // has no children. Children are always stored at larger indices than their
+  // parent, so a reverse sweep over Nodes visits children before parents.
+  struct Node
+  {
+    double Bounds[6];
+    int Children[2]; // (-1, -1) for leaves
+    int First;
+    int Count;
+  };
+
+  std::vector<Node> Nodes;
+  std::vector<int> PropIndices;
+
+  // Bounding sphere (center, radius) of each prop, cached at build time.
+  std::vector<double> Spheres; // 4 entries per prop
+
+  // Props the hierarchy was built over, and the largest prop MTime seen
+  // then. A different prop set triggers a rebuild; a newer MTime over the
+  // same set only triggers a refit.
+  std::vector<vtkProp*> CachedProps;
+  vtkMTimeType BuildMTime = 0;
+
+  //----------------------------------------------------------------------------
+  // Cache the bounding sphere of prop i and return whether its bounds are
+  // usable. Props without bounds (2D props) and props with uninitialized
+  // bounds are left out of the hierarchy.
+  bool UpdateSphere(vtkProp* prop, int i)
+  {
+    const double* bounds = prop->GetBounds();
+    if (!bounds || !vtkMath::AreBoundsInitialized(bounds))
+    {
+      return false;
+    }
+
+    double* sphere = &this->Spheres[4 * i];
+    sphere[0] = (bounds[0] + bounds[1]) / 2.0;
+    sphere[1] = (bounds[2] + bounds[3]) / 2.0;
+    sphere[2] = (bounds[4] + bounds[5]) / 2.0;
+    sphere[3] = 0.5 *
+      sqrt((bounds[1] - bounds[0]) * (bounds[1] - bounds[0]) +
+        (bounds[3] - bounds[2]) * (bounds[3] - bounds[2]) +
+        (bounds[5] - bounds[4]) * (bounds[5] - bounds[4]));
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  void ComputeNodeBounds(Node& node)
+  {
+    vtkMath::UninitializeBounds(node.Bounds);
+    for (int i = node.First; i < node.First + node.Count; i++)
+    {
+      const double* bounds = this->CachedProps[this->PropIndices[i]]->GetBounds();
+      if (!bounds || !vtkMath::AreBoundsInitialized(bounds))
+      {
+        continue;
+      }
+      if (!vtkMath::AreBoundsInitialized(node.Bounds))
+      {
+        std::copy(bounds, bounds + 6, node.Bounds);
+      }
+      else
+      {
+        node.Bounds[0] = std::min(node.Bounds[0], bounds[0]);
+        node.Bounds[1] = std::max(node.Bounds[1], bounds[1]);
+        node.Bounds[2] = std::min(node.Bounds[2], bounds[2]);
+        node.Bounds[3] = std::max(node.Bounds[3], bounds[3]);
+        node.Bounds[4] = std::min(node.Bounds[4], bounds[4]);
+        node.Bounds[5] = std::max(node.Bounds[5], bounds[5]);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Recursively split PropIndices[first .. first + count) at the median of
+  // the prop centers along the longest axis. Returns the node index.
+  int BuildNode(int first, int count, int leafSize)
+  {
+    int nodeId = static_cast<int>(this->Nodes.size());
+    this->Nodes.emplace_back();
+    Node& node = this->Nodes.back();
+    node.First = first;
+    node.Count = count;
+    node.Children[0] = -1;
+    node.Children[1] = -1;
+    this->ComputeNodeBounds(node);
+
+    if (count <= leafSize)
+    {
+      return nodeId;
+    }
+
+    double* b = node.Bounds;
+    int axis = 0;
+    double length = b[1] - b[0];
+    if (b[3] - b[2] > length)
+    {
+      axis = 1;
+      length = b[3] - b[2];
+    }
+    if (b[5] - b[4] > length)
+    {
+      axis = 2;
+    }
+
+    int* begin = &this->PropIndices[first];
+    int* median = begin + count / 2;
+    std::nth_element(begin, median, begin + count,
+      [this, axis](int lhs, int rhs)
+      { return this->Spheres[4 * lhs + axis] < this->Spheres[4 * rhs + axis]; });
+
+    // Node references are invalidated by the recursive emplace_back.
+    int left = this->BuildNode(first, count / 2, leafSize);
+    int right = this->BuildNode(first + count / 2, count - count / 2, leafSize);
+    this->Nodes[nodeId].Children[0] = left;
+    this->Nodes[nodeId].Children[1] = right;
+    return nodeId;
+  }
+
+  //----------------------------------------------------------------------------
+  void Build(vtkProp** propList, int listLength, int leafSize)
+  {
+    this->Nodes.clear();
+    this->PropIndices.clear();
+    this->CachedProps.assign(propList, propList + listLength);
+    this->Spheres.resize(4 * static_cast<size_t>(listLength));
+
+    this->BuildMTime = 0;
+    for (int i = 0; i < listLength; i++)
+    {
+      this->BuildMTime = std::max(this->BuildMTime, propList[i]->GetMTime());
+      if (this->UpdateSphere(propList[i], i))
+      {
+        this->PropIndices.push_back(i);
+      }
+    }
+
+    if (!this->PropIndices.empty())
+    {
+      this->BuildNode(0, static_cast<int>(this->PropIndices.size()), leafSize);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Recompute leaf bounds from the current prop bounds and propagate them
+  // upwards, keeping the tree topology. Cheaper than Build when props moved
+  // but the prop set is unchanged.
+  void Refit()
+  {
+    for (int i = static_cast<int>(this->Nodes.size()) - 1; i >= 0; i--)
+    {
+      Node& node = this->Nodes[i];
+      if (node.Children[0] < 0)
+      {
+        for (int j = node.First; j < node.First + node.Count; j++)
+        {
+          this->UpdateSphere(this->CachedProps[this->PropIndices[j]], this->PropIndices[j]);
+        }
+        this->ComputeNodeBounds(node);
+      }
+      else
+      {
+        const double* left = this->Nodes[node.Children[0]].Bounds;
+        const double* right = this->Nodes[node.Children[1]].Bounds;
+        node.Bounds[0] = std::min(left[0], right[0]);
+        node.Bounds[1] = std::max(left[1], right[1]);
+        node.Bounds[2] = std::min(left[2], right[2]);
+        node.Bounds[3] = std::max(left[3], right[3]);
+        node.Bounds[4] = std::min(left[4], right[4]);
+        node.Bounds[5] = std::max(left[5], right[5]);
+      }
+    }
+
+    for (vtkProp* prop : this->CachedProps)
+    {
+      this->BuildMTime = std::max(this->BuildMTime, prop->GetMTime());
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Classify a box against the six frustum planes: 0 = outside, 1 = fully
+  // inside, 2 = intersecting. The near vertex of the box along each plane
+  // normal decides rejection, the far vertex decides full containment.
+  static int ClassifyBounds(const double bounds[6], const double planes[24])
+  {
+    int result = 1;
+    for (int p = 0; p < 6; p++)
+    {
+      const double* plane = planes + 4 * p;
+      double nearVertex[3], farVertex[3];
+      for (int c = 0; c < 3; c++)
+      {
+        nearVertex[c] = plane[c] >= 0.0 ? bounds[2 * c + 1] : bounds[2 * c];
+        farVertex[c] = plane[c] >= 0.0 ? bounds[2 * c] : bounds[2 * c + 1];
+      }
+      if (plane[0] * nearVertex[0] + plane[1] * nearVertex[1] + plane[2] * nearVertex[2] +
+            plane[3] <
+        0.0)
+      {
+        return 0;
+      }
+      if (plane[0] * farVertex[0] + plane[1] * farVertex[1] + plane[2] * farVertex[2] + plane[3] <
+        0.0)
+      {
+        result = 2;
+      }
+    }
+    return result;
+  }
+
+  //----------------------------------------------------------------------------
+  // Walk the hierarchy; mark props of rejected subtrees invisible and gather
+  // the props of partially visible leaves for individual tests.
+  void Traverse(const double planes[24], std::vector<unsigned char>& visibility,
+    std::vector<int>& undecided) const
+  {
+    if (this->Nodes.empty())
+    {
+      return;
+    }
+
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+      const Node& node = this->Nodes[stack.back()];
+      stack.pop_back();
+
+      int side = ClassifyBounds(node.Bounds, planes);
+      if (side == 0)
+      {
+        for (int i = node.First; i < node.First + node.Count; i++)
+        {
+          visibility[this->PropIndices[i]] = 0;
+        }
+      }
+      else if (side == 2)
+      {
+        if (node.Children[0] < 0)
+        {
+          undecided.insert(undecided.end(), this->PropIndices.begin() + node.First,
+            this->PropIndices.begin() + node.First + node.Count);
+        }
+        else
+        {
+          stack.push_back(node.Children[0]);
+          stack.push_back(node.Children[1]);
+        }
+      }
+      // side == 1: the whole subtree is inside, every prop stays visible.
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkHierarchicalFrustumCuller::vtkHierarchicalFrustumCuller()
+{
+  this->LeafSize = 8;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkHierarchicalFrustumCuller::~vtkHierarchicalFrustumCuller()
+{
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+double vtkHierarchicalFrustumCuller::Cull(
+  vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized)
+{
+  vtkInternals* internals = this->Internals;
+
+  double planes[24];
+  ren->GetActiveCamera()->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+
+  // Reuse the cached hierarchy when possible: rebuild only when the prop set
+  // changed, refit when a prop over the same set was modified.
+  bool samePropSet = internals->CachedProps.size() == static_cast<size_t>(listLength) &&
+    std::equal(propList, propList + listLength, internals->CachedProps.begin());
+  if (!samePropSet)
+  {
+    internals->Build(propList, listLength, this->LeafSize);
+  }
+  else
+  {
+    vtkMTimeType latest = 0;
+    for (int i = 0; i < listLength; i++)
+    {
+      latest = std::max(latest, propList[i]->GetMTime());
+    }
+    if (latest > internals->BuildMTime)
+    {
+      internals->Refit();
+    }
+  }
+
+  // Props without usable bounds are not in the hierarchy and are never
+  // culled, matching vtkFrustumCoverageCuller's handling of 2D props.
+  std::vector<unsigned char> visibility(listLength, 1);
+  std::vector<int> undecided;
+  internals->Traverse(planes, visibility, undecided);
+
+  // Resolve the props of partially visible leaves with sphere-plane tests.
+  const double* spheres = internals->Spheres.data();
+  vtkSMPTools::For(0, static_cast<vtkIdType>(undecided.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType idx = begin; idx < end; idx++)
+      {
+        const double* sphere = &spheres[4 * undecided[idx]];
+        for (int p = 0; p < 6; p++)
+        {
+          double d = planes[p * 4 + 0] * sphere[0] + planes[p * 4 + 1] * sphere[1] +
+            planes[p * 4 + 2] * sphere[2] + planes[p * 4 + 3];
+          if (d < -sphere[3])
+          {
+            visibility[undecided[idx]] = 0;
+            break;
+          }
+        }
+      }
+    });
+
+  // Zero the render time of culled props; visible props keep their current
+  // multiplier so a downstream coverage culler can still allocate time.
+  std::vector<double> allocatedTimeList(listLength);
+  double total_time = 0.0;
+  for (int i = 0; i < listLength; i++)
+  {
+    double previous_time = initialized ? propList[i]->GetRenderTimeMultiplier() : 1.0;
+    double allocated = visibility[i] ? previous_time : 0.0;
+    propList[i]->SetRenderTimeMultiplier(allocated);
+    allocatedTimeList[i] = allocated;
+    total_time += allocated;
+  }
+
+  // Compact the list, removing the culled props while preserving the order
+  // of the remaining ones (same scheme as vtkFrustumCoverageCuller).
+  int index1 = 0;
+  for (int index2 = 1; index2 < listLength; index2++)
+  {
+    if (allocatedTimeList[index1] == 0.0)
+    {
+      if (allocatedTimeList[index2] != 0.0)
+      {
+        allocatedTimeList[index1] = allocatedTimeList[index2];
+        propList[index1] = propList[index2];
+        propList[index2] = nullptr;
+        allocatedTimeList[index2] = 0.0;
+      }
+      else
+      {
+        propList[index1] = propList[index2] = nullptr;
+        allocatedTimeList[index1] = allocatedTimeList[index2] = 0.0;
+      }
+    }
+    if (allocatedTimeList[index1] != 0.0)
+    {
+      index1++;
+    }
+  }
+  if (listLength > 0)
+  {
+    listLength = (allocatedTimeList[index1] == 0.0) ? index1 : listLength;
+  }
+
+  initialized = 1;
+  return total_time;
+}
+
+//------------------------------------------------------------------------------
+void vtkHierarchicalFrustumCuller::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Leaf Size: " << this->LeafSize << endl;
+}
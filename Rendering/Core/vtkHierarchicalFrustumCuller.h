@@ -0,0 +1,92 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkHierarchicalFrustumCuller.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkHierarchicalFrustumCuller
+ * @brief   cull props with a bounding volume hierarchy
+ *
+ * vtkHierarchicalFrustumCuller culls props against the view frustum through
+ * a bounding volume hierarchy (BVH) built over the prop bounds, instead of
+ * testing every prop individually the way vtkFrustumCoverageCuller does.
+ * A subtree whose bounding box lies entirely outside one frustum plane is
+ * culled without visiting its props, and a subtree entirely inside all six
+ * planes is accepted without further plane tests, so the per-frame cost
+ * scales with the number of visible regions rather than the actor count.
+ *
+ * The hierarchy is cached between renders. It is rebuilt when the prop list
+ * changes and only refitted (leaf bounds recomputed and propagated upwards)
+ * when props are merely modified, which keeps moving a few actors in a large
+ * scene cheap. Props in partially visible leaves are resolved with
+ * individual sphere tests evaluated in parallel.
+ *
+ * Like vtkFrustumCoverageCuller, culled props get a render time multiplier
+ * of zero and are removed from the prop list; visible props keep their
+ * current multiplier. This culler performs no coverage-based time
+ * allocation, so it can be placed in front of a vtkFrustumCoverageCuller
+ * when LOD behavior is also wanted.
+ *
+ * @sa
+ * vtkCuller vtkFrustumCoverageCuller
+ */
+
+#ifndef vtkHierarchicalFrustumCuller_h
+#define vtkHierarchicalFrustumCuller_h
+
+#include "vtkCuller.h"
+#include "vtkRenderingCoreModule.h" // For export macro
+
+class vtkProp;
+class vtkRenderer;
+
+class VTKRENDERINGCORE_EXPORT vtkHierarchicalFrustumCuller : public vtkCuller
+{
+public:
+  static vtkHierarchicalFrustumCuller* New();
+  vtkTypeMacro(vtkHierarchicalFrustumCuller, vtkCuller);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the maximum number of props stored in a leaf of the hierarchy.
+   * Smaller leaves cull more precisely but make the tree deeper and more
+   * expensive to build. Default is 8.
+   */
+  vtkSetClampMacro(LeafSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(LeafSize, int);
+  ///@}
+
+  /**
+   * WARNING: INTERNAL METHOD - NOT INTENDED FOR GENERAL USE
+   * DO NOT USE THESE METHODS OUTSIDE OF THE RENDERING PROCESS
+   * Perform the cull operation
+   * This method should only be called by vtkRenderer as part of
+   * the render process
+   */
+  double Cull(vtkRenderer* ren, vtkProp** propList, int& listLength, int& initialized) override;
+
+protected:
+  vtkHierarchicalFrustumCuller();
+  ~vtkHierarchicalFrustumCuller() override;
+
+  int LeafSize;
+
+private:
+  class vtkInternals;
+  vtkInternals* Internals;
+
+  vtkHierarchicalFrustumCuller(const vtkHierarchicalFrustumCuller&) = delete;
+  void operator=(const vtkHierarchicalFrustumCuller&) = delete;
+};
+
+#endif
@@ -153,7 +153,11 @@ public:
    * one slice is mapped to the screen.  The default behavior is to pull
    * the full 3D input extent through the input pipeline, but to do this
    * only when the input data changes.  The default behavior results in
-   * much faster follow-up renders when the input data is static.
+   * much faster follow-up renders when the input data is static.  While
+   * the input pipeline is being modified (e.g. a lookup table upstream is
+   * changing during a window/level interaction), only the displayed slice
+   * is pulled through the pipeline even when streaming is off; the full
+   * extent is pulled again once the input settles down.
    */
   vtkSetMacro(Streaming, vtkTypeBool);
   vtkGetMacro(Streaming, vtkTypeBool);
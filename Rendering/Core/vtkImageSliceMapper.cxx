@@ -15,6 +15,7 @@
 #include "vtkImageSliceMapper.h"
 
 #include "vtkCamera.h"
+#include "vtkDemandDrivenPipeline.h"
 #include "vtkImageData.h"
 #include "vtkImageProperty.h"
 #include "vtkImageSlice.h"
@@ -232,9 +233,30 @@ vtkTypeBool vtkImageSliceMapper::ProcessRequest(
   {
     vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
 
-    if (this->Streaming)
+    bool displayExtentOnly = (this->Streaming != 0);
+
+    if (!displayExtentOnly)
+    {
+      // The whole extent is normally requested so that scrolling through
+      // the slices does not cause the input pipeline to re-execute.  But
+      // when the input pipeline has been modified (e.g. the lookup table
+      // of an upstream vtkImageMapToColors changes during a window/level
+      // interaction), the buffered data is stale and will be regenerated
+      // no matter what extent is requested, so request just the displayed
+      // slice: only that slice is recomputed per render, and the whole
+      // extent is restored by the first update after the input settles.
+      vtkDataObject* inData = inInfo->Get(vtkDataObject::DATA_OBJECT());
+      vtkAlgorithm* inAlg = this->GetInputAlgorithm();
+      vtkDemandDrivenPipeline* inExec =
+        (inAlg ? vtkDemandDrivenPipeline::SafeDownCast(inAlg->GetExecutive()) : nullptr);
+      if (inData && inExec && inExec->GetPipelineMTime() > inData->GetUpdateTime())
+      {
+        displayExtentOnly = true;
+      }
+    }
+
+    if (displayExtentOnly)
     {
-      // only update the display extent if streaming is on
       inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), this->DisplayExtent, 6);
     }
     else
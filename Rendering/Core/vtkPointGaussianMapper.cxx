@@ -40,6 +40,9 @@ vtkPointGaussianMapper::vtkPointGaussianMapper()
   this->ScaleFactor = 1.0;
   this->Emissive = 1;
   this->TriangleScale = 3.0;
+
+  this->LODEnable = 0;
+  this->LODTargetPoints = 2000000;
 }
 
 //------------------------------------------------------------------------------
@@ -68,4 +71,6 @@ void vtkPointGaussianMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OpacityTableSize: " << this->OpacityTableSize << "\n";
   os << indent << "ScaleTableSize: " << this->ScaleTableSize << "\n";
   os << indent << "TriangleScale: " << this->TriangleScale << "\n";
+  os << indent << "LODEnable: " << this->LODEnable << "\n";
+  os << indent << "LODTargetPoints: " << this->LODTargetPoints << "\n";
 }
@@ -161,6 +161,31 @@ public:
   vtkGetMacro(TriangleScale, float);
   ///@}
 
+  ///@{
+  /**
+   * Enable level-of-detail rendering of large point clouds. When on,
+   * interactive renders (renders whose desired update rate is above one
+   * frame per second, as set by the interactor during camera motion) draw
+   * only an evenly strided subset of about LODTargetPoints splats; still
+   * renders always draw the full set, so the image refines as soon as the
+   * camera stops. Picking renders are never decimated. The default is off.
+   */
+  vtkSetMacro(LODEnable, vtkTypeBool);
+  vtkGetMacro(LODEnable, vtkTypeBool);
+  vtkBooleanMacro(LODEnable, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * The approximate number of splats interactive renders should draw when
+   * LODEnable is on. The default is two million, which stays interactive
+   * on typical hardware; inputs at or below this size are always drawn in
+   * full.
+   */
+  vtkSetMacro(LODTargetPoints, vtkIdType);
+  vtkGetMacro(LODTargetPoints, vtkIdType);
+  ///@}
+
   /**
    * WARNING: INTERNAL METHOD - NOT INTENDED FOR GENERAL USE
    * DO NOT USE THIS METHOD OUTSIDE OF THE RENDERING PROCESS
@@ -190,6 +215,9 @@ protected:
 
   float TriangleScale;
 
+  vtkTypeBool LODEnable;
+  vtkIdType LODTargetPoints;
+
 private:
   vtkPointGaussianMapper(const vtkPointGaussianMapper&) = delete;
   void operator=(const vtkPointGaussianMapper&) = delete;
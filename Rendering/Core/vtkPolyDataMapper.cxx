@@ -22,6 +22,7 @@
 #include "vtkPolyData.h"
 #include "vtkRenderWindow.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTimerLog.h"
 
 vtkObjectFactoryNewMacro(vtkPolyDataMapper);
 
@@ -34,6 +35,9 @@ vtkPolyDataMapper::vtkPolyDataMapper()
   this->GhostLevel = 0;
   this->SeamlessU = false;
   this->SeamlessV = false;
+  this->StreamingRender = false;
+  this->StreamingTimeBudget = 0.1;
+  this->StreamingCurrentPiece = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -52,6 +56,12 @@ void vtkPolyDataMapper::Render(vtkRenderer* ren, vtkActor* act)
     return;
   }
 
+  if (this->StreamingRender)
+  {
+    this->RenderStreamedPieces(ren, act);
+    return;
+  }
+
   int nPieces = this->NumberOfPieces * this->NumberOfSubPieces;
   for (int i = 0; i < this->NumberOfSubPieces; i++)
   {
@@ -66,6 +76,31 @@ void vtkPolyDataMapper::Render(vtkRenderer* ren, vtkActor* act)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyDataMapper::RenderStreamedPieces(vtkRenderer* ren, vtkActor* act)
+{
+  vtkInformation* inInfo = this->GetInputInformation();
+  int nPieces = this->NumberOfPieces * this->NumberOfSubPieces;
+  double startTime = vtkTimerLog::GetUniversalTime();
+
+  // Resume at the piece after the last one rendered. At least one piece is
+  // rendered per call so a tiny budget still makes progress.
+  int currentPiece = this->StreamingCurrentPiece;
+  do
+  {
+    this->GetInputAlgorithm()->UpdateInformation();
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), currentPiece);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), nPieces);
+    inInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), this->GhostLevel);
+    this->RenderPiece(ren, act);
+    ++currentPiece;
+  } while (currentPiece < nPieces &&
+    vtkTimerLog::GetUniversalTime() - startTime < this->StreamingTimeBudget);
+
+  this->StreamingCurrentPiece = (currentPiece < nPieces) ? currentPiece : 0;
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyDataMapper::SetInputData(vtkPolyData* input)
 {
@@ -163,6 +198,8 @@ void vtkPolyDataMapper::ShallowCopy(vtkAbstractMapper* mapper)
     this->SetNumberOfSubPieces(m->GetNumberOfSubPieces());
     this->SetSeamlessU(m->GetSeamlessU());
     this->SetSeamlessV(m->GetSeamlessV());
+    this->SetStreamingRender(m->GetStreamingRender());
+    this->SetStreamingTimeBudget(m->GetStreamingTimeBudget());
   }
 
   // Now do superclass
@@ -206,6 +243,9 @@ void vtkPolyDataMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NumberOfPieces : " << this->NumberOfPieces << endl;
   os << indent << "GhostLevel: " << this->GhostLevel << endl;
   os << indent << "Number of sub pieces: " << this->NumberOfSubPieces << endl;
+  os << indent << "StreamingRender: " << (this->StreamingRender ? "On" : "Off") << endl;
+  os << indent << "StreamingTimeBudget: " << this->StreamingTimeBudget << endl;
+  os << indent << "StreamingCurrentPiece: " << this->StreamingCurrentPiece << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -88,6 +88,40 @@ public:
   vtkGetMacro(GhostLevel, int);
   ///@}
 
+  ///@{
+  /**
+   * Enable rendering the input piece by piece across several Render() calls.
+   * When enabled, Render() resumes at the piece after the last one rendered,
+   * requests pieces through the streaming demand driven pipeline (using
+   * NumberOfPieces * NumberOfSubPieces as the total piece count) and renders
+   * them until the per-frame time budget is exhausted. The first pieces are
+   * therefore on screen after a fraction of the full pipeline execution.
+   * Repeat rendering until IsStreamingComplete() returns true. The renderer
+   * must keep the pixels of previous frames, e.g. with
+   * vtkRenderer::PreserveColorBufferOn() and PreserveDepthBufferOn().
+   * Default is off.
+   */
+  vtkSetMacro(StreamingRender, bool);
+  vtkGetMacro(StreamingRender, bool);
+  vtkBooleanMacro(StreamingRender, bool);
+  ///@}
+
+  ///@{
+  /**
+   * The time budget (in seconds) one Render() call may spend on updating and
+   * rendering pieces when StreamingRender is enabled. At least one piece is
+   * rendered per call regardless of the budget. Default is 0.1 seconds.
+   */
+  vtkSetClampMacro(StreamingTimeBudget, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(StreamingTimeBudget, double);
+  ///@}
+
+  /**
+   * Return true when a streaming render has rendered its last piece, i.e.
+   * the next Render() call starts over at piece 0.
+   */
+  bool IsStreamingComplete() { return this->StreamingCurrentPiece == 0; }
+
   ///@{
   /**
    * Accessors / Mutators for handling seams on wrapping surfaces. Letters U and V stand for
@@ -165,11 +199,21 @@ protected:
    */
   virtual void ComputeBounds();
 
+  /**
+   * Render pieces incrementally, resuming at StreamingCurrentPiece and
+   * stopping once StreamingTimeBudget is spent. Called from Render() when
+   * StreamingRender is enabled.
+   */
+  void RenderStreamedPieces(vtkRenderer* ren, vtkActor* act);
+
   int Piece;
   int NumberOfPieces;
   int NumberOfSubPieces;
   int GhostLevel;
   bool SeamlessU, SeamlessV;
+  bool StreamingRender;
+  double StreamingTimeBudget;
+  int StreamingCurrentPiece;
 
   int FillInputPortInformation(int, vtkInformation*) override;
 
@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkRenderWindowInteractor.h"
 
+#include "vtkCallbackCommand.h"
 #include "vtkCamera.h"
 #include "vtkCommand.h"
 #include "vtkDebugLeaks.h"
@@ -131,6 +132,18 @@ vtkRenderWindowInteractor::vtkRenderWindowInteractor()
 
   this->TimerMap = new vtkTimerIdMap;
   this->TimerDuration = 10;
+
+  this->RenderRequestTimerId = 0;
+  this->RenderRequestPriority = RENDER_PRIORITY_LOW;
+  this->RenderCoalescingDuration = 17; // about one refresh of a 60Hz display
+
+  this->RenderRequestObserver = vtkCallbackCommand::New();
+  this->RenderRequestObserver->SetClientData(this);
+  this->RenderRequestObserver->SetCallback(vtkRenderWindowInteractor::ProcessRenderRequestTimer);
+  // Run ahead of interactor styles and widgets so that scheduler timers are
+  // consumed before anybody interprets them as interaction timers.
+  this->AddObserver(vtkCommand::TimerEvent, this->RenderRequestObserver, 1.0f);
+
   this->ObserverMediator = nullptr;
   this->HandleEventLoop = false;
 
@@ -160,6 +173,12 @@ vtkRenderWindowInteractor::~vtkRenderWindowInteractor()
   {
     this->ObserverMediator->Delete();
   }
+  if (this->RenderRequestTimerId)
+  {
+    this->DestroyTimer(this->RenderRequestTimerId);
+  }
+  this->RemoveObserver(this->RenderRequestObserver);
+  this->RenderRequestObserver->Delete();
   delete this->TimerMap;
 
   this->SetPickingManager(nullptr);
@@ -172,6 +191,12 @@ vtkObjectFactoryNewMacro(vtkRenderWindowInteractor);
 //------------------------------------------------------------------------------
 void vtkRenderWindowInteractor::Render()
 {
+  // A direct render satisfies any pending coalesced request.
+  if (this->RenderRequestTimerId)
+  {
+    this->DestroyTimer(this->RenderRequestTimerId);
+    this->RenderRequestTimerId = 0;
+  }
   if (this->RenderWindow && this->Enabled && this->EnableRender)
   {
     this->RenderWindow->Render();
@@ -181,6 +206,60 @@ void vtkRenderWindowInteractor::Render()
   this->InvokeEvent(vtkCommand::RenderEvent, nullptr);
 }
 
+//------------------------------------------------------------------------------
+void vtkRenderWindowInteractor::RequestRender(int priority)
+{
+  if (priority >= RENDER_PRIORITY_IMMEDIATE)
+  {
+    // Render() cancels any pending request; it would only repeat this render.
+    this->Render();
+    return;
+  }
+
+  if (this->RenderRequestTimerId)
+  {
+    if (priority <= this->RenderRequestPriority)
+    {
+      // Coalesced into the already pending request.
+      return;
+    }
+    // Upgrade the pending request by re-arming with the shorter delay.
+    this->DestroyTimer(this->RenderRequestTimerId);
+    this->RenderRequestTimerId = 0;
+  }
+
+  unsigned long duration = this->RenderCoalescingDuration;
+  if (priority <= RENDER_PRIORITY_LOW)
+  {
+    duration *= 5;
+  }
+  this->RenderRequestTimerId = this->CreateOneShotTimer(duration);
+  if (this->RenderRequestTimerId)
+  {
+    this->RenderRequestPriority = priority;
+  }
+  else
+  {
+    // The platform interactor does not implement timers; render directly.
+    this->Render();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Consume the coalescing timer armed by RequestRender() and perform the
+// deferred render.
+void vtkRenderWindowInteractor::ProcessRenderRequestTimer(vtkObject* vtkNotUsed(caller),
+  unsigned long vtkNotUsed(event), void* clientData, void* callData)
+{
+  vtkRenderWindowInteractor* self = static_cast<vtkRenderWindowInteractor*>(clientData);
+  int timerId = (callData ? *(static_cast<int*>(callData)) : 0);
+  if (self->RenderRequestTimerId && timerId == self->RenderRequestTimerId)
+  {
+    self->RenderRequestObserver->SetAbortFlag(1);
+    self->Render(); // clears RenderRequestTimerId and destroys the timer
+  }
+}
+
 //------------------------------------------------------------------------------
 // treat renderWindow and interactor as one object.
 // it might be easier if the GetReference count method were redefined.
@@ -986,6 +1065,7 @@ void vtkRenderWindowInteractor::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "TimerEventType: " << this->TimerEventType << "\n";
   os << indent << "TimerEventDuration: " << this->TimerEventDuration << "\n";
   os << indent << "TimerEventPlatformId: " << this->TimerEventPlatformId << "\n";
+  os << indent << "RenderCoalescingDuration: " << this->RenderCoalescingDuration << "\n";
   os << indent << "UseTDx: " << this->UseTDx << endl;
   os << indent << "Recognize Gestures: " << this->RecognizeGestures << endl;
 }
@@ -63,6 +63,7 @@ class vtkTimerIdMap;
 class vtkAbstractPicker;
 class vtkAbstractPropPicker;
 class vtkAssemblyPath;
+class vtkCallbackCommand;
 class vtkHardwareWindow;
 class vtkInteractorObserver;
 class vtkRenderWindow;
@@ -403,6 +404,43 @@ public:
    */
   virtual void Render();
 
+  /**
+   * Priority levels accepted by RequestRender().
+   */
+  enum RenderPriority
+  {
+    RENDER_PRIORITY_LOW = 0,
+    RENDER_PRIORITY_NORMAL,
+    RENDER_PRIORITY_IMMEDIATE
+  };
+
+  /**
+   * Request that the scene be rendered soon, coalescing bursts of requests
+   * into a single render. Rather than rendering synchronously, this method
+   * arms a one-shot timer and renders once when it fires, so any number of
+   * requests issued in the meantime (say, from a stream of mouse move
+   * events) produce a single render pass with the latest state. The
+   * priority controls the latency: RENDER_PRIORITY_IMMEDIATE renders
+   * synchronously before returning, RENDER_PRIORITY_NORMAL renders after at
+   * most RenderCoalescingDuration milliseconds (roughly one display refresh
+   * by default), and RENDER_PRIORITY_LOW waits five times as long, which
+   * suits background refinement. A pending request is upgraded, never
+   * delayed, by subsequent requests of higher priority, and a direct call
+   * to Render() satisfies it. On platforms whose interactor does not
+   * implement timers the request falls back to an immediate render.
+   */
+  virtual void RequestRender(int priority = RENDER_PRIORITY_NORMAL);
+
+  ///@{
+  /**
+   * Specify the interval (in milliseconds) that RequestRender() uses to
+   * coalesce render requests. The default of 17 milliseconds approximates
+   * one refresh of a 60 Hz display.
+   */
+  vtkSetClampMacro(RenderCoalescingDuration, unsigned long, 1, 100000);
+  vtkGetMacro(RenderCoalescingDuration, unsigned long);
+  ///@}
+
   ///@{
   /**
    * Given a position x, move the current camera's focal point to x.
@@ -888,6 +926,22 @@ protected:
   friend struct vtkTimerStruct;
   vtkTimerIdMap* TimerMap;     // An internal, PIMPLd map of timers and associated attributes
   unsigned long TimerDuration; // in milliseconds
+
+  ///@{
+  /**
+   * RequestRender() support: the id of the armed coalescing timer (0 when
+   * no request is pending), the priority of the pending request, the
+   * coalescing interval, and the observer that consumes the timer event
+   * and performs the deferred render.
+   */
+  int RenderRequestTimerId;
+  int RenderRequestPriority;
+  unsigned long RenderCoalescingDuration; // in milliseconds
+  vtkCallbackCommand* RenderRequestObserver;
+  static void ProcessRenderRequestTimer(
+    vtkObject* caller, unsigned long event, void* clientData, void* callData);
+  ///@}
+
   ///@{
   /**
    * Internal methods for creating and destroying timers that must be
@@ -17,6 +17,7 @@
 #include "vtkAssemblyPath.h"
 #include "vtkCamera.h"
 #include "vtkCommand.h"
+#include "vtkActor.h"
 #include "vtkCuller.h"
 #include "vtkCullerCollection.h"
 #include "vtkFXAAOptions.h"
@@ -25,10 +26,12 @@
 #include "vtkInformation.h"
 #include "vtkLight.h"
 #include "vtkLightCollection.h"
+#include "vtkMapper.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPropCollection.h"
+#include "vtkProperty.h"
 #include "vtkRect.h"
 #include "vtkRenderPass.h"
 #include "vtkRenderTimerLog.h"
@@ -39,6 +42,8 @@
 #include "vtkTimerLog.h"
 #include "vtkVectorOperators.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 vtkCxxSetObjectMacro(vtkRenderer, Information, vtkInformation);
@@ -123,6 +128,7 @@ vtkRenderer::vtkRenderer()
   this->UseHiddenLineRemoval = 0;
 
   this->UseDepthPeeling = 0;
+  this->UseStateSortingForProps = 0;
   this->UseDepthPeelingForVolumes = false;
   this->OcclusionRatio = 0.0;
   this->MaximumNumberOfPeels = 4;
@@ -734,13 +740,90 @@ int vtkRenderer::UpdateTranslucentPolygonalGeometry()
   return result;
 }
 
+//------------------------------------------------------------------------------
+vtkProp** vtkRenderer::GetStateSortedPropArray()
+{
+  // Gather a state signature for each visible prop. For actors this is the
+  // texture, the mapper and the material; other props only contribute their
+  // identity and keep their relative order.
+  struct StateKey
+  {
+    vtkTexture* Texture;
+    const char* MapperClass;
+    vtkMapper* Mapper;
+  };
+  std::vector<StateKey> keys(this->PropArrayCount);
+  vtkStateStorage state;
+  for (int i = 0; i < this->PropArrayCount; i++)
+  {
+    vtkProp* aProp = this->PropArray[i];
+    StateKey& key = keys[i];
+    key.Texture = nullptr;
+    key.MapperClass = "";
+    key.Mapper = nullptr;
+    state.Append(aProp, "prop");
+    vtkActor* anActor = vtkActor::SafeDownCast(aProp);
+    if (anActor)
+    {
+      key.Texture = anActor->GetTexture();
+      key.Mapper = anActor->GetMapper();
+      if (key.Mapper)
+      {
+        key.MapperClass = key.Mapper->GetClassName();
+      }
+      state.Append(key.Texture, "texture");
+      state.Append(key.Mapper, "mapper");
+      vtkMTimeType propertyTime = anActor->GetProperty()->GetMTime();
+      state.Append(propertyTime, "property time");
+    }
+  }
+
+  if (this->StateSortedPropsState != state ||
+    this->StateSortedProps.size() != static_cast<size_t>(this->PropArrayCount))
+  {
+    // Group props that share state: same texture first, then same mapper
+    // type (hence same shader template), then same mapper. The sort is
+    // stable so props with identical signatures keep the collection order.
+    std::vector<int> order(this->PropArrayCount);
+    for (int i = 0; i < this->PropArrayCount; i++)
+    {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&keys](int a, int b) {
+      if (keys[a].Texture != keys[b].Texture)
+      {
+        return keys[a].Texture < keys[b].Texture;
+      }
+      int classDiff = strcmp(keys[a].MapperClass, keys[b].MapperClass);
+      if (classDiff != 0)
+      {
+        return classDiff < 0;
+      }
+      return keys[a].Mapper < keys[b].Mapper;
+    });
+    this->StateSortedProps.resize(this->PropArrayCount);
+    for (int i = 0; i < this->PropArrayCount; i++)
+    {
+      this->StateSortedProps[i] = this->PropArray[order[i]];
+    }
+    this->StateSortedPropsState = state;
+  }
+
+  return this->StateSortedProps.data();
+}
+
 //------------------------------------------------------------------------------
 int vtkRenderer::UpdateOpaquePolygonalGeometry()
 {
   int result = 0;
+  vtkProp** props = this->PropArray;
+  if (this->UseStateSortingForProps && this->PropArrayCount > 1)
+  {
+    props = this->GetStateSortedPropArray();
+  }
   for (int i = 0; i < this->PropArrayCount; i++)
   {
-    result += this->PropArray[i]->RenderOpaqueGeometry(this);
+    result += props[i]->RenderOpaqueGeometry(this);
   }
   this->NumberOfPropsRendered += result;
   return result;
@@ -1750,6 +1833,9 @@ void vtkRenderer::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "UseDepthPeeling: " << (this->UseDepthPeeling ? "On" : "Off") << "\n";
 
+  os << indent << "UseStateSortingForProps: " << (this->UseStateSortingForProps ? "On" : "Off")
+     << "\n";
+
   os << indent << "OcclusionRation: " << this->OcclusionRatio << "\n";
 
   os << indent << "MaximumNumberOfPeels: " << this->MaximumNumberOfPeels << "\n";
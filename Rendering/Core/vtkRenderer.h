@@ -36,9 +36,11 @@
 #include "vtkViewport.h"
 
 #include "vtkActorCollection.h"  // Needed for access in inline members
+#include "vtkStateStorage.h"     // Needed for render state sorting ivars
 #include "vtkVolumeCollection.h" // Needed for access in inline members
 
-#include <array> // To store matrices
+#include <array>  // To store matrices
+#include <vector> // To store the state sorted prop list
 
 class vtkFXAAOptions;
 class vtkRenderWindow;
@@ -741,6 +743,22 @@ public:
   vtkBooleanMacro(SSAOBlur, bool);
   ////@}
 
+  ////@{
+  /**
+   * Turn on/off ordering of the visible opaque props by a rendering state
+   * signature (texture, mapper and material) before they are rendered.
+   * Grouping props that share state reduces the number of shader and texture
+   * binds performed by the rendering backend in scenes with many
+   * heterogeneous actors. Opaque rendering is depth buffered and therefore
+   * order independent, so the resulting image is unchanged. The sorted order
+   * is cached and only recomputed when the prop set or one of the signatures
+   * changes. Initial value is off.
+   */
+  vtkSetMacro(UseStateSortingForProps, vtkTypeBool);
+  vtkGetMacro(UseStateSortingForProps, vtkTypeBool);
+  vtkBooleanMacro(UseStateSortingForProps, vtkTypeBool);
+  ////@}
+
   ////@{
   /**
    * Set/Get a custom Render call. Allows to hook a Render call from an
@@ -934,6 +952,18 @@ protected:
   vtkProp** PropArray;
   int PropArrayCount;
 
+  /**
+   * Return the visible props ordered by rendering state signature,
+   * rebuilding the cached order when the prop set or a signature changed.
+   * Only valid while PropArray is valid.
+   */
+  vtkProp** GetStateSortedPropArray();
+
+  // Opaque props ordered to minimize rendering state changes, together with
+  // the prop set and material state the ordering was computed from.
+  std::vector<vtkProp*> StateSortedProps;
+  vtkStateStorage StateSortedPropsState;
+
   // Indicates if the renderer should receive events from an interactor.
   // Typically only used in conjunction with transparent renderers.
   vtkTypeBool Interactive;
@@ -1081,6 +1111,13 @@ protected:
    */
   vtkTypeBool UseDepthPeeling;
 
+  /**
+   * If this flag is on, visible opaque props are rendered grouped by a
+   * texture/mapper/material signature to reduce backend state changes.
+   * Initial value is off.
+   */
+  vtkTypeBool UseStateSortingForProps;
+
   /**
    * This flag is on and the GPU supports it, depth-peel volumes along with
    * the translucent geometry. Default is false;
@@ -25,6 +25,7 @@
 #include "vtkRenderer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
+#include "vtkUnsignedCharArray.h"
 
 vtkCxxSetObjectMacro(vtkTexture, LookupTable, vtkScalarsToColors);
 //------------------------------------------------------------------------------
@@ -49,6 +50,11 @@ vtkTexture::vtkTexture()
   this->ColorMode = VTK_COLOR_MODE_DEFAULT;
   this->Transform = nullptr;
 
+  this->CompressedImage = nullptr;
+  this->CompressedImageFormat = BC7Compression;
+  this->CompressedImageWidth = 0;
+  this->CompressedImageHeight = 0;
+
   this->SelfAdjustingTableRange = 0;
 
   this->SetNumberOfOutputPorts(0);
@@ -84,6 +90,35 @@ vtkTexture::~vtkTexture()
   {
     this->Transform->UnRegister(this);
   }
+
+  if (this->CompressedImage != nullptr)
+  {
+    this->CompressedImage->UnRegister(this);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkTexture::SetCompressedImage(vtkUnsignedCharArray* data, int format, int width, int height)
+{
+  if (data == this->CompressedImage && format == this->CompressedImageFormat &&
+    width == this->CompressedImageWidth && height == this->CompressedImageHeight)
+  {
+    return;
+  }
+
+  if (this->CompressedImage != nullptr)
+  {
+    this->CompressedImage->UnRegister(this);
+  }
+  this->CompressedImage = data;
+  if (this->CompressedImage != nullptr)
+  {
+    this->CompressedImage->Register(this);
+  }
+  this->CompressedImageFormat = format;
+  this->CompressedImageWidth = width;
+  this->CompressedImageHeight = height;
+  this->Modified();
 }
 
 //------------------------------------------------------------------------------
@@ -187,6 +222,13 @@ void vtkTexture::PrintSelf(ostream& os, vtkIndent indent)
      << this->BorderColor[2] << ", " << this->BorderColor[3] << " }\n";
 
   os << indent << "PremultipliedAlpha: " << (this->PremultipliedAlpha ? "On\n" : "Off\n");
+  os << indent << "CompressedImage: " << this->CompressedImage << "\n";
+  if (this->CompressedImage)
+  {
+    os << indent << "CompressedImageFormat: " << this->CompressedImageFormat << "\n";
+    os << indent << "CompressedImageWidth: " << this->CompressedImageWidth << "\n";
+    os << indent << "CompressedImageHeight: " << this->CompressedImageHeight << "\n";
+  }
 
   if (this->GetInput())
   {
@@ -274,6 +274,34 @@ public:
   vtkBooleanMacro(UseSRGBColorSpace, bool);
   ///@}
 
+  /**
+   * Pre-compressed payload formats accepted by SetCompressedImage().
+   */
+  enum CompressedImageFormats
+  {
+    BC3Compression = 0, // S3TC DXT5 RGBA blocks
+    BC7Compression,     // BPTC UNORM RGBA blocks
+    ASTC4x4Compression  // ASTC 4x4 LDR RGBA blocks
+  };
+
+  ///@{
+  /**
+   * Supply a pre-compressed texture payload to be uploaded to the GPU as
+   * is, bypassing the image scalar input. The payload is the raw block
+   * data for a single mip level with the given pixel dimensions, in one of
+   * the CompressedImageFormats. When set, it takes precedence over the
+   * image input; pass nullptr to return to the regular upload path. The
+   * rendering backend rejects formats the graphics driver cannot decode
+   * (there is no CPU decompression fallback), so provide payloads in a
+   * format known to be supported by the target hardware.
+   */
+  void SetCompressedImage(vtkUnsignedCharArray* data, int format, int width, int height);
+  vtkGetObjectMacro(CompressedImage, vtkUnsignedCharArray);
+  vtkGetMacro(CompressedImageFormat, int);
+  vtkGetMacro(CompressedImageWidth, int);
+  vtkGetMacro(CompressedImageHeight, int);
+  ///@}
+
   ///@{
   /**
    * Border Color (RGBA). The values can be any valid float value,
@@ -358,6 +386,11 @@ protected:
   bool CubeMap;
   bool UseSRGBColorSpace;
 
+  vtkUnsignedCharArray* CompressedImage;
+  int CompressedImageFormat;
+  int CompressedImageWidth;
+  int CompressedImageHeight;
+
   // the result of HasTranslucentPolygonalGeometry is cached
   vtkTimeStamp TranslucentComputationTime;
   int TranslucentCachedResult;
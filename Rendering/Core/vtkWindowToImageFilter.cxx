@@ -23,10 +23,12 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointData.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRendererCollection.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
 #include <vector>
@@ -469,6 +471,27 @@ void vtkWindowToImageFilter::RequestData(vtkInformation* vtkNotUsed(request),
       int buffer = this->ReadFrontBuffer;
       if (this->InputBufferType == VTK_RGB || this->InputBufferType == VTK_RGBA)
       {
+        // with a single tile the window region maps 1:1 onto the output rows,
+        // so read straight into the output scalars and skip the intermediate
+        // buffer and the row-by-row copy; this matters for movie export where
+        // this filter runs once per frame
+        if (num_iterations[0] == 1 && num_iterations[1] == 1)
+        {
+          vtkUnsignedCharArray* outArray =
+            vtkArrayDownCast<vtkUnsignedCharArray>(out->GetPointData()->GetScalars());
+          if (this->InputBufferType == VTK_RGB)
+          {
+            this->Input->GetPixelData(
+              imageBounds[0], imageBounds[1], imageBounds[2], imageBounds[3], buffer, outArray);
+          }
+          else
+          {
+            renWin->GetRGBACharPixelData(
+              imageBounds[0], imageBounds[1], imageBounds[2], imageBounds[3], buffer, outArray);
+          }
+          continue;
+        }
+
         unsigned char *pixels, *pixels1, *outPtr;
         if (this->InputBufferType == VTK_RGB)
         {
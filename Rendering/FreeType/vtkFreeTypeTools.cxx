@@ -37,6 +37,7 @@
 #include <limits>
 #include <map>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 // Print debug info
@@ -53,6 +54,24 @@ void rotateVector2i(vtkVector2i& vec, float sinTheta, float cosTheta)
   vec = vtkVector2i(x, y);
 }
 
+// Cache of string measurements, keyed on the text property identity and
+// MTime, the DPI and the string. Measuring a string walks every glyph, and
+// interactive scenes with many text actors re-measure the same strings each
+// frame. vtkObject MTimes come from a global monotonic counter, so a (pointer,
+// MTime) pair never aliases a property with different settings.
+std::unordered_map<std::string, vtkTextRenderer::Metrics> MetricsCache;
+
+// Keep the cache from growing without bound, e.g. while searching for a
+// constrained font size; clearing wholesale is cheap compared to measuring.
+constexpr size_t MetricsCacheMaxEntries = 2048;
+
+std::string MetricsCacheKey(vtkTextProperty* tprop, const vtkStdString& str, int dpi)
+{
+  std::ostringstream key;
+  key << static_cast<const void*>(tprop) << '|' << tprop->GetMTime() << '|' << dpi << '|' << str;
+  return key.str();
+}
+
 } // end anon namespace
 
 class vtkTextPropertyLookup : public std::map<size_t, vtkSmartPointer<vtkTextProperty>>
@@ -495,17 +514,15 @@ bool vtkFreeTypeTools::GetBoundingBox(
     return true;
   }
 
-  MetaData metaData;
-  bool result = this->PrepareMetaData(tprop, dpi, metaData);
-  if (result)
+  // GetMetrics computes the same information and maintains the metrics
+  // cache, so measure through it.
+  vtkTextRenderer::Metrics metrics;
+  if (!this->GetMetrics(tprop, str, dpi, metrics))
   {
-    result = this->CalculateBoundingBox(str, metaData);
-    if (result)
-    {
-      memcpy(bbox, metaData.bbox.GetData(), sizeof(int) * 4);
-    }
+    return false;
   }
-  return result;
+  memcpy(bbox, metrics.BoundingBox.GetData(), sizeof(int) * 4);
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -524,6 +541,14 @@ bool vtkFreeTypeTools::GetMetrics(
     return true;
   }
 
+  std::string cacheKey = MetricsCacheKey(tprop, str, dpi);
+  auto cacheIter = MetricsCache.find(cacheKey);
+  if (cacheIter != MetricsCache.end())
+  {
+    metrics = cacheIter->second;
+    return true;
+  }
+
   MetaData metaData;
   bool result = this->PrepareMetaData(tprop, dpi, metaData);
   if (result)
@@ -538,6 +563,12 @@ bool vtkFreeTypeTools::GetMetrics(
       metrics.BottomRight = metaData.BR;
       metrics.Ascent = metaData.ascent;
       metrics.Descent = metaData.descent;
+
+      if (MetricsCache.size() >= MetricsCacheMaxEntries)
+      {
+        MetricsCache.clear();
+      }
+      MetricsCache[cacheKey] = metrics;
     }
   }
   return result;
@@ -31,6 +31,8 @@
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 
+#include <algorithm>
+
 namespace
 {
 vtkSmartPointer<vtkCompositeDataSet> EnsureComposite(vtkDataObject* dobj)
@@ -91,7 +93,29 @@ void vtkHyperTreeGridMapper::Render(vtkRenderer* ren, vtkActor* act)
 
   // Adaptive decimation (if required)
   auto htgs = ::EnsureComposite(dataObj);
-  auto adaptedHtgs = this->UpdateWithDecimation(htgs, ren);
+
+  // Only re-extract the surface when something it depends on has changed:
+  // the input data, the decimation mode, or the camera when the adaptive
+  // decimation is active. In the plain mode the extracted surface is static
+  // geometry, so camera interaction renders from the cache.
+  bool useAdapt = this->UseAdaptiveDecimation && ren->GetActiveCamera()->GetParallelProjection();
+  vtkMTimeType inputTime = dataObj->GetMTime();
+  for (auto block : vtk::Range(htgs))
+  {
+    if (block)
+    {
+      inputTime = std::max(inputTime, block->GetMTime());
+    }
+  }
+  vtkMTimeType cameraTime = ren->GetActiveCamera()->GetMTime();
+  if (!this->CachedGeometry || this->CachedInputTime != inputTime ||
+    this->CachedUseAdapt != useAdapt || (useAdapt && this->CachedCameraTime != cameraTime))
+  {
+    this->CachedGeometry = this->UpdateWithDecimation(htgs, ren);
+    this->CachedInputTime = inputTime;
+    this->CachedCameraTime = cameraTime;
+    this->CachedUseAdapt = useAdapt;
+  }
 
   // Setup the mapper
   if (this->GetMTime() > this->Mapper->GetMTime())
@@ -99,7 +123,7 @@ void vtkHyperTreeGridMapper::Render(vtkRenderer* ren, vtkActor* act)
     this->Mapper->ShallowCopy(this);
   }
 
-  this->Mapper->SetInputDataObject(adaptedHtgs);
+  this->Mapper->SetInputDataObject(this->CachedGeometry);
   this->Mapper->Render(ren, act);
 }
 
@@ -128,6 +128,14 @@ protected:
   // Internal object to render
   vtkSmartPointer<vtkCompositeDataSet> Input;
 
+  // Cached extracted surface, regenerated only when the input, the
+  // decimation mode or (in adaptive mode) the camera changes. Without the
+  // cache every camera interaction re-runs the geometry extraction.
+  vtkSmartPointer<vtkCompositeDataSet> CachedGeometry;
+  vtkMTimeType CachedInputTime = 0;
+  vtkMTimeType CachedCameraTime = 0;
+  bool CachedUseAdapt = false;
+
 private:
   vtkHyperTreeGridMapper(const vtkHyperTreeGridMapper&) = delete;
   void operator=(const vtkHyperTreeGridMapper&) = delete;
@@ -16,6 +16,7 @@
 
 #include "vtkAbstractImageInterpolator.h"
 #include "vtkCamera.h"
+#include "vtkDemandDrivenPipeline.h"
 #include "vtkGarbageCollector.h"
 #include "vtkImageData.h"
 #include "vtkImageProperty.h"
@@ -414,6 +415,22 @@ vtkTypeBool vtkImageResliceMapper::ProcessRequest(
     else
     {
       vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+      // the whole extent is normally requested so that the input pipeline
+      // does not re-execute every time the reslice geometry changes, but if
+      // the input pipeline is modified (e.g. an upstream lookup table is
+      // changing during a window/level interaction) the buffered data will
+      // be regenerated regardless, so let vtkImageReslice request only the
+      // extent that the displayed slice needs
+      vtkDataObject* inData = inInfo->Get(vtkDataObject::DATA_OBJECT());
+      vtkAlgorithm* inAlg = this->GetInputAlgorithm();
+      vtkDemandDrivenPipeline* inExec =
+        (inAlg ? vtkDemandDrivenPipeline::SafeDownCast(inAlg->GetExecutive()) : nullptr);
+      if (inData && inExec && inExec->GetPipelineMTime() > inData->GetUpdateTime())
+      {
+        return this->ImageReslice->ProcessRequest(request, inputVector, outputVector);
+      }
+
       int ext[6];
       inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), ext);
       inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), ext, 6);
@@ -111,7 +111,7 @@ class vtkLICPingPongBufferManager
 public:
   vtkLICPingPongBufferManager(vtkOpenGLFramebufferObject* fbo, unsigned int* bufSize,
     vtkTextureObject* vectorTexture, vtkTextureObject* maskVectorTexture,
-    vtkTextureObject* noiseTexture, int doEEPass, int doVTPass)
+    vtkTextureObject* noiseTexture, int doEEPass, int doVTPass, vtkTextureObject** pool)
   {
     this->VectorTexture = vectorTexture;
     this->MaskVectorTexture = maskVectorTexture;
@@ -119,14 +119,32 @@ public:
 
     this->ReadIndex = 0;
 
-    // allocate buffers
+    // grab buffers from the pool, allocating them on first use. The pooled
+    // textures persist between executions (they are owned by the pool, not
+    // by this manager) so that repeated updates, e.g. while animating a
+    // time-varying vector field, do not re-create them every time.
     vtkOpenGLRenderWindow* context = vtkOpenGLRenderWindow::SafeDownCast(fbo->GetContext());
-    this->LICTexture0 = this->AllocateLICBuffer(context, bufSize);
-    this->SeedTexture0 = this->AllocateLICBuffer(context, bufSize);
-    this->LICTexture1 = this->AllocateLICBuffer(context, bufSize);
-    this->SeedTexture1 = this->AllocateLICBuffer(context, bufSize);
-    this->EETexture = doEEPass ? this->AllocateNoiseBuffer(context, bufSize) : nullptr;
-    this->ImageVectorTexture = doVTPass ? this->AllocateVectorBuffer(context, bufSize) : nullptr;
+    if (pool[0] == nullptr)
+    {
+      pool[0] = this->AllocateLICBuffer(context, bufSize);
+      pool[1] = this->AllocateLICBuffer(context, bufSize);
+      pool[2] = this->AllocateLICBuffer(context, bufSize);
+      pool[3] = this->AllocateLICBuffer(context, bufSize);
+    }
+    this->LICTexture0 = pool[0];
+    this->SeedTexture0 = pool[1];
+    this->LICTexture1 = pool[2];
+    this->SeedTexture1 = pool[3];
+    if (doEEPass && pool[4] == nullptr)
+    {
+      pool[4] = this->AllocateNoiseBuffer(context, bufSize);
+    }
+    this->EETexture = doEEPass ? pool[4] : nullptr;
+    if (doVTPass && pool[5] == nullptr)
+    {
+      pool[5] = this->AllocateVectorBuffer(context, bufSize);
+    }
+    this->ImageVectorTexture = doVTPass ? pool[5] : nullptr;
 
     // setup pairs for buffer ping-pong
     this->PingTextures[0] = this->LICTexture0;
@@ -150,23 +168,12 @@ public:
 
   ~vtkLICPingPongBufferManager()
   {
-    // free buffers
     if (this->QuadVBO)
     {
       this->QuadVBO->Delete();
     }
-    this->LICTexture0->Delete();
-    this->SeedTexture0->Delete();
-    this->LICTexture1->Delete();
-    this->SeedTexture1->Delete();
-    if (this->EETexture)
-    {
-      this->EETexture->Delete();
-    }
-    if (this->ImageVectorTexture)
-    {
-      this->ImageVectorTexture->Delete();
-    }
+    // the lic/seed/ee/image-vector buffer textures are owned by the pool
+    // and remain available for the next execution
   }
 
   // Description:
@@ -907,12 +914,20 @@ vtkLineIntegralConvolution2D::vtkLineIntegralConvolution2D()
   this->MaskThreshold = 0.0;
 
   this->TransformVectors = 1;
+
+  for (int i = 0; i < 6; ++i)
+  {
+    this->BufferPool[i] = nullptr;
+  }
+  this->BufferPoolSize[0] = 0;
+  this->BufferPoolSize[1] = 0;
 }
 
 //------------------------------------------------------------------------------
 vtkLineIntegralConvolution2D::~vtkLineIntegralConvolution2D()
 {
   delete this->Comm;
+  this->ClearBufferPool();
   this->SetContext(nullptr);
   this->SetVTShader(nullptr);
   this->SetLIC0Shader(nullptr);
@@ -951,6 +966,7 @@ void vtkLineIntegralConvolution2D::SetContext(vtkOpenGLRenderWindow* renWin)
 
   this->Context = renWin;
   this->ShadersNeedBuild = 1;
+  this->ClearBufferPool();
   this->FBO->SetContext(renWin);
   this->Modified();
 
@@ -960,6 +976,21 @@ void vtkLineIntegralConvolution2D::SetContext(vtkOpenGLRenderWindow* renWin)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkLineIntegralConvolution2D::ClearBufferPool()
+{
+  for (int i = 0; i < 6; ++i)
+  {
+    if (this->BufferPool[i])
+    {
+      this->BufferPool[i]->Delete();
+      this->BufferPool[i] = nullptr;
+    }
+  }
+  this->BufferPoolSize[0] = 0;
+  this->BufferPoolSize[1] = 0;
+}
+
 //------------------------------------------------------------------------------
 bool vtkLineIntegralConvolution2D::IsSupported(vtkRenderWindow* renWin)
 {
@@ -1323,11 +1354,21 @@ vtkTextureObject* vtkLineIntegralConvolution2D::Execute(
   this->FBO->Bind();
   this->FBO->InitializeViewport(computeTexSize[0], computeTexSize[1]);
 
+  // reuse the pooled buffer textures from the previous execution when the
+  // compute size is unchanged, otherwise release them so that they are
+  // re-created at the new size.
+  if (this->BufferPoolSize[0] != computeTexSize[0] || this->BufferPoolSize[1] != computeTexSize[1])
+  {
+    this->ClearBufferPool();
+    this->BufferPoolSize[0] = computeTexSize[0];
+    this->BufferPoolSize[1] = computeTexSize[1];
+  }
+
   // initialize the buffer manager. Textures are assigned
   // and bound to individual units. These textures and units
   // are active and bound for the remainder of this execution.
   vtkLICPingPongBufferManager bufs(this->FBO, computeTexSize, vectorTex, maskVectorTex, noiseTex,
-    this->EnhancedLIC, this->TransformVectors);
+    this->EnhancedLIC, this->TransformVectors, this->BufferPool);
 
 #if vtkLineIntegralConvolution2DDEBUG >= 1
   int rank = this->GetCommunicator()->GetRank();
@@ -378,6 +378,16 @@ protected:
 
   vtkTextureObject* AllocateBuffer(unsigned int texSize[2]);
 
+  /**
+   * Release the pooled internal buffer textures. The pool lets the
+   * ping-pong lic/seed buffers (and the optional edge-enhance and
+   * image-space vector buffers) be reused from one execution to the next,
+   * e.g. while animating a time-varying vector field, instead of being
+   * re-created for every update. The pool is released automatically when
+   * the compute size or the rendering context changes.
+   */
+  void ClearBufferPool();
+
   /**
    * Convenience functions to ensure that the input textures are
    * configured correctly.
@@ -397,6 +407,10 @@ protected:
   vtkWeakPointer<vtkOpenGLRenderWindow> Context;
   vtkOpenGLFramebufferObject* FBO;
 
+  // Pooled buffer textures reused across executions (see ClearBufferPool).
+  vtkTextureObject* BufferPool[6];
+  unsigned int BufferPoolSize[2];
+
   int ShadersNeedBuild;
   vtkOpenGLHelper* FinalBlendProgram;
   vtkOpenGLHelper* IntermediateBlendProgram;
@@ -14,10 +14,12 @@
 =========================================================================*/
 #include "vtkQuadricLODActor.h"
 
+#include "vtkBinnedDecimation.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkFollower.h"
 #include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolyDataAlgorithm.h"
@@ -27,10 +29,64 @@
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
+#include "vtkSmartPointer.h"
 #include "vtkTexture.h"
 
+#include <atomic>
+#include <thread>
+
 vtkStandardNewMacro(vtkQuadricLODActor);
 
+//------------------------------------------------------------------------------
+// Runs the decimation on a worker thread. The worker only touches its own
+// filter and a shallow-copied snapshot of the input (shared arrays are only
+// read, by the worker as well as by the full resolution renders that continue
+// in the meantime).
+class vtkQuadricLODActor::vtkInternals
+{
+public:
+  ~vtkInternals() { this->Join(); }
+
+  void Join()
+  {
+    if (this->Worker.joinable())
+    {
+      this->Worker.join();
+    }
+    this->InFlight = false;
+    this->Done = false;
+  }
+
+  void Launch(vtkPolyData* input, const int nDivs[3])
+  {
+    this->Join();
+
+    vtkSmartPointer<vtkPolyData> snapshot = vtkSmartPointer<vtkPolyData>::New();
+    snapshot->ShallowCopy(input);
+    int d0 = nDivs[0], d1 = nDivs[1], d2 = nDivs[2];
+
+    this->InFlight = true;
+    this->Worker = std::thread(
+      [this, snapshot, d0, d1, d2]()
+      {
+        vtkNew<vtkBinnedDecimation> decimate;
+        decimate->SetInputData(snapshot);
+        decimate->SetNumberOfDivisions(d0, d1, d2);
+        decimate->AutoAdjustNumberOfDivisionsOff();
+        decimate->SetPointGenerationModeToBinPoints();
+        decimate->ProducePointDataOff();
+        decimate->Update();
+        this->Output = decimate->GetOutput();
+        this->Done = true;
+      });
+  }
+
+  std::thread Worker;
+  std::atomic<bool> Done{ false };
+  bool InFlight = false;
+  vtkSmartPointer<vtkPolyData> Output;
+};
+
 //------------------------------------------------------------------------------
 // Specify the quadric clustering algorithm for decimating the geometry.
 vtkCxxSetObjectMacro(vtkQuadricLODActor, LODFilter, vtkQuadricClustering);
@@ -46,6 +102,7 @@ vtkQuadricLODActor::vtkQuadricLODActor()
 
   this->Static = 0;
   this->DeferLODConstruction = 0;
+  this->AsynchronousLODConstruction = 1;
   this->CollapseDimensionRatio = 0.05;
   this->DataConfiguration = UNKNOWN;
   this->PropType = ACTOR;
@@ -64,11 +121,14 @@ vtkQuadricLODActor::vtkQuadricLODActor()
   vtkMatrix4x4* m = vtkMatrix4x4::New();
   this->LODActor->SetUserMatrix(m);
   m->Delete();
+
+  this->Internals = new vtkInternals;
 }
 
 //------------------------------------------------------------------------------
 vtkQuadricLODActor::~vtkQuadricLODActor()
 {
+  delete this->Internals;
   this->LODFilter->Delete();
   this->LODActor->Delete();
   this->LODActor = nullptr;
@@ -98,8 +158,28 @@ void vtkQuadricLODActor::Render(vtkRenderer* ren, vtkMapper* vtkNotUsed(m))
 
   vtkMatrix4x4* matrix;
 
-  // Build LOD only if necessary
-  if ((interactiveRender || !this->DeferLODConstruction) &&
+  // Pick up the result of a background decimation launched on an earlier
+  // render.
+  if (this->Internals->InFlight && this->Internals->Done)
+  {
+    this->Internals->Join();
+    this->LODMapper->SetInputData(this->Internals->Output);
+    this->Internals->Output = nullptr;
+
+    matrix = this->LODActor->GetUserMatrix();
+    this->GetMatrix(matrix);
+
+    this->LODMapper->Update();
+    if (this->Static)
+    {
+      this->LODMapper->StaticOn();
+    }
+    this->BuildTime.Modified();
+  }
+
+  // Build LOD only if necessary, and never launch a new build while one is
+  // still running on the worker thread.
+  if ((interactiveRender || !this->DeferLODConstruction) && !this->Internals->InFlight &&
     (this->GetMTime() > this->BuildTime || (this->Mapper->GetMTime() > this->BuildTime) ||
       (this->CachedInteractiveFrameRate < 0.9 * frameRate) ||
       (this->CachedInteractiveFrameRate > 1.1 * frameRate)))
@@ -116,103 +196,38 @@ void vtkQuadricLODActor::Render(vtkRenderer* ren, vtkMapper* vtkNotUsed(m))
     this->LODActor->SetProperty(this->GetProperty());
     this->LODActor->SetBackfaceProperty(this->BackfaceProperty);
 
-    // This table has been empirically defined. It specifies a quadric
-    // clustering bin size go along with a desired frame rate.
-    static const int NumTableEntries = 7;
-    static const double FPSTable[] = { 0.0, 5.0, 10.0, 17.5, 25.0, 50.0, 75.0 };
-    static const double DIMTable[] = { 75.0, 60.0, 50.0, 35.0, 25.0, 20.0, 15.0 };
-    int dim = 15;
-    for (int i = 0; i < (NumTableEntries - 1); i++)
-    {
-      if (frameRate >= FPSTable[i] && frameRate <= FPSTable[i + 1])
-      {
-        dim = static_cast<int>((DIMTable[i] +
-          (frameRate - FPSTable[i]) / (FPSTable[i + 1] - FPSTable[i]) *
-            (DIMTable[i + 1] - DIMTable[i])));
-        break;
-      }
-    }
-
-    // TODO: When the 'TestQuadricLODActor' test gets here frameRate=15.0
-    // and dim=40.  This causes vtkQuadricClustering::AddTriangle()'s computations
-    // to overflow.  If you set dim=35 there's no overflow, if you set it to 36 there is.
-
     // Construct the LOD
     vtkPolyData* pd = vtkPolyData::SafeDownCast(this->Mapper->GetInput());
 
-    // First see if there is an explicit description of the data configuration.
-    if (this->DataConfiguration == XLINE)
-    {
-      this->LODFilter->SetNumberOfDivisions(dim, 1, 1);
-    }
-    else if (this->DataConfiguration == YLINE)
-    {
-      this->LODFilter->SetNumberOfDivisions(1, dim, 1);
-    }
-    else if (this->DataConfiguration == ZLINE)
-    {
-      this->LODFilter->SetNumberOfDivisions(1, 1, dim);
-    }
-    else if (this->DataConfiguration == XYPLANE)
-    {
-      this->LODFilter->SetNumberOfDivisions(dim, dim, 1);
-    }
-    else if (this->DataConfiguration == YZPLANE)
-    {
-      this->LODFilter->SetNumberOfDivisions(1, dim, dim);
-    }
-    else if (this->DataConfiguration == XZPLANE)
-    {
-      this->LODFilter->SetNumberOfDivisions(dim, 1, dim);
-    }
-    else if (this->DataConfiguration == XYZVOLUME)
+    int nDivs[3];
+    this->ComputeNumberOfDivisions(pd, frameRate, nDivs);
+
+    if (this->AsynchronousLODConstruction)
     {
-      this->LODFilter->SetNumberOfDivisions(dim, dim, dim);
+      // Decimate on the worker thread; full resolution geometry keeps
+      // rendering until the result is picked up above.
+      this->Internals->Launch(pd, nDivs);
     }
-    else // no explicit description
+    else
     {
-      // If here, we analyze the data to see if we can optimize binning.  The
-      // binning is optimized depending on data dimension and data aspect
-      // ratio.
-      double bounds[6], h[3];
-      pd->GetBounds(bounds);
-      h[0] = bounds[1] - bounds[0];
-      h[1] = bounds[3] - bounds[2];
-      h[2] = bounds[5] - bounds[4];
-      double hMax = (h[0] > h[1]) ? (h[0] > h[2] ? h[0] : h[2]) : (h[1] > h[2] ? h[1] : h[2]);
-      int nDivs[3], numSmallDims = 0;
-      for (int i = 0; i < 3; i++)
+      this->LODFilter->SetNumberOfDivisions(nDivs);
+      this->LODFilter->AutoAdjustNumberOfDivisionsOff();
+      this->LODFilter->SetInputConnection(this->Mapper->GetInputConnection(0, 0));
+      this->LODFilter->Update();
+      this->LODMapper->SetInputConnection(this->LODFilter->GetOutputPort());
+
+      // Make sure the device has the same matrix. Only update when still update
+      // rate is requested.
+      matrix = this->LODActor->GetUserMatrix();
+      this->GetMatrix(matrix);
+
+      this->LODMapper->Update();
+      if (this->Static)
       {
-        if (h[i] <= (this->CollapseDimensionRatio * hMax))
-        {
-          nDivs[i] = 1;
-          numSmallDims++;
-        }
-        else
-        {
-          nDivs[i] = dim;
-        }
+        this->LODMapper->StaticOn();
       }
-      this->LODFilter->SetNumberOfDivisions(nDivs);
-    } // data configuration not explicitly specified
-
-    vtkDebugMacro("QC bin size: " << dim);
-    this->LODFilter->AutoAdjustNumberOfDivisionsOff();
-    this->LODFilter->SetInputConnection(this->Mapper->GetInputConnection(0, 0));
-    this->LODFilter->Update();
-    this->LODMapper->SetInputConnection(this->LODFilter->GetOutputPort());
-
-    // Make sure the device has the same matrix. Only update when still update
-    // rate is requested.
-    matrix = this->LODActor->GetUserMatrix();
-    this->GetMatrix(matrix);
-
-    this->LODMapper->Update();
-    if (this->Static)
-    {
-      this->LODMapper->StaticOn();
+      this->BuildTime.Modified();
     }
-    this->BuildTime.Modified();
   }
 
   // Figure out which resolution to use. We want the highest resolution that
@@ -224,8 +239,9 @@ void vtkQuadricLODActor::Render(vtkRenderer* ren, vtkMapper* vtkNotUsed(m))
 #ifndef NDEBUG
   float bestTime = bestMapper->GetTimeToDraw();
 #endif
-  if (interactiveRender)
-  { // use lod
+  if (interactiveRender && !this->Internals->InFlight)
+  { // use lod - unless the decimation is still being built on the worker
+    // thread, in which case full resolution is rendered until it is ready
     bestMapper = this->LODMapper;
 #ifndef NDEBUG
     bestTime = bestMapper->GetTimeToDraw();
@@ -275,6 +291,88 @@ void vtkQuadricLODActor::Render(vtkRenderer* ren, vtkMapper* vtkNotUsed(m))
   this->EstimatedRenderTime = bestMapper->GetTimeToDraw();
 }
 
+//------------------------------------------------------------------------------
+void vtkQuadricLODActor::ComputeNumberOfDivisions(vtkPolyData* pd, double frameRate, int nDivs[3])
+{
+  // This table has been empirically defined. It specifies a quadric
+  // clustering bin size go along with a desired frame rate.
+  static const int NumTableEntries = 7;
+  static const double FPSTable[] = { 0.0, 5.0, 10.0, 17.5, 25.0, 50.0, 75.0 };
+  static const double DIMTable[] = { 75.0, 60.0, 50.0, 35.0, 25.0, 20.0, 15.0 };
+  int dim = 15;
+  for (int i = 0; i < (NumTableEntries - 1); i++)
+  {
+    if (frameRate >= FPSTable[i] && frameRate <= FPSTable[i + 1])
+    {
+      dim = static_cast<int>((DIMTable[i] +
+        (frameRate - FPSTable[i]) / (FPSTable[i + 1] - FPSTable[i]) *
+          (DIMTable[i + 1] - DIMTable[i])));
+      break;
+    }
+  }
+
+  // TODO: When the 'TestQuadricLODActor' test gets here frameRate=15.0
+  // and dim=40.  This causes vtkQuadricClustering::AddTriangle()'s computations
+  // to overflow.  If you set dim=35 there's no overflow, if you set it to 36 there is.
+  vtkDebugMacro("QC bin size: " << dim);
+
+  // First see if there is an explicit description of the data configuration.
+  switch (this->DataConfiguration)
+  {
+    case XLINE:
+      nDivs[0] = dim;
+      nDivs[1] = 1;
+      nDivs[2] = 1;
+      break;
+    case YLINE:
+      nDivs[0] = 1;
+      nDivs[1] = dim;
+      nDivs[2] = 1;
+      break;
+    case ZLINE:
+      nDivs[0] = 1;
+      nDivs[1] = 1;
+      nDivs[2] = dim;
+      break;
+    case XYPLANE:
+      nDivs[0] = dim;
+      nDivs[1] = dim;
+      nDivs[2] = 1;
+      break;
+    case YZPLANE:
+      nDivs[0] = 1;
+      nDivs[1] = dim;
+      nDivs[2] = dim;
+      break;
+    case XZPLANE:
+      nDivs[0] = dim;
+      nDivs[1] = 1;
+      nDivs[2] = dim;
+      break;
+    case XYZVOLUME:
+      nDivs[0] = dim;
+      nDivs[1] = dim;
+      nDivs[2] = dim;
+      break;
+    default:
+    {
+      // If here, we analyze the data to see if we can optimize binning.  The
+      // binning is optimized depending on data dimension and data aspect
+      // ratio.
+      double bounds[6], h[3];
+      pd->GetBounds(bounds);
+      h[0] = bounds[1] - bounds[0];
+      h[1] = bounds[3] - bounds[2];
+      h[2] = bounds[5] - bounds[4];
+      double hMax = (h[0] > h[1]) ? (h[0] > h[2] ? h[0] : h[2]) : (h[1] > h[2] ? h[1] : h[2]);
+      for (int i = 0; i < 3; i++)
+      {
+        nDivs[i] = (h[i] <= (this->CollapseDimensionRatio * hMax)) ? 1 : dim;
+      }
+    } // data configuration not explicitly specified
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkQuadricLODActor::ReleaseGraphicsResources(vtkWindow* renWin)
 {
@@ -307,6 +405,9 @@ void vtkQuadricLODActor::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Defer LOD Construction: " << (this->DeferLODConstruction ? "On\n" : "Off\n");
 
+  os << indent
+     << "Asynchronous LOD Construction: " << (this->AsynchronousLODConstruction ? "On\n" : "Off\n");
+
   os << indent << "Static : " << (this->Static ? "On\n" : "Off\n");
 
   os << indent << "Collapse Dimension Ratio: " << this->CollapseDimensionRatio << "\n";
@@ -35,8 +35,11 @@
  * By default the algorithm is set up to pre-compute the LODs. That is, on
  * the first render (whether a full resolution render or interactive render)
  * the LOD is computed. This behavior can be changed so that the LOD
- * construction is deferred until the first interactive render. Either way,
- * when the LOD is constructed, the user may notice a short pause.
+ * construction is deferred until the first interactive render. When the LOD
+ * is constructed synchronously the user may notice a short pause; with
+ * AsynchronousLODConstruction enabled (the default) the LOD is built with
+ * vtkBinnedDecimation on a background thread while full resolution geometry
+ * keeps rendering, so no pause occurs.
  *
  * @warning
  * This class can be used as a direct replacement for vtkActor. It may also be
@@ -85,6 +88,21 @@ public:
   vtkBooleanMacro(DeferLODConstruction, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Specify whether to build the LOD on a background thread. When enabled,
+   * the render that first needs the LOD launches a vtkBinnedDecimation of
+   * the mapper's input (configured to produce point-data-free output) on a
+   * worker thread and keeps rendering full resolution geometry until the
+   * decimated version is ready, instead of stalling inside Render(). When
+   * disabled, the LOD is built synchronously with the quadric clustering
+   * filter as before. Default is enabled.
+   */
+  vtkSetMacro(AsynchronousLODConstruction, vtkTypeBool);
+  vtkGetMacro(AsynchronousLODConstruction, vtkTypeBool);
+  vtkBooleanMacro(AsynchronousLODConstruction, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Turn on/off a flag to control whether the underlying pipeline is static.
@@ -207,6 +225,12 @@ protected:
   vtkQuadricLODActor();
   ~vtkQuadricLODActor() override;
 
+  /**
+   * Compute the clustering bin counts from the desired frame rate and the
+   * data configuration (explicit or derived from the input bounds).
+   */
+  void ComputeNumberOfDivisions(vtkPolyData* pd, double frameRate, int nDivs[3]);
+
   // Renders the LOD
   vtkActor* LODActor;
   vtkPolyDataMapper* LODMapper;
@@ -231,10 +255,17 @@ protected:
   // Specify to defer construction of the LOD.
   vtkTypeBool DeferLODConstruction;
 
+  // Specify whether the LOD is decimated on a background thread.
+  vtkTypeBool AsynchronousLODConstruction;
+
   // Keep track of building
   vtkTimeStamp BuildTime;
 
 private:
+  // Manages the worker thread decimating the LOD.
+  class vtkInternals;
+  vtkInternals* Internals;
+
   vtkQuadricLODActor(const vtkQuadricLODActor&) = delete;
   void operator=(const vtkQuadricLODActor&) = delete;
 };
@@ -68,6 +68,8 @@ public:
   // origin[a] = corner[0].dot(axis[a]);
   double Origin[2];
 
+  LabelRect() = default;
+
   LabelRect(double center[2], const double w, const double h, double rotation)
   {
     double X[2];
@@ -344,7 +346,19 @@ public:
     void Reset() { this->Labels.clear(); }
     void Insert(const LabelRect& rect) { this->Labels.push_back(rect); }
   };
+  /// Everything needed to re-render a label placed on the last frame without
+  /// traversing the hierarchy or resolving collisions again.
+  struct CachedLabel
+  {
+    LabelRect Rect;
+    vtkSmartPointer<vtkTextProperty> TextProperty;
+    vtkStdString Label;
+    vtkIdType Type;
+    int Origin[2];
+    int BoundedWidth; // > 0 when rendered through the bounded-size path
+  };
   std::vector<std::vector<ScreenTile>> Tiles;
+  std::vector<CachedLabel> PlacedLabels;
   float ScreenOrigin[2];
   float TileSize[2];
   int NumTiles[2];
@@ -488,6 +502,8 @@ vtkLabelPlacementMapper::vtkLabelPlacementMapper()
   this->LastCameraViewUp[1] = 0.0;
   this->LastCameraViewUp[2] = 0.0;
   this->LastCameraParallelScale = 0.0;
+  this->LastInputMTime = 0;
+  this->LastSettingsMTime = 0;
 
   this->UseDepthBuffer = false;
 
@@ -563,6 +579,67 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
   // Update the pipeline if necessary
   this->Update();
 
+  // The input label hierarchies are only rebuilt upstream when their inputs
+  // change, so the demand-driven Update() above is cheap for a static scene.
+  // When the hierarchies, the mapper and strategy settings, the camera, and
+  // the viewport are all unchanged since the last render, the placements
+  // resolved then are still valid: replay them and skip the hierarchy
+  // traversal and collision tests entirely.
+  int numInputs = this->GetNumberOfInputConnections(0);
+  vtkMTimeType inputMTime = 0;
+  for (int i = 0; i < numInputs; ++i)
+  {
+    vtkDataObject* inData = this->GetInputDataObject(0, i);
+    if (inData && inData->GetMTime() > inputMTime)
+    {
+      inputMTime = inData->GetMTime();
+    }
+  }
+  double camPos[3];
+  double camFocus[3];
+  double camUp[3];
+  cam->GetPosition(camPos);
+  cam->GetFocalPoint(camFocus);
+  cam->GetViewUp(camUp);
+  bool cameraUnchanged = cam->GetParallelScale() == this->LastCameraParallelScale;
+  for (int i = 0; i < 3; ++i)
+  {
+    cameraUnchanged = cameraUnchanged && camPos[i] == this->LastCameraPosition[i] &&
+      camFocus[i] == this->LastCameraFocalPoint[i] && camUp[i] == this->LastCameraViewUp[i];
+  }
+  if (this->Buckets && cameraUnchanged && inputMTime == this->LastInputMTime &&
+    this->GetMTime() <= this->LastSettingsMTime &&
+    this->RenderStrategy->GetMTime() <= this->LastSettingsMTime &&
+    renSize[0] == this->LastRendererSize[0] && renSize[1] == this->LastRendererSize[1] &&
+    !this->UseDepthBuffer && !this->OutputTraversedBounds)
+  {
+    this->RenderStrategy->SetRenderer(ren);
+    this->RenderStrategy->StartFrame();
+    for (Internal::CachedLabel& cached : this->Buckets->PlacedLabels)
+    {
+      if (cached.BoundedWidth > 0)
+      {
+        this->RenderStrategy->RenderLabel(
+          cached.Origin, cached.TextProperty, cached.Label, cached.BoundedWidth);
+        continue;
+      }
+      cached.Rect.Render(ren, this->Shape, this->Style, this->Margin, this->BackgroundColor,
+        this->BackgroundOpacity);
+      if (cached.Type == 0)
+      {
+        this->RenderStrategy->RenderLabel(cached.Origin, cached.TextProperty, cached.Label);
+      }
+    }
+    this->RenderStrategy->EndFrame();
+    this->RenderStrategy->SetRenderer(nullptr);
+    // SetRenderer() modifies the strategy, so refresh the settings time stamp
+    // to keep the cache valid for the next render.
+    this->LastSettingsMTime = this->GetMTime() > this->RenderStrategy->GetMTime()
+      ? this->GetMTime()
+      : this->RenderStrategy->GetMTime();
+    return;
+  }
+
   int tvpsz[4]; // tiled viewport size (and origin)
   // kd-tree bounds on screenspace (as floats... eventually we
   // should use a median kd-tree -- not naive version)
@@ -576,12 +653,14 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
   if (!this->Buckets || this->Buckets->NumTiles[0] * this->Buckets->TileSize[0] < tvpsz[2] ||
     this->Buckets->NumTiles[1] * this->Buckets->TileSize[1] < tvpsz[3])
   {
+    delete this->Buckets;
     this->Buckets = new Internal(kdbounds, tileSize);
   }
   else
   {
     this->Buckets->Reset(kdbounds, tileSize);
   }
+  this->Buckets->PlacedLabels.clear();
 
   float* zPtr = nullptr;
   int placed = 0;
@@ -623,7 +702,6 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
     inIter->SetTraversedBounds(boundsPoly);
   }
 
-  int numInputs = this->GetNumberOfInputConnections(0);
   for (int i = 0; i < numInputs; ++i)
   {
     vtkLabelHierarchy* inData = vtkLabelHierarchy::SafeDownCast(this->GetInputDataObject(0, i));
@@ -780,6 +858,16 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
       // Render it
       this->RenderStrategy->RenderLabel(origin, tpropCopy, inIter->GetLabel(), width);
 
+      Internal::CachedLabel cached;
+      cached.TextProperty = vtkSmartPointer<vtkTextProperty>::New();
+      cached.TextProperty->ShallowCopy(tpropCopy);
+      cached.Label = inIter->GetLabel();
+      cached.Type = labelType;
+      cached.Origin[0] = origin[0];
+      cached.Origin[1] = origin[1];
+      cached.BoundedWidth = width;
+      this->Buckets->PlacedLabels.push_back(cached);
+
       int renderedHeight = static_cast<int>(bds[3] - bds[2]);
       int renderedWidth = static_cast<int>((bds[1] - bds[0] < width) ? (bds[1] - bds[0]) : width);
       renderedLabelArea += static_cast<unsigned long>(renderedWidth * renderedHeight);
@@ -835,6 +923,17 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
         // TODO: Do something ...
       }
 
+      Internal::CachedLabel cached;
+      cached.Rect = r;
+      cached.TextProperty = vtkSmartPointer<vtkTextProperty>::New();
+      cached.TextProperty->ShallowCopy(tpropCopy);
+      cached.Label = inIter->GetLabel();
+      cached.Type = labelType;
+      cached.Origin[0] = origin[0];
+      cached.Origin[1] = origin[1];
+      cached.BoundedWidth = 0;
+      this->Buckets->PlacedLabels.push_back(cached);
+
       vtkDebugMacro("Placed: " << inIter->GetLabelId() << " (" << ll[0] << ", " << ll[1] << "  "
                                << ur[0] << "," << ur[1] << ") " << labelType);
       placed++;
@@ -845,6 +944,20 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
   this->RenderStrategy->EndFrame();
   this->RenderStrategy->SetRenderer(nullptr);
 
+  // Record the state these placements were resolved against so the next
+  // render can replay them when nothing has changed. The settings time stamp
+  // is taken after EndFrame() since SetRenderer() modifies the strategy.
+  this->LastInputMTime = inputMTime;
+  this->LastSettingsMTime = this->GetMTime() > this->RenderStrategy->GetMTime()
+    ? this->GetMTime()
+    : this->RenderStrategy->GetMTime();
+  this->LastRendererSize[0] = renSize[0];
+  this->LastRendererSize[1] = renSize[1];
+  cam->GetPosition(this->LastCameraPosition);
+  cam->GetFocalPoint(this->LastCameraFocalPoint);
+  cam->GetViewUp(this->LastCameraViewUp);
+  this->LastCameraParallelScale = cam->GetParallelScale();
+
   if (this->OutputTraversedBounds)
   {
     // For some reason I cannot use vtkPolyDataMapper, I need to use
@@ -233,6 +233,8 @@ protected:
   double LastCameraFocalPoint[3];
   double LastCameraViewUp[3];
   double LastCameraParallelScale;
+  vtkMTimeType LastInputMTime;
+  vtkMTimeType LastSettingsMTime;
   int IteratorType;
 
   int Style;
@@ -399,6 +399,43 @@ void vtkCompositeMapperHelper2::DrawIBO(vtkRenderer* ren, vtkActor* actor, int p
     bool selecting = this->CurrentSelector != nullptr;
     bool tpass = actor->IsRenderingTranslucentPolygonalGeometry();
 
+    // Consecutive blocks that share the same shader state and occupy adjacent
+    // ranges of the consolidated IBO are folded into a single draw call. With
+    // many-block assemblies this removes nearly all of the per-block driver
+    // overhead. Batching must be disabled whenever the uniforms legitimately
+    // vary per block: hardware selection, selection highlighting, per-block
+    // primitive id offsets, and NaN coloring of blocks missing the color
+    // array.
+    bool canBatch = !selecting && !this->DrawingSelection && !this->PrimIDUsed &&
+      !(this->Parent->GetColorMissingArraysWithNanColor() && this->GetScalarVisibility());
+
+    vtkCompositeMapperHelperData* batchStart = nullptr;
+    unsigned int batchEndIndex = 0;
+    unsigned int batchEndVertex = 0;
+
+    auto flushBatch = [&]() {
+      if (!batchStart)
+      {
+        return;
+      }
+      // compilers think this can exceed the bounds so we also
+      // test against primType even though we should not need to
+      if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
+      {
+        this->SetShaderValues(
+          prog, batchStart, batchStart->CellCellMap->GetPrimitiveOffsets()[primType]);
+      }
+
+      unsigned int count = this->DrawingSelection
+        ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
+        : batchEndIndex - batchStart->StartIndex[primType];
+
+      glDrawRangeElements(mode, static_cast<GLuint>(batchStart->StartVertex),
+        static_cast<GLuint>(batchEndVertex > 0 ? batchEndVertex - 1 : 0), count, GL_UNSIGNED_INT,
+        reinterpret_cast<const GLvoid*>(batchStart->StartIndex[primType] * sizeof(GLuint)));
+      batchStart = nullptr;
+    };
+
     for (auto& data : this->Data)
     {
       vtkCompositeMapperHelperData* starthdata = data.second;
@@ -410,24 +447,31 @@ void vtkCompositeMapperHelper2::DrawIBO(vtkRenderer* ren, vtkActor* actor, int p
                   !selecting)); // translucent during translucent and never selecting
       if (shouldDraw && starthdata->NextIndex[primType] > starthdata->StartIndex[primType])
       {
-        // compilers think this can exceed the bounds so we also
-        // test against primType even though we should not need to
-        if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
+        // a pending batch can only absorb this block if its index range picks
+        // up exactly where the batch ends (skipped blocks with indices in
+        // between break the run) and its color state matches
+        if (batchStart &&
+          (!canBatch || starthdata->StartIndex[primType] != batchEndIndex ||
+            starthdata->Opacity != batchStart->Opacity ||
+            starthdata->AmbientColor != batchStart->AmbientColor ||
+            starthdata->DiffuseColor != batchStart->DiffuseColor ||
+            (this->OverideColorUsed && starthdata->OverridesColor != batchStart->OverridesColor)))
         {
-          this->SetShaderValues(
-            prog, starthdata, starthdata->CellCellMap->GetPrimitiveOffsets()[primType]);
+          flushBatch();
         }
-
-        unsigned int count = this->DrawingSelection
-          ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
-          : starthdata->NextIndex[primType] - starthdata->StartIndex[primType];
-
-        glDrawRangeElements(mode, static_cast<GLuint>(starthdata->StartVertex),
-          static_cast<GLuint>(starthdata->NextVertex > 0 ? starthdata->NextVertex - 1 : 0), count,
-          GL_UNSIGNED_INT,
-          reinterpret_cast<const GLvoid*>(starthdata->StartIndex[primType] * sizeof(GLuint)));
+        if (!batchStart)
+        {
+          batchStart = starthdata;
+          batchEndVertex = starthdata->NextVertex;
+        }
+        else
+        {
+          batchEndVertex = std::max(batchEndVertex, starthdata->NextVertex);
+        }
+        batchEndIndex = starthdata->NextIndex[primType];
       }
     }
+    flushBatch();
     CellBO.IBO->Release();
   }
 }
@@ -16,8 +16,11 @@
 #include "vtkDualDepthPeelingPass.h"
 
 #include "vtkAbstractVolumeMapper.h"
+#include "vtkCamera.h"
 #include "vtkInformation.h"
 #include "vtkInformationKey.h"
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLActor.h"
@@ -804,9 +807,12 @@ vtkDualDepthPeelingPass::vtkDualDepthPeelingPass()
   , CullFaceMode(0)
   , CullFaceEnabled(false)
   , DepthTestEnabled(true)
+  , UsePeelingScissor(false)
 {
   std::fill(this->Textures, this->Textures + static_cast<int>(NumberOfTextures),
     static_cast<vtkTextureObject*>(nullptr));
+  std::fill(this->PeelingScissor, this->PeelingScissor + 4, 0);
+  std::fill(this->SavedScissorBox, this->SavedScissorBox + 4, 0);
 }
 
 //------------------------------------------------------------------------------
@@ -1045,16 +1051,17 @@ void vtkDualDepthPeelingPass::Prepare()
   // The source front buffer must be initialized, since it simply uses additive
   // blending.
   // The back-blending may discard fragments, so the back peel accumulator needs
-  // initialization as well.
-  std::array<TextureName, 2> targets = { { Back, this->FrontSource } };
-  this->ActivateDrawBuffers(targets);
+  // initialization as well. The front destination and back temporary buffers
+  // are cleared here too so texels outside the peeling scissor rectangle stay
+  // transparent.
+  std::array<TextureName, 4> colorTargets = { { Back, BackTemp, FrontA, FrontB } };
+  this->ActivateDrawBuffers(colorTargets);
   this->State->vtkglClearColor(0.f, 0.f, 0.f, 0.f);
   this->State->vtkglClear(GL_COLOR_BUFFER_BIT);
 
   // Fill both depth buffers with -1, -1. This lets us discard fragments in
   // CopyOpaqueDepthBuffers, which gives a moderate performance boost.
-  targets[0] = this->DepthSource;
-  targets[1] = this->DepthDestination;
+  std::array<TextureName, 2> targets = { { this->DepthSource, this->DepthDestination } };
   this->ActivateDrawBuffers(targets);
   this->State->vtkglClearColor(-1, -1, 0, 0);
   this->State->vtkglClear(GL_COLOR_BUFFER_BIT);
@@ -1064,6 +1071,83 @@ void vtkDualDepthPeelingPass::Prepare()
 
   // Initialize the transparent depths for the peeling algorithm:
   this->InitializeDepth();
+
+  // Restrict the peeling passes to the translucent geometry footprint:
+  this->ComputePeelingScissor();
+  if (this->UsePeelingScissor)
+  {
+    this->State->vtkglGetIntegerv(GL_SCISSOR_BOX, this->SavedScissorBox);
+    this->State->vtkglScissor(this->PeelingScissor[0], this->PeelingScissor[1],
+      this->PeelingScissor[2], this->PeelingScissor[3]);
+    this->State->vtkglEnable(GL_SCISSOR_TEST);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDualDepthPeelingPass::ComputePeelingScissor()
+{
+  this->UsePeelingScissor = false;
+
+  vtkRenderer* r = this->RenderState->GetRenderer();
+  vtkCamera* cam = r->GetActiveCamera();
+  size_t numProps = this->RenderState->GetPropArrayCount();
+  if (cam == nullptr || numProps == 0)
+  {
+    return;
+  }
+
+  vtkMatrix4x4* mat = cam->GetCompositeProjectionTransformMatrix(r->GetTiledAspectRatio(), -1, 1);
+
+  double ndcMin[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double ndcMax[2] = { -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  for (size_t i = 0; i < numProps; ++i)
+  {
+    vtkProp* prop = this->RenderState->GetPropArray()[i];
+    const double* bounds = prop->GetBounds();
+    if (!bounds || !vtkMath::AreBoundsInitialized(bounds))
+    {
+      // unknown extent: peel the whole viewport
+      return;
+    }
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      double point[4] = { bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)],
+        bounds[4 + ((corner >> 2) & 1)], 1.0 };
+      double projected[4];
+      mat->MultiplyPoint(point, projected);
+      if (projected[3] <= 0.0)
+      {
+        // the prop crosses the near plane; its screen footprint is unbounded
+        return;
+      }
+      ndcMin[0] = std::min(ndcMin[0], projected[0] / projected[3]);
+      ndcMax[0] = std::max(ndcMax[0], projected[0] / projected[3]);
+      ndcMin[1] = std::min(ndcMin[1], projected[1] / projected[3]);
+      ndcMax[1] = std::max(ndcMax[1], projected[1] / projected[3]);
+    }
+  }
+
+  // normalized device coordinates to pixels, with a small margin for point
+  // and line widths
+  int x0 = vtkMath::Floor((ndcMin[0] * 0.5 + 0.5) * this->ViewportWidth) - 2;
+  int x1 = vtkMath::Ceil((ndcMax[0] * 0.5 + 0.5) * this->ViewportWidth) + 2;
+  int y0 = vtkMath::Floor((ndcMin[1] * 0.5 + 0.5) * this->ViewportHeight) - 2;
+  int y1 = vtkMath::Ceil((ndcMax[1] * 0.5 + 0.5) * this->ViewportHeight) + 2;
+  x0 = std::max(x0, 0);
+  y0 = std::max(y0, 0);
+  x1 = std::min(x1, this->ViewportWidth);
+  y1 = std::min(y1, this->ViewportHeight);
+  if (x0 == 0 && y0 == 0 && x1 == this->ViewportWidth && y1 == this->ViewportHeight)
+  {
+    // the geometry covers the viewport; no need to touch the scissor
+    return;
+  }
+
+  this->PeelingScissor[0] = x0;
+  this->PeelingScissor[1] = y0;
+  this->PeelingScissor[2] = std::max(x1 - x0, 0);
+  this->PeelingScissor[3] = std::max(y1 - y0, 0);
+  this->UsePeelingScissor = true;
 }
 
 //------------------------------------------------------------------------------
@@ -1585,6 +1669,16 @@ void vtkDualDepthPeelingPass::Finalize()
     this->NumberOfRenderedProps += this->VolumetricPass->GetNumberOfRenderedProps();
   }
 
+  // Peeling is done; restore the scissor rectangle saved in Prepare before
+  // blending into the destination framebuffer.
+  if (this->UsePeelingScissor)
+  {
+    this->State->vtkglDisable(GL_SCISSOR_TEST);
+    this->State->vtkglScissor(this->SavedScissorBox[0], this->SavedScissorBox[1],
+      this->SavedScissorBox[2], this->SavedScissorBox[3]);
+    this->UsePeelingScissor = false;
+  }
+
   this->Framebuffer->UnBind(GL_DRAW_FRAMEBUFFER);
   this->State->PopDrawFramebufferBinding();
   this->BlendFinalImage();
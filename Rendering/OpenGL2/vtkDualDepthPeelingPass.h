@@ -190,6 +190,15 @@ protected:
    */
   void Prepare();
 
+  /**
+   * Compute the screen-space bounding rectangle of the translucent props and
+   * restrict the peeling passes to it with a scissor, so per-peel geometry
+   * and blending costs scale with the area actually covered by translucent
+   * geometry. Peels the full viewport when a prop's footprint cannot be
+   * bounded.
+   */
+  void ComputePeelingScissor();
+
   void InitializeOcclusionQuery();
   void CopyOpaqueDepthBuffer();
   void InitializeDepth();
@@ -274,6 +283,12 @@ protected:
   bool CullFaceEnabled;
   bool DepthTestEnabled;
 
+  // Peeling passes are restricted to the screen-space rectangle covering the
+  // translucent geometry:
+  bool UsePeelingScissor;
+  int PeelingScissor[4];
+  int SavedScissorBox[4];
+
 private:
   vtkDualDepthPeelingPass(const vtkDualDepthPeelingPass&) = delete;
   void operator=(const vtkDualDepthPeelingPass&) = delete;
@@ -67,6 +67,7 @@ vtkEDLShading::vtkEDLShading()
 
   this->EDLHighFBO = nullptr;
   this->EDLHighShadeTexture = nullptr;
+  this->EDLReducedShadeTexture = nullptr;
   this->EDLLowFBO = nullptr;
   this->EDLLowShadeTexture = nullptr;
   this->EDLLowBlurTexture = nullptr;
@@ -84,6 +85,8 @@ vtkEDLShading::vtkEDLShading()
     this->EDLNeighbours[c][3] = 0.;
   }
   this->EDLLowResFactor = 2;
+  this->ShadeResolutionFactor = 1;
+  this->ReuseShadingIfStatic = 1;
   this->Zn = 0.1;
   this->Zf = 1.0;
 }
@@ -116,6 +119,11 @@ vtkEDLShading::~vtkEDLShading()
     vtkErrorMacro(<< "ColorTexture should have been deleted in "
                   << "ReleaseGraphicsResources().");
   }
+  if (this->EDLReducedShadeTexture != nullptr)
+  {
+    vtkErrorMacro(<< "ColorTexture should have been deleted in "
+                  << "ReleaseGraphicsResources().");
+  }
   if (this->EDLLowFBO != nullptr)
   {
     vtkErrorMacro(<< "FrameBufferObject should have been deleted in "
@@ -235,6 +243,30 @@ void vtkEDLShading::EDLInitializeFramebuffers(vtkRenderState& s)
   this->EDLHighFBO->AddDepthAttachment();
   renWin->GetState()->PopFramebufferBindings();
 
+  // Reduced resolution shade texture, upsampled into EDLHighShadeTexture
+  if (this->ShadeResolutionFactor > 1)
+  {
+    if (this->EDLReducedShadeTexture == nullptr)
+    {
+      this->EDLReducedShadeTexture = vtkTextureObject::New();
+      this->EDLReducedShadeTexture->SetContext(this->EDLHighFBO->GetContext());
+    }
+    if (this->EDLReducedShadeTexture->GetWidth() !=
+        static_cast<unsigned int>(this->W / this->ShadeResolutionFactor) ||
+      this->EDLReducedShadeTexture->GetHeight() !=
+        static_cast<unsigned int>(this->H / this->ShadeResolutionFactor))
+    {
+      this->EDLReducedShadeTexture->Create2D(this->W / this->ShadeResolutionFactor,
+        this->H / this->ShadeResolutionFactor, 4, VTK_FLOAT, false);
+    }
+    this->EDLReducedShadeTexture->SetWrapS(vtkTextureObject::ClampToEdge);
+    this->EDLReducedShadeTexture->SetWrapT(vtkTextureObject::ClampToEdge);
+    this->EDLReducedShadeTexture->SetMinificationFilter(vtkTextureObject::Linear);
+    this->EDLReducedShadeTexture->SetLinearMagnification(true);
+    this->EDLReducedShadeTexture->Bind();
+    this->EDLReducedShadeTexture->SendParameters();
+  }
+
   //  EDL-RES2 FBO and TEXTURE
   //
   if (this->EDLLowFBO == nullptr)
@@ -341,23 +373,28 @@ bool vtkEDLShading::EDLShadeHigh(vtkRenderState& s, vtkOpenGLRenderWindow* renWi
   //
   float d = 1.0;
   float F_scale = 5.0;
-  float SX = 1. / float(this->W);
-  float SY = 1. / float(this->H);
+  int factor = this->ShadeResolutionFactor;
+  int shadeW = this->W / factor;
+  int shadeH = this->H / factor;
+  float SX = 1. / float(shadeW);
+  float SY = 1. / float(shadeH);
   float L[3] = { 0., 0., -1. };
 
   // ACTIVATE SHADER
   //
   renWin->GetShaderCache()->ReadyShaderProgram(this->EDLShadeProgram.Program);
 
-  // ACTIVATE FBO
+  // ACTIVATE FBO - shade at full or reduced resolution
   //
   s.SetFrameBuffer(this->EDLHighFBO);
-  this->EDLHighShadeTexture->Activate();
+  vtkTextureObject* shadeTarget =
+    factor > 1 ? this->EDLReducedShadeTexture : this->EDLHighShadeTexture;
+  shadeTarget->Activate();
   renWin->GetState()->PushFramebufferBindings();
   this->EDLHighFBO->Bind();
-  this->EDLHighFBO->AddColorAttachment(0, this->EDLHighShadeTexture);
+  this->EDLHighFBO->AddColorAttachment(0, shadeTarget);
   this->EDLHighFBO->ActivateDrawBuffer(0);
-  this->EDLHighFBO->Start(this->W, this->H);
+  this->EDLHighFBO->Start(shadeW, shadeH);
 
   // DEPTH TEXTURE PARAMETERS
   this->ProjectionDepthTexture->Activate();
@@ -410,11 +447,42 @@ bool vtkEDLShading::EDLShadeHigh(vtkRenderState& s, vtkOpenGLRenderWindow* renWi
   prog->SetUniformf("SceneSize", diag);
 
   // RENDER AND FREE ALL
-  this->EDLHighFBO->RenderQuad(0, this->W - 1, 0, this->H - 1, prog, this->EDLShadeProgram.VAO);
+  this->EDLHighFBO->RenderQuad(0, shadeW - 1, 0, shadeH - 1, prog, this->EDLShadeProgram.VAO);
 
   //
   this->ProjectionDepthTexture->Deactivate();
-  this->EDLHighShadeTexture->Deactivate();
+  shadeTarget->Deactivate();
+
+  if (factor > 1)
+  {
+    // Upsample the reduced shading to full resolution with the bilateral
+    // filter: low resolution samples are weighted by their depth difference
+    // to the full resolution fragment, which keeps silhouettes crisp.
+    renWin->GetShaderCache()->ReadyShaderProgram(this->BilateralProgram.Program);
+    vtkShaderProgram* upsample = this->BilateralProgram.Program;
+
+    this->EDLHighShadeTexture->Activate();
+    this->EDLHighFBO->AddColorAttachment(0, this->EDLHighShadeTexture);
+    this->EDLHighFBO->ActivateDrawBuffer(0);
+    this->EDLHighFBO->Start(this->W, this->H);
+
+    this->EDLReducedShadeTexture->Activate();
+    this->ProjectionDepthTexture->Activate();
+    upsample->SetUniformi("s2_I", this->EDLReducedShadeTexture->GetTextureUnit());
+    upsample->SetUniformi("s2_D", this->ProjectionDepthTexture->GetTextureUnit());
+    upsample->SetUniformf("SX", SX);
+    upsample->SetUniformf("SY", SY);
+    upsample->SetUniformi("N", 3);
+    upsample->SetUniformf("sigma", 2.0f);
+
+    this->EDLHighFBO->RenderQuad(
+      0, this->W - 1, 0, this->H - 1, upsample, this->BilateralProgram.VAO);
+
+    this->EDLReducedShadeTexture->Deactivate();
+    this->ProjectionDepthTexture->Deactivate();
+    this->EDLHighShadeTexture->Deactivate();
+  }
+
   renWin->GetState()->PopFramebufferBindings();
 
   return true; // succeeded
@@ -668,40 +736,62 @@ void vtkEDLShading::Render(const vtkRenderState* s)
 
     // system("PAUSE");
 
-    //////////////////////////////////////////////////////
-    //
-    // 5. EDL SHADING PASS - FULL RESOLUTION
-    //
-#if EDL_HIGH_RESOLUTION_ON
-    annotate("Start vtkEDLShading::ShadeHigh");
-    if (!this->EDLShadeHigh(s2, renWin))
+    // When the camera and the props are unchanged since the previous frame
+    // (e.g. only annotations were modified), the shaded buffers still match
+    // the scene and the shading and blur passes can be skipped; the buffers
+    // from the previous frame are composed again below.
+    vtkStateStorage shadingState;
+    shadingState.Append(this->W, "width");
+    shadingState.Append(this->H, "height");
+    shadingState.Append(this->ShadeResolutionFactor, "shade factor");
+    shadingState.Append(this->EDLLowResFactor, "low res factor");
+    shadingState.Append(r->GetActiveCamera()->GetMTime(), "camera mtime");
+    shadingState.Append(s->GetPropArrayCount(), "prop count");
+    for (int i = 0; i < s->GetPropArrayCount(); i++)
     {
-      renWin->GetState()->PopFramebufferBindings();
+      shadingState.Append(s->GetPropArray()[i]->GetRedrawMTime(), "prop mtime");
     }
-    annotate("End vtkEDLShading::ShadeHigh");
+    bool reuseShading = this->ReuseShadingIfStatic && !(this->ShadingState != shadingState);
+    if (!reuseShading)
+    {
+      this->ShadingState = shadingState;
+
+      //////////////////////////////////////////////////////
+      //
+      // 5. EDL SHADING PASS - FULL RESOLUTION
+      //
+#if EDL_HIGH_RESOLUTION_ON
+      annotate("Start vtkEDLShading::ShadeHigh");
+      if (!this->EDLShadeHigh(s2, renWin))
+      {
+        renWin->GetState()->PopFramebufferBindings();
+      }
+      annotate("End vtkEDLShading::ShadeHigh");
 #endif // EDL_HIGH_RESOLUTION_ON
 
-    //////////////////////////////////////////////////////
-    //
-    // 6. EDL SHADING PASS - LOW RESOLUTION + blur pass
-    //
+      //////////////////////////////////////////////////////
+      //
+      // 6. EDL SHADING PASS - LOW RESOLUTION + blur pass
+      //
 #if EDL_LOW_RESOLUTION_ON
-    annotate("Start vtkEDLShading::ShadeLow");
-    if (!this->EDLShadeLow(s2, renWin))
-    {
-      renWin->GetState()->PopFramebufferBindings();
-    }
-    annotate("End vtkEDLShading::ShadeLow");
-    if (this->EDLIsFiltered)
-    {
-      annotate("Start vtkEDLShading::BlurLow");
-      this->EDLBlurLow(s2, renWin);
-      annotate("End vtkEDLShading::BlurLow");
-    }
-    // Low-res processing reduces the viewport dimensions.
-    // Reset the viewport after to ensure that following passes get the right viewport size.
-    renWin->GetState()->vtkglViewport(this->Origin[0], this->Origin[1], this->Width, this->Height);
+      annotate("Start vtkEDLShading::ShadeLow");
+      if (!this->EDLShadeLow(s2, renWin))
+      {
+        renWin->GetState()->PopFramebufferBindings();
+      }
+      annotate("End vtkEDLShading::ShadeLow");
+      if (this->EDLIsFiltered)
+      {
+        annotate("Start vtkEDLShading::BlurLow");
+        this->EDLBlurLow(s2, renWin);
+        annotate("End vtkEDLShading::BlurLow");
+      }
+      // Low-res processing reduces the viewport dimensions.
+      // Reset the viewport after to ensure that following passes get the right viewport size.
+      renWin->GetState()->vtkglViewport(
+        this->Origin[0], this->Origin[1], this->Width, this->Height);
 #endif // EDL_LOW_RESOLUTION_ON
+    }
 
     //////////////////////////////////////////////////////
     //
@@ -769,6 +859,11 @@ void vtkEDLShading::ReleaseGraphicsResources(vtkWindow* w)
     this->EDLHighShadeTexture->Delete();
     this->EDLHighShadeTexture = nullptr;
   }
+  if (this->EDLReducedShadeTexture != nullptr)
+  {
+    this->EDLReducedShadeTexture->Delete();
+    this->EDLReducedShadeTexture = nullptr;
+  }
   if (this->EDLLowFBO != nullptr)
   {
     this->EDLLowFBO->Delete();
@@ -46,6 +46,7 @@ Ph.D. thesis of Christian BOUCHENY.
 #include "vtkOpenGLHelper.h"           // used for ivars
 #include "vtkRenderingOpenGL2Module.h" // For export macro
 #include "vtkSmartPointer.h"           // needed for vtkSmartPointer
+#include "vtkStateStorage.h"           // used for ivars
 
 class vtkOpenGLRenderWindow;
 class vtkOpenGLFramebufferObject;
@@ -71,6 +72,31 @@ public:
    */
   void ReleaseGraphicsResources(vtkWindow* w) override;
 
+  ///@{
+  /**
+   * Get/Set the resolution divider of the full resolution shading pass.
+   * When greater than 1, the detail shading is computed on a buffer whose
+   * width and height are divided by this factor and upsampled to full
+   * resolution with the depth-aware bilateral filter, which is much cheaper
+   * on large framebuffers. Default is 1 (shade at full resolution).
+   */
+  vtkSetClampMacro(ShadeResolutionFactor, int, 1, 8);
+  vtkGetMacro(ShadeResolutionFactor, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether the shaded buffers of the previous frame are reused when
+   * the camera and the props are unchanged since that frame (e.g. only
+   * annotations were modified). The delegate still renders and the result is
+   * still composed, but the shading and blur passes are skipped.
+   * Default is true.
+   */
+  vtkSetMacro(ReuseShadingIfStatic, vtkTypeBool);
+  vtkGetMacro(ReuseShadingIfStatic, vtkTypeBool);
+  vtkBooleanMacro(ReuseShadingIfStatic, vtkTypeBool);
+  ///@}
+
 protected:
   /**
    * Default constructor. DelegatePass is set to NULL.
@@ -129,6 +155,9 @@ protected:
   // for EDL full res shading
   vtkTextureObject* EDLHighShadeTexture;
   // color render target for EDL full res pass
+  vtkTextureObject* EDLReducedShadeTexture;
+  // reduced resolution detail shading, upsampled into EDLHighShadeTexture
+  // when ShadeResolutionFactor > 1
   vtkOpenGLFramebufferObject* EDLLowFBO;
   // for EDL low res shading (image size/4)
   vtkTextureObject* EDLLowShadeTexture;
@@ -145,6 +174,12 @@ protected:
   float EDLNeighbours[8][4];
   bool EDLIsFiltered;
   int EDLLowResFactor; // basically 4
+  int ShadeResolutionFactor;
+
+  // State the shaded buffers were computed from; when it is unchanged the
+  // shading passes are skipped and the buffers reused.
+  vtkTypeBool ReuseShadingIfStatic;
+  vtkStateStorage ShadingState;
 
   float Zn; // near clipping plane
   float Zf; // far clipping plane
@@ -36,6 +36,20 @@ inline GLenum convertType(vtkOpenGLBufferObject::ObjectType type)
       return GL_ARRAY_BUFFER;
   }
 }
+
+inline GLenum convertUsage(vtkOpenGLBufferObject::ObjectUsage usage)
+{
+  switch (usage)
+  {
+    case vtkOpenGLBufferObject::DynamicDraw:
+      return GL_DYNAMIC_DRAW;
+    case vtkOpenGLBufferObject::StreamDraw:
+      return GL_STREAM_DRAW;
+    default:
+    case vtkOpenGLBufferObject::StaticDraw:
+      return GL_STATIC_DRAW;
+  }
+}
 }
 
 struct vtkOpenGLBufferObject::Private
@@ -44,9 +58,13 @@ struct vtkOpenGLBufferObject::Private
   {
     this->Handle = 0;
     this->Type = GL_ARRAY_BUFFER;
+    this->Usage = GL_STATIC_DRAW;
+    this->AllocatedSize = 0;
   }
   GLenum Type;
+  GLenum Usage;
   GLuint Handle;
+  size_t AllocatedSize;
 };
 
 vtkOpenGLBufferObject::vtkOpenGLBufferObject()
@@ -72,6 +90,7 @@ void vtkOpenGLBufferObject::ReleaseGraphicsResources()
     glBindBuffer(this->Internal->Type, 0);
     glDeleteBuffers(1, &this->Internal->Handle);
     this->Internal->Handle = 0;
+    this->Internal->AllocatedSize = 0;
   }
 }
 
@@ -80,6 +99,24 @@ void vtkOpenGLBufferObject::SetType(vtkOpenGLBufferObject::ObjectType value)
   this->Internal->Type = convertType(value);
 }
 
+void vtkOpenGLBufferObject::SetUsage(vtkOpenGLBufferObject::ObjectUsage value)
+{
+  this->Internal->Usage = convertUsage(value);
+}
+
+vtkOpenGLBufferObject::ObjectUsage vtkOpenGLBufferObject::GetUsage() const
+{
+  if (this->Internal->Usage == GL_DYNAMIC_DRAW)
+  {
+    return vtkOpenGLBufferObject::DynamicDraw;
+  }
+  if (this->Internal->Usage == GL_STREAM_DRAW)
+  {
+    return vtkOpenGLBufferObject::StreamDraw;
+  }
+  return vtkOpenGLBufferObject::StaticDraw;
+}
+
 vtkOpenGLBufferObject::ObjectType vtkOpenGLBufferObject::GetType() const
 {
   if (this->Internal->Type == GL_ARRAY_BUFFER)
@@ -145,7 +182,42 @@ bool vtkOpenGLBufferObject::UploadInternal(
   }
 
   glBindBuffer(this->Internal->Type, this->Internal->Handle);
-  glBufferData(this->Internal->Type, size, static_cast<const GLvoid*>(buffer), GL_STATIC_DRAW);
+  if (this->Internal->Usage != GL_STATIC_DRAW && this->Internal->AllocatedSize >= size &&
+    this->Internal->AllocatedSize > 0)
+  {
+    // dynamic re-upload that fits: update the storage in place rather than
+    // orphaning the allocation
+    glBufferSubData(this->Internal->Type, 0, size, static_cast<const GLvoid*>(buffer));
+  }
+  else
+  {
+    glBufferData(
+      this->Internal->Type, size, static_cast<const GLvoid*>(buffer), this->Internal->Usage);
+    this->Internal->AllocatedSize = size;
+  }
+  this->Dirty = false;
+  return true;
+}
+
+bool vtkOpenGLBufferObject::UploadRangeInternal(
+  const void* buffer, ptrdiff_t offset, size_t size, vtkOpenGLBufferObject::ObjectType objectType)
+{
+  const bool generated = this->GenerateBuffer(objectType);
+  if (!generated)
+  {
+    this->Error = "Trying to upload array buffer to incompatible buffer.";
+    return false;
+  }
+
+  glBindBuffer(this->Internal->Type, this->Internal->Handle);
+  if (static_cast<size_t>(offset) + size > this->Internal->AllocatedSize)
+  {
+    // Growing the buffer requires a re-allocation; the contents outside the
+    // uploaded range are left undefined.
+    glBufferData(this->Internal->Type, offset + size, nullptr, this->Internal->Usage);
+    this->Internal->AllocatedSize = static_cast<size_t>(offset) + size;
+  }
+  glBufferSubData(this->Internal->Type, offset, size, static_cast<const GLvoid*>(buffer));
   this->Dirty = false;
   return true;
 }
@@ -44,12 +44,32 @@ public:
     TextureBuffer
   };
 
+  enum ObjectUsage
+  {
+    StaticDraw,
+    DynamicDraw,
+    StreamDraw
+  };
+
   /** Get the type of the buffer object. */
   ObjectType GetType() const;
 
   /** Set the type of the buffer object. */
   void SetType(ObjectType value);
 
+  ///@{
+  /**
+   * The usage hint handed to OpenGL when allocating storage. StaticDraw,
+   * the default, matches the historical behavior. With DynamicDraw or
+   * StreamDraw, an upload that fits in the existing allocation updates the
+   * storage in place instead of re-allocating it, which avoids the
+   * orphan-and-sync cost of calling glBufferData on every frame for
+   * frequently changing data.
+   */
+  ObjectUsage GetUsage() const;
+  void SetUsage(ObjectUsage value);
+  ///@}
+
   /** Get the handle of the buffer object. */
   int GetHandle() const;
 
@@ -75,6 +95,18 @@ public:
   template <class T>
   bool Upload(const T* array, size_t numElements, ObjectType type);
 
+  /**
+   * Upload a range of data into the buffer object with glBufferSubData,
+   * starting at @a offset bytes into the buffer. The existing storage is
+   * updated in place; the buffer is only re-allocated when the range does
+   * not fit, in which case the contents outside the range are undefined.
+   * Use this instead of Upload() for frequently changing data (e.g.
+   * per-instance attributes) to avoid re-allocating driver storage on
+   * every update.
+   */
+  template <class T>
+  bool UploadRange(const T& array, ptrdiff_t offset, ObjectType type);
+
   /**
    * Bind the buffer object ready for rendering.
    * @note Only one ARRAY_BUFFER and one ELEMENT_ARRAY_BUFFER may be bound at
@@ -103,6 +135,7 @@ protected:
   std::string Error;
 
   bool UploadInternal(const void* buffer, size_t size, ObjectType objectType);
+  bool UploadRangeInternal(const void* buffer, ptrdiff_t offset, size_t size, ObjectType objectType);
 
 private:
   vtkOpenGLBufferObject(const vtkOpenGLBufferObject&) = delete;
@@ -136,4 +169,18 @@ inline bool vtkOpenGLBufferObject::Upload(
   return this->UploadInternal(array, numElements * sizeof(T), objectType);
 }
 
+template <class T>
+inline bool vtkOpenGLBufferObject::UploadRange(
+  const T& array, ptrdiff_t offset, vtkOpenGLBufferObject::ObjectType objectType)
+{
+  if (array.empty())
+  {
+    this->Error = "Refusing to upload empty array.";
+    return false;
+  }
+
+  return this->UploadRangeInternal(
+    &array[0], offset, array.size() * sizeof(typename T::value_type), objectType);
+}
+
 #endif
@@ -379,17 +379,19 @@ void vtkOpenGLGlyph3DHelper::GlyphRenderInstances(vtkRenderer* ren, vtkActor* ac
 
   bool withNormals = (this->VBOs->GetNumberOfComponents("normalMC") == 3);
 
-  // update the VBOs if needed
+  // update the VBOs if needed. UploadRange updates the persistent instance
+  // buffers in place so animating glyphs do not re-allocate driver storage
+  // on every change.
   if (pointMTime > this->InstanceBuffersBuildTime.GetMTime())
   {
-    this->MatrixBuffer->Upload(matrices, vtkOpenGLBufferObject::ArrayBuffer);
+    this->MatrixBuffer->UploadRange(matrices, 0, vtkOpenGLBufferObject::ArrayBuffer);
 
     if (withNormals)
     {
-      this->NormalMatrixBuffer->Upload(normalMatrices, vtkOpenGLBufferObject::ArrayBuffer);
+      this->NormalMatrixBuffer->UploadRange(normalMatrices, 0, vtkOpenGLBufferObject::ArrayBuffer);
     }
 
-    this->ColorBuffer->Upload(colors, vtkOpenGLBufferObject::ArrayBuffer);
+    this->ColorBuffer->UploadRange(colors, 0, vtkOpenGLBufferObject::ArrayBuffer);
     this->InstanceBuffersBuildTime.Modified();
   }
 
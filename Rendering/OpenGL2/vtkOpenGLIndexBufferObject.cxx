@@ -19,6 +19,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkDataArrayRange.h"
+#include "vtkOpenGLIndexBufferObjectCache.h"
 #include "vtkPoints.h"
 #include "vtkPolygon.h"
 #include "vtkProperty.h"
@@ -33,10 +34,21 @@ vtkStandardNewMacro(vtkOpenGLIndexBufferObject);
 vtkOpenGLIndexBufferObject::vtkOpenGLIndexBufferObject()
 {
   this->IndexCount = 0;
+  this->Cache = nullptr;
   this->SetType(vtkOpenGLIndexBufferObject::ElementArrayBuffer);
 }
 
-vtkOpenGLIndexBufferObject::~vtkOpenGLIndexBufferObject() = default;
+vtkOpenGLIndexBufferObject::~vtkOpenGLIndexBufferObject()
+{
+  if (this->Cache)
+  {
+    this->Cache->RemoveIBO(this);
+    this->Cache->Delete();
+    this->Cache = nullptr;
+  }
+}
+
+vtkCxxSetObjectMacro(vtkOpenGLIndexBufferObject, Cache, vtkOpenGLIndexBufferObjectCache);
 
 namespace
 {
@@ -17,6 +17,8 @@
 #include "vtkOpenGLBufferObject.h"
 #include "vtkRenderingOpenGL2Module.h" // for export macro
 
+class vtkOpenGLIndexBufferObjectCache;
+
 /**
  * @brief OpenGL vertex buffer object
  *
@@ -95,10 +97,17 @@ public:
   static void AppendVertexIndexBuffer(
     std::vector<unsigned int>& indexArray, vtkCellArray** cells, vtkIdType vertexOffset);
 
+  // IBOs may hold onto the cache, never the other way around. The cache
+  // entry for this IBO is removed when the IBO is destroyed.
+  void SetCache(vtkOpenGLIndexBufferObjectCache* cache);
+  vtkGetObjectMacro(Cache, vtkOpenGLIndexBufferObjectCache);
+
 protected:
   vtkOpenGLIndexBufferObject();
   ~vtkOpenGLIndexBufferObject() override;
 
+  vtkOpenGLIndexBufferObjectCache* Cache;
+
 private:
   vtkOpenGLIndexBufferObject(const vtkOpenGLIndexBufferObject&) = delete;
   void operator=(const vtkOpenGLIndexBufferObject&) = delete;
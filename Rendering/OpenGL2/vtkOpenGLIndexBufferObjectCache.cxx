@@ -0,0 +1,109 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLIndexBufferObjectCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkOpenGLIndexBufferObjectCache.h"
+
+#include "vtkCellArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkOpenGLIndexBufferObject.h"
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkOpenGLIndexBufferObjectCache);
+
+//------------------------------------------------------------------------------
+vtkOpenGLIndexBufferObjectCache::vtkOpenGLIndexBufferObjectCache() = default;
+
+//------------------------------------------------------------------------------
+// Every cached IBO holds a reference to this cache and removes itself when
+// it is destroyed, so by the time the cache goes away the map is empty.
+vtkOpenGLIndexBufferObjectCache::~vtkOpenGLIndexBufferObjectCache() = default;
+
+//------------------------------------------------------------------------------
+void vtkOpenGLIndexBufferObjectCache::RemoveIBO(vtkOpenGLIndexBufferObject* ibo)
+{
+  IBOMap::iterator iter = this->MappedIBOs.begin();
+  while (iter != this->MappedIBOs.end())
+  {
+    std::vector<std::unique_ptr<CacheEntry>>& variants = iter->second;
+    for (size_t j = 0; j < variants.size();)
+    {
+      if (variants[j]->IBO == ibo)
+      {
+        variants.erase(variants.begin() + j);
+      }
+      else
+      {
+        ++j;
+      }
+    }
+    if (variants.empty())
+    {
+      iter->first->UnRegister(this);
+      this->MappedIBOs.erase(iter++);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLIndexBufferObject* vtkOpenGLIndexBufferObjectCache::GetIBO(
+  vtkCellArray* cells, const vtkStateStorage& buildState, bool& rebuildNeeded)
+{
+  if (cells == nullptr)
+  {
+    vtkErrorMacro(<< "Cannot get IBO for null cell array.");
+    return nullptr;
+  }
+
+  IBOMap::iterator iter = this->MappedIBOs.find(cells);
+  if (iter == this->MappedIBOs.end())
+  {
+    cells->Register(this);
+    iter = this->MappedIBOs.emplace(cells, std::vector<std::unique_ptr<CacheEntry>>()).first;
+  }
+
+  std::vector<std::unique_ptr<CacheEntry>>& variants = iter->second;
+  for (auto& variant : variants)
+  {
+    if (!(variant->BuildState != buildState))
+    {
+      // up to date IBO, share as is
+      rebuildNeeded = false;
+      variant->IBO->Register(this);
+      return variant->IBO;
+    }
+  }
+
+  // No variant matches the requested state: create a new empty IBO the
+  // caller must fill. The cache holds no reference of its own; the IBO
+  // removes its entry when the last mapper using it drops its reference,
+  // so stale variants (and their GPU buffers) do not accumulate.
+  variants.emplace_back(new CacheEntry);
+  CacheEntry* entry = variants.back().get();
+  entry->BuildState = buildState;
+  entry->IBO = vtkOpenGLIndexBufferObject::New();
+  entry->IBO->SetCache(this);
+  rebuildNeeded = true;
+  return entry->IBO;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLIndexBufferObjectCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfCellArrays: " << this->MappedIBOs.size() << "\n";
+}
@@ -0,0 +1,81 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkOpenGLIndexBufferObjectCache.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkOpenGLIndexBufferObjectCache
+ * @brief   manage index buffer objects shared within a context
+ *
+ * This class allows mappers to share IBOs, the same way
+ * vtkOpenGLVertexBufferObjectCache allows them to share VBOs. Index
+ * buffers built from the same vtkCellArray with the same build options
+ * (representation, edge flags, etc., captured in a vtkStateStorage) are
+ * uploaded once per context instead of once per mapper, which matters
+ * when many actors share the same polydata.
+ */
+
+#ifndef vtkOpenGLIndexBufferObjectCache_h
+#define vtkOpenGLIndexBufferObjectCache_h
+
+#include "vtkObject.h"
+#include "vtkRenderingOpenGL2Module.h" // For export macro
+#include "vtkStateStorage.h"           // for ivar
+#include <map>                         // for methods
+#include <memory>                      // for methods
+#include <vector>                      // for methods
+
+class vtkCellArray;
+class vtkOpenGLIndexBufferObject;
+
+class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLIndexBufferObjectCache : public vtkObject
+{
+public:
+  static vtkOpenGLIndexBufferObjectCache* New();
+  vtkTypeMacro(vtkOpenGLIndexBufferObjectCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns the index buffer object for the given cell array and build
+   * state. When no IBO exists for that combination a new empty one is
+   * created and rebuildNeeded is set to true: the caller must then fill
+   * and upload it. The return value has been registered, you are
+   * responsible for deleting it. The cell array is also registered.
+   */
+  vtkOpenGLIndexBufferObject* GetIBO(
+    vtkCellArray* cells, const vtkStateStorage& buildState, bool& rebuildNeeded);
+
+  /**
+   * Removes all references to a given index buffer object.
+   */
+  void RemoveIBO(vtkOpenGLIndexBufferObject* ibo);
+
+  struct CacheEntry
+  {
+    // vtkStateStorage is not copyable, entries are held by pointer
+    vtkStateStorage BuildState;
+    vtkOpenGLIndexBufferObject* IBO = nullptr;
+  };
+  typedef std::map<vtkCellArray*, std::vector<std::unique_ptr<CacheEntry>>> IBOMap;
+
+protected:
+  vtkOpenGLIndexBufferObjectCache();
+  ~vtkOpenGLIndexBufferObjectCache() override;
+
+  IBOMap MappedIBOs;
+
+private:
+  vtkOpenGLIndexBufferObjectCache(const vtkOpenGLIndexBufferObjectCache&) = delete;
+  void operator=(const vtkOpenGLIndexBufferObjectCache&) = delete;
+};
+
+#endif
@@ -76,6 +76,8 @@ public:
   // called by our Owner skips some stuff
   void GaussianRender(vtkRenderer* ren, vtkActor* act);
 
+  void ReleaseGraphicsResources(vtkWindow* win) override;
+
 protected:
   vtkOpenGLPointGaussianMapperHelper();
   ~vtkOpenGLPointGaussianMapperHelper() override;
@@ -114,6 +116,11 @@ protected:
   // Does the shader source need to be recomputed
   bool GetNeedToRebuildShaders(vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act) override;
 
+  // Description:
+  // Strided subset of the splats drawn during interactive renders when the
+  // owner's LODEnable is on; empty when the full set is small enough.
+  vtkOpenGLIndexBufferObject* LODIBO;
+
 private:
   vtkOpenGLPointGaussianMapperHelper(const vtkOpenGLPointGaussianMapperHelper&) = delete;
   void operator=(const vtkOpenGLPointGaussianMapperHelper&) = delete;
@@ -135,6 +142,7 @@ vtkOpenGLPointGaussianMapperHelper::vtkOpenGLPointGaussianMapperHelper()
   this->ScaleScale = 1.0;
   this->OpacityOffset = 0.0;
   this->ScaleOffset = 0.0;
+  this->LODIBO = vtkOpenGLIndexBufferObject::New();
 }
 
 //------------------------------------------------------------------------------
@@ -242,7 +250,18 @@ bool vtkOpenGLPointGaussianMapperHelper::GetNeedToRebuildShaders(
 }
 
 //------------------------------------------------------------------------------
-vtkOpenGLPointGaussianMapperHelper::~vtkOpenGLPointGaussianMapperHelper() = default;
+vtkOpenGLPointGaussianMapperHelper::~vtkOpenGLPointGaussianMapperHelper()
+{
+  this->LODIBO->Delete();
+  this->LODIBO = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLPointGaussianMapperHelper::ReleaseGraphicsResources(vtkWindow* win)
+{
+  this->LODIBO->ReleaseGraphicsResources();
+  this->Superclass::ReleaseGraphicsResources(win);
+}
 
 //------------------------------------------------------------------------------
 void vtkOpenGLPointGaussianMapperHelper::SetCameraShaderParameters(
@@ -617,6 +636,24 @@ void vtkOpenGLPointGaussianMapperHelper::BuildBufferObjects(
     this->Primitives[i].IBO->IndexCount = 0;
   }
   this->Primitives[PrimitiveTris].IBO->IndexCount = splatCount;
+
+  // When LOD is on and the full set is larger than the target, build an
+  // index buffer selecting an evenly strided subset for interactive renders.
+  this->LODIBO->IndexCount = 0;
+  if (this->Owner->GetLODEnable() && splatCount > this->Owner->GetLODTargetPoints())
+  {
+    vtkIdType target = this->Owner->GetLODTargetPoints();
+    vtkIdType stride = (splatCount + target - 1) / target;
+    std::vector<unsigned int> lodIndices;
+    lodIndices.reserve(static_cast<size_t>(splatCount / stride + 1));
+    for (vtkIdType i = 0; i < splatCount; i += stride)
+    {
+      lodIndices.push_back(static_cast<unsigned int>(i));
+    }
+    this->LODIBO->Upload(lodIndices, vtkOpenGLBufferObject::ElementArrayBuffer);
+    this->LODIBO->IndexCount = lodIndices.size();
+  }
+
   this->VBOBuildTime.Modified();
 }
 
@@ -628,7 +665,21 @@ void vtkOpenGLPointGaussianMapperHelper::RenderPieceDraw(vtkRenderer* ren, vtkAc
   if (numVerts)
   {
     this->UpdateShaders(this->Primitives[PrimitiveTris], ren, actor);
-    glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+
+    // Draw the strided LOD subset during interactive renders; still renders
+    // and picking renders always draw the full set.
+    if (this->LODIBO->IndexCount > 0 && !ren->GetSelector() &&
+      ren->GetRenderWindow()->GetDesiredUpdateRate() >= 1.0)
+    {
+      this->LODIBO->Bind();
+      glDrawElements(
+        GL_POINTS, static_cast<GLsizei>(this->LODIBO->IndexCount), GL_UNSIGNED_INT, nullptr);
+      this->LODIBO->Release();
+    }
+    else
+    {
+      glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+    }
   }
 }
 
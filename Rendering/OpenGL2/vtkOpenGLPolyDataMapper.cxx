@@ -38,6 +38,7 @@
 #include "vtkOpenGLError.h"
 #include "vtkOpenGLHelper.h"
 #include "vtkOpenGLIndexBufferObject.h"
+#include "vtkOpenGLIndexBufferObjectCache.h"
 #include "vtkOpenGLRenderPass.h"
 #include "vtkOpenGLRenderTimer.h"
 #include "vtkOpenGLRenderWindow.h"
@@ -211,6 +212,15 @@ void vtkOpenGLPolyDataMapper::ReleaseGraphicsResources(vtkWindow* win)
   for (int i = vtkOpenGLPolyDataMapper::PrimitiveStart; i < vtkOpenGLPolyDataMapper::PrimitiveEnd;
        i++)
   {
+    // IBOs obtained from the context's IBO cache may still be in use by
+    // other mappers, so drop our reference instead of releasing their
+    // graphics resources: the GL buffer is freed (and the cache entry
+    // removed) when the last mapper using the IBO lets go of it.
+    if (this->Primitives[i].IBO->GetCache())
+    {
+      this->Primitives[i].IBO->Delete();
+      this->Primitives[i].IBO = vtkOpenGLIndexBufferObject::New();
+    }
     this->Primitives[i].ReleaseGraphicsResources(win);
     this->SelectionPrimitives[i].ReleaseGraphicsResources(win);
   }
@@ -3977,36 +3987,96 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
     this->EdgeValues.clear();
 
     this->IBOBuildState = this->TempState;
-    this->Primitives[PrimitivePoints].IBO->CreatePointIndexBuffer(prims[0]);
+
+    // IBOs built purely from a cell array (no per-mapper data such as edge
+    // values) are shared through the context wide cache so that many actors
+    // showing the same polydata upload the indices only once. The mode value
+    // distinguishes the different index layouts a cell array can produce.
+    vtkOpenGLIndexBufferObjectCache* iboCache =
+      static_cast<vtkOpenGLRenderWindow*>(ren->GetVTKWindow())->GetIBOCache();
+    auto acquireSharedIBO = [iboCache](vtkOpenGLHelper& prim, vtkCellArray* cells, int mode,
+                              vtkMTimeType auxTime) -> bool {
+      vtkStateStorage buildState;
+      buildState.Append(mode, "ibo mode");
+      buildState.Append(cells->GetNumberOfCells() ? cells->GetMTime() : 0, "cells mtime");
+      buildState.Append(auxTime, "aux mtime");
+      bool rebuildNeeded = false;
+      vtkOpenGLIndexBufferObject* ibo = iboCache->GetIBO(cells, buildState, rebuildNeeded);
+      if (prim.IBO == ibo)
+      {
+        // drop the extra reference returned by the lookup
+        ibo->Delete();
+      }
+      else
+      {
+        prim.IBO->Delete();
+        prim.IBO = ibo;
+      }
+      return rebuildNeeded;
+    };
+    // edge flag and surface-with-edges index buffers embed per-mapper edge
+    // values, those stay private. Make sure the helper is not still pointing
+    // at a shared IBO from an earlier state before filling it.
+    auto makeLocalIBO = [](vtkOpenGLHelper& prim) {
+      if (prim.IBO->GetCache())
+      {
+        prim.IBO->Delete();
+        prim.IBO = vtkOpenGLIndexBufferObject::New();
+      }
+    };
+
+    if (acquireSharedIBO(this->Primitives[PrimitivePoints], prims[0], 0, 0))
+    {
+      this->Primitives[PrimitivePoints].IBO->CreatePointIndexBuffer(prims[0]);
+    }
 
     if (representation == VTK_POINTS)
     {
-      this->Primitives[PrimitiveLines].IBO->CreatePointIndexBuffer(prims[1]);
-      this->Primitives[PrimitiveTris].IBO->CreatePointIndexBuffer(prims[2]);
-      this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreatePointIndexBuffer(
-        prims[3]);
+      if (acquireSharedIBO(this->Primitives[PrimitiveLines], prims[1], 0, 0))
+      {
+        this->Primitives[PrimitiveLines].IBO->CreatePointIndexBuffer(prims[1]);
+      }
+      if (acquireSharedIBO(this->Primitives[PrimitiveTris], prims[2], 0, 0))
+      {
+        this->Primitives[PrimitiveTris].IBO->CreatePointIndexBuffer(prims[2]);
+      }
+      if (acquireSharedIBO(
+            this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips], prims[3], 0, 0))
+      {
+        this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreatePointIndexBuffer(
+          prims[3]);
+      }
     }
     else // WIREFRAME OR SURFACE
     {
-      this->Primitives[PrimitiveLines].IBO->CreateLineIndexBuffer(prims[1]);
+      if (acquireSharedIBO(this->Primitives[PrimitiveLines], prims[1], 1, 0))
+      {
+        this->Primitives[PrimitiveLines].IBO->CreateLineIndexBuffer(prims[1]);
+      }
 
       if (representation == VTK_WIREFRAME)
       {
         if (ef)
         {
+          makeLocalIBO(this->Primitives[PrimitiveTris]);
           this->Primitives[PrimitiveTris].IBO->CreateEdgeFlagIndexBuffer(prims[2], ef);
         }
-        else
+        else if (acquireSharedIBO(this->Primitives[PrimitiveTris], prims[2], 2, 0))
         {
           this->Primitives[PrimitiveTris].IBO->CreateTriangleLineIndexBuffer(prims[2]);
         }
-        this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreateStripIndexBuffer(
-          prims[3], true);
+        if (acquireSharedIBO(
+              this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips], prims[3], 4, 0))
+        {
+          this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreateStripIndexBuffer(
+            prims[3], true);
+        }
       }
       else // SURFACE
       {
         if (draw_surface_with_edges)
         {
+          makeLocalIBO(this->Primitives[PrimitiveTris]);
           this->Primitives[PrimitiveTris].IBO->CreateTriangleIndexBuffer(
             prims[2], poly->GetPoints(), &this->EdgeValues, ef);
           if (!this->EdgeValues.empty())
@@ -4024,13 +4094,18 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
               this->EdgeBuffer);
           }
         }
-        else
+        else if (acquireSharedIBO(this->Primitives[PrimitiveTris], prims[2], 3,
+                   poly->GetPoints() ? poly->GetPoints()->GetMTime() : 0))
         {
           this->Primitives[PrimitiveTris].IBO->CreateTriangleIndexBuffer(
             prims[2], poly->GetPoints(), nullptr, nullptr);
         }
-        this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreateStripIndexBuffer(
-          prims[3], false);
+        if (acquireSharedIBO(
+              this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips], prims[3], 5, 0))
+        {
+          this->Primitives[vtkOpenGLPolyDataMapper::PrimitiveTriStrips].IBO->CreateStripIndexBuffer(
+            prims[3], false);
+        }
       }
     }
 
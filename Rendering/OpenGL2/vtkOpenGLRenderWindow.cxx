@@ -36,6 +36,7 @@
 #include "vtkOpenGLShaderCache.h"
 #include "vtkOpenGLState.h"
 #include "vtkOpenGLVertexArrayObject.h"
+#include "vtkOpenGLIndexBufferObjectCache.h"
 #include "vtkOpenGLVertexBufferObjectCache.h"
 #include "vtkOutputWindow.h"
 #include "vtkPerlinNoise.h"
@@ -385,6 +386,12 @@ vtkOpenGLVertexBufferObjectCache* vtkOpenGLRenderWindow::GetVBOCache()
   return this->GetState()->GetVBOCache();
 }
 
+//------------------------------------------------------------------------------
+vtkOpenGLIndexBufferObjectCache* vtkOpenGLRenderWindow::GetIBOCache()
+{
+  return this->GetState()->GetIBOCache();
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLRenderWindow::OpenGLInit()
 {
@@ -39,6 +39,7 @@ class vtkOpenGLFramebufferObject;
 class vtkOpenGLHardwareSupport;
 class vtkOpenGLQuadHelper;
 class vtkOpenGLShaderCache;
+class vtkOpenGLIndexBufferObjectCache;
 class vtkOpenGLVertexBufferObjectCache;
 class vtkOpenGLVertexArrayObject;
 class vtkShaderProgram;
@@ -198,6 +199,11 @@ public:
    */
   vtkOpenGLVertexBufferObjectCache* GetVBOCache();
 
+  /**
+   * Returns the IBO Cache
+   */
+  vtkOpenGLIndexBufferObjectCache* GetIBOCache();
+
   ///@{
   /**
    * Returns the render framebuffer object.
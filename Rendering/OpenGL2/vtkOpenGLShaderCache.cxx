@@ -24,8 +24,11 @@
 
 #include <cmath>
 #include <sstream>
+#include <vector>
 
+#include "vtksys/FStream.hxx"
 #include "vtksys/MD5.h"
+#include "vtksys/SystemTools.hxx"
 
 class vtkOpenGLShaderCache::Private
 {
@@ -78,6 +81,7 @@ vtkOpenGLShaderCache::vtkOpenGLShaderCache()
   : Internal(new Private)
 {
   this->LastShaderBound = nullptr;
+  this->PersistentCacheDirectory = nullptr;
   this->OpenGLMajorVersion = 0;
   this->OpenGLMinorVersion = 0;
 }
@@ -92,9 +96,161 @@ vtkOpenGLShaderCache::~vtkOpenGLShaderCache()
     iter->second->Delete();
   }
 
+  this->SetPersistentCacheDirectory(nullptr);
   delete this->Internal;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// glProgramBinary support: core since OpenGL ES 3.0 and desktop OpenGL 4.1,
+// otherwise via ARB_get_program_binary.
+bool ProgramBinarySupported()
+{
+#if !defined(GL_PROGRAM_BINARY_LENGTH)
+  return false;
+#elif defined(GL_ES_VERSION_3_0)
+  return true;
+#else
+  return (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary);
+#endif
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+std::string vtkOpenGLShaderCache::GetShaderProgramBinaryFileName(vtkShaderProgram* shader)
+{
+  if (!this->PersistentCacheDirectory || !this->PersistentCacheDirectory[0] ||
+    shader->GetMD5Hash().empty() || !ProgramBinarySupported())
+  {
+    return std::string();
+  }
+
+  // Key on the driver identification strings in addition to the source hash
+  // so that binaries produced by another driver (or GPU) are never loaded.
+  std::string driver;
+  for (GLenum name : { static_cast<GLenum>(GL_VENDOR), static_cast<GLenum>(GL_RENDERER),
+         static_cast<GLenum>(GL_VERSION) })
+  {
+    if (const char* value = reinterpret_cast<const char*>(glGetString(name)))
+    {
+      driver += value;
+      driver += '\n';
+    }
+  }
+
+  std::string hash;
+  this->Internal->ComputeMD5(shader->GetMD5Hash().c_str(), driver.c_str(), nullptr, hash);
+
+  std::string fileName = this->PersistentCacheDirectory;
+  fileName += "/vtkShaderProgram_" + hash + ".bin";
+  return fileName;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLShaderCache::LoadShaderProgramBinary(vtkShaderProgram* shader)
+{
+#if defined(GL_PROGRAM_BINARY_LENGTH)
+  std::string fileName = this->GetShaderProgramBinaryFileName(shader);
+  if (fileName.empty() || !vtksys::SystemTools::FileExists(fileName))
+  {
+    return false;
+  }
+
+  vtkTypeUInt32 format = 0;
+  vtkIdType binaryLength =
+    static_cast<vtkIdType>(vtksys::SystemTools::FileLength(fileName)) -
+    static_cast<vtkIdType>(sizeof(format));
+  if (binaryLength <= 0)
+  {
+    return false;
+  }
+
+  vtksys::ifstream file(fileName.c_str(), ios::in | ios::binary);
+  std::vector<char> binary(static_cast<size_t>(binaryLength));
+  file.read(reinterpret_cast<char*>(&format), sizeof(format));
+  file.read(binary.data(), binaryLength);
+  if (!file)
+  {
+    return false;
+  }
+
+  if (shader->Handle == 0)
+  {
+    shader->Handle = static_cast<int>(glCreateProgram());
+    if (shader->Handle == 0)
+    {
+      return false;
+    }
+  }
+
+  glProgramBinary(static_cast<GLuint>(shader->Handle), static_cast<GLenum>(format), binary.data(),
+    static_cast<GLsizei>(binaryLength));
+
+  GLint isLinked = 0;
+  glGetProgramiv(static_cast<GLuint>(shader->Handle), GL_LINK_STATUS, &isLinked);
+  if (isLinked == 0)
+  {
+    // The binary is stale; a driver update can invalidate binaries without
+    // changing the identification strings. Drop it and fall back to
+    // compiling.
+    vtksys::SystemTools::RemoveFile(fileName);
+    return false;
+  }
+
+  shader->ClearMaps();
+  shader->Linked = true;
+  shader->Compiled = true;
+  return true;
+#else
+  (void)shader;
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLShaderCache::SaveShaderProgramBinary(vtkShaderProgram* shader)
+{
+#if defined(GL_PROGRAM_BINARY_LENGTH)
+  std::string fileName = this->GetShaderProgramBinaryFileName(shader);
+  if (fileName.empty())
+  {
+    return false;
+  }
+
+  GLint binaryLength = 0;
+  glGetProgramiv(static_cast<GLuint>(shader->Handle), GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+  if (binaryLength <= 0)
+  {
+    return false;
+  }
+
+  std::vector<char> binary(static_cast<size_t>(binaryLength));
+  GLsizei actualLength = 0;
+  GLenum format = 0;
+  glGetProgramBinary(static_cast<GLuint>(shader->Handle), binaryLength, &actualLength, &format,
+    binary.data());
+  if (actualLength <= 0)
+  {
+    return false;
+  }
+
+  vtksys::SystemTools::MakeDirectory(this->PersistentCacheDirectory);
+  vtksys::ofstream file(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+  if (!file)
+  {
+    return false;
+  }
+  vtkTypeUInt32 format32 = static_cast<vtkTypeUInt32>(format);
+  file.write(reinterpret_cast<const char*>(&format32), sizeof(format32));
+  file.write(binary.data(), actualLength);
+  return file.good();
+#else
+  (void)shader;
+  return false;
+#endif
+}
+
 // perform System and Output replacements
 unsigned int vtkOpenGLShaderCache::ReplaceShaderValues(
   std::string& VSSource, std::string& FSSource, std::string& GSSource)
@@ -262,10 +418,37 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
     shader->SetTransformFeedback(cap);
   }
 
-  // compile if needed
-  if (!shader->GetCompiled() && !shader->CompileShader())
+  // compile if needed. Transform feedback configurations are not covered by
+  // the persistent cache key, so they always go through the compiler.
+  if (!shader->GetCompiled())
   {
-    return nullptr;
+    if (cap != nullptr || !this->LoadShaderProgramBinary(shader))
+    {
+#if defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+      bool saveBinary = cap == nullptr &&
+        !this->GetShaderProgramBinaryFileName(shader).empty();
+      if (saveBinary)
+      {
+        // the hint has to be in place before the program is linked
+        if (shader->Handle == 0)
+        {
+          shader->Handle = static_cast<int>(glCreateProgram());
+        }
+        glProgramParameteri(static_cast<GLuint>(shader->Handle),
+          GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+      }
+#else
+      bool saveBinary = false;
+#endif
+      if (!shader->CompileShader())
+      {
+        return nullptr;
+      }
+      if (saveBinary)
+      {
+        this->SaveShaderProgramBinary(shader);
+      }
+    }
   }
 
   // bind if needed
@@ -392,4 +575,6 @@ int vtkOpenGLShaderCache::BindShader(vtkShaderProgram* shader)
 void vtkOpenGLShaderCache::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "PersistentCacheDirectory: "
+     << (this->PersistentCacheDirectory ? this->PersistentCacheDirectory : "(none)") << endl;
 }
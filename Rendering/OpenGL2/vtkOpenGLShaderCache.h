@@ -75,6 +75,20 @@ public:
   // Set the time in seconds elapsed since the first render
   void SetElapsedTime(float val) { this->ElapsedTime = val; }
 
+  ///@{
+  /**
+   * Set/Get the directory used to persist linked program binaries across
+   * application runs. When set (and the driver supports program binary
+   * retrieval), a shader program that is not in the in-memory cache is first
+   * looked up on disk, keyed on the MD5 of its sources combined with the
+   * driver identification strings, and loaded with glProgramBinary instead
+   * of being compiled. Newly compiled programs are written back to the
+   * directory. Default is nullptr, which disables persistent caching.
+   */
+  vtkSetStringMacro(PersistentCacheDirectory);
+  vtkGetStringMacro(PersistentCacheDirectory);
+  ///@}
+
 protected:
   vtkOpenGLShaderCache();
   ~vtkOpenGLShaderCache() override;
@@ -89,9 +103,29 @@ protected:
   virtual vtkShaderProgram* GetShaderProgram(std::map<vtkShader::Type, vtkShader*> shaders);
   virtual int BindShader(vtkShaderProgram* shader);
 
+  ///@{
+  /**
+   * Load / store the linked binary of a shader program from / to
+   * PersistentCacheDirectory. Both are no-ops returning failure when
+   * persistent caching is disabled or the driver cannot retrieve program
+   * binaries.
+   */
+  virtual bool LoadShaderProgramBinary(vtkShaderProgram* shader);
+  virtual bool SaveShaderProgramBinary(vtkShaderProgram* shader);
+  ///@}
+
+  /**
+   * Compute the file name a program's binary is cached under, combining the
+   * program's source hash with the driver identification strings so that
+   * stale binaries are ignored after a driver change. Returns an empty
+   * string when persistent caching is unavailable.
+   */
+  std::string GetShaderProgramBinaryFileName(vtkShaderProgram* shader);
+
   class Private;
   Private* Internal;
   vtkShaderProgram* LastShaderBound;
+  char* PersistentCacheDirectory;
 
   int OpenGLMajorVersion;
   int OpenGLMinorVersion;
@@ -198,40 +198,69 @@ void vtkOpenGLSphereMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Radius: " << this->Radius << "\n";
 }
 
-// internal function called by CreateVBO
+// internal function called by BuildBufferObjects
 void vtkOpenGLSphereMapper::CreateVBO(vtkPolyData* poly, vtkIdType numPts, unsigned char* colors,
   int colorComponents, vtkIdType nc, float* sizes, vtkIdType ns, vtkRenderer* ren)
 {
-  vtkFloatArray* offsets = vtkFloatArray::New();
-  offsets->SetNumberOfComponents(1);
-  offsets->SetNumberOfTuples(numPts);
-  float* oPtr = static_cast<float*>(offsets->GetVoidPointer(0));
+  // The radius and color arrays are baked from mapper state that typically
+  // stays fixed while the points move (e.g. trajectory playback). Keep the
+  // baked arrays across builds and only regenerate them when that state
+  // changes; BuildAllVBOs then skips their upload and only the point
+  // coordinates travel to the GPU.
+  vtkStateStorage attributeState;
+  attributeState.Append(numPts, "num pts");
+  attributeState.Append(this->GetMTime(), "mapper mtime");
+  if (nc == numPts)
+  {
+    attributeState.Append(this->Colors->GetMTime(), "colors mtime");
+  }
+  else
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      attributeState.Append(colors[j], "constant color");
+    }
+  }
+  if (ns == numPts)
+  {
+    attributeState.Append(
+      poly->GetPointData()->GetArray(this->ScaleArray)->GetMTime(), "scale mtime");
+  }
+
+  if (this->AttributeState != attributeState)
+  {
+    this->AttributeState = attributeState;
 
-  vtkUnsignedCharArray* ucolors = vtkUnsignedCharArray::New();
-  ucolors->SetNumberOfComponents(4);
-  ucolors->SetNumberOfTuples(numPts);
-  unsigned char* cPtr = static_cast<unsigned char*>(ucolors->GetVoidPointer(0));
+    this->RadiusArray->SetNumberOfComponents(1);
+    this->RadiusArray->SetNumberOfTuples(numPts);
+    float* oPtr = static_cast<float*>(this->RadiusArray->GetVoidPointer(0));
 
-  unsigned char* colorPtr;
+    this->ColorArray->SetNumberOfComponents(4);
+    this->ColorArray->SetNumberOfTuples(numPts);
+    unsigned char* cPtr = static_cast<unsigned char*>(this->ColorArray->GetVoidPointer(0));
 
-  for (vtkIdType i = 0; i < numPts; ++i)
-  {
-    colorPtr = (nc == numPts ? colors + i * colorComponents : colors);
-    float radius = (ns == numPts ? sizes[i] : sizes[0]);
-
-    *(cPtr++) = colorPtr[0];
-    *(cPtr++) = colorPtr[1];
-    *(cPtr++) = colorPtr[2];
-    *(cPtr++) = colorPtr[3];
-    *(oPtr++) = radius;
+    unsigned char* colorPtr;
+
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      colorPtr = (nc == numPts ? colors + i * colorComponents : colors);
+      float radius = (ns == numPts ? sizes[i] : sizes[0]);
+
+      *(cPtr++) = colorPtr[0];
+      *(cPtr++) = colorPtr[1];
+      *(cPtr++) = colorPtr[2];
+      *(cPtr++) = colorPtr[3];
+      *(oPtr++) = radius;
+    }
+
+    this->RadiusArray->Modified();
+    this->ColorArray->Modified();
   }
 
   this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), ren, VTK_FLOAT);
 
-  this->VBOs->CacheDataArray("radiusMC", offsets, ren, VTK_FLOAT);
-  offsets->Delete();
-  this->VBOs->CacheDataArray("scalarColor", ucolors, ren, VTK_UNSIGNED_CHAR);
-  ucolors->Delete();
+  this->VBOs->CacheDataArray("radiusMC", this->RadiusArray, ren, VTK_FLOAT);
+  this->VBOs->CacheDataArray("scalarColor", this->ColorArray, ren, VTK_UNSIGNED_CHAR);
   VBOs->BuildAllVBOs(ren);
 }
 
@@ -22,8 +22,12 @@
 #ifndef vtkOpenGLSphereMapper_h
 #define vtkOpenGLSphereMapper_h
 
+#include "vtkFloatArray.h"             // for ivars
+#include "vtkNew.h"                    // for ivars
 #include "vtkOpenGLPolyDataMapper.h"
 #include "vtkRenderingOpenGL2Module.h" // For export macro
+#include "vtkStateStorage.h"           // used for ivars
+#include "vtkUnsignedCharArray.h"      // for ivars
 
 class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLSphereMapper : public vtkOpenGLPolyDataMapper
 {
@@ -101,6 +105,13 @@ protected:
   bool Invert;
   float Radius;
 
+  // Cached per-point radius/color arrays together with the state they were
+  // baked from. Keeping the same arrays (and MTimes) across builds lets the
+  // VBO group skip their upload when only the point positions changed.
+  vtkNew<vtkFloatArray> RadiusArray;
+  vtkNew<vtkUnsignedCharArray> ColorArray;
+  vtkStateStorage AttributeState;
+
 private:
   vtkOpenGLSphereMapper(const vtkOpenGLSphereMapper&) = delete;
   void operator=(const vtkOpenGLSphereMapper&) = delete;
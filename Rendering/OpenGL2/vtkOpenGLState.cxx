@@ -20,6 +20,7 @@
 #include "vtkOpenGLRenderUtilities.h"
 #include "vtkOpenGLRenderWindow.h"
 #include "vtkOpenGLShaderCache.h"
+#include "vtkOpenGLIndexBufferObjectCache.h"
 #include "vtkOpenGLVertexBufferObjectCache.h"
 #include "vtkRenderer.h"
 #include "vtkTextureUnitManager.h"
@@ -1858,6 +1859,7 @@ void vtkOpenGLState::PrintSelf(ostream& os, vtkIndent indent)
 }
 
 vtkCxxSetObjectMacro(vtkOpenGLState, VBOCache, vtkOpenGLVertexBufferObjectCache);
+vtkCxxSetObjectMacro(vtkOpenGLState, IBOCache, vtkOpenGLIndexBufferObjectCache);
 
 // initialize all state values. This is important so that in
 // ::Initialize we can just set the state to the current
@@ -1883,6 +1885,7 @@ vtkOpenGLState::vtkOpenGLState()
 {
   this->ShaderCache = vtkOpenGLShaderCache::New();
   this->VBOCache = vtkOpenGLVertexBufferObjectCache::New();
+  this->IBOCache = vtkOpenGLIndexBufferObjectCache::New();
 
   this->TextureUnitManager = vtkTextureUnitManager::New();
 
@@ -1976,6 +1979,7 @@ vtkOpenGLState::~vtkOpenGLState()
 {
   this->TextureResourceIds.clear();
   this->SetTextureUnitManager(nullptr);
+  this->IBOCache->Delete();
   this->VBOCache->Delete();
   this->ShaderCache->Delete();
 }
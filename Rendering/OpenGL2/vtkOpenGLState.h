@@ -74,6 +74,7 @@
 class vtkOpenGLFramebufferObject;
 class vtkOpenGLRenderWindow;
 class vtkOpenGLShaderCache;
+class vtkOpenGLIndexBufferObjectCache;
 class vtkOpenGLVertexBufferObjectCache;
 class vtkTextureObject;
 class vtkTextureUnitManager;
@@ -333,6 +334,14 @@ public:
   // lists
   void SetVBOCache(vtkOpenGLVertexBufferObjectCache* val);
 
+  // get the ibo buffer cache for this context
+  vtkGetObjectMacro(IBOCache, vtkOpenGLIndexBufferObjectCache);
+
+  // set the IBO Cache to use for this state
+  // this allows two contexts to share IBOs just
+  // like the VBO cache above
+  void SetIBOCache(vtkOpenGLIndexBufferObjectCache* val);
+
   /**
    * Get a mapping of vtk data types to native texture formats for this window
    * we put this on the RenderWindow so that every texture does not have to
@@ -493,6 +502,7 @@ protected:
 
   std::stack<GLState> Stack;
 
+  vtkOpenGLIndexBufferObjectCache* IBOCache;
   vtkOpenGLVertexBufferObjectCache* VBOCache;
   vtkOpenGLShaderCache* ShaderCache;
 
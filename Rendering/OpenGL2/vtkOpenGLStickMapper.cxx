@@ -291,7 +291,8 @@ namespace
 // internal function called by CreateVBO
 void vtkOpenGLStickMapperCreateVBO(vtkPolyData* poly, vtkIdType numPts, unsigned char* colors,
   int colorComponents, float* orients, float* sizes, vtkIdType* selectionIds,
-  vtkOpenGLVertexBufferObjectGroup* VBOs, vtkViewport* ren)
+  vtkUnsignedCharArray* ucolors, bool updateColors, vtkOpenGLVertexBufferObjectGroup* VBOs,
+  vtkViewport* ren)
 {
   vtkFloatArray* orientDA = vtkFloatArray::New();
   orientDA->SetNumberOfComponents(3);
@@ -303,10 +304,13 @@ void vtkOpenGLStickMapperCreateVBO(vtkPolyData* poly, vtkIdType numPts, unsigned
   radiusDA->SetNumberOfTuples(numPts);
   float* radPtr = static_cast<float*>(radiusDA->GetVoidPointer(0));
 
-  vtkUnsignedCharArray* ucolors = vtkUnsignedCharArray::New();
-  ucolors->SetNumberOfComponents(4);
-  ucolors->SetNumberOfTuples(numPts);
-  unsigned char* cPtr = static_cast<unsigned char*>(ucolors->GetVoidPointer(0));
+  unsigned char* cPtr = nullptr;
+  if (updateColors)
+  {
+    ucolors->SetNumberOfComponents(4);
+    ucolors->SetNumberOfTuples(numPts);
+    cPtr = static_cast<unsigned char*>(ucolors->GetVoidPointer(0));
+  }
 
   float* orientPtr;
   unsigned char* colorPtr;
@@ -322,27 +326,35 @@ void vtkOpenGLStickMapperCreateVBO(vtkPolyData* poly, vtkIdType numPts, unsigned
     orPtr += 3;
 
     // colors or selection ids
-    if (selectionIds)
-    {
-      vtkIdType thisId = selectionIds[i];
-      cPtr[0] = thisId % 256;
-      cPtr[1] = (thisId >> 8) % 256;
-      cPtr[2] = (thisId >> 16) % 256;
-      cPtr[3] = 0;
-    }
-    else
+    if (cPtr)
     {
-      colorPtr = colors + i * colorComponents;
-      cPtr[0] = colorPtr[0];
-      cPtr[1] = colorPtr[1];
-      cPtr[2] = colorPtr[2];
-      cPtr[3] = (colorComponents == 4 ? colorPtr[3] : 255);
+      if (selectionIds)
+      {
+        vtkIdType thisId = selectionIds[i];
+        cPtr[0] = thisId % 256;
+        cPtr[1] = (thisId >> 8) % 256;
+        cPtr[2] = (thisId >> 16) % 256;
+        cPtr[3] = 0;
+      }
+      else
+      {
+        colorPtr = colors + i * colorComponents;
+        cPtr[0] = colorPtr[0];
+        cPtr[1] = colorPtr[1];
+        cPtr[2] = colorPtr[2];
+        cPtr[3] = (colorComponents == 4 ? colorPtr[3] : 255);
+      }
+      cPtr += 4;
     }
-    cPtr += 4;
 
     *(radPtr++) = sizes[i * 3 + 1];
   }
 
+  if (updateColors)
+  {
+    ucolors->Modified();
+  }
+
   VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), ren, VTK_FLOAT);
   VBOs->CacheDataArray("orientMC", orientDA, ren, VTK_FLOAT);
   orientDA->Delete();
@@ -359,7 +371,6 @@ void vtkOpenGLStickMapperCreateVBO(vtkPolyData* poly, vtkIdType numPts, unsigned
     VBOs->CacheDataArray("scalarColor", ucolors, ren, VTK_UNSIGNED_CHAR);
     VBOs->CacheDataArray("selectionId", nullptr, ren, VTK_UNSIGNED_CHAR);
   }
-  ucolors->Delete();
   VBOs->BuildAllVBOs(ren);
 }
 }
@@ -392,7 +403,31 @@ void vtkOpenGLStickMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* vtkNot
   vtkHardwareSelector* selector = ren->GetSelector();
   bool picking = (selector != nullptr);
 
-  vtkOpenGLStickMapperCreateVBO(poly, poly->GetPoints()->GetNumberOfPoints(),
+  vtkIdType numPts = poly->GetPoints()->GetNumberOfPoints();
+
+  // The color/selection array is baked from state that typically stays fixed
+  // while the sticks move. Keep the baked array across builds and only
+  // regenerate it when that state changes, so the VBO group skips its upload
+  // on geometry-only updates.
+  vtkStateStorage colorState;
+  colorState.Append(numPts, "num pts");
+  colorState.Append(picking ? 1 : 0, "picking");
+  if (picking)
+  {
+    colorState.Append(
+      poly->GetPointData()->GetArray(this->SelectionIdArray)->GetMTime(), "selection mtime");
+  }
+  else if (this->Colors)
+  {
+    colorState.Append(this->Colors->GetMTime(), "colors mtime");
+  }
+  bool updateColors = this->ColorState != colorState;
+  if (updateColors)
+  {
+    this->ColorState = colorState;
+  }
+
+  vtkOpenGLStickMapperCreateVBO(poly, numPts,
     this->Colors ? (unsigned char*)this->Colors->GetVoidPointer(0) : nullptr,
     this->Colors ? this->Colors->GetNumberOfComponents() : 0,
     static_cast<float*>(poly->GetPointData()->GetArray(this->OrientationArray)->GetVoidPointer(0)),
@@ -400,7 +435,7 @@ void vtkOpenGLStickMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* vtkNot
     picking ? static_cast<vtkIdType*>(
                 poly->GetPointData()->GetArray(this->SelectionIdArray)->GetVoidPointer(0))
             : nullptr,
-    this->VBOs, ren);
+    this->ColorArray, updateColors, this->VBOs, ren);
 
   // create the IBO (none)
   this->Primitives[PrimitivePoints].IBO->IndexCount = 0;
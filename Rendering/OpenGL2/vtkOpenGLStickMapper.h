@@ -22,8 +22,11 @@
 #ifndef vtkOpenGLStickMapper_h
 #define vtkOpenGLStickMapper_h
 
+#include "vtkNew.h"                    // for ivars
 #include "vtkOpenGLPolyDataMapper.h"
 #include "vtkRenderingOpenGL2Module.h" // For export macro
+#include "vtkStateStorage.h"           // used for ivars
+#include "vtkUnsignedCharArray.h"      // for ivars
 
 class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLStickMapper : public vtkOpenGLPolyDataMapper
 {
@@ -83,6 +86,12 @@ protected:
   const char* OrientationArray;
   const char* SelectionIdArray;
 
+  // Cached per-point color/selection array together with the state it was
+  // baked from. Keeping the same array (and MTime) across builds lets the
+  // VBO group skip its upload when only the stick geometry changed.
+  vtkNew<vtkUnsignedCharArray> ColorArray;
+  vtkStateStorage ColorState;
+
   /**
    * Does the VBO/IBO need to be rebuilt
    */
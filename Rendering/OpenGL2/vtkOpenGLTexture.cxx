@@ -131,6 +131,106 @@ void vtkOpenGLTexture::Load(vtkRenderer* ren)
   vtkOpenGLRenderWindow* renWin = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
   vtkOpenGLState* ostate = renWin->GetState();
 
+  if (!this->ExternalTextureObject && this->CompressedImage && !this->CubeMap)
+  {
+    // A pre-compressed payload is uploaded as is, bypassing the image
+    // scalar pipeline (and any CPU color mapping or resampling).
+    if (this->GetMTime() > this->LoadTime.GetMTime() ||
+      this->CompressedImage->GetMTime() > this->LoadTime.GetMTime() ||
+      this->RenderWindow == nullptr ||
+      renWin->GetGenericContext() != this->RenderWindow->GetGenericContext() ||
+      renWin->GetContextCreationTime() > this->LoadTime)
+    {
+      this->RenderWindow = renWin;
+      if (this->TextureObject == nullptr)
+      {
+        this->TextureObject = vtkTextureObject::New();
+      }
+      this->TextureObject->ResetFormatAndType();
+      this->TextureObject->SetContext(renWin);
+
+      // map the payload format to GL and verify driver support; there is
+      // no CPU decompression fallback
+      unsigned int internalFormat = 0;
+      bool supported = false;
+      switch (this->CompressedImageFormat)
+      {
+        case vtkTexture::BC3Compression:
+          internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+          supported = (GLEW_EXT_texture_compression_s3tc != 0);
+          break;
+        case vtkTexture::BC7Compression:
+          internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;
+          supported = (GLEW_ARB_texture_compression_bptc != 0);
+          break;
+        case vtkTexture::ASTC4x4Compression:
+          internalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+          supported = (GLEW_KHR_texture_compression_astc_ldr != 0);
+          break;
+      }
+      if (!supported)
+      {
+        vtkErrorMacro("The compressed texture format is not supported by the OpenGL driver.");
+        return;
+      }
+
+      if (!this->TextureObject->Create2DFromCompressedRaw(this->CompressedImageWidth,
+            this->CompressedImageHeight, internalFormat,
+            static_cast<size_t>(this->CompressedImage->GetNumberOfValues()),
+            this->CompressedImage->GetPointer(0)))
+      {
+        return;
+      }
+
+      // compressed uploads carry a single mip level
+      this->TextureObject->SetMagnificationFilter(
+        this->Interpolate ? vtkTextureObject::Linear : vtkTextureObject::Nearest);
+      this->TextureObject->SetMinificationFilter(
+        this->Interpolate ? vtkTextureObject::Linear : vtkTextureObject::Nearest);
+      int wrap = this->GetWrap();
+      switch (this->GetWrap())
+      {
+        case vtkTexture::ClampToEdge:
+          wrap = vtkTextureObject::ClampToEdge;
+          break;
+        case vtkTexture::Repeat:
+          wrap = vtkTextureObject::Repeat;
+          break;
+        case vtkTexture::MirroredRepeat:
+          wrap = vtkTextureObject::MirroredRepeat;
+          break;
+        case vtkTexture::ClampToBorder:
+#ifndef GL_ES_VERSION_3_0
+          wrap = vtkTextureObject::ClampToBorder;
+#else
+          wrap = vtkTextureObject::ClampToEdge;
+#endif
+          break;
+      }
+      this->TextureObject->SetWrapS(wrap);
+      this->TextureObject->SetWrapT(wrap);
+      this->TextureObject->SetWrapR(wrap);
+      this->TextureObject->SetBorderColor(this->GetBorderColor());
+
+      // modify the load time to the current time
+      this->LoadTime.Modified();
+    }
+
+    // activate a free texture unit for this texture
+    this->TextureObject->Activate();
+
+    if (this->PremultipliedAlpha)
+    {
+      ostate->GetBlendFuncState(this->PrevBlendParams);
+
+      // make the blend function correct for textures premultiplied by alpha.
+      ostate->vtkglBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    vtkOpenGLCheckErrorMacro("failed after Load");
+    return;
+  }
+
   if (!this->ExternalTextureObject)
   {
     if (this->GetInputDataObject(0, 0) == nullptr)
@@ -556,6 +556,12 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   {
     this->NumberOfTuples = array->GetNumberOfTuples();
     this->PackedVBO.resize(0);
+    if (this->GetHandle())
+    {
+      // re-uploading an existing VBO: assume the data keeps changing so the
+      // driver updates the storage in place instead of orphaning it
+      this->SetUsage(vtkOpenGLBufferObject::DynamicDraw);
+    }
     this->Upload(reinterpret_cast<float*>(array->GetVoidPointer(0)),
       this->NumberOfTuples * this->Stride / sizeof(float), vtkOpenGLBufferObject::ArrayBuffer);
     this->UploadTime.Modified();
@@ -675,6 +681,12 @@ void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
 //------------------------------------------------------------------------------
 void vtkOpenGLVertexBufferObject::UploadVBO()
 {
+  if (this->GetHandle())
+  {
+    // re-uploading an existing VBO: assume the data keeps changing so the
+    // driver updates the storage in place instead of orphaning it
+    this->SetUsage(vtkOpenGLBufferObject::DynamicDraw);
+  }
   this->Upload(this->PackedVBO, vtkOpenGLBufferObject::ArrayBuffer);
   this->PackedVBO.resize(0);
   this->UploadTime.Modified();
@@ -395,7 +395,34 @@ void vtkSSAOPass::RenderCombine(vtkOpenGLRenderWindow* renWin)
     std::stringstream ssImpl;
     ssImpl << "  vec4 col = texture(texColor, texCoord);\n";
 
-    if (this->Blur)
+    if (this->DownsamplingFactor > 1)
+    {
+      // depth-aware upsampling of the reduced resolution occlusion: weight
+      // each low resolution sample by its bilinear weight and its depth
+      // similarity so occlusion does not bleed across silhouettes
+      ssImpl << "  float fragDepth = texture(texDepth, texCoord).r;\n"
+                "  vec2 sizeAO = vec2(textureSize(texSSAO, 0));\n"
+                "  vec2 uv = texCoord * sizeAO - 0.5;\n"
+                "  vec2 base = floor(uv);\n"
+                "  vec2 fuv = uv - base;\n"
+                "  float ao = 0.0;\n"
+                "  float aoWeight = 0.0;\n"
+                "  for (int j = 0; j < 2; j++)\n"
+                "  {\n"
+                "    for (int i = 0; i < 2; i++)\n"
+                "    {\n"
+                "      vec2 sampleCoord = (base + vec2(i, j) + 0.5) / sizeAO;\n"
+                "      float bilinear = (i == 0 ? 1.0 - fuv.x : fuv.x) *\n"
+                "        (j == 0 ? 1.0 - fuv.y : fuv.y);\n"
+                "      float sampleDepth = texture(texDepth, sampleCoord).r;\n"
+                "      float weight = bilinear / (0.0001 + abs(fragDepth - sampleDepth));\n"
+                "      ao += texture(texSSAO, sampleCoord).r * weight;\n"
+                "      aoWeight += weight;\n"
+                "    }\n"
+                "  }\n"
+                "  ao /= aoWeight;\n";
+    }
+    else if (this->Blur)
     {
       ssImpl << "  ivec2 size = textureSize(texSSAO, 0);"
                 "  float ao = 0.195346 * texture(texSSAO, texCoord).r + \n"
@@ -485,10 +512,15 @@ void vtkSSAOPass::Render(const vtkRenderState* s)
 
   this->InitializeGraphicsResources(renWin, w, h);
 
+  // the occlusion can be computed at reduced resolution
+  int factor = static_cast<int>(this->DownsamplingFactor);
+  int ssaoW = (w + factor - 1) / factor;
+  int ssaoH = (h + factor - 1) / factor;
+
   this->ColorTexture->Resize(w, h);
   this->PositionTexture->Resize(w, h);
   this->NormalTexture->Resize(w, h);
-  this->SSAOTexture->Resize(w, h);
+  this->SSAOTexture->Resize(ssaoW, ssaoH);
   this->DepthTexture->Resize(w, h);
 
   ostate->vtkglViewport(x, y, w, h);
@@ -507,7 +539,13 @@ void vtkSSAOPass::Render(const vtkRenderState* s)
   vtkMatrix4x4* projection = cam->GetProjectionTransformMatrix(r->GetTiledAspectRatio(), -1, 1);
   projection->Transpose();
 
-  this->RenderSSAO(renWin, projection, w, h);
+  this->RenderSSAO(renWin, projection, ssaoW, ssaoH);
+  if (factor > 1)
+  {
+    // restore the full resolution viewport for the combine pass
+    ostate->vtkglViewport(x, y, w, h);
+    ostate->vtkglScissor(x, y, w, h);
+  }
   this->RenderCombine(renWin);
 
   vtkOpenGLCheckErrorMacro("failed after Render");
@@ -112,6 +112,19 @@ public:
   vtkBooleanMacro(Blur, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the resolution divider of the ambient occlusion computation.
+   * The occlusion is computed on a framebuffer whose width and height are
+   * divided by this factor and upsampled to full resolution with a
+   * depth-aware filter, which is much cheaper on large framebuffers.
+   * When greater than 1, this upsampling replaces the Blur filter.
+   * Default is 1 (full resolution).
+   */
+  vtkGetMacro(DownsamplingFactor, unsigned int);
+  vtkSetClampMacro(DownsamplingFactor, unsigned int, 1, 16);
+  ///@}
+
 protected:
   vtkSSAOPass() = default;
   ~vtkSSAOPass() override = default;
@@ -139,6 +152,7 @@ protected:
   double Radius = 0.5;
   double Bias = 0.01;
   bool Blur = false;
+  unsigned int DownsamplingFactor = 1;
 
 private:
   vtkSSAOPass(const vtkSSAOPass&) = delete;
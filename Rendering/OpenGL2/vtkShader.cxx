@@ -61,6 +61,11 @@ bool vtkShader::Compile()
     case vtkShader::Geometry:
       type = GL_GEOMETRY_SHADER;
       break;
+#endif
+#ifdef GL_COMPUTE_SHADER
+    case vtkShader::Compute:
+      type = GL_COMPUTE_SHADER;
+      break;
 #endif
     case vtkShader::Fragment:
       type = GL_FRAGMENT_SHADER;
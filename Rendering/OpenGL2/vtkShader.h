@@ -47,6 +47,7 @@ public:
     Vertex,   /**< Vertex shader */
     Fragment, /**< Fragment shader */
     Geometry, /**< Geometry shader */
+    Compute,  /**< Compute shader, requires OpenGL 4.3 at run time */
     Unknown   /**< Unknown (default) */
   };
 
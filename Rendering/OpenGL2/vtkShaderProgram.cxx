@@ -71,6 +71,7 @@ vtkStandardNewMacro(vtkShaderProgram);
 vtkCxxSetObjectMacro(vtkShaderProgram, VertexShader, vtkShader);
 vtkCxxSetObjectMacro(vtkShaderProgram, FragmentShader, vtkShader);
 vtkCxxSetObjectMacro(vtkShaderProgram, GeometryShader, vtkShader);
+vtkCxxSetObjectMacro(vtkShaderProgram, ComputeShader, vtkShader);
 vtkCxxSetObjectMacro(vtkShaderProgram, TransformFeedback, vtkTransformFeedback);
 
 vtkShaderProgram::vtkShaderProgram()
@@ -81,6 +82,8 @@ vtkShaderProgram::vtkShaderProgram()
   this->FragmentShader->SetType(vtkShader::Fragment);
   this->GeometryShader = vtkShader::New();
   this->GeometryShader->SetType(vtkShader::Geometry);
+  this->ComputeShader = vtkShader::New();
+  this->ComputeShader->SetType(vtkShader::Compute);
 
   this->TransformFeedback = nullptr;
 
@@ -90,6 +93,7 @@ vtkShaderProgram::vtkShaderProgram()
   this->VertexShaderHandle = 0;
   this->FragmentShaderHandle = 0;
   this->GeometryShaderHandle = 0;
+  this->ComputeShaderHandle = 0;
   this->Linked = false;
   this->Bound = false;
 
@@ -114,6 +118,11 @@ vtkShaderProgram::~vtkShaderProgram()
     this->GeometryShader->Delete();
     this->GeometryShader = nullptr;
   }
+  if (this->ComputeShader)
+  {
+    this->ComputeShader->Delete();
+    this->ComputeShader = nullptr;
+  }
   if (this->TransformFeedback)
   {
     this->TransformFeedback->Delete();
@@ -225,6 +234,18 @@ bool vtkShaderProgram::AttachShader(const vtkShader* shader)
 // only use GS if supported
 #ifdef GL_GEOMETRY_SHADER
     this->GeometryShaderHandle = shader->GetHandle();
+#endif
+  }
+  else if (shader->GetType() == vtkShader::Compute)
+  {
+    if (this->ComputeShaderHandle != 0)
+    {
+      glDetachShader(
+        static_cast<GLuint>(this->Handle), static_cast<GLuint>(this->ComputeShaderHandle));
+    }
+// only use CS if supported
+#ifdef GL_COMPUTE_SHADER
+    this->ComputeShaderHandle = shader->GetHandle();
 #endif
   }
   else
@@ -297,6 +318,21 @@ bool vtkShaderProgram::DetachShader(const vtkShader* shader)
         this->Linked = false;
         return true;
       }
+#endif
+#ifdef GL_COMPUTE_SHADER
+    case vtkShader::Compute:
+      if (this->ComputeShaderHandle != shader->GetHandle())
+      {
+        this->Error = "The supplied shader was not attached to this program.";
+        return false;
+      }
+      else
+      {
+        glDetachShader(static_cast<GLuint>(this->Handle), static_cast<GLuint>(shader->GetHandle()));
+        this->ComputeShaderHandle = 0;
+        this->Linked = false;
+        return true;
+      }
 #endif
     case vtkShader::Unknown:
     default:
@@ -423,6 +459,40 @@ bool vtkShaderProgram::Bind()
 // return 0 if there is an issue
 int vtkShaderProgram::CompileShader()
 {
+#ifdef GL_COMPUTE_SHADER
+  // a compute shader forms a program of its own and may not be combined
+  // with the other stages
+  if (!this->GetComputeShader()->GetSource().empty())
+  {
+    if (!this->GetComputeShader()->Compile())
+    {
+      int lineNum = 1;
+      std::istringstream stream(this->GetComputeShader()->GetSource());
+      std::stringstream sstm;
+      std::string aline;
+      while (std::getline(stream, aline))
+      {
+        sstm << lineNum << ": " << aline << "\n";
+        lineNum++;
+      }
+      vtkErrorMacro(<< sstm.str());
+      vtkErrorMacro(<< this->GetComputeShader()->GetError());
+      return 0;
+    }
+    if (!this->AttachShader(this->GetComputeShader()))
+    {
+      vtkErrorMacro(<< this->GetError());
+      return 0;
+    }
+    if (!this->Link())
+    {
+      vtkErrorMacro(<< "Links failed: " << this->GetError());
+      return 0;
+    }
+    this->Compiled = true;
+    return 1;
+  }
+#endif
   if (!this->GetVertexShader()->Compile())
   {
     int lineNum = 1;
@@ -518,9 +588,11 @@ void vtkShaderProgram::ReleaseGraphicsResources(vtkWindow* win)
     this->DetachShader(this->VertexShader);
     this->DetachShader(this->FragmentShader);
     this->DetachShader(this->GeometryShader);
+    this->DetachShader(this->ComputeShader);
     this->VertexShader->Cleanup();
     this->FragmentShader->Cleanup();
     this->GeometryShader->Cleanup();
+    this->ComputeShader->Cleanup();
     this->Compiled = false;
   }
 
@@ -72,6 +72,16 @@ public:
   void SetGeometryShader(vtkShader*);
   ///@}
 
+  ///@{
+  /**
+   * Get the compute shader for this program. A compute shader forms a
+   * program of its own and may not be combined with the other stages.
+   * Requires OpenGL 4.3 at run time.
+   */
+  vtkGetObjectMacro(ComputeShader, vtkShader);
+  void SetComputeShader(vtkShader*);
+  ///@}
+
   ///@{
   /**
    * Get/Set a TransformFeedbackCapture object on this shader program.
@@ -357,6 +367,7 @@ protected:
   vtkShader* VertexShader;
   vtkShader* FragmentShader;
   vtkShader* GeometryShader;
+  vtkShader* ComputeShader;
   vtkTransformFeedback* TransformFeedback;
 
   // hash of the shader program
@@ -368,6 +379,7 @@ protected:
   int VertexShaderHandle;
   int FragmentShaderHandle;
   int GeometryShaderHandle;
+  int ComputeShaderHandle;
 
   bool Linked;
   bool Bound;
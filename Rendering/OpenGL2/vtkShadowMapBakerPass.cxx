@@ -330,33 +330,32 @@ void vtkShadowMapBakerPass::Render(const vtkRenderState* s)
     // 1. Create a shadow map for each spotlight.
 
     // Do we need to recreate shadow maps?
-    this->NeedUpdate = this->LastRenderTime < lights->GetMTime();
-    if (!this->NeedUpdate)
+    bool lightCollectionModified = this->LastRenderTime < lights->GetMTime();
+    bool anyLightModified = false;
+    lights->InitTraversal();
+    l = lights->GetNextItem();
+    while (!anyLightModified && l != nullptr)
     {
-      lights->InitTraversal();
+      anyLightModified = this->LastRenderTime < l->GetMTime();
       l = lights->GetNextItem();
-      while (!this->NeedUpdate && l != nullptr)
-      {
-        this->NeedUpdate = this->LastRenderTime < l->GetMTime();
-        l = lights->GetNextItem();
-      }
-    }
-    if (!this->NeedUpdate)
-    {
-      this->NeedUpdate = this->LastRenderTime < r->GetViewProps()->GetMTime() ||
-        this->LastRenderTime < latestPropTime;
     }
 
-    if (!this->NeedUpdate)
+    bool propsModified = this->LastRenderTime < r->GetViewProps()->GetMTime() ||
+      this->LastRenderTime < latestPropTime;
+    int propIndex = 0;
+    while (!propsModified && propIndex < propArrayCount)
     {
-      int i = 0;
-      while (i < propArrayCount)
-      {
-        this->NeedUpdate = this->LastRenderTime < propArray[i]->GetMTime();
-        ++i;
-      }
+      propsModified = this->LastRenderTime < propArray[propIndex]->GetMTime();
+      ++propIndex;
     }
 
+    this->NeedUpdate = lightCollectionModified || anyLightModified || propsModified;
+
+    // When only individual lights moved, the casters and therefore the scene
+    // bounds and the other light cameras are unchanged: only the maps of the
+    // modified lights have to be re-rendered.
+    bool updateAllMaps = lightCollectionModified || propsModified;
+
     bool autoLight = r->GetAutomaticLightCreation() == 1;
     vtkCamera* realCamera = r->GetActiveCamera();
     vtkRenderState s2(r);
@@ -413,6 +412,7 @@ void vtkShadowMapBakerPass::Render(const vtkRenderState* s)
       {
         this->ShadowMaps = new std::vector<vtkSmartPointer<vtkTextureObject>>();
         this->ShadowMaps->resize(numberOfShadowLights);
+        updateAllMaps = true;
       }
 
       if (this->LightCameras != nullptr && this->LightCameras->size() != numberOfShadowLights)
@@ -425,6 +425,7 @@ void vtkShadowMapBakerPass::Render(const vtkRenderState* s)
       {
         this->LightCameras = new std::vector<vtkSmartPointer<vtkCamera>>();
         this->LightCameras->resize(numberOfShadowLights);
+        updateAllMaps = true;
       }
 
       r->SetAutomaticLightCreation(false);
@@ -498,6 +499,14 @@ void vtkShadowMapBakerPass::Render(const vtkRenderState* s)
             lightCamera->Delete();
           }
 
+          if (!updateAllMaps && !(this->LastRenderTime < l->GetMTime()))
+          {
+            // this light and the casters are unchanged: keep the baked map
+            ++this->CurrentLightIndex;
+            l = lights->GetNextItem();
+            continue;
+          }
+
           // Build light camera
           this->BuildCameraLight(l, bb, lightCamera);
           r->SetActiveCamera(lightCamera);
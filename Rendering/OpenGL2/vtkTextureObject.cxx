@@ -1487,6 +1487,41 @@ bool vtkTextureObject::Create2DFromRaw(
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkTextureObject::Create2DFromCompressedRaw(unsigned int width, unsigned int height,
+  unsigned int glInternalFormat, size_t dataSize, const void* data)
+{
+  assert(this->Context);
+  assert(data);
+
+  // The payload is uploaded as is; there is no client-side format or type.
+  this->InternalFormat = glInternalFormat;
+  this->Format = 0;
+  this->Type = 0;
+  this->Components = 4;
+
+  GLenum target = GL_TEXTURE_2D;
+  this->Target = target;
+  this->Width = width;
+  this->Height = height;
+  this->Depth = 1;
+  this->NumberOfDimensions = 2;
+  this->Context->ActivateTexture(this);
+  this->CreateTexture();
+  this->Bind();
+
+  this->Context->GetState()->vtkglPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  glCompressedTexImage2D(this->Target, 0, this->InternalFormat, static_cast<GLsizei>(this->Width),
+    static_cast<GLsizei>(this->Height), 0, static_cast<GLsizei>(dataSize),
+    static_cast<const GLvoid*>(data));
+
+  vtkOpenGLCheckErrorMacro("failed at glCompressedTexImage2D");
+
+  this->Deactivate();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 bool vtkTextureObject::CreateCubeFromRaw(
   unsigned int width, unsigned int height, int numComps, int dataType, void* data[6])
@@ -203,6 +203,15 @@ public:
   bool Create2DFromRaw(
     unsigned int width, unsigned int height, int numComps, int dataType, void* data);
 
+  /**
+   * Create a 2D texture from a pre-compressed payload (e.g. S3TC, BPTC or
+   * ASTC blocks) in client memory. glInternalFormat must be a compressed
+   * OpenGL internal format supported by the driver, and dataSize the
+   * payload size in bytes. Only a single mip level is uploaded.
+   */
+  bool Create2DFromCompressedRaw(unsigned int width, unsigned int height,
+    unsigned int glInternalFormat, size_t dataSize, const void* data);
+
   /**
    * Create a 2D depth texture using a raw pointer.
    * This is a blocking call. If you can, use PBO instead.
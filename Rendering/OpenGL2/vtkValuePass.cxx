@@ -33,6 +33,7 @@
 #include "vtkOpenGLRenderer.h"
 #include "vtkOpenGLState.h"
 #include "vtkOpenGLVertexArrayObject.h"
+#include "vtkPixelBufferObject.h"
 #include "vtkPolyData.h"
 #include "vtkProp.h"
 #include "vtkProperty.h"
@@ -45,6 +46,7 @@
 #include "vtkTimeStamp.h"
 
 #include <cassert>
+#include <cstring>
 #include <vector>
 
 struct vtkValuePass::Parameters
@@ -88,7 +90,13 @@ public:
     , CellFloatTexture(nullptr)
     , CellFloatBuffer(nullptr)
     , OutputFloatArray(vtkFloatArray::New())
+    , ReadbackPBO(nullptr)
+    , ReadbackFence(nullptr)
+    , ReadbackPending(false)
   {
+    this->ReadbackSize[0] = 0;
+    this->ReadbackSize[1] = 0;
+
     this->FloatImageExt[0] = 0;
     this->FloatImageExt[1] = 0;
     this->FloatImageExt[2] = 0;
@@ -143,6 +151,12 @@ public:
       this->OutputFloatArray->Delete();
       this->OutputFloatArray = nullptr;
     }
+
+    if (this->ReadbackPBO)
+    {
+      this->ReadbackPBO->Delete();
+      this->ReadbackPBO = nullptr;
+    }
   }
 
   vtkOpenGLFramebufferObject* ValueFBO;
@@ -161,6 +175,12 @@ public:
   std::vector<vtkIdType> CellCellMap;
   vtkMTimeType CCMapTime;
 
+  // Asynchronous readback state (BeginFloatImageReadback).
+  vtkPixelBufferObject* ReadbackPBO;
+  GLsync ReadbackFence;
+  bool ReadbackPending;
+  int ReadbackSize[2];
+
 private:
   vtkInternalsFloat(const vtkInternalsFloat&) = delete;
   void operator=(const vtkInternalsFloat&) = delete;
@@ -683,16 +703,121 @@ vtkFloatArray* vtkValuePass::GetFloatImageDataArray(vtkRenderer* ren)
   int* size = this->ImplFloat->ValueFBO->GetLastSize();
   this->ImplFloat->OutputFloatArray->SetNumberOfTuples(size[0] * size[1]);
 
-  // RGB channels are all equal in the FBO (they all contain the same rendered
-  // values), by default RED is copied.
   vtkRenderWindow* renWin = ren->GetRenderWindow();
   renWin->MakeCurrent();
+
+  // Consume a readback issued by BeginFloatImageReadback if one is in flight,
+  // waiting on its fence only if the transfer has not completed yet.
+  if (this->ImplFloat->ReadbackPending)
+  {
+    bool consumed = false;
+    if (this->ImplFloat->ReadbackSize[0] == size[0] && this->ImplFloat->ReadbackSize[1] == size[1])
+    {
+      GLenum status = GL_TIMEOUT_EXPIRED;
+      while (status == GL_TIMEOUT_EXPIRED)
+      {
+        status = glClientWaitSync(this->ImplFloat->ReadbackFence, GL_SYNC_FLUSH_COMMANDS_BIT,
+          1000000 /* 1 ms slices */);
+      }
+
+      void* mapped = this->ImplFloat->ReadbackPBO->MapPackedBuffer();
+      if (mapped)
+      {
+        memcpy(this->ImplFloat->OutputFloatArray->GetVoidPointer(0), mapped,
+          static_cast<size_t>(size[0]) * static_cast<size_t>(size[1]) * sizeof(float));
+        this->ImplFloat->ReadbackPBO->UnmapPackedBuffer();
+        consumed = true;
+      }
+    }
+
+    glDeleteSync(this->ImplFloat->ReadbackFence);
+    this->ImplFloat->ReadbackFence = nullptr;
+    this->ImplFloat->ReadbackPending = false;
+
+    if (consumed)
+    {
+      return this->ImplFloat->OutputFloatArray;
+    }
+    // The FBO was resized since the readback was issued (or the map failed),
+    // fall back to a synchronous read.
+  }
+
+  // RGB channels are all equal in the FBO (they all contain the same rendered
+  // values), by default RED is copied.
   this->GetFloatImageData(
     GL_RED, size[0], size[1], this->ImplFloat->OutputFloatArray->GetVoidPointer(0));
 
   return this->ImplFloat->OutputFloatArray;
 }
 
+//------------------------------------------------------------------------------
+void vtkValuePass::BeginFloatImageReadback(vtkRenderer* ren)
+{
+  if (!this->ImplFloat->FBOAllocated)
+  {
+    return;
+  }
+
+  vtkRenderWindow* renWin = ren->GetRenderWindow();
+  renWin->MakeCurrent();
+
+  // Drop a previously issued transfer that was never consumed.
+  if (this->ImplFloat->ReadbackPending)
+  {
+    glDeleteSync(this->ImplFloat->ReadbackFence);
+    this->ImplFloat->ReadbackFence = nullptr;
+    this->ImplFloat->ReadbackPending = false;
+  }
+
+  int* size = this->ImplFloat->ValueFBO->GetLastSize();
+  if (!this->ImplFloat->ReadbackPBO)
+  {
+    this->ImplFloat->ReadbackPBO = vtkPixelBufferObject::New();
+    this->ImplFloat->ReadbackPBO->SetContext(renWin);
+  }
+  // Size the pack buffer for the current framebuffer (the mapping itself is
+  // discarded, this only allocates device memory).
+  this->ImplFloat->ReadbackPBO->MapPackedBuffer(
+    VTK_FLOAT, static_cast<unsigned int>(size[0] * size[1]), 1);
+  this->ImplFloat->ReadbackPBO->UnmapPackedBuffer();
+
+  auto ostate = this->ImplFloat->ValueFBO->GetContext()->GetState();
+  ostate->PushReadFramebufferBinding();
+  this->ImplFloat->ValueFBO->Bind(GL_READ_FRAMEBUFFER);
+  this->ImplFloat->ValueFBO->ActivateReadBuffer(0);
+  ostate->vtkglPixelStorei(GL_PACK_ALIGNMENT, 1);
+#ifndef GL_ES_VERSION_3_0
+  glClampColor(GL_CLAMP_READ_COLOR, GL_FALSE);
+#endif
+
+  // With a pixel pack buffer bound, glReadPixels returns immediately and the
+  // transfer proceeds on the GPU; the fence tells us when it has finished.
+  this->ImplFloat->ReadbackPBO->BindToPackedBuffer();
+  glReadPixels(0, 0, size[0], size[1], GL_RED, GL_FLOAT, nullptr);
+  this->ImplFloat->ReadbackPBO->UnBind();
+  ostate->PopReadFramebufferBinding();
+
+  this->ImplFloat->ReadbackFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  glFlush();
+  this->ImplFloat->ReadbackSize[0] = size[0];
+  this->ImplFloat->ReadbackSize[1] = size[1];
+  this->ImplFloat->ReadbackPending = true;
+
+  vtkOpenGLCheckErrorMacro("Failed to issue asynchronous pixel readback!");
+}
+
+//------------------------------------------------------------------------------
+bool vtkValuePass::IsFloatImageReadbackReady()
+{
+  if (!this->ImplFloat->ReadbackPending)
+  {
+    return false;
+  }
+
+  GLenum status = glClientWaitSync(this->ImplFloat->ReadbackFence, 0, 0);
+  return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
 //------------------------------------------------------------------------------
 void vtkValuePass::GetFloatImageData(
   int const format, int const width, int const height, void* data)
@@ -791,6 +916,19 @@ void vtkValuePass::ReleaseGraphicsResources(vtkWindow* win)
   }
   this->ImplFloat->BuffersAllocated = false;
 
+  if (this->ImplFloat->ReadbackFence)
+  {
+    glDeleteSync(this->ImplFloat->ReadbackFence);
+    this->ImplFloat->ReadbackFence = nullptr;
+    this->ImplFloat->ReadbackPending = false;
+  }
+
+  if (this->ImplFloat->ReadbackPBO)
+  {
+    this->ImplFloat->ReadbackPBO->Delete();
+    this->ImplFloat->ReadbackPBO = nullptr;
+  }
+
   this->ReleaseFBO(win);
 }
 
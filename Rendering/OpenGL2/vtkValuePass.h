@@ -101,6 +101,20 @@ public:
    */
   int* GetFloatImageExtents();
 
+  ///@{
+  /**
+   * Asynchronous variant of GetFloatImageDataArray. BeginFloatImageReadback
+   * schedules the transfer of the rendered values into a pixel pack buffer
+   * and returns without waiting for the GPU; IsFloatImageReadbackReady polls
+   * the transfer without blocking. The next GetFloatImageDataArray call
+   * consumes the scheduled transfer (waiting for it only if it has not
+   * completed), so CPU work done in-between overlaps the GPU copy instead of
+   * stalling on glReadPixels.
+   */
+  void BeginFloatImageReadback(vtkRenderer* ren);
+  bool IsFloatImageReadbackReady();
+  ///@}
+
   void ReleaseGraphicsResources(vtkWindow* win) override;
 
 protected:
@@ -105,6 +105,15 @@
 #define FOR_EACH_SCENE_UNDERSTANDING_SERIALIZATION_FUNCTION(_)
 #endif
 
+#if XR_FB_foveation && XR_FB_swapchain_update_state
+#define FOR_EACH_FOVEATION_FUNCTION(_)                                                             \
+  _(xrCreateFoveationProfileFB)                                                                    \
+  _(xrDestroyFoveationProfileFB)                                                                   \
+  _(xrUpdateSwapchainFB)
+#else
+#define FOR_EACH_FOVEATION_FUNCTION(_)
+#endif
+
 #define FOR_EACH_EXTENSION_FUNCTION(_)                                                             \
   FOR_EACH_WIN32_EXTENSION_FUNCTION(_)                                                             \
   FOR_EACH_OPENGL_EXTENSION_FUNCTION(_)                                                            \
@@ -117,7 +126,8 @@
   FOR_EACH_CONTROLLER_MODEL_EXTENSION_FUNCTION(_)                                                  \
   FOR_EACH_PERCEPTION_ANCHOR_INTEROP_FUNCTION(_)                                                   \
   FOR_EACH_SCENE_UNDERSTANDING_FUNCTION(_)                                                         \
-  FOR_EACH_SCENE_UNDERSTANDING_SERIALIZATION_FUNCTION(_)
+  FOR_EACH_SCENE_UNDERSTANDING_SERIALIZATION_FUNCTION(_)                                           \
+  FOR_EACH_FOVEATION_FUNCTION(_)
 
 #define GET_INSTANCE_PROC_ADDRESS(name)                                                            \
   (void)xrGetInstanceProcAddr(                                                                     \
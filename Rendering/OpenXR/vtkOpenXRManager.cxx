@@ -598,6 +598,13 @@ std::vector<const char*> vtkOpenXRManager::SelectExtensions()
   this->OptionalExtensions.ControllerModelExtensionSupported =
     EnableExtensionIfSupported(XR_MSFT_CONTROLLER_MODEL_EXTENSION_NAME);
 
+#if XR_FB_foveation && XR_FB_foveation_configuration && XR_FB_swapchain_update_state
+  this->OptionalExtensions.FoveationSupported =
+    EnableExtensionIfSupported(XR_FB_FOVEATION_EXTENSION_NAME) &&
+    EnableExtensionIfSupported(XR_FB_FOVEATION_CONFIGURATION_EXTENSION_NAME) &&
+    EnableExtensionIfSupported(XR_FB_SWAPCHAIN_UPDATE_STATE_EXTENSION_NAME);
+#endif
+
   this->PrintOptionalExtensions();
 
   return enabledExtensions;
@@ -626,6 +633,10 @@ void vtkOpenXRManager::PrintOptionalExtensions()
   {
     std::cout << "Optional extensions HandTrackingSupported is supported" << std::endl;
   }
+  if (this->OptionalExtensions.FoveationSupported)
+  {
+    std::cout << "Optional extensions FoveationSupported is supported" << std::endl;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1015,6 +1026,7 @@ bool vtkOpenXRManager::CreateSwapchains()
     this->RenderResources->ColorSwapchains[i] = this->CreateSwapchainOpenGL(colorSwapchainFormat,
       imageRectWidth, imageRectHeight, swapchainSampleCount, 0 /*createFlags*/,
       XR_SWAPCHAIN_USAGE_TRANSFER_DST_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT);
+    this->ApplyFoveationProfile(this->RenderResources->ColorSwapchains[i]);
 
     if (this->OptionalExtensions.DepthExtensionSupported)
     {
@@ -1058,6 +1070,18 @@ vtkOpenXRManager::SwapchainOpenGL_t vtkOpenXRManager::CreateSwapchainOpenGL(int6
   swapchainCreateInfo.createFlags = createFlags;
   swapchainCreateInfo.usageFlags = usageFlags;
 
+#if XR_FB_foveation && XR_FB_foveation_configuration && XR_FB_swapchain_update_state
+  // Color swapchains must be created foveation-capable for the runtime to
+  // accept a foveation profile on them later
+  XrSwapchainCreateInfoFoveationFB foveationCreateInfo{ XR_TYPE_SWAPCHAIN_CREATE_INFO_FOVEATION_FB };
+  if (this->OptionalExtensions.FoveationSupported && this->FoveationLevel > 0 &&
+    (usageFlags & XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT))
+  {
+    foveationCreateInfo.flags = XR_SWAPCHAIN_CREATE_FOVEATION_SCALED_BIN_BIT_FB;
+    swapchainCreateInfo.next = &foveationCreateInfo;
+  }
+#endif
+
   this->XrCheckError(xrCreateSwapchain(this->Session, &swapchainCreateInfo, &swapchain.Swapchain),
     "Failed to create swapchain!");
 
@@ -1074,6 +1098,46 @@ vtkOpenXRManager::SwapchainOpenGL_t vtkOpenXRManager::CreateSwapchainOpenGL(int6
   return swapchain;
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenXRManager::ApplyFoveationProfile(SwapchainOpenGL_t& swapchain)
+{
+#if XR_FB_foveation && XR_FB_foveation_configuration && XR_FB_swapchain_update_state
+  if (!this->OptionalExtensions.FoveationSupported || this->FoveationLevel == 0)
+  {
+    return;
+  }
+
+  // XrFoveationLevelFB enumerants match our 0 (none) to 3 (high) levels
+  XrFoveationLevelProfileCreateInfoFB levelProfileCreateInfo{
+    XR_TYPE_FOVEATION_LEVEL_PROFILE_CREATE_INFO_FB
+  };
+  levelProfileCreateInfo.level = static_cast<XrFoveationLevelFB>(this->FoveationLevel);
+  levelProfileCreateInfo.verticalOffset = 0.f;
+  levelProfileCreateInfo.dynamic = XR_FOVEATION_DYNAMIC_DISABLED_FB;
+
+  XrFoveationProfileCreateInfoFB profileCreateInfo{ XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB };
+  profileCreateInfo.next = &levelProfileCreateInfo;
+
+  XrFoveationProfileFB foveationProfile;
+  if (!this->XrCheckWarn(this->Extensions.xrCreateFoveationProfileFB(
+                           this->Session, &profileCreateInfo, &foveationProfile),
+        "Failed to create the foveation profile"))
+  {
+    return;
+  }
+
+  XrSwapchainStateFoveationFB foveationState{ XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB };
+  foveationState.profile = foveationProfile;
+  this->XrCheckWarn(this->Extensions.xrUpdateSwapchainFB(swapchain.Swapchain,
+                      reinterpret_cast<XrSwapchainStateBaseHeaderFB*>(&foveationState)),
+    "Failed to apply the foveation profile to the swapchain");
+
+  this->Extensions.xrDestroyFoveationProfileFB(foveationProfile);
+#else
+  (void)swapchain;
+#endif
+}
+
 //------------------------------------------------------------------------------
 bool vtkOpenXRManager::CreateConfigViews()
 {
@@ -157,6 +157,18 @@ public:
   bool IsDepthExtensionSupported() { return this->OptionalExtensions.DepthExtensionSupported; }
   //@}
 
+  //@{
+  /**
+   * Set/Get the requested level of fixed foveated rendering, from 0 (off,
+   * the default) to 3 (high, strongest shading rate reduction towards the
+   * periphery of each eye). Must be set before Initialize. Silently ignored
+   * when the runtime does not support the XR_FB_foveation extensions or the
+   * headers used to build VTK predate them.
+   */
+  void SetFoveationLevel(uint32_t level) { this->FoveationLevel = level > 3 ? 3 : level; }
+  uint32_t GetFoveationLevel() { return this->FoveationLevel; }
+  //@}
+
   //@{
   /**
    * Return true if the current frame should be rendered.
@@ -445,6 +457,15 @@ protected:
     uint32_t sampleCount, XrSwapchainCreateFlags createFlags, XrSwapchainUsageFlags usageFlags);
   //@}
 
+  //@{
+  /**
+   * Apply the requested fixed foveated rendering profile to a color
+   * swapchain. Does nothing when the runtime does not support the foveation
+   * extensions or when FoveationLevel is 0.
+   */
+  void ApplyFoveationProfile(SwapchainOpenGL_t& swapchain);
+  //@}
+
   //@{
   /**
    *  Creates the reference space of type ReferenceSpaceType that will be used to locate views
@@ -526,9 +547,15 @@ protected:
     bool UnboundedRefSpaceSupported{ false };
     bool SpatialAnchorSupported{ false };
     bool HandTrackingSupported{ false };
+    bool FoveationSupported{ false };
   } OptionalExtensions;
   //@}
 
+  /**
+   * Requested fixed foveated rendering level, see SetFoveationLevel.
+   */
+  uint32_t FoveationLevel{ 0 };
+
   std::shared_ptr<void> GraphicsBinding;
 
   /**
@@ -119,6 +119,7 @@ void vtkOpenXRRenderWindow::Initialize()
   this->OpenGLInit();
 
   vtkOpenXRManager& xrManager = vtkOpenXRManager::GetInstance();
+  xrManager.SetFoveationLevel(static_cast<uint32_t>(this->FoveationLevel));
   if (!xrManager.Initialize(this->HelperWindow))
   {
     // Set to false because the above init of the HelperWindow sets it to true
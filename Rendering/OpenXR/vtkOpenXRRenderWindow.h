@@ -140,6 +140,19 @@ public:
   void SetModelActiveState(const int hand, bool state) { this->ModelsActiveState[hand] = state; }
   //@}
 
+  //@{
+  /**
+   * Set/Get the level of fixed foveated rendering to request from the
+   * runtime, from 0 (off, the default) to 3 (high). Higher levels lower the
+   * shading rate towards the periphery of each eye, which can substantially
+   * reduce the fragment cost of large scenes with no visible change in the
+   * center of gaze. Must be set before Initialize and it is silently ignored
+   * when the runtime does not support the OpenXR foveation extensions.
+   */
+  vtkSetClampMacro(FoveationLevel, int, 0, 3);
+  vtkGetMacro(FoveationLevel, int);
+  //@}
+
   uint32_t GetDeviceHandleForOpenXRHandle(uint32_t index);
   vtkEventDataDevice GetDeviceForOpenXRHandle(uint32_t ohandle);
 
@@ -170,6 +183,8 @@ protected:
   // of active/inactive controller
   std::array<bool, 2> ModelsActiveState = { true, true };
 
+  int FoveationLevel = 0;
+
 private:
   vtkOpenXRRenderWindow(const vtkOpenXRRenderWindow&) = delete;
   void operator=(const vtkOpenXRRenderWindow&) = delete;
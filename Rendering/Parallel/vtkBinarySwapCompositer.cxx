@@ -0,0 +1,410 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBinarySwapCompositer.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkBinarySwapCompositer.h"
+
+#include "vtkCompressCompositer.h"
+#include "vtkFloatArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstring>
+
+vtkStandardNewMacro(vtkBinarySwapCompositer);
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::vtkBinarySwapCompositer()
+{
+  this->SendPData = nullptr;
+  this->SendZData = nullptr;
+  this->RecvPData = nullptr;
+  this->RecvZData = nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::~vtkBinarySwapCompositer()
+{
+  if (this->SendPData)
+  {
+    vtkCompositer::DeleteArray(this->SendPData);
+    this->SendPData = nullptr;
+  }
+  if (this->SendZData)
+  {
+    vtkCompositer::DeleteArray(this->SendZData);
+    this->SendZData = nullptr;
+  }
+  if (this->RecvPData)
+  {
+    vtkCompositer::DeleteArray(this->RecvPData);
+    this->RecvPData = nullptr;
+  }
+  if (this->RecvZData)
+  {
+    vtkCompositer::DeleteArray(this->RecvZData);
+    this->RecvZData = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+namespace
+{
+
+// Composite a range of uncompressed pixels; the remote pixel wins where its
+// depth is closer. Results are stored in the local data.
+void vtkBinarySwapCompositePixels(
+  float* localZ, unsigned char* localP, float* remoteZ, unsigned char* remoteP, vtkIdType numPixels,
+  int pixelSize)
+{
+  for (vtkIdType i = 0; i < numPixels; ++i)
+  {
+    if (remoteZ[i] < localZ[i])
+    {
+      localZ[i] = remoteZ[i];
+      memcpy(localP + i * pixelSize, remoteP + i * pixelSize, pixelSize);
+    }
+  }
+}
+
+// Create an array of the same type as the prototype wrapping (not copying)
+// the given range of pixel memory.
+vtkSmartPointer<vtkDataArray> vtkBinarySwapWrapPixels(
+  vtkDataArray* prototype, unsigned char* pixels, vtkIdType numPixels, int pixelSize)
+{
+  int numComps = prototype->GetNumberOfComponents();
+  if (prototype->GetDataType() == VTK_UNSIGNED_CHAR)
+  {
+    vtkSmartPointer<vtkUnsignedCharArray> view = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    view->SetNumberOfComponents(numComps);
+    view->SetArray(pixels, numPixels * pixelSize, 1);
+    return view;
+  }
+  vtkSmartPointer<vtkFloatArray> view = vtkSmartPointer<vtkFloatArray>::New();
+  view->SetNumberOfComponents(numComps);
+  view->SetArray(reinterpret_cast<float*>(pixels), numPixels * numComps, 1);
+  return view;
+}
+
+vtkSmartPointer<vtkFloatArray> vtkBinarySwapWrapDepth(float* depth, vtkIdType numPixels)
+{
+  vtkSmartPointer<vtkFloatArray> view = vtkSmartPointer<vtkFloatArray>::New();
+  view->SetNumberOfComponents(1);
+  view->SetArray(depth, numPixels, 1);
+  return view;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::PrepareStagingBuffers(vtkDataArray* pBuf, vtkFloatArray* zBuf)
+{
+  int numComps = pBuf->GetNumberOfComponents();
+
+  vtkDataArray** pStagings[2] = { &this->SendPData, &this->RecvPData };
+  for (vtkDataArray** pStaging : pStagings)
+  {
+    if (*pStaging == nullptr || (*pStaging)->GetDataType() != pBuf->GetDataType() ||
+      (*pStaging)->GetSize() < pBuf->GetSize())
+    {
+      if (*pStaging)
+      {
+        vtkCompositer::DeleteArray(*pStaging);
+        *pStaging = nullptr;
+      }
+      if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+      {
+        *pStaging = vtkUnsignedCharArray::New();
+        vtkCompositer::ResizeUnsignedCharArray(
+          static_cast<vtkUnsignedCharArray*>(*pStaging), numComps, pBuf->GetSize());
+      }
+      else
+      {
+        *pStaging = vtkFloatArray::New();
+        vtkCompositer::ResizeFloatArray(
+          static_cast<vtkFloatArray*>(*pStaging), numComps, pBuf->GetSize());
+      }
+    }
+  }
+
+  vtkFloatArray** zStagings[2] = { &this->SendZData, &this->RecvZData };
+  for (vtkFloatArray** zStaging : zStagings)
+  {
+    if (*zStaging == nullptr || (*zStaging)->GetSize() < zBuf->GetSize())
+    {
+      if (*zStaging)
+      {
+        vtkCompositer::DeleteArray(*zStaging);
+        *zStaging = nullptr;
+      }
+      *zStaging = vtkFloatArray::New();
+      vtkCompositer::ResizeFloatArray(*zStaging, 1, zBuf->GetSize());
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::CompositeBuffer(
+  vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp)
+{
+  int myId = this->Controller->GetLocalProcessId();
+  int numProcs = this->NumberOfProcesses;
+  vtkIdType totalPixels = zBuf->GetNumberOfTuples();
+  int numComps = pBuf->GetNumberOfComponents();
+  int pixelSize = numComps * pBuf->GetDataTypeSize();
+
+  if (numProcs <= 1 || totalPixels < 1)
+  {
+    return;
+  }
+
+  this->PrepareStagingBuffers(pBuf, zBuf);
+
+  float* zData = zBuf->GetPointer(0);
+  unsigned char* pData = static_cast<unsigned char*>(pBuf->GetVoidPointer(0));
+  float* zTmpData = zTmp->GetPointer(0);
+  unsigned char* pTmpData = static_cast<unsigned char*>(pTmp->GetVoidPointer(0));
+
+  // The swap rounds need a power of 2 processes; the extra processes fold
+  // their full (compressed) buffers into their partner first and are done.
+  int pow2 = 1;
+  int logProcs = 0;
+  while (pow2 * 2 <= numProcs)
+  {
+    pow2 *= 2;
+    logProcs++;
+  }
+  int numExtra = numProcs - pow2;
+
+#ifdef MPIPROALLOC
+  vtkCommunicator::SetUseCopy(0);
+#endif
+
+  if (myId >= pow2)
+  {
+    vtkSmartPointer<vtkFloatArray> zView = vtkBinarySwapWrapDepth(zData, totalPixels);
+    vtkSmartPointer<vtkDataArray> pView =
+      vtkBinarySwapWrapPixels(pBuf, pData, totalPixels, pixelSize);
+    vtkCompressCompositer::Compress(zView, pView, this->SendZData, this->SendPData);
+
+    int sizes[2] = { static_cast<int>(this->SendZData->GetNumberOfTuples()),
+      static_cast<int>(this->SendPData->GetNumberOfTuples() * numComps) };
+    this->Controller->Send(sizes, 2, myId - pow2, 98);
+    this->Controller->Send(this->SendZData->GetPointer(0), sizes[0], myId - pow2, 99);
+    if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+    {
+      this->Controller->Send(
+        static_cast<unsigned char*>(this->SendPData->GetVoidPointer(0)), sizes[1], myId - pow2, 99);
+    }
+    else
+    {
+      this->Controller->Send(
+        static_cast<float*>(this->SendPData->GetVoidPointer(0)), sizes[1], myId - pow2, 99);
+    }
+#ifdef MPIPROALLOC
+    vtkCommunicator::SetUseCopy(1);
+#endif
+    return;
+  }
+
+  if (myId < numExtra)
+  {
+    int sizes[2];
+    this->Controller->Receive(sizes, 2, myId + pow2, 98);
+    this->Controller->Receive(this->RecvZData->GetPointer(0), sizes[0], myId + pow2, 99);
+    if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+    {
+      this->Controller->Receive(
+        static_cast<unsigned char*>(this->RecvPData->GetVoidPointer(0)), sizes[1], myId + pow2, 99);
+    }
+    else
+    {
+      this->Controller->Receive(
+        static_cast<float*>(this->RecvPData->GetVoidPointer(0)), sizes[1], myId + pow2, 99);
+    }
+    this->RecvZData->SetNumberOfTuples(sizes[0]);
+    this->RecvPData->SetNumberOfTuples(sizes[1] / numComps);
+
+    vtkSmartPointer<vtkFloatArray> zOut = vtkBinarySwapWrapDepth(zTmpData, totalPixels);
+    vtkSmartPointer<vtkDataArray> pOut =
+      vtkBinarySwapWrapPixels(pBuf, pTmpData, totalPixels, pixelSize);
+    vtkCompressCompositer::Uncompress(
+      this->RecvZData, this->RecvPData, zOut, pOut, static_cast<int>(totalPixels));
+
+    vtkBinarySwapCompositePixels(zData, pData, zTmpData, pTmpData, totalPixels, pixelSize);
+  }
+
+  // Binary-swap rounds. In each round the process keeps one half of its
+  // current span and trades the other half with its partner; after all
+  // rounds the process owns the fully composited pixels of its final span.
+  vtkIdType offset = 0;
+  vtkIdType span = totalPixels;
+  for (int round = 0; round < logProcs; ++round)
+  {
+    int halfGroup = 1 << round;
+    int partner = myId ^ halfGroup;
+    vtkIdType lowSize = span / 2;
+    vtkIdType highSize = span - lowSize;
+    int keepLow = (myId & halfGroup) == 0;
+    vtkIdType keepOffset = keepLow ? offset : offset + lowSize;
+    vtkIdType keepSize = keepLow ? lowSize : highSize;
+    vtkIdType sendOffset = keepLow ? offset + lowSize : offset;
+    vtkIdType sendSize = keepLow ? highSize : lowSize;
+
+    int sendSizes[2] = { 0, 0 };
+    if (sendSize > 0)
+    {
+      vtkSmartPointer<vtkFloatArray> zView =
+        vtkBinarySwapWrapDepth(zData + sendOffset, sendSize);
+      vtkSmartPointer<vtkDataArray> pView =
+        vtkBinarySwapWrapPixels(pBuf, pData + sendOffset * pixelSize, sendSize, pixelSize);
+      vtkCompressCompositer::Compress(zView, pView, this->SendZData, this->SendPData);
+      sendSizes[0] = static_cast<int>(this->SendZData->GetNumberOfTuples());
+      sendSizes[1] = static_cast<int>(this->SendPData->GetNumberOfTuples() * numComps);
+    }
+
+    // The lower rank of the pair sends first; the higher one receives first.
+    int recvSizes[2] = { 0, 0 };
+    for (int phase = 0; phase < 2; ++phase)
+    {
+      if ((myId < partner) == (phase == 0))
+      {
+        this->Controller->Send(sendSizes, 2, partner, 98);
+        if (sendSizes[0] > 0)
+        {
+          this->Controller->Send(this->SendZData->GetPointer(0), sendSizes[0], partner, 99);
+          if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+          {
+            this->Controller->Send(static_cast<unsigned char*>(this->SendPData->GetVoidPointer(0)),
+              sendSizes[1], partner, 99);
+          }
+          else
+          {
+            this->Controller->Send(
+              static_cast<float*>(this->SendPData->GetVoidPointer(0)), sendSizes[1], partner, 99);
+          }
+        }
+      }
+      else
+      {
+        this->Controller->Receive(recvSizes, 2, partner, 98);
+        if (recvSizes[0] > 0)
+        {
+          this->Controller->Receive(this->RecvZData->GetPointer(0), recvSizes[0], partner, 99);
+          if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+          {
+            this->Controller->Receive(
+              static_cast<unsigned char*>(this->RecvPData->GetVoidPointer(0)), recvSizes[1],
+              partner, 99);
+          }
+          else
+          {
+            this->Controller->Receive(static_cast<float*>(this->RecvPData->GetVoidPointer(0)),
+              recvSizes[1], partner, 99);
+          }
+        }
+      }
+    }
+
+    if (recvSizes[0] > 0 && keepSize > 0)
+    {
+      this->RecvZData->SetNumberOfTuples(recvSizes[0]);
+      this->RecvPData->SetNumberOfTuples(recvSizes[1] / numComps);
+
+      vtkSmartPointer<vtkFloatArray> zOut = vtkBinarySwapWrapDepth(zTmpData, keepSize);
+      vtkSmartPointer<vtkDataArray> pOut =
+        vtkBinarySwapWrapPixels(pBuf, pTmpData, keepSize, pixelSize);
+      vtkCompressCompositer::Uncompress(
+        this->RecvZData, this->RecvPData, zOut, pOut, static_cast<int>(keepSize));
+
+      vtkBinarySwapCompositePixels(zData + keepOffset, pData + keepOffset * pixelSize, zTmpData,
+        pTmpData, keepSize, pixelSize);
+    }
+
+    offset = keepOffset;
+    span = keepSize;
+  }
+
+  // Gather the composited spans onto process 0.
+  if (myId == 0)
+  {
+    for (int id = 1; id < pow2; ++id)
+    {
+      int header[4]; // offset, span, compressed z size, compressed p size
+      this->Controller->Receive(header, 4, id, 97);
+      if (header[2] < 1)
+      {
+        continue;
+      }
+      this->Controller->Receive(this->RecvZData->GetPointer(0), header[2], id, 99);
+      if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+      {
+        this->Controller->Receive(
+          static_cast<unsigned char*>(this->RecvPData->GetVoidPointer(0)), header[3], id, 99);
+      }
+      else
+      {
+        this->Controller->Receive(
+          static_cast<float*>(this->RecvPData->GetVoidPointer(0)), header[3], id, 99);
+      }
+      this->RecvZData->SetNumberOfTuples(header[2]);
+      this->RecvPData->SetNumberOfTuples(header[3] / numComps);
+
+      vtkSmartPointer<vtkFloatArray> zOut = vtkBinarySwapWrapDepth(zData + header[0], header[1]);
+      vtkSmartPointer<vtkDataArray> pOut =
+        vtkBinarySwapWrapPixels(pBuf, pData + header[0] * pixelSize, header[1], pixelSize);
+      vtkCompressCompositer::Uncompress(this->RecvZData, this->RecvPData, zOut, pOut, header[1]);
+    }
+  }
+  else
+  {
+    int header[4] = { static_cast<int>(offset), static_cast<int>(span), 0, 0 };
+    if (span > 0)
+    {
+      vtkSmartPointer<vtkFloatArray> zView = vtkBinarySwapWrapDepth(zData + offset, span);
+      vtkSmartPointer<vtkDataArray> pView =
+        vtkBinarySwapWrapPixels(pBuf, pData + offset * pixelSize, span, pixelSize);
+      vtkCompressCompositer::Compress(zView, pView, this->SendZData, this->SendPData);
+      header[2] = static_cast<int>(this->SendZData->GetNumberOfTuples());
+      header[3] = static_cast<int>(this->SendPData->GetNumberOfTuples() * numComps);
+    }
+    this->Controller->Send(header, 4, 0, 97);
+    if (header[2] > 0)
+    {
+      this->Controller->Send(this->SendZData->GetPointer(0), header[2], 0, 99);
+      if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+      {
+        this->Controller->Send(
+          static_cast<unsigned char*>(this->SendPData->GetVoidPointer(0)), header[3], 0, 99);
+      }
+      else
+      {
+        this->Controller->Send(
+          static_cast<float*>(this->SendPData->GetVoidPointer(0)), header[3], 0, 99);
+      }
+    }
+  }
+
+#ifdef MPIPROALLOC
+  vtkCommunicator::SetUseCopy(1);
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
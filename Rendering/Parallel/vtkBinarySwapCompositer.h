@@ -0,0 +1,77 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBinarySwapCompositer.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkBinarySwapCompositer
+ * @brief   Implements binary-swap compositing with compressed exchanges.
+ *
+ * vtkBinarySwapCompositer operates in multiple processes. In each of the
+ * log2(N) exchange rounds every process keeps one half of its current image
+ * span and trades the other half with its partner, so the compositing work
+ * and the communication volume stay balanced across all processes instead of
+ * idling half of them per round as the tree algorithms do. Exchanged halves
+ * and the final gather are run-length compressed with the
+ * vtkCompressCompositer helpers, which pays off for the large background
+ * areas typical of parallel rendering. The fully composited image ends up in
+ * the buffers of process 0.
+ *
+ * @sa
+ * vtkCompressCompositer vtkTreeCompositer
+ */
+
+#ifndef vtkBinarySwapCompositer_h
+#define vtkBinarySwapCompositer_h
+
+#include "vtkCompositer.h"
+#include "vtkRenderingParallelModule.h" // For export macro
+
+class vtkDataArray;
+class vtkFloatArray;
+
+class VTKRENDERINGPARALLEL_EXPORT vtkBinarySwapCompositer : public vtkCompositer
+{
+public:
+  static vtkBinarySwapCompositer* New();
+  vtkTypeMacro(vtkBinarySwapCompositer, vtkCompositer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  void CompositeBuffer(
+    vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp) override;
+
+protected:
+  vtkBinarySwapCompositer();
+  ~vtkBinarySwapCompositer() override;
+
+  /**
+   * Make sure the compressed send/receive staging buffers exist and match
+   * the pixel type and size of the given buffers.
+   */
+  void PrepareStagingBuffers(vtkDataArray* pBuf, vtkFloatArray* zBuf);
+
+  ///@{
+  /**
+   * Staging buffers for the compressed exchanges.
+   */
+  vtkDataArray* SendPData;
+  vtkFloatArray* SendZData;
+  vtkDataArray* RecvPData;
+  vtkFloatArray* RecvZData;
+  ///@}
+
+private:
+  vtkBinarySwapCompositer(const vtkBinarySwapCompositer&) = delete;
+  void operator=(const vtkBinarySwapCompositer&) = delete;
+};
+
+#endif
@@ -840,6 +840,10 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
   vtkActor* act = vtkActor::SafeDownCast(aNode->GetRenderable());
   vtkProperty* property = act->GetProperty();
 
+  // models already retained from earlier calls (one per block for composite
+  // data) must not be wrapped into instances again below
+  const size_t firstModel = this->GeometricModels.size();
+
   // get texture transform
   osp::vec4f texTransform{ 1.f, 0.f, 0.f, 1.f };
   vtkInformation* info = act->GetPropertyKeys();
@@ -1309,22 +1313,139 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
     ospRelease(mat);
   }
 
-  for (auto g : this->GeometricModels)
+  // remember whether this build used only the single actor level material
+  // and which property state shaped the geometry, so that a later
+  // appearance-only change can be recommitted without a rebuild
+  this->SingleActorMaterial = !useCustomMaterial && !property->GetMaterialName() &&
+    numCellMaterials == 0 && numPointColors == 0 && numPointValueTextureCoords == 0 &&
+    vColorTextureMap == nullptr && vNormalTextureMap == nullptr && !property->GetEdgeVisibility();
+  this->BuildRepresentation = property->GetRepresentation();
+  this->BuildInterpolation = property->GetInterpolation();
+  this->BuildPointSize = property->GetPointSize();
+  this->BuildLineWidth = property->GetLineWidth();
+  this->BuildVertexVisibility = property->GetVertexVisibility();
+
+  for (size_t i = firstModel; i < this->GeometricModels.size(); ++i)
   {
+    OSPGeometricModel g = this->GeometricModels[i];
     OSPGroup group = ospNewGroup();
     OSPData data = ospNewCopyData1D(&g, OSP_GEOMETRIC_MODEL, 1);
     ospCommit(data);
-    ospRelease(g);
     ospSetObject(group, "geometry", data);
     ospCommit(group);
     ospRelease(data);
     OSPInstance instance = ospNewInstance(group); // valgrind reports instance is lost
     ospCommit(instance);
-    ospRelease(group);
     this->Instances.emplace_back(instance);
+    // the model and group are retained (instead of released here) so that
+    // UpdateActorMaterial can recommit a new material onto them later
+    this->Groups.emplace_back(group);
   }
+}
 
-  this->GeometricModels.clear();
+//------------------------------------------------------------------------------
+bool vtkOSPRayPolyDataMapperNode::UpdateActorMaterial(vtkOSPRayActorNode* aNode)
+{
+  if (!this->SingleActorMaterial || this->GeometricModels.empty())
+  {
+    return false;
+  }
+
+  vtkActor* act = vtkActor::SafeDownCast(aNode->GetRenderable());
+  vtkProperty* property = act->GetProperty();
+
+  // the property MTime alone cannot tell a color change from, say, a
+  // representation change, so the geometry shaping state has to still match
+  // the retained build
+  if (property->GetRepresentation() != this->BuildRepresentation ||
+    property->GetInterpolation() != this->BuildInterpolation ||
+    property->GetPointSize() != this->BuildPointSize ||
+    property->GetLineWidth() != this->BuildLineWidth ||
+    property->GetVertexVisibility() != this->BuildVertexVisibility ||
+    property->GetEdgeVisibility() || property->GetMaterialName())
+  {
+    return false;
+  }
+
+  // textures are fused into the geometric models; adding one needs a rebuild
+  vtkTexture* texture =
+    (property->GetInterpolation() == VTK_PBR) ? property->GetTexture("albedoTex")
+                                              : act->GetTexture();
+  if (texture || property->GetTexture("normalTex"))
+  {
+    return false;
+  }
+
+  vtkOSPRayRendererNode* orn =
+    static_cast<vtkOSPRayRendererNode*>(this->GetFirstAncestorOfType("vtkOSPRayRendererNode"));
+  RTW::Backend* backend = orn->GetBackend();
+  if (backend == nullptr)
+  {
+    return false;
+  }
+  OSPRenderer oRenderer = static_cast<OSPRenderer>(orn->GetORenderer());
+
+  double ambient[3];
+  double diffuse[3];
+  property->GetAmbientColor(ambient);
+  property->GetDiffuseColor(diffuse);
+  float specularf[3];
+  const std::string rendererType =
+    orn->GetRendererType(vtkRenderer::SafeDownCast(orn->GetRenderable()));
+  bool pt_avail =
+    rendererType == std::string("pathtracer") || rendererType == std::string("optix pathtracer");
+  bool useCustomMaterial = false;
+  std::map<std::string, OSPMaterial> mats;
+  OSPMaterial oMaterial = vtkosp::MakeActorMaterial(orn, oRenderer, property, ambient, diffuse,
+    specularf, property->GetOpacity(), pt_avail, useCustomMaterial, mats, "");
+  ospCommit(oMaterial);
+
+  for (auto g : this->GeometricModels)
+  {
+    ospSetObjectAsData(g, "material", OSP_MATERIAL, oMaterial);
+    ospCommit(g);
+  }
+  ospRelease(oMaterial);
+  for (auto group : this->Groups)
+  {
+    ospCommit(group);
+  }
+  for (auto instance : this->Instances)
+  {
+    ospCommit(instance);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkOSPRayPolyDataMapperNode::GetGeometryTime(vtkActor* act, vtkPolyData* poly)
+{
+  // deliberately leaves out the property, backface property and textures
+  // that vtkActor::GetMTime folds in; those only affect appearance
+  vtkMTimeType gTime = act->vtkProp3D::GetMTime();
+  vtkMapper* mapper = act->GetMapper();
+  if (mapper)
+  {
+    if (mapper->GetMTime() > gTime)
+    {
+      gTime = mapper->GetMTime();
+    }
+    if (mapper->GetInformation()->GetMTime() > gTime)
+    {
+      gTime = mapper->GetInformation()->GetMTime();
+    }
+    vtkPiecewiseFunction* pwf = vtkPiecewiseFunction::SafeDownCast(
+      mapper->GetInformation()->Get(vtkOSPRayActorNode::SCALE_FUNCTION()));
+    if (pwf && pwf->GetMTime() > gTime)
+    {
+      gTime = pwf->GetMTime();
+    }
+  }
+  if (poly && poly->GetMTime() > gTime)
+  {
+    gTime = poly->GetMTime();
+  }
+  return gTime;
 }
 
 //------------------------------------------------------------------------------
@@ -1333,6 +1454,7 @@ void vtkOSPRayPolyDataMapperNode::Invalidate(bool prepass)
   if (prepass)
   {
     this->RenderTime = 0;
+    this->GeometryTime = 0;
   }
 }
 
@@ -1360,8 +1482,6 @@ void vtkOSPRayPolyDataMapperNode::Render(bool prepass)
       this->RenderGeometricModels();
       return;
     }
-    this->RenderTime = inTime;
-    this->ClearGeometricModels();
 
     vtkPolyData* poly = nullptr;
     vtkPolyDataMapper* mapper = vtkPolyDataMapper::SafeDownCast(act->GetMapper());
@@ -1369,6 +1489,22 @@ void vtkOSPRayPolyDataMapperNode::Render(bool prepass)
     {
       poly = mapper->GetInput();
     }
+
+    // when only the appearance changed, recommit the material onto the
+    // retained scene instead of rebuilding, which keeps the acceleration
+    // structures OSPRay built for the geometry warm
+    vtkMTimeType geomTime = this->GetGeometryTime(act, poly);
+    if (this->RenderTime > 0 && this->GeometryTime >= geomTime && this->UpdateActorMaterial(aNode))
+    {
+      this->RenderTime = inTime;
+      this->RenderGeometricModels();
+      return;
+    }
+
+    this->RenderTime = inTime;
+    this->GeometryTime = geomTime;
+    this->ClearGeometricModels();
+
     if (poly)
     {
       vtkProperty* property = act->GetProperty();
@@ -1403,9 +1539,20 @@ void vtkOSPRayPolyDataMapperNode::ClearGeometricModels()
 
   RTW::Backend* backend = orn->GetBackend();
 
+  for (auto g : this->GeometricModels)
+  {
+    ospRelease(g);
+  }
+  this->GeometricModels.clear();
+  for (auto group : this->Groups)
+  {
+    ospRelease(group);
+  }
+  this->Groups.clear();
   for (auto instance : this->Instances)
   {
     ospRelease(instance);
   }
   this->Instances.clear();
+  this->SingleActorMaterial = false;
 }
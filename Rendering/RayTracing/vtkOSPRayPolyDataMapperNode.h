@@ -26,6 +26,7 @@
 #include "vtkPolyDataMapperNode.h"
 #include "vtkRenderingRayTracingModule.h" // For export macro
 
+class vtkActor;
 class vtkOSPRayActorNode;
 class vtkPolyData;
 
@@ -53,10 +54,41 @@ protected:
   void ORenderPoly(void* renderer, vtkOSPRayActorNode* aNode, vtkPolyData* poly,
     double* ambientColor, double* diffuseColor, double opacity, std::string material);
 
+  /**
+   * Recommit the actor level material onto the scene retained from the last
+   * full translation, keeping the geometry and the acceleration structures
+   * OSPRay built for it. Returns false when the retained scene cannot absorb
+   * the change (scalar coloring, textures, custom materials, or a property
+   * edit that reshapes the geometry), in which case the caller has to
+   * rebuild.
+   */
+  bool UpdateActorMaterial(vtkOSPRayActorNode* aNode);
+
+  /**
+   * Time of the most recent geometry affecting modification, i.e. the actor
+   * node's MTime without the appearance-only inputs (property, textures).
+   */
+  vtkMTimeType GetGeometryTime(vtkActor* act, vtkPolyData* poly);
+
   std::vector<OSPGeometricModel> GeometricModels;
+  std::vector<OSPGroup> Groups;
   std::vector<OSPInstance> Instances;
   void ClearGeometricModels();
 
+  ///@{
+  /**
+   * State captured during the last full translation that decides whether an
+   * appearance-only change can be recommitted onto the retained geometry.
+   */
+  vtkMTimeType GeometryTime{ 0 };
+  bool SingleActorMaterial{ false };
+  int BuildRepresentation{ -1 };
+  int BuildInterpolation{ -1 };
+  double BuildPointSize{ -1.0 };
+  double BuildLineWidth{ -1.0 };
+  vtkTypeBool BuildVertexVisibility{ false };
+  ///@}
+
   /**
    * @brief add precomputed ospray geometries to renderer model.
    */
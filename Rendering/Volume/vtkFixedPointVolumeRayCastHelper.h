@@ -944,9 +944,10 @@
   vtkIdType dDHinc = dim[0] * dirOffset + dirOffset;
 
 #define VTKKWRCHelper_OuterInitialization()                                                        \
-  if (j % threadCount != threadID)                                                                 \
+  j = mapper->ClaimNextRayCastRow();                                                               \
+  if (j < 0)                                                                                       \
   {                                                                                                \
-    continue;                                                                                      \
+    break;                                                                                         \
   }                                                                                                \
   if (!threadID)                                                                                   \
   {                                                                                                \
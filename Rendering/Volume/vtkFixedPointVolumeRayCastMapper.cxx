@@ -582,6 +582,7 @@ vtkFixedPointVolumeRayCastMapper::vtkFixedPointVolumeRayCastMapper()
 
   this->Threader = vtkMultiThreader::New();
   this->ThreadWarning = true;
+  this->NextRayCastRow = 0;
   this->RayCastImage = vtkFixedPointRayCastImage::New();
 
   this->RowBounds = nullptr;
@@ -1218,11 +1219,24 @@ void vtkFixedPointVolumeRayCastMapper::RenderSubVolume()
   // Set the number of threads to use for ray casting,
   // then set the execution method and do it.
   this->InvokeEvent(vtkCommand::VolumeMapperRenderStartEvent, nullptr);
+  this->NextRayCastRow = 0;
   this->Threader->SetSingleMethod(FixedPointVolumeRayCastMapper_CastRays, (void*)this);
   this->Threader->SingleMethodExecute();
   this->InvokeEvent(vtkCommand::VolumeMapperRenderEndEvent, nullptr);
 }
 
+// Hand out image rows to the ray casting threads. Rows vary widely in cost
+// due to early ray termination and space leaping, so pulling them from a
+// shared counter keeps the threads busy until the whole image is done.
+int vtkFixedPointVolumeRayCastMapper::ClaimNextRayCastRow()
+{
+  int size[2];
+  this->RayCastImage->GetImageInUseSize(size);
+
+  int row = this->NextRayCastRow++;
+  return (row < size[1]) ? row : -1;
+}
+
 // This method displays the image that has been created
 void vtkFixedPointVolumeRayCastMapper::DisplayRenderedImage(vtkRenderer* ren, vtkVolume* vol)
 {
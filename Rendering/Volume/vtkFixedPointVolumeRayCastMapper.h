@@ -60,6 +60,8 @@
 #include "vtkThreads.h"               // for VTK_THREAD_RETURN_TYPE
 #include "vtkVolumeMapper.h"
 
+#include <atomic> // for std::atomic
+
 #define VTKKW_FP_SHIFT 15
 #define VTKKW_FPMM_SHIFT 17
 #define VTKKW_FP_MASK 0x7fff
@@ -267,6 +269,15 @@ public:
 
   void InitializeRayInfo(vtkVolume* vol);
 
+  /**
+   * WARNING: INTERNAL METHOD - NOT INTENDED FOR GENERAL USE
+   * Claim the next image row to be ray cast. The render threads pull rows
+   * from a shared counter one at a time so that they stay load balanced
+   * even when the rays in some rows terminate much earlier than in others.
+   * Returns the row index, or -1 once every row has been claimed.
+   */
+  int ClaimNextRayCastRow();
+
   int ShouldUseNearestNeighborInterpolation(vtkVolume* vol);
 
   ///@{
@@ -370,6 +381,9 @@ protected:
 
   vtkMultiThreader* Threader;
 
+  // Shared row counter the render threads pull from while casting rays
+  std::atomic<int> NextRayCastRow;
+
   vtkMatrix4x4* PerspectiveMatrix;
   vtkMatrix4x4* ViewToWorldMatrix;
   vtkMatrix4x4* ViewToVoxelsMatrix;
@@ -54,6 +54,7 @@ vtkGPUVolumeRayCastMapper::vtkGPUVolumeRayCastMapper()
   this->ClampDepthToBackface = 0;
   this->UseJittering = 0;
   this->UseDepthPass = 0;
+  this->UseTemporalReuse = 0;
   this->DepthPassContourValues = nullptr;
   this->SampleDistance = 1.0;
   this->SmallVolumeRender = 0;
@@ -617,6 +618,7 @@ void vtkGPUVolumeRayCastMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "MaxMemoryInBytes: " << this->MaxMemoryInBytes << endl;
   os << indent << "MaxMemoryFraction: " << this->MaxMemoryFraction << endl;
   os << indent << "ReportProgress: " << this->ReportProgress << endl;
+  os << indent << "UseTemporalReuse: " << this->UseTemporalReuse << endl;
 }
 
 //------------------------------------------------------------------------------
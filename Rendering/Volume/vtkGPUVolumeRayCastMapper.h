@@ -94,6 +94,21 @@ public:
   vtkBooleanMacro(UseDepthPass, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * If UseTemporalReuse is on, the mapper keeps the ray-cast result of the
+   * previous frame in a texture and redraws that texture instead of casting
+   * rays again whenever the camera, the volume, its property, the lights and
+   * the viewport are all unchanged. This makes renders triggered by changes
+   * elsewhere in the scene essentially free for the volume, at the cost of
+   * one screen-sized RGBA texture. It has no effect on RenderToImage mode or
+   * during picking. Default is off.
+   */
+  vtkSetClampMacro(UseTemporalReuse, vtkTypeBool, 0, 1);
+  vtkGetMacro(UseTemporalReuse, vtkTypeBool);
+  vtkBooleanMacro(UseTemporalReuse, vtkTypeBool);
+  ///@}
+
   /**
    * Return handle to contour values container so
    * that values can be set by the application. Contour values
@@ -556,6 +571,7 @@ protected:
 
   // Enable / disable two pass rendering
   vtkTypeBool UseDepthPass;
+  vtkTypeBool UseTemporalReuse;
   vtkContourValues* DepthPassContourValues;
 
   // The distance between sample points along the ray
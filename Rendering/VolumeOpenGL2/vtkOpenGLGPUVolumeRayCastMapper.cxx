@@ -391,6 +391,19 @@ public:
   size_t GetNumImageSampleDrawBuffers(vtkVolume* vol);
   //@}
 
+  //@{
+  /**
+   * Frame reuse (UseTemporalReuse). ComputeFrameSignature folds the MTimes of
+   * everything that affects the ray-cast image into a single value;
+   * CanReuseCachedFrame compares it against the signature recorded when the
+   * ImageSample framebuffer was last rendered. DrawImageSampleQuad blits the
+   * framebuffer contents to the screen and is shared with EndImageSample.
+   */
+  vtkMTimeType ComputeFrameSignature(vtkRenderer* ren, vtkVolume* vol);
+  bool CanReuseCachedFrame(vtkRenderer* ren, vtkVolume* vol);
+  void DrawImageSampleQuad(vtkRenderer* ren);
+  //@}
+
   //@{
   /**
    * Allocate and update input data. A list of active ports is maintained
@@ -506,6 +519,10 @@ public:
   bool RebuildImageSampleProg = false;
   bool RenderPassAttached = false;
 
+  bool CachedFrameValid = false;
+  vtkMTimeType CachedFrameSignature = 0;
+  int CachedFrameWindowSize[2] = { 0, 0 };
+
   bool Transfer2DUseGradient = true;
   vtkSmartPointer<vtkVolumeTexture> Transfer2DYAxisScalars;
   vtkTimeStamp Transfer2DYAxisScalarsUpdateTime;
@@ -1657,7 +1674,8 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::BeginImageSample(vtkRenderer*
   }
 
   float const xySampleDist = this->Parent->ImageSampleDistance;
-  if (xySampleDist != 1.f && this->InitializeImageSampleFBO(ren))
+  if ((xySampleDist != 1.f || this->Parent->UseTemporalReuse) &&
+    this->InitializeImageSampleFBO(ren))
   {
     this->ImageSampleFBO->GetContext()->GetState()->PushDrawFramebufferBinding();
     this->ImageSampleFBO->Bind(GL_DRAW_FRAMEBUFFER);
@@ -1753,7 +1771,7 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::InitializeImageSampleFBO(vtkR
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* ren)
 {
-  if (this->Parent->ImageSampleDistance != 1.f)
+  if (this->Parent->ImageSampleDistance != 1.f || this->Parent->UseTemporalReuse)
   {
     this->ImageSampleFBO->DeactivateDrawBuffers();
     if (this->RenderPassAttached)
@@ -1764,74 +1782,120 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* r
     vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
     win->GetState()->PopDrawFramebufferBinding();
 
-    // Render the contents of ImageSampleFBO as a quad to intermix with the
-    // rest of the scene.
-    typedef vtkOpenGLRenderUtilities GLUtil;
+    this->DrawImageSampleQuad(ren);
+  }
+}
 
-    if (this->RebuildImageSampleProg)
-    {
-      std::string frag = GLUtil::GetFullScreenQuadFragmentShaderTemplate();
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::DrawImageSampleQuad(vtkRenderer* ren)
+{
+  vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
 
-      vtkShaderProgram::Substitute(frag, "//VTK::FSQ::Decl",
-        vtkvolume::ImageSampleDeclarationFrag(
-          this->ImageSampleTexNames, this->NumImageSampleDrawBuffers));
-      vtkShaderProgram::Substitute(frag, "//VTK::FSQ::Impl",
-        vtkvolume::ImageSampleImplementationFrag(
-          this->ImageSampleTexNames, this->NumImageSampleDrawBuffers));
+  // Render the contents of ImageSampleFBO as a quad to intermix with the
+  // rest of the scene.
+  typedef vtkOpenGLRenderUtilities GLUtil;
 
-      this->ImageSampleProg =
-        win->GetShaderCache()->ReadyShaderProgram(GLUtil::GetFullScreenQuadVertexShader().c_str(),
-          frag.c_str(), GLUtil::GetFullScreenQuadGeometryShader().c_str());
-    }
-    else
-    {
-      win->GetShaderCache()->ReadyShaderProgram(this->ImageSampleProg);
-    }
+  if (this->RebuildImageSampleProg)
+  {
+    std::string frag = GLUtil::GetFullScreenQuadFragmentShaderTemplate();
 
-    if (!this->ImageSampleProg)
-    {
-      vtkGenericWarningMacro(<< "Failed to initialize ImageSampleProgram!");
-      return;
-    }
+    vtkShaderProgram::Substitute(frag, "//VTK::FSQ::Decl",
+      vtkvolume::ImageSampleDeclarationFrag(
+        this->ImageSampleTexNames, this->NumImageSampleDrawBuffers));
+    vtkShaderProgram::Substitute(frag, "//VTK::FSQ::Impl",
+      vtkvolume::ImageSampleImplementationFrag(
+        this->ImageSampleTexNames, this->NumImageSampleDrawBuffers));
 
-    if (!this->ImageSampleVAO)
-    {
-      this->ImageSampleVAO = vtkOpenGLVertexArrayObject::New();
-      GLUtil::PrepFullScreenVAO(win, this->ImageSampleVAO, this->ImageSampleProg);
-    }
+    this->ImageSampleProg =
+      win->GetShaderCache()->ReadyShaderProgram(GLUtil::GetFullScreenQuadVertexShader().c_str(),
+        frag.c_str(), GLUtil::GetFullScreenQuadGeometryShader().c_str());
+  }
+  else
+  {
+    win->GetShaderCache()->ReadyShaderProgram(this->ImageSampleProg);
+  }
 
-    vtkOpenGLState* ostate = win->GetState();
+  if (!this->ImageSampleProg)
+  {
+    vtkGenericWarningMacro(<< "Failed to initialize ImageSampleProgram!");
+    return;
+  }
 
-    // Adjust the GL viewport to VTK's defined viewport
-    ren->GetTiledSizeAndOrigin(
-      this->WindowSize, this->WindowSize + 1, this->WindowLowerLeft, this->WindowLowerLeft + 1);
-    ostate->vtkglViewport(
-      this->WindowLowerLeft[0], this->WindowLowerLeft[1], this->WindowSize[0], this->WindowSize[1]);
+  if (!this->ImageSampleVAO)
+  {
+    this->ImageSampleVAO = vtkOpenGLVertexArrayObject::New();
+    GLUtil::PrepFullScreenVAO(win, this->ImageSampleVAO, this->ImageSampleProg);
+  }
 
-    // Bind objects and draw
-    ostate->vtkglEnable(GL_BLEND);
-    ostate->vtkglBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-    ostate->vtkglDisable(GL_DEPTH_TEST);
+  vtkOpenGLState* ostate = win->GetState();
 
-    for (size_t i = 0; i < this->NumImageSampleDrawBuffers; i++)
-    {
-      this->ImageSampleTexture[i]->Activate();
-      this->ImageSampleProg->SetUniformi(
-        this->ImageSampleTexNames[i].c_str(), this->ImageSampleTexture[i]->GetTextureUnit());
-    }
+  // Adjust the GL viewport to VTK's defined viewport
+  ren->GetTiledSizeAndOrigin(
+    this->WindowSize, this->WindowSize + 1, this->WindowLowerLeft, this->WindowLowerLeft + 1);
+  ostate->vtkglViewport(
+    this->WindowLowerLeft[0], this->WindowLowerLeft[1], this->WindowSize[0], this->WindowSize[1]);
 
-    this->ImageSampleVAO->Bind();
-    GLUtil::DrawFullScreenQuad();
-    this->ImageSampleVAO->Release();
-    vtkOpenGLStaticCheckErrorMacro("Error after DrawFullScreenQuad()!");
+  // Bind objects and draw
+  ostate->vtkglEnable(GL_BLEND);
+  ostate->vtkglBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  ostate->vtkglDisable(GL_DEPTH_TEST);
 
-    for (auto& tex : this->ImageSampleTexture)
-    {
-      tex->Deactivate();
-    }
+  for (size_t i = 0; i < this->NumImageSampleDrawBuffers; i++)
+  {
+    this->ImageSampleTexture[i]->Activate();
+    this->ImageSampleProg->SetUniformi(
+      this->ImageSampleTexNames[i].c_str(), this->ImageSampleTexture[i]->GetTextureUnit());
+  }
+
+  this->ImageSampleVAO->Bind();
+  GLUtil::DrawFullScreenQuad();
+  this->ImageSampleVAO->Release();
+  vtkOpenGLStaticCheckErrorMacro("Error after DrawFullScreenQuad()!");
+
+  for (auto& tex : this->ImageSampleTexture)
+  {
+    tex->Deactivate();
   }
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::ComputeFrameSignature(
+  vtkRenderer* ren, vtkVolume* vol)
+{
+  // Modifying any of these objects pushes its MTime past the global maximum
+  // recorded here, so an unchanged signature means an unchanged image.
+  vtkMTimeType signature = this->Parent->GetMTime();
+  signature = std::max(signature, ren->GetActiveCamera()->GetMTime());
+  signature = std::max(signature, vol->GetMTime());
+  if (vol->GetProperty())
+  {
+    signature = std::max(signature, vol->GetProperty()->GetMTime());
+  }
+  if (vtkDataSet* input = this->Parent->GetInput(0))
+  {
+    signature = std::max(signature, input->GetMTime());
+  }
+  signature = std::max(signature, this->LastModifiedLightTime(ren->GetLights()));
+  return signature;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::CanReuseCachedFrame(
+  vtkRenderer* ren, vtkVolume* vol)
+{
+  if (!this->CachedFrameValid || !this->ImageSampleFBO || this->NeedToInitializeResources ||
+    this->RenderPassAttached || this->PreserveViewport)
+  {
+    return false;
+  }
+  if (this->CachedFrameWindowSize[0] != this->WindowSize[0] ||
+    this->CachedFrameWindowSize[1] != this->WindowSize[1])
+  {
+    return false;
+  }
+  return this->ComputeFrameSignature(ren, vol) == this->CachedFrameSignature;
+}
+
 //------------------------------------------------------------------------------
 size_t vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::GetNumImageSampleDrawBuffers(vtkVolume* vol)
 {
@@ -2152,6 +2216,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal ::ReleaseImageSampleGraphicsRe
 
     // Do not delete the shader program - Let the cache clean it up.
     this->ImageSampleProg = nullptr;
+    this->CachedFrameValid = false;
   }
 }
 
@@ -3257,11 +3322,27 @@ void vtkOpenGLGPUVolumeRayCastMapper::GPURender(vtkRenderer* ren, vtkVolume* vol
       this->DoGPURender(ren, cam, this->Impl->ShaderProgram, shaderProperty);
       this->Impl->ExitRenderToTexture(ren);
     }
+    else if (this->UseTemporalReuse && !this->Impl->IsPicking && !this->Impl->MultiVolume &&
+      this->Impl->CanReuseCachedFrame(ren, vol))
+    {
+      // The scene changed but this volume's image did not: redraw the
+      // previous frame's ray-cast result instead of casting rays again.
+      this->Impl->DrawImageSampleQuad(ren);
+    }
     else
     {
       this->Impl->BeginImageSample(ren);
       this->DoGPURender(ren, cam, this->Impl->ShaderProgram, shaderProperty);
       this->Impl->EndImageSample(ren);
+
+      if (this->UseTemporalReuse && !this->Impl->IsPicking && !this->Impl->MultiVolume &&
+        this->Impl->ImageSampleFBO)
+      {
+        this->Impl->CachedFrameSignature = this->Impl->ComputeFrameSignature(ren, vol);
+        this->Impl->CachedFrameWindowSize[0] = this->Impl->WindowSize[0];
+        this->Impl->CachedFrameWindowSize[1] = this->Impl->WindowSize[1];
+        this->Impl->CachedFrameValid = true;
+      }
     }
 
     if (this->Impl->IsPicking && !this->Impl->MultiVolume)
@@ -268,6 +268,44 @@ std::string BaseDeclarationFragment(vtkRenderer* vtkNotUsed(ren), vtkVolumeMappe
 
   toShaderStr << "vec4 g_eyePosObjs[" << numInputs << "];\n";
 
+  if (numInputs > 1)
+  {
+    // Multi-volume: the ray is transformed into each input's texture
+    // coordinates once per ray (see BaseInit) rather than once per sample.
+    toShaderStr << "vec3 g_texPos0[" << numInputs
+                << "];\n"
+                   "vec3 g_texDirStep["
+                << numInputs
+                << "];\n"
+                   "vec2 g_texInterval["
+                << numInputs
+                << "];\n"
+                   "float g_maxVolumeT = 0.0;\n"
+                   "\n"
+                   "// Intersect the ray point0 + t * stepDir with the unit box [0, 1]^3 and\n"
+                   "// return the step interval [tEntry, tExit] over which the ray overlaps\n"
+                   "// the box (empty when tEntry > tExit).\n"
+                   "vec2 rayBoxIntersection(vec3 point0, vec3 stepDir)\n"
+                   "{\n"
+                   "  vec2 interval = vec2(0.0, 1e20);\n"
+                   "  for (int axis = 0; axis < 3; ++axis)\n"
+                   "  {\n"
+                   "    if (abs(stepDir[axis]) > 1e-12)\n"
+                   "    {\n"
+                   "      float t0 = (0.0 - point0[axis]) / stepDir[axis];\n"
+                   "      float t1 = (1.0 - point0[axis]) / stepDir[axis];\n"
+                   "      interval.x = max(interval.x, min(t0, t1));\n"
+                   "      interval.y = min(interval.y, max(t0, t1));\n"
+                   "    }\n"
+                   "    else if (point0[axis] < 0.0 || point0[axis] > 1.0)\n"
+                   "    {\n"
+                   "      interval = vec2(1.0, -1.0);\n"
+                   "    }\n"
+                   "  }\n"
+                   "  return interval;\n"
+                   "}\n";
+  }
+
   const bool hasGradientOpacity = HasGradientOpacity(inputs);
   if (totalNumberOfLights > 0 || hasGradientOpacity)
   {
@@ -492,6 +530,36 @@ std::string BaseInit(vtkRenderer* vtkNotUsed(ren), vtkVolumeMapper* mapper,
       \n  // Flag to determine if voxel should be considered for the rendering\
       \n  g_skip = false;";
 
+  if (numInputs > 1)
+  {
+    shaderStr << "\
+        \n  // Transform the ray into each input's texture coordinates once per\
+        \n  // ray (instead of transforming every sample) and compute the step\
+        \n  // interval over which the ray overlaps each input, so that samples\
+        \n  // outside an input are skipped without any matrix or texture work.";
+    for (int i = 0; i < numInputs; ++i)
+    {
+      // In multi-volume case the first volume matrix is of the bounding box
+      const int idx = i + 1;
+      shaderStr << "\
+        \n  {\
+        \n    mat4 dataPosToTexPos = in_cellToPoint["
+                << idx << "] * in_inverseTextureDatasetMatrix[" << idx << "] *\
+        \n      in_inverseVolumeMatrix["
+                << idx << "] * in_volumeMatrix[0] * in_textureDatasetMatrix[0];\
+        \n    g_texPos0["
+                << i << "] = (dataPosToTexPos * vec4(g_rayOrigin, 1.0)).xyz;\
+        \n    g_texDirStep["
+                << i << "] = (dataPosToTexPos * vec4(g_dirStep, 0.0)).xyz;\
+        \n    g_texInterval["
+                << i << "] = rayBoxIntersection(g_texPos0[" << i << "], g_texDirStep[" << i
+                << "]);\
+        \n    g_maxVolumeT = max(g_maxVolumeT, g_texInterval["
+                << i << "].y);\
+        \n  }";
+    }
+  }
+
   if (vol->GetProperty()->GetShade() && defaultLighting)
   {
     shaderStr << "\
@@ -2510,7 +2578,13 @@ std::string ShadingMultipleInputs(
   vtkVolumeMapper* mapper, vtkOpenGLGPUVolumeRayCastMapper::VolumeInputMap& inputs)
 {
   std::ostringstream toShaderStr;
-  toShaderStr << "    if (!g_skip)\n"
+  toShaderStr << "    if (g_currentT > g_maxVolumeT)\n"
+                 "    {\n"
+                 "      // The ray is past the exit point of every input: nothing is\n"
+                 "      // left to composite.\n"
+                 "      break;\n"
+                 "    }\n"
+                 "    if (!g_skip)\n"
                  "    {\n"
                  "      vec3 texPos;\n";
 
@@ -2524,17 +2598,20 @@ std::string ShadingMultipleInputs(
       {
         auto& input = item.second;
         auto property = input.Volume->GetProperty();
-        // Transformation index. Index 0 refers to the global bounding-box.
-        const auto idx = i + 1;
         toShaderStr <<
-          // From global texture coordinates (bbox) to volume_i texture coords.
-          // texPos = T * g_dataPos
-          // T = T_dataToTex1 * T_worldToData * T_bboxTexToWorld;
-          "      texPos = (in_cellToPoint[" << idx << "] * in_inverseTextureDatasetMatrix[" << idx
-                    << "] * in_inverseVolumeMatrix[" << idx
-                    << "] *\n"
-                       "        in_volumeMatrix[0] * in_textureDatasetMatrix[0] * "
-                       "vec4(g_dataPos.xyz, 1.0)).xyz;\n"
+          // The ray was transformed into volume_i texture coordinates once per
+          // ray (//VTK::Base::Init): stepping by the sample count avoids a mat4
+          // multiply per sample, and the precomputed overlap interval skips the
+          // input entirely while the ray is outside of it.
+          "      if (g_currentT >= g_texInterval[" << i
+                    << "].x &&\n"
+                       "        g_currentT <= g_texInterval["
+                    << i
+                    << "].y)\n"
+                       "      {\n"
+                       "      texPos = g_texPos0["
+                    << i << "] + g_currentT * g_texDirStep[" << i
+                    << "];\n"
                        "      if ((all(lessThanEqual(texPos, vec3(1.0))) &&\n"
                        "        all(greaterThanEqual(texPos, vec3(0.0)))))\n"
                        "      {\n"
@@ -2598,6 +2675,7 @@ std::string ShadingMultipleInputs(
           << "          g_srcColor.rgb *= g_srcColor.a;\n"
              "          g_fragColor = (1.0f - g_fragColor.a) * g_srcColor + g_fragColor;\n"
              "        }\n"
+             "      }\n"
              "      }\n\n";
 
         i++;
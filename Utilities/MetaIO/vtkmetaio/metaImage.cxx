@@ -2331,11 +2331,57 @@ MetaImage::M_ReadElements(std::ifstream * _fstream, void * _data, std::streamoff
       _fstream->seekg(0, std::ios::beg);
     }
 
-    auto * compr = new unsigned char[static_cast<size_t>(m_CompressedDataSize)];
-
-    M_ReadElementData(_fstream, compr, m_CompressedDataSize);
-
-    MET_PerformUncompression(compr, m_CompressedDataSize, static_cast<unsigned char *>(_data), readSize);
+    // Inflate the file a bounded chunk at a time instead of reading the whole
+    // compressed payload into memory first: peak memory stays bounded by the
+    // chunk size and decompression overlaps the file reads.
+    static const std::streamoff MaxInflateChunk = 64 * 1024 * 1024;
+    std::streamoff comprChunkSize = std::min(m_CompressedDataSize, MaxInflateChunk);
+    auto * compr = new unsigned char[static_cast<size_t>(comprChunkSize)];
+
+    z_stream d_stream;
+    d_stream.zalloc = (alloc_func) nullptr;
+    d_stream.zfree = (free_func) nullptr;
+    d_stream.opaque = (voidpf) nullptr;
+    inflateInit2(&d_stream, 47); // allow both gzip and zlib compression headers
+
+    std::streamoff sourceRemaining = m_CompressedDataSize;
+    std::streamoff dest_pos = 0;
+    int            err = Z_OK;
+    while (sourceRemaining > 0 && err >= 0 && err != Z_STREAM_END && dest_pos < readSize)
+    {
+      std::streamoff chunkToRead = std::min(sourceRemaining, comprChunkSize);
+      _fstream->read(reinterpret_cast<char *>(compr), static_cast<size_t>(chunkToRead));
+      std::streamsize numberOfBytesRead = _fstream->gcount();
+      if (numberOfBytesRead <= 0)
+      {
+        break;
+      }
+      sourceRemaining -= numberOfBytesRead;
+      d_stream.next_in = compr;
+      d_stream.avail_in = static_cast<uInt>(numberOfBytesRead);
+      do
+      {
+        uInt availOut = static_cast<uInt>(std::min(readSize - dest_pos, MaxIOChunk));
+        if (availOut == 0)
+        {
+          break;
+        }
+        d_stream.next_out = static_cast<unsigned char *>(_data) + dest_pos;
+        d_stream.avail_out = availOut;
+        err = inflate(&d_stream, Z_NO_FLUSH);
+        dest_pos += availOut - d_stream.avail_out;
+        if (err == Z_STREAM_END || err < 0)
+        {
+          if (err != Z_STREAM_END && err != Z_BUF_ERROR) // Z_BUF_ERROR means there is still data to
+          {                                              // uncompress, but no space left in buffer;
+                                                         // non-fatal
+            std::cerr << "MetaImage: M_ReadElements: uncompress failed" << std::endl;
+          }
+          break;
+        }
+      } while (d_stream.avail_out == 0);
+    }
+    inflateEnd(&d_stream);
 
     if (compressedDataDeterminedFromFile)
     {
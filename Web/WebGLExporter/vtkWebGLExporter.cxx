@@ -38,6 +38,7 @@
 #include "vtkPolyDataNormals.h"
 #include "vtkProperty.h"
 #include "vtkProperty2D.h"
+#include "vtkQuadricClustering.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkRendererCollection.h"
@@ -84,6 +85,7 @@ vtkWebGLExporter::vtkWebGLExporter()
 {
   this->meshObjMaxSize = 65532 / 3;
   this->lineObjMaxSize = 65534 / 2;
+  this->maxTriangles = 0;
   this->Internal = new vtkInternal();
   this->TriangleFilter = nullptr;
   this->GradientBackground = false;
@@ -131,6 +133,11 @@ void vtkWebGLExporter::SetMaxAllowedSize(int size)
   this->SetMaxAllowedSize(size, size);
 }
 
+void vtkWebGLExporter::SetMaxNumberOfTriangles(int size)
+{
+  this->maxTriangles = (size < 0 ? 0 : size);
+}
+
 void vtkWebGLExporter::SetCenterOfRotation(float a1, float a2, float a3)
 {
   this->CenterOfRotation[0] = a1;
@@ -564,6 +571,31 @@ vtkTriangleFilter* vtkWebGLExporter::GetPolyData(vtkMapper* mapper, vtkMTimeType
   this->TriangleFilter = vtkTriangleFilter::New();
   this->TriangleFilter->SetInputData(dataset);
   this->TriangleFilter->Update();
+
+  // Apply the server-side triangle budget: when the triangulated dataset is
+  // larger than the budget, reduce it with quadric clustering before it is
+  // split into WebGL parts, so remote clients get a smaller download.
+  if (this->maxTriangles > 0 &&
+    this->TriangleFilter->GetOutput()->GetNumberOfPolys() > this->maxTriangles)
+  {
+    // Pick the bin resolution so that the occupied bins produce roughly the
+    // requested number of triangles.
+    int divisions = 2;
+    while (divisions * divisions * divisions < this->maxTriangles)
+    {
+      divisions++;
+    }
+    vtkQuadricClustering* cluster = vtkQuadricClustering::New();
+    cluster->SetInputData(this->TriangleFilter->GetOutput());
+    cluster->AutoAdjustNumberOfDivisionsOff();
+    cluster->SetNumberOfDivisions(divisions, divisions, divisions);
+    cluster->UseInputPointsOn();
+    cluster->Update();
+    vtkSmartPointer<vtkPolyData> reduced = cluster->GetOutput();
+    cluster->Delete();
+    this->TriangleFilter->SetInputData(reduced);
+    this->TriangleFilter->Update();
+  }
   return this->TriangleFilter;
 }
 
@@ -66,6 +66,10 @@ public:
   void SetCenterOfRotation(float a1, float a2, float a3);
   void SetMaxAllowedSize(int mesh, int lines);
   void SetMaxAllowedSize(int size);
+  // Set a server-side triangle budget: datasets that triangulate to more
+  // faces than this are reduced with quadric clustering before they are
+  // serialized. Zero (the default) disables the reduction.
+  void SetMaxNumberOfTriangles(int size);
   ///@}
 
   static void ComputeMD5(const unsigned char* content, int size, std::string& hash);
@@ -94,6 +98,7 @@ protected:
   std::string SceneId;                // Id of the parsed scene
   float CenterOfRotation[3];          // Center Of Rotation
   int meshObjMaxSize, lineObjMaxSize; // Max size of object allowed (faces)
+  int maxTriangles;                   // Triangle budget for datasets (0 = no reduction)
   std::string renderersMetaData;
   bool hasWidget;
 
@@ -464,6 +464,18 @@ static int PyVTKObject_AsBuffer_GetBuffer(PyObject* obj, Py_buffer* view, int fl
   vtkDataArray* da = vtkDataArray::SafeDownCast(self->vtk_ptr);
   if (da)
   {
+    // For non-AOS layouts (e.g. SOA arrays), GetVoidPointer() silently
+    // exports a deep copy, so a writable view would never write back to
+    // the array. Refuse such views so callers get an explicit error
+    // instead of lost writes; read-only views still work via the copy.
+    if ((flags & PyBUF_WRITABLE) != 0 && !da->HasStandardMemoryLayout())
+    {
+      PyErr_Format(PyExc_BufferError,
+        "Cannot get a writable buffer from %s: the array does not have "
+        "a contiguous memory layout.",
+        Py_TYPE(obj)->tp_name);
+      return -1;
+    }
     void* ptr = da->GetVoidPointer(0);
     Py_ssize_t ntuples = da->GetNumberOfTuples();
     int ncomp = da->GetNumberOfComponents();
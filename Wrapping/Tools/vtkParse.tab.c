@@ -4706,6 +4706,10 @@ static YYRESULTTAG yyuserAction(
         currentFunction->DeprecatedReason = deprecationReason;
         currentFunction->DeprecatedVersion = deprecationVersion;
       }
+      if (getAttributes() & VTK_PARSE_UNBLOCKTHREADS)
+      {
+        currentFunction->IsUnblockThreads = 1;
+      }
       currentFunction->Name =
         (((yyGLRStackItem const*)yyvsp)[YYFILL(-3)].yystate.yysemantics.yysval.str);
       currentFunction->Comment = vtkstrdup(getComment());
@@ -9731,6 +9735,11 @@ static void handle_attribute(const char* att, int pack)
     {
       addAttribute(VTK_PARSE_FILEPATH);
     }
+    else if (l == 19 && strncmp(att, "vtk::unblockthreads", l) == 0 && !args &&
+      role == VTK_PARSE_ATTRIB_DECL)
+    {
+      addAttribute(VTK_PARSE_UNBLOCKTHREADS);
+    }
     else if (l == 15 && strncmp(att, "vtk::deprecated", l) == 0 &&
       (role == VTK_PARSE_ATTRIB_DECL || role == VTK_PARSE_ATTRIB_CLASS ||
         role == VTK_PARSE_ATTRIB_ID))
@@ -9912,6 +9921,13 @@ static void output_function(void)
       currentFunction->DeprecatedVersion = deprecationVersion;
     }
 
+    if (currentFunction->ReturnValue->Attributes & VTK_PARSE_UNBLOCKTHREADS)
+    {
+      /* remove "unblockthreads" attrib from ReturnValue, attach it to function */
+      currentFunction->ReturnValue->Attributes ^= VTK_PARSE_UNBLOCKTHREADS;
+      currentFunction->IsUnblockThreads = 1;
+    }
+
     if (currentFunction->ReturnValue->Type & VTK_PARSE_FRIEND)
     {
       /* remove "friend" specifier from ReturnValue */
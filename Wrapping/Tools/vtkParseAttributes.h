@@ -24,8 +24,9 @@
 #define VTK_PARSE_NEWINSTANCE 0x00000001 /* [[vtk::newinstance]] */
 #define VTK_PARSE_ZEROCOPY 0x00000002    /* [[vtk::zerocopy]] */
 #define VTK_PARSE_FILEPATH 0x00000004    /* [[vtk::filepath]] */
-#define VTK_PARSE_WRAPEXCLUDE 0x00000010 /* [[vtk::wrapexclude]] */
-#define VTK_PARSE_DEPRECATED 0x00000020  /* [[vtk::deprecated()]] */
+#define VTK_PARSE_WRAPEXCLUDE 0x00000010    /* [[vtk::wrapexclude]] */
+#define VTK_PARSE_DEPRECATED 0x00000020     /* [[vtk::deprecated()]] */
+#define VTK_PARSE_UNBLOCKTHREADS 0x00000040 /* [[vtk::unblockthreads]] */
 
 #endif
 /* VTK-HeaderTest-Exclude: vtkParseAttributes.h */
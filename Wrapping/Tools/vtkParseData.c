@@ -160,6 +160,7 @@ void vtkParse_InitFunction(FunctionInfo* func)
   func->IsExplicit = 0;
   func->IsExcluded = 0;
   func->IsDeprecated = 0;
+  func->IsUnblockThreads = 0;
 
 #ifndef VTK_PARSE_LEGACY_REMOVE
   /* everything below here is legacy information, *
@@ -249,6 +250,7 @@ void vtkParse_CopyFunction(FunctionInfo* func, const FunctionInfo* orig)
   func->IsLegacy = orig->IsLegacy;
   func->IsExcluded = orig->IsExcluded;
   func->IsDeprecated = orig->IsDeprecated;
+  func->IsUnblockThreads = orig->IsUnblockThreads;
 
 #ifndef VTK_PARSE_LEGACY_REMOVE
   /* everything below here is legacy information, *
@@ -190,16 +190,17 @@ struct FunctionInfo_
   const char* DeprecatedVersion; /* version of deprecation, or NULL */
   int IsOperator;
   int IsVariadic;
-  int IsExcluded;    /* marked as excluded from wrapping */
-  int IsDeprecated;  /* method or function has been deprecated */
-  int IsStatic;      /* methods only */
-  int IsVirtual;     /* methods only */
-  int IsPureVirtual; /* methods only */
-  int IsConst;       /* methods only */
-  int IsDeleted;     /* methods only */
-  int IsFinal;       /* methods only */
-  int IsOverride;    /* methods only */
-  int IsExplicit;    /* constructors only */
+  int IsExcluded;       /* marked as excluded from wrapping */
+  int IsDeprecated;     /* method or function has been deprecated */
+  int IsUnblockThreads; /* wrappers may release the interpreter lock */
+  int IsStatic;         /* methods only */
+  int IsVirtual;        /* methods only */
+  int IsPureVirtual;    /* methods only */
+  int IsConst;          /* methods only */
+  int IsDeleted;        /* methods only */
+  int IsFinal;          /* methods only */
+  int IsOverride;       /* methods only */
+  int IsExplicit;       /* constructors only */
 #ifndef VTK_PARSE_LEGACY_REMOVE
   int NumberOfArguments;            /* legacy */
   unsigned int ArgTypes[MAX_ARGS];  /* legacy */
@@ -799,12 +799,31 @@ static void vtkWrapPython_GenerateMethodCall(
   ValueInfo* arg;
   int totalArgs;
   int is_constructor;
+  int release_gil;
   int i, k, n;
 
   totalArgs = vtkWrap_CountWrappedParameters(currentFunction);
 
   is_constructor = vtkWrap_IsConstructor(data, currentFunction);
 
+  /* if the method is marked [[vtk::unblockthreads]], release the GIL
+   * around the call so other interpreter threads can make progress;
+   * skip methods that take python callbacks, since those re-enter the
+   * interpreter from within the call */
+  release_gil = currentFunction->IsUnblockThreads;
+  for (i = 0; i < totalArgs && release_gil; i++)
+  {
+    if (vtkWrap_IsFunction(currentFunction->Parameters[i]))
+    {
+      release_gil = 0;
+    }
+  }
+
+  if (release_gil)
+  {
+    fprintf(fp, "    PyThreadState* threadState = PyEval_SaveThread();\n");
+  }
+
   /* for vtkobjects, do a bound call and an unbound call */
   n = 1;
   if (is_vtkobject && !currentFunction->IsStatic && !currentFunction->IsPureVirtual &&
@@ -967,6 +986,11 @@ static void vtkWrapPython_GenerateMethodCall(
     }
   }
 
+  if (release_gil)
+  {
+    fprintf(fp, "    PyEval_RestoreThread(threadState);\n");
+  }
+
   fprintf(fp, "\n");
 }
 